@@ -0,0 +1,91 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "jobqueue.h"
+
+#include "vtkMultiThreader.h"
+#include "vtkMutexLock.h"
+#include "vtkSmartPointer.h"
+
+namespace {
+
+// The state shared by all of the workers
+struct JobQueueState
+{
+  JobQueue::JobFunction Function;
+  void *Data;
+  int NumberOfJobs;
+  int NextJob;
+  vtkSimpleMutexLock Lock;
+};
+
+// The worker, which pulls jobs until none remain
+VTK_THREAD_RETURN_TYPE JobQueueWorker(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *info =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  JobQueueState *state = static_cast<JobQueueState *>(info->UserData);
+
+  for (;;)
+  {
+    state->Lock.Lock();
+    int i = state->NextJob;
+    if (i < state->NumberOfJobs)
+    {
+      state->NextJob++;
+    }
+    state->Lock.Unlock();
+
+    if (i >= state->NumberOfJobs)
+    {
+      break;
+    }
+
+    state->Function(state->Data, i);
+  }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+} // end anonymous namespace
+
+void JobQueue::Run(JobFunction func, void *data, int n, int threads)
+{
+  if (threads > n)
+  {
+    threads = n;
+  }
+
+  if (threads <= 1)
+  {
+    for (int i = 0; i < n; i++)
+    {
+      func(data, i);
+    }
+    return;
+  }
+
+  JobQueueState state;
+  state.Function = func;
+  state.Data = data;
+  state.NumberOfJobs = n;
+  state.NextJob = 0;
+
+  // the calling thread acts as one of the workers
+  vtkSmartPointer<vtkMultiThreader> threader =
+    vtkSmartPointer<vtkMultiThreader>::New();
+  threader->SetNumberOfThreads(threads);
+  threader->SetSingleMethod(JobQueueWorker, &state);
+  threader->SingleMethodExecute();
+}
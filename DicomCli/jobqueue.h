@@ -0,0 +1,30 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef jobqueue_h
+#define jobqueue_h
+
+// Run a set of independent jobs on a pool of worker threads
+class JobQueue
+{
+public:
+  // The function that performs job "i"
+  typedef void (*JobFunction)(void *data, int i);
+
+  // Run jobs 0 to n-1, with at most "threads" jobs running at once.
+  // Each worker takes the lowest-numbered job that hasn't been started.
+  // If "threads" is 1 or less, the jobs are run in order on this thread.
+  static void Run(JobFunction func, void *data, int n, int threads);
+};
+
+#endif /* jobqueue_h */
@@ -14,15 +14,18 @@
 =========================================================================*/
 #include "vtkConsoleOutputWindow.h"
 #include "vtkObjectFactory.h"
+#include "vtkMutexLock.h"
 
 vtkStandardNewMacro(vtkConsoleOutputWindow);
 
 vtkConsoleOutputWindow::vtkConsoleOutputWindow()
 {
+  this->Lock = new vtkSimpleMutexLock;
 }
 
 vtkConsoleOutputWindow::~vtkConsoleOutputWindow()
 {
+  delete this->Lock;
 }
 
 void vtkConsoleOutputWindow::Initialize()
@@ -40,8 +43,10 @@ void vtkConsoleOutputWindow::DisplayText(const char* text)
 {
   if (text)
   {
+    this->Lock->Lock();
     fwrite(text, 1, strlen(text), stderr);
     fputc('\n', stderr);
+    this->Lock->Unlock();
   }
 }
 
@@ -23,6 +23,8 @@
 
 #include "vtkOutputWindow.h"
 
+class vtkSimpleMutexLock;
+
 class vtkConsoleOutputWindow : public vtkOutputWindow
 {
 public:
@@ -42,6 +44,9 @@ protected:
   virtual ~vtkConsoleOutputWindow();
   void Initialize();
 
+  // Keep messages from different threads from being interleaved.
+  vtkSimpleMutexLock *Lock;
+
 private:
 #ifdef VTK_DELETE_FUNCTION
   vtkConsoleOutputWindow(const vtkConsoleOutputWindow&) VTK_DELETE_FUNCTION;
@@ -26,12 +26,15 @@
 
 #include "vtkStringArray.h"
 #include "vtkSmartPointer.h"
+#include "vtkCommand.h"
 
 #ifndef _WIN32
 // includes for execvp
 #include <unistd.h>
 #include <sys/wait.h>
 #include <errno.h>
+// the environment, which counts towards ARG_MAX
+extern char **environ;
 #else
 // includes for spawn
 #include <windows.h>
@@ -72,6 +75,7 @@ void dicomfind_usage(FILE *file, const char *cp)
     "  -name pattern     Set a pattern to match (with \"*\" or \"?\").\n"
     "  -image            Restrict the search to files with PixelData.\n"
     "  -series           Find all files in series if even one file matches.\n"
+    "  -batch            Let -exec ... + take files from many series at once.\n"
     "  -print            Print the filenames of all matched files (default).\n"
     "  -print0           Print the filenames with terminating null, for xargs.\n"
     "  -exec ... +       Execute the given command for every series matched.\n"
@@ -114,7 +118,21 @@ void dicomfind_help(FILE *file, const char *cp)
     "program will be run on each DICOM series and {} will be replaced by all\n"
     "files in the series.  The \"-execdir\" argument is similar, except that\n"
     "it runs the program from within the directory of the file (or files),\n"
-    "and {} is replaced by just the filenames instead of with the full paths.\n\n");
+    "and {} is replaced by just the filenames instead of with the full paths.\n"
+    "\n"
+    "When \"-batch\" is given, \"-exec ... +\" will collect the files from\n"
+    "consecutive series and run the program on as many files as will fit on\n"
+    "the command line, rather than running it once per series.  This is much\n"
+    "faster when there are many small series.  The files for each series\n"
+    "are still kept together and in order, and a series is only split if\n"
+    "it has too many files to fit on the command line by itself.\n"
+    "\n"
+    "If every operation acts on one file at a time (\"-print\", \"-print0\",\n"
+    "or \"-exec ... ;\"), then the files are acted upon as soon as they\n"
+    "are found, rather than after the whole directory has been scanned.\n"
+    "Each series is then still listed in order, but series that are found\n"
+    "a little at a time can be interleaved with each other.  Any \"-exec\n"
+    "... +\" waits for the scan to finish, so that each series is whole.\n\n");
 
 }
 
@@ -321,12 +339,203 @@ std::string dicomfind_getcwd()
 // The type used to store an operation
 struct Operation
 {
-  Operation(const char *type) : Type(type) {}
+  Operation(const char *type) : Type(type), PendingSize(0), MaxSize(0) {}
 
   std::string Type;
   std::vector<std::string> Args;
+
+  // For "-batch", the files waiting to be passed to "-exec ... +"
+  vtkSmartPointer<vtkStringArray> Pending;
+  size_t PendingSize;
+  size_t MaxSize;
 };
 
+// Get the space available for the arguments of a command
+size_t dicomfind_arg_max(const std::vector<std::string>& args)
+{
+#ifndef _WIN32
+  long argmax = sysconf(_SC_ARG_MAX);
+  if (argmax <= 0)
+  {
+    argmax = 131072;
+  }
+  // the environment uses the same space as the arguments
+  size_t used = 0;
+  for (char **ep = environ; *ep != 0; ep++)
+  {
+    used += strlen(*ep) + 1 + sizeof(char *);
+  }
+  // leave some headroom, like xargs does
+  used += 2048;
+#else
+  // the limit is on the length of the command line
+  long argmax = 32767;
+  size_t used = 0;
+#endif
+  for (size_t i = 0; i < args.size(); i++)
+  {
+    used += args[i].length() + 1 + sizeof(char *);
+  }
+  size_t avail = static_cast<size_t>(argmax);
+  avail = (used < avail ? avail - used : 0);
+  // a "+" command always receives at least one file
+  return (avail > 0 ? avail : 1);
+}
+
+// Execute the "-exec ... +" command with the given files as arguments
+void dicomfind_execute_files(
+  const Operation& op, vtkStringArray *sa,
+  const std::string& originalDir)
+{
+  bool execdir = (op.Type == "-execdir");
+
+  // Count the number of times {} appears in exec args
+  size_t subcount = 0;
+  for (size_t jj = 0; jj < op.Args.size(); jj++)
+  {
+    subcount += (op.Args[jj].find("{}") != std::string::npos);
+  }
+
+  // remember the current subdirectory
+  std::string currentSubdir;
+
+  // for execdir, what if series is split across directories?
+  // need to call executable once per directory, using only
+  // the files in that directory.
+  size_t sub_argc = op.Args.size() +
+    subcount*sa->GetNumberOfTuples() - 1;
+  char **sub_argv = new char *[sub_argc+1];
+  std::vector<std::string> temp_args(subcount*sa->GetNumberOfValues());
+  size_t subc = 0;
+
+  // for execdir, keep a list of directories that are done
+  std::vector<std::string> done_dirs;
+  std::string doing_dir;
+
+  bool notdone = true;
+
+  while (notdone)
+  {
+    notdone = false;
+    if (execdir)
+    {
+      bool foundDirToProcess = false;
+      for (vtkIdType kk = 0; kk < sa->GetNumberOfValues(); kk++)
+      {
+        std::string dirname =
+          dicomfind_dirname(sa->GetValue(kk).c_str());
+        if (!foundDirToProcess)
+        {
+          bool dirIsDone = false;
+          for (size_t ll = 0; ll < done_dirs.size(); ll++)
+          {
+            if (dirname == done_dirs[ll])
+            {
+              dirIsDone = true;
+              break;
+            }
+          }
+          if (!dirIsDone)
+          {
+            foundDirToProcess = true;
+            doing_dir = dirname;
+            done_dirs.push_back(dirname);
+            break;
+          }
+        }
+      }
+      if (foundDirToProcess)
+      {
+        notdone = true;
+      }
+      else
+      {
+        break;
+      }
+    }
+
+    size_t ii = 0;
+    size_t nn = op.Args.size()-1;
+    for (size_t jj = 0; jj < nn; jj++)
+    {
+      const std::string& arg = op.Args[jj];
+      size_t pos = arg.find("{}");
+      if (pos != std::string::npos)
+      {
+        for (vtkIdType kk = 0; kk < sa->GetNumberOfValues(); kk++)
+        {
+          const char *sub = sa->GetValue(kk).c_str();
+
+          if (execdir)
+          {
+            std::string dirname = dicomfind_dirname(sub);
+            if (dirname != doing_dir)
+            {
+              continue;
+            }
+            sub = dicomfind_basename(sub);
+          }
+
+          std::string& temp_arg = temp_args[subc++];
+          temp_arg = arg;
+          pos = temp_arg.find("{}");
+          do
+          {
+            temp_arg.replace(pos, 2, sub);
+            pos = temp_arg.find("{}", pos + strlen(sub));
+          }
+          while (pos != std::string::npos);
+
+          sub_argv[ii++] = const_cast<char *>(temp_arg.c_str());
+        }
+      }
+      else
+      {
+        sub_argv[ii++] = const_cast<char *>(arg.c_str());
+      }
+    }
+    sub_argv[ii] = 0;
+
+    if (execdir)
+    {
+      if (doing_dir != currentSubdir)
+      {
+        dicomfind_chdir(originalDir.c_str());
+        dicomfind_chdir(doing_dir.c_str());
+      }
+    }
+
+    if (!execute_command(sub_argv[0], sub_argv))
+    {
+      fprintf(stderr, "failure!");
+    }
+  }
+
+  if (execdir && currentSubdir != "")
+  {
+    dicomfind_chdir(originalDir.c_str());
+  }
+
+  delete [] sub_argv;
+}
+
+// Run any "-exec ... +" commands that are waiting for more files
+void dicomfind_flush(
+  std::vector<Operation>& operationList, const std::string& originalDir)
+{
+  for (std::vector<Operation>::iterator op = operationList.begin();
+       op != operationList.end();
+       ++op)
+  {
+    if (op->Pending && op->Pending->GetNumberOfValues() > 0)
+    {
+      dicomfind_execute_files(*op, op->Pending, originalDir);
+      op->Pending->Initialize();
+      op->PendingSize = 0;
+    }
+  }
+}
+
 // Apply the given operations to the given list of files
 void dicomfind_operations(
   std::vector<Operation>& operationList, vtkStringArray *sa,
@@ -426,132 +635,94 @@ void dicomfind_operations(
           dicomfind_chdir(originalDir.c_str());
         }
       }
-      else
+      else if (op->Pending)
       {
-        // call program for each series
-        // for execdir, what if series is split across directories?
-        // need to call executable once per directory, using only
-        // the files in that directory.
-        size_t sub_argc = op->Args.size() +
-          subcount*sa->GetNumberOfTuples() - 1;
-        char **sub_argv = new char *[sub_argc+1];
-        std::vector<std::string> temp_args(subcount*sa->GetNumberOfValues());
-        size_t subc = 0;
-
-        // for execdir, keep a list of directories that are done
-        std::vector<std::string> done_dirs;
-        std::string doing_dir;
-
-        bool notdone = true;
-
-        while (notdone)
+        // if the whole series will not fit with the files that are
+        // waiting, then run the command on the waiting files first
+        size_t total = 0;
+        for (vtkIdType kk = 0; kk < sa->GetNumberOfValues(); kk++)
         {
-          notdone = false;
-          if (execdir)
-          {
-            bool foundDirToProcess = false;
-            for (vtkIdType kk = 0; kk < sa->GetNumberOfValues(); kk++)
-            {
-              std::string dirname =
-                dicomfind_dirname(sa->GetValue(kk).c_str());
-              if (!foundDirToProcess)
-              {
-                bool dirIsDone = false;
-                for (size_t ll = 0; ll < done_dirs.size(); ll++)
-                {
-                  if (dirname == done_dirs[ll])
-                  {
-                    dirIsDone = true;
-                    break;
-                  }
-                }
-                if (!dirIsDone)
-                {
-                  foundDirToProcess = true;
-                  doing_dir = dirname;
-                  done_dirs.push_back(dirname);
-                  break;
-                }
-              }
-            }
-            if (foundDirToProcess)
-            {
-              notdone = true;
-            }
-            else
-            {
-              break;
-            }
-          }
-
-          size_t ii = 0;
-          size_t nn = op->Args.size()-1;
-          for (size_t jj = 0; jj < nn; jj++)
-          {
-            const std::string& arg = op->Args[jj];
-            size_t pos = arg.find("{}");
-            if (pos != std::string::npos)
-            {
-              for (vtkIdType kk = 0; kk < sa->GetNumberOfValues(); kk++)
-              {
-                const char *sub = sa->GetValue(kk).c_str();
-
-                if (execdir)
-                {
-                  std::string dirname = dicomfind_dirname(sub);
-                  if (dirname != doing_dir)
-                  {
-                    continue;
-                  }
-                  sub = dicomfind_basename(sub);
-                }
-
-                std::string& temp_arg = temp_args[subc++];
-                temp_arg = arg;
-                pos = temp_arg.find("{}");
-                do
-                {
-                  temp_arg.replace(pos, 2, sub);
-                  pos = temp_arg.find("{}", pos + strlen(sub));
-                }
-                while (pos != std::string::npos);
-
-                sub_argv[ii++] = const_cast<char *>(temp_arg.c_str());
-              }
-            }
-            else
-            {
-              sub_argv[ii++] = const_cast<char *>(arg.c_str());
-            }
-          }
-          sub_argv[ii] = 0;
-
-          if (execdir)
-          {
-            if (doing_dir != currentSubdir)
-            {
-              dicomfind_chdir(originalDir.c_str());
-              dicomfind_chdir(doing_dir.c_str());
-            }
-          }
-
-          if (!execute_command(sub_argv[0], sub_argv))
-          {
-            fprintf(stderr, "failure!");
-          }
+          total += subcount*(sa->GetValue(kk).length() + 1 + sizeof(char *));
         }
-
-        if (execdir && currentSubdir != "")
+        if (op->PendingSize + total > op->MaxSize &&
+            op->Pending->GetNumberOfValues() > 0)
         {
-          dicomfind_chdir(originalDir.c_str());
+          dicomfind_execute_files(*op, op->Pending, originalDir);
+          op->Pending->Initialize();
+          op->PendingSize = 0;
         }
 
-        delete [] sub_argv;
+        // add the files to those waiting for the next batch, the series
+        // is only split if it is too large to fit in a batch by itself
+        for (vtkIdType kk = 0; kk < sa->GetNumberOfValues(); kk++)
+        {
+          const std::string& fname = sa->GetValue(kk);
+          size_t size = subcount*(fname.length() + 1 + sizeof(char *));
+          if (op->PendingSize + size > op->MaxSize &&
+              op->Pending->GetNumberOfValues() > 0)
+          {
+            dicomfind_execute_files(*op, op->Pending, originalDir);
+            op->Pending->Initialize();
+            op->PendingSize = 0;
+          }
+          op->Pending->InsertNextValue(fname);
+          op->PendingSize += size;
+        }
+      }
+      else
+      {
+        // call program for each series
+        dicomfind_execute_files(*op, sa, originalDir);
       }
     }
   }
 }
 
+// Observer that applies the operations to files as the scan finds them
+class PartialSeriesObserver : public vtkCommand
+{
+public:
+  static PartialSeriesObserver *New() { return new PartialSeriesObserver(); }
+  vtkTypeMacro(PartialSeriesObserver,vtkCommand);
+#ifdef VTK_OVERRIDE
+  void Execute(
+    vtkObject *caller, unsigned long eventId, void *callData) VTK_OVERRIDE;
+#else
+  void Execute(vtkObject *caller, unsigned long eventId, void *callData);
+#endif
+  void SetOptions(std::vector<Operation> *operationList,
+                  const std::string *originalDir);
+protected:
+  PartialSeriesObserver() : OperationList(0), OriginalDir(0) {}
+  PartialSeriesObserver(const PartialSeriesObserver& c) : vtkCommand(c) {}
+  void operator=(const PartialSeriesObserver&) {}
+  std::vector<Operation> *OperationList;
+  const std::string *OriginalDir;
+};
+
+void PartialSeriesObserver::SetOptions(
+  std::vector<Operation> *operationList, const std::string *originalDir)
+{
+  this->OperationList = operationList;
+  this->OriginalDir = originalDir;
+}
+
+void PartialSeriesObserver::Execute(
+  vtkObject *, unsigned long e, void *data)
+{
+  if (e != vtkDICOMDirectory::PartialSeriesEvent || data == 0 ||
+      this->OperationList == 0)
+  {
+    return;
+  }
+
+  // every file is reported as "new" exactly once during the scan
+  vtkDICOMDirectory::PartialSeries *ps =
+    static_cast<vtkDICOMDirectory::PartialSeries *>(data);
+  dicomfind_operations(*this->OperationList, ps->NewFileNames,
+                       *this->OriginalDir);
+}
+
 // Delay wildcard expansion for -name option
 MAINMACRO_PASSTHROUGH(-name);
 
@@ -572,6 +743,7 @@ int MAINMACRO(int argc, char *argv[])
   bool ignoreDicomdir = false;
   bool requirePixelData = false;
   bool findSeries = false;
+  bool batchExec = false;
   vtkDICOMCharacterSet charset;
 
   vtkSmartPointer<vtkStringArray> a = vtkSmartPointer<vtkStringArray>::New();
@@ -683,6 +855,10 @@ int MAINMACRO(int argc, char *argv[])
     {
       findSeries = true;
     }
+    else if (strcmp(arg, "-batch") == 0)
+    {
+      batchExec = true;
+    }
     else if (strcmp(arg, "-print") == 0 ||
              strcmp(arg, "-print0") == 0)
     {
@@ -753,6 +929,33 @@ int MAINMACRO(int argc, char *argv[])
     operationList.push_back("-print");
   }
 
+  // if batching, prepare to collect files for "-exec ... +"
+  if (batchExec)
+  {
+    for (std::vector<Operation>::iterator op = operationList.begin();
+         op != operationList.end();
+         ++op)
+    {
+      if (!op->Args.empty() && op->Args.back() == "+")
+      {
+        op->Pending = vtkSmartPointer<vtkStringArray>::New();
+        op->MaxSize = dicomfind_arg_max(op->Args);
+      }
+    }
+  }
+
+  // files can be acted upon during the scan if no "+" commands are used
+  bool streaming = true;
+  for (std::vector<Operation>::iterator op = operationList.begin();
+       op != operationList.end();
+       ++op)
+  {
+    if (!op->Args.empty() && op->Args.back() == "+")
+    {
+      streaming = false;
+    }
+  }
+
   // Remember the current directory
   std::string originalDir = dicomfind_getcwd();
 
@@ -771,19 +974,35 @@ int MAINMACRO(int argc, char *argv[])
     finder->SetRequirePixelData(requirePixelData);
     finder->SetFindLevel(
       findSeries ? vtkDICOMDirectory::SERIES : vtkDICOMDirectory::IMAGE);
+
+    if (streaming)
+    {
+      vtkSmartPointer<PartialSeriesObserver> observer =
+        vtkSmartPointer<PartialSeriesObserver>::New();
+      observer->SetOptions(&operationList, &originalDir);
+      finder->SetIncremental(1);
+      finder->AddObserver(vtkDICOMDirectory::PartialSeriesEvent, observer);
+    }
+
     finder->Update();
 
-    for (int j = 0; j < finder->GetNumberOfStudies(); j++)
+    // reuse one array, rather than keeping an array for every series
+    vtkSmartPointer<vtkStringArray> sa =
+      vtkSmartPointer<vtkStringArray>::New();
+    for (int j = 0; j < finder->GetNumberOfStudies() && !streaming; j++)
     {
       int k0 = finder->GetFirstSeriesForStudy(j);
       int k1 = finder->GetLastSeriesForStudy(j);
 
       for (int k = k0; k <= k1; k++)
       {
-        vtkStringArray *sa = finder->GetFileNamesForSeries(k);
+        finder->GetFileNamesForSeries(k, sa);
         dicomfind_operations(operationList, sa, originalDir);
       }
     }
+
+    // run the final batch
+    dicomfind_flush(operationList, originalDir);
   }
 
   return rval;
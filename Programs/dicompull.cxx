@@ -14,6 +14,7 @@
 
 #include "vtkDICOMConfig.h"
 #include "vtkDICOMDirectory.h"
+#include "vtkDICOMDirectoryWriter.h"
 #include "vtkDICOMMetaData.h"
 #include "vtkDICOMItem.h"
 #include "vtkDICOMDataElement.h"
@@ -28,9 +29,11 @@
 #include "mainmacro.h"
 #include "readquery.h"
 #include "progress.h"
+#include "jobqueue.h"
 
 #include "vtkStringArray.h"
 #include "vtkSmartPointer.h"
+#include "vtkMutexLock.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -39,7 +42,9 @@
 
 #include <limits>
 #include <map>
+#include <set>
 #include <utility>
+#include <vector>
 
 // print the version
 void dicompull_version(FILE *file, const char *cp)
@@ -67,6 +72,10 @@ void dicompull_usage(FILE *file, const char *cp)
     "  -name pattern     Set file names to match (with \"*\" or \"?\").\n"
     "  -image            Restrict the search to files with PixelData.\n"
     "  -series           Find all files in series if even one file matches.\n"
+    "  -j N              Copy up to N files concurrently.\n"
+    "  --link            Create hard links instead of copies, if possible.\n"
+    "  --reflink         Create copy-on-write clones, if possible.\n"
+    "  --dicomdir        Write a DICOMDIR that indexes the output files.\n"
     "  --ignore-dicomdir Ignore the DICOMDIR file even if it is present.\n"
     "  --charset <cs>    Charset to use if SpecificCharacterSet is missing.\n"
     "  --silent          Do not report any progress information.\n"
@@ -102,6 +111,28 @@ void dicompull_help(FILE *file, const char *cp)
     "where the first line of the file is the key (e.g. SeriesInstanceUID) and\n"
     "the rest of the file is the UIDs to match, one UID per line.\n"
     "\n"
+    "Files are copied by the operating system without passing through the\n"
+    "program's memory, where the system allows it.  With \"--link\", each\n"
+    "output file is a hard link to the original file (so be careful, since\n"
+    "changing one will change the other).  With \"--reflink\", the output\n"
+    "files share storage with the originals until either one is modified,\n"
+    "which is supported by filesystems such as Btrfs and XFS.  In either\n"
+    "case, a file is copied if a link or clone cannot be made, for example\n"
+    "if the output is on a different filesystem.  The \"-j\" option allows\n"
+    "several files to be copied at once, which can help with fast storage.\n"
+    "\n"
+    "With \"--dicomdir\", a DICOMDIR file is written to the output\n"
+    "directory (or, if the directory name contains attributes in curly\n"
+    "braces, to the part of the path that precedes them).  It lists the\n"
+    "files that were copied, as well as the files that were listed by an\n"
+    "earlier DICOMDIR in the same place.  As the DICOM standard requires,\n"
+    "the names below the DICOMDIR are converted to upper case and cut to\n"
+    "eight characters, characters other than letters, digits, and \"_\"\n"
+    "are replaced with \"_\", and the files are named IM000001, IM000002,\n"
+    "and so on.  There can be at most seven directory levels below the\n"
+    "DICOMDIR.  When the output is later scanned, the DICOMDIR is read\n"
+    "instead of the files.\n"
+    "\n"
   );
 }
 
@@ -290,9 +321,212 @@ std::string dicompull_makedirname(vtkDICOMMetaData *meta, const char *outdir)
   return s;
 }
 
+// Make the part of the path that follows the base directory usable in
+// a DICOMDIR, where each component must have at most 8 characters from
+// A-Z, 0-9, and underscore.  Returns false if there are too many levels.
+bool dicompull_fileidpath(std::string *dirname, size_t baselen)
+{
+  std::string s = dirname->substr(0, baselen);
+  int depth = 0;
+  size_t pos = baselen;
+  while (pos < dirname->length())
+  {
+    size_t end = dirname->find('/', pos);
+    if (end == std::string::npos)
+    {
+      end = dirname->length();
+    }
+    if (end > pos)
+    {
+      if (!s.empty() && s[s.length()-1] != '/')
+      {
+        s.push_back('/');
+      }
+      for (size_t i = pos; i < end && i < pos + 8; i++)
+      {
+        char c = (*dirname)[i];
+        if (c >= 'a' && c <= 'z')
+        {
+          c = static_cast<char>(c - 'a' + 'A');
+        }
+        else if ((c < 'A' || c > 'Z') && (c < '0' || c > '9'))
+        {
+          c = '_';
+        }
+        s.push_back(c);
+      }
+      depth++;
+    }
+    pos = end + 1;
+  }
+  *dirname = s;
+
+  // the file itself will be the final component
+  return (depth < 8);
+}
+
 // Delay wildcard expansion for -name option
 MAINMACRO_PASSTHROUGH(-name);
 
+// How files are transferred to the output
+enum dicompull_mode
+{
+  dicompull_copy,
+  dicompull_link,
+  dicompull_reflink
+};
+
+// A file to be copied
+struct dicompull_job
+{
+  int series;
+  vtkIdType index;
+  std::string srcname;
+  std::string fullname;
+  bool copied;
+};
+
+// All of the files to be copied, and the shared state for the workers
+struct dicompull_jobs
+{
+  std::vector<dicompull_job> jobs;
+  vtkDICOMDirectory *finder;
+  dicompull_mode mode;
+  ProgressObserver *progress;
+  vtkIdType count;
+  vtkIdType total;
+  vtkSimpleMutexLock lock;
+};
+
+// Copy one file (called from the worker threads)
+void dicompull_copy_file(void *data, int jobIdx)
+{
+  dicompull_jobs *jobs = static_cast<dicompull_jobs *>(data);
+  const dicompull_job& job = jobs->jobs[jobIdx];
+  const std::string& srcname = job.srcname;
+  const std::string& fullname = job.fullname;
+  int k = job.series;
+  vtkIdType i = job.index;
+
+  // any error messages are printed while holding the lock
+  std::string message;
+  bool copied = true;
+
+  if (!vtkDICOMFile::SameFile(srcname.c_str(), fullname.c_str()))
+  {
+    bool linked = false;
+    if (jobs->mode == dicompull_link)
+    {
+      // replace any existing file with the link
+      vtkDICOMFile::Remove(fullname.c_str());
+      linked = (vtkDICOMFile::Link(srcname.c_str(), fullname.c_str()) == 0);
+    }
+
+    vtkDICOMFile infile(srcname.c_str(), vtkDICOMFile::In);
+    if (linked)
+    {
+      // nothing more to do
+    }
+    else if (infile.GetError())
+    {
+      message = "Missing file";
+      switch (infile.GetError())
+      {
+        case vtkDICOMFile::AccessDenied:
+          message = "Access denied for file";
+          break;
+        case vtkDICOMFile::FileIsDirectory:
+          message = "This file is a directory";
+          break;
+        case vtkDICOMFile::ImpossiblePath:
+          message = "Bad file path";
+          break;
+      }
+      jobs->lock.Lock();
+      dicomcli_error_helper(jobs->finder->GetMetaDataForSeries(k), i);
+      fprintf(stderr, "Error: %s: %s\n\n", message.c_str(), srcname.c_str());
+      jobs->lock.Unlock();
+      copied = false;
+    }
+    else if (infile.GetSize() == 0)
+    {
+      jobs->lock.Lock();
+      dicomcli_error_helper(jobs->finder->GetMetaDataForSeries(k), i);
+      fprintf(stderr, "Error: File size is zero: %s\n\n",
+              srcname.c_str());
+      jobs->lock.Unlock();
+      copied = false;
+    }
+    else
+    {
+      vtkDICOMFile outfile(fullname.c_str(), vtkDICOMFile::Out);
+      if (outfile.GetError())
+      {
+        message = "Cannot write file";
+        switch (outfile.GetError())
+        {
+          case vtkDICOMFile::AccessDenied:
+            message = "Access denied for output file";
+            break;
+          case vtkDICOMFile::FileIsDirectory:
+            message = "This output is a directory";
+            break;
+          case vtkDICOMFile::ImpossiblePath:
+            message = "Bad file path";
+            break;
+        }
+        jobs->lock.Lock();
+        fprintf(stderr, "Error: %s: %s\n\n", message.c_str(),
+                fullname.c_str());
+        jobs->lock.Unlock();
+        copied = false;
+      }
+      else if (jobs->mode == dicompull_reflink && outfile.Clone(&infile))
+      {
+        // the clone shares the storage of the original file
+      }
+      else
+      {
+        // copy the file
+        vtkDICOMFile::Size size = infile.GetSize();
+        vtkDICOMFile::Size n = outfile.WriteFrom(&infile, size);
+        if (n < size && infile.GetError())
+        {
+          jobs->lock.Lock();
+          dicomcli_error_helper(jobs->finder->GetMetaDataForSeries(k), i);
+          fprintf(stderr, "Error, incomplete read: %s\n\n",
+                  srcname.c_str());
+          jobs->lock.Unlock();
+          vtkDICOMFile::Remove(fullname.c_str());
+          copied = false;
+        }
+        else if (n < size)
+        {
+          jobs->lock.Lock();
+          fprintf(stderr, "Error: Incomplete write: %s\n\n",
+                  fullname.c_str());
+          jobs->lock.Unlock();
+          vtkDICOMFile::Remove(fullname.c_str());
+          copied = false;
+        }
+      }
+    }
+  }
+
+  // each job is only written to by one thread
+  jobs->jobs[jobIdx].copied = copied;
+
+  if (jobs->progress)
+  {
+    jobs->lock.Lock();
+    jobs->count++;
+    double progress = (static_cast<double>(jobs->count)/
+                       static_cast<double>(jobs->total));
+    jobs->progress->Execute(NULL, vtkCommand::ProgressEvent, &progress);
+    jobs->lock.Unlock();
+  }
+}
+
 // This program will find and copy dicom files
 int MAINMACRO(int argc, char *argv[])
 {
@@ -310,6 +544,9 @@ int MAINMACRO(int argc, char *argv[])
   bool ignoreDicomdir = false;
   vtkDICOMCharacterSet charset;
   bool silent = false;
+  int threads = 1;
+  dicompull_mode mode = dicompull_copy;
+  bool writeDicomdir = false;
   std::string outdir;
 
   vtkSmartPointer<vtkStringArray> a = vtkSmartPointer<vtkStringArray>::New();
@@ -458,6 +695,27 @@ int MAINMACRO(int argc, char *argv[])
     {
       silent = true;
     }
+    else if (strcmp(arg, "--link") == 0)
+    {
+      mode = dicompull_link;
+    }
+    else if (strcmp(arg, "--reflink") == 0)
+    {
+      mode = dicompull_reflink;
+    }
+    else if (strcmp(arg, "--dicomdir") == 0)
+    {
+      writeDicomdir = true;
+    }
+    else if (strcmp(arg, "-j") == 0)
+    {
+      ++argi;
+      if (argi == argc || (threads = atoi(argv[argi])) <= 0)
+      {
+        fprintf(stderr, "Error: %s must be followed by a number.\n\n", arg);
+        return 1;
+      }
+    }
     else if (arg[0] == '-')
     {
       fprintf(stderr, "Error: Unrecognized option %s.\n\n", arg);
@@ -536,13 +794,18 @@ int MAINMACRO(int argc, char *argv[])
   // Create a map of all directories written to.  The count is the
   // number of series that have been written to the directory.
   std::map<std::string, int> dircount;
+  // For --dicomdir, the number of files written to each directory.
+  std::map<std::string, int> filecount;
+  // For --dicomdir, the length of the part of the path above the DICOMDIR
+  size_t baselen = 0;
+  if (outdir.compare(0, basedir.length(), basedir) == 0)
+  {
+    baselen = basedir.length();
+  }
 
   // Write data for every input directory
   if (a->GetNumberOfTuples() > 0)
   {
-    const size_t bufsize = 8192;
-    unsigned char *buffer = new unsigned char [bufsize];
-
     vtkSmartPointer<vtkDICOMDirectory> finder =
       vtkSmartPointer<vtkDICOMDirectory>::New();
     finder->SetDefaultCharacterSet(charset);
@@ -567,18 +830,17 @@ int MAINMACRO(int argc, char *argv[])
     }
     finder->Update();
 
-    vtkIdType count = 0;
-    vtkIdType total = 0;
-    if (!silent)
-    {
-      p->SetText("Copying");
-      p->Execute(NULL, vtkCommand::StartEvent, NULL);
-      for (int k = 0; k < finder->GetNumberOfSeries(); k++)
-      {
-        total += finder->GetFileNamesForSeries(k)->GetNumberOfValues();
-      }
-    }
-
+    // the names of all output files are generated before copying
+    dicompull_jobs jobs;
+    jobs.finder = finder;
+    jobs.mode = mode;
+    jobs.progress = (silent ? NULL : p.GetPointer());
+    jobs.count = 0;
+    jobs.total = 0;
+
+    // reuse one array, rather than keeping an array for every series
+    vtkSmartPointer<vtkStringArray> sa =
+      vtkSmartPointer<vtkStringArray>::New();
     for (int j = 0; j < finder->GetNumberOfStudies(); j++)
     {
       int k0 = finder->GetFirstSeriesForStudy(j);
@@ -586,10 +848,16 @@ int MAINMACRO(int argc, char *argv[])
 
       for (int k = k0; k <= k1; k++)
       {
-        vtkStringArray *sa = finder->GetFileNamesForSeries(k);
+        finder->GetFileNamesForSeries(k, sa);
         vtkDICOMMetaData *meta = finder->GetMetaDataForSeries(k);
         // create the directory name
         std::string dirname = dicompull_makedirname(meta, outdir.c_str());
+        if (writeDicomdir && !dicompull_fileidpath(&dirname, baselen))
+        {
+          fprintf(stderr, "Error: With --dicomdir, there can be at most "
+                  "7 directory levels below %s\n\n", basedir.c_str());
+          exit(1);
+        }
         std::map<std::string,int>::iterator mi = dircount.find(dirname);
         int si = 1;
         if (mi != dircount.end())
@@ -605,107 +873,115 @@ int MAINMACRO(int argc, char *argv[])
           {
             fprintf(stderr, "Error: Cannot create directory: %s\n\n",
                     dirname.c_str());
-            delete [] buffer;
             exit(1);
           }
         }
         vtkDICOMFilePath outpath(dirname);
         for (vtkIdType i = 0; i < sa->GetNumberOfValues(); i++)
         {
-          // copy the file
           char fname[32];
-          sprintf(fname, "IM-%04d-%04d.dcm", si, static_cast<int>(i+1));
-          const std::string& srcname = sa->GetValue(i);
-          std::string fullname = outpath.Join(fname);
-          if (!vtkDICOMFile::SameFile(srcname.c_str(), fullname.c_str()))
+          if (writeDicomdir)
           {
-            vtkDICOMFile infile(srcname.c_str(), vtkDICOMFile::In);
-            if (infile.GetError())
-            {
-              const char *message = "Missing file";
-              switch (infile.GetError())
-              {
-                case vtkDICOMFile::AccessDenied:
-                  message = "Access denied for file";
-                  break;
-                case vtkDICOMFile::FileIsDirectory:
-                  message = "This file is a directory";
-                  break;
-                case vtkDICOMFile::ImpossiblePath:
-                  message = "Bad file path";
-                  break;
-              }
-              dicomcli_error_helper(finder->GetMetaDataForSeries(k), i);
-              fprintf(stderr, "Error: %s: %s\n\n", message, srcname.c_str());
-            }
-            else if (infile.GetSize() == 0)
-            {
-              dicomcli_error_helper(finder->GetMetaDataForSeries(k), i);
-              fprintf(stderr, "Error: File size is zero: %s\n\n",
-                      srcname.c_str());
-            }
-            else
-            {
-              vtkDICOMFile outfile(fullname.c_str(), vtkDICOMFile::Out);
-              if (outfile.GetError())
-              {
-                const char *message = "Cannot write file";
-                switch (outfile.GetError())
-                {
-                  case vtkDICOMFile::AccessDenied:
-                    message = "Access denied for output file";
-                    break;
-                  case vtkDICOMFile::FileIsDirectory:
-                    message = "This output is a directory";
-                    break;
-                  case vtkDICOMFile::ImpossiblePath:
-                    message = "Bad file path";
-                    break;
-                }
-                fprintf(stderr, "Error: %s: %s\n\n", message, fullname.c_str());
-              }
-              else
-              {
-                // copy the file
-                while (!infile.EndOfFile())
-                {
-                  size_t bytecount = infile.Read(buffer, bufsize);
-                  if (bytecount == 0 && infile.GetError())
-                  {
-                    dicomcli_error_helper(finder->GetMetaDataForSeries(k), i);
-                    fprintf(stderr, "Error, incomplete read: %s\n\n",
-                            srcname.c_str());
-                    vtkDICOMFile::Remove(fullname.c_str());
-                    break;
-                  }
-                  if (bytecount > 0 &&
-                      outfile.Write(buffer, bytecount) != bytecount)
-                  {
-                    fprintf(stderr, "Error: Incomplete write: %s\n\n",
-                            fullname.c_str());
-                    vtkDICOMFile::Remove(fullname.c_str());
-                    break;
-                  }
-                }
-              }
-            }
+            // a name that can be used as a ReferencedFileID component
+            sprintf(fname, "IM%06d", ++filecount[dirname]);
           }
-
-          if (!silent)
+          else
           {
-            count++;
-            double progress = (static_cast<double>(count)/
-                               static_cast<double>(total));
-            p->Execute(NULL, vtkCommand::ProgressEvent, &progress);
+            sprintf(fname, "IM-%04d-%04d.dcm", si, static_cast<int>(i+1));
           }
+          dicompull_job job;
+          job.series = k;
+          job.index = i;
+          job.srcname = sa->GetValue(i);
+          job.fullname = outpath.Join(fname);
+          job.copied = false;
+          jobs.jobs.push_back(job);
         }
       }
     }
-    delete [] buffer;
+
+    // copy the files
+    jobs.total = static_cast<vtkIdType>(jobs.jobs.size());
+    if (!silent)
+    {
+      p->SetText("Copying");
+      p->Execute(NULL, vtkCommand::StartEvent, NULL);
+    }
+    JobQueue::Run(dicompull_copy_file, &jobs,
+                  static_cast<int>(jobs.jobs.size()), threads);
     if (!silent)
     {
       p->Execute(NULL, vtkCommand::EndEvent, NULL);
     }
+
+    // index the output files, so that they can be found without a scan,
+    // by using the records that were found for the files that were copied
+    if (writeDicomdir)
+    {
+      std::string dicomdir = vtkDICOMFilePath(basedir).Join("DICOMDIR");
+      vtkSmartPointer<vtkDICOMDirectoryWriter> writer =
+        vtkSmartPointer<vtkDICOMDirectoryWriter>::New();
+      writer->SetFileName(dicomdir.c_str());
+
+      // the series that were copied, with an empty name for each file
+      // that could not be copied (the jobs are in order of series)
+      std::set<std::string> outnames;
+      size_t jobIdx = 0;
+      for (int k = 0; k < finder->GetNumberOfSeries(); k++)
+      {
+        vtkSmartPointer<vtkStringArray> names =
+          vtkSmartPointer<vtkStringArray>::New();
+        names->SetNumberOfValues(finder->GetNumberOfFilesForSeries(k));
+        for (; jobIdx < jobs.jobs.size() && jobs.jobs[jobIdx].series == k;
+             jobIdx++)
+        {
+          const dicompull_job& job = jobs.jobs[jobIdx];
+          if (job.copied)
+          {
+            names->SetValue(job.index, job.fullname);
+            outnames.insert(vtkDICOMFilePath(job.fullname).GetRealPath());
+          }
+        }
+        writer->AddSeries(finder, k, names);
+      }
+
+      // keep the files that were indexed by an earlier DICOMDIR, unless
+      // they were just replaced or are gone, by reading only the DICOMDIR
+      vtkSmartPointer<vtkDICOMDirectory> earlier =
+        vtkSmartPointer<vtkDICOMDirectory>::New();
+      if (vtkDICOMFile::Access(dicomdir.c_str(), vtkDICOMFile::In) == 0)
+      {
+        earlier->SetDirectoryName(basedir.c_str());
+        earlier->SetScanDepth(0);
+        earlier->RequirePixelDataOff();
+        earlier->SetDefaultCharacterSet(charset);
+        earlier->Update();
+      }
+      for (int k = 0; k < earlier->GetNumberOfSeries(); k++)
+      {
+        vtkSmartPointer<vtkStringArray> names =
+          vtkSmartPointer<vtkStringArray>::New();
+        earlier->GetFileNamesForSeries(k, names);
+        for (vtkIdType i = 0; i < names->GetNumberOfValues(); i++)
+        {
+          std::string path =
+            vtkDICOMFilePath(names->GetValue(i)).GetRealPath();
+          if (path.empty() || outnames.find(path) != outnames.end())
+          {
+            names->SetValue(i, "");
+          }
+        }
+        writer->AddSeries(earlier, k, names);
+      }
+
+      writer->Write();
+      if (writer->GetErrorCode() != 0)
+      {
+        fprintf(stderr, "Error: Cannot write %s\n\n",
+                writer->GetFileName());
+        rval = 1;
+      }
+    }
   }
 
   return rval;
@@ -465,317 +465,401 @@ struct SearchState {
   const vtkDICOMItem *n;
 };
 
-// Write out the results in csv format
-void dicomtocsv_write(vtkDICOMDirectory *finder,
-  const vtkDICOMItem& query, const QueryTagList *ql, FILE *fp,
-  int level, ReductionType rt, bool allUnique, bool rescanFiles,
+// Write out the results for one series in csv format
+void dicomtocsv_write_series(vtkDICOMDirectory *finder, int k,
+  int numberOfFiles, const vtkDICOMItem& query, const QueryTagList *ql,
+  FILE *fp, int level, ReductionType rt, bool allUnique, bool rescanFiles,
   vtkCommand *p)
 {
-  // for keeping track of progress
-  vtkIdType count = 0.0;
-  vtkIdType total = 0.0;
-  if (p)
+  vtkStringArray *a = finder->GetFileNamesForSeries(k);
+  if (a->GetNumberOfValues() == 0)
   {
-    for (int k = 0; k < finder->GetNumberOfSeries(); k++)
-    {
-      total += finder->GetFileNamesForSeries(k)->GetNumberOfValues();
-    }
-    p->Execute(NULL, vtkCommand::StartEvent, NULL);
+    return;
   }
 
-  for (int j = 0; j < finder->GetNumberOfStudies(); j++)
+  vtkSmartPointer<vtkDICOMMetaData> meta;
+  if (!rescanFiles)
+  {
+    meta = finder->GetMetaDataForSeries(k);
+  }
+  else
   {
-    int k0 = finder->GetFirstSeriesForStudy(j);
-    int k1 = finder->GetLastSeriesForStudy(j);
-    int numberOfFiles = 1;
+    meta = vtkSmartPointer<vtkDICOMMetaData>::New();
+    if (level >= 4 || rt != None || allUnique)
+    {
+      // need to parse all files
+      meta->SetNumberOfInstances(a->GetNumberOfValues());
+    }
+
+    // need to go to the files for the meta data
+    vtkSmartPointer<vtkDICOMParser> parser =
+      vtkSmartPointer<vtkDICOMParser>::New();
 
-    if (level < 3 && k1 > k0)
+    vtkSmartPointer<ErrorObserver> errorObserver =
+      vtkSmartPointer<ErrorObserver>::New();
+    errorObserver->SetMetaData(finder->GetMetaDataForSeries(k));
+    parser->AddObserver(vtkCommand::ErrorEvent, errorObserver);
+
+    parser->SetQueryItem(query);
+    parser->SetMetaData(meta);
+
+    for (int ii = 0; ii < meta->GetNumberOfInstances(); ii++)
     {
-      // if level is "study", only look at one series
-      numberOfFiles = 0;
-      for (int k = k0; k <= k1; k++)
+      parser->SetIndex(ii);
+      parser->SetFileName(a->GetValue(ii));
+      parser->Update();
+
+      // report progress (the total is not known until the scan is done)
+      if (p)
       {
-        vtkStringArray *a = finder->GetFileNamesForSeries(k);
-        numberOfFiles += a->GetNumberOfValues();
+        double progress = 0.0;
+        p->Execute(NULL, vtkCommand::ProgressEvent, &progress);
       }
-      k1 = k0;
     }
+  }
 
-    for (int k = k0; k <= k1; k++)
+  // this loop is only for the "image" level
+  int m = (level >= 4 ? meta->GetNumberOfInstances() : 1);
+  for (int jj = 0; jj < m; jj++)
+  {
+    // print the value of each tag
+    for (size_t i = 0; i < ql->size(); i++)
     {
-      vtkStringArray *a = finder->GetFileNamesForSeries(k);
-      if (a->GetNumberOfValues() == 0)
+      if (i != 0)
       {
-        continue;
+        fprintf(fp, "%s", ",");
       }
 
-      if (level == 3)
-      {
-        // at series level, this is the number of files
-        numberOfFiles = a->GetNumberOfValues();
-      }
+      vtkDICOMTagPath tagPath = ql->at(i);
+      std::string s;
+      double d = 0.0;
+      bool isNumber = true;
+      bool found = false;
+      bool done = false;
 
-      vtkSmartPointer<vtkDICOMMetaData> meta;
-      if (!rescanFiles)
+      // this loop is only needed if all images are to be checked
+      int n = (m == 1 ? meta->GetNumberOfInstances() : 1);
+      if (level >= 4)
       {
-        meta = finder->GetMetaDataForSeries(k);
+        // we will probe one instance (instance jj)
+        n = jj+1;
       }
-      else
+      else if (n > 1)
       {
-        meta = vtkSmartPointer<vtkDICOMMetaData>::New();
-        if (level >= 4 || rt != None || allUnique)
+        // do a quick check to see if value is same for all instances
+        vtkDICOMTag tag = tagPath.GetHead();
+        if ((tag.GetGroup() & 0x0001) == 0)
         {
-          // need to parse all files
-          meta->SetNumberOfInstances(a->GetNumberOfValues());
-        }
-
-        // need to go to the files for the meta data
-        vtkSmartPointer<vtkDICOMParser> parser =
-          vtkSmartPointer<vtkDICOMParser>::New();
-
-        vtkSmartPointer<ErrorObserver> errorObserver =
-          vtkSmartPointer<ErrorObserver>::New();
-        errorObserver->SetMetaData(finder->GetMetaDataForSeries(k));
-        parser->AddObserver(vtkCommand::ErrorEvent, errorObserver);
-
-        parser->SetQueryItem(query);
-        parser->SetMetaData(meta);
-
-        for (int ii = 0; ii < meta->GetNumberOfInstances(); ii++)
-        {
-          parser->SetIndex(ii);
-          parser->SetFileName(a->GetValue(ii));
-          parser->Update();
+          vtkDICOMDataElementIterator iter = meta->Find(tag);
+          n = ((iter == meta->End() || !iter->IsPerInstance()) ? 1 : n);
         }
       }
-
-      // this loop is only for the "image" level
-      int m = (level >= 4 ? meta->GetNumberOfInstances() : 1);
-      for (int jj = 0; jj < m; jj++)
+      for (int ii = jj; ii < n && !done; ii++)
       {
-        // print the value of each tag
-        for (size_t i = 0; i < ql->size(); i++)
+        // Create an adapter, which helps with extracting attributes from
+        // the PerFrameFunctionalSequence of enhanced IODs.
+        vtkDICOMMetaDataAdapter adapter(meta, ii);
+
+        // Create a stack for searching the whole tree
+        std::vector<SearchState> tstack(1);
+        SearchState &head = tstack.back();
+        head.p = tagPath;
+        head.q = &query;
+        head.m = 0;
+        head.n = head.m + 1;
+
+        while (!tstack.empty())
         {
-          if (i != 0)
+          SearchState &top = tstack.back();
+          if (top.m == top.n)
           {
-            fprintf(fp, "%s", ",");
+            tstack.pop_back();
+            continue;
           }
 
-          vtkDICOMTagPath tagPath = ql->at(i);
-          std::string s;
-          double d = 0.0;
-          bool isNumber = true;
-          bool found = false;
-          bool done = false;
+          const vtkDICOMTagPath& tpath = top.p;
+          const vtkDICOMItem *qitem = top.q;
+          const vtkDICOMItem *mitem = top.m++;
 
-          // this loop is only needed if all images are to be checked
-          int n = (m == 1 ? meta->GetNumberOfInstances() : 1);
-          if (level >= 4)
+          vtkDICOMTag tag = tpath.GetHead();
+          std::string creator;
+          if ((tag.GetGroup() & 0x0001) == 1)
           {
-            // we will probe one instance (instance jj)
-            n = jj+1;
-          }
-          else if (n > 1)
-          {
-            // do a quick check to see if value is same for all instances
-            vtkDICOMTag tag = tagPath.GetHead();
-            if ((tag.GetGroup() & 0x0001) == 0)
+            vtkDICOMTag ctag(tag.GetGroup(), tag.GetElement() >> 8);
+            creator = qitem->Get(ctag).AsString();
+            if (mitem)
+            {
+              tag = mitem->ResolvePrivateTag(tag, creator);
+            }
+            else
             {
-              vtkDICOMDataElementIterator iter = meta->Find(tag);
-              n = ((iter == meta->End() || !iter->IsPerInstance()) ? 1 : n);
+              tag = adapter->ResolvePrivateTag(tag, creator);
             }
           }
-          for (int ii = jj; ii < n && !done; ii++)
+          const vtkDICOMValue *vptr = 0;
+          if (mitem)
           {
-            // Create an adapter, which helps with extracting attributes from
-            // the PerFrameFunctionalSequence of enhanced IODs.
-            vtkDICOMMetaDataAdapter adapter(meta, ii);
-
-            // Create a stack for searching the whole tree
-            std::vector<SearchState> tstack(1);
-            SearchState &head = tstack.back();
-            head.p = tagPath;
-            head.q = &query;
-            head.m = 0;
-            head.n = head.m + 1;
-
-            while (!tstack.empty())
+            vptr = &mitem->Get(tag);
+          }
+          else if (tag != DC::NumberOfFrames)
+          {
+            // vtkDICOMMetaDataAdapter hides NumberOfFrames, so it
+            // will never be found if we check the adapter
+            vptr = &adapter->Get(tag);
+          }
+          else
+          {
+            vptr = &meta->Get(ii, tag);
+          }
+          if (vptr && !vptr->IsValid())
+          {
+            vptr = 0;
+          }
+          // check if we have reached the end of a tag path
+          if (!tpath.HasTail())
+          {
+            if (vptr != 0)
             {
-              SearchState &top = tstack.back();
-              if (top.m == top.n)
+              std::string t = value_as_string(*vptr);
+
+              if (!is_binary_number(*vptr))
               {
-                tstack.pop_back();
-                continue;
+                isNumber = false;
               }
 
-              const vtkDICOMTagPath& tpath = top.p;
-              const vtkDICOMItem *qitem = top.q;
-              const vtkDICOMItem *mitem = top.m++;
-
-              vtkDICOMTag tag = tpath.GetHead();
-              std::string creator;
-              if ((tag.GetGroup() & 0x0001) == 1)
+              if (rt != 0 && vptr->GetVR().HasNumericValue())
               {
-                vtkDICOMTag ctag(tag.GetGroup(), tag.GetElement() >> 8);
-                creator = qitem->Get(ctag).AsString();
-                if (mitem)
+                double f = vptr->AsDouble();
+                if (!found)
                 {
-                  tag = mitem->ResolvePrivateTag(tag, creator);
+                  d = f;
+                  s = t;
+                  found = true;
                 }
-                else
+                else if (rt == FirstNonzero && f != 0.0)
                 {
-                  tag = adapter->ResolvePrivateTag(tag, creator);
+                  // if a non-zero value is found, then break
+                  s = t;
+                  done = true;
+                  break;
+                }
+                else if ((rt == MinValue && f < d) ||
+                         (rt == MaxValue && f > d))
+                {
+                  d = f;
+                  s = t;
                 }
               }
-              const vtkDICOMValue *vptr = 0;
-              if (mitem)
-              {
-                vptr = &mitem->Get(tag);
-              }
-              else if (tag != DC::NumberOfFrames)
-              {
-                // vtkDICOMMetaDataAdapter hides NumberOfFrames, so it
-                // will never be found if we check the adapter
-                vptr = &adapter->Get(tag);
-              }
-              else
-              {
-                vptr = &meta->Get(ii, tag);
-              }
-              if (vptr && !vptr->IsValid())
-              {
-                vptr = 0;
-              }
-              // check if we have reached the end of a tag path
-              if (!tpath.HasTail())
+              else if (allUnique)
               {
-                if (vptr != 0)
+                if (!found || unique_value(t, s))
                 {
-                  std::string t = value_as_string(*vptr);
-
-                  if (!is_binary_number(*vptr))
+                  if (found)
                   {
+                    s.push_back('\\');
                     isNumber = false;
                   }
-
-                  if (rt != 0 && vptr->GetVR().HasNumericValue())
-                  {
-                    double f = vptr->AsDouble();
-                    if (!found)
-                    {
-                      d = f;
-                      s = t;
-                      found = true;
-                    }
-                    else if (rt == FirstNonzero && f != 0.0)
-                    {
-                      // if a non-zero value is found, then break
-                      s = t;
-                      done = true;
-                      break;
-                    }
-                    else if ((rt == MinValue && f < d) ||
-                             (rt == MaxValue && f > d))
-                    {
-                      d = f;
-                      s = t;
-                    }
-                  }
-                  else if (allUnique)
-                  {
-                    if (!found || unique_value(t, s))
-                    {
-                      if (found)
-                      {
-                        s.push_back('\\');
-                        isNumber = false;
-                      }
-                      found = true;
-                      s += t;
-                    }
-                  }
-                  else
-                  {
-                    // output the value
-                    s = t;
-                    found = true;
-                    if (rt == 0 || vptr->GetVL() != 0)
-                    {
-                      done = true;
-                      break;
-                    }
-                  }
+                  found = true;
+                  s += t;
                 }
               }
-              else if (vptr != 0)
+              else
               {
-                // go one level deeper into the query
-                qitem = qitem->Get(tpath.GetHead()).GetSequenceData();
-                // go one level deeper into the meta data
-                mitem = vptr->GetSequenceData();
-                if (mitem)
+                // output the value
+                s = t;
+                found = true;
+                if (rt == 0 || vptr->GetVL() != 0)
                 {
-                  tstack.resize(tstack.size()+1);
-                  SearchState &b = tstack.back();
-                  b.p = tstack[tstack.size()-2].p.GetTail();
-                  b.q = qitem;
-                  b.m = mitem;
-                  b.n = mitem + vptr->GetNumberOfValues();
-                  continue;
+                  done = true;
+                  break;
                 }
               }
             }
           }
-
-          if (found)
+          else if (vptr != 0)
           {
-            // Print the found value(s)
-            if (isNumber)
-            {
-              fprintf(fp, "%s", s.c_str());
-            }
-            else
+            // go one level deeper into the query
+            qitem = qitem->Get(tpath.GetHead()).GetSequenceData();
+            // go one level deeper into the meta data
+            mitem = vptr->GetSequenceData();
+            if (mitem)
             {
-              fprintf(fp, "\"%s\"", s.c_str());
+              tstack.resize(tstack.size()+1);
+              SearchState &b = tstack.back();
+              b.p = tstack[tstack.size()-2].p.GetTail();
+              b.q = qitem;
+              b.m = mitem;
+              b.n = mitem + vptr->GetNumberOfValues();
+              continue;
             }
           }
-          else if (tagPath.GetHead() == DC::ReferencedFileID &&
-                   !tagPath.HasTail())
-          {
-            // ReferencedFileID (0004,1500) is meant to be used in DICOMDIR,
-            // but we hijack it to report the first file in the series.
-            s = dicomtocsv_quote(a->GetValue(jj));
-            fprintf(fp, "\"%s\"", s.c_str());
-          }
-          else if (tagPath.GetHead() == DC::NumberOfReferences &&
-                   !tagPath.HasTail())
-          {
-            // NumberOfReferences (0004,1600) is a retired attribute meant
-            // to count the number of references to a file, but we hijack
-            // it and use it to report the number of files found for the
-            // series.
-            fprintf(fp, "\"%d\"", numberOfFiles);
-          }
         }
+      }
 
-        fprintf(fp, "%s", "\r\n");
-
-        // report progress
-        if (p)
+      if (found)
+      {
+        // Print the found value(s)
+        if (isNumber)
         {
-          count += numberOfFiles;
-          double progress = (static_cast<double>(count)/
-                             static_cast<double>(total));
-          p->Execute(NULL, vtkCommand::ProgressEvent, &progress);
+          fprintf(fp, "%s", s.c_str());
         }
+        else
+        {
+          fprintf(fp, "\"%s\"", s.c_str());
+        }
+      }
+      else if (tagPath.GetHead() == DC::ReferencedFileID &&
+               !tagPath.HasTail())
+      {
+        // ReferencedFileID (0004,1500) is meant to be used in DICOMDIR,
+        // but we hijack it to report the first file in the series.
+        s = dicomtocsv_quote(a->GetValue(jj));
+        fprintf(fp, "\"%s\"", s.c_str());
+      }
+      else if (tagPath.GetHead() == DC::NumberOfReferences &&
+               !tagPath.HasTail())
+      {
+        // NumberOfReferences (0004,1600) is a retired attribute meant
+        // to count the number of references to a file, but we hijack
+        // it and use it to report the number of files found for the
+        // series.
+        fprintf(fp, "\"%d\"", numberOfFiles);
       }
     }
+
+    fprintf(fp, "%s", "\r\n");
   }
+}
 
-  if (p)
+// Observer that writes each series as soon as the scan provides it
+class SeriesWriter : public vtkCommand
+{
+public:
+  static SeriesWriter *New() { return new SeriesWriter(); }
+  vtkTypeMacro(SeriesWriter,vtkCommand);
+#ifdef VTK_OVERRIDE
+  void Execute(
+    vtkObject *caller, unsigned long eventId, void *callData) VTK_OVERRIDE;
+#else
+  void Execute(vtkObject *caller, unsigned long eventId, void *callData);
+#endif
+  void SetOptions(const vtkDICOMItem *query, const QueryTagList *ql,
+                  FILE *fp, int level, ReductionType rt, bool allUnique,
+                  bool rescanFiles);
+  void SetProgressObserver(vtkCommand *p) { this->Progress = p; }
+  void Flush(vtkDICOMDirectory *finder);
+  void Finish(vtkDICOMDirectory *finder);
+protected:
+  SeriesWriter() : Query(0), TagList(0), File(0), Level(3), Reduction(None),
+    AllUnique(false), RescanFiles(false), Progress(0), Started(false),
+    PendingStudy(-1), PendingSeries(-1), PendingFiles(0) {}
+  SeriesWriter(const SeriesWriter& c) : vtkCommand(c) {}
+  void operator=(const SeriesWriter&) {}
+  const vtkDICOMItem *Query;
+  const QueryTagList *TagList;
+  FILE *File;
+  int Level;
+  ReductionType Reduction;
+  bool AllUnique;
+  bool RescanFiles;
+  vtkCommand *Progress;
+  bool Started;
+  // for "study" level, the study that is waiting for more series
+  int PendingStudy;
+  int PendingSeries;
+  int PendingFiles;
+};
+
+void SeriesWriter::SetOptions(
+  const vtkDICOMItem *query, const QueryTagList *ql, FILE *fp,
+  int level, ReductionType rt, bool allUnique, bool rescanFiles)
+{
+  this->Query = query;
+  this->TagList = ql;
+  this->File = fp;
+  this->Level = level;
+  this->Reduction = rt;
+  this->AllUnique = allUnique;
+  this->RescanFiles = rescanFiles;
+}
+
+void SeriesWriter::Execute(vtkObject *o, unsigned long e, void *data)
+{
+  vtkDICOMDirectory *finder = vtkDICOMDirectory::SafeDownCast(o);
+  if (e != vtkCommand::UpdateDataEvent || finder == 0 || data == 0)
   {
-    p->Execute(NULL, vtkCommand::EndEvent, NULL);
+    return;
   }
+
+  // the series that was just added, it is always in the last study
+  int k = *static_cast<int *>(data);
+  int j = finder->GetNumberOfStudies() - 1;
+  int n = finder->GetNumberOfFilesForSeries(k);
+
+  if (this->Progress && !this->Started)
+  {
+    this->Progress->Execute(NULL, vtkCommand::StartEvent, NULL);
+    this->Started = true;
+  }
+
+  if (this->Level >= 3)
+  {
+    dicomtocsv_write_series(
+      finder, k, n, *this->Query, this->TagList, this->File,
+      this->Level, this->Reduction, this->AllUnique, this->RescanFiles,
+      this->Progress);
+    fflush(this->File);
+    finder->ReleaseSeries(k);
+  }
+  else
+  {
+    // if level is "study", only write the first series of each study,
+    // but this must wait until the number of files in the study is known
+    if (j != this->PendingStudy)
+    {
+      this->Flush(finder);
+      this->PendingStudy = j;
+      this->PendingSeries = k;
+    }
+    else
+    {
+      finder->ReleaseSeries(k);
+    }
+    this->PendingFiles += n;
+  }
+
+  if (this->Progress)
+  {
+    double progress = 0.0;
+    this->Progress->Execute(NULL, vtkCommand::ProgressEvent, &progress);
+  }
+}
+
+void SeriesWriter::Flush(vtkDICOMDirectory *finder)
+{
+  if (this->PendingSeries >= 0)
+  {
+    dicomtocsv_write_series(
+      finder, this->PendingSeries, this->PendingFiles,
+      *this->Query, this->TagList, this->File,
+      this->Level, this->Reduction, this->AllUnique, this->RescanFiles,
+      this->Progress);
+    fflush(this->File);
+    finder->ReleaseSeries(this->PendingSeries);
+  }
+  this->PendingStudy = -1;
+  this->PendingSeries = -1;
+  this->PendingFiles = 0;
+}
+
+void SeriesWriter::Finish(vtkDICOMDirectory *finder)
+{
+  this->Flush(finder);
+  if (this->Progress && this->Started)
+  {
+    this->Progress->Execute(NULL, vtkCommand::EndEvent, NULL);
+  }
+  this->Started = false;
 }
 
 } // end anonymous namespace
@@ -1047,6 +1131,7 @@ int MAINMACRO(int argc, char *argv[])
   if (a->GetNumberOfTuples() > 0)
   {
     vtkSmartPointer<ProgressObserver> p;
+    vtkSmartPointer<ProgressObserver> wp;
 
     // Set the default characte set
     vtkDICOMCharacterSet::SetGlobalDefault(charset);
@@ -1078,14 +1163,22 @@ int MAINMACRO(int argc, char *argv[])
     }
     finder->SetScanDepth(scandepth);
     finder->SetFindQuery(query);
-    finder->Update();
 
+    // Write each series as soon as the finder provides it, and
+    // re-read the files for the series if --rescan was given
+    vtkSmartPointer<SeriesWriter> writer =
+      vtkSmartPointer<SeriesWriter>::New();
+    writer->SetOptions(&query, &qtlist, fp, level, rt, allUnique,
+                       rescanFiles);
     if (!silent)
     {
-      p->SetText("Writing");
+      wp = vtkSmartPointer<ProgressObserver>::New();
+      wp->SetText("Writing");
+      writer->SetProgressObserver(wp);
     }
-    dicomtocsv_write(
-      finder, query, &qtlist, fp, level, rt, allUnique, rescanFiles, p);
+    finder->AddObserver(vtkCommand::UpdateDataEvent, writer);
+    finder->Update();
+    writer->Finish(finder);
 
     fflush(fp);
   }
@@ -54,6 +54,7 @@
 
 // from dicomcli
 #include "vtkConsoleOutputWindow.h"
+#include "jobqueue.h"
 #include "mainmacro.h"
 
 // Kinds of reformats
@@ -79,6 +80,7 @@ struct dicomtodicom_options
   bool resample;
   bool silent;
   bool verbose;
+  int threads;
   const char *output;
 };
 
@@ -120,6 +122,7 @@ void dicomtodicom_usage(FILE *file, const char *command_name)
     "  -o directory            The output directory.\n"
     "  -s --silent             Do not print anything while executing.\n"
     "  -v --verbose            Verbose error reporting.\n"
+    "  -j N                    Convert up to N series concurrently.\n"
     "  --resample              Resample to produce square pixels.\n"
     "  --axial                 Produce axial slices.\n"
     "  --coronal               Produce coronal slices.\n"
@@ -170,10 +173,17 @@ void dicomtodicom_help(FILE *file, const char *command_name)
     "meta data to be discarded.  Reformatting be combined with resampling\n"
     "to produce an output with square pixels via Lanczos interpolation.\n"
     "\n");
+  fprintf(file,
+    "If the input files contain more than one series, then each series is\n"
+    "written with its own file prefix: IM-0001 for the first series, IM-0002\n"
+    "for the second, etc.  The -j option will convert several series at\n"
+    "once, each in its own thread.  An error in one series will not stop the\n"
+    "conversion of the others.\n"
+    "\n");
 }
 
-// Print error
-void dicomtodicom_check_error(vtkObject *o)
+// Print error, return true if an error occurred
+bool dicomtodicom_check_error(vtkObject *o)
 {
   vtkDICOMReader *reader = vtkDICOMReader::SafeDownCast(o);
   vtkDICOMFileSorter *sorter = vtkDICOMFileSorter::SafeDownCast(o);
@@ -209,7 +219,7 @@ void dicomtodicom_check_error(vtkObject *o)
   switch(errorcode)
   {
     case vtkErrorCode::NoError:
-      return;
+      return false;
     case vtkErrorCode::FileNotFoundError:
       fprintf(stderr, "File not found: %s\n", filename);
       break;
@@ -236,7 +246,7 @@ void dicomtodicom_check_error(vtkObject *o)
       break;
   }
 
-  exit(1);
+  return true;
 }
 
 // Read the options
@@ -252,6 +262,7 @@ void dicomtodicom_read_options(
   options->resample = false;
   options->silent = false;
   options->verbose = false;
+  options->threads = 1;
   options->output = 0;
 
   // read the options from the command line
@@ -371,6 +382,29 @@ void dicomtodicom_read_options(
             options->output = arg;
             break;
           }
+          else if (arg[argj] == 'j')
+          {
+            if (arg[argj+1] != '\0')
+            {
+              arg += argj+1;
+            }
+            else if (argi < argc)
+            {
+              arg = argv[argi++];
+            }
+            else
+            {
+              arg = "";
+            }
+            options->threads = atoi(arg);
+            if (options->threads <= 0)
+            {
+              fprintf(stderr, "\nA number must follow the \'-j\' flag\n\n");
+              dicomtodicom_usage(stderr, argv[0]);
+              exit(1);
+            }
+            break;
+          }
           else
           {
             fprintf(stderr, "\nUnrecognized \'%c\' in option %s\n\n", arg[argj], arg);
@@ -392,11 +426,12 @@ void dicomtodicom_read_options(
   }
 }
 
-// Convert one DICOM series into another DICOM series
-void dicomtodicom_convert_one(
+// Convert one DICOM series into another DICOM series, return false on error
+bool dicomtodicom_convert_one(
   const dicomtodicom_options *options,
   vtkStringArray *a,
-  const char *outfile)
+  const char *outfile,
+  int seriesIndex)
 {
   // read the files
   vtkSmartPointer<vtkDICOMReader> reader =
@@ -405,7 +440,10 @@ void dicomtodicom_convert_one(
   reader->TimeAsVectorOn();
   reader->SetFileNames(a);
   reader->Update();
-  dicomtodicom_check_error(reader);
+  if (dicomtodicom_check_error(reader))
+  {
+    return false;
+  }
 
   // get a handle for the reader's output
   vtkAlgorithmOutput *lastOutput = reader->GetOutputPort();
@@ -632,7 +670,9 @@ void dicomtodicom_convert_one(
   }
   writer->SetMetaData(meta);
   writer->SetFilePrefix(outfile);
-  writer->SetFilePattern("%s/IM-0001-%04.4d.dcm");
+  char pattern[32];
+  sprintf(pattern, "%%s/IM-%04d-%%04.4d.dcm", (seriesIndex + 1) % 10000);
+  writer->SetFilePattern(pattern);
   writer->TimeAsVectorOn();
   if (reader->GetTimeDimension() > 1)
   {
@@ -648,11 +688,29 @@ void dicomtodicom_convert_one(
   writer->SetInputConnection(lastOutput);
   writer->SetMemoryRowOrderToFileNative();
   writer->Write();
-  dicomtodicom_check_error(writer);
+  return !dicomtodicom_check_error(writer);
 }
 
-// Process a list of files
-void dicomtodicom_convert_files(
+// All of the series to convert
+struct dicomtodicom_batch
+{
+  const dicomtodicom_options *options;
+  vtkDICOMFileSorter *sorter;
+  const char *outpath;
+  std::vector<int> results;
+};
+
+// Convert one series from the batch (called from worker threads)
+void dicomtodicom_batch_convert(void *data, int i)
+{
+  dicomtodicom_batch *batch = static_cast<dicomtodicom_batch *>(data);
+  batch->results[i] = dicomtodicom_convert_one(
+    batch->options, batch->sorter->GetFileNamesForSeries(i),
+    batch->outpath, i);
+}
+
+// Process a list of files, return false if any series failed
+bool dicomtodicom_convert_files(
   dicomtodicom_options *options, vtkStringArray *files,
   const char *outpath)
 {
@@ -669,10 +727,28 @@ void dicomtodicom_convert_files(
     vtkSmartPointer<vtkDICOMFileSorter>::New();
   sorter->SetInputFileNames(presorter->GetFileNames());
   sorter->Update();
-  dicomtodicom_check_error(sorter);
+  if (dicomtodicom_check_error(sorter))
+  {
+    exit(1);
+  }
+
+  int n = sorter->GetNumberOfSeries();
+  if (n <= 1)
+  {
+    return dicomtodicom_convert_one(
+      options, sorter->GetOutputFileNames(), outpath, 0);
+  }
+
+  // each series is written with its own file prefix
+  dicomtodicom_batch batch;
+  batch.options = options;
+  batch.sorter = sorter;
+  batch.outpath = outpath;
+  batch.results.resize(n, 0);
+  JobQueue::Run(dicomtodicom_batch_convert, &batch, n, options->threads);
 
-  dicomtodicom_convert_one(
-    options, sorter->GetOutputFileNames(), outpath);
+  return (std::find(batch.results.begin(), batch.results.end(), 0) ==
+          batch.results.end());
 }
 
 // This program will convert DICOM to DICOM
@@ -728,7 +804,10 @@ int MAINMACRO(int argc, char *argv[])
     exit(1);
   }
 
-  dicomtodicom_convert_files(&options, files, outpath);
+  if (!dicomtodicom_convert_files(&options, files, outpath))
+  {
+    return 1;
+  }
 
   return 0;
 }
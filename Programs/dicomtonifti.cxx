@@ -54,6 +54,7 @@
 
 // from dicomcli
 #include "vtkConsoleOutputWindow.h"
+#include "jobqueue.h"
 #include "mainmacro.h"
 
 // Simple structure for command-line options
@@ -73,6 +74,8 @@ struct dicomtonifti_options
   bool silent;
   bool verbose;
   int volume;
+  int memory_limit;
+  int threads;
   const char *output;
 };
 
@@ -118,6 +121,7 @@ void dicomtonifti_usage(FILE *file, const char *command_name)
     "  -s --silent             Do not echo output filenames.\n"
     "  -v --verbose            Verbose error reporting.\n"
     "  -L --follow-symlinks    Follow symbolic links when recursing.\n"
+    "  -j N                    Convert up to N series concurrently.\n"
     "  --fsl                   Format axial image for use in FSL.\n"
     "  --reformat-to-axial     Reformat the image into axial orientation.\n"
     "  --no-slice-reordering   Never reorder the slices.\n"
@@ -127,6 +131,7 @@ void dicomtonifti_usage(FILE *file, const char *command_name)
     "  --no-qform              Don't include a qform in the NIFTI file.\n"
     "  --no-sform              Don't include an sform in the NIFTI file.\n"
     "  --volume N              Set the volume to output (starts at 0).\n"
+    "  --memory-limit N        Write in slabs, using at most N MiB each.\n"
     "  --version               Print the version and exit.\n"
     "  --build-version         Print source and build version.\n"
     "  --help                  Documentation for dicomtonifti.\n"
@@ -173,6 +178,22 @@ void dicomtonifti_help(FILE *file, const char *command_name)
     "increasing from posterior to anterior.  This will also convert the data\n"
     "type from unsigned 16-bit to signed 16-bit if necessary.\n"
     "\n");
+  fprintf(file,
+    "For very large series, the --memory-limit option will cause the data\n"
+    "to be read and written in slabs of slices, so that only one slab must\n"
+    "be held in memory at a time.  The limit is approximate, and it cannot\n"
+    "be honored if --reformat-to-axial (or --fsl) must exchange the slice\n"
+    "axis with the row or column axis.  When streaming, cal_min and cal_max\n"
+    "are only set from the DICOM window/level, since computing the range\n"
+    "would require a second pass through the data.\n"
+    "\n");
+  fprintf(file,
+    "In batch mode, the -j option will convert several series at once, each\n"
+    "in its own thread.  The output filenames are identical to those that\n"
+    "would be produced without -j, and an error in one series will not\n"
+    "stop the conversion of the others.  Note that memory use increases in\n"
+    "proportion to the number of series being converted concurrently.\n"
+    "\n");
   fprintf(file,
     "If batch mode is selected, the output file given with \"-o\" can be\n"
     "constructed from DICOM attributes, by providing the attribute names\n"
@@ -280,6 +301,8 @@ void dicomtonifti_read_options(
   options->silent = false;
   options->verbose = false;
   options->volume = -1;
+  options->memory_limit = 0;
+  options->threads = 1;
   options->output = 0;
 
   // read the options from the command line
@@ -363,6 +386,17 @@ void dicomtonifti_read_options(
         arg = argv[argi++];
         options->volume = atoi(arg);
       }
+      else if (strcmp(arg, "--memory-limit") == 0)
+      {
+        if (argi >= argc || argv[argi][0] == '-' ||
+            (options->memory_limit = atoi(argv[argi])) <= 0)
+        {
+          fprintf(stderr, "\nA size in MiB must follow \'--memory-limit\'\n\n");
+          dicomtonifti_usage(stderr, argv[0]);
+          exit(1);
+        }
+        argi++;
+      }
       else if (strcmp(arg, "--version") == 0)
       {
         dicomtonifti_version(stdout, argv[0], false);
@@ -431,6 +465,29 @@ void dicomtonifti_read_options(
             options->output = arg;
             break;
           }
+          else if (arg[argj] == 'j')
+          {
+            if (arg[argj+1] != '\0')
+            {
+              arg += argj+1;
+            }
+            else if (argi < argc)
+            {
+              arg = argv[argi++];
+            }
+            else
+            {
+              arg = "";
+            }
+            options->threads = atoi(arg);
+            if (options->threads <= 0)
+            {
+              fprintf(stderr, "\nA number must follow the \'-j\' flag\n\n");
+              dicomtonifti_usage(stderr, argv[0]);
+              exit(1);
+            }
+            break;
+          }
           else
           {
             fprintf(stderr, "\nUnrecognized \'%c\' in option %s\n\n", arg[argj], arg);
@@ -571,7 +628,17 @@ void dicomtonifti_convert_one(
   reader->SetMemoryRowOrderToFileNative();
   reader->TimeAsVectorOn();
   reader->SetFileNames(a);
-  reader->Update();
+
+  // when streaming, only the header information is read up front
+  bool streaming = (options->memory_limit > 0);
+  if (streaming)
+  {
+    reader->UpdateInformation();
+  }
+  else
+  {
+    reader->Update();
+  }
   if (dicomtonifti_check_error(reader)) {
     return;
   }
@@ -586,15 +653,18 @@ void dicomtonifti_convert_one(
   extract->SetInputConnection(lastOutput);
   if (options->volume >= 0)
   {
-    if (reader->GetOutput()->GetNumberOfScalarComponents() <= options->volume)
+    if (reader->GetNumberOfScalarComponents() <= options->volume)
     {
       fprintf(stderr, "Only %d volumes, but --volume %d used.\n",
-              reader->GetOutput()->GetNumberOfScalarComponents(),
+              reader->GetNumberOfScalarComponents(),
               options->volume);
       return;
     }
     extract->SetComponents(options->volume);
-    extract->Update();
+    if (!streaming)
+    {
+      extract->Update();
+    }
     lastOutput = extract->GetOutputPort();
   }
 
@@ -616,7 +686,15 @@ void dicomtonifti_convert_one(
     // tilt is significant, so regrid as a rectangular volume
     rectifier->SetInputConnection(lastOutput);
     rectifier->SetVolumeMatrix(patientMatrix);
-    rectifier->Update();
+    if (streaming)
+    {
+      // the rectified matrix is computed along with the information
+      rectifier->UpdateInformation();
+    }
+    else
+    {
+      rectifier->Update();
+    }
     lastOutput = rectifier->GetOutputPort();
     patientMatrix = rectifier->GetRectifiedMatrix();
   }
@@ -735,7 +813,7 @@ void dicomtonifti_convert_one(
   }
 
   // convert to signed short if fsl
-  int scalarType = reader->GetOutput()->GetScalarType();
+  int scalarType = reader->GetDataScalarType();
   vtkSmartPointer<vtkImageCast> caster =
     vtkSmartPointer<vtkImageCast>::New();
   if (options->fsl && scalarType != VTK_UNSIGNED_CHAR &&
@@ -748,7 +826,16 @@ void dicomtonifti_convert_one(
         scalarType == VTK_SIGNED_CHAR)
     {
       outputType = VTK_SHORT;
-      if (scalarType == VTK_UNSIGNED_SHORT)
+      if (scalarType == VTK_UNSIGNED_SHORT && streaming)
+      {
+        // the data isn't in memory, so use the declared bit depth instead
+        vtkDICOMMetaData *meta = reader->GetMetaData();
+        if (meta->Get(DC::BitsStored).AsInt() > 15)
+        {
+          outputType = VTK_FLOAT;
+        }
+      }
+      else if (scalarType == VTK_UNSIGNED_SHORT)
       {
         // change to float if values greater than 32767 exist
         const unsigned short *sptr = static_cast<const unsigned short *>(
@@ -859,7 +946,7 @@ void dicomtonifti_convert_one(
     }
   }
 #if (VTK_MAJOR_VERSION > 5) || (VTK_MINOR_VERSION > 9)
-  if (!useWindowLevel)
+  if (!useWindowLevel && !streaming)
   {
     std::string photometric =
       meta->Get(DC::PhotometricInterpretation).AsString();
@@ -907,11 +994,42 @@ void dicomtonifti_convert_one(
   {
     writer->SetSFormMatrix(matrix);
   }
+  if (streaming)
+  {
+    writer->StreamingOn();
+    writer->SetMemoryLimit(
+      static_cast<vtkIdType>(options->memory_limit)*1024);
+  }
   writer->SetInputConnection(lastOutput);
   writer->Write();
   dicomtonifti_check_error(writer);
 }
 
+// A series to convert in batch mode
+struct dicomtonifti_job
+{
+  vtkStringArray *files;
+  std::string outfile;
+};
+
+// All of the series to convert in batch mode
+struct dicomtonifti_batch
+{
+  const dicomtonifti_options *options;
+  std::vector<dicomtonifti_job> jobs;
+};
+
+// Convert one series from the batch (called from worker threads)
+void dicomtonifti_batch_convert(void *data, int i)
+{
+  dicomtonifti_batch *batch = static_cast<dicomtonifti_batch *>(data);
+  const dicomtonifti_job& job = batch->jobs[i];
+  if (job.files)
+  {
+    dicomtonifti_convert_one(batch->options, job.files, job.outfile.c_str());
+  }
+}
+
 // Process a list of DICOM files
 void dicomtonifti_convert_files(
   dicomtonifti_options *options, vtkStringArray *files,
@@ -958,6 +1076,10 @@ void dicomtonifti_convert_files(
       vtkSmartPointer<vtkDICOMMetaData>::New();
     parser->SetMetaData(meta);
 
+    // the output names are generated before any conversion is done
+    dicomtonifti_batch batch;
+    batch.options = options;
+
     int m = sorter->GetNumberOfStudies();
     for (int j = 0; j < m; j++)
     {
@@ -1008,10 +1130,26 @@ void dicomtonifti_convert_files(
           printf("%s\n", outfile.c_str());
         }
 
-        // convert the file
-        dicomtonifti_convert_one(options, a, outfile.c_str());
+        dicomtonifti_job job;
+        job.files = a;
+        job.outfile = outfile;
+        batch.jobs.push_back(job);
       }
     }
+
+    // if a name is used twice, the last series gets the file
+    std::set<std::string> outnames;
+    for (size_t i = batch.jobs.size(); i > 0; i--)
+    {
+      if (!outnames.insert(batch.jobs[i-1].outfile).second)
+      {
+        batch.jobs[i-1].files = 0;
+      }
+    }
+
+    // convert the files
+    JobQueue::Run(dicomtonifti_batch_convert, &batch,
+                  static_cast<int>(batch.jobs.size()), options->threads);
   }
 }
 
@@ -13,14 +13,25 @@
 =========================================================================*/
 #include "vtkDICOMCharacterSet.h"
 #include "vtkDICOMCharacterSetTables.h"
+#include "vtkDICOMReferenceCount.h"
+
+#include "vtkMutexLock.h"
 
 #include <algorithm>
 #include <cstddef>
 
+#include <string.h>
+
 unsigned char vtkDICOMCharacterSet::GlobalDefault =
   vtkDICOMCharacterSet::ISO_IR_6;
 bool vtkDICOMCharacterSet::GlobalOverride = false;
 
+// Dense tables for converting unicode to the multi-byte encodings, which
+// are expanded from the compressed tables on first use.  Once stored, a
+// table is never modified, so it can be read without a lock.
+static vtkSimpleMutexLock *vtkDICOMCharacterSetLock;
+static const unsigned short *vtkDICOMCharacterSetDenseReverse[256];
+
 //----------------------------------------------------------------------------
 namespace {
 
@@ -136,23 +147,64 @@ unsigned short CompressedTableR::operator[](unsigned int x)
   return 0xFFFD;
 }
 
+// Get a dense version of a reversed table, with one entry for every
+// code in the BMP.  The multi-byte encoders use these instead of the
+// compressed tables, since a search of the compressed tables for every
+// character is slow.  The dense table is built on first use.
+const unsigned short *DenseReverseTable(unsigned char key)
+{
+  const unsigned short *dense = vtkDICOMCharacterSetDenseReverse[key];
+  if (dense == 0)
+  {
+    vtkDICOMCharacterSetLock->Lock();
+    dense = vtkDICOMCharacterSetDenseReverse[key];
+    if (dense == 0)
+    {
+      CompressedTable table(vtkDICOMCharacterSet::Reverse[key]);
+      unsigned short *t = new unsigned short[0xFFFE];
+      for (unsigned int x = 0; x < 0xFFFE; x++)
+      {
+        t[x] = table[static_cast<unsigned short>(x)];
+      }
+      // the table must be complete before other threads can see it
+      vtkDICOMReferenceCount::Fence();
+      vtkDICOMCharacterSetDenseReverse[key] = t;
+      dense = t;
+    }
+    vtkDICOMCharacterSetLock->Unlock();
+  }
+  return dense;
+}
+
+// A dense reversed table, for the multi-byte encodings.
+class DenseTableR
+{
+public:
+  DenseTableR(unsigned char key) : Table(DenseReverseTable(key)) {}
+  unsigned short operator[](unsigned int x) {
+    return (x <= 0xFFFD ? this->Table[x] : 0xFFFD); }
+
+private:
+  const unsigned short *Table;
+};
+
 // For reversed JIS X 0208/0212 table, include one compatibility
 // code that is beyond the BMP
-class CompressedTableJISXR
+class DenseTableJISXR
 {
 public:
-  CompressedTableJISXR(const unsigned short *table) : Table(table) {}
+  DenseTableJISXR(unsigned char key) : Table(DenseReverseTable(key)) {}
   unsigned short operator[](unsigned int x);
 
 private:
-  CompressedTable Table;
+  const unsigned short *Table;
 };
 
-unsigned short CompressedTableJISXR::operator[](unsigned int x)
+unsigned short DenseTableJISXR::operator[](unsigned int x)
 {
   if (x <= 0xFFFD)
   {
-    return this->Table[static_cast<unsigned short>(x)];
+    return this->Table[x];
   }
   if (x == 0x20B9F) // jouyou kanji that is outside BMP
   {
@@ -1471,6 +1523,34 @@ size_t UTF8ToUTF8(const char *text, size_t l, std::string *s, int mode)
   return (errpos ? errpos-text : cp-text);
 }
 
+//----------------------------------------------------------------------------
+// Check whether all octets are 7-bit ASCII.  The octets are checked
+// several words at a time, which is fast enough that this check can
+// be done before every conversion.
+bool IsASCII(const char *text, size_t l)
+{
+  // a mask with the high bit of every octet set
+  const size_t highbits = (~static_cast<size_t>(0)/0xFF)*0x80;
+  const size_t w = sizeof(size_t);
+
+  size_t i = 0;
+  for (; i + 4*w <= l; i += 4*w)
+  {
+    size_t x[4];
+    memcpy(x, &text[i], sizeof(x));
+    if (((x[0] | x[1] | x[2] | x[3]) & highbits) != 0)
+    {
+      return false;
+    }
+  }
+  unsigned char bits = 0;
+  for (; i < l; i++)
+  {
+    bits |= static_cast<unsigned char>(text[i]);
+  }
+  return ((bits & 0x80) == 0);
+}
+
 //----------------------------------------------------------------------------
 size_t ASCIIToUTF8(const char *text, size_t l, std::string *s, int mode)
 {
@@ -1617,8 +1697,8 @@ size_t vtkDICOMCharacterSet::UTF8ToSJIS(
   const char *text, size_t l, std::string *s)
 {
   // windows-31j (shift-jis)
-  CompressedTableJISXR table(vtkDICOMCharacterSet::Reverse[X_EUCJP]);
-  CompressedTableR table2(vtkDICOMCharacterSet::Reverse[X_SJIS]);
+  DenseTableJISXR table(X_EUCJP);
+  DenseTableR table2(X_SJIS);
 
   const char *errpos = 0;
   const char *cp = text;
@@ -1771,7 +1851,7 @@ size_t vtkDICOMCharacterSet::SJISToUTF8(
 size_t vtkDICOMCharacterSet::UTF8ToEUCJP(
   const char *text, size_t l, std::string *s)
 {
-  CompressedTableJISXR table(vtkDICOMCharacterSet::Reverse[X_EUCJP]);
+  DenseTableJISXR table(X_EUCJP);
 
   const char *errpos = 0;
   const char *cp = text;
@@ -1894,7 +1974,7 @@ size_t vtkDICOMCharacterSet::UTF8ToBig5(
   const char *text, size_t l, std::string *s)
 {
   // traditional Chinese
-  CompressedTableR table(vtkDICOMCharacterSet::Reverse[X_BIG5]);
+  DenseTableR table(X_BIG5);
 
   const char *errpos = 0;
   const char *cp = text;
@@ -1995,8 +2075,8 @@ size_t vtkDICOMCharacterSet::UTF8ToGBK(
   const char *text, size_t l, std::string *s)
 {
   // Chinese national encoding standard
-  CompressedTableR table(vtkDICOMCharacterSet::Reverse[GB18030]);
-  CompressedTableR table2(vtkDICOMCharacterSet::Reverse[GBK]);
+  DenseTableR table(GB18030);
+  DenseTableR table2(GBK);
 
   const char *errpos = 0;
   const char *cp = text;
@@ -2141,7 +2221,7 @@ size_t vtkDICOMCharacterSet::UTF8ToGB18030(
   const char *text, size_t l, std::string *s)
 {
   // Chinese national encoding standard
-  CompressedTableR table(vtkDICOMCharacterSet::Reverse[GB18030]);
+  DenseTableR table(GB18030);
 
   const char *errpos = 0;
   const char *cp = text;
@@ -2333,8 +2413,8 @@ size_t vtkDICOMCharacterSet::UTF8ToGB2312(
   const char *text, size_t l, std::string *s)
 {
   // Chinese national encoding standard
-  CompressedTableR table(vtkDICOMCharacterSet::Reverse[GB18030]);
-  CompressedTableR table2(vtkDICOMCharacterSet::Reverse[X_GB2312]);
+  DenseTableR table(GB18030);
+  DenseTableR table2(X_GB2312);
 
   const char *errpos = 0;
   const char *cp = text;
@@ -2432,9 +2512,9 @@ size_t vtkDICOMCharacterSet::UTF8ToJISX(
   int charset, const char *text, size_t l, std::string *s)
 {
   // table for JIS X 0208 and JIS X 0212
-  CompressedTableJISXR table(vtkDICOMCharacterSet::Reverse[X_EUCJP]);
+  DenseTableJISXR table(X_EUCJP);
   // table for JIS X 0208 compatibility mappings
-  CompressedTableR table2(vtkDICOMCharacterSet::Reverse[X_SJIS]);
+  DenseTableR table2(X_SJIS);
 
   bool hasJISX0201 = ((charset & ISO_IR_13) == ISO_IR_13);
   bool hasJISX0208 = ((charset & ISO_2022_IR_87) == ISO_2022_IR_87);
@@ -2630,7 +2710,7 @@ size_t vtkDICOMCharacterSet::UTF8ToEUCKR(
   const char *text, size_t l, std::string *s)
 {
   // EUC-KR encoding of KS X 1001 (and CP949 for compatibility)
-  CompressedTableR table(vtkDICOMCharacterSet::Reverse[X_EUCKR]);
+  DenseTableR table(X_EUCKR);
 
   const char *errpos = 0;
   const char *cp = text;
@@ -3441,11 +3521,32 @@ std::string vtkDICOMCharacterSet::ToUTF8(
   return s;
 }
 
+//----------------------------------------------------------------------------
+bool vtkDICOMCharacterSet::IsPlainASCII(const char *text, size_t l) const
+{
+  // for JIS X 0201 in G0, backslash is yen and tilde is overline
+  if (this->Key == ISO_IR_13 ||
+      (this->IsISO2022() && (this->Key & ISO_IR_13) != 0 &&
+       (this->Key & ISO_2022_BASE) <= ISO_2022_JP_BASE))
+  {
+    return false;
+  }
+
+  // escape codes might switch G0 to a different character set
+  return (IsASCII(text, l) &&
+          (!this->IsISO2022() || memchr(text, '\033', l) == 0));
+}
+
 //----------------------------------------------------------------------------
 size_t vtkDICOMCharacterSet::AnyToUTF8(
   const char *text, size_t l, std::string *s, int mode) const
 {
-  if (this->Key == ISO_IR_6)
+  if (this->IsPlainASCII(text, l))
+  {
+    // most text is plain ASCII, which is already valid utf-8
+    s->append(text, l);
+  }
+  else if (this->Key == ISO_IR_6)
   {
     l = ASCIIToUTF8(text, l, s, mode);
   }
@@ -3572,6 +3673,20 @@ std::string vtkDICOMCharacterSet::CaseFoldedUTF8(
   std::string s;
   std::string t;
 
+  if (this->IsPlainASCII(text, l))
+  {
+    // only ascii uppercase needs to be folded
+    s.assign(text, l);
+    for (size_t i = 0; i < l; i++)
+    {
+      if (s[i] >= 'A' && s[i] <= 'Z')
+      {
+        s[i] += 0x20;
+      }
+    }
+    return s;
+  }
+
   const char *cp = text;
   const char *ep = text + l;
 
@@ -3770,3 +3885,30 @@ ostream& operator<<(ostream& o, const vtkDICOMCharacterSet& a)
   }
   return o << s.c_str();
 }
+
+//----------------------------------------------------------------------------
+// A helper class to delete static variables when program exits.
+static unsigned int vtkDICOMCharacterSetInitializerCounter;
+
+// Perform initialization of static variables.
+vtkDICOMCharacterSetInitializer::vtkDICOMCharacterSetInitializer()
+{
+  if (vtkDICOMCharacterSetInitializerCounter++ == 0)
+  {
+    vtkDICOMCharacterSetLock = new vtkSimpleMutexLock;
+  }
+}
+
+// Perform cleanup of static variables.
+vtkDICOMCharacterSetInitializer::~vtkDICOMCharacterSetInitializer()
+{
+  if (--vtkDICOMCharacterSetInitializerCounter == 0)
+  {
+    for (int i = 0; i < 256; i++)
+    {
+      delete [] vtkDICOMCharacterSetDenseReverse[i];
+      vtkDICOMCharacterSetDenseReverse[i] = 0;
+    }
+    delete vtkDICOMCharacterSetLock;
+  }
+}
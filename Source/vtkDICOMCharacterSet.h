@@ -147,7 +147,10 @@ public:
    *  nevertheless use a non-ASCII character encoding.  This method can be
    *  used to specify the character set in absence of SpecificCharacterSet.
    *  If SpecificCharacterSet is present, the default will not override it
-   *  unless OverrideCharacterSet is true.
+   *  unless OverrideCharacterSet is true.  The global default is copied
+   *  by the reader, parser, and directory classes when they are created,
+   *  so code that runs on several threads should use the per-instance
+   *  SetDefaultCharacterSet() methods of those classes instead.
    */
   static void SetGlobalDefault(vtkDICOMCharacterSet cs) {
     GlobalDefault = cs.GetKey(); }
@@ -241,6 +244,15 @@ public:
   std::string CaseFoldedUTF8(const std::string& text) const {
     return CaseFoldedUTF8(text.data(), text.length()); }
 
+  //! Returns true if the text is plain ASCII that needs no conversion.
+  /*!
+   *  This checks that the text has only 7-bit codes with no escape
+   *  codes, and that this character set maps these codes to ASCII,
+   *  which is true for all but those that use JIS X 0201 in G0.  Such
+   *  text is already valid UTF-8, so it can be used without ToUTF8().
+   */
+  bool IsPlainASCII(const char *text, size_t l) const;
+
   //! Returns true if ISO 2022 escape codes are used.
   /*!
    *  If this method returns true, then escape codes can be used to
@@ -340,5 +352,25 @@ public:
 
 VTKDICOM_EXPORT ostream& operator<<(ostream& o, const vtkDICOMCharacterSet& a);
 
+//! @cond
+//! Initializer (Schwarz counter).
+/*!
+ *  This ensures that the vtkDICOMCharacterSet module is initialized before
+ *  any other module that includes this header file.
+ */
+class VTKDICOM_EXPORT vtkDICOMCharacterSetInitializer
+{
+public:
+  vtkDICOMCharacterSetInitializer();
+  ~vtkDICOMCharacterSetInitializer();
+private:
+  vtkDICOMCharacterSetInitializer(const vtkDICOMCharacterSetInitializer&);
+  vtkDICOMCharacterSetInitializer& operator=(
+    const vtkDICOMCharacterSetInitializer&);
+};
+
+static vtkDICOMCharacterSetInitializer vtkDICOMCharacterSetInitializerInstance;
+//! @endcond
+
 #endif /* vtkDICOMCharacterSet_h */
 // VTK-HeaderTest-Exclude: vtkDICOMCharacterSet.h
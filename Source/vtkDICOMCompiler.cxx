@@ -70,6 +70,16 @@ public:
   {
     return comp->ComputePixelDataSize();
   }
+
+  static void RecordItemOffset(vtkDICOMCompiler *comp,
+    const unsigned char *cp)
+  {
+    if (comp->RecordOffsets)
+    {
+      comp->RecordOffsets[comp->RecordCounter++] =
+        static_cast<unsigned int>(comp->BytesWritten + (cp - comp->Buffer));
+    }
+  }
 };
 
 namespace {
@@ -684,6 +694,12 @@ bool Encoder<E>::WriteDataElement(
         {
           break;
         }
+        // DICOMDIR records are referenced by their offsets
+        if (this->Depth == 0 && tag == DC::DirectoryRecordSequence)
+        {
+          vtkDICOMCompilerInternalFriendship::RecordItemOffset(
+            this->Compiler, cp);
+        }
         // item start
         Encoder<E>::PutInt16(cp, HxFFFE);
         Encoder<E>::PutInt16(cp+2, HxE000);
@@ -869,6 +885,10 @@ vtkDICOMCompiler::vtkDICOMCompiler()
   this->MetaData = NULL;
   this->OutputFile = NULL;
   this->Buffer = NULL;
+  this->BytesWritten = 0;
+  this->RecordOffsets = NULL;
+  this->RecordCounter = 0;
+  this->DryRun = false;
   this->BufferSize = 8192;
   this->ChunkSize = 0;
   this->Index = 0;
@@ -970,6 +990,37 @@ void vtkDICOMCompiler::WriteHeader()
   this->WriteFile(this->MetaData, this->Index);
 }
 
+//----------------------------------------------------------------------------
+bool vtkDICOMCompiler::ComputeDirectoryRecordOffsets(unsigned int *offsets)
+{
+  if (!this->MetaData)
+  {
+    vtkErrorMacro("ComputeDirectoryRecordOffsets: No meta data was set");
+    return false;
+  }
+
+  // the UIDs must not change size before the file is written
+  if (this->SOPInstanceUID == 0)
+  {
+    std::string uid = vtkDICOMUtilities::GenerateUID(DC::SOPInstanceUID);
+    this->SetSOPInstanceUID(uid.c_str());
+  }
+  if (this->SeriesInstanceUID == 0)
+  {
+    std::string uid = vtkDICOMUtilities::GenerateUID(DC::SeriesInstanceUID);
+    this->SetSeriesInstanceUID(uid.c_str());
+  }
+
+  this->DryRun = true;
+  this->RecordOffsets = offsets;
+  this->RecordCounter = 0;
+  bool r = this->WriteFile(this->MetaData, this->Index);
+  this->DryRun = false;
+  this->RecordOffsets = NULL;
+
+  return r;
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMCompiler::Close()
 {
@@ -1136,9 +1187,13 @@ bool vtkDICOMCompiler::WriteFile(vtkDICOMMetaData *data, int idx)
     this->GenerateSeriesUIDs();
   }
 
-  this->OutputFile = new vtkDICOMFile(this->FileName, vtkDICOMFile::Out);
+  // a dry run computes offsets without writing anything
+  if (!this->DryRun)
+  {
+    this->OutputFile = new vtkDICOMFile(this->FileName, vtkDICOMFile::Out);
+  }
 
-  if (this->OutputFile->GetError())
+  if (this->OutputFile && this->OutputFile->GetError())
   {
     this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
     const char *errText = "Can't open the file ";
@@ -1159,6 +1214,7 @@ bool vtkDICOMCompiler::WriteFile(vtkDICOMMetaData *data, int idx)
   this->Buffer = new unsigned char [this->BufferSize];
   // guard against anyone changing BufferSize while compiling the file
   this->ChunkSize = this->BufferSize;
+  this->BytesWritten = 0;
 
   unsigned char *cp = this->Buffer;
   unsigned char *ep = cp + this->ChunkSize;
@@ -1190,9 +1246,10 @@ bool vtkDICOMCompiler::WriteFile(vtkDICOMMetaData *data, int idx)
   }
 
   delete [] this->Buffer;
+  this->Buffer = NULL;
 
   // delete the file if an error occurred
-  if (!r)
+  if (!r && !this->DryRun)
   {
     if (this->GetErrorCode() == vtkErrorCode::NoError)
     {
@@ -1595,7 +1652,12 @@ bool vtkDICOMCompiler::FlushBuffer(
   if (cp)
   {
     size_t n = cp - dp;
-    size_t m = this->OutputFile->Write(dp, n);
+    size_t m = n;
+    if (this->OutputFile)
+    {
+      m = this->OutputFile->Write(dp, n);
+    }
+    this->BytesWritten += m;
     rval = (n == m);
   }
 
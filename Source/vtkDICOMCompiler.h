@@ -173,6 +173,22 @@ public:
   unsigned long GetErrorCode() { return this->ErrorCode; }
   //@}
 
+  //@{
+  //! Compute where each directory record will be written.
+  /*!
+   *  The records in a DICOMDIR file refer to each other by their byte
+   *  offsets from the beginning of the file.  This method compiles the
+   *  meta data without writing anything, and stores the offset of each
+   *  item in the DirectoryRecordSequence in "offsets", which must have
+   *  room for all of the items.  Since the offset attributes have a fixed
+   *  size, they can then be set in the records without changing where
+   *  the records will be written.  If the SOPInstanceUID or the
+   *  SeriesInstanceUID has not been set, it will be generated and set
+   *  by this method, so that it will not change when the file is written.
+   */
+  bool ComputeDirectoryRecordOffsets(unsigned int *offsets);
+  //@}
+
   //@{
   //! Generate a series UID and instance UIDs for the meta data.
   /*!
@@ -256,6 +272,10 @@ protected:
   vtkStringArray *SeriesUIDs;
   vtkDICOMFile *OutputFile;
   unsigned char *Buffer;
+  size_t BytesWritten;
+  unsigned int *RecordOffsets;
+  unsigned int RecordCounter;
+  bool DryRun;
   unsigned char **FrameData;
   unsigned int *FrameLength;
   unsigned int FrameCounter;
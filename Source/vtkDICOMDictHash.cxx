@@ -5284,3398 +5284,2159 @@ const DictEntry DictContents[] = {
 { 0xFFFE, 0xE0DD, 0, VR::XX, VM::M0, "SequenceDelimitationItem" },
 };
 
-const unsigned short DictTagHashTable[] = {
- 4097,  4132,  4155,  4176,  4197,  4216,  4235,  4256,  4275,  4290,
- 4303,  4316,  4327,  4340,  4357,  4368,  4379,  4404,  4427,  4448,
- 4467,  4482,  4501,  4514,  4533,  4556,  4575,  4594,  4613,  4626,
- 4643,  4656,  4671,  4700,  4717,  4742,  4763,  4782,  4797,  4818,
- 4829,  4848,  4867,  4886,  4903,  4924,  4941,  4958,  4971,  4994,
- 5019,  5044,  5063,  5076,  5093,  5108,  5129,  5150,  5177,  5198,
- 5223,  5246,  5265,  5282,  5303,  5346,  5393,  5434,  5473,  5508,
- 5535,  5570,  5605,  5642,  5671,  5704,  5729,  5758,  5777,  5802,
- 5827,  5864,  5907,  5938,  5969,  5988,  6019,  6040,  6067,  6098,
- 6119,  6144,  6171,  6198,  6221,  6236,  6255,  6276,  6297,  6318,
- 6337,  6354,  6371,  6386,  6403,  6414,  6433,  6454,  6469,  6482,
- 6499,  6506,  6511,  6534,  6555,  6578,  6601,  6628,  6647,  6670,
- 6693,  6712,  6729,  6742,  6763,  6774,  6787,  6796,  6805,  6826,
- 6841,  6856,  6867,  6882,  6895,  6910,  6921,  6944,  6951,  6970,
- 6981,  6998,  7005,  7022,  7033,  7056,  7065,  7084,  7097,  7108,
- 7115,  7132,  7143,  7162,  7173,  7190,  7199,  7218,  7229,  7248,
- 7253,  7266,  7277,  7284,  7295,  7300,  7309,  7316,  7327,  7336,
- 7341,  7348,  7353,  7358,  7365,  7372,  7377,  7388,  7399,  7408,
- 7417,  7426,  7435,  7440,  7447,  7456,  7463,  7468,  7475,  7478,
- 7481,  7488,  7491,  7508,  7527,  7540,  7551,  7566,  7587,  7606,
- 7617,  7632,  7645,  7662,  7673,  7686,  7695,  7714,  7725,  7744,
- 7759,  7776,  7785,  7794,  7801,  7814,  7825,  7840,  7851,  7868,
- 7879,  7892,  7901,  7914,  7925,  7934,  7945,  7956,  7961,  7970,
- 7973,  7982,  7985,  7994,  7999,  8012,  8023,  8034,  8041,  8048,
- 8051,  8062,  8075,  8086,  8093,  8100,  8109,  8118,  8123,  4096,
- 8128,  8133,  8136,  4096,  8139,  8144,  8149,  8162,  8175,  8184,
- 8199,  8218,  8231,  8246,  8267,  8282,  8299,  8302,  8311,  8320,
- 8335,  8344,  8359,  8376,  8391,  8404,  8417,  8434,  8451,  8466,
- 8479,  8492,  8507,  8514,  8527,  8534,  8545,  8552,  8561,  8570,
- 8577,  8584,  8589,  8602,  8609,  8618,  8627,  8640,  8647,  8654,
- 8659,  8670,  8681,  8690,  8699,  8708,  8715,  8726,  8733,  8746,
- 8753,  8764,  8771,  8778,  4096,  8783,  8786,  8797,  8806,  8813,
- 8818,  8831,  8846,  8865,  8882,  8899,  8918,  8933,  8954,  8973,
- 8984,  8999,  9010,  9027,  9040,  9053,  9068,  9085,  9100,  9109,
- 9118,  9133,  9148,  9163,  9178,  9191,  9202,  9211,  9214,  9229,
- 9238,  9247,  9254,  9275,  9292,  9309,  9320,  9343,  9352,  9375,
- 9396,  9417,  9428,  9441,  9450,  9467,  9478,  9491,  9496,  9515,
- 9528,  9539,  9548,  9567,  9580,  9601,  9616,  9631,  9638,  9653,
- 9658,  9677,  9688,  9703,  9712,  9721,  9730,  9739,  9746,  9765,
- 9772,  9781,  9790,  9799,  9812,  9825,  9838,  9851,  9864,  9873,
- 9884,  9893,  9902,  9911,  9918,  9935,  9944,  9953,  9960,  9977,
- 9984,  9995, 10006, 10017, 10032, 10047, 10062, 10067, 10072, 10077,
-10080, 10095, 10102, 10109, 10112, 10119, 10124, 10129, 10134, 10143,
-10146, 10153, 10156,  4096, 10161,  4096, 10166, 10183, 10186, 10193,
-10196, 10207, 10214, 10219, 10222, 10237, 10240, 10255, 10260, 10287,
-10304, 10331, 10344, 10369, 10388, 10413, 10430, 10459, 10480, 10511,
-10526, 10559, 10574, 10605, 10624, 10649, 10662, 10687, 10698, 10725,
-10744, 10771, 10784, 10815, 10834, 10865, 10882, 10913, 10930, 10963,
-10980, 10993, 11004, 11015, 11026, 11039, 11054, 11065, 11078, 11091,
-11104, 11117, 11130, 11145, 11158, 11173, 11186, 11199, 11210, 11221,
-11234, 11247, 11268, 11279, 11294, 11307, 11320, 11337, 11350, 11369,
-11384, 11401, 11414, 11423, 11434, 11439, 11444, 11447, 11450, 11455,
-11458, 11463, 11478, 11487, 11500, 11511, 11524, 11531, 11536, 11543,
-11554, 11559,  4096, 11568, 11573, 11576, 11579, 11588, 11597, 11604,
-11609, 11618, 11629, 11636, 11645, 11660, 11669, 11676, 11683, 11686,
-11689, 11696, 11701, 11710, 11719, 11728, 11735, 11740, 11747, 11754,
-11761, 11772, 11783, 11788, 11791, 11794, 11797, 11802, 11807, 11816,
-11825, 11836, 11849, 11858, 11871, 11882, 11891, 11902, 11911, 11916,
-11925,  4096, 11930, 11937, 11944, 11953, 11958, 11971, 11980, 11991,
-12000, 12007, 12016, 12027, 12038, 12045, 12048,  4096, 12051, 12054,
-12059,  4096, 12062, 12067, 12070, 12077, 12084, 12097, 12106, 12113,
-12118, 12123, 12128,  4096,  4096, 12133, 12136, 12143, 12150, 12157,
-12168, 12175, 12180, 12185, 12192, 12199, 12208, 12215, 12226, 12233,
-12236, 12239, 12246, 12257, 12264, 12273, 12282, 12285, 12294, 12301,
-12310, 12317, 12324, 12329, 12336, 12343, 12346, 12349, 12356, 12361,
-12364, 12367, 12370, 12375, 12378, 12381, 12384, 12391, 12396, 12399,
-12402, 12405, 12408, 12411, 12416, 12421, 12426, 12433,  4096,  4096,
-12440,  4096, 12443, 12450, 12457, 12460, 12465, 12468, 12471, 12474,
-12479, 12486,  4096,  4096,  4096,  4096,  4096, 12491, 12494, 12503,
-12506, 12509, 12512, 12519, 12522, 12527, 12530,  4096, 12535,  4096,
-12540,  4096, 12545,  4096, 12548, 12555, 12562, 12571, 12578, 12583,
-12592, 12597, 12604, 12609, 12616, 12623, 12632, 12637, 12642, 12647,
-12654, 12661, 12668, 12675, 12682, 12689, 12696, 12703, 12710, 12723,
-12734, 12741, 12750, 12753, 12764, 12773, 12782, 12789, 12792, 12795,
-12800, 12805, 12810, 12815, 12818, 12821, 12826, 12829, 12832,  4096,
-12835, 12840, 12843, 12848, 12851, 12856, 12863, 12866, 12869,  4096,
- 4096, 12872, 12875,  4096, 12878,  4096, 12881, 12884, 12887, 12894,
-12901, 12910, 12915, 12922, 12925, 12930, 12935, 12944, 12949, 12952,
-12955, 12962, 12967, 12970, 12975,  4096, 12982,  4096, 12987, 12992,
- 4096, 12995,  4096, 12998, 13003,  4096,  4096, 13006,  4096,  4096,
-13009, 13014, 13017,  4096, 13020, 13025, 13030, 13033, 13036, 13041,
-13048, 13051, 13054, 13057, 13060, 13065, 13070, 13075, 13078, 13083,
-13086, 13097, 13102, 13107, 13114, 13119, 13124, 13127, 13134, 13137,
-13142, 13145, 13152, 13159, 13162, 13169, 13174, 13183, 13186, 13193,
-13196, 13199, 13202, 13205, 13212, 13223, 13228, 13235, 13240, 13243,
-13248, 13253, 13256, 13263, 13272, 13277, 13280, 13283, 13290, 13293,
-13300, 13305, 13312, 13319, 13328, 13331, 13334, 13339, 13344, 13351,
-13354, 13357, 13362, 13369,  4096, 13376, 13379, 13386, 13397, 13402,
-13409, 13412, 13415,  4096, 13420, 13425, 13430, 13433,  4096, 13440,
-13445, 13448, 13455, 13458, 13463, 13466, 13469, 13474, 13477, 13480,
-13483, 13486, 13491, 13494, 13497,  4096, 13500, 13503, 13506, 13509,
-13512, 13515, 13518, 13523, 13526, 13531, 13534, 13537, 13540, 13543,
-13546,  4096, 13549,  4096, 13552, 13555, 13558, 13561,  4096, 13564,
- 4096, 13567, 13572, 13575, 13580, 13583,  4096,  4096,  4096,  4096,
-13588,  4096, 13591,  4096, 13594,  4096,  4096, 13597, 13600, 13603,
-13608, 13611,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
-13616, 13627, 13632, 13641, 13648, 13657, 13666, 13673, 13684, 13691,
-13702, 13709, 13718, 13725, 13730, 13737, 13744, 13753, 13762, 13769,
-13774, 13781, 13788, 13793, 13800, 13807, 13812, 13819, 13826, 13833,
-13840, 13849, 13856, 13861, 13866, 13869, 13872, 13879, 13884, 13889,
- 4096,  4096,  4096, 13892,  4096,  4096,  4096,  4096, 13895, 13900,
-13905, 13908, 13911, 13914, 13917, 13920,  4096,  4096, 13923,  4096,
-13926, 13929, 13932, 13935, 13938, 13941,  4096, 13944, 13947, 13950,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 13955,  4096,
-13958, 13963,  4096, 13968, 13971, 13974, 13979,  4096,  4096, 13982,
- 4096, 13985,  4096,  4096, 13988,  4096, 13991, 13994, 13999, 14002,
-14007,  4096, 14010, 14013, 14018, 14025, 14032, 14035, 14042, 14045,
-14048, 14053, 14056,  4096,  4096,  4096,  4096,  4096, 14061,  4096,
-14064, 14067, 14072, 14075, 14078,  4096,  4096,  4096,  4096, 14081,
-14086, 14091, 14096, 14107, 14112, 14117, 14122, 14125, 14128, 14131,
-14134, 14137,  4096, 14140,  4096, 14143, 14152, 14155, 14158, 14163,
- 4096, 14166,  4096, 14171, 14174, 14177,  4096,  4096,  4096, 14180,
-14183, 14186, 14191, 14196, 14203, 14210, 14215, 14218, 14223,  4096,
- 4096,  4096,  4096,  4096,  4096, 14226, 14229,  4096,  4096, 14232,
-14235, 14240, 14243, 14246,  4096, 14249, 14252, 14255, 14258, 14261,
-14264, 14267,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
-14270, 14273, 14276, 14279,  4096,  4096,  4096,  4096, 14282,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096, 14285, 14288, 14291, 14294,
-14297,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096, 14300,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 14303,
- 4096,  4096, 14306,  4096,  4096,  4096, 14309,  4096, 14314,  4096,
-14319,  4096, 14324,  4096, 14329,  4096, 14336,  4096, 14345, 14350,
-14353,  4096, 14358, 14363, 14366,  4096, 14371,  4096, 14376,  4096,
-14381, 14390, 14393, 14402, 14407, 14412, 14415, 14420,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096, 14423, 14426,  4096, 14429,
-14432, 14435, 14438, 14441,  4096, 14444, 14447, 14450, 14453, 14456,
-14459,  4096, 14462, 14465, 14468, 14471,  4096, 14474, 14477, 14480,
-14483, 14488, 14493,  4096, 14496, 14503, 14508, 14511,  4096,  4096,
-14514,  4096, 14517,  4096,  4096,  4096, 14520, 14523,  4096, 14526,
-14529,  4096, 14536,  4096,  4096,  4096, 14539,  4096, 14542, 14545,
- 4096,  4096, 14548, 14553, 14556, 14561, 14564, 14569, 14572, 14577,
-14582, 14585, 14588,  4096, 14591, 14596, 14601,  4096, 14604,  4096,
-14607,  4096, 14610, 14621, 14624, 14627,  4096,  4096, 14632,  4096,
- 4096,  4096,  4096,  4096, 14635, 14642, 14647,  4096, 14650, 14653,
-14656, 14661,  4096,  4096, 14668,  4096, 14671, 14674,  4096, 14677,
-14680, 14685, 14690, 14693, 14698, 14701,  4096,  4096,  4096,  4096,
- 4096, 14704, 14707, 14712, 14717, 14720, 14725, 14728, 14733, 14736,
-14741, 14746, 14751, 14754,  4096,  4096,  4096, 14759, 14762, 14765,
-14770,  4096, 14773, 14776, 14781, 14784,  4096, 14789, 14794, 14797,
- 4096,  4096,  4096,  4096, 14802, 14807,  4096,  4096,  4096,  4096,
- 4096,  4096, 14812,  4096,  4096,  4096, 14817,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 14820,  4096,
- 4096,  4096, 14825,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096, 14830,  4096,  4096,  4096, 14833,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096, 14836,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096, 14839,  4096,  4096,
- 4096, 14842,  4096,  4096, 14845, 14848, 14851, 14854,  4096,  4096,
- 4096,  4096,  4096, 14857, 14860, 14863, 14866, 14869, 14874, 14877,
-14880, 14883,  4096, 14886,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096, 14889,  4096,  4096, 14892, 14895,  4096, 14898,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 14901,
- 4096,  4096,  4096,  4096,  4096,  4096, 14904, 14909,  4096,  4096,
- 4096,  4096,  4096,  4096, 14914, 14917,  4096, 14920,  4096, 14923,
-14926,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
-14929,  4096,  4096, 14932, 14935,  4096, 14938, 14941, 14944, 14947,
-14952, 14955,  4096,  4096,  4096,  4096, 14958,  4096, 14961, 14966,
-14973, 14978, 14985, 14990,  4096,  4096, 14995,  4096,  4096,  4096,
- 4096,  4096, 14998, 15003, 15010, 15015, 15020, 15023, 15030, 15035,
-15042, 15047, 15050,  4096, 15055, 15058, 15061, 15064, 15067, 15072,
-15077, 15082, 15087, 15090, 15093, 15096, 15099, 15102, 15105,  4096,
- 4096,  4096,  4096,  4096, 15110, 15115, 15118, 15125, 15128,  4096,
-15133, 15136, 15139, 15144, 15147, 15152, 15155,  4096,  4096,  4096,
-15158, 15163,  4096, 15168, 15173, 15178, 15183, 15188, 15195, 15198,
- 4096,  4096,  4096,  4096,  4096,  4096, 15203, 15206, 15209, 15212,
-15215, 15218, 15221, 15224,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096, 15227,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096, 15230, 15233,  4096, 15236,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096, 15239, 15244,  4096,  4096,
-15247, 15250, 15253, 15256, 15259,  4096, 15264, 15267,  4096,  4096,
- 4096,  4096, 15270, 15275, 15280,  4096, 15285, 15288, 15293, 15296,
-15299, 15302, 15305, 15308,  4096,  4096,  4096,  4096, 15311,  4096,
- 4096,  4096, 15314, 15317,  4096, 15320, 15323,  4096, 15326, 15329,
- 4096,  4096,  4096,  4096, 15332, 15335, 15338,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096, 15341,  4096, 15344,  4096,
-15349, 15354, 15357, 15360, 15363,  4096, 15368, 15371, 15376,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096, 15379, 15384, 15387,  4096,
-15390, 15393, 15396, 15399, 15402, 15407,  4096,  4096,  4096,  4096,
- 4096,  4096, 15412,  4096,  4096, 15417, 15420, 15423, 15428, 15433,
-15438, 15441,  4096, 15444,  4096,  4096,  4096,  4096, 15447, 15450,
- 4096, 15453, 15458, 15463, 15468, 15471, 15476, 15479, 15486, 15489,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096, 15494,  4096, 15499,  4096, 15504,  4096,
-15509,  4096, 15514,  4096, 15519,  4096, 15524,  4096, 15529,  4096,
-15534, 15539, 15544,  4096, 15549,  4096, 15554,  4096, 15559,  4096,
-15564,  4096, 15569,  4096, 15574,  4096,  4096, 15579,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096, 15582,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096, 15585,  4096, 15590, 15593, 15596, 15599,
-15602, 15605, 15608, 15611, 15614, 15617, 15620,  4096,  4096,  4096,
-15623, 15626,  4096,  4096,  4096,  4096, 15629,  4096,  4096,  4096,
-15632, 15635,  4096, 15638,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096, 15641,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 15644, 15647,
-15650, 15653,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096, 15656,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096, 15659,  4096, 15662,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
-15665, 15668, 15671,  4096, 15674,  4096, 15677,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096, 15680,  4096, 15683, 15690, 15693, 15700, 15703, 15710,
-15713, 15720, 15723, 15732, 15735, 15744, 15747, 15754, 15757, 15764,
-15767, 15774, 15777, 15784, 15787, 15794, 15797, 15804, 15807, 15814,
-15817, 15824, 15827, 15836, 15839, 15848,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096, 15851,  4096, 15854,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096, 15857, 15860,  4096,  4096,
- 4096,  4096,  4096,  4096, 15863,  4096, 15866,  4096, 15869, 15872,
-15875, 15878,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096, 15881,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096, 15884, 15887,  4096, 15890, 15893, 15896, 15899, 15902,
- 4096, 15905,  4096, 15908, 15911, 15914, 15917, 15920,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096, 15923,  4096,  4096, 15926,  4096,
-15929, 15932,  4096,  4096,  4096,  4096,  4096, 15935,  4096,  4096,
- 4096, 15938, 15941, 15944, 15947,  4096, 15950, 15953,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096, 15956, 15959, 15962, 15965, 15968,  4096, 15971, 15974,
-15977, 15980, 15983,  4096, 15986, 15989, 15992, 15995, 15998, 16001,
-16004, 16007, 16010, 16013, 16016, 16019,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096, 16022,  4096,  4096,  4096, 16025, 16028,
-16031, 16034, 16037, 16040, 16043, 16046, 16049, 16052, 16055, 16058,
-16061, 16064, 16067, 16070, 16073, 16076, 16079, 16082, 16085, 16088,
-16091, 16094, 16097, 16100, 16105, 16108, 16111, 16114, 16117, 16120,
-16123, 16126, 16129, 16132,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 16135,
- 4096,  4096,  4096,  4096,  4096,  4096, 16138, 16141,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096, 16144,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 16147,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096, 16150,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 16153,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096, 16156,  4096,  4096, 16159,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 16162,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096, 16165,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
-16168, 16171,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096, 16174,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096, 16177,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
-16180,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4096,  4096,  4096,  4096,     0,    17,     2,     2,
-   34,     8,   142,  4169,   244,    16,  1051, 37457,  1353,    32,
- 1494,    34,  1633,    36,  1976,    50,  2167,  4097,  2429,    70,
- 3053,   114,  3374,   162,  4071, 16384,  4084,   268,  5265, 65530,
- 5266, 65532,    11,     3,     3,   141,  4168,   287,  4176,  1050,
-37456,  1634,    37,  1977,    51,  3054,   115,  3151,  4148,  3301,
- 1025,  3535,   196,  3723,   200,    10,     0,     0,   320,    16,
- 1053, 37459,  1354,    34,  1492,    32,  2169,  4099,  2428,    68,
- 3051,   112,  3302,  1026,  3373,   160,    10,     1,     1,  1052,
-37458,  1493,    33,  1998,  4208,  2168,  4098,  3052,   113,  3152,
- 4150,  3303,  1027,  3536,   198,  3724,   202,     9,  1055, 37461,
- 1355,    36,  1631,    32,  2171,  4101,  2427,    66,  2586,    80,
- 3057,   118,  3304,  1028,  4080,   264,     9,  1054, 37460,  1534,
- 4198,  1632,    33,  2170,  4100,  2587,    81,  3149,  4144,  3533,
-  192,  3725,   204,  4081,   265,    10,  1057, 37463,  1356,    38,
- 1533,  4197,  1978,    52,  2173,  4103,  2426,    64,  2588,    82,
- 3055,   116,  3218,   112,  4082,   266,     9,  1056, 37462,  1979,
-   53,  2172,  4102,  2589,    83,  3056,   117,  3150,  4146,  3534,
-  194,  3726,   206,  4083,   267,     7,   536,    16,  1059, 37465,
- 2013,    48,  2175,  4105,  3059,   122,  3234,   112,  4099, 16384,
-    6,    31,     1,   140,  4160,   622,  4176,  1058, 37464,  2174,
- 4104,  3716,   192,     6,   537,    18,  1061, 37467,  1495,    40,
- 2014,    50,  3058,   120,  3718,   195,     5,   538,    19,  1060,
-37466,  2176,  4106,  3592,   192,  3717,   194,     6,   539,    20,
- 1063, 37469,  1635,    40,  3061,   126,  3720,   197,  4076,   256,
-    8,    32,     5,   540,    21,  1062, 37468,  3062,   127,  3153,
- 4152,  3537,   200,  3719,   196,  4077,   257,     5,    33,     6,
- 1065, 37471,  3060,   124,  3722,   199,  4078,   258,     5,  1064,
-37470,  3154,  4154,  3721,   198,  4053,   192,  4079,   259,    12,
-    5,    18,    41,    24,   621,  4169,  1049, 37441,  1357,    48,
- 1498,    50,  1638,    52,  2178,  4113,  2846,    96,  3037,    98,
- 3141,  4133,  3736,   217,    11,     6,    19,   286,  4160,   620,
- 4168,  1048, 37440,  1383,  4208,  1639,    53,  2177,  4112,  2623,
- 4100,  3038,    99,  3140,  4132,  3735,   216,    10,     4,    16,
-   42,    26,  1358,    50,  1496,    48,  1640,    54,  2847,    98,
- 3035,    96,  3143,  4135,  3349,   128,  3738,   219,     9,    43,
-   27,  1497,    49,  1641,    55,  1996,  4192,  2179,  4114,  2624,
- 4102,  3036,    97,  3142,  4134,  3737,   218,     7,     7,    22,
- 1500,    54,  2431,    82,  2621,  4097,  3041,   102,  3740,   221,
- 4091,   280,     9,     8,    23,   370,  4160,  1359,    53,  1501,
-   55,  2620,  4096,  3042,   103,  3138,  4128,  3739,   220,  4092,
-  281,     6,  1636,    50,  2430,    80,  2848,   102,  3039,   100,
- 3217,    96,  4093,   282,     9,  1360,    55,  1499,    53,  1637,
-   51,  1997,  4196,  2622,  4098,  2849,   103,  3040,   101,  3139,
- 4130,  3741,   222,    11,    35,    16,   613,  4161,  1739,    48,
- 2011,    32,  2247, 37393,  2850,   104,  3045,   106,  3148,  4141,
- 3233,    96,  3728,   209,  4088,   276,     9,   143,  4176,   612,
- 4160,  1740,    49,  2012,    33,  2246, 37392,  3046,   107,  3147,
- 4140,  3727,   208,  4089,   277,     9,     9,    24,    36,    18,
-  615,  4163,  1502,    56,  1741,    50,  2034,    32,  2249, 37395,
- 3043,   104,  3730,   211,     9,    37,    19,   144,  4178,   614,
- 4162,  1503,    57,  2248, 37394,  3044,   105,  3593,   208,  3729,
-  210,  4090,   279,     6,    38,    20,   617,  4165,  1642,    56,
- 1742,    52,  3049,   110,  3732,   213,     8,    39,    21,   616,
- 4164,  1643,    57,  2250, 37396,  3050,   111,  3144,  4136,  3731,
-  212,  4085,   273,     6,    40,    22,   619,  4167,  3047,   108,
- 3146,  4139,  3734,   215,  4086,   274,     7,   618,  4166,  2251,
-37398,  3048,   109,  3145,  4138,  3733,   214,  4054,   208,  4087,
-  275,    14,   252,    48,   350,    52,   560,    56,   645,  4217,
- 1382,  4161,  1433, 37449,  1464,     2,  1732,     8,  1975,    18,
- 2033,    26,  2841,    80,  3030,    82,  3337,   162,  3751,   233,
-    8,   561,    57,   644,  4216,  1381,  4160,  1432, 37448,  1465,
-    3,  1733,     9,  2842,    81,  3750,   232,    12,    50,    42,
-  253,    50,   323,    48,   562,    58,  1734,    10,  1994,  4177,
- 2006,    26,  2435,   100,  2843,    82,  3029,    80,  3335,   160,
- 3753,   235,    10,   254,    51,   324,    49,  1463,     1,  1527,
- 4160,  1993,  4176,  2007,    27,  2844,    83,  3216,    85,  3336,
-  161,  3752,   234,     9,   255,    52,   348,    48,  1468,     6,
- 2008,    28,  2433,    98,  2594,   112,  2732,    66,  3032,    86,
- 3755,   237,     7,   256,    53,  1469,     7,  2009,    29,  2434,
-   99,  2595,   113,  2733,    67,  3754,   236,    10,   349,    50,
- 1466,     4,  1995,  4181,  2010,    30,  2432,    96,  2596,   114,
- 2730,    64,  3031,    84,  3338,   164,  3757,   239,     5,  1467,
-    5,  1528,  4164,  2597,   115,  2731,    65,  3756,   238,     9,
-   44,    32,   552,    48,   637,  4209,  1428, 37441,  1472,    10,
- 1815,  4161,  2002,    16,  3232,    80,  3743,   225,     9,    45,
-   33,   145,  4192,   553,    49,   636,  4208,  1473,    11,  1814,
- 4160,  2003,    17,  2252, 37408,  3742,   224,     9,    46,    34,
-  554,    50,   639,  4211,  1470,     8,  1727,     2,  2032,    16,
- 2845,    90,  3339,   168,  3745,   227,     8,    47,    35,   146,
- 4194,   555,    51,   638,  4210,  1471,     9,  1728,     3,  3594,
-  224,  3744,   226,    10,    48,    36,   556,    52,   641,  4213,
- 1429, 37445,  1476,    14,  1729,     4,  2004,    20,  2254, 37413,
- 3033,    94,  3747,   229,     8,    49,    37,   557,    53,   640,
- 4212,  1341,    13,  1730,     5,  2253, 37412,  3034,    95,  3746,
-  228,     8,   558,    54,   643,  4215,  1342,    14,  1431, 37447,
- 1474,    12,  1731,     6,  2005,    22,  3749,   231,     6,   559,
-   55,   642,  4214,  1430, 37446,  1475,    13,  3748,   230,  4055,
-  224,    11,   245,    32,   345,    36,   549,    40,   632,  4201,
- 1343,    16,  1479,    18,  1530,  4179,  2001,     8,  2440,   118,
- 2838,    64,  3766,   249,    12,   246,    33,   288,  4192,   346,
-   37,   550,    41,   631,  4200,  1066, 37472,  1344,    17,  1480,
-   19,  2441,   119,  2839,    65,  3131,  4100,  3765,   248,    12,
-  247,    34,   321,    32,   551,    42,  1345,    18,  1477,    16,
- 1629,    22,  1992,  4161,  2438,   116,  2840,    66,  3028,    64,
- 3133,  4103,  3768,   251,     9,   322,    33,   633,  4202,  1346,
-   19,  1478,    17,  1529,  4176,  1991,  4160,  2439,   117,  3132,
- 4102,  3767,   250,     6,   248,    36,  1347,    20,  1483,    22,
- 1626,    16,  2590,    96,  3350,   166,     8,   634,  4204,  1348,
-   21,  1484,    23,  1627,    17,  2591,    97,  3129,  4096,  3351,
-  167,  3769,   252,     7,   249,    38,  1349,    22,  1481,    20,
- 1628,    18,  2436,   112,  2592,    98,  3215,    64,    10,   250,
-   39,   344,    35,   635,  4206,  1350,    23,  1482,    21,  1531,
- 4180,  2437,   113,  2593,    99,  3130,  4098,  3770,   254,    10,
-   51,    48,   251,    40,   541,    32,   624,  4193,  1351,    24,
- 1435, 37457,  1487,    26,  1735,    16,  1817,  4177,  1973,    10,
-   13,    52,    49,   147,  4208,   542,    33,   623,  4192,  1352,
-   25,  1434, 37456,  1488,    27,  1736,    17,  1816,  4176,  3136,
- 4108,  3596,   242,  3758,   240,  4059,   246,    10,    53,    50,
-  543,    34,   626,  4195,  1437, 37459,  1485,    24,  1532,  4185,
- 1737,    18,  1819,  4179,  3352,   168,  3760,   243,    12,    54,
-   51,   148,  4210,   544,    35,   625,  4194,  1436, 37458,  1486,
-   25,  1818,  4178,  3137,  4110,  3353,   169,  3595,   240,  3759,
-  242,  4058,   244,    11,    55,    52,   347,    40,   545,    36,
-  628,  4197,  1439, 37461,  1491,    30,  1630,    24,  1738,    20,
- 1821,  4181,  2000,     4,  3762,   245,     9,    56,    53,   546,
-   37,   627,  4196,  1438, 37460,  1820,  4180,  3134,  4104,  3598,
-  246,  3761,   244,  4057,   242,     8,   547,    38,   630,  4199,
- 1441, 37463,  1489,    28,  1896, 24976,  1974,    12,  2030,     4,
- 3764,   247,    10,   548,    39,   629,  4198,  1440, 37462,  1490,
-   29,  1822,  4182,  2031,     5,  3135,  4106,  3597,   244,  3763,
-  246,  4056,   240,    21,   279,  4112,   330,    83,   520, 20752,
-  604,  4120,  1379,  4128,  1426, 37416,  1665,   101,  1754,   105,
- 1988,  4146,  2068,     1,  2551,    19,  2572,    21,  2713,    39,
- 3314,     0,  3519,   132,  3691,   136,  4194,   260,  4222,   262,
- 4407,   276,  4457,   272,  4484,   274,    23,   258,    80,   329,
-   82,   357,    84,   521, 20753,   605,  4121,  1363,    96,  1664,
-  100,  1753,   104,  1989,  4147,  2393,     4,  2499,     8,  2526,
-   16,  2550,    18,  2571,    20,  2712,    38,  3022,    50,  3213,
-   54,  3315,     1,  3389,   130,  3520,   133,  3692,   137,  4195,
-  261,  4271,   259,    20,   328,    81,   522, 20754,   606,  4122,
- 1667,   103,  1986,  4144,  2070,     3,  2394,     7,  2528,    19,
- 2549,    17,  2574,    23,  2674,    33,  2711,    37,  3316,     2,
- 3521,   134,  3693,   138,  4196,   262,  4220,   260,  4433,   276,
- 4458,   274,  4483,   272,    19,   327,    80,   358,    86,   523,
-20755,   607,  4123,  1364,    98,  1666,   102,  1987,  4145,  2069,
-    2,  2527,    18,  2573,    22,  2673,    32,  2710,    36,  3021,
-   48,  3212,    52,  3317,     3,  3388,   128,  3694,   139,  4221,
-  261,  4245,   259,    17,   368,  4112,   524, 20756,  1036, 37396,
- 1661,    97,  2072,     5,  2390,     1,  2530,    21,  2568,    17,
- 2709,    35,  3318,     4,  3517,   128,  3695,   140,  4246,   260,
- 4274,   262,  4405,   272,  4432,   274,  4459,   276,    13,   233,
-37381,   355,    80,   525, 20757,  1660,    96,  2071,     4,  2529,
-   20,  2553,    22,  2567,    16,  3211,    50,  3319,     5,  3696,
-  141,  4219,   259,  4247,   261,    17,   234, 37382,   526, 20758,
- 1519,  4132,  1663,    99,  1990,  4148,  2074,     7,  2392,     3,
- 2532,    23,  2570,    19,  2708,    33,  3518,   130,  3697,   142,
- 4248,   262,  4272,   260,  4406,   274,  4431,   272,  4485,   276,
-   17,   235, 37383,   356,    82,   527, 20759,  1037, 37399,  1520,
- 4133,  1662,    98,  2073,     6,  2391,     2,  2531,    22,  2552,
-   20,  2569,    18,  2707,    32,  3023,    52,  3210,    48,  3698,
-  143,  4193,   259,  4273,   261,    18,    58,    65,   134,  4096,
-  236, 37384,   528, 20760,   598,  4112,  1038, 37400,  1748,    97,
- 2076,     9,  2494,     1,  2534,    25,  2721,    47,  3587,   130,
- 3686,   128,  4298,   260,  4326,   262,  4511,   276,  4561,   272,
- 4588,   274,    14,    57,    64,   237, 37385,   529, 20761,   565,
-   80,   599,  4113,  1039, 37401,  1424, 37409,  1747,    96,  2075,
-    8,  2533,    24,  2720,    46,  3025,    58,  4299,   261,  4375,
-  259,    16,   530, 20762,   600,  4114,  1425, 37410,  1521,  4136,
- 1750,    99,  2078,    11,  2496,     3,  2536,    27,  2719,    45,
- 3586,   128,  3687,   130,  4300,   262,  4324,   260,  4537,   276,
- 4562,   274,  4587,   272,    12,    59,    66,   531, 20763,  1522,
- 4137,  1749,    98,  2077,    10,  2495,     2,  2535,    26,  2718,
-   44,  3024,    56,  3688,   131,  4325,   261,  4349,   259,    14,
-  532, 20764,   601,  4116,  1669,   105,  1751,   101,  2396,     9,
- 2538,    29,  2717,    43,  3522,   136,  3689,   132,  4350,   260,
- 4378,   262,  4509,   272,  4536,   274,  4563,   276,     9,   533,
-20765,  1668,   104,  2395,     8,  2537,    28,  2575,    24,  2716,
-   42,  3027,    62,  4323,   259,  4351,   261,    12,   534, 20766,
-  602,  4118,  2398,    11,  2498,     7,  2715,    41,  3690,   134,
- 4050,   128,  4352,   262,  4376,   260,  4510,   274,  4535,   272,
- 4589,   276,    12,   418, 12441,   535, 20767,   603,  4119,  1752,
-  102,  2397,    10,  2497,     6,  2539,    30,  2714,    40,  3026,
-   60,  3214,    56,  4297,   259,  4377,   261,    18,   275,  4096,
-  353,    69,   504, 20736,   595,  4104,  1035, 37376,  1427, 37432,
- 1675,   117,  2080,    17,  2388,    19,  2543,     3,  2728,    55,
- 2834,    33,  3320,     0,  4199,   276,  4249,   272,  4276,   274,
- 4402,   260,  4430,   262,    21,    67,    88,   257,    64,   276,
- 4097,   326,    66,   352,    68,   505, 20737,   596,  4105,  1365,
-  112,  1523,  4147,  1674,   116,  2079,    16,  2326, 41626,  2387,
-   18,  2418,    22,  2542,     2,  2727,    54,  2833,    32,  3017,
-   34,  3229,    40,  4403,   261,  4479,   259,    15,   277,  4098,
-  506, 20738,   597,  4106,  1677,   119,  1984,  4128,  2386,    17,
- 2417,    21,  2541,     1,  2726,    53,  2836,    35,  4225,   276,
- 4250,   274,  4275,   272,  4404,   262,  4428,   260,    15,   325,
-   64,   354,    70,   507, 20739,  1676,   118,  1985,  4129,  2081,
-   18,  2385,    16,  2416,    20,  2725,    52,  2835,    34,  3016,
-   32,  3230,    42,  3390,   144,  4429,   261,  4453,   259,     9,
-  508, 20740,  1671,   113,  2400,    17,  2546,     7,  4197,   272,
- 4224,   274,  4251,   276,  4454,   260,  4482,   262,    15,   238,
-37397,   278,  4101,   509, 20741,  1525,  4151,  1670,   112,  1953,
-37429,  2399,    16,  2415,    18,  2525,     4,  2545,     6,  2724,
-   50,  2837,    36,  3019,    38,  4427,   259,  4455,   261,    10,
-  417, 12416,   510, 20742,  1673,   115,  2402,    19,  2723,    49,
- 4198,   274,  4223,   272,  4277,   276,  4456,   262,  4480,   260,
-   13,   351,    66,   511, 20743,  1524,  4149,  1672,   114,  2389,
-   20,  2401,    18,  2544,     4,  2722,    48,  3018,    36,  3209,
-   32,  3231,    46,  4401,   259,  4481,   261,    15,    61,    81,
-  135,  4112,   512, 20744,   588,  4096,   815, 20740,  1756,   113,
- 2019,    97,  2501,    17,  3589,   146,  3699,   144,  4303,   276,
- 4353,   272,  4380,   274,  4506,   260,  4534,   262,    10,    60,
-   80,   513, 20745,   563,    64,  1755,   112,  2018,    96,  2500,
-   16,  3226,    32,  3700,   145,  4507,   261,  4583,   259,    12,
-   63,    83,   514, 20746,   589,  4098,  2503,    19,  2548,     9,
- 3588,   144,  3701,   146,  4329,   276,  4354,   274,  4379,   272,
- 4508,   262,  4532,   260,    13,    62,    82,   515, 20747,   564,
-   66,   590,  4099,  1526,  4153,  2020,    98,  2323, 41616,  2502,
-   18,  2547,     8,  3020,    40,  3702,   147,  4533,   261,  4557,
-  259,    13,    65,    85,   516, 20748,   591,  4100,   813, 20736,
- 1679,   121,  2325, 41623,  2403,    25,  2505,    21,  4301,   272,
- 4328,   274,  4355,   276,  4558,   260,  4586,   262,    11,    64,
-   84,   517, 20749,   592,  4101,   814, 20737,  1678,   120,  2021,
-  100,  2324, 41622,  2504,    20,  3227,    36,  4531,   259,  4559,
-  261,     7,   518, 20750,   593,  4102,  4302,   274,  4327,   272,
- 4381,   276,  4560,   262,  4584,   260,     9,    66,    86,   519,
-20751,   594,  4103,  1380,  4159,  2419,    24,  2729,    56,  3228,
-   38,  4505,   259,  4585,   261,    10,   285,  4144,  1373,  4096,
- 1647,    69,  2180,  4192,  2561,    51,  2657,     3,  2677,     5,
- 2829,    17,  3165,  4180,  3524,   164,    10,    73,   104,   336,
-  114,  1043, 37425,  1374,  4097,  1505,    66,  1646,    68,  2082,
-   32,  2656,     2,  2828,    16,  3014,    18,    10,   335,   113,
- 1044, 37426,  1375,  4098,  1504,    65,  1982,  4112,  2560,    49,
- 2655,     1,  2678,     7,  3166,  4182,  3525,   166,     9,  1376,
- 4099,  1648,    70,  1983,  4113,  2559,    48,  2583,    54,  2686,
-    4,  2830,    18,  3013,    16,  3167,  4183,     8,  1045, 37428,
- 1377,  4100,  2580,    49,  2661,     7,  2685,     3,  2832,    21,
- 3163,  4176,  3523,   160,     8,  1378,  4101,  1513,  4103,  1644,
-   64,  2563,    54,  2579,    48,  2660,     6,  2684,     2,  2831,
-   20,     7,  1046, 37430,  2084,    39,  2582,    51,  2659,     5,
- 2676,     3,  2683,     1,  3164,  4178,     8,  1645,    66,  2083,
-   38,  2562,    52,  2581,    50,  2658,     4,  2675,     2,  3015,
-   20,  3208,    16,     5,    69,    97,   568,   113,   611,  4144,
- 2665,    11,  3703,   160,     9,    68,    96,   567,   112,  1047,
-37433,  1743,    64,  2017,    80,  2566,    58,  2664,    10,  2692,
-   14,  3225,    16,    10,    71,    99,   570,   115,  1507,    73,
- 1514,  4104,  2565,    57,  2663,     9,  2681,    15,  2691,    13,
- 3590,   160,  3704,   162,     7,    70,    98,   569,   114,  1506,
-   72,  1515,  4105,  2564,    56,  2662,     8,  2690,    12,     6,
-  572,   117,  2585,    57,  2669,    15,  2680,     9,  2689,    11,
- 3705,   164,     8,    72,   100,   571,   116,  1508,    78,  1649,
-   72,  2584,    56,  2668,    14,  2679,     8,  2688,    10,     3,
- 2667,    13,  2687,     9,  4051,   160,     2,  2420,    40,  2666,
-   12,    11,   280,  4128,   333,    99,  1040, 37408,  1517,  4114,
- 1655,    85,  2085,    49,  2699,    23,  2820,     1,  3157,  4164,
- 3528,   180,  3711,   184,    10,   281,  4129,   332,    98,  1361,
-   80,  1654,    84,  2424,    54,  2540,    32,  2672,    18,  2698,
-   22,  3006,     2,  3203,     6,    11,   282,  4130,  1516,  4112,
- 1657,    87,  1980,  4096,  2087,    51,  2671,    17,  2697,    21,
- 2822,     3,  3158,  4166,  3529,   182,  3712,   186,    11,   283,
- 4131,   331,    96,  1362,    82,  1656,    86,  1981,  4097,  2086,
-   50,  2423,    52,  2670,    16,  2821,     2,  3530,   183,  3713,
-  187,    13,   284,  4132,   369,  4128,  1511,    87,  1651,    81,
- 2088,    53,  2556,    39,  2577,    33,  2696,    19,  2824,     5,
- 3155,  4160,  3202,     3,  3526,   176,  3714,   188,     9,  1510,
-   86,  1650,    80,  2422,    50,  2555,    38,  2576,    32,  2682,
-   16,  2695,    18,  2823,     4,  3008,     6,    11,   138,  4158,
- 1041, 37414,  1509,    85,  1653,    83,  1746,    95,  2554,    37,
- 2694,    17,  3156,  4162,  3201,     1,  3527,   178,  3715,   190,
-   11,   139,  4159,   239, 37431,   334,   100,  1042, 37415,  1652,
-   82,  2089,    54,  2421,    48,  2578,    34,  2693,    16,  2825,
-    6,  3007,     4,     9,   136,  4144,   608,  4128,  1745,    81,
- 2090,    57,  2706,    31,  2827,     9,  3161,  4172,  3224,     1,
- 3706,   176,     8,    74,   112,   566,    96,  1744,    80,  2015,
-   64,  2705,    30,  2826,     8,  3010,    10,  3207,    14,     6,
-  137,  4146,   609,  4130,  2558,    41,  3162,  4174,  3591,   176,
- 3707,   178,    10,   610,  4131,  1423, 37395,  1512,    88,  1518,
- 4121,  2091,    58,  2557,    40,  2704,    28,  3009,     8,  3206,
-   12,  3708,   179,     5,  1659,    89,  2703,    27,  3159,  4168,
- 3531,   184,  3709,   180,     6,  1658,    88,  2016,    68,  2702,
-   26,  3012,    14,  3205,    10,  3532,   185,     4,  2701,    25,
- 3160,  4170,  3710,   182,  4052,   176,     4,  2425,    56,  2700,
-   24,  3011,    12,  3204,     8,    10,   376,  8212,  2198, 12289,
- 3243,     2,  3342,    16,  3369,    32,  3670,    75,  4653, 16384,
- 4711,   256,  4752,   258,  5033,   272,     7,  2654, 12320,  3244,
-    3,  3255,     1,  3459,    66,  3513,    70,  3564,    72,  3669,
-   74,     7,   377,  8214,  3458,    65,  3512,    69,  4693, 16384,
- 4712,   258,  4751,   256,  5073,   272,     5,  3242,     1,  3256,
-    3,  3457,    64,  3511,    68,  3668,    72,     7,  3247,     6,
- 3257,     4,  3673,    79,  4631,   256,  4672,   258,  4733, 16384,
- 4953,   272,     6,   407, 12368,  3248,     7,  3258,     5,  3475,
-   64,  3510,    66,  3672,    78,     7,   375,  8210,  3245,     4,
- 3259,     6,  4632,   258,  4671,   256,  4773, 16384,  4993,   272,
-    5,  3246,     5,  3260,     7,  3476,    66,  3509,    64,  3671,
-   76,    11,    77,   130,   380,  8220,   783,  8208,  1367,   170,
- 3261,     8,  3558,    65,  3665,    67,  4813, 16384,  4871,   256,
- 4912,   258,  5193,   272,     3,   585,   147,  3557,    64,  3664,
-   66,     9,    75,   128,   381,  8222,   583,   144,  3249,     8,
- 3262,    10,  4853, 16384,  4872,   258,  4911,   256,  5233,   272,
-    5,    76,   129,   584,   145,  3250,     9,  3559,    66,  3663,
-   64,     8,   378,  8216,  1895, 24864,  3263,    12,  3561,    69,
- 4791,   256,  4832,   258,  4893, 16384,  5113,   272,     3,  3560,
-   68,  3667,    70,  4043,    64,     8,   379,  8218,   586,   148,
- 3515,    73,  3563,    71,  4792,   258,  4831,   256,  4933, 16384,
- 5153,   272,     5,   587,   149,  3514,    72,  3562,    70,  3666,
-   68,  4044,    66,    11,   293,  8192,   372,  8196,  3253,    18,
- 3264,    16,  3321,    16,  3370,    48,  3380,    32,  4713,   272,
- 4973, 16384,  5031,   256,  5072,   258,     4,   337,   129,  3254,
-   19,  3462,    82,  3479,    84,     9,   338,   130,   373,  8198,
-  581,   136,  3251,    16,  3461,    81,  4753,   272,  5013, 16384,
- 5032,   258,  5071,   256,     6,   339,   131,   582,   137,  3252,
-   17,  3460,    80,  3480,    86,  3569,    90,     5,   340,   132,
- 4633,   272,  4951,   256,  4992,   258,  5053, 16384,     3,   341,
-  133,   406, 12352,  3477,    80,     8,    82,   156,   342,   134,
-  371,  8194,  3265,    22,  4673,   272,  4952,   258,  4991,   256,
- 5093, 16384,     5,    83,   157,   343,   135,  3266,    23,  3478,
-   82,  3516,    80,     9,    79,   146,   575,   130,  3267,    24,
- 3677,    83,  4047,    85,  4873,   272,  5133, 16384,  5191,   256,
- 5232,   258,     5,   576,   131,   777,  8193,  3268,    25,  3565,
-   80,  3676,    82,     8,    78,   144,   573,   128,   778,  8194,
- 3675,    81,  4913,   272,  5173, 16384,  5192,   258,  5231,   256,
-    4,   574,   129,   779,  8195,  3566,    82,  3674,    80,     9,
-   81,   150,   374,  8200,   579,   134,   780,  8196,  4046,    81,
- 4793,   272,  5111,   256,  5152,   258,  5213, 16384,     5,   580,
-  135,   781,  8197,  3481,    88,  3567,    84,  4045,    80,     9,
-   80,   148,   577,   132,   782,  8198,  3322,    30,  3678,    85,
- 4833,   272,  5112,   258,  5151,   256,  5253, 16384,     2,   578,
-  133,  3568,    86,     6,   414, 12405,  1684,   134,  3323,    32,
- 3343,    48,  3379,    16,  3384,    96,     5,   413, 12404,  1685,
-  135,  2648, 12288,  3269,    33,  3578,   104,     3,   416, 12407,
- 1366,   128,  3270,    34,     5,   415, 12406,  1683,   133,  2649,
-12290,  3271,    35,  3579,   106,     2,   382,  8240,   410, 12401,
-    4,   409, 12400,  1682,   131,  2650, 12292,  3482,    96,     3,
-  383,  8242,   412, 12403,  1680,   128,     5,   411, 12402,  1681,
-  129,  2651, 12294,  3483,    98,  4049,   106,     4,   785,  8240,
- 1759,   130,  1869,  8192,  3571,    97,     2,  2652, 12296,  3570,
-   96,     3,  1757,   128,  1870,  8194,  3573,    99,     2,  1758,
-  129,  3572,    98,     2,  1889, 24832,  3575,   101,     3,  1890,
-24833,  3574,   100,  4048,    96,     3,  1686,   136,  1891, 24834,
- 3577,   103,     2,  1687,   137,  3576,   102,     5,  1694,   150,
- 3324,    48,  3368,    16,  3385,   112,  3685,   123,     5,  1695,
-  151,  2653, 12304,  3486,   116,  3584,   120,  3684,   122,     4,
- 1692,   148,  3272,    50,  3386,   114,  3683,   121,     4,  1693,
-  149,  3273,    51,  3585,   122,  3682,   120,     4,  1690,   146,
- 3223,   192,  3274,    52,  3387,   116,     4,   408, 12384,  1691,
-  147,  3275,    53,  3484,   112,     2,  1688,   144,  3276,    54,
-    3,  1689,   145,  3277,    55,  3485,   114,     4,   784,  8224,
- 1762,   146,  1894, 24852,  3278,    56,     3,  1763,   147,  3580,
-  112,  3681,   114,     2,  1760,   144,  3680,   113,     3,  1761,
-  145,  3581,   114,  3679,   112,     1,  1892, 24848,     1,  3582,
-  116,     3,  1696,   152,  1764,   148,  1893, 24850,     1,  3583,
-  118,     8,  2186,  8193,  3438,     2,  3465,     4,  3489,     6,
- 3639,    10,  4039,    12,  4720,  4352,  4762,  4354,     9,  3325,
-   64,  3345,    80,  3393,    16,  3402,   320,  3439,     3,  3466,
-    5,  3640,    11,  4721,  4353,  4763,  4355,     6,   291,  4240,
- 3467,     6,  3488,     4,  4040,    14,  4722,  4354,  4760,  4352,
-    5,  3241,   184,  3346,    82,  3638,     9,  4723,  4355,  4761,
- 4353,     7,  1068, 37526,  2188,  8197,  3487,     2,  3642,    14,
- 4036,     8,  4640,  4352,  4682,  4354,    10,   399, 12305,  1069,
-37527,  2187,  8196,  2442,   128,  3222,   176,  3347,    84,  3463,
-    1,  4037,     9,  4641,  4353,  4683,  4355,     9,   400, 12306,
- 2190,  8199,  3440,     4,  3464,     2,  3641,    12,  4038,    10,
- 4069,     8,  4642,  4354,  4680,  4352,     5,  1067, 37525,  2189,
- 8198,  2600,   144,  4643,  4355,  4681,  4353,     7,  2192,  8201,
- 3441,    10,  3470,    12,  3633,     2,  4033,     4,  4880,  4352,
- 4922,  4354,     6,   222, 12289,  2191,  8200,  3238,   178,  3634,
-    3,  4881,  4353,  4923,  4355,     8,   149,  4224,   654,  4240,
- 1070, 37528,  3471,    14,  4034,     6,  4067,     4,  4882,  4354,
- 4920,  4352,     5,  3237,   176,  4035,     7,  4068,     5,  4883,
- 4355,  4921,  4353,     6,  3444,    14,  3468,     8,  3636,     6,
- 4066,     2,  4800,  4352,  4842,  4354,     4,  3240,   182,  3637,
-    7,  4801,  4353,  4843,  4355,     9,   150,  4228,   655,  4244,
- 3442,    12,  3469,    10,  3490,     8,  3635,     4,  4032,     2,
- 4802,  4354,  4840,  4352,     5,  3239,   180,  3443,    13,  3491,
-    9,  4803,  4355,  4841,  4353,     9,  2194,  8209,  2445,   149,
- 3382,    17,  3447,    18,  3474,    20,  3495,    22,  3650,    26,
- 5040,  4352,  5082,  4354,     7,  2193,  8208,  2444,   148,  3326,
-   80,  3344,    64,  3381,    16,  5041,  4353,  5083,  4355,     8,
-  289,  4224,   653,  4232,  2446,   151,  3445,    16,  3494,    20,
- 3649,    24,  5042,  4354,  5080,  4352,     4,   290,  4225,  3446,
-   17,  5043,  4355,  5081,  4353,     4,  3472,    16,  3493,    18,
- 4960,  4352,  5002,  4354,     3,  3221,   160,  4961,  4353,  5003,
- 4355,     6,  2196,  8215,  2599,   129,  3473,    18,  3492,    16,
- 4962,  4354,  5000,  4352,     5,  2195,  8214,  2443,   146,  2598,
-  128,  4963,  4355,  5001,  4353,     7,   223, 12304,   648,  4226,
-  786,  8257,  3538,    16,  3644,    18,  5200,  4352,  5242,  4354,
-    5,   224, 12305,   649,  4227,  3645,    19,  5201,  4353,  5243,
- 4355,     8,   151,  4240,   225, 12306,   646,  4224,   788,  8259,
- 3539,    18,  3643,    16,  5202,  4354,  5240,  4352,     5,   647,
- 4225,   787,  8258,  3236,   160,  5203,  4355,  5241,  4353,     6,
-  652,  4230,   790,  8261,  3540,    20,  3648,    22,  5120,  4352,
- 5162,  4354,     4,   789,  8260,  2447,   152,  5121,  4353,  5163,
- 4355,     6,   650,  4228,  3496,    24,  3541,    22,  3646,    20,
- 5122,  4354,  5160,  4352,     5,   651,  4229,   791,  8262,  3647,
-   21,  5123,  4355,  5161,  4353,     4,  3328,    97,  3449,    34,
- 3500,    38,  3659,    42,     5,  3327,    96,  3371,    64,  3383,
-   32,  3403,   352,  3660,    43,     5,  3330,    99,  3448,    32,
- 3499,    36,  3547,    42,  3658,    40,     2,  3329,    98,  3548,
-   43,     4,  3331,   101,  3451,    38,  3498,    34,  3549,    44,
-    1,  3220,   144,     4,  3332,   103,  3450,    36,  3497,    32,
- 3661,    44,     1,  3662,    45,     4,  1874, 12288,  3333,   105,
- 3542,    32,  3653,    34,     2,  3543,    33,  3654,    35,     6,
- 1823,  4224,  1875, 12290,  3452,    40,  3503,    44,  3544,    34,
- 3651,    32,     5,  1876, 12291,  3235,   144,  3334,   106,  3453,
-   41,  3652,    33,     5,  1877, 12292,  3502,    42,  3545,    36,
- 3656,    38,  4041,    32,     3,  2322, 41508,  3546,    37,  3657,
-   39,     3,  1878, 12294,  3501,    40,  4042,    34,     1,  3655,
-   37,     5,   403, 12324,  1535,  4240,  2854,   131,  3455,    50,
- 3506,    54,     6,  2853,   130,  3063,   128,  3348,    96,  3372,
-   80,  3394,    32,  3404,   368,     5,   404, 12326,  1536,  4242,
- 2852,   129,  3454,    48,  3555,    58,     3,  1537,  4243,  2851,
-  128,  3556,    59,     3,   401, 12320,  1538,  4244,  2857,   135,
-    4,  1539,  4245,  2856,   134,  3219,   128,  3505,    51,     4,
-  402, 12322,  1540,  4246,  3456,    52,  3504,    48,     2,  1541,
- 4247,  2855,   132,     2,  1879, 12304,  3550,    48,     2,  1824,
- 4240,  3551,    50,     1,  3552,    51,     1,   405, 12328,     2,
- 3507,    56,  3553,    54,     2,  3508,    57,  3554,    55,     6,
-   13,  4417,    96,   268,   431, 16404,  1712,   288,  2230, 16448,
- 4153,  4177,     6,    97,   269,   432, 16405,  2184,  4356,  2231,
-16449,  4192,    64,  4200,  4097,     4,    98,   270,   433, 16406,
- 1713,   290,  4155,  4179,     7,    14,  4418,    99,   271,   434,
-16407,   687,  4446,  4154,  4178,  4218,    64,  4226,  4097,     9,
-   11,   258,    92,   264,   427, 16400,  1114, 37713,  1714,   292,
- 2181,  4353,  2462,   326,  3305,  1280,  4157,  4181,     6,    93,
-  265,   428, 16401,  2463,   327,  4156,  4180,  4244,    64,  4252,
- 4097,     7,    10,   256,    94,   266,   164,  4427,   429, 16402,
- 1116, 37715,  1715,   294,  2183,  4355,    10,    95,   267,   163,
- 4426,   430, 16403,   686,  4442,  1115, 37714,  2182,  4354,  2461,
-  325,  4158,  4182,  4270,    64,  4278,  4097,     7,    88,   260,
-  162,  4421,   226, 16384,   439, 16412,   684,  4437,  1781,   292,
- 4160,  4185,     8,    89,   261,   440, 16413,   683,  4436,   812,
-20560,  1782,   293,  4159,  4184,  4296,    64,  4304,  4097,     1,
-   90,   262,     4,    91,   263,   685,  4438,  4322,    64,  4330,
- 4097,     4,    84,   256,   435, 16408,   680,  4433,  1777,   288,
-    7,    85,   257,   161,  4416,   436, 16409,   679,  4432,  1778,
-  289,  4348,    64,  4356,  4097,     4,    86,   258,   437, 16410,
-  682,  4435,  1779,   290,     7,    87,   259,   438, 16411,   681,
- 4434,  1780,   291,  3409,   153,  4374,    64,  4382,  4097,     8,
-  318, 16384,   359,   256,   420, 16388,  1112, 37701,  2232, 16464,
- 2626,  4353,  4070,    16,  4145,  4161,     7,   360,   257,  1111,
-37700,  2233, 16465,  2625,  4352,  4100,     1,  4400,    64,  4408,
- 4097,     6,   361,   258,   421, 16390,  2234, 16466,  2628,  4355,
- 4101,     2,  4147,  4163,     6,   362,   259,  1113, 37702,  2627,
- 4354,  4146,  4162,  4426,    64,  4434,  4097,     8,   106,   280,
-  363,   260,   678,  4425,  1108, 37697,  2630,  4357,  3306,  1296,
- 4102,     4,  4149,  4165,     8,   107,   281,   259,   257,   364,
-  261,  1107, 37696,  2629,  4356,  4148,  4164,  4452,    64,  4460,
- 4097,     7,   260,   258,   300,  8576,   365,   262,   419, 16386,
- 1110, 37699,  3420,   160,  4151,  4167,     6,   167,  4442,   366,
-  263,  1109, 37698,  4150,  4166,  4478,    64,  4486,  4097,     6,
-  102,   276,   166,  4437,   367,   264,   424, 16396,   675,  4421,
-  798, 16384,     7,   103,   277,   674,  4420,   811, 20544,  3848,
-  468,  4152,  4168,  4504,    64,  4512,  4097,     3,   104,   278,
-  425, 16398,   677,  4423,     6,   105,   279,   426, 16399,   676,
- 4422,  3849,   470,  4530,    64,  4538,  4097,     3,   100,   272,
-  422, 16392,   671,  4417,     5,   165,  4432,   670,  4416,  3846,
-  464,  4556,    64,  4564,  4097,     3,   101,   274,   423, 16394,
-  673,  4419,     4,   672,  4418,  3847,   466,  4582,    64,  4590,
- 4097,     4,   450, 16436,  1397, 16384,  1697,   256,  4173,  4209,
-    3,   451, 16437,  1369,   261,  4172,  4208,     3,   452, 16438,
- 1698,   258,  4175,  4211,     2,  1699,   259,  4174,  4210,     6,
-  446, 16432,  1368,   256,  1700,   260,  1773,   264,  3307,  1312,
- 4176,  4213,     3,   447, 16433,  1701,   261,  1774,   265,     4,
-  302,  8624,   448, 16434,  1702,   262,  4178,  4215,     4,   449,
-16435,  1556,  4416,  1703,   263,  4177,  4214,     6,   112,   292,
-  455, 16444,  1704,   264,  1769,   260,  1881, 16384,  4180,  4217,
-    3,   172,  4452,  1770,   261,  4179,  4216,     3,   173,  4455,
- 1771,   262,  4182,  4219,     2,  1772,   263,  4181,  4218,     5,
-  108,   288,   169,  4449,   453, 16440,  1765,   256,  4184,  4221,
-    5,   109,   289,   168,  4448,   693,  4464,  1766,   257,  4183,
- 4220,     4,   110,   290,   171,  4451,   454, 16442,  1767,   258,
-    4,   111,   291,   170,  4450,  1768,   259,  4185,  4222,     4,
-  443, 16420,  1705,   272,  2235, 16496,  4162,  4193,     3,  2236,
-16497,  2931,  4356,  4161,  4192,     5,   444, 16422,  1559,  4437,
- 1706,   274,  1999, 16384,  2237, 16498,     3,  1707,   275,  2238,
-16499,  4163,  4194,     6,   441, 16416,  1370,   272,  1558,  4435,
- 1708,   276,  2239, 16500,  2928,  4353,     3,  1117, 37728,  1709,
-  277,  4164,  4196,     5,   301,  8608,   442, 16418,  2930,  4355,
- 3419,   128,  4165,  4199,     3,  1557,  4432,  1710,   279,  2929,
- 4354,     3,  1711,   280,  2029, 16384,  4167,  4201,     2,   691,
- 4452,  4166,  4200,     1,   692,  4454,     5,   445, 16424,   689,
- 4449,  1775,   272,  2022,   256,  4169,  4205,     4,   688,  4448,
- 1776,   273,  2023,   257,  4168,  4204,     3,  1560,  4441,  2024,
-  258,  4171,  4207,     2,   690,  4450,  4170,  4206,     6,  1084,
-37652,  2199, 16385,  2405,   257,  4111,  4112,  4396,    16,  4652,
-12288,     7,   460, 16468,  1085, 37653,  1548,  4391,  2404,   256,
- 2450,   258,  4112,  4113,  4239,     5,     9,   462, 16471,  1086,
-37654,  2201, 16387,  2407,   259,  2449,   257,  2742,   289,  4113,
- 4114,  4422,    16,  4692, 12288,     8,   461, 16470,  1087, 37655,
- 1547,  4389,  2200, 16386,  2406,   258,  2448,   256,  4114,  4115,
- 4265,     5,     8,   458, 16465,  1080, 37648,  1546,  4386,  2203,
-16389,  2409,   261,  4115,  4116,  4448,    16,  4732, 12288,     9,
-  457, 16464,  1081, 37649,  2092,   256,  2202, 16388,  2408,   260,
- 2452,   262,  2511,   264,  4116,  4117,  4187,     5,     7,  1082,
-37650,  2205, 16391,  2411,   263,  2744,   293,  4117,  4118,  4474,
-   16,  4772, 12288,    10,   304,  8656,   459, 16466,  1083, 37651,
- 1545,  4385,  2204, 16390,  2410,   262,  2451,   260,  2743,   292,
- 4118,  4119,  4213,     5,     9,   659,  4372,   800, 20496,  2206,
-16393,  2413,   265,  2508,   261,  3826,   388,  4119,  4120,  4500,
-   16,  4812, 12288,     5,   466, 16476,  2412,   264,  4072,    64,
- 4120,  4121,  4343,     5,     7,   801, 20498,  2343, 41861,  2510,
-  263,  2745,   297,  4121,  4122,  4526,    16,  4852, 12288,     5,
- 2414,   266,  2509,   262,  4073,    66,  4122,  4123,  4369,     5,
-    8,   152,  4352,   464, 16473,   657,  4368,  1088, 37656,  3823,
-  384,  4123,  4124,  4552,    16,  4892, 12288,     6,   463, 16472,
-  658,  4369,  1089, 37657,  2506,   256,  4124,  4125,  4291,     5,
-    6,  1549,  4392,  2241, 33539,  3824,   386,  4125,  4126,  4578,
-   16,  4932, 12288,     7,   465, 16474,  2240, 33538,  2342, 41856,
- 2507,   258,  3825,   387,  4126,  4127,  4317,     5,     8,   503,
-20484,  1074, 37636,  2208, 16401,  2602,   257,  2748,   307,  3128,
-  289,  4188,    16,  4972, 12288,     7,  1075, 37637,  2207, 16400,
- 2601,   256,  2747,   306,  3127,   288,  4103,  4097,  4447,     5,
-    4,  1076, 37638,  1554,  4404,  4214,    16,  5012, 12288,     4,
- 1077, 37639,  1555,  4405,  2746,   304,  4473,     5,     7,   292,
- 4352,  1552,  4402,  2209, 16405,  3831,   408,  4104,  4100,  4240,
-   16,  5052, 12288,     7,   456, 16448,  1071, 37633,  1553,  4403,
- 3308,  1360,  3832,   409,  4105,  4101,  4395,     5,     7,   502,
-20482,  1072, 37634,  1550,  4400,  3833,   410,  4106,  4102,  4266,
-   16,  5092, 12288,     7,   303,  8640,  1073, 37635,  1551,  4401,
- 2210, 16406,  2749,   308,  4107,  4103,  4421,     5,     6,   799,
-20480,  2212, 16409,  3829,   404,  4108,  4104,  4292,    16,  5132,
-12288,     5,   155,  4373,  2211, 16408,  4074,    80,  4109,  4105,
- 4551,     5,     4,  3830,   406,  4110,  4106,  4318,    16,  5172,
-12288,     1,  4577,     5,     7,   153,  4368,   656,  4352,  1078,
-37640,  2513,   273,  3827,   400,  4344,    16,  5212, 12288,     4,
-  154,  4369,  1079, 37641,  2512,   272,  4499,     5,     4,  2515,
-  275,  3828,   402,  4370,    16,  5252, 12288,     3,  2344, 41872,
- 2514,   274,  4525,     5,    10,  1103, 37684,  1398, 20480,  1449,
-37644,  2214, 16417,  2455,   291,  2736,   259,  3313,  1381,  4189,
-   32,  4216,    34,  4399,    48,     8,   472, 16500,  1104, 37685,
- 1450, 37645,  2213, 16416,  2454,   290,  2735,   258,  3312,  1380,
- 4138,  4145,     8,  1399, 20482,  1451, 37646,  2216, 16419,  2453,
-  289,  2734,   257,  4190,    34,  4215,    32,  4425,    48,     5,
-  473, 16502,  1105, 37687,  1452, 37647,  2215, 16418,  4139,  4147,
-   11,   668,  4408,  1100, 37680,  1445, 37640,  2217, 16421,  2740,
-  263,  3309,  1377,  3838,   424,  4140,  4148,  4241,    32,  4268,
-   34,  4451,    48,     4,   470, 16496,  1446, 37641,  1544,  4355,
- 2739,   262,    11,   669,  4410,  1101, 37682,  1447, 37642,  1542,
- 4352,  2219, 16423,  2457,   293,  2738,   261,  3311,  1379,  4242,
-   34,  4267,    32,  4477,    48,    10,   305,  8688,   471, 16498,
- 1102, 37683,  1448, 37643,  1543,  4353,  2218, 16422,  2456,   292,
- 2737,   260,  3310,  1378,  4141,  4151,    10,   664,  4404,   810,
-20528,  1829,  4356,  1882, 20480,  2221, 16425,  3836,   420,  4142,
- 4152,  4293,    32,  4320,    34,  4503,    48,     5,   157,  4389,
-  476, 16508,   665,  4405,  2220, 16424,  4143,  4153,     6,   666,
- 4406,  3837,   422,  4144,  4154,  4294,    34,  4319,    32,  4529,
-   48,     4,   477, 16510,   667,  4407,  1444, 37639,  2741,   264,
-    8,   156,  4384,   662,  4400,  1106, 37688,  1825,  4352,  3834,
-  416,  4345,    32,  4372,    34,  4555,    48,     5,   474, 16504,
-  663,  4401,  1442, 37633,  1826,  4353,  2516,   288,     6,  1443,
-37634,  1827,  4354,  3835,   418,  4346,    34,  4371,    32,  4581,
-   48,     2,   475, 16506,  1828,  4355,     9,    12,  4400,   808,
-20520,  1094, 37668,  2223, 16433,  3845,   444,  4127,  4128,  4191,
-   48,  4397,    32,  4424,    34,     6,   469, 16484,   809, 20521,
- 1095, 37669,  2222, 16432,  3067,   262,  4128,  4129,     5,  1096,
-37670,  2225, 16435,  4217,    48,  4398,    34,  4423,    32,     4,
- 1097, 37671,  2224, 16434,  3066,   260,  4129,  4131,     9,  1090,
-37664,  2227, 16437,  2459,   311,  2859,   257,  3843,   440,  4130,
- 4132,  4243,    48,  4449,    32,  4476,    34,     6,   467, 16480,
- 1091, 37665,  2226, 16436,  2858,   256,  3065,   258,  4131,  4133,
-   10,   160,  4410,  1092, 37666,  2229, 16439,  2458,   309,  2861,
-  259,  3844,   442,  4132,  4134,  4269,    48,  4450,    34,  4475,
-   32,     7,   468, 16482,  1093, 37667,  2228, 16438,  2860,   258,
- 3064,   256,  3421,   192,  4133,  4135,     7,   159,  4404,   802,
-20512,  3841,   436,  4134,  4136,  4295,    48,  4501,    32,  4528,
-   34,     3,   803, 20513,  3071,   270,  4135,  4137,     7,   804,
-20514,  2460,   313,  3842,   438,  4136,  4138,  4321,    48,  4502,
-   34,  4527,    32,     2,  3070,   268,  4137,  4139,     9,   158,
- 4400,   660,  4384,   805, 20516,  1098, 37672,  1453, 37648,  3839,
-  432,  4347,    48,  4553,    32,  4580,    34,     5,   661,  4385,
- 1099, 37673,  1454, 37649,  1830,  4369,  3069,   266,     7,   806,
-20518,  1455, 37650,  1831,  4370,  3840,   434,  4373,    48,  4554,
-   34,  4579,    32,     4,   807, 20519,  1456, 37651,  1832,  4371,
- 3068,   264,     4,   823, 24600,  4212, 12288,  4934,    16,  4976,
-   18,     4,   903, 28760,  3816,   334,  4935,    17,  5017,    21,
-    4,   824, 24602,  4238, 12288,  4936,    18,  4974,    16,     3,
- 3815,   332,  4975,    17,  5057,    21,     9,   294,  8464,   493,
-16530,   825, 24604,  3355,   272,  3406,    16,  3415,    48,  4264,
-12288,  5014,    16,  5056,    18,     3,  3814,   330,  4937,    21,
- 5015,    17,     4,   826, 24606,  4290, 12288,  5016,    18,  5054,
-   16,     4,   492, 16529,  3813,   328,  4977,    21,  5055,    17,
-    4,  1884, 24608,  4316, 12288,  5094,    16,  5136,    18,     6,
-  498, 16543,   819, 24593,   899, 28752,  3812,   326,  5095,    17,
- 5177,    21,     6,   496, 16540,   820, 24594,  1885, 24610,  4342,
-12288,  5096,    18,  5134,    16,     6,   497, 16541,   900, 28754,
- 1886, 24611,  3811,   324,  5135,    17,  5217,    21,     6,   494,
-16538,   821, 24596,  2333, 41792,  4368, 12288,  5174,    16,  5216,
-   18,     6,   495, 16539,   901, 28756,  3612,   320,  3810,   322,
- 5097,    21,  5175,    17,     4,   822, 24598,  4394, 12288,  5176,
-   18,  5214,    16,     5,   902, 28758,  3613,   322,  3809,   320,
- 5137,    21,  5215,    17,     4,   484, 16518,  4420, 12288,  4614,
-   16,  4656,    18,     4,   485, 16519,   897, 28744,  4615,    17,
- 4697,    21,     4,   482, 16516,  4446, 12288,  4616,    18,  4654,
-   16,     3,   483, 16517,  4655,    17,  4737,    21,     8,   480,
-16514,  2337, 41816,  3354,   256,  3377,   304,  3396,    16,  4472,
-12288,  4694,    16,  4736,    18,     4,   481, 16515,   898, 28748,
- 4617,    21,  4695,    17,     4,   478, 16512,  4498, 12288,  4696,
-   18,  4734,    16,     3,   479, 16513,  4657,    21,  4735,    17,
-    8,   491, 16526,   818, 24576,   893, 28737,  1887, 24624,  2336,
-41812,  4524, 12288,  4774,    16,  4816,    18,     3,   892, 28736,
- 4775,    17,  4857,    21,     5,   489, 16524,  3822,   341,  4550,
-12288,  4776,    18,  4814,    16,     5,   490, 16525,   894, 28738,
- 3821,   340,  4815,    17,  4897,    21,     5,   183,  8464,  3820,
-  339,  4576, 12288,  4854,    16,  4896,    18,     7,   184,  8465,
-  488, 16523,   895, 28740,  3614,   336,  3819,   338,  4777,    21,
- 4855,    17,     7,   185,  8466,   486, 16520,  2334, 41810,  3818,
-  337,  4602, 12288,  4856,    18,  4894,    16,     7,   487, 16521,
-  896, 28742,  2335, 41811,  3615,   338,  3817,   336,  4817,    21,
- 4895,    17,     2,   840, 24632,  4658,    34,     2,   841, 24633,
- 3414,    21,     2,   842, 24634,  4618,    34,     1,   843, 24635,
-    7,   190,  8488,   844, 24636,  3357,   304,  3397,    32,  3408,
-   48,  3413,    16,  4738,    34,     3,   191,  8489,   845, 24637,
- 3620,   360,     3,   192,  8490,   846, 24638,  4698,    34,     1,
-  847, 24639,     3,   188,  8484,   835, 24624,  4818,    34,     2,
-  836, 24625,  3618,   356,     2,   837, 24626,  4778,    34,     2,
-  189,  8487,  3619,   358,     4,   186,  8480,   838, 24628,  2338,
-41824,  4898,    34,     1,  3616,   352,     3,   187,  8482,   839,
-24630,  4858,    34,     1,  3617,   354,     2,   831, 24616,  4978,
-   34,     2,   832, 24618,  4938,    34,     8,   501, 16546,   833,
-24620,  3356,   288,  3375,   272,  3398,    48,  3407,    32,  3410,
-   16,  5058,    34,     1,  3376,   273,     3,   499, 16544,   834,
-24622,  5018,    34,     1,   500, 16545,     5,   196,  8500,   827,
-24608,  1873,  8468,  1883, 24592,  5138,    34,     3,   197,  8501,
-  904, 28768,  2341, 41845,     2,   828, 24610,  5098,    34,     1,
-  905, 28770,     7,   193,  8496,   829, 24612,   907, 28773,  1871,
- 8464,  2339, 41840,  3621,   369,  5218,    34,     1,   906, 28772,
-    7,   194,  8498,   830, 24614,  1872,  8466,  2340, 41842,  3279,
-  304,  3623,   371,  5178,    34,     2,   195,  8499,  3622,   370,
-   13,   298,  8533,  1937, 28712,  3780,   270,  4201,  8192,  4228,
- 8194,  4255,  8196,  4282,  8198,  4309,  8200,  4336,  8202,  4363,
- 8204,  4390,  8206,  4700,    69,  4942,    81,     8,   297,  8532,
-  862, 24664,  1938, 28713,  3361,   340,  4619,    64,  4639,  4097,
- 4941,    80,  4983,    82,    13,   879, 28698,  1939, 28714,  3779,
-  268,  4202,  8194,  4227,  8192,  4256,  8198,  4281,  8196,  4310,
- 8202,  4335,  8200,  4364,  8206,  4389,  8204,  4740,    69,  4982,
-   81,     6,   863, 24666,  1940, 28715,  4659,    64,  4679,  4097,
- 4943,    82,  4981,    80,    12,  1941, 28716,  3778,   266,  4203,
- 8196,  4230,  8198,  4253,  8192,  4280,  8194,  4311,  8204,  4338,
- 8206,  4361,  8200,  4388,  8202,  4620,    69,  5022,    81,     9,
-  295,  8528,  1942, 28717,  3359,   336,  3391,   256,  3399,    64,
- 4699,    64,  4719,  4097,  5021,    80,  5063,    82,    12,  1943,
-28718,  3776,   264,  4204,  8198,  4229,  8196,  4254,  8194,  4279,
- 8192,  4312,  8206,  4337,  8204,  4362,  8202,  4387,  8200,  4660,
-   69,  5062,    81,     8,   296,  8530,  2330, 41738,  3360,   338,
- 3777,   265,  4739,    64,  4759,  4097,  5023,    82,  5061,    80,
-   14,   874, 28688,  1929, 28704,  3774,   262,  4060,   256,  4205,
- 8200,  4232,  8202,  4259,  8204,  4286,  8206,  4305,  8192,  4332,
- 8194,  4359,  8196,  4386,  8198,  4860,    69,  5102,    81,    10,
-  200,  8516,   858, 24656,   875, 28689,  1930, 28705,  3600,   261,
- 3775,   263,  4779,    64,  4799,  4097,  5101,    80,  5143,    82,
-   15,   876, 28690,  1931, 28706,  2329, 41735,  3773,   260,  4061,
-  258,  4206,  8202,  4231,  8200,  4260,  8206,  4285,  8204,  4306,
- 8194,  4331,  8192,  4360,  8198,  4385,  8196,  4900,    69,  5142,
-   81,     7,   859, 24658,  1932, 28707,  3362,   350,  4819,    64,
- 4839,  4097,  5103,    82,  5141,    80,    16,   877, 28692,  1933,
-28708,  2328, 41729,  3599,   256,  3772,   258,  4062,   260,  4207,
- 8204,  4234,  8206,  4257,  8200,  4284,  8202,  4307,  8196,  4334,
- 8198,  4357,  8192,  4384,  8194,  4780,    69,  5182,    81,     7,
-  860, 24660,  1934, 28709,  2327, 41728,  4859,    64,  4879,  4097,
- 5181,    80,  5223,    82,    15,   199,  8515,   699,  4496,   878,
-28694,  1935, 28710,  3771,   256,  4208,  8206,  4233,  8204,  4258,
- 8202,  4283,  8200,  4308,  8198,  4333,  8196,  4358,  8194,  4383,
- 8192,  4820,    69,  5222,    81,     9,   198,  8514,   700,  4497,
-  861, 24662,  1936, 28711,  3280,   320,  4899,    64,  4919,  4097,
- 5183,    82,  5221,    80,    12,   870, 28680,  3790,   286,  4409,
- 8192,  4436,  8194,  4463,  8196,  4490,  8198,  4517,  8200,  4544,
- 8202,  4571,  8204,  4598,  8206,  4622,    81,  5020,    69,     6,
-  854, 24648,  3791,   287,  4621,    80,  4663,    82,  4939,    64,
- 4959,  4097,    12,   871, 28682,  3789,   284,  4410,  8194,  4435,
- 8192,  4464,  8198,  4489,  8196,  4518,  8202,  4543,  8200,  4572,
- 8206,  4597,  8204,  4662,    81,  5060,    69,     5,   855, 24650,
- 4623,    82,  4661,    80,  4979,    64,  4999,  4097,    13,   180,
- 4506,   872, 28684,  3788,   282,  4411,  8196,  4438,  8198,  4461,
- 8192,  4488,  8194,  4519,  8204,  4546,  8206,  4569,  8200,  4596,
- 8202,  4702,    81,  4940,    69,     9,   856, 24652,  3358,   320,
- 3400,    80,  3412,   112,  3418,    96,  4701,    80,  4743,    82,
- 5019,    64,  5039,  4097,    13,   178,  4504,   873, 28686,  3787,
-  280,  4412,  8198,  4437,  8196,  4462,  8194,  4487,  8192,  4520,
- 8206,  4545,  8204,  4570,  8202,  4595,  8200,  4742,    81,  4980,
-   69,     6,   179,  4505,   857, 24654,  4703,    82,  4741,    80,
- 5059,    64,  5079,  4097,    15,   176,  4502,   796, 12548,   849,
-24641,   865, 28672,  3786,   278,  4413,  8200,  4440,  8202,  4467,
- 8204,  4494,  8206,  4513,  8192,  4540,  8194,  4567,  8196,  4594,
- 8198,  4782,    81,  5180,    69,     9,   177,  4503,   797, 12549,
-  848, 24640,   866, 28673,  4063,   273,  4781,    80,  4823,    82,
- 5099,    64,  5119,  4097,    15,   698,  4484,   851, 24643,  3602,
-  278,  3784,   276,  4064,   274,  4414,  8202,  4439,  8200,  4468,
- 8206,  4493,  8204,  4514,  8194,  4539,  8192,  4568,  8198,  4593,
- 8196,  4822,    81,  5220,    69,     8,   175,  4501,   850, 24642,
- 3785,   277,  4065,   275,  4783,    82,  4821,    80,  5139,    64,
- 5159,  4097,    15,   696,  4482,   792, 12544,   867, 28676,  3601,
-  272,  3783,   274,  4415,  8204,  4442,  8206,  4465,  8200,  4492,
- 8202,  4515,  8196,  4542,  8198,  4565,  8192,  4592,  8194,  4862,
-   81,  5100,    69,     8,   697,  4483,   793, 12545,   852, 24644,
-  868, 28677,  4861,    80,  4903,    82,  5179,    64,  5199,  4097,
-   16,   174,  4496,   694,  4480,   794, 12546,   869, 28678,  2331,
-41747,  3781,   272,  4416,  8206,  4441,  8204,  4466,  8202,  4491,
- 8200,  4516,  8198,  4541,  8196,  4566,  8194,  4591,  8192,  4902,
-   81,  5140,    69,     8,   695,  4481,   795, 12547,   853, 24646,
- 3782,   273,  4863,    82,  4901,    80,  5219,    64,  5239,  4097,
-    6,   891, 28728,  1905, 28680,  3803,   302,  4625,    97,  4667,
-   99,  4790,   105,     5,  1906, 28681,  4624,    96,  4666,    98,
- 4748,   102,  4789,   104,     5,  1907, 28682,  3802,   300,  4627,
-   99,  4665,    97,  4830,   105,     5,  1908, 28683,  4626,    98,
- 4664,    96,  4708,   102,  4829,   104,     6,  1390, 12544,  1909,
-28684,  3801,   298,  4705,    97,  4747,    99,  4870,   105,     7,
- 1910, 28685,  3378,   320,  3417,    80,  4668,   102,  4704,    96,
- 4746,    98,  4869,   104,     5,  1911, 28686,  3799,   296,  4707,
-   99,  4745,    97,  4910,   105,     6,  1912, 28687,  3800,   297,
- 4628,   102,  4706,    98,  4744,    96,  4909,   104,     6,   887,
-28720,  1897, 28672,  3798,   294,  4630,   105,  4785,    97,  4827,
-   99,     6,  1888, 24640,  1898, 28673,  4629,   104,  4784,    96,
- 4826,    98,  4908,   102,     6,   888, 28722,  1899, 28674,  3796,
-  292,  4670,   105,  4787,    99,  4825,    97,     6,  1900, 28675,
- 3797,   293,  4669,   104,  4786,    98,  4824,    96,  4868,   102,
-    7,   889, 28724,  1901, 28676,  3603,   288,  3794,   290,  4710,
-  105,  4865,    97,  4907,    99,     6,  1902, 28677,  3795,   291,
- 4709,   104,  4828,   102,  4864,    96,  4906,    98,     7,   890,
-28726,  1903, 28678,  3604,   290,  3792,   288,  4750,   105,  4867,
-   99,  4905,    97,     6,  1904, 28679,  3793,   289,  4749,   104,
- 4788,   102,  4866,    98,  4904,    96,     6,   884, 28712,  1921,
-28696,  3611,   316,  4945,    97,  4987,    99,  5110,   105,     5,
- 1922, 28697,  4944,    96,  4986,    98,  5068,   102,  5109,   104,
-    5,   885, 28714,  1923, 28698,  4947,    99,  4985,    97,  5150,
-  105,     6,   886, 28715,  1924, 28699,  4946,    98,  4984,    96,
- 5028,   102,  5149,   104,     6,  1925, 28700,  3609,   312,  4075,
-  255,  5025,    97,  5067,    99,  5190,   105,    10,   299,  8544,
- 1926, 28701,  3363,   352,  3401,   112,  3411,    80,  3416,    64,
- 4988,   102,  5024,    96,  5066,    98,  5189,   104,     5,  1927,
-28702,  3610,   314,  5027,    99,  5065,    97,  5230,   105,     7,
- 1833,  4505,  1928, 28703,  2332, 41786,  4948,   102,  5026,    98,
- 5064,    96,  5229,   104,     6,   880, 28704,  1913, 28688,  3607,
-  308,  4950,   105,  5105,    97,  5147,    99,     6,   864, 24672,
- 1914, 28689,  4949,   104,  5104,    96,  5146,    98,  5228,   102,
-    8,   704,  4516,   881, 28706,  1915, 28690,  3608,   310,  3808,
-  308,  4990,   105,  5107,    99,  5145,    97,     6,   705,  4517,
- 1916, 28691,  4989,   104,  5106,    98,  5144,    96,  5188,   102,
-    9,   702,  4514,   882, 28708,  1880, 12560,  1917, 28692,  3605,
-  304,  3806,   306,  5030,   105,  5185,    97,  5227,    99,     7,
-  703,  4515,  1918, 28693,  3807,   307,  5029,   104,  5148,   102,
- 5184,    96,  5226,    98,     8,   701,  4512,   883, 28710,  1919,
-28694,  3606,   306,  3804,   304,  5070,   105,  5187,    99,  5225,
-   97,     6,  1920, 28695,  3805,   305,  5069,   104,  5108,   102,
- 5186,    98,  5224,    96,     4,   269,   536,   715,  4689,   955,
-36953,  2896,   632,     5,   113,   513,   270,   537,   714,  4688,
-  954, 36952,  2897,   633,     2,   316,  8856,  2055,   560,     2,
-  317,  8857,  2056,   561,     1,  4098,   768,     1,  3180,  4664,
-    2,  2488,   584,  2789, 25568,     1,  2489,   585,     2,   310,
- 8850,   950, 36945,     7,   311,  8851,   949, 36944,  1571,  4706,
- 2094,   577,  2487,   583,  3178,  4660,  3914,   712,     4,   263,
-  530,   952, 36947,  2095,   578,  2486,   580,     6,   264,   531,
-  951, 36946,  1570,  4704,  2096,   579,  2894,   627,  3179,  4662,
-    5,   265,   532,   314,  8854,  2097,   580,  2485,   578,  2895,
-  628,     6,   266,   533,   315,  8855,   953, 36948,  2098,   581,
- 2635,  4624,  3177,  4656,     3,   267,   534,   312,  8852,  1572,
- 4709,     2,   268,   535,   313,  8853,     3,   948, 36937,  1402,
-36977,  2053,   546,     5,   182,  4688,   710,  4672,   947, 36936,
- 2054,   547,  3915,   720,     2,   712,  4675,  2051,   544,     4,
-  711,  4674,  1403, 36978,  2052,   545,  3916,   722,     2,   713,
- 4676,  3917,   724,     1,  2790, 25584,     1,  3918,   726,     4,
-  261,   512,   940, 36929,  1573,  4723,  2099,   592,     4,   262,
-  513,  2100,   593,  2892,   609,  3176,  4644,     3,   942, 36931,
- 2101,   594,  2893,   610,     2,   941, 36930,  2102,   595,     4,
-  944, 36933,  2103,   596,  2492,   594,  2632,  4609,     5,   943,
-36932,  2104,   597,  2493,   595,  2631,  4608,  3174,  4640,     3,
-  946, 36935,  2490,   592,  2634,  4611,     4,   945, 36934,  2491,
-  593,  2633,  4610,  3175,  4642,     7,   114,   544,   718,  4721,
-  972, 36985,  1783,   512,  2045,   530,  2891,   600,  3920,   737,
-    4,   115,   545,   971, 36984,  2046,   531,  3919,   736,     3,
-  116,   546,  2043,   528,  3922,   739,     3,   719,  4722,  2044,
-  529,  3921,   738,     1,  3924,   741,     1,  3923,   740,     3,
- 2047,   532,  2787, 25536,  3926,   743,     2,  2048,   533,  3925,
-  742,     4,  1371,   512,  2050,   538,  2105,   608,  2883,   592,
-    4,   965, 36976,  2106,   609,  2884,   593,  3927,   744,     4,
-  966, 36979,  2049,   536,  2885,   594,  3929,   747,     3,  2886,
-  595,  3173,  4630,  3928,   746,     2,   968, 36981,  2887,   596,
-    3,   967, 36980,  2888,   597,  3171,  4624,     3,   970, 36983,
- 1716,   514,  2889,   598,     3,   969, 36982,  2890,   599,  3172,
- 4626,     5,   717,  4705,   964, 36969,  2036,   514,  2881,   584,
- 2940,  4617,     5,   274,   553,   716,  4704,  2037,   515,  2882,
-  585,  2939,  4616,     2,  2035,   512,  2942,  4619,     1,  2941,
- 4618,     1,  2944,  4621,     1,  2943,  4620,     2,  1401, 36951,
- 2788, 25552,     2,  1400, 36950,  2038,   517,     4,   957, 36961,
- 2041,   522,  2107,   624,  2932,  4609,     4,   271,   545,   956,
-36960,  2874,   577,  3170,  4612,     5,   272,   546,   959, 36963,
- 2039,   520,  2875,   578,  2934,  4611,     6,   273,   547,   958,
-36962,  1567,  4688,  2040,   521,  2876,   579,  2933,  4610,     4,
-  961, 36965,  1569,  4695,  2877,   580,  2936,  4613,     6,   960,
-36964,  2108,   629,  2636,  4640,  2878,   581,  2935,  4612,  3168,
- 4608,     5,   963, 36967,  1568,  4693,  2042,   524,  2879,   582,
- 2938,  4615,     4,   962, 36966,  2880,   583,  2937,  4614,  3169,
- 4610,     5,   181,  4608,   709,  4624,   922, 36888,  2518,   513,
- 3890,   640,     4,   923, 36889,  1843,  4641,  2285, 41090,  2517,
-  512,     2,  1844,  4642,  3891,   642,     4,  1845,  4643,  2284,
-41088,  2519,   514,  2783, 25508,     2,  1846,  4644,  3892,   644,
-    3,  2287, 41093,  2520,   519,  3893,   646,     3,  2286, 41092,
- 2470,   520,  2782, 25504,     4,   915, 36880,  2469,   519,  2870,
-  561,  3894,   648,     2,   916, 36881,  2869,   560,     6,   917,
-36882,  1564,  4640,  2289, 41097,  2468,   517,  2872,   563,  3895,
-  650,     4,  2288, 41096,  2467,   516,  2785, 25516,  2871,   562,
-    5,    15,  4608,   918, 36884,  2466,   515,  2606,   529,  3896,
-  652,     4,   919, 36885,  2465,   514,  2605,   528,  2873,   564,
-    3,    16,  4610,   920, 36886,  2464,   513,     4,   227, 36871,
-  921, 36887,  1565,  4645,  2784, 25512,     5,   706,  4608,   913,
-36872,  1847,  4656,  2868,   553,  3897,   656,     5,   707,  4609,
-  914, 36873,  1848,  4657,  2867,   552,  3898,   657,     3,   708,
- 4610,  1849,  4658,  3899,   658,     1,  2290, 41104,     1,  3900,
-  660,     1,  3901,   662,     2,  2476,   536,  2786, 25520,     1,
- 3902,   664,     2,  1566,  4656,  2475,   533,     1,  2521,   538,
-    3,   910, 36868,  2474,   531,  3903,   668,     3,   911, 36869,
- 2473,   530,  2603,   512,     6,    17,  4626,   912, 36870,  2472,
-  529,  2523,   543,  2866,   551,  3904,   670,     4,  2471,   528,
- 2522,   542,  2604,   514,  2865,   550,     3,  1388,  4616,  1834,
- 4608,  3905,   672,     2,  1389,  4617,  1835,  4609,     2,  1836,
- 4610,  3906,   674,     2,  1837,  4611,  3082,   536,     2,  1838,
- 4612,  3907,   676,     1,  2780, 25472,     3,   933, 36912,  1384,
- 4608,  2479,   551,     3,  1945, 36865,  2093,   544,  3079,   530,
-    3,   934, 36914,  1385,  4610,  1946, 36866,     5,   935, 36915,
- 1372,   578,  1947, 36867,  2478,   548,  3078,   528,     3,    18,
- 4640,   936, 36916,  1386,  4612,     2,   937, 36917,  3081,   534,
-    2,   938, 36918,  1387,  4614,     3,   939, 36919,  2477,   544,
- 3080,   532,     3,   931, 36904,  2864,   521,  3908,   688,     4,
-  932, 36905,  1839,  4625,  2059,   578,  2863,   520,     3,  1840,
- 4626,  2058,   577,  3909,   690,     5,  1841,  4627,  2057,   576,
- 2291, 41136,  3077,   520,  3910,   691,     3,  1842,  4628,  2063,
-  583,  3911,   692,     1,  2062,   582,     1,  2061,   581,     3,
- 2060,   580,  2484,   568,  2781, 25488,     5,   924, 36896,  1563,
- 4626,  3074,   515,  3182,  4676,  3912,   696,     3,   925, 36897,
- 2483,   566,  3073,   514,     4,   926, 36898,  1561,  4624,  3183,
- 4678,  3913,   698,     4,  1562,  4625,  2064,   584,  2482,   564,
- 3072,   512,     1,   927, 36900,     4,   928, 36901,  2481,   562,
- 2607,   544,  3076,   518,     3,   929, 36902,  2862,   519,  3181,
- 4674,     4,   930, 36903,  2480,   560,  2608,   546,  3075,   516,
-    3,   201,  8704,  2267, 41024,  3429,     8,     3,  3430,     9,
- 3630,   576,  3876,   578,     2,  3281,   512,  3431,    10,     3,
- 2268, 41027,  3432,    11,  3875,   576,     3,   202,  8708,  2779,
-25440,  3433,    12,     1,  3434,    13,     1,  3435,    14,     3,
- 2269, 41031,  3436,    15,  3877,   580,     2,   203,  8712,   309,
- 8720,     1,  3422,     1,     1,  3423,     2,     1,  3424,     3,
-    2,   391,  8720,  3425,     4,     1,  3426,     5,     1,  3427,
-    6,     1,  3428,     7,     3,   389,  8716,  2270, 41040,  3632,
-  593,     2,  2242, 37010,  3631,   592,     1,   390,  8718,     1,
- 3878,   592,     1,   387,  8712,     1,  2244, 37014,     1,   388,
- 8714,     2,  2243, 37012,  2271, 41047,     2,   204,  8728,   385,
- 8708,     2,   306,  8705,  1338, 40961,     3,   307,  8706,   386,
- 8710,  1339, 40962,     3,   308,  8707,  1340, 40963,  2245, 37016,
-    1,   384,  8706,     3,   205,  8736,  2272, 41056,  3881,   611,
-    3,  2363, 45088,  2775, 25413,  3880,   610,     1,  2776, 25414,
-    2,  2777, 25415,  3879,   608,     1,  2774, 25408,     1,  3883,
-  614,     1,  2273, 41062,     2,  2274, 41063,  3882,   612,     3,
-  206,  8744,  2275, 41064,  3437,    32,     2,   207,  8745,  3884,
-  618,     1,  3885,   620,     4,   208,  8752,   398,  8748,  2276,
-41072,  3888,   627,     1,  3887,   626,     1,  3886,   625,     1,
- 2277, 41075,     3,   396,  8744,  2278, 41076,  2778, 25424,     1,
- 2279, 41077,     2,   397,  8746,  2280, 41078,     1,  3889,   628,
-    2,   394,  8740,  2281, 41080,     2,   395,  8742,  2282, 41082,
-    2,   392,  8736,  2283, 41084,     1,   393,  8738,     3,  3624,
-  512,  3851,   514,  4929,  4866,     3,   209,  8768,  4888,  4865,
- 4930,  4867,     4,   988, 37016,  3625,   514,  3850,   512,  4889,
- 4866,     3,   210,  8770,  4890,  4867,  4928,  4865,     2,  3852,
-  518,  4849,  4866,     4,   211,  8772,  2772, 25376,  4808,  4865,
- 4850,  4867,     2,  2255, 40967,  4809,  4866,     3,   212,  8774,
- 4810,  4867,  4848,  4865,     2,   983, 37010,  4769,  4866,     3,
-  984, 37011,  4728,  4865,  4770,  4867,     3,   981, 37008,  2110,
-  641,  4729,  4866,     4,   982, 37009,  2109,   640,  4730,  4867,
- 4768,  4865,     2,   987, 37014,  4689,  4866,     2,  4648,  4865,
- 4690,  4867,     2,   985, 37012,  4649,  4866,     3,   986, 37013,
- 4650,  4867,  4688,  4865,     3,   213,  8785,  3854,   530,  5249,
- 4866,     3,  2256, 40976,  5208,  4865,  5250,  4867,     3,   214,
- 8787,  3853,   528,  5209,  4866,     3,   980, 37001,  5210,  4867,
- 5248,  4865,     3,   215,  8789,  3856,   534,  5169,  4866,     3,
- 2773, 25392,  5128,  4865,  5170,  4867,     3,   217,  8791,  3855,
-  532,  5129,  4866,     3,   216,  8790,  5130,  4867,  5168,  4865,
-    6,   219,  8793,   228, 37010,   975, 36994,  2111,   659,  3858,
-  538,  5089,  4866,     5,   218,  8792,   976, 36995,  3859,   539,
- 5048,  4865,  5090,  4867,     3,   973, 36992,  3857,   536,  5049,
- 4866,     4,   220,  8794,   974, 36993,  5050,  4867,  5088,  4865,
-    1,  5009,  4866,     5,   221,  8796,   979, 36999,  2114,   662,
- 4968,  4865,  5010,  4867,     4,   977, 36996,  2113,   661,  3860,
-  540,  4969,  4866,     4,   978, 36997,  2112,   660,  4970,  4867,
- 5008,  4865,     3,  2258, 40993,  3626,   544,  3861,   546,     1,
- 2257, 40992,     1,  2260, 40995,     2,  2259, 40994,  3627,   547,
-    2,  3628,   548,  3863,   550,     2,  2261, 40996,  2770, 25344,
-    2,  2263, 40999,  3862,   548,     1,  2262, 40998,     1,  3866,
-  554,     2,  2264, 41000,  3867,   555,     1,  3864,   552,     1,
- 3865,   553,     1,  3869,   558,     2,  2905,   661,  3868,   556,
-    1,  2904,   660,     2,  3629,   560,  3871,   562,     1,  2265,
-41008,     2,  2903,   649,  3870,   560,     3,  1948, 37017,  2266,
-41010,  2902,   648,     1,  3873,   566,     1,  2771, 25360,     1,
- 3872,   564,     1,  2898,   642,     1,  3874,   568,     1,  2901,
-  647,     1,  2900,   645,     1,  2899,   644,     3,   121,   772,
- 1418, 37221,  4094,   512,     3,   122,   773,  1417, 37220,  3185,
- 4920,     4,   123,   774,  1419, 37223,  2767, 25312,  4095,   514,
-    2,   124,   775,  3186,  4922,     3,   117,   768,  1009, 37209,
- 1414, 37217,     1,   118,   769,     2,   119,   770,  1416, 37219,
-    2,   120,   771,  1415, 37218,     4,   129,   780,  1008, 37205,
- 1722,   800,  2639,  4881,     2,   130,   781,  2638,  4880,     1,
-  131,   782,     1,   132,   783,     3,   125,   776,  1006, 37201,
- 2131,   832,     2,   126,   777,  1723,   805,     1,   127,   778,
-    2,   128,   779,  1007, 37202,     3,  1724,   824,  2769, 25330,
- 4096,   528,     2,  2768, 25328,  4097,   530,     2,   133,   784,
- 1421, 37233,     1,  1420, 37232,     1,  1422, 37234,     2,   232,
-37204,  2637,  4864,     1,  1005, 37191,     1,  3184,  4900,     2,
- 1719,   776,  1788,   772,     1,  1720,   777,     1,  2764, 25280,
-    2,  1022, 37241,  1784,   768,     2,  1021, 37240,  1785,   769,
-    1,  1786,   770,     1,  1787,   771,     2,  1018, 37237,  1952,
-37189,     3,  1017, 37236,  2645,  4912,  4603, 37417,     1,  1020,
-37239,     1,  1019, 37238,     1,  1014, 37233,     1,  1013, 37232,
-    2,  1016, 37235,  1717,   774,     2,  1015, 37234,  1718,   775,
-    2,  1410, 37205,  4604, 37424,     1,  1409, 37204,     2,  1412,
-37207,  2765, 25296,     1,  1411, 37206,     5,  1012, 37225,  1852,
- 4945,  2025,   768,  2067,   770,  2951,  4873,     2,  1011, 37224,
- 1851,  4944,     2,  1408, 37203,  2065,   768,     3,  1853,  4946,
- 2066,   769,  2766, 25301,     2,  2641,  4897,  2949,  4869,     2,
- 2640,  4896,  2948,  4868,     1,  2643,  4899,     3,  1010, 37222,
- 2642,  4898,  2950,  4870,     1,  2945,  4865,     2,  1413, 37208,
- 2644,  4900,     1,  2947,  4867,     3,  1721,   791,  1854,  4954,
- 2946,  4866,     3,   725,  4884,   816, 21008,  3975,   900,     1,
-  726,  4885,     3,   727,  4886,   817, 21010,  3976,   902,     2,
- 2121,   782,  2762, 25248,     4,   723,  4880,  1000, 37144,  2524,
-  769,  3973,   896,     1,  1001, 37145,     3,   724,  4882,  2763,
-25253,  3974,   898,     1,  2317, 41344,     1,   997, 37140,     1,
-  998, 37141,     1,  2120,   775,     3,   999, 37143,  2119,   774,
- 3979,   911,     5,   728,  4888,   909, 33105,  1407, 37160,  2116,
-  769,  3977,   904,     2,   908, 33104,  2115,   768,     3,   996,
-37138,  2118,   771,  3978,   906,     2,  2117,   770,  3094,   816,
-    1,  3984,   916,     2,  2613,   776,  3985,   917,     2,  2321,
-41365,  3986,   918,     1,  2320, 41364,     3,   720,  4864,  2319,
-41363,  3980,   912,     4,   721,  4865,  2126,   792,  2318, 41362,
- 3981,   913,     2,   722,  4866,  3982,   914,     1,  3983,   915,
-    1,   992, 37124,     3,   993, 37125,  2124,   788,  2609,   768,
-    1,   994, 37126,     3,   995, 37127,  2125,   790,  2610,   770,
-    2,   989, 37120,  3987,   920,     3,   990, 37121,  2122,   784,
- 2611,   772,     3,  1576,  4912,  1951, 37170,  3988,   922,     4,
-  991, 37123,  2123,   786,  2612,   774,  3093,   800,     1,  3991,
-  932,     1,  2920,   796,     2,  2922,   799,  3992,   934,     2,
- 2761, 25216,  2921,   798,     3,  1850,  4864,  1949, 37128,  3989,
-  928,     1,  2918,   792,     1,  3990,   930,     2,  2919,   794,
- 3092,   792,     3,   231, 37156,  1725,   833,  3995,   940,     3,
- 2129,   804,  2917,   788,  3091,   790,     1,  3090,   788,     3,
- 2128,   801,  2915,   785,  3993,   936,     5,   229, 37153,  1726,
-  836,  2127,   800,  2914,   784,  3089,   786,     2,  1574,  4864,
- 3994,   938,     3,   230, 37155,  2916,   786,  3088,   784,     1,
- 2912,   781,     1,  2911,   780,     2,  1406, 37142,  2913,   783,
-    2,   729,  4896,  2908,   777,     2,  1404, 37137,  2907,   776,
-    1,  2910,   779,     3,  1405, 37139,  2909,   778,  3087,   776,
-    2,  1002, 37157,  3086,   774,     1,  1003, 37158,     3,  1004,
-37159,  2906,   774,  3085,   772,     1,  1950, 37136,     2,  2130,
-  816,  3084,   770,     1,  1575,  4880,     1,  3083,   768,     2,
- 2758, 25184,  4794,   512,     1,  3955,   838,     1,  4834,   512,
-    1,  3954,   836,     1,  4874,   512,     2,  2759, 25189,  3953,
-  834,     1,  4914,   512,     1,  3952,   832,     1,  4634,   512,
-    1,  4674,   512,     1,  3958,   844,     1,  4714,   512,     1,
- 3957,   842,     1,  4754,   512,     1,  3956,   840,     2,  2760,
-25200,  5114,   512,     1,  3963,   854,     2,  3962,   853,  5154,
-  512,     1,  3961,   852,     1,  5194,   512,     1,  3960,   850,
-    1,  5234,   512,     1,  3959,   848,     1,  4954,   512,     1,
- 4994,   512,     1,  5034,   512,     1,  3965,   858,     1,  5074,
-  512,     1,  3964,   856,     1,  3969,   870,     2,  2309, 41319,
- 3968,   868,     1,  2305, 41312,     2,  2306, 41313,  3967,   866,
-    1,  2307, 41314,     2,  2308, 41315,  3966,   864,     1,  2310,
-41320,     1,  2311, 41322,     1,  2316, 41332,     1,  3972,   884,
-    1,  2312, 41328,     2,  2313, 41329,  3971,   882,     1,  2314,
-41330,     2,  2315, 41331,  3970,   880,     5,  2371, 57345,  2751,
-25121,  3932,   774,  4804,  4608,  4846,  4610,     2,  4805,  4609,
- 4847,  4611,     4,  2753, 25123,  3931,   772,  4806,  4610,  4844,
- 4608,     3,  2752, 25122,  4807,  4611,  4845,  4609,     4,  2755,
-25125,  3930,   770,  4884,  4608,  4926,  4610,     4,  2372, 57348,
- 2754, 25124,  4885,  4609,  4927,  4611,     3,  1033, 37272,  4886,
- 4610,  4924,  4608,     5,  1034, 37273,  2373, 57350,  2756, 25126,
- 4887,  4611,  4925,  4609,     3,  1031, 37270,  4644,  4608,  4686,
- 4610,     5,  1032, 37271,  2374, 57352,  3938,   783,  4645,  4609,
- 4687,  4611,     3,  3936,   780,  4646,  4610,  4684,  4608,     4,
- 1030, 37269,  3937,   781,  4647,  4611,  4685,  4609,     3,  3935,
-  778,  4724,  4608,  4766,  4610,     2,  4725,  4609,  4767,  4611,
-    3,  3933,   776,  4726,  4610,  4764,  4608,     3,  3934,   777,
- 4727,  4611,  4765,  4609,     4,  2376, 57361,  3941,   790,  5124,
- 4608,  5166,  4610,     4,  2375, 57360,  2757, 25136,  5125,  4609,
- 5167,  4611,     3,  3940,   788,  5126,  4610,  5164,  4608,     2,
- 5127,  4611,  5165,  4609,     3,  3939,   786,  5204,  4608,  5246,
- 4610,     3,  2292, 41232,  5205,  4609,  5247,  4611,     2,  5206,
- 4610,  5244,  4608,     3,  2293, 41234,  5207,  4611,  5245,  4609,
-    3,  1029, 37254,  4964,  4608,  5006,  4610,     2,  4965,  4609,
- 5007,  4611,     3,  1027, 37252,  4966,  4610,  5004,  4608,     3,
- 1028, 37253,  4967,  4611,  5005,  4609,     3,  1025, 37250,  5044,
- 4608,  5086,  4610,     3,  1026, 37251,  5045,  4609,  5087,  4611,
-    4,  1023, 37248,  3942,   792,  5046,  4610,  5084,  4608,     3,
- 1024, 37249,  5047,  4611,  5085,  4609,     2,  2299, 41253,  2378,
-57377,     2,  2298, 41252,  2377, 57376,     1,  2380, 57379,     1,
- 2379, 57378,     3,  2295, 41249,  2382, 57381,  3944,   802,     2,
- 2294, 41248,  2381, 57380,     2,  2297, 41251,  3943,   800,     1,
- 2296, 41250,     1,  3364,   886,     2,  2384, 57393,  3948,   822,
-    2,  2383, 57392,  2750, 25104,     1,  3947,   820,     1,  2302,
-41270,     1,  3946,   818,     1,  2300, 41264,     1,  3945,   816,
-    1,  2301, 41266,     1,  3951,   828,     1,  3950,   826,     1,
- 2303, 41272,     1,  3949,   824,     1,  2304, 41274,     1,  3291,
-   16,     1,  1594,  5234,     1,  1593,  5232,     1,  2647,  5121,
-    2,  2646,  5120,  3292,    21,     1,  2817, 26096,     2,  1588,
- 5219,  2133,  1088,     2,  2134,  1089,  2185,  5120,     1,  1587,
- 5216,     1,  1591,  5223,     2,  1590,  5222,  3290,     5,     1,
- 1589,  5221,     1,   739,  5200,     1,  1592,  5224,     1,  2816,
-26080,     1,  3191,  5125,     2,  1584,  5202,  3190,  5124,     1,
- 3193,  5127,     2,  1583,  5200,  3192,  5126,     1,  3187,  5121,
-    1,  3189,  5123,     2,  1585,  5204,  3188,  5122,     3,  1794,
- 1040,  2026,  1024,  3199,  5133,     3,   740,  5216,  1795,  1041,
- 3198,  5132,     1,  1796,  1042,     3,  1586,  5208,  1797,  1043,
- 3200,  5134,     1,  3195,  5129,     1,  3194,  5128,     2,  2815,
-26064,  3197,  5131,     1,  3196,  5130,     2,  1581,  5187,  3293,
-   32,     1,  1582,  5189,     1,  1789,  1024,     2,   741,  5232,
- 1790,  1025,     1,  1791,  1026,     1,  1792,  1027,     1,  1793,
- 1028,     2,  1211, 38401,  3101,  1058,     2,  1212, 38402,  3100,
- 1057,     2,  1213, 38403,  3099,  1056,     5,    20,  5136,  1214,
-38404,  1580,  5174,  3103,  1063,  4606,   272,     2,  1215, 38405,
- 2614,  1024,     2,  1216, 38406,  4607,   274,     2,  1217, 38407,
- 3102,  1060,     1,   730,  5120,     1,   731,  5121,     1,   732,
- 5122,     1,   733,  5123,     1,   734,  5124,     1,   735,  5125,
-    1,  2814, 26032,     4,  1579,  5155,  2132,  1024,  2617,  1044,
- 3105,  1074,     1,  1578,  5152,     1,  3104,  1072,     2,    19,
- 5120,  4605,   256,     1,  2615,  1040,     2,  2616,  1042,  3106,
- 1076,     1,   736,  5137,     1,   737,  5138,     1,   738,  5139,
-    1,  2813, 26016,     1,  2923,  1025,     2,  1218, 38433,  3096,
- 1026,     2,  1219, 38434,  2925,  1027,     3,  1220, 38435,  2924,
- 1026,  3095,  1024,     3,    22,  5168,  1221, 38436,  2927,  1029,
-    2,  2926,  1028,  3098,  1030,     1,    23,  5170,     2,  1577,
- 5141,  3097,  1028,     1,  1868,  5136,     1,  2812, 26000,     1,
- 1862,  5128,     1,  1863,  5131,     2,    21,  5152,  1864,  5132,
-    1,  1865,  5133,     1,  1866,  5134,     1,  1867,  5135,     1,
- 1855,  5121,     1,  1856,  5122,     1,  1857,  5123,     1,  1858,
- 5124,     1,  1859,  5125,     1,  1860,  5126,     1,  1861,  5127,
-    1,  4019,  1107,     1,  4018,  1106,     1,  4017,  1105,     1,
- 4016,  1104,     1,  3405,  1280,     1,  4015,  1091,     1,  4014,
- 1090,     1,  4013,  1089,     1,  4012,  1088,     1,  2811, 25952,
-    1,  2810, 25936,     1,  2809, 25925,     1,  2808, 25920,     2,
- 4469,  9472,  5051,  5376,     2,  4495,  9472,  5091,  5376,     2,
- 4417,  9472,  4971,  5376,     2,  4443,  9472,  5011,  5376,     3,
- 3999,  1042,  4573,  9472,  5211,  5376,     4,   742,  5248,  3998,
- 1040,  4599,  9472,  5251,  5376,     2,  4521,  9472,  5131,  5376,
-    1,  2807, 25904,     2,  4547,  9472,  5171,  5376,     2,  4261,
- 9472,  4731,  5376,     1,  2197,  9216,     2,  4287,  9472,  4771,
- 5376,     2,  4209,  9472,  4651,  5376,     2,  4235,  9472,  4691,
- 5376,     4,  2356, 42497,  3997,  1026,  4365,  9472,  4891,  5376,
-    1,  2355, 42496,     4,   743,  5264,  2357, 42499,  4391,  9472,
- 4931,  5376,     2,   744,  5265,  3996,  1025,     2,  4313,  9472,
- 4811,  5376,     1,  2806, 25888,     2,  4339,  9472,  4851,  5376,
-    1,   745,  5269,     1,  4007,  1074,     1,  4008,  1075,     1,
- 4006,  1073,     1,  4011,  1078,     1,  2805, 25872,     1,  4009,
- 1076,     1,  4010,  1077,     1,  1391, 13313,     1,  1392, 13314,
-    1,  1393, 13315,     1,  1394, 13316,     1,  1395, 13317,     1,
- 1396, 13318,     1,  4002,  1058,     1,  4003,  1059,     1,  4000,
- 1056,     1,  4001,  1057,     1,  2804, 25856,     1,  4004,  1060,
-    1,  4005,  1061,     2,  2147,  1364,  4611,  4112,     2,  2148,
- 1365,  3297,   277,     1,  2149,  1366,     3,  2143,  1360,  3286,
- 1040,  3296,   272,     2,  1245, 38720,  2144,  1361,     1,  2145,
- 1362,     1,  2146,  1363,     1,  2803, 25840,     1,  1246, 38729,
-    1,  1248, 38741,     1,  3295,   261,     1,  1249, 38742,     3,
- 1247, 38737,  3294,   256,  4608,  4100,     1,  4609,  4102,     1,
- 4610,  4106,     1,  1251, 38745,     1,  1250, 38744,     2,  1257,
-38757,  2955,  5381,     1,  1256, 38756,     2,  1259, 38759,  2956,
- 5383,     1,  1258, 38758,     2,  1253, 38753,  2952,  5377,     1,
- 1252, 38752,     2,  1255, 38755,  2954,  5379,     2,  1254, 38754,
- 2953,  5378,     1,  2959,  5389,     1,  2958,  5388,     1,  2802,
-25808,     2,  1261, 38761,  2027,  1280,     2,  1260, 38760,  2957,
- 5384,     1,  2028,  1282,     1,  3288,  1060,     1,  3289,  1062,
-    5,  1263, 38769,  2151,  1376,  2960,  5393,  3287,  1056,  3298,
-  288,     1,  1262, 38768,     1,  2152,  1378,     2,  1264, 38770,
- 2961,  5394,     1,  2801, 25792,     3,    26,  5392,  2139,  1301,
- 2619,  1281,     2,    27,  5393,  2618,  1280,     1,    28,  5394,
-    1,   747,  5384,     1,  1222, 38657,     2,  1605,  5424,  2138,
- 1299,     3,  1606,  5425,  2137,  1298,  3112,  1312,     1,    29,
- 5402,     1,   746,  5376,     1,  2140,  1304,     1,  2141,  1306,
-    2,    24,  5376,  1601,  5414,     2,  1223, 38677,  1602,  5415,
-    1,  1224, 38678,     2,  1225, 38679,  1600,  5413,     1,    25,
- 5380,     1,  2135,  1280,     1,  2800, 25760,     2,   748,  5392,
- 1226, 38680,     2,   749,  5393,  1227, 38681,     1,  1603,  5416,
-    2,  1604,  5417,  2136,  1290,     1,  1232, 38692,     2,  1233,
-38693,  1598,  5399,     1,  1234, 38694,     2,  1235, 38695,  1597,
- 5397,     2,  1228, 38688,  1595,  5394,     2,  1229, 38689,  1596,
- 5395,     1,  1230, 38690,     2,  1231, 38691,  3107,  1280,     1,
- 2799, 25744,     1,   750,  5408,     2,   751,  5409,  1236, 38697,
-    1,  1599,  5400,     1,  1239, 38708,     2,  1240, 38709,  3111,
- 1302,     1,  1241, 38710,     2,  1242, 38711,  3110,  1300,     2,
- 2142,  1312,  3109,  1298,     1,  1237, 38706,     2,  1238, 38707,
- 3108,  1296,     2,   752,  5424,  1243, 38712,     2,   753,  5425,
- 1244, 38713,     2,  3341,  1296,  3365,  1280,     1,  2798, 25712,
-    2,  3340,  1280,  3366,  1296,     2,  2361, 42820,  2797, 25696,
-    1,  3367,  1312,     1,  2796, 25680,     1,  2795, 25664,     1,
- 3395,  1280,     1,  2794, 25648,     1,  4031,  1298,     1,  2150,
- 1434,     1,  4029,  1296,     1,  4030,  1297,     1,  3392,  1280,
-    1,  4027,  1288,     1,  4028,  1289,     1,  4025,  1286,     2,
- 2793, 25632,  4026,  1287,     1,  4023,  1284,     1,  4024,  1285,
-    1,  4021,  1282,     1,  4022,  1283,     1,  4020,  1281,     1,
- 2792, 25616,     1,  2359, 42801,     1,  2358, 42800,     1,  2360,
-42802,     1,  2791, 25600,     2,   242, 37977,  1149, 37961,     2,
-  241, 37976,  1964, 38008,     1,  1146, 37953,     1,  1145, 37952,
-    1,  1147, 37954,     1,  1963, 38004,     1,  1148, 37959,     1,
- 1150, 37969,     1,  1151, 37970,     1,  1152, 37973,     1,  1154,
-37975,     1,  1153, 37974,     1,  1163, 37993,     2,  1162, 37992,
- 1458, 37968,     1,  1459, 37971,     1,  1625,  5720,     1,  1155,
-37985,     2,  1157, 37987,  2963,  5635,     3,  1156, 37986,  1624,
- 5712,  2962,  5634,     2,  1159, 37989,  2965,  5637,     3,  1158,
-37988,  1962, 37972,  2964,  5636,     2,  1161, 37991,  2967,  5639,
-    2,  1160, 37990,  2966,  5638,     1,  1623,  5705,     2,  1165,
-38001,  1619,  5699,     3,   243, 37984,  1164, 38000,  1618,  5698,
-    2,  1167, 38003,  1958, 37955,     2,  1166, 38002,  1617,  5696,
-    1,  1960, 37957,     3,  1168, 38004,  1622,  5702,  1959, 37956,
-    2,  1170, 38007,  1621,  5701,     3,  1169, 38006,  1620,  5700,
- 1961, 37958,     2,   754,  5632,  2350, 42131,     1,  2349, 42130,
-    2,   755,  5634,  2348, 42129,     1,   756,  5636,     1,  2352,
-42134,     1,   757,  5638,     1,  2351, 42132,     2,   240, 37904,
-  758,  5640,     2,  1118, 37889,  2155,  1552,     2,  1119, 37890,
- 1616,  5680,     2,  1120, 37891,  2156,  1554,     1,  1121, 37892,
-    1,  1122, 37893,     1,  1123, 37894,     1,  1124, 37895,     1,
-  759,  5648,     1,  1457, 37921,     2,   760,  5650,  1615,  5672,
-    2,  1125, 37904,  1612,  5666,     1,  2153,  1536,     3,  1126,
-37906,  1611,  5664,  1957, 37922,     1,  2154,  1538,     2,    30,
- 5632,  1614,  5670,     1,  1613,  5668,     1,  1127, 37911,     2,
-  761,  5664,  1134, 37928,     1,  1135, 37929,     2,   762,  5666,
- 1610,  5656,     1,   763,  5667,     1,   764,  5668,     2,  1128,
-37920,  1607,  5650,     2,  1954, 37905,  3114,  1538,     2,  1129,
-37923,  3113,  1536,     2,  1130, 37924,  1609,  5654,     2,  1131,
-37925,  1955, 37909,     2,  1132, 37926,  1956, 37910,     3,  1133,
-37927,  1608,  5653,  3115,  1540,     1,  1143, 37944,     2,   319,
-37937,  1144, 37945,     1,  1136, 37936,     1,  2157,  1568,     1,
- 1137, 37938,     1,  1138, 37939,     1,  1139, 37940,     1,  1140,
-37941,     1,  1141, 37942,     1,  1142, 37943,     1,  2158,  1786,
-    1,  2346, 41987,     1,  2345, 41986,     1,  2347, 41988,     2,
- 1200, 38217,  1805,  1840,     1,  1199, 38216,     1,  1196, 38213,
-    1,  1195, 38212,     1,  1198, 38215,     1,  1197, 38214,     2,
- 1192, 38209,  3300,   784,     1,  1194, 38211,     1,  1193, 38210,
-    2,  1210, 38233,  1802,  1824,     2,  1209, 38232,  1803,  1825,
-    2,  1804,  1826,  2162,  1866,     1,  1206, 38229,     2,  1205,
-38228,  3299,   773,     1,  1208, 38231,     1,  1207, 38230,     1,
- 1202, 38225,     1,  1201, 38224,     1,  1204, 38227,     1,  1203,
-38226,     1,  1801,  1808,     1,  2972,  5893,     1,  2971,  5892,
-    1,  2973,  5894,     1,  2968,  5889,     1,  2970,  5891,     1,
- 2969,  5890,     1,  1798,  1792,     1,  1799,  1793,     1,  1800,
- 1794,     1,   767,  5892,     2,   768,  5894,  1462, 38198,     2,
-  765,  5888,  1174, 38152,     1,  1175, 38153,     1,   766,  5890,
-    1,  2159,  1818,     2,  1171, 38148,  4612,    16,     1,  1172,
-38150,     2,  1173, 38151,  1972, 38199,     1,   769,  5896,     2,
-  770,  5904,  1182, 38168,     1,  1183, 38169,     1,   771,  5906,
-    1,  1178, 38164,     1,  1179, 38165,     1,  1180, 38166,     1,
- 1181, 38167,     2,  1176, 38160,  1971, 38176,     2,  1177, 38161,
- 1461, 38185,     2,   772,  5920,  1188, 38184,     1,  2161,  1850,
-    1,  1184, 38180,     2,  1185, 38181,  3120,  1798,     2,  1186,
-38182,  3119,  1797,     2,  1187, 38183,  3118,  1796,     1,  1460,
-38168,     1,  3117,  1794,     1,  3116,  1792,     1,  1191, 38200,
-    1,  1806,  1856,     2,  2160,  1834,  3126,  1816,     2,  3125,
- 1815,  4613,    32,     2,  1968, 38149,  3124,  1814,     1,  1969,
-38150,     2,  1970, 38151,  3123,  1812,     1,  1189, 38192,     3,
- 1190, 38193,  1965, 38145,  3122,  1810,     1,  1966, 38146,     2,
- 1967, 38147,  3121,  1808,     2,  4315,  9744,  4522,  9728,     2,
- 4341,  9744,  4548,  9728,     2,  4367,  9744,  4574,  9728,     2,
- 4393,  9744,  4600,  9728,     2,  4211,  9744,  4418,  9728,     2,
- 4237,  9744,  4444,  9728,     2,  4263,  9744,  4470,  9728,     2,
- 4289,  9744,  4496,  9728,     2,  4314,  9728,  4523,  9744,     2,
- 2353, 42244,  2819, 26144,     2,  4340,  9728,  4549,  9744,     2,
- 4366,  9728,  4575,  9744,     2,  4392,  9728,  4601,  9744,     2,
- 4210,  9728,  4419,  9744,     2,  4236,  9728,  4445,  9744,     2,
- 4262,  9728,  4471,  9744,     2,  4288,  9728,  4497,  9744,     1,
- 2818, 26128,     1,  2354, 42277,     2,  1811,  2072,  2974,  6145,
-    1,  2976,  6147,     1,  2975,  6146,     1,  2978,  6149,     1,
- 2977,  6148,     1,  2980,  6151,     1,  2979,  6150,     1,  1807,
- 2064,     1,  2981,  6152,     1,  1808,  2066,     1,  1809,  2067,
-    1,  1810,  2068,     1,  2369, 56077,     1,  2368, 56076,     1,
- 2367, 56075,     1,  2366, 56071,     1,  2365, 56070,     1,  2364,
-56064,     1,  2370, 56179,     1,   773,  6144,     1,   774,  6145,
-    1,   775,  6146,     1,   776,  6147,     1,  2165,  2282,     1,
- 2164,  2266,     1,  2163,  2264,     1,  2985,  6405,     1,  2984,
- 6404,     1,  2986,  6407,     1,  2982,  6401,     1,  2983,  6403,
-    1,  2166,  2552,     3,  4635,  2048,  4676,  2050,  4718,  2052,
-    1,  4677,  2051,     3,  4636,  2050,  4675,  2048,  4758,  2052,
-    1,  4637,  2051,     3,  4638,  2052,  4715,  2048,  4756,  2050,
-    1,  4757,  2051,     3,  4678,  2052,  4716,  2050,  4755,  2048,
-    1,  4717,  2051,     4,  3283,  2310,  4795,  2048,  4836,  2050,
- 4878,  2052,     1,  4837,  2051,     4,  3282,  2308,  4796,  2050,
- 4835,  2048,  4918,  2052,     1,  4797,  2051,     3,  4798,  2052,
- 4875,  2048,  4916,  2050,     1,  4917,  2051,     3,  4838,  2052,
- 4876,  2050,  4915,  2048,     1,  4877,  2051,     3,  4955,  2048,
- 4996,  2050,  5038,  2052,     1,  4997,  2051,     3,  4956,  2050,
- 4995,  2048,  5078,  2052,     1,  4957,  2051,     3,  4958,  2052,
- 5035,  2048,  5076,  2050,     1,  5077,  2051,     3,  4998,  2052,
- 5036,  2050,  5075,  2048,     1,  5037,  2051,     3,  5115,  2048,
- 5156,  2050,  5198,  2052,     1,  5157,  2051,     3,  5116,  2050,
- 5155,  2048,  5238,  2052,     1,  5117,  2051,     4,  3285,  2322,
- 5118,  2052,  5195,  2048,  5236,  2050,     1,  5237,  2051,     4,
- 3284,  2320,  5158,  2052,  5196,  2050,  5235,  2048,     1,  5197,
- 2051,     1,  1812,  2562,     1,  1813,  2564,     1,  2994,  6665,
-    1,  2993,  6664,     1,  2987,  6657,     1,  2988,  6659,     1,
- 2990,  6661,     1,  2989,  6660,     1,  2992,  6663,     1,  2991,
- 6662,     1,  1278, 38928,     1,  1271, 38920,     1,  1272, 38921,
-    1,  1273, 38923,     1,  1274, 38924,     1,  1275, 38925,     1,
- 1276, 38926,     1,  1277, 38927,     1,  1265, 38913,     1,  1266,
-38915,     1,  1267, 38916,     1,  1268, 38917,     1,  1269, 38918,
-    1,  1270, 38919,     1,  3005,  6932,     1,  3002,  6929,     1,
- 3004,  6931,     1,  3003,  6930,     1,  3001,  6920,     1,  2998,
- 6916,     1,  3000,  6919,     1,  2999,  6918,     1,  2995,  6913,
-    1,  2997,  6915,     1,  2996,  6914,     1,  1335, 39237,     1,
- 1334, 39236,     1,  1337, 39239,     1,  1336, 39238,     1,  1331,
-39233,     1,  1333, 39235,     1,  1332, 39234,     1,  1328, 39228,
-    1,  1329, 39229,     1,  1330, 39230,     1,  1324, 39224,     1,
- 1325, 39225,     1,  1326, 39226,     1,  1327, 39227,     1,  1320,
-39220,     1,  1321, 39221,     1,  1322, 39222,     1,  1323, 39223,
-    1,  1316, 39216,     1,  1317, 39217,     1,  1318, 39218,     1,
- 1319, 39219,     1,  1315, 39204,     1,  1311, 39200,     1,  1312,
-39201,     1,  1313, 39202,     1,  1314, 39203,     1,  1307, 39196,
-    1,  1308, 39197,     1,  1309, 39198,     1,  1310, 39199,     1,
- 1303, 39192,     1,  1304, 39193,     1,  1305, 39194,     1,  1306,
-39195,     1,  1299, 39188,     1,  1300, 39189,     1,  1301, 39190,
-    1,  1302, 39191,     1,  1295, 39184,     1,  1296, 39185,     1,
- 1297, 39186,     1,  1298, 39187,     1,  1291, 39180,     1,  1292,
-39181,     1,  1293, 39182,     1,  1294, 39183,     1,  1287, 39176,
-    2,  1288, 39177,  2362, 43410,     1,  1289, 39178,     1,  1290,
-39179,     1,  1283, 39172,     1,  1284, 39173,     1,  1285, 39174,
-    1,  1286, 39175,     1,  1279, 39168,     1,  1280, 39169,     1,
- 1281, 39170,     1,  1282, 39171,     1,  5256,    16,     1,  5255,
-    9,     1,  5254,     8,     1,  5258,    48,     1,  1944, 32736,
-    1,  5257,    32,     1,  5259,    64,     1,  5264,    64,     1,
- 4186,     1,     1,  5263,    48,     1,  5262,    32,     1,  5260,
-   16,     1,  5261,    17,     1,  5269, 57565,     1,  5267, 57344,
-    1,  5268, 57357,
+const unsigned short DictTagPerfectHash[] = {
+ 4096,  5270,     0,     2,     3,     0,     5,     0,     7,     0,
+    9,     0,    10,     0,    13,     0,    15,     2,    17,     0,
+   17,     0,    17,     0,    17,     0,    18,     0,    18,     0,
+   19,     0,    20,     1,    23,     0,    25,     1,    27,     0,
+   28,     0,    29,     0,    30,     0,    34,     3,    37,     0,
+   39,     0,    39,     0,    40,     0,    40,     3,    42,     0,
+   42,     0,    43,     0,    44,   152,    49,     4,    51,     4,
+   54,  2560,    60,    78,    65,   142,    69,    12,    72,     0,
+   76,     0,    77,     8,    80,    11,    84,     0,    85,     0,
+   86,     0,    87,     1,    89,    30,    93,    17,    96,     0,
+   99,     5,   103,     8,   105,     7,   109,    10,   111,     0,
+  114,     6,   116,    22,   119,     4,   121,     4,   124,     0,
+  125,     0,   127,     1,   129,     3,   131,     0,   134,     1,
+  137,     0,   139,     0,   141,     0,   142,     0,   144,    18,
+  148,     0,   150,    17,   154,     0,   155,     0,   157,     0,
+  160,     0,   161,     5,   163,     0,   164,     4,   166,    21,
+  169,     0,   171,     0,   172,     0,   173,     4,   175,     4,
+  177,    19,   180,     0,   181,     0,   182,     0,   183,     0,
+  185,     0,   186,     0,   186,     0,   187,     0,   188,     0,
+  189,   513,   192,     4,   194,     4,   196,     0,   197,     0,
+  199,     0,   200,     0,   201,     1,   203,     0,   203,     0,
+  205,     0,   208,     0,   209,     0,   211,     0,   212,     0,
+  214,     0,   215,     0,   216,     0,   216,     0,   216,     0,
+  217,     0,   218,     0,   220,     0,   221,     0,   221,     0,
+  222,     4,   225,     3,   228,     2,   230,     0,   231,     8,
+  234,     0,   235,     0,   236,     0,   237,     0,   238,    10,
+  240,     0,   241,    20,   243,     0,   243,     0,   244,     0,
+  245,     0,   246,    17,   248,     3,   251,     0,   253,     0,
+  253,     2,   257,    33,   260,     0,   262,     0,   264,     0,
+  264,     0,   264,     0,   265,     5,   267,     0,   268,     0,
+  269,     0,   270,     8,   272,   422,   278,    19,   280,    12,
+  282,     0,   284,     3,   287,    46,   293,     0,   295,     0,
+  298,     0,   300,     0,   302,     1,   304,     8,   306,     0,
+  307,     0,   307,     0,   309,     0,   311,    25,   314,     0,
+  315,     0,   317,     0,   318,     0,   320,    50,   324,     0,
+  326,     0,   326,     0,   327,     0,   327,     9,   329,     0,
+  330,     0,   330,     0,   330,     0,   331,     0,   332,     0,
+  335,     0,   336,     0,   336,     0,   337,     0,   338,     0,
+  338,     0,   339,     0,   340,     0,   341,     0,   341,     0,
+  342,     0,   343,     8,   345,     0,   346,     0,   347,     0,
+  347,     0,   349,     0,   350,     0,   350,     0,   351,     0,
+  352,     0,   353,     0,   354,     0,   355,     1,   358,     0,
+  360,     4,   364,     1,   366,     4,   369,    11,   372,     2,
+  375,     3,   378,     0,   381,     0,   382,     0,   384,     0,
+  386,     4,   389,     0,   392,   538,   396,     6,   398,     6,
+  400,     4,   402,     4,   406,     8,   408,     0,   409,     1,
+  412,     9,   415,     0,   416,     0,   416,     0,   416,     0,
+  417,     0,   417,     5,   419,     5,   421,     6,   423,     7,
+  425,     0,   427,     1,   429,     0,   432,     3,   434,     0,
+  435,     0,   436,     0,   436,    10,   439,     0,   439,     0,
+  439,     0,   439,     0,   439,     0,   440,     0,   441,     0,
+  441,     1,   444,     0,   446,     0,   447,     0,   448,     1,
+  451,     0,   452,     8,   454,    16,   456,     0,   457,     0,
+  457,     0,   457,     0,   457,     0,   457,     0,   458,     0,
+  459,     0,   461,     1,   463,     0,   465,     0,   467,     0,
+  469,     0,   470,     0,   470,     0,   471,     5,   474,     4,
+  476,     0,   476,     0,   476,     0,   477,     0,   478,     0,
+  479,     8,   481,     8,   483,   285,   487,     8,   489,     0,
+  490,     8,   492,     6,   494,     0,   494,     0,   495,     1,
+  498,     0,   502,     0,   504,     0,   506,     0,   509,     4,
+  513,   149,   518,     4,   520,     0,   521,     0,   522,     0,
+  523,     0,   525,     2,   527,     2,   529,     4,   531,     0,
+  532,     0,   532,     0,   532,     0,   532,     0,   532,     0,
+  533,     0,   534,     4,   536,     0,   538,     0,   540,     0,
+  541,     2,   543,     4,   545,     5,   547,     6,   549,     0,
+  550,     8,   552,     0,   553,     8,   556,    11,   558,    12,
+  560,     0,   561,     0,   562,     0,   563,     0,   564,     0,
+  565,     0,   566,     0,   566,     0,   566,     0,   566,     0,
+  566,     0,   566,     0,   567,     0,   567,     0,   568,     0,
+  568,     0,   568,     0,   569,     0,   570,     0,   570,     0,
+  571,     0,   572,     0,   574,     0,   574,     0,   575,     0,
+  576,     0,   577,     0,   577,     0,   577,     0,   577,    27,
+  579,     0,   579,     0,   580,     0,   582,     0,   584,     0,
+  586,    16,   588,     0,   589,    19,   591,     0,   592,    17,
+  594,    16,   596,    16,   598,    16,   600,    16,   602,     0,
+  602,    72,   605,     0,   605,     0,   606,     0,   607,     0,
+  608,     0,   609,     0,   610,     0,   610,     0,   611,     0,
+  613,     0,   613,     0,   614,     0,   615,     0,   616,     0,
+  616,     0,   616,     0,   616,     0,   616,     0,   617,     0,
+  617,    17,   620,    34,   624,    22,   628,     1,   631,     0,
+  633,     0,   633,     0,   633,     0,   633,     8,   635,     0,
+  635,     0,   636,     0,   636,     0,   637,     0,   640,     0,
+  641,     1,   643,     0,   646,   261,   651,   282,   655,    68,
+  659,     0,   661,     0,   662,     0,   663,     1,   666,     0,
+  667,     0,   668,     4,   670,   257,   674,     0,   675,     0,
+  676,     0,   676,     0,   677,     9,   679,     0,   680,    22,
+  684,     8,   686,     0,   687,     0,   688,     0,   689,     0,
+  690,     0,   691,     0,   692,     3,   694,     0,   696,     0,
+  697,     0,   697,     0,   698,     0,   699,     0,   700,     0,
+  702,     4,   704,     0,   705,     0,   706,     0,   708,     0,
+  710,     0,   712,     1,   715,     0,   716,     0,   717,     0,
+  718,     0,   720,     0,   720,     0,   721,     0,   722,     0,
+  724,     0,   726,     0,   728,     0,   730,     0,   731,     0,
+  734,     0,   736,     0,   738,     0,   739,     0,   740,     0,
+  741,     0,   742,     4,   744,     0,   745,     0,   746,     0,
+  747,     0,   748,     6,   752,     5,   756,     6,   760,     3,
+  763,     4,   766,     5,   769,     0,   770,     0,   770,     0,
+  770,     0,   771,     9,   774,     0,   774,     0,   776,     0,
+  777,     0,   778,     0,   780,     0,   781,     2,   783,     1,
+  785,     0,   787,     0,   789,     0,   790,     0,   790,     0,
+  790,     0,   790,     0,   790,     0,   792,     0,   794,     0,
+  795,     0,   795,     0,   796,     0,   797,     1,   800,     4,
+  802,     0,   803,     0,   804,     0,   805,     0,   807,     0,
+  808,     0,   809,     0,   809,     0,   810,     4,   812,     4,
+  814,     0,   814,     0,   814,     0,   814,     0,   815,     0,
+  817,     0,   818,     0,   819,     1,   822,     0,   824,     0,
+  826,     1,   829,     0,   830,     7,   832,    16,   834,     0,
+  835,     0,   836,     0,   836,     0,   836,     0,   837,     0,
+  839,    12,   841,     0,   843,     0,   844,  1036,   850,     2,
+  853,     0,   853,     0,   853,     0,   853,     0,   854,     0,
+  854,     0,   855,     0,   856,     0,   856,     0,   857,     0,
+  858,     1,   860,     4,   862,     0,   863,     0,   864,     0,
+  864,     0,   865,     0,   866,     0,   867,     0,   868,     0,
+  868,     0,   868,     0,   868,     0,   868,     0,   868,     0,
+  869,     0,   869,     6,   871,     0,   872,     0,   873,     0,
+  874,     0,   874,     0,   874,     0,   874,     0,   874,     0,
+  874,     0,   875,     0,   876,     0,   876,     0,   877,     0,
+  878,     0,   879,     0,   880,     0,   881,     0,   882,     0,
+  882,     0,   884,     0,   885,     0,   886,     0,   886,     0,
+  887,     0,   887,     0,   887,     0,   888,     0,   888,     0,
+  889,     0,   890,     0,   891,     0,   891,     0,   892,     0,
+  893,    12,   895,     0,   896,    13,   898,     0,   898,    12,
+  901,   532,   904,     6,   906,     0,   907,     0,   907,     0,
+  907,     0,   907,     0,   907,     0,   907,     0,   908,     0,
+  909,     0,   909,     2,   911,     0,   911,     0,   913,     0,
+  913,     0,   913,     0,   913,     0,   913,     0,   913,     0,
+  914,     0,   914,     0,   915,     0,   915,     0,   916,     0,
+  916,     0,   917,     0,   919,    32,   922,     0,   923,     0,
+  924,     0,   924,     0,   924,     0,   924,     0,   924,     0,
+  924,     0,   924,     0,   924,     1,   926,     0,   926,     0,
+  926,     0,   926,     0,   926,     0,   927,     0,   928,     0,
+  929,     0,   929,     0,   930,     0,   930,     0,   931,     0,
+  931,     0,   932,     0,   932,     0,   933,     5,   936,     0,
+  937,     0,   938,     0,   939,     0,   939,     0,   940,     0,
+  941,     0,   941,     0,   942,     0,   942,     0,   942,     0,
+  942,     0,   942,     0,   942,     0,   942,    12,   944,     0,
+  946,     0,   947,     0,   947,     8,   949,     0,   949,     0,
+  950,     0,   950,     0,   952,     0,   952,     0,   954,     0,
+  954,     0,   955,     0,   955,     0,   956,     0,   956,     0,
+  956,     0,   958,     0,   958,     0,   958,     0,   958,     0,
+  958,    11,   960,    10,   962,     5,   965,     0,   966,     0,
+  967,     0,   968,     0,   969,     0,   970,     0,   971,     0,
+  972,     0,   973,     0,   975,     0,   976,     0,   977,     0,
+  978,     0,   979,     0,   980,     0,   980,     0,   981,     0,
+  981,     0,   982,     0,   984,     0,   985,     0,   987,     0,
+  989,     3,   992,     8,   995,     4,   998,     0,  1000,     0,
+ 1002,     8,  1005,     9,  1008,     1,  1010,     0,  1012,     2,
+ 1015,     1,  1018,     0,  1021,     0,  1023,     0,  1025,     0,
+ 1027,     0,  1028,     2,  1030,   144,  1034,    21,  1039,     0,
+ 1040,     0,  1042,     0,  1043,     0,  1044,    16,  1047,     0,
+ 1048,     0,  1052,     0,  1052,     0,  1053,     8,  1055,    23,
+ 1060,     3,  1063,     0,  1065,     0,  1066,     0,  1066,     8,
+ 1069,     0,  1070,     0,  1071,     0,  1071,     0,  1071,     0,
+ 1072,     0,  1072,    32,  1075,     2,  1079,     1,  1082,     0,
+ 1083,     3,  1087,     0,  1088,     0,  1090,     1,  1093,     8,
+ 1095,     8,  1097,     0,  1097,     0,  1098,     0,  1098,     0,
+ 1098,     0,  1098,     0,  1098,     0,  1099,     0,  1100,     0,
+ 1101,     0,  1102,     5,  1106,     0,  1107,     4,  1109,     4,
+ 1111,    29,  1115,     0,  1118,     0,  1118,     0,  1118,    30,
+ 1122,    23,  1125,     0,  1125,     0,  1126,     1,  1129,    17,
+ 1131,     0,  1133,     0,  1134,     0,  1136,     0,  1137,     2,
+ 1139,     0,  1140,    17,  1145,    12,  1148,     1,  1150,     0,
+ 1151,     0,  1152,     0,  1153,     0,  1154,     0,  1155,     0,
+ 1156,     0,  1157,   264,  1161,     8,  1163,     0,  1165,     9,
+ 1167,     0,  1168,     0,  1170,     0,  1171,     0,  1173,     0,
+ 1174,     0,  1175,     0,  1175,     0,  1175,     8,  1177,     0,
+ 1177,     0,  1180,     4,  1182,    13,  1186,    48,  1189,     3,
+ 1192,     0,  1193,     0,  1195,     0,  1196,     0,  1196,     0,
+ 1196,     0,  1197,     0,  1198,     0,  1200,     4,  1202,     0,
+ 1204,     0,  1206,     0,  1207,     0,  1209,     0,  1211,     7,
+ 1214,     0,  1216,     5,  1219,     0,  1222,     8,  1224,    34,
+ 1228,     0,  1230,     1,  1233,     0,  1234,   137,  1238,     4,
+ 1240,     0,  1241,     2,  1243,     1,  1246,     0,  1248,    32,
+ 1252, 16632,  1257,    32,  1261,     4,  1265,    32,  1269,    10,
+ 1273,     0,  1275,     0,  1278,     0,  1279,     0,  1282,     0,
+ 1284,     0,  1285,     1,  1288,     0,  1291,     0,  1293,     0,
+ 1295,     8,  1297,     0,  1300,     9,  1302,     5,  1305,     0,
+ 1307,     0,  1309,     0,  1310,     0,  1311,     0,  1312,     2,
+ 1315,     0,  1318,     0,  1320,     6,  1324,     3,  1327,     0,
+ 1329,     0,  1330,     0,  1331,     2,  1334,    53,  1337,     0,
+ 1339,     0,  1340,     0,  1340,     0,  1340,     0,  1342,     0,
+ 1343,     0,  1344,     0,  1345,     0,  1346,     0,  1347,     0,
+ 1347,     0,  1348,    32,  1351,     1,  1353,     1,  1355,     0,
+ 1356,     0,  1357,     0,  1358,     0,  1359,     0,  1360,     0,
+ 1362,     0,  1365,     0,  1367,     4,  1369,     0,  1370,     0,
+ 1372,     0,  1373,     0,  1374,     0,  1375,     0,  1378,     0,
+ 1380,     4,  1382,     0,  1383,     0,  1383,     0,  1383,     0,
+ 1383,     0,  1384,     0,  1386,     0,  1386,     8,  1388,     9,
+ 1390,     0,  1392,     0,  1394,     0,  1395,     0,  1396,     0,
+ 1396,     0,  1397,     0,  1398,     0,  1398,     0,  1400,     0,
+ 1401,     0,  1403,     0,  1405,     0,  1407,     0,  1407,     0,
+ 1407,     0,  1407,     0,  1407,     0,  1408,     0,  1411,     0,
+ 1411,     0,  1412,     0,  1413,     0,  1413,     0,  1414,     0,
+ 1415,     0,  1415,     0,  1415,     0,  1415,     0,  1416,     0,
+ 1416,     0,  1417,     0,  1418,     0,  1419,     0,  1420,     0,
+ 1423,     0,  1423,     0,  1424,     0,  1425,     0,  1426,     0,
+ 1426,     0,  1426,     0,  1426,     7,  1429,     0,  1429,     4,
+ 1431,     0,  1432,     0,  1434,     0,  1434,     1,  1436,     0,
+ 1437,     5,  1440,     0,  1441,     0,  1442,     0,  1443,     0,
+ 1443,     0,  1443,     0,  1444,     0,  1444,     5,  1446,     0,
+ 1447,     0,  1447,     0,  1447,     0,  1448,     0,  1449,     0,
+ 1450,     0,  1451,    23,  1454,    24,  1456,     0,  1458,    24,
+ 1460,     0,  1462,     0,  1463,     0,  1465,     0,  1466,     0,
+ 1466,     0,  1467,     0,  1467,     0,  1467,     0,  1468,     0,
+ 1468,     0,  1469,     0,  1469,     9,  1471,     0,  1472,     0,
+ 1475,     0,  1475,     8,  1477,     0,  1478,     0,  1480,     0,
+ 1481,     4,  1483,     0,  1483,     0,  1483,     0,  1483,     0,
+ 1484,     0,  1484,     5,  1487,     0,  1488,   534,  1492,     0,
+ 1493,     0,  1495,     0,  1495,     0,  1496,     0,  1498,     0,
+ 1499,    20,  1502,     0,  1503,    58,  1505,     0,  1505,    60,
+ 1507,     0,  1507,    62,  1509,     0,  1510,     0,  1512,    13,
+ 1515,     0,  1517,     0,  1518,     0,  1518,     0,  1519,     0,
+ 1519,     0,  1519,     0,  1520,    16,  1522,     1,  1525,     0,
+ 1526,     0,  1528,    16,  1531,     2,  1534,    52,  1539,     3,
+ 1542,    25,  1547,     0,  1548,    24,  1552,    24,  1555,     4,
+ 1558,    28,  1560,    28,  1562,     0,  1563,     0,  1563,     0,
+ 1564,     0,  1565,     0,  1566,     0,  1566,     0,  1567,     0,
+ 1567,     0,  1567,     4,  1569,     0,  1569,     0,  1570,     0,
+ 1571,     0,  1572,     0,  1573,     0,  1574,     0,  1574,     0,
+ 1575,     0,  1576,     8,  1578,     0,  1579,     8,  1581,     0,
+ 1581,     8,  1583,     0,  1584,     1,  1587,     0,  1588,     0,
+ 1591,     0,  1592,     0,  1594,     0,  1595,     0,  1597,     0,
+ 1598,     0,  1599,     0,  1599,     0,  1599,     0,  1600,     0,
+ 1600,     0,  1600,     0,  1600,     0,  1600,     0,  1600,     0,
+ 1600,     0,  1600,     0,  1601,     0,  1602,     8,  1604,     0,
+ 1605,     0,  1606,     0,  1607,     0,  1607,     0,  1608,     0,
+ 1608,     0,  1609,     0,  1609,     1,  1611,     0,  1612,     0,
+ 1614,     0,  1614,     0,  1615,     0,  1616,     0,  1617,     0,
+ 1620,     0,  1620,     0,  1620,     0,  1620,     0,  1620,     0,
+ 1620,     0,  1621,     0,  1622,     0,  1622,     0,  1622,     0,
+ 1623,     0,  1624,     0,  1625,     0,  1625,     0,  1625,     0,
+ 1625,     0,  1625,     0,  1625,     0,  1625,     0,  1625,     0,
+ 1625,     0,  1625,     0,  1625,     0,  1625,     0,  1625,     0,
+ 1627,     0,  1628,     0,  1629,     0,  1630,     0,  1631,     0,
+ 1631,     0,  1633,     0,  1635,     0,  1636,     0,  1637,     0,
+ 1638,     0,  1639,     0,  1639,     0,  1639,     0,  1639,     0,
+ 1639,     0,  1641,     0,  1643,     0,  1645,     0,  1645,     0,
+ 1646,     1,  1648,     2,  1650,     0,  1651,     0,  1651,     0,
+ 1651,     0,  1651,     0,  1651,     0,  1652,     0,  1652,     0,
+ 1653,     0,  1654,     0,  1655,     0,  1655,     0,  1657,     0,
+ 1659,     0,  1661,     0,  1663,     0,  1664,     0,  1664,     0,
+ 1664,     0,  1664,     0,  1664,     0,  1665,     0,  1665,     0,
+ 1667,     0,  1667,     0,  1669,   258,  1674,    20,  1679,     3,
+ 1682,    18,  1686,     0,  1687,     1,  1691,     0,  1693,     0,
+ 1695,     0,  1696,    24,  1698,     0,  1700,     8,  1703,     8,
+ 1705,    12,  1708,     8,  1710,     8,  1712,    49,  1716,     0,
+ 1718,     1,  1720,    10,  1722,     0,  1723,     0,  1724,     0,
+ 1725,    14,  1727,     0,  1727,     0,  1728,     4,  1731,    16,
+ 1734,     0,  1735,     2,  1738,     0,  1739,     0,  1740,     0,
+ 1741,     0,  1742,     0,  1743,     0,  1743,     0,  1743,     0,
+ 1744,     0,  1745,     0,  1745,     0,  1745,     0,  1746,     0,
+ 1747,     0,  1748,     0,  1748,     0,  1749,     0,  1749,     0,
+ 1749,     0,  1751,     0,  1752,     0,  1752,     3,  1755,     0,
+ 1756,     0,  1758,     0,  1759,     0,  1761,     0,  1764,     0,
+ 1767,     0,  1769,     1,  1772,     0,  1772,     0,  1773,     0,
+ 1773,     0,  1775,     7,  1778,     0,  1780,     2,  1782,     0,
+ 1784,     0,  1786,     4,  1788,     0,  1790,     0,  1792,     0,
+ 1792,     1,  1794,    15,  1797,     7,  1800,     0,  1801,     2,
+ 1803,     0,  1804,     0,  1805,    43,  1809,     4,  1811,    32,
+ 1814,    33,  1817,     3,  1819,     2,  1821,    33,  1824,     0,
+ 1826,    16,  1829,    34,  1833,     0,  1836,     0,  1840,     0,
+ 1841,    10,  1844,     0,  1845,     1,  1847,    12,  1850,    54,
+ 1854,     7,  1857,    32,  1861,    16,  1864,    17,  1867,     3,
+ 1870,     0,  1872,     0,  1874,    12,  1876,     4,  1880,     4,
+ 1885,     0,  1888,    14,  1892,     0,  1894,     4,  1896,     1,
+ 1898,     9,  1901,     0,  1903,    12,  1907,     0,  1908,     5,
+ 1911,     0,  1911,     0,  1913,    17,  1916,     8,  1918,     0,
+ 1919,    20,  1922,     8,  1924,     0,  1925,     0,  1925,     0,
+ 1926,    24,  1930,     0,  1932,     0,  1934,     2,  1937,     0,
+ 1938,     0,  1939,     0,  1940,     0,  1941,     5,  1944,     0,
+ 1945,     0,  1947,     1,  1950,     0,  1952,     0,  1953,     0,
+ 1954,     0,  1955,    38,  1958,     0,  1959,     0,  1961,     0,
+ 1962,     0,  1963,     0,  1964,     0,  1964,     0,  1966,     0,
+ 1967,     0,  1968,     0,  1969,     0,  1970,     0,  1971,     0,
+ 1972,     0,  1973,     0,  1975,     0,  1977,     0,  1978,     0,
+ 1980,     0,  1980,     0,  1981,     0,  1981,     0,  1982,     0,
+ 1982,     2,  1986,     0,  1988,     0,  1989,    20,  1991,    20,
+ 1993,    18,  1996,    17,  1999,     4,  2001,    10,  2005,     8,
+ 2009,     4,  2013,     0,  2014,     2,  2016,     0,  2016,     0,
+ 2016,     9,  2018,   107,  2022,     6,  2024,     2,  2026,     0,
+ 2027,     0,  2029,     1,  2031,     0,  2031,     0,  2032,    34,
+ 2036,     0,  2037,     0,  2040,     1,  2043,     0,  2044,     0,
+ 2044,     0,  2045,     0,  2046,    25,  2049,     8,  2051,     0,
+ 2052,     0,  2053,     0,  2055,     5,  2058,    30,  2061,    46,
+ 2065,    20,  2070,    17,  2075,    16,  2079,     0,  2082,     0,
+ 2083,     0,  2084,     0,  2085,     0,  2085,     0,  2086,     0,
+ 2086,     8,  2088,     0,  2089,     0,  2090,     6,  2093,     4,
+ 2096,    12,  2098,     3,  2101,     0,  2102,     0,  2104,    16,
+ 2106,     0,  2107,     0,  2108,     0,  2109,     0,  2111,     0,
+ 2112,     0,  2115,     0,  2117,     0,  2119,     0,  2120,     0,
+ 2121,     0,  2121,     0,  2122,   386,  2127,     0,  2127,     1,
+ 2130,     0,  2131,    10,  2133,     0,  2133,     0,  2134,     0,
+ 2134,     0,  2136,     2,  2138,     0,  2140,     0,  2143,     4,
+ 2145,     0,  2148,     4,  2150,     5,  2153,    20,  2158,     2,
+ 2161,     4,  2163,     0,  2165,     0,  2166,     1,  2169,     0,
+ 2170,     4,  2172,     0,  2174,     8,  2176,     0,  2177,     0,
+ 2178,     0,  2180,     0,  2181,     0,  2182,     0,  2182,     5,
+ 2185,     0,  2186,     0,  2187,     0,  2189,     0,  2191,     0,
+ 2193,     0,  2194,     0,  2195,     0,  2196,     0,  2197,     0,
+ 2198,     1,  2201,     4,  2203,     4,  2205,    14,  2208,     0,
+ 2210,     2,  2213,     0,  2215,     2,  2218,     0,  2219,     0,
+ 2220,     0,  2221,     0,  2222,     0,  2223,     0,  2224,     0,
+ 2225,     0,  2227,     0,  2228,     0,  2229,     0,  2230,     0,
+ 2231,     0,  2232,     0,  2234,     0,  2234,     0,  2236,     0,
+ 2237,     0,  2238,     0,  2239,     5,  2242,    14,  2246,    10,
+ 2248,    10,  2250,     0,  2251,     0,  2253,     0,  2254,     0,
+ 2256,    30,  2258,     0,  2258,     0,  2260,     0,  2260,     0,
+ 2262,     0,  2262,     0,  2263,     0,  2263,     0,  2264,     0,
+ 2265,     0,  2266,     0,  2267,     0,  2268,     0,  2268,     0,
+ 2269,     0,  2269,    27,  2272,     0,  2273,     6,  2276,     0,
+ 2278,     0,  2281,     0,  2281,     4,  2283,     0,  2284,     0,
+ 2285,     0,  2285,     0,  2287,     0,  2288,     0,  2290,     0,
+ 2291,     4,  2293,     0,  2294,     0,  2296,     0,  2297,    10,
+ 2299,     0,  2301,     2,  2304,     0,  2307,     0,  2308,     0,
+ 2310,     0,  2311,     0,  2312,     3,  2315,     4,  2317,     9,
+ 2319,     4,  2322,     1,  2325,     0,  2327,    56,  2331,     0,
+ 2333,     0,  2336,     0,  2337,     3,  2340,     0,  2341,     0,
+ 2343,     0,  2344,     0,  2345,     0,  2346,     0,  2346,     0,
+ 2346,     0,  2347,     0,  2348,     0,  2349,     0,  2350,     0,
+ 2350,     0,  2351,     0,  2352,     0,  2353,     0,  2354,     0,
+ 2355,     0,  2356,     0,  2357,     2,  2359,     0,  2360,     0,
+ 2361,     0,  2362,     0,  2364,     0,  2364,     4,  2367,     0,
+ 2368,     0,  2369,     0,  2369,   271,  2372,     0,  2373,     0,
+ 2377,     0,  2378,     0,  2379,     0,  2380,     0,  2380,     0,
+ 2380,     0,  2380,     0,  2381,     0,  2383,     0,  2384,     0,
+ 2384,     0,  2385,     0,  2385,     0,  2386,     0,  2386,     0,
+ 2386,     0,  2387,     0,  2387,     0,  2387,     0,  2387,     0,
+ 2387,     0,  2388,     0,  2388,     0,  2389,     0,  2390,     0,
+ 2390,     0,  2391,     0,  2392,     0,  2393,     0,  2394,     0,
+ 2395,     0,  2395,     0,  2395,     0,  2395,     0,  2395,     0,
+ 2395,     0,  2395,     0,  2396,     0,  2396,     0,  2396,     0,
+ 2397,     0,  2398,    35,  2401,     0,  2402,     0,  2403,     0,
+ 2404,    62,  2408,     2,  2410,     0,  2411,     1,  2414,     0,
+ 2415,     0,  2416,     0,  2417,     5,  2419,     0,  2420,     0,
+ 2421,     0,  2422,     0,  2423,     0,  2423,     9,  2425,     0,
+ 2425,     0,  2426,     0,  2428,     0,  2429,     0,  2431,     0,
+ 2431,     0,  2433,     0,  2435,     1,  2438,     2,  2441,     2,
+ 2444,     4,  2446,     5,  2449,     0,  2450,     0,  2451,     0,
+ 2452,     0,  2453,     0,  2454,     0,  2455,     0,  2455,     0,
+ 2456,     0,  2457,     0,  2458,     0,  2459,     0,  2460,     0,
+ 2462,     0,  2464,     0,  2465,     0,  2466,     0,  2467,     0,
+ 2468,     0,  2469,     0,  2470,     0,  2470,     0,  2473,     0,
+ 2473,     2,  2475,    12,  2477,     4,  2479,     0,  2481,     0,
+ 2482,     0,  2483,     0,  2484,     0,  2485,     0,  2486,     0,
+ 2489,     0,  2492,     2,  2495,     0,  2495,     0,  2496,     0,
+ 2496,     0,  2497,     0,  2498,     8,  2500,  4096,  2503,  1300,
+ 2507,     0,  2507,     0,  2507,     0,  2508,     0,  2510,   100,
+ 2514,     1,  2517,    32,  2520,     5,  2523,     0,  2524,     0,
+ 2525,     0,  2526,     0,  2529,    12,  2531,     0,  2533,    73,
+ 2537,     0,  2540,     8,  2542,     0,  2543,     0,  2543,     0,
+ 2543,     0,  2544,     0,  2544,     0,  2544,     0,  2544,     0,
+ 2544,     0,  2545,     0,  2545,     0,  2545,     0,  2545,     0,
+ 2545,     5,  2547,     0,  2548,     0,  2550,     0,  2551,     0,
+ 2552,     0,  2552,     0,  2552,     0,  2553,     0,  2554,     0,
+ 2555,     0,  2556,     0,  2557,     0,  2558,     0,  2559,     0,
+ 2560,     0,  2560,     2,  2562,     0,  2564,   108,  2567,     2,
+ 2569,    22,  2571,    16,  2573,     0,  2574,     0,  2575,     0,
+ 2575,     0,  2576,     0,  2577,     0,  2578,     9,  2580,     5,
+ 2582,     6,  2586,     0,  2587,    15,  2591,    14,  2593,   114,
+ 2597,    12,  2599,     0,  2600,     0,  2601,     0,  2602,     0,
+ 2603,     7,  2605,     6,  2607,     0,  2608,     0,  2610,     3,
+ 2613,     2,  2615,     1,  2618,     0,  2619,    10,  2621,     0,
+ 2621,     8,  2623,     0,  2624,     1,  2628,     1,  2630,     0,
+ 2634,     0,  2637,     0,  2640,     0,  2641,     0,  2643,     0,
+ 2644,     9,  2646,     0,  2647,    10,  2649,     0,  2650,   264,
+ 2654,     0,  2655,     1,  2658,     0,  2659,     8,  2661,     4,
+ 2664,     0,  2667,   289,  2671,     1,  2675,     0,  2676,     9,
+ 2678,     0,  2680,     5,  2683,     4,  2685,     0,  2687,     0,
+ 2688,     0,  2690,     0,  2691,     0,  2693,     0,  2694,     0,
+ 2695,     0,  2695,     0,  2696,     0,  2697,     0,  2697,     0,
+ 2697,     0,  2697,     0,  2697,     0,  2698,     0,  2698,     8,
+ 2700,     0,  2700,     8,  2702,     0,  2702,     0,  2703,     0,
+ 2703,     0,  2703,     0,  2704,     0,  2704,     0,  2705,     0,
+ 2706,     0,  2707,     0,  2707,     0,  2707,     0,  2708,     0,
+ 2708,     0,  2709,     0,  2709,     0,  2710,     0,  2710,     0,
+ 2711,     0,  2711,     0,  2711,     0,  2711,     0,  2712,     0,
+ 2712,     0,  2712,     0,  2712,     0,  2712,     0,  2712,     0,
+ 2713,     0,  2713,     0,  2714,     8,  2716,     0,  2718,     0,
+ 2719,     3,  2722,     0,  2723,     0,  2723,     0,  2723,    16,
+ 2725,     0,  2726,    16,  2728,     0,  2729,     0,  2729,     0,
+ 2730,     0,  2730,     0,  2731,     0,  2732,     0,  2733,     1,
+ 2735,     0,  2735,     0,  2735,     0,  2735,     0,  2735,     0,
+ 2735,     0,  2735,     0,  2736,     0,  2736,     0,  2736,     0,
+ 2736,     0,  2736,     0,  2737,     0,  2737,     0,  2738,     0,
+ 2738,     0,  2739,     0,  2740,     0,  2741,     0,  2742,     0,
+ 2743,     0,  2744,     0,  2745,     0,  2745,     0,  2746,     0,
+ 2746,     0,  2746,     0,  2746,     0,  2747,     0,  2748,     0,
+ 2749,     0,  2749,     0,  2750,     0,  2751,     0,  2752,     0,
+ 2752,     4,  2754,     0,  2755,     0,  2756,     0,  2757,     0,
+ 2758,     0,  2758,    16,  2760,     0,  2760,    14,  2762,     0,
+ 2763,    12,  2765,     0,  2766,    10,  2768,    10,  2770,     0,
+ 2770,     0,  2770,     0,  2770,     0,  2770,     0,  2770,     0,
+ 2770,     0,  2770,     0,  2770,     0,  2771,     0,  2771,     0,
+ 2772,     0,  2773,     0,  2776,    36,  2779,     0,  2781,     0,
+ 2782,     0,  2782,     0,  2782,     0,  2783,     0,  2785,     0,
+ 2786,     0,  2787,     0,  2787,     0,  2788,     0,  2789,     0,
+ 2791,     0,  2791,     0,  2793,    14,  2795,     4,  2797,     5,
+ 2799,     6,  2801,     0,  2802,     0,  2804,    24,  2807,     6,
+ 2810,     3,  2812,     0,  2814,     0,  2815,    15,  2818,     8,
+ 2820,     0,  2821,    12,  2823,     0,  2824,     0,  2826,     0,
+ 2826,    12,  2828,     0,  2829,    13,  2831,     0,  2831,     0,
+ 2832,     0,  2833,     0,  2833,     0,  2834,     0,  2834,     0,
+ 2835,     0,  2836,     0,  2837,     0,  2838,     0,  2840,     0,
+ 2841,     0,  2843,     0,  2844,     0,  2846,     0,  2847,     0,
+ 2849,     0,  2851,    24,  2853,     0,  2855,     0,  2857,     0,
+ 2857,     0,  2857,     0,  2858,     0,  2858,     0,  2858,     0,
+ 2858,     0,  2858,     0,  2858,    12,  2860,     0,  2860,     0,
+ 2860,     0,  2861,     0,  2862,    12,  2864,     0,  2864,     0,
+ 2865,     0,  2865,     0,  2866,     0,  2867,     0,  2868,     0,
+ 2868,     0,  2869,     0,  2870,     0,  2871,     8,  2873,     0,
+ 2874,     0,  2875,     0,  2875,     0,  2877,     0,  2878,     0,
+ 2879,     0,  2879,     0,  2880,     0,  2881,     0,  2881,     0,
+ 2882,     0,  2882,     0,  2882,     0,  2883,     0,  2883,     0,
+ 2886,     0,  2887,     0,  2888,     0,  2889,     0,  2890,     0,
+ 2890,     0,  2891,     0,  2892,     0,  2892,     0,  2892,     0,
+ 2892,     0,  2892,     0,  2893,     0,  2893,     0,  2894,     0,
+ 2894,     0,  2895,     0,  2895,     0,  2895,     0,  2896,     0,
+ 2896,     0,  2897,     5,  2899,    38,  2902,     7,  2904,     0,
+ 2905,     8,  2907,     0,  2908,     0,  2910,     1,  2913,     0,
+ 2915,     0,  2916,     3,  2918,     0,  2919,     1,  2921,     2,
+ 2924,    30,  2927,     0,  2928,     2,  2930,     0,  2930,    26,
+ 2933,     0,  2934,     0,  2935,     0,  2935,    13,  2937,     0,
+ 2938,     0,  2939,     0,  2940,     9,  2942,     0,  2944,    24,
+ 2947,     0,  2948,     5,  2950,     6,  2952,     0,  2953,     0,
+ 2954,     0,  2956,     0,  2957,     0,  2959,     4,  2961,    20,
+ 2963,    22,  2967,    33,  2971,    25,  2974,     0,  2975,     0,
+ 2976,     5,  2978,     0,  2978,     0,  2979,     0,  2979,     4,
+ 2981,     0,  2982,     0,  2983,     0,  2984,     0,  2986,     0,
+ 2987,     0,  2988,     0,  2989,     1,  2991,    14,  2994,     0,
+ 2996,     0,  2997,     2,  2999,     0,  3001,     0,  3002,     0,
+ 3002,     0,  3003,     0,  3005,     0,  3007,     0,  3009,     0,
+ 3011,     0,  3012,     0,  3013,     0,  3013,     0,  3014,     0,
+ 3014,     0,  3015,     0,  3015,     0,  3015,     0,  3016,     0,
+ 3017,     0,  3018,     0,  3018,     0,  3018,     0,  3018,     0,
+ 3018,     0,  3018,     0,  3018,     0,  3019,     0,  3020,     0,
+ 3021,     0,  3021,     0,  3022,     0,  3023,     8,  3025,    16,
+ 3027,    35,  3030,    16,  3032,     0,  3035,     0,  3036,     0,
+ 3037,     0,  3038,     0,  3038,     0,  3040,     0,  3042,     0,
+ 3044,     0,  3046,     2,  3048,     0,  3049,     0,  3050,     0,
+ 3051,     0,  3051,     0,  3052,     0,  3052,     0,  3055,     1,
+ 3058,     0,  3059,     0,  3060,     0,  3060,     0,  3060,     0,
+ 3061,     8,  3063,     1,  3065,     8,  3067,    17,  3070,     0,
+ 3071,     0,  3073,    12,  3075,     0,  3076,     0,  3077,    53,
+ 3081,     0,  3081,     8,  3083,     0,  3083,     0,  3083,     0,
+ 3083,     0,  3085,     8,  3088,    36,  3093,    10,  3096,     0,
+ 3098,    32,  3102,    32,  3105,     0,  3106,     0,  3108,     0,
+ 3110,     0,  3112,     1,  3115,     1,  3117,     4,  3120,     0,
+ 3122,     0,  3124,     0,  3126,    24,  3129,     0,  3132,     0,
+ 3133,     3,  3135,     0,  3136,     0,  3136,     0,  3137,     0,
+ 3138,     0,  3138,     0,  3139,   258,  3143,   323,  3148,   256,
+ 3151,     1,  3154,     0,  3154,     4,  3156,     0,  3158,     0,
+ 3160,     0,  3161,     0,  3161,     0,  3162,     0,  3163,     0,
+ 3164,     0,  3166,     0,  3168,    16,  3170,     0,  3171,     0,
+ 3172,     0,  3173,     0,  3173,     0,  3173,     0,  3175,    34,
+ 3177,     0,  3178,     0,  3179,     0,  3180,     0,  3181,     0,
+ 3181,     0,  3182,     0,  3183,     0,  3184,     0,  3184,     0,
+ 3186,     0,  3186,     0,  3187,     0,  3187,     0,  3187,     0,
+ 3188,     0,  3189,     0,  3190,     0,  3191,    19,  3193,     0,
+ 3194,     0,  3195,     0,  3196,     0,  3198,     0,  3199,     0,
+ 3200,     0,  3202,     0,  3203,     0,  3204,     0,  3204,     0,
+ 3205,     0,  3206,    33,  3209,     0,  3211,     0,  3212,     0,
+ 3212,     0,  3213,     0,  3213,     0,  3214,     0,  3214,     0,
+ 3215,     0,  3215,     0,  3216,     0,  3216,     0,  3216,     0,
+ 3217,     0,  3218,     0,  3220,     6,  3222,     0,  3224,     4,
+ 3226,     0,  3226,     0,  3227,     0,  3228,     0,  3228,     0,
+ 3229,     0,  3230,     0,  3230,     0,  3230,     0,  3230,     0,
+ 3230,    14,  3232,     0,  3232,    31,  3235,    56,  3239,     4,
+ 3241,     4,  3243,     0,  3244,     0,  3245,     0,  3245,     0,
+ 3247,     0,  3247,     0,  3248,     0,  3249,     0,  3250,     0,
+ 3251,     0,  3251,     0,  3253,     0,  3254,     0,  3256,    53,
+ 3260,     9,  3262,     0,  3263,     0,  3264,     0,  3265,     8,
+ 3267,     0,  3268,     0,  3268,     0,  3268,     0,  3268,     0,
+ 3268,     0,  3268,     0,  3268,     0,  3268,     0,  3268,     0,
+ 3270,   100,  3275,     2,  3277,  1045,  3280,     0,  3281,     0,
+ 3282,     0,  3282,     0,  3282,     0,  3282,     0,  3282,     0,
+ 3283,     0,  3284,     0,  3286,     0,  3287,     0,  3287,     0,
+ 3287,     0,  3288,    18,  3291,     0,  3292,     0,  3293,     0,
+ 3293,     0,  3293,     0,  3293,     0,  3293,     0,  3293,     0,
+ 3293,     0,  3293,     0,  3293,     0,  3293,     0,  3293,     0,
+ 3293,     0,  3293,     0,  3293,     2,  3295,     0,  3295,     0,
+ 3296,     0,  3297,     0,  3297,     0,  3297,     0,  3297,     0,
+ 3297,     0,  3297,     0,  3298,     0,  3298,     0,  3298,     0,
+ 3300,     1,  3302,     2,  3304,     0,  3305,     0,  3306,     0,
+ 3306,     0,  3306,     0,  3306,     0,  3306,     0,  3306,     0,
+ 3306,     0,  3306,     0,  3306,     0,  3306,     0,  3307,     0,
+ 3307,     0,  3307,     0,  3307,     0,  3307,     0,  3307,     0,
+ 3308,     0,  3308,     2,  3310,     0,  3310,     0,  3311,     0,
+ 3311,     4,  3313,    12,  3315,     0,  3316,     0,  3318,     0,
+ 3318,     0,  3318,     0,  3318,     0,  3318,     0,  3318,     0,
+ 3318,     0,  3319,     0,  3319,     0,  3320,     0,  3320,     0,
+ 3320,     0,  3321,     0,  3321,     0,  3321,     0,  3321,     0,
+ 3321,     0,  3321,     0,  3321,     0,  3321,     0,  3322,     0,
+ 3322,     0,  3322,     0,  3323,     0,  3323,     0,  3324,     0,
+ 3324,     0,  3325,     0,  3325,     0,  3326,     0,  3326,     0,
+ 3326,     0,  3326,     0,  3326,     0,  3326,     0,  3326,     0,
+ 3326,     0,  3326,     0,  3327,    12,  3330,     0,  3332,    24,
+ 3335,     0,  3337,     0,  3338,     0,  3340,     0,  3341,     0,
+ 3343,     0,  3345,     0,  3346,     0,  3346,     0,  3347,     0,
+ 3347,     0,  3348,     0,  3348,     0,  3350,    10,  3353,     0,
+ 3353,     0,  3355,     0,  3355,     0,  3356,     0,  3356,     0,
+ 3357,     0,  3357,     0,  3359,     0,  3359,     0,  3361,     0,
+ 3362,     0,  3364,     0,  3365,     0,  3366,     0,  3368,    30,
+ 3370,     0,  3372,    28,  3374,     8,  3376,     0,  3377,     0,
+ 3378,     0,  3379,     0,  3380,     0,  3381,     0,  3382,     0,
+ 3383,     0,  3383,     0,  3383,     0,  3383,     0,  3383,     0,
+ 3383,     0,  3384,     0,  3384,     0,  3387,     0,  3387,     0,
+ 3388,     0,  3388,     0,  3389,     0,  3389,     0,  3390,     0,
+ 3390,     0,  3390,     0,  3390,     0,  3390,     0,  3390,     0,
+ 3390,     0,  3390,     0,  3391,     0,  3391,     3,  3393,     0,
+ 3393,     0,  3394,     0,  3394,     0,  3395,     0,  3395,     0,
+ 3396,     0,  3396,     0,  3396,     0,  3396,     7,  3398,     0,
+ 3400,     0,  3401,     0,  3402,     3,  3404,     0,  3406,     0,
+ 3408,     0,  3410,     0,  3411,     0,  3412,     6,  3414,     0,
+ 3415,     0,  3416,     0,  3416,     0,  3416,     0,  3417,     8,
+ 3419,     0,  3420,     0,  3420,     0,  3421,     0,  3423,     1,
+ 3425,     0,  3425,     0,  3425,     0,  3426,     0,  3427,     0,
+ 3427,     0,  3427,     0,  3427,     0,  3427,     0,  3427,     0,
+ 3427,     0,  3427,     0,  3428,     0,  3429,     0,  3430,     0,
+ 3431,     0,  3432,     0,  3434,     0,  3434,     0,  3434,     0,
+ 3436,    14,  3438,    28,  3440,     1,  3443,   265,  3447,   524,
+ 3451,     0,  3454,     0,  3455,     0,  3457,     0,  3459,     0,
+ 3462,     0,  3464,     0,  3466,     0,  3468,    10,  3472,     0,
+ 3476,     1,  3479,     0,  3481,     0,  3484,     8,  3488,     0,
+ 3490,     9,  3493,     0,  3495,    12,  3497,     0,  3498,     5,
+ 3500,     4,  3502,     3,  3505,     4,  3507,    34,  3511,    33,
+ 3514,     8,  3517,     0,  3518,     0,  3520,     0,  3522,     0,
+ 3525,     0,  3527,     0,  3530,    52,  3534,    30,  3538,     3,
+ 3541,     1,  3544,     0,  3546,     0,  3548,     0,  3549,     5,
+ 3552,     0,  3553,     0,  3555,     1,  3559,     0,  3561,     0,
+ 3562,    14,  3564,     0,  3565,    10,  3567,     1,  3570,    14,
+ 3572,     0,  3573,     0,  3576,     0,  3577,     0,  3578,     0,
+ 3581,     2,  3583,     0,  3585,     0,  3587,    69,  3592,     0,
+ 3594,    52,  3598,     1,  3601,     0,  3602,    28,  3604,     0,
+ 3605,     0,  3606,     0,  3608,     0,  3608,     9,  3611,     0,
+ 3614,     0,  3615,     1,  3618,     0,  3618,     0,  3619,     3,
+ 3622,     4,  3624,     0,  3625,     4,  3627,     0,  3628,     0,
+ 3629,     0,  3631,     0,  3632,     0,  3634,     0,  3635,     0,
+ 3636,     0,  3636,     0,  3636,     0,  3637,     0,  3637,     0,
+ 3637,     0,  3639,     0,  3640,     0,  3644,     0,  3647,     2,
+ 3649,     0,  3651,     0,  3652,     4,  3654,     0,  3655,     2,
+ 3657,     0,  3658,     0,  3660,     0,  3661,    49,  3665,     0,
+ 3665,     0,  3666,     0,  3668,     2,  3670,    12,  3672,    32,
+ 3676,     0,  3678,    32,  3682,     0,  3683,     1,  3685,     0,
+ 3687,     0,  3690,     0,  3692,     0,  3693,     0,  3695,     0,
+ 3696,     0,  3696,     0,  3697,     0,  3699,     0,  3700,    28,
+ 3702,    20,  3705,    25,  3707,    59,  3711,     0,  3713,     0,
+ 3714,     0,  3715,     0,  3716,     2,  3718,     2,  3720,     0,
+ 3721,     0,  3722,     0,  3723,     0,  3725,     4,  3728,     0,
+ 3729,     1,  3732,     0,  3735,     0,  3736,     0,  3737,     0,
+ 3739,    37,  3742,     4,  3744,     0,  3744,     0,  3744,     0,
+ 3745,     0,  3746,     0,  3747,     0,  3748,     0,  3749,     0,
+ 3750,     0,  3751,     0,  3752,     0,  3753,     0,  3753,     0,
+ 3754,     0,  3755,     0,  3756,     0,  3757,     0,  3759,     0,
+ 3759,     1,  3762,     0,  3763,    11,  3765,     0,  3765,     0,
+ 3766,     0,  3767,     0,  3769,     0,  3770,     0,  3771,     2,
+ 3773,     0,  3775,     0,  3778,     0,  3781,     1,  3784,    13,
+ 3786,     0,  3786,     0,  3787,     0,  3788,     0,  3789,     0,
+ 3789,     0,  3789,     0,  3789,     0,  3789,     0,  3789,     0,
+ 3790,     0,  3790,     0,  3791,     0,  3792,     0,  3793,     0,
+ 3794,     0,  3795,     0,  3796,     0,  3797,     0,  3797,     0,
+ 3798,     0,  3799,     0,  3799,     0,  3801,     0,  3803,     0,
+ 3804,     0,  3805,     0,  3805,     0,  3806,     0,  3807,     0,
+ 3809,     0,  3810,     0,  3811,     0,  3812,     0,  3813,     0,
+ 3813,     0,  3814,     0,  3814,     0,  3814,     0,  3814,     0,
+ 3814,     0,  3815,     0,  3816,     0,  3816,     0,  3817,     6,
+ 3819,     0,  3820,     0,  3820,     0,  3821,     0,  3821,     0,
+ 3822,     0,  3822,     0,  3823,     0,  3823,     0,  3824,     0,
+ 3825,     0,  3827,     0,  3828,     0,  3828,     0,  3828,     0,
+ 3828,     0,  3828,     0,  3828,     0,  3828,     0,  3828,     0,
+ 3829,     0,  3830,     0,  3831,     0,  3833,     0,  3834,     0,
+ 3835,     0,  3837,     0,  3839,     0,  3839,     0,  3840,     0,
+ 3842,     0,  3844,     0,  3846,     0,  3846,     0,  3847,     0,
+ 3848,     0,  3848,     0,  3849,     0,  3849,     0,  3850,     0,
+ 3850,     0,  3851,     0,  3852,     0,  3852,     0,  3853,     0,
+ 3854,     0,  3855,     0,  3856,     0,  3857,     0,  3857,     0,
+ 3857,     0,  3857,     0,  3858,     0,  3860,     0,  3860,     4,
+ 3863,     5,  3866,     0,  3867,     0,  3868,     0,  3868,     0,
+ 3869,     0,  3869,     0,  3869,     0,  3869,     0,  3869,     0,
+ 3869,     0,  3869,    10,  3871,    24,  3873,    12,  3875,     0,
+ 3877,     0,  3880,     0,  3881,     0,  3882,     0,  3883,     0,
+ 3884,     0,  3884,     0,  3885,     0,  3886,     0,  3887,     0,
+ 3888,     0,  3888,    24,  3890,     0,  3891,     0,  3891,     0,
+ 3892,     0,  3893,     0,  3894,     0,  3895,     0,  3895,     0,
+ 3896,     0,  3896,     0,  3897,    10,  3900,     0,  3902,     0,
+ 3904,     0,  3905,     0,  3905,     0,  3906,     1,  3909,     0,
+ 3910,     0,  3911,     0,  3913,     4,  3915,     2,  3917,     0,
+ 3918,     0,  3920,     0,  3921,     0,  3923,     4,  3925,     0,
+ 3927,     4,  3929,     0,  3931,     0,  3932,     0,  3933,     0,
+ 3934,     0,  3935,     0,  3936,     1,  3938,     0,  3939,     0,
+ 3940,     0,  3941,     0,  3943,     0,  3944,     8,  3946,     0,
+ 3948,     8,  3950,     0,  3951,    12,  3953,     0,  3954,     5,
+ 3957,     0,  3958,     0,  3959,     0,  3960,     0,  3961,     0,
+ 3963,     0,  3964,     0,  3964,     0,  3966,     0,  3967,     0,
+ 3970,     0,  3972,     0,  3974,     0,  3974,     0,  3975,     1,
+ 3977,     5,  3979,     0,  3981,     0,  3981,     0,  3981,     3,
+ 3983,     8,  3985,     0,  3986,     0,  3986,     0,  3986,     0,
+ 3986,     0,  3987,     0,  3987,     0,  3988,     0,  3989,     0,
+ 3990,     0,  3991,     0,  3992,     0,  3993,     0,  3995,     0,
+ 3997,     0,  3999,     0,  4002,     1,  4004,     0,  4004,     0,
+ 4004,     0,  4004,     8,  4006,     0,  4007,     0,  4009,     9,
+ 4011,     0,  4013,    11,  4015,     0,  4016,     0,  4018,     0,
+ 4018,     0,  4019,     2,  4021,     3,  4023,     0,  4024,     0,
+ 4025,     0,  4027,     0,  4028,     0,  4031,     0,  4034,    25,
+ 4037,     0,  4038,     0,  4039,   531,  4042,     0,  4043,     6,
+ 4045,     0,  4046,     1,  4049,     0,  4052,     0,  4054,    16,
+ 4056,     0,  4057,     0,  4058,     0,  4059,     0,  4060,     0,
+ 4061,    16,  4063,     0,  4064,     0,  4065,     0,  4066,     0,
+ 4067,     0,  4068,     0,  4069,     0,  4070,     0,  4073,     4,
+ 4075,     4,  4077,     0,  4078,     0,  4079,     0,  4081,     0,
+ 4081,     0,  4081,     0,  4081,     0,  4081,     0,  4081,     0,
+ 4081,     0,  4081,     0,  4082,     0,  4082,     0,  4082,     0,
+ 4082,     0,  4082,     0,  4083,     0,  4083,     0,  4083,     0,
+ 4083,     0,  4084,     0,  4084,     0,  4084,     0,  4084,     0,
+ 4085,     0,  4086,     0,  4087,     0,  4088,     0,  4089,     0,
+ 4090,     0,  4090,     0,  4091,     0,  4091,     0,  4091,     0,
+ 4092,     0,  4092,     0,  4093,     0,  4094,     0,  4095,     0,
+ 4095,     0,  4095,     0,  4095,     0,  4095,     0,  4095,     0,
+ 4095,     0,  4095,     0,  4096,     0,  4097,     0,  4097,     0,
+ 4097,     0,  4099,     0,  4100,     0,  4101,     4,  4103,     0,
+ 4104,     0,  4105,     0,  4105,     0,  4106,     0,  4107,     0,
+ 4107,     0,  4108,     0,  4109,     0,  4110,     0,  4111,     0,
+ 4113,     8,  4115,     0,  4115,    12,  4117,     0,  4117,    12,
+ 4119,     0,  4120,     0,  4122,     7,  4125,     0,  4125,     2,
+ 4127,     0,  4129,     0,  4130,     0,  4131,     0,  4132,     3,
+ 4135,     4,  4138,    48,  4142,     0,  4143,     0,  4145,    32,
+ 4148,     8,  4150,     0,  4153,     1,  4156,     0,  4157,     0,
+ 4158,     0,  4158,     0,  4158,     0,  4158,     0,  4159,     0,
+ 4161,     7,  4166,     0,  4168,     0,  4172,     9,  4174,     0,
+ 4176,    16,  4178,     0,  4180,     0,  4180,    12,  4182,     0,
+ 4183,    12,  4185,     0,  4186,     8,  4189,     0,  4189,     0,
+ 4190,     0,  4190,     4,  4192,     0,  4192,     0,  4192,     0,
+ 4193,     0,  4194,     0,  4195,     6,  4197,     0,  4198,     0,
+ 4199,     8,  4201,    10,  4203,     0,  4204,     9,  4206,     0,
+ 4206,     0,  4206,     0,  4206,     0,  4207,     0,  4207,     0,
+ 4208,     0,  4208,     0,  4210,     0,  4211,     2,  4213,     0,
+ 4213,     1,  4216,     0,  4217,     0,  4218,     0,  4218,     0,
+ 4218,     0,  4218,     0,  4218,     0,  4218,    15,  4220,    16,
+ 4222,     0,  4223,    16,  4225,     0,  4226,     0,  4226,     0,
+ 4227,     0,  4227,     0,  4227,     0,  4227,     0,  4228,     0,
+ 4229,     0,  4230,     0,  4230,     0,  4230,     0,  4231,     0,
+ 4232,     0,  4232,     0,  4233,     0,  4234,     0,  4235,     0,
+ 4236,     5,  4239,     4,  4241,     0,  4243,     8,  4245,     0,
+ 4245,     0,  4246,     0,  4246,     0,  4246,     0,  4246,     0,
+ 4246,     0,  4247,     0,  4247,     0,  4247,     0,  4247,     0,
+ 4247,     0,  4247,     0,  4247,     0,  4247,     0,  4247,     0,
+ 4248,     0,  4248,     0,  4249,     0,  4250,     0,  4251,     0,
+ 4251,     0,  4251,     0,  4252,     0,  4252,     0,  4253,     0,
+ 4253,     0,  4254,     0,  4255,     0,  4256,     0,  4257,     0,
+ 4258,     0,  4259,     0,  4259,    10,  4261,     0,  4261,     0,
+ 4264,     0,  4265,     8,  4268,     9,  4271,     0,  4273,     0,
+ 4273,     0,  4273,     0,  4273,     0,  4275,     0,  4275,    14,
+ 4277,     0,  4278,    15,  4281,     8,  4283,    12,  4285,     0,
+ 4286,     0,  4288,     0,  4290,     0,  4292,    15,  4295,     0,
+ 4297,     0,  4298,     0,  4299,     0,  4301,     4,  4303,     1,
+ 4306,     0,  4307,     0,  4308,     0,  4309,     0,  4311,     0,
+ 4312,     0,  4314,     0,  4315,     0,  4316,     1,  4319,     6,
+ 4322,    17,  4325,     4,  4327,     0,  4330,     2,  4333,     4,
+ 4335,     0,  4338,     0,  4340,     0,  4341,     0,  4342,     0,
+ 4342,     0,  4343,     0,  4344,     0,  4344,     0,  4344,     0,
+ 4345,     0,  4346,     0,  4346,     0,  4347,     0,  4347,     0,
+ 4348,     0,  4349,    10,  4352,     0,  4352,     3,  4354,     0,
+ 4354,     0,  4354,     0,  4354,     0,  4356,     0,  4356,     0,
+ 4356,     0,  4357,     0,  4357,     0,  4357,     0,  4357,     0,
+ 4357,     0,  4357,     0,  4357,     0,  4357,     0,  4357,     0,
+ 4358,     0,  4358,     0,  4359,     0,  4360,    19,  4363,     0,
+ 4364,     0,  4365,     0,  4365,     0,  4366,     0,  4366,     0,
+ 4366,     0,  4367,     0,  4367,     0,  4367,     0,  4368,     0,
+ 4369,     0,  4370,     0,  4371,     0,  4371,     0,  4371,     0,
+ 4372,     0,  4372,     0,  4372,     0,  4372,     0,  4373,     0,
+ 4373,     0,  4373,     0,  4374,     0,  4374,     0,  4374,     0,
+ 4376,     0,  4377,     0,  4378,     0,  4378,     0,  4380,     0,
+ 4380,     0,  4381,     0,  4381,     0,  4381,     0,  4381,     0,
+ 4381,     0,  4382,     0,  4382,     0,  4382,     0,  4383,     0,
+ 4384,     0,  4387,     0,  4389,     0,  4389,     0,  4389,     0,
+ 4390,     0,  4391,     0,  4392,     0,  4392,     0,  4392,     0,
+ 4392,     0,  4393,     0,  4394,     0,  4394,     0,  4395,     0,
+ 4396,     0,  4397,     0,  4399,     0,  4400,     0,  4400,     0,
+ 4402,     4,  4404,     0,  4406,     0,  4407,     0,  4408,     0,
+ 4408,     0,  4408,     0,  4410,     0,  4411,     0,  4412,     0,
+ 4412,     0,  4414,     0,  4414,     0,  4415,     0,  4415,     0,
+ 4416,     0,  4416,     0,  4418,     0,  4419,     0,  4421,     0,
+ 4421,     0,  4422,     0,  4422,     0,  4422,     0,  4424,     0,
+ 4424,     0,  4425,     0,  4425,     0,  4425,     0,  4425,     0,
+ 4426,     0,  4427,     0,  4428,     0,  4431,     4,  4433,     5,
+ 4435,     0,  4436,     0,  4437,     0,  4439,     0,  4439,     0,
+ 4439,     0,  4439,     0,  4439,     0,  4439,     0,  4439,     0,
+ 4439,     0,  4439,     0,  4439,     0,  4439,     0,  4439,     0,
+ 4439,     0,  4440,     0,  4440,     0,  4440,     0,  4440,    11,
+ 4442,     0,  4443,     0,  4444,     0,  4444,     0,  4444,     0,
+ 4445,     8,  4447,     0,  4447,     0,  4448,     0,  4448,     0,
+ 4448,     0,  4449,     0,  4450,     0,  4450,     0,  4450,     0,
+ 4450,     0,  4450,     0,  4451,     0,  4451,     0,  4451,     0,
+ 4451,     0,  4451,     0,  4452,     0,  4452,     0,  4453,     0,
+ 4453,     0,  4454,     0,  4455,     0,  4455,     0,  4456,     0,
+ 4457,     0,  4458,     0,  4459,     0,  4459,     0,  4459,     0,
+ 4459,     0,  4459,     0,  4461,     3,  4463,     0,  4465,     0,
+ 4468,     0,  4468,     0,  4470,    12,  4472,    12,  4475,     0,
+ 4476,     1,  4478,     2,  4480,     4,  4483,     0,  4483,     0,
+ 4485,     0,  4486,     0,  4488,     0,  4488,     0,  4489,     2,
+ 4491,     0,  4492,     0,  4492,     0,  4492,     0,  4492,     0,
+ 4493,     0,  4494,     0,  4495,    17,  4497,    16,  4499,     2,
+ 4501,     0,  4502,     0,  4503,    23,  4507,    62,  4510,     8,
+ 4513,     0,  4516,     1,  4519,     5,  4521,     0,  4522,     0,
+ 4522,     3,  4524,     0,  4527,     0,  4528,     0,  4529,     0,
+ 4531,     0,  4533,    15,  4536,     0,  4538,    40,  4542,     0,
+ 4543,     1,  4546,     0,  4548,    11,  4552,     8,  4554,   136,
+ 4558,     0,  4559,    11,  4562,    17,  4565,     8,  4568,    73,
+ 4573,     0,  4575,     1,  4578,     0,  4581,     1,  4584,     1,
+ 4587,     2,  4590,     3,  4592,    21,  4597,    17,  4601,   549,
+ 4605,  4098,  4609,     4,  4612,  4096,  4616,     2,  4619,     2,
+ 4621,   266,  4625,     1,  4628,    10,  4630,    10,  4632,    56,
+ 4636,  4099,  4640,     1,  4643,     0,  4646,     0,  4650,     1,
+ 4654,     3,  4658,     6,  4662,    56,  4667,    56,  4671,  4146,
+ 4675,     5,  4678,     0,  4680,     2,  4682,     1,  4685,    21,
+ 4689,     0,  4691,     0,  4695,     0,  4696,     0,  4698,     0,
+ 4700,     6,  4702,     0,  4703,     0,  4704,     0,  4704,     0,
+ 4706,     0,  4708,    14,  4711,     0,  4712,     0,  4715,     0,
+ 4716,     0,  4717,     0,  4718,     5,  4721,     0,  4722,     1,
+ 4724,    87,  4728,     9,  4731,     0,  4732,     0,  4734,     0,
+ 4735,    12,  4737,     0,  4738,     0,  4741,     0,  4742,     0,
+ 4744,     1,  4747,     0,  4749,     0,  4751,     0,  4754,     0,
+ 4756,    32,  4760,     0,  4763,     0,  4765,     4,  4767,     0,
+ 4768,     0,  4769,     0,  4769,     0,  4769,     0,  4770,     0,
+ 4772,     0,  4773,     3,  4776,     0,  4777,     1,  4780,     1,
+ 4783,     0,  4785,     0,  4785,     0,  4787,     1,  4790,     0,
+ 4791,     0,  4791,     0,  4791,     0,  4793,     1,  4795,     0,
+ 4797,     0,  4798,     0,  4799,     0,  4800,     1,  4803,     8,
+ 4806,     9,  4809,     4,  4811,     0,  4812,     1,  4814,     0,
+ 4815,     3,  4817,     0,  4818,     0,  4819,     0,  4819,     0,
+ 4820,     0,  4820,     0,  4820,     0,  4820,     0,  4821,     0,
+ 4821,     6,  4823,     0,  4824,     2,  4826,     0,  4826,     0,
+ 4827,     0,  4827,     0,  4828,     0,  4828,     0,  4829,     0,
+ 4830,     0,  4830,     0,  4830,     0,  4830,     0,  4830,     0,
+ 4830,     0,  4830,     0,  4831,     0,  4832,     0,  4832,     0,
+ 4832,     0,  4832,     0,  4833,     0,  4833,     0,  4833,     0,
+ 4833,     0,  4833,     0,  4833,     0,  4833,     0,  4834,     0,
+ 4835,     0,  4835,     0,  4835,     0,  4836,     0,  4836,     0,
+ 4836,     0,  4836,     0,  4836,     0,  4837,     0,  4837,     0,
+ 4838,     0,  4839,     0,  4840,     0,  4840,     0,  4840,     0,
+ 4840,     0,  4840,     0,  4841,     0,  4841,     0,  4841,     0,
+ 4841,     0,  4841,     0,  4841,     0,  4841,     0,  4841,     0,
+ 4841,     0,  4841,     0,  4841,     0,  4841,     0,  4842,     0,
+ 4843,     0,  4843,     0,  4843,     0,  4843,     0,  4844,     0,
+ 4844,     0,  4845,     0,  4846,     0,  4847,     0,  4847,     0,
+ 4847,     0,  4847,     0,  4848,     0,  4849,     0,  4850,     0,
+ 4851,     0,  4851,     0,  4852,     0,  4852,     0,  4852,     0,
+ 4852,     0,  4852,     0,  4852,     0,  4853,     0,  4854,     0,
+ 4856,     0,  4858,     0,  4858,     9,  4860,     0,  4861,     0,
+ 4862,     0,  4863,     0,  4863,     0,  4864,     3,  4866,     0,
+ 4867,     4,  4869,     0,  4870,     0,  4871,     0,  4871,     0,
+ 4872,     0,  4872,    31,  4874,     0,  4874,     0,  4875,     0,
+ 4875,     0,  4876,     0,  4877,     0,  4878,     0,  4879,     0,
+ 4880,     0,  4880,     0,  4881,     0,  4882,     0,  4884,     0,
+ 4885,     0,  4886,     0,  4889,     1,  4892,     0,  4894,    32,
+ 4897,     0,  4898,     0,  4899,    24,  4901,     8,  4903,     8,
+ 4905,     8,  4907,     0,  4908,    12,  4910,     0,  4911,    14,
+ 4914,     0,  4915,     0,  4916,     0,  4918,     0,  4920,     0,
+ 4921,     0,  4922,     0,  4923,     0,  4924,     0,  4925,     0,
+ 4925,     0,  4926,     0,  4927,     0,  4928,     1,  4931,     0,
+ 4932,     0,  4933,     0,  4934,     0,  4935,     0,  4937,     0,
+ 4938,     0,  4939,     0,  4941,     0,  4942,     0,  4943,     4,
+ 4945,     0,  4946,     8,  4948,     0,  4950,     0,  4951,     0,
+ 4951,     2,  4953,     0,  4953,     0,  4953,     0,  4954,     0,
+ 4954,    16,  4956,     0,  4956,     0,  4956,     0,  4956,     0,
+ 4957,     6,  4960,     0,  4960,     0,  4961,     0,  4962,     0,
+ 4963,     0,  4963,     0,  4963,     0,  4963,     0,  4964,     0,
+ 4965,     0,  4966,     0,  4968,     0,  4968,     0,  4968,     0,
+ 4968,     0,  4969,     0,  4972,     0,  4973,     0,  4973,     0,
+ 4974,     0,  4974,     0,  4975,     0,  4975,     0,  4976,     0,
+ 4977,     8,  4979,     0,  4981,     2,  4984,     0,  4986,     8,
+ 4988,     0,  4989,     0,  4990,     2,  4993,     0,  4994,     0,
+ 4995,     0,  4996,     0,  4997,     8,  4999,     7,  5002,     0,
+ 5004,     0,  5005,    17,  5008,     8,  5010,     4,  5013,     0,
+ 5014,     8,  5016,     0,  5017,     9,  5019,     0,  5020,    13,
+ 5023,     0,  5024,     3,  5026,     0,  5027,     0,  5028,     0,
+ 5030,    13,  5033,     0,  5033,     0,  5035,     0,  5037,     0,
+ 5038,     0,  5039,     0,  5040,     0,  5040,     0,  5041,    12,
+ 5044,    20,  5046,     0,  5048,     0,  5050,     0,  5051,     0,
+ 5052,     0,  5054,     0,  5055,     0,  5056,     0,  5057,     0,
+ 5057,     0,  5057,     0,  5057,     0,  5057,     0,  5058,     0,
+ 5058,     0,  5059,     0,  5060,     0,  5060,     0,  5060,     0,
+ 5060,     0,  5060,     0,  5060,     0,  5060,     0,  5060,     0,
+ 5061,     0,  5061,    14,  5063,     0,  5064,     0,  5065,     0,
+ 5066,     0,  5066,     0,  5067,     0,  5067,     0,  5067,     0,
+ 5067,     0,  5068,     0,  5069,     0,  5070,     0,  5070,     0,
+ 5070,     4,  5073,     0,  5074,    16,  5076,     0,  5076,     0,
+ 5076,     0,  5077,     0,  5077,     0,  5078,     0,  5078,     0,
+ 5078,     0,  5078,     0,  5078,     0,  5079,     0,  5080,     0,
+ 5081,     0,  5083,     0,  5084,     0,  5084,     1,  5086,     0,
+ 5086,     0,  5087,     0,  5087,     0,  5088,     1,  5090,     0,
+ 5090,     0,  5090,     0,  5091,     0,  5092,     0,  5093,     0,
+ 5093,     0,  5093,     4,  5095,     0,  5096,     0,  5096,     4,
+ 5098,     0,  5098,     0,  5100,     0,  5101,     0,  5101,     0,
+ 5102,     0,  5103,     0,  5103,     0,  5103,     0,  5104,     0,
+ 5105,     0,  5105,     0,  5105,     0,  5106,     0,  5107,     0,
+ 5107,     0,  5108,     0,  5109,     0,  5110,     8,  5112,     0,
+ 5113,     0,  5114,     0,  5116,     0,  5117,     0,  5117,     0,
+ 5117,     0,  5117,     0,  5117,     0,  5117,     0,  5117,     0,
+ 5118,     0,  5119,     6,  5122,     0,  5123,     0,  5124,     0,
+ 5125,     0,  5125,     5,  5128,    32,  5131,     4,  5133,     0,
+ 5134,     8,  5136,     9,  5139,     0,  5141,     0,  5143,     0,
+ 5144,     0,  5145,     0,  5146,     0,  5147,     0,  5148,     0,
+ 5148,     0,  5148,     2,  5150,    19,  5154,     1,  5157,     0,
+ 5160,     0,  5163,     9,  5165,     0,  5167,     0,  5168,     0,
+ 5169,     0,  5170,     0,  5171,     0,  5172,     0,  5172,     4,
+ 5174,     0,  5175,     0,  5176,     0,  5176,     7,  5179,     0,
+ 5180,     0,  5182,     0,  5183,     0,  5185,     0,  5187,     0,
+ 5189,     0,  5190,     0,  5191,     0,  5192,     0,  5193,     0,
+ 5194,     0,  5195,     0,  5196,     0,  5196,     0,  5196,     6,
+ 5198,     8,  5200,     0,  5201,     0,  5203,     4,  5205,     0,
+ 5206,     0,  5207,     0,  5208,     0,  5209,     0,  5210,     0,
+ 5211,     1,  5213,     0,  5215,     0,  5217,     0,  5218,     0,
+ 5220,    15,  5223,     0,  5224,     1,  5227,    14,  5230,     7,
+ 5233,     0,  5234,     0,  5235,     0,  5236,     0,  5237,     0,
+ 5237,     0,  5238,     0,  5238,     0,  5238,     0,  5239,    14,
+ 5241,     0,  5242,    22,  5245,     0,  5245,     2,  5247,     3,
+ 5249,     0,  5250,     0,  5250,     0,  5252,     0,  5253,     0,
+ 5253,     0,  5253,     0,  5256,     0,  5258,     0,  5259,     0,
+ 5259,     0,  5261,     0,  5262,     0,  5262,    12,  5264,     8,
+ 5266,     0,  5267,     1,  5270,     0,  1637,  1046,  2755,  3478,
+ 1638,  1639,  1045,  3479,  1640,  1641,  3480,  4472,  1642,  1643,
+  321,  3481,   322,  2765,  1644,  1040,  1042,  1645,  3482,  1041,
+ 2766,  3483,  1646,  1647,  1648,   722,  1649,   373,  1039,   721,
+  720,  1038,   323,   372,   324,   371,  5265,  2764,  1650,  1651,
+ 1652,  1037,  3484,  4238,  2094,  2095,  1653,  1654,  2096,  3485,
+ 1655,  2026,  1036,  2097,  5235,  1602,  1656,  2098,  3486,  1601,
+  374,   724,  5236,  1600,  1657,  5237,  1658,   377,  1659,  5238,
+  325,   723,   376,   727,  1604,   326,   726,   375,  1603,  2769,
+  725,  2768,  2290,  1660,   381,  1035,  2099,   728,  1661,   380,
+ 1662,  2100,  1663,  2101,  1606,  1664,  2102,   379,  1605,  1665,
+ 2103,  1666,  2104,   378,   859,  1667,  2288,   858,  2289,  1668,
+  327,  1669,  1881,   328,   861,   329,  2286,   860,  2287,   330,
+ 2285,   863,  2767,  2284,  4875,   862,  1670,  4876,  1671,  2105,
+ 4877,  1672,  2106,  4878,  1673,  1674,   319,  1675,  1676,   850,
+ 5151,  1677,  4417,   851,  1678,   848,   849,   331,  5152,  1679,
+  853,   332,  5079,   333,   383,   852,   334,   382,   855,  2291,
+  854,  1680,  2107,  1596,  1681,   857,  1595,  1682,   856,  1598,
+ 1683,  1684,  2108,  5153,  1597,  1685,  1686,  1687,   335,  1996,
+  336,  1599,  2761,  1997,  1688,  2109,  1689,  4791,  2110,  1690,
+ 1691,  4792,  1692,  1693,  4719,  1694,  1695,   864,  1696,  2271,
+  337,   338,  4072,  1998,   339,   340,  4073,   341,   342,  2270,
+  343,  4793,  2111,  2112,  2113,   820,  2114,   819,  2269,  1992,
+  822,  1991,  4074,  1422,  1421,   821,  1420,  2268,  2762,   824,
+ 2267,   823,  5132,   826,  2763,  2283,   825,  1383,  2282,  2281,
+  818,  2280,  1416,  1994,  2278,  1415,  1993,  2279,  1414,  2277,
+ 4927,  1419,  1995,  4926,  2276,  4577,  4925,  1418,  1417,  4924,
+ 1382,  1381,  1413,   837,  2275,   835,   836,  2273,  1408,  4578,
+ 1391,   839,  1985,  2274,  4772,  1984,  1393,   838,  1392,  2506,
+  842,  1395,  1412,  3393,  1394,   843,  1411,  2272,  2507,  1410,
+  840,   841,  1396,  1409,  2508,   846,   847,  2509,   844,  2510,
+  845,  2511,   828,   827,  1989,  1988,  4343,  1987,   830,  4579,
+ 1986,   829,  4580,  2512,   832,  2513,  3394,  1990,  2514,  2256,
+  831,  2515,   834,  4344,   833,  1379,   717,   716,  4581,  2255,
+ 1981,  1980,  2516,  1807,  1808,  1809,  1810,  4345,  1407,  1811,
+ 4346,   719,   718,  1983,  4582,  1982,  2266,  1380,  2265,  1697,
+ 1117,  1376,  4386,  1698,  1375,  1699,  4347,  1700,  1374,  4385,
+ 1701,  1373,  4384,  1702,   712,  2264,  1703,   711,  4383,  1704,
+ 1378,  2262,   710,  1377,  4390,  2263,  1405,  2261,  4389,  1404,
+  713,  2259,  4388,  2260,  1116,  1115,  1406,  2257,  4387,  1705,
+ 2258,  1114,  1588,  2115,  2116,  1706,  1707,  2117,  2118,  4348,
+ 1587,  1708,  1591,  1709,  1590,  2119,  1589,  1710,  1711,   715,
+ 2120,   714,  1592,  3299,  1110,  2121,  1109,  1712,  1108,  2122,
+ 1107,  1713,  1594,  2123,  1113,  1714,  1112,  1593,  2124,  1111,
+ 1715,  2125,  3300,  1106,  2126,  1102,  1101,  1100,  2127,  1581,
+ 1105,  2128,  4522,  1104,  1103,  5243,  2129,  5242,  5241,  1582,
+ 1099,  5240,  1098,  1093,  1092,  1948,  1091,  2130,  1090,  1584,
+ 1097,  1096,  4523,  1583,  1095,  1094,   708,  1089,   707,  1585,
+ 1088,   706,  1586,  4288,  1083,  4883,  1082,  1081,  4882,  2131,
+ 1080,  1579,  4881,  4880,  1087,  1086,  1578,  1085,  2027,  1084,
+ 2028,  2930,  1079,  1833,  3413,  2929,  1078,   709,  4075,  2928,
+ 2320,  4076,  4934,  4077,  2321,  4078,  2318,  4289,  4935,  2319,
+ 4936,  4079,  3414,  1073,  2931,  1072,  1071,  4937,  1077,  4080,
+ 1076,  1075,  4081,  4082,  1074,  1580,  4083,  4084,  4085,  4086,
+ 4087,  4938,  4088,  2317,  2655,  4089,  2656,  2657,  4090,  2658,
+ 4091,  2659,  4092,  2660,  4093,  2661,  2662,  5154,  2663,  3415,
+ 2664,  5090,  2665,  5089,  2666,  5088,  2667,  2668,  2669,  2670,
+ 2671,  2672,  1577,  3416,  4939,  2525,  2673,  2674,  4794,  4940,
+ 4730,  4729,  4728,  2526,  3417,  2527,  2528,  4941,  4942,  2529,
+ 2530,  4943,  2531,  4032,  2532,  2533,  4033,  2534,  2535,  4034,
+ 2536,  4035,  4036,  2537,  2538,  4037,  4038,  2539,  4039,  2540,
+ 3418,  4040,  4944,  4945,  4946,  4947,    14,  4948,    13,  4949,
+ 4950,  5053,  2316,  4041,  4583,  2314,  4538,  2315,  1828,  4584,
+ 4585,  2312,  1827,  4042,  1826,  2313,  4586,  1825,  4931,  2311,
+ 1829,  2310,  3419,  1437,  4587,  2309,  1436,  4588,  1435,  2307,
+ 1434,  2517,  4589,  2308,  1441,  2518,  1832,  2519,  1440,  1831,
+ 2305,  4693,  2306,  1439,  1830,  2189,  1438,  2190,  2187,  2188,
+ 1433,  2520,  1432,  1947,  1946,  4349,  1945,  4304,  4350,  2186,
+ 4351,  4352,  1428,  2293,  4043,  1431,  2292,  4044,  1430,  2191,
+ 1429,  2192,  2195,  2196,    12,  4353,  1427,  4354,  2193,  2521,
+ 4355,  2194,  3420,  2522,  2523,  4045,  1167,  4046,  1166,    31,
+ 1165,  1164,  4047,  1170,  1169,    32,    33,  4576,  1426,  1168,
+ 2304,    34,  2303,  1163,  2302,  1162,  1425,  1424,  2301,  4048,
+ 1157,    35,  2300,  1156,  1155,    36,    37,  1161,  1716,    38,
+   39,  1160,  1159,    40,  1158,    41,  4049,    42,  3421,    43,
+ 1423,  2298,  2299,  2296,    44,  2297,  4342,   793,    45,  2294,
+  792,  1151,    46,  2295,   795,  1150,    47,   794,  2132,    48,
+  797,  1154,    49,   796,  1153,  1152,  4100,  4101,    50,  1149,
+ 4102,  3301,  3302,  3303,  3304,  4050,    51,    52,  1147,    53,
+ 1146,    54,  1145,  1148,    55,    56,  1144,   751,   750,  1143,
+ 5035,  5036,  5037,    57,  1138,  5038,    58,  1137,    59,  1136,
+ 1142,  4521,  1141,  1140,  1139,  5239,   753,  1135,  1134,   752,
+ 4051,    60,  1129,    61,    62,    63,  1128,  1823,    64,  1133,
+ 1132,    65,  1131,  4675,    66,  1130,    67,  4676,  4677,  3392,
+ 4678,   746,  4951,  4287,  4052,  4952,    68,    69,  1126,    70,
+   71,  1125,  2133,  1824,   747,  4879,  1127,  2134,    72,    73,
+  749,   748,  4094,  4953,  4095,  4053,    74,  1120,  1119,  1118,
+ 1124,  1123,  1122,  1121,  4096,  4097,  4054,    75,    76,    77,
+ 3127,  3128,  5087,  5086,  5085,  5084,  4055,    78,  1815,    79,
+ 1814,    80,    81,  4932,  2654,    82,    83,  4056,  1819,  4057,
+ 1818,  1817,  1816,  4058,  4059,  1822,  4727,  1821,  4726,  4447,
+ 1820,  4725,  4724,  1952,  4060,  4061,  4448,  2652,  4062,  1951,
+ 2648,  2649,  2650,  4063,  4213,  4449,  4064,  2651,  4065,  4450,
+ 2653,  4214,  4490,  4451,  4489,  4488,  4487,  4494,  4493,  1950,
+ 4215,   742,  4492,  4216,  4491,  2524,  4452,  1949,  4256,   744,
+ 4217,   743,  4255,  4254,   745,  4253,  4260,  1812,  4259,  1813,
+ 4258,  4257,  4218,   740,    84,  2357,    85,  2355,  3342,  2356,
+   86,    87,    88,    89,    90,    91,    92,    93,    94,    95,
+  741,    96,    97,    98,    99,   100,   101,   102,   103,  1385,
+  104,   105,  1384,  1717,   106,  1718,  1387,   107,  1719,  1210,
+ 4392,  1720,  1209,  1386,  5043,  1456,  1455,  5042,  5041,  1389,
+ 1454,  5040,  1388,  1453,  1204,   108,  1203,   109,  3343,  1202,
+  110,   111,  1201,  2135,   112,  1448,  1208,  1207,  1447,  1446,
+ 1206,  1205,  1445,  1452,  1721,  1451,  5094,  4393,  1200,  1450,
+ 5095,  3305,   739,  1449,  1199,  5096,  2136,  1443,  1442,  5097,
+ 1893,  1194,  1444,  1193,  1192,  1892,  3344,  1722,  1198,  1197,
+ 2137,  1196,  2138,  1894,  4612,  4683,  1723,  1195,  4682,  2139,
+ 4681,  4680,  1191,  2140,  3306,  5098,  2141,  1891,  1190,  3345,
+ 1889,  1619,  1189,  1890,  2142,  1618,  3346,  4734,  4735,  1617,
+ 4613,  3347,  4736,  5250,  5249,  1622,  4737,  5248,  1621,  1724,
+ 1620,  3307,  1188,  1623,  3348,  1725,  1187,  1186,  1726,  4738,
+ 1624,  1185,  1184,   733,  2628,  2627,   732,   731,  1183,  2626,
+ 5099,  2625,   730,  1182,  2630,  4954,   735,  1625,  2629,   734,
+ 5100,  4890,  1895,  1177,  4889,  4888,  1176,  1181,  1612,  1180,
+ 1179,  1611,  1178,   738,  1614,   737,  5101,   736,  2947,  1175,
+ 1613,  1174,  2946,  5102,  2945,  5103,  4098,  1615,  2950,  2949,
+ 2948,  3349,  2143,  1173,  4739,  2951,  2144,  2145,  1172,  1616,
+ 2146,  1171,  2147,  2148,  2149,  4740,  5104,  3308,  5105,  5106,
+ 5107,   212,  5108,   211,  5109,  2415,  5110,  2151,  5213,  2416,
+ 4741,   210,  2152,  4742,  2417,  4743,  2418,   209,  3438,  3439,
+ 2419,  3440,  3309,  3310,  3311,  5091,  3312,  3441,  3313,   216,
+  217,  3442,  3443,   215,  3444,  4744,  1607,  4745,   214,  3445,
+ 4746,  3446,  4747,   213,  3447,  2420,  1609,  3350,  1608,  3351,
+ 3352,  4748,   221,   489,  3353,   490,   220,   491,  4749,  4750,
+ 1610,   486,  4853,   218,   219,   487,  2421,   488,  1853,  2422,
+  482,  1852,   483,  1851,  1463,  4453,   484,  2423,  4408,   485,
+ 3448,  1464,  4454,  1465,   478,  4455,  2424,  4456,   479,  3449,
+ 1466,  1467,  4731,   480,  2425,  1468,   481,  3450,  1854,   496,
+ 1469,  1470,  3451,   497,  1471,  1472,  3452,   498,  3453,  1473,
+ 1474,  1475,  2426,   494,  1476,  4457,   495,  1896,  2427,  1477,
+ 4458,  2428,  1478,  1479,  4459,  3454,  1480,  2429,   492,  3455,
+ 1481,   493,  1482,  1483,  3456,  1484,  1485,  1486,  2361,  1487,
+ 2150,  1488,  4219,  1953,  4220,  1489,  1490,  2430,  4221,   908,
+ 1491,  4222,   909,  2431,   202,  1492,  1493,  3457,  1494,  1944,
+ 3458,   201,   499,  3459,   500,   501,  4223,  1495,   244,  4224,
+  203,  4225,  2432,  2433,  1496,  2434,  1850,  2435,  1497,  3460,
+ 1498,  3461,  3462,  1499,  1500,  1501,  1502,  4446,  1459,   245,
+ 1503,  1390,   246,   204,   247,  1458,   248,  2436,  2437,   249,
+  250,  2438,   251,  1504,  1505,  2439,   205,  2440,  2441,  1506,
+ 1507,   252,   206,   253,   207,   254,  2442,   255,   256,  1508,
+ 3354,  2029,  4212,   208,  1509,  5195,  1510,  1511,  5196,  5197,
+ 1512,   257,  5198,   113,  3355,  1888,  2443,  2444,  2445,  2446,
+ 2447,   258,  1457,  2360,  2818,  2358,  2359,  4835,  3356,  4836,
+ 4837,  4838,  4391,   424,  5111,  5112,   425,   426,  5039,   422,
+  114,   423,   115,   420,   116,  3357,  2153,   421,  2154,   419,
+ 5113,   439,   440,   435,   436,   437,   438,   431,  3358,  1883,
+ 2155,   432,   433,  4751,  2156,   434,   427,  4752,   428,   429,
+ 4679,   430,   772,   445,  2819,   443,  3359,  2157,  4753,   444,
+ 3360,  3361,   441,  5247,  5246,   442,  5245,   455,  5244,   453,
+ 1220,  3362,   454,  1219,  1218,   450,  3363,  1887,   451,   452,
+ 5092,   446,   447,  1221,   448,   449,  2622,   766,  2621,  2620,
+  765,  2624,   768,  2623,   767,  1885,  1886,  4887,  4886,  1884,
+ 4551,   769,  4885,  4884,   456,   771,  2934,   466,   770,  2352,
+ 2933,  2932,  2351,  4552,  2938,   463,  4732,  2937,   464,  2349,
+ 2350,   465,  2448,  2936,  1213,  2449,  1212,  2935,   460,  2450,
+ 2942,  1211,  2348,  2941,  2940,  1217,   461,  2451,   462,  2939,
+ 1216,  2452,  1215,   457,   458,  1214,  2944,   459,  2943,  3340,
+ 4317,  4553,  4554,   200,   469,   198,   199,   467,  4318,   468,
+  476,  3341,   477,  4594,  4555,   474,  4593,   475,  4592,  2453,
+ 4591,  2454,   472,  2455,  2456,   473,  4598,  2457,   470,  4597,
+ 4319,   471,  4596,  4320,  4595,  4556,  2458,  4360,  2459,  4321,
+ 4359,  2460,  4358,  4357,  4364,  4363,  1845,  1844,  1843,  4362,
+ 4361,  2461,  2462,  1846,  2463,  4322,   259,   260,  1849,  1848,
+ 1847,  2810,  1837,  1836,  1835,  1834,   185,   183,  4496,  1838,
+  184,  5203,  5202,  5201,  5200,  1841,  2808,   189,  1840,  1839,
+  188,   187,    18,  2809,  4497,   186,  1842,   192,   190,   191,
+ 4262,  4843,   196,   197,  4842,  4841,   194,   195,  4840,   193,
+ 3006,  3007,  2347,  3008,  2345,  2346,   117,  4894,  2811,  4263,
+  118,  1462,  1264,  3009,  4895,  4896,   119,  1263,    16,  1262,
+ 3010,   120,   121,   122,    15,  4897,  3011,   123,  1461,  3012,
+  124,   125,  3013,   126,   127,  1261,  1260,   128,  3014,   129,
+  314,   315,   130,  3015,   131,   312,   313,   132,   310,   133,
+ 2805,  1255,  1254,   311,  1253,  4898,    17,  1252,  1259,  1258,
+ 1257,  1460,  1256,  3016,  5114,   316,  1251,  3017,   317,  1250,
+ 5050,  3018,  5049,  2158,  5048,  3019,  2804,  3020,  1247,  1249,
+ 1248,  3021,  1246,  3022,  3023,  2807,  4899,  3024,  1245,  4605,
+ 3025,  4754,  4900,  3026,  4690,  4689,  3027,  2643,   763,  4688,
+  762,  3028,  2642,  2641,  1244,  2640,   761,  1243,  2159,   764,
+ 2644,  1238,  2806,  4901,  1237,  4902,  4903,  3633,  4606,  3634,
+ 3635,  1242,  1241,  4607,  3636,  1240,  1239,  3637,  3638,  3029,
+ 5251,  3639,  1236,  3640,  3030,  2645,  3641,  3031,  2160,  3642,
+ 3032,  1231,  4904,  2815,  3643,  4905,  1230,  3644,  1229,  4906,
+ 3645,  1228,  4907,  3646,  1235,  3647,  1234,  1233,  4908,  3648,
+ 3033,  1232,  3649,  3034,  4909,  5013,  4910,  3035,   755,  1227,
+ 3650,  3036,   754,  3037,  1226,  2637,  3038,  2161,   757,  3039,
+ 3040,  3041,   756,  3042,  4557,  3651,  3652,  3043,  4558,  4512,
+ 3653,  4559,  3044,   758,  4560,  3654,  3045,  4891,  3046,  1225,
+ 3655,  3047,  1224,  3656,  1223,  3048,  3657,  3049,  3050,  3658,
+ 3051,   760,  3659,  3052,  2954,  2639,  2953,  2638,  3660,   759,
+ 3053,  3054,  2952,  3661,  4561,  3662,  2162,  3055,  3056,  2956,
+ 4562,  3057,  2817,  2955,  3058,  2464,  4563,  2465,  1222,  2466,
+ 4653,  1964,  3059,  2467,  2468,  3060,  2957,  3061,  2469,  2470,
+ 2959,  3062,  3063,  2958,  4323,  2961,  4324,  4278,  4325,  2960,
+ 4326,  1963,  3663,  2471,   307,  2816,  2472,   308,  3664,  2473,
+ 2474,   306,  3665,  3666,  2475,  3667,  4327,  3668,  2476,   536,
+ 4328,   537,  3669,  4329,   538,  3670,   539,  3671,   540,  3672,
+ 3673,  2477,  2812,  3674,  3675,   309,  3676,  3677,  2478,  3678,
+ 4550,  2479,   541,   542,   543,   544,   545,   546,   547,   548,
+ 1962,  2480,   549,   550,  2481,   551,  2482,  2483,   552,  2206,
+ 2484,  1958,  1880,   553,   554,   555,  2202,  2203,   556,  2204,
+  557,  1961,  2205,   558,  1960,  1959,   559,   560,  2199,  2814,
+ 3679,  4316,  3680,   561,  2200,  2201,   562,  3681,  2485,  5260,
+ 5261,  2486,  2211,  2487,  2212,   563,  2488,  3682,  3683,  2489,
+  564,  3684,  3685,   261,  2209,   262,  2210,  2207,  2208,  2813,
+ 3686,  2490,  2491,  2492,   303,  3687,  2493,  5262,  3688,  3689,
+ 3690,  2220,   565,  2221,  3691,  3692,  1957,  3693,  3694,  3695,
+ 2217,  3696,  4995,  2218,  3697,  2219,   263,  3698,   264,  4996,
+ 2213,  3699,  2214,   265,  4997,  2796,  3395,  2215,   266,  4998,
+ 3700,  2216,   304,   267,  3701,  5263,   268,  3702,   269,   270,
+ 4495,   566,  1954,  5199,  2226,  2227,  1956,  2228,   271,  2229,
+  272,  1955,   273,  2222,  3703,  2795,  2223,  2224,  2225,  3704,
+  815,  5264,  3705,   274,   814,  4635,   813,   567,   568,  4636,
+ 2197,  4637,   569,   570,  4638,   571,   572,  2230,  3706,  4911,
+ 2231,  4261,  2798,   305,  3707,  4912,  3708,  3709,  4839,  3710,
+ 3711,   573,  3064,   574,  3712,   575,  3065,   576,  3713,  3714,
+  577,  3066,   578,  2353,  3715,   579,  2232,  3067,   580,  2797,
+ 4913,   581,  2233,  3716,  3068,  2234,   582,   300,  3717,  3069,
+ 3718,  3719,    24,  3720,  3070,  3721,  3071,  3722,   583,  3723,
+  584,    25,  3724,   585,   586,  3725,   587,  3726,  2792,  3727,
+ 5252,  3728,  3729,  3730,    28,    27,  3731,  3732,    26,  3733,
+ 3734,  3735,  3736,  3737,  3738,    29,  2239,  5047,  3739,  3740,
+ 5046,  2354,  5045,  3741,  2235,  5044,  3742,  2791,  2236,  2237,
+ 3743,  3744,  2238,   301,  3745,  3746,  3747,  3748,  3749,  3750,
+ 3751,  3752,  4892,  3753,  3754,  3755,  3756,  3757,  2794,  3758,
+  302,  3759,  3760,  3761,  3762,  3763,  4687,  5254,  3764,  4421,
+ 4686,  5255,  4685,  3765,  3766,  4684,  3767,  3768,  2636,  3769,
+  370,  4071,  3770,  5256,  2793,  3771,  4422,  3772,  3773,  3774,
+ 3775,  3776,  3777,  3778,  3779,  5257,   297,  3780,   298,  2802,
+ 3781,   296,  4187,  3782,  3783,  4423,   295,  3784,  4424,  3785,
+ 3786,  3787,  2634,  2633,  3788,  2632,  2631,  3789,  4188,   369,
+ 5258,  3790,  3791,  2801,  3792,  3793,  4464,   299,  3794,  4425,
+ 3795,  1278,  4463,  3796,  3797,  4462,  3798,  4461,  1273,  3799,
+ 3364,  3800,  4468,  3801,  1272,  1271,  2635,  4467,  1277,  3802,
+ 4189,  1276,  4466,  4190,  3803,  1275,  5259,  1274,  4465,  3804,
+ 1266,  2803,  3805,  1265,  3806,  4426,  3807,  3808,  1270,  1269,
+ 1268,  1267,  3368,  4230,  4191,  4229,  4228,  3809,  4227,  3810,
+ 4234,  3811,  4233,  3812,  2245,  4232,  3813,  4231,  3369,  3814,
+ 4192,  3815,  2242,   368,  3816,  2244,  2799,  3817,  3818,  4600,
+  294,  2243,  3819,  3820,  3821,  3822,  1874,  1876,  3370,  1875,
+ 1877,  1878,  4601,   811,  1879,  3371,  4366,  5003,  5002,  5001,
+ 5000,   812,  3372,  5054,  1972,  4367,  5055,  5056,   809,   808,
+ 5057,  3823,   807,  2800,   806,  3282,  3824,   805,  3283,  3825,
+ 3826,   804,   803,   802,  4643,  4642,  4641,  4640,  1971,  5058,
+ 3284,  3285,  3827,  1857,  1856,  3828,  1855,  3829,  1861,  1860,
+ 4694,  1859,  4695,  3830,  1858,  4696,   810,  5210,  3831,  1863,
+ 3832,  5209,  3833,  4697,  5208,  1862,  1867,  1866,  1865,  1864,
+ 3834,  3835,  1868,  3836,    21,  3837,  4698,   799,  1967,  3838,
+ 1966,  1965,  5059,  1970,  1969,  1968,  4914,  5060,  3839,  4850,
+ 3840,    23,  4849,  4848,  3841,   801,    22,  3842,   800,  3843,
+ 3072,  3844,  3073,  5061,  2163,  3845,  3074,  5062,  3075,  5063,
+ 2164,  3076,  3077,  2390,  2183,  2391,  2392,  2182,  3396,  2181,
+   19,  2393,  4699,  2394,  3078,  2395,  3373,  2184,  4700,  2396,
+ 5064,  2397,  3079,  2398,  5065,  3374,  2165,  5066,  3080,  5067,
+ 3081,  3846,  2399,  3082,  5068,  3847,  2400,  2401,  5069,  3848,
+ 5070,  3397,  2402,  4701,  5173,    20,  3849,  4702,  4703,  2403,
+ 5051,  1973,  3398,  4704,  4705,  1974,  4706,  4707,  4708,  1975,
+ 4709,  4710,  4813,  1333,  1332,  1331,  3399,  1337,  4427,  1336,
+ 4382,  1335,  4428,  4429,  1334,  1327,  4430,  4691,  1326,  1325,
+ 1324,  1330,  1329,  1328,  1319,  3850,  1341,  1318,  4431,  1342,
+ 1317,  3851,  1316,  1323,  3400,  1343,  4432,  1322,  1344,  1321,
+ 3852,  1345,  4433,  1320,  1346,  1347,  1348,  1349,  1350,  1976,
+ 1351,  1977,  1352,  1978,  1979,  4193,  4194,  1314,  3853,  4195,
+ 1313,  4196,  1312,  3854,  1311,  1353,  3855,  1354,  3856,  1315,
+  776,  1306,  1355,  3857,  1305,   775,  1356,  3858,   774,  1304,
+  773,  1303,  3859,  1310,  3860,  4197,  1309,  1308,  4198,  1307,
+ 1298,  4199,  1297,  1296,  3861,  1295,  1302,  3401,  1357,  3862,
+ 1301,  3863,  1300,  1358,  1299,  1290,  3864,  1289,  3865,  1359,
+ 2970,  1288,  3866,  2969,  1287,  1360,  3867,  1294,  3868,  2968,
+ 4420,  1293,  3869,  1292,  1291,  2973,  1282,  3870,  2972,  1281,
+ 2971,  1280,  3871,  1279,  3872,  1286,  1285,  3873,  1284,  1283,
+ 3874,  3375,  3376,  3875,   293,  3876,  1361,  3877,  1362,  5155,
+ 5156,  5157,  5158,  3878,  4599,  1363,  1364,  3377,  3879,  3880,
+ 4795,  3881,  3882,  1365,  4796,  2180,  3883,  4797,  4798,  3378,
+ 3884,  5071,  4365,  3885,  5072,  4999,  3886,  3887,  3888,  3889,
+ 1366,  5073,  3890,  3891,  3892,  4711,  3893,  4712,  3894,  4639,
+ 3895,  3896,  3897,  3898,  3899,  3900,  4713,  3901,  3902,  5207,
+ 5206,  5205,  5204,  3903,  3904,  1367,  3314,  3905,  3315,  3316,
+ 3906,  3317,  3318,  3907,  5052,  3319,  5268,  3908,  5267,  4847,
+ 3365,  3909,  4525,  4846,  3910,  4845,  3911,  4844,  3912,  4099,
+ 3083,  3913,  3084,  3085,  4526,  3086,  4692,  3087,  2404,  3366,
+ 2405,  2169,  2406,  2168,  2407,  2167,  2408,  2409,  2173,  2410,
+ 2172,  3914,  2411,  2412,  3088,  2171,  2170,  2413,  3089,  2414,
+ 2176,  3090,  2175,  4291,  2174,  4527,  3091,  4528,  3915,  3092,
+ 3367,  3916,  2179,  3917,  2178,  3918,  2177,  4292,  3093,  2166,
+ 4568,  4529,  4567,  3919,  4566,  3920,  3921,  4565,  3922,  3923,
+ 4572,  3924,  3925,  4571,  3926,  3927,  4293,  4570,  3094,  3928,
+ 4294,  4569,  3929,  4530,  3402,  1368,  4334,  4295,  4333,  1369,
+ 4332,  4331,  5269,  4338,  4337,  3930,  4336,  3931,  1370,  4335,
+ 3932,  4296,  3933,  3934,  3935,  3936,  3937,  3938,  3939,  3940,
+ 1339,  3403,  1340,  3941,  1338,  3942,  2647,  2646,  3943,  3944,
+ 3404,  4470,  5163,  5162,  2963,  2379,  2962,  5161,  5160,  2380,
+ 2377,  2378,  2967,  2966,  2965,  3945,  2381,  2964,  3255,  2382,
+ 3946,  3256,  3257,  3947,  3258,  3259,  3948,  5214,  3260,  4471,
+ 3261,  3949,  5215,  5216,  3950,  3262,  3263,  3951,  5217,  2383,
+ 2384,  3952,  3264,  4236,  3953,  4803,  3954,  4802,  2374,  4801,
+ 3265,  4800,  3955,  3266,  3956,  3267,  3268,  5218,  3957,  2820,
+ 3958,  2821,  2822,  2371,  2823,  2824,  2373,  3959,  2825,  4237,
+ 2372,  3269,  4854,  2826,  3270,  4855,  3960,  3271,  4856,  2827,
+ 3961,  3962,  3963,  4857,  3964,  2828,  3965,  2829,  2830,  2375,
+ 2831,  2376,  2832,  3966,  1399,  3272,  3967,  1398,  4858,  3273,
+ 3968,  3274,  3275,  3969,  3276,  5219,  3277,  3278,  2833,  5074,
+ 2834,  2835,  5220,  5010,  2836,  2837,  5009,  5008,  3970,  3971,
+ 3972,  5221,  5222,  5223,  3973,  4859,  3974,  3975,  4714,  3976,
+ 4860,  5224,  4650,  3977,  5225,  4649,  5226,  4648,  2838,  5227,
+ 3978,  2839,  2840,  5228,  5229,  3979,  3980,  5230,  4861,  3981,
+ 3982,  4862,  4863,  3983,  3984,  3985,  3986,  3987,  3988,  2841,
+ 2030,  5211,  2842,  2031,  2843,  2844,  3989,  4864,  3538,  3990,
+ 4865,  4866,  3539,  4867,  3991,  2845,  3540,  2032,  3992,  4868,
+ 3541,  3993,  4869,  2846,  4973,  4870,  3994,  2847,  3995,  2033,
+ 2848,  3542,  2849,  4531,  3543,  2850,  1727,  4532,  4486,  3544,
+ 1728,  4533,  4534,  1729,  4851,  3545,   817,  1730,  3546,  1731,
+ 2034,   816,   791,  1732,  1733,  3095,   789,  1734,   790,  3096,
+ 3547,  3548,   787,  3549,   788,  3097,  4535,  2252,   786,  3098,
+ 4536,  1735,  3550,  1736,  2254,  1737,  4537,  2253,  3551,  3552,
+ 1738,    30,  3553,  3554,  2851,  2852,  4297,  3555,  2249,  3556,
+ 2248,  2853,  4252,  4298,  2854,  4299,  2247,  2855,  4300,  2246,
+ 2251,  2856,  2857,  3557,  3558,  2250,  3559,  3560,  3561,  3562,
+ 4301,  3563,  3564,  3099,  3100,  4302,  3101,  4303,  3102,  3103,
+ 1739,  3565,  1740,  1741,  3566,  1742,  3567,  3568,  4524,  3104,
+ 3569,  3105,  3106,  1743,  3570,  3571,  3572,  1371,  3573,  3574,
+ 3575,  3576,  3577,   782,  3578,   780,   781,  3579,   778,   779,
+  777,  1744,  1745,  3996,  3580,  4290,  3997,  3581,  3582,  3583,
+ 3584,  3585,   783,  1746,  3998,  1747,  3586,  1748,  3999,  1749,
+ 3587,  1750,  1751,  1752,  1753,  1754,  4955,   784,  4956,  4000,
+ 1755,  4957,  3588,  4001,  1756,  4958,  4002,  4003,  3589,  4004,
+ 4005,  4469,  5231,  5232,  2983,  5159,  2982,  2986,   785,  2362,
+ 2985,  1757,  2984,  3590,  4006,  1758,  1759,  4007,  4008,  4009,
+ 4010,  4011,  1372,  5233,  4012,  1760,  4013,  3591,  4235,  1761,
+ 4871,  4014,  1762,  4872,  1763,  4015,  1764,  4799,  2858,  2859,
+  226,  2860,  2861,  4016,  3592,  4873,  4017,  4018,  4019,  3593,
+ 5212,  2366,  2365,  2364,  2369,  5007,  2368,  5006,  2367,  5005,
+ 5004,  3594,  4852,  3595,   417,  3596,  3597,  4647,  3598,  4646,
+ 4395,  4645,   418,  4644,  3599,  4396,  3600,  4186,  3601,  4397,
+ 4398,  3602,  1765,  3603,  1766,  3379,  4438,  1767,  4399,  3604,
+ 1768,  4437,  1769,  1770,  4436,  1771,  1772,  4435,  1773,  1774,
+ 3107,  4442,  4441,  4440,  4439,  1775,  3380,  3605,  1776,  3606,
+ 4400,  3607,  3608,  3108,  3609,  3109,  3610,  4204,  3110,  3611,
+ 4203,  3111,  1777,  4202,  3612,  1778,  1779,  4201,  3613,  1780,
+ 4208,  1781,  1782,  4207,  2370,  4206,  3112,  4205,   405,  3614,
+ 3615,  4574,   401,   402,   403,   404,  3616,  3617,  4575,  3618,
+ 3619,  3620,  4340,  2240,  4963,  2241,  4962,  4961,  4960,  4020,
+ 3621,  4021,  4022,  3622,  3623,  4023,  4024,  4025,  4026,  3224,
+ 4027,  4028,  5014,  5015,  4341,  5016,  4029,  4030,  5017,   399,
+ 4031,   400,  3225,  5018,  1882,  2683,  2684,  2685,   408,  2686,
+ 4654,  3226,  5234,  4655,  4656,  2687,  5170,  2688,   228,  5169,
+ 3227,  2689,  2976,  5168,  2690,  4657,  2975,  2974,  2691,  3228,
+ 2692,  2980,  3229,  2693,  2979,  2978,  2694,  3230,  2695,  2977,
+  410,  2696,   174,   409,   177,   412,  3231,  2697,  2698,   176,
+  411,  2981,  2699,   175,   414,  2700,   413,   416,  4658,  2701,
+ 2702,   180,   889,   415,   179,  2703,   890,  2704,   178,  5019,
+ 3406,  2705,   887,  2706,  2707,   888,  2708,   171,  4874,  5020,
+  170,  2709,   169,  4810,   406,   168,  2710,  4809,   173,  2711,
+  891,  4808,  2712,  2713,   172,  2714,  2715,  2567,  2568,  2716,
+  882,  2717,  2569,   883,  2570,  2718,  2571,  5021,  2719,  3407,
+ 2572,  5022,   880,  2720,  5023,  2573,  2721,  2722,   881,  2574,
+ 2723,  2575,  2862,  2724,  2863,  2725,   407,  2864,  2726,   884,
+ 2727,   886,  3232,  4659,  2728,   885,  2729,  2576,  2577,   877,
+ 2578,  4660,   878,  3408,   875,  5024,  5025,   874,  5026,  2730,
+  876,  5027,  2731,  2732,  5028,  2385,  2733,  2386,   161,  5029,
+ 2387,  2388,  5030,  5133,  3233,  2389,  4661,   162,  4662,   879,
+ 4663,   164,  2579,   868,   163,  2580,   867,  2581,  2582,   869,
+  866,   865,  4590,  2583,  2584,  5011,  2865,  2585,   872,  2866,
+ 2867,  2868,   165,   873,   870,  3234,  4664,   166,   871,  4665,
+ 4666,   167,  4667,  2869,  2870,  4668,  2871,  2872,  4669,  2873,
+ 4670,  4773,   156,   157,  4401,  4402,  4356,  2586,  4403,   907,
+ 4404,   906,  2587,  2588,  4651,  2874,  2589,  2875,   904,  2876,
+ 2877,   905,  2878,  2879,  3624,  2880,  2881,  2882,  4405,   158,
+ 3625,  4406,  3235,  2035,   159,  4407,  2036,  2590,  2037,  2591,
+  160,   901,  2883,  2592,  2038,  2593,  2884,   902,  2885,  2886,
+  899,  2887,  2039,   900,  2040,  2888,  2889,  2041,  2890,  2891,
+ 2042,   152,   903,  2043,  3236,  2044,  2045,  2594,  2595,  2046,
+  895,  2596,  2047,  2597,  2892,   896,  2048,   893,  2893,   892,
+ 2049,   894,  2050,  1783,  3626,   898,   154,   153,  3627,  3628,
+  897,  3237,  2051,   155,  2052,  2053,  3238,  2598,  2054,  3113,
+ 2599,  3239,  3114,  3240,   227,  4394,  2894,  3115,  3241,  2895,
+ 3629,  2896,  2897,  2363,  3409,  2055,  2056,  2600,  3156,  3155,
+ 2898,  3158,  2899,  3157,  2900,  3630,  2901,  3160,  2902,  2903,
+ 3159,  3162,  2057,  3161,  2058,  2059,  3164,  2060,  5115,  3163,
+ 2061,  2062,  5116,  3167,  5117,  3166,  2063,  5118,  2904,  2064,
+ 3165,  2905,  3631,  3632,  4573,  3139,  3138,  3143,  3142,  3141,
+ 3140,  3146,  3145,  3144,  4755,  4756,  3148,  3147,  4757,  4758,
+ 3150,  3149,  5031,  4339,  3152,  5032,  3151,  4959,  3154,  3153,
+  318,  3130,  3129,  5033,  3133,  3132,  3131,  3135,  3134,  3137,
+ 4671,  3320,  3136,  4672,  2734,  2735,  2736,   149,  2737,  2738,
+ 2739,  2740,  4673,   150,  2741,  5167,  5166,  2997,  2996,  5165,
+ 5164,  2995,  3000,  2999,  2998,   151,  3001,  5012,  2601,  2602,
+ 3004,  3003,  3002,  2742,   146,  3005,  2743,   145,  4807,  2744,
+ 4499,  4806,  4805,  4804,  2745,  4500,  2746,  2906,  4652,  2747,
+  148,  2748,  2907,  2908,   147,  2749,  2909,  2910,  2911,  2912,
+ 2913,  2914,  2915,  2916,  4265,  2917,  4501,  4502,  2918,   140,
+ 2919,  2920,  2921,  2922,  4163,  4266,   142,  4162,  4161,   141,
+ 4165,  4542,  4503,   232,  4164,  4541,   144,  4167,  4540,   143,
+ 4166,  4171,  4539,  4170,  4169,  4546,  4168,  4175,  4545,  4267,
+ 4174,  4173,  4544,  4268,  4172,  4178,  4543,  4177,  4176,  4504,
+ 4182,  4181,  1873,  4180,  4179,  1872,  4185,  1871,  4184,  4183,
+ 4147,  4308,  4269,  4146,  4145,  4307,  2198,  4151,  4306,  4150,
+ 3286,  4149,  4305,  4148,  4312,   137,  4311,   136,  4152,  4310,
+ 4309,  2065,  2066,   230,  4155,  2067,  4154,  4270,   229,  4153,
+  139,   138,  4158,  3287,  4157,  4156,   231,  4160,  3288,   134,
+ 4159,  3289,  4129,  4128,  4127,  4133,  4132,  4131,  4130,  1784,
+ 4137,  4136,  1785,  1786,  4135,  4134,   135,  1787,  1788,  3405,
+ 4139,  4444,  3116,  5123,  4138,  3117,  5122,  5121,  4141,  3118,
+ 5120,  3119,  4140,  3120,  4144,  4143,  3242,  4142,  3243,  3244,
+ 3245,  2185,  3246,  3247,  4445,  5174,  3248,  5175,  3249,  3121,
+ 5176,  3250,  4103,  3122,  4107,  5177,  3123,  4106,  4105,  4104,
+ 3124,  3125,  3251,  3126,  4110,  3252,  4210,  4109,  4108,  3253,
+ 4763,  3254,  4762,  4761,  4760,  4114,  4113,  5178,  4112,  4111,
+ 4118,  4117,  4116,  4115,  4122,  4121,  4120,  4814,  4211,  4815,
+ 4119,  4126,  4816,  4125,  4124,  4817,  4123,  3184,  4818,  5179,
+ 5034,  5180,  4970,  4969,  4968,  3186,  3185,  1556,  5181,  5182,
+ 5183,  4819,  1558,  1557,  4674,  4820,  5184,  5185,  1559,  5186,
+ 5187,  1560,  5188,  5189,  5190,  4821,  4822,  1546,  4823,  3487,
+ 1545,  1548,  3488,  3489,  1547,  2988,  2000,  3490,  3491,  2987,
+ 5171,  2992,  1549,  2001,  2991,  2990,  2989,  4824,  4825,  1553,
+ 3492,  2994,  4826,  1552,  1551,  4827,  3493,  2993,  1550,  3494,
+ 2002,  2603,  4828,  2003,  1555,  3495,  2604,  4829,  1554,  2004,
+ 4830,  3496,  4933,  2005,  2006,  2007,  4505,  4460,  3497,  2008,
+ 1544,  4506,  2009,  4507,  1543,  4508,  3498,  2010,  1542,  4811,
+ 2011,  3499,  2605,  2012,  2606,  3500,  2923,  3501,  2924,  2925,
+ 3502,  2926,  2927,  3503,  4509,  4510,  3504,  4511,  3505,  2013,
+ 2607,  2014,  3506,  2608,  3507,  3508,  4271,  4272,  4226,  4273,
+  292,  4274,  3509,  3510,  3511,  2015,  3512,  3513,  4275,  4276,
+ 2016,  3514,  3515,  4277,     0,  3516,     1,  1870,     2,  1869,
+    3,  2017,  4498,   344,   345,   346,   347,     4,     5,     6,
+ 2018,  2019,  2020,     7,  5266,   348,     8,     9,  2021,   349,
+  239,   350,  4264,   351,   352,   353,   354,  3517,  3518,  3519,
+ 3520,  3521,   355,  3522,   356,   238,   357,  1789,  4915,   358,
+ 1790,   237,  1791,  4916,   236,  1792,  4917,  1793,  4918,  5191,
+ 4443,  5192,   519,   518,  5119,   517,   235,   234,   516,   515,
+  233,   514,   513,  1794,  1795,   512,   511,  1796,   510,  3523,
+ 1797,   509,   798,   508,   507,   506,  3524,   505,  5193,  3525,
+ 3181,   504,   535,   534,   533,   532,  3183,   531,   530,  3182,
+  529,   528,  4209,  4831,   527,  3526,  1537,   526,  1536,   525,
+ 4832,  3527,   524,  4759,   523,  1535,  3528,  1541,   522,   521,
+ 1540,  3529,  1539,   520,  1538,  3530,  3531,  3532,   290,   289,
+ 4833,  3533,  3534,  3535,  1534,  3175,  3536,  1533,  3537,  3174,
+ 3176,   291,  5172,  3177,  3179,  4967,  4966,   288,  3178,  4965,
+ 4964,  3180,  1527,  3169,  1528,  3168,  4812,  3170,  1530,  1529,
+ 4369,  3172,  1531,  3171,  1532,  3173,   286,  4370,  2022,  2023,
+ 2024,  3381,  1520,  1519,  3382,  1522,  1521,   287,  1523,  4371,
+ 4372,  1525,  2609,  1524,  3383,  2610,  2611,   283,   282,  1526,
+ 2612,   281,   280,  2613,   284,  4412,  4373,  4411,  1513,  4410,
+ 4409,  4416,  1515,  4415,  1514,   285,  4414,  4413,  1517,  4374,
+ 1516,   359,   360,   361,   362,   277,  1518,   276,   363,   275,
+  364,   365,   366,   278,   367,   279,    10,   182,  4548,    11,
+  703,  3384,   702,   701,   705,   704,  4549,  3385,  3386,  3387,
+ 4314,  4923,  4922,  4921,  4920,   697,  3201,   696,  3388,   695,
+ 3202,   988,   694,  3389,  3203,  4974,  4315,  4975,  4976,  3204,
+  698,   984,  3205,   983,  4977,   982,   981,  3206,   181,   987,
+ 3207,   986,   985,  3208,  3390,   980,   700,   699,  4978,   976,
+  975,  2675,   974,  2676,   973,   979,  3410,  2677,   978,  3209,
+ 2678,   977,  4614,  2679,  5194,  4615,   690,  2680,  4616,  5130,
+  689,   972,  5129,   688,   971,  4617,  5128,   692,  2681,   691,
+ 1934,  2682,   966,  1933,  1936,   965,  1935,  1930,   970,   503,
+ 1929,   969,  1932,   968,  1931,   502,   967,  3210,  1942,  1941,
+ 4618,  3211,  2541,   964,  1943,  3212,  2542,   693,  1938,  2543,
+ 2544,  1937,  3213,  4979,  1940,  1939,  2545,  3214,   959,  2546,
+ 1918,   958,  1917,  2547,  4834,  2548,   957,  4980,  1920,  1919,
+  956,  1914,  4770,   963,  1913,  4769,   962,  1916,  4768,   961,
+ 3215,   960,  1915,  1926,   673,  4609,  1925,   672,  1928,   955,
+  671,  4608,  2549,   670,  2550,  1927,   954,  1922,  4610,   677,
+ 2551,  2552,   676,  1921,  4981,  1924,   675,  4982,  2553,   674,
+ 1923,  4983,  4066,  1902,   952,   951,  1901,   950,  4067,  1904,
+  678,  4068,  1903,   949,  2068,  1898,  1897,  2069,  4069,  2070,
+ 1900,  4611,  2071,   953,  1899,  4619,  1910,   682,  2072,  1909,
+  681,  2073,   680,  2074,  1912,   948,   679,  2075,  1911,   947,
+ 1906,  3216,  4620,  2076,  1905,   685,  4984,  2077,  2554,  2078,
+ 1908,   684,  4985,   683,  4986,  2555,  1907,  3290,  4987,  2556,
+  942,   686,  2557,   941,  2558,   940,  2079,  4988,   946,  3411,
+ 2080,   945,  2081,  4989,   687,  4990,   944,   943,  5093,  3217,
+ 4621,  4622,  4623,  2559,  2560,   661,  3291,   660,  2561,  2562,
+ 2563,  4564,   935,  3292,  2564,  4971,   934,  2565,  2566,  2082,
+  933,   939,   938,   937,   936,  3218,  4624,  4625,  2083,  4626,
+ 2084,  4627,   932,   663,  3293,   662,   931,   667,  4628,   666,
+  665,  4629,   664,  4630,  4733,   926,   669,   925,   924,   668,
+ 3412,   930,  2085,   929,  2086,  2087,   928,  3219,   927,  4375,
+ 2088,  4376,  2089,  4330,  3391,  4377,   386,  4378,   923,   922,
+  656,   385,  2090,  2091,   384,   917,   390,   916,   915,   921,
+ 4379,   389,   920,   919,  4380,   388,  3220,   918,  2326,   387,
+ 4381,   914,   658,   913,   657,  2324,  2325,   659,  3422,   391,
+ 3423,  2323,  3424,  3425,  3426,  3427,   912,  3428,  4602,  3429,
+  911,  1576,  3430,   910,  3221,  2614,  3431,  3432,  3433,   395,
+ 3434,  3435,   394,  3436,   393,   392,   398,   397,  1574,  3222,
+  396,  2615,  2616,  2617,  3437,  4368,  1575,  3223,   243,   242,
+  241,  1999,  5075,  5076,  5077,  5078,  4547,  1397,  4070,  4715,
+ 4716,  4717,  4718,  4991,  4313,  4992,  2778,  4919,   649,   648,
+  647,  1034,  1033,   646,  4993,   652,   651,   650,  2774,  2776,
+  653,  2777,  1032,  2775,  1031,  1030,  4631,  4632,   240,   654,
+ 3279,   655,  1026,  1025,  1024,  1023,  1029,  1028,  4633,  1027,
+  626,   625,  5127,   624,  1022,  5126,   623,  1021,  5125,   630,
+  629,  5124,  3280,   628,   627,  2779,  1016,  1015,   633,   632,
+ 1014,  1013,   631,  1020,  1019,   635,  1018,  4972,  1017,   634,
+  639,   638,  1012,   637,   636,  1011,   643,   642,   641,   640,
+ 2771,   645,   644,  4767,  4766,  1010,  4473,  4765,  4764,   615,
+  614,  1009,   613,   612,   619,   618,  2322,   617,   616,  4474,
+ 2770,  1007,  1006,   621,   620,  2092,  1571,  1008,  1570,  1572,
+  622,  3294,  4239,  3295,  2773,  4475,  4476,  1573,  1005,   610,
+  609,  4240,   608,  3296,  4516,  2772,  3297,  4477,  4515,  4514,
+ 4513,  4520,  3189,  3188,  4519,  4241,  3187,  4518,  3298,   611,
+ 4242,  3193,  3192,  4517,  3191,  3190,  2788,  4478,  3197,  3196,
+ 3195,  3194,  1004,  3200,  1003,  1002,  3199,  1567,  3198,  1569,
+  590,  1568,   589,  4282,  1001,  4243,  1000,  4281,   588,   594,
+  593,  4280,   592,  4279,   591,  2787,  4286,   597,   996,   596,
+  595,  4285,   999,  4284,  1564,   998,  4283,   997,  2025,   600,
+ 1565,  4244,   599,   598,   603,   602,   601,  2790,   991,   607,
+  606,  2344,   990,   605,   604,   989,   995,   994,   993,  1566,
+  992,  2618,  2619,  2343,  2789,  2342,  4418,  3321,  5083,  5082,
+ 5081,  5080,  2781,  1563,  1562,  1561,  5134,  4419,  3322,  5135,
+ 3323,  5136,  5137,  2780,  4723,  4722,  4721,   222,  4720,  2337,
+ 3324,  5138,  2336,  2334,  2786,  2335,  4774,  4775,  4776,  4777,
+  224,   223,   225,  3325,  3281,  1403,  1402,  2782,  2333,  2783,
+ 4778,  2784,  5139,  3326,  2785,  4994,  2341,  5140,  2340,  4930,
+ 2339,  4929,  4928,  5141,  5142,  1070,  5143,  3327,  3328,  3329,
+ 3330,  2494,  3331,  1401,  2338,  1400,  2495,  3332,  2496,  4779,
+ 3333,  1069,  3334,  1068,  2497,  1067,  2498,  2499,  4634,  4780,
+ 5144,  5145,  5146,  5147,  2500,  5148,  1798,  2760,  2331,  2501,
+ 1799,  5149,  2502,  1800,  5150,  2503,  4781,  2504,  5253,  4782,
+ 2505,  4783,  3463,  3464,  2330,  3465,  3466,  3467,  2329,  3468,
+ 5131,  3469,  1801,  2758,  3470,  2327,  2328,  3471,  4784,  4785,
+ 3472,  2759,  4786,  4787,  3473,  2332,  3474,  4788,  4604,  4789,
+ 4790,  4893,  2750,  1802,  4603,  1803,  1804,  4479,  1066,  4434,
+ 4480,  4481,  4482,  4771,  1061,  1060,  1059,  1058,  3335,  1065,
+ 3336,  3337,  1064,  1063,  3338,  1062,  1805,  1053,  4483,  1052,
+ 1051,  1626,  4484,  3339,  1050,  1627,  1057,  1628,  4485,  1056,
+ 1055,  1054,  1629,  1630,  4245,  4200,  4246,  4247,  1806,  2757,
+ 4248,  1631,  1049,  1632,  1048,  3475,  1633,  3476,  1634,  1047,
+ 1635,  4249,   729,   320,  4250,  2752,  4251,  2753,  2751,  1044,
+ 1043,  2756,  2093,  1636,  3477,  2754, 65535,
 };
 
-const unsigned short DictKeyHashTable[] = {
- 4096,  4097,  4100,  4096,  4103,  4096,  4106,  4109,  4112,  4115,
- 4118,  4121,  4124,  4096,  4096,  4096,  4127,  4132,  4135,  4138,
- 4141,  4146,  4149,  4096,  4152,  4096,  4096,  4157,  4160,  4163,
- 4168,  4171,  4176,  4181,  4096,  4184,  4096,  4187,  4096,  4190,
- 4195,  4200,  4203,  4096,  4208,  4096,  4096,  4211,  4096,  4218,
- 4223,  4096,  4230,  4233,  4238,  4243,  4096,  4246,  4096,  4249,
- 4252,  4096,  4096,  4255,  4096,  4096,  4258,  4261,  4264,  4269,
- 4096,  4272,  4277,  4280,  4285,  4096,  4288,  4293,  4296,  4096,
- 4096,  4096,  4096,  4096,  4096,  4303,  4096,  4306,  4317,  4322,
- 4325,  4328,  4335,  4340,  4343,  4346,  4096,  4349,  4096,  4354,
- 4096,  4357,  4360,  4363,  4096,  4366,  4369,  4378,  4383,  4386,
- 4393,  4398,  4405,  4410,  4417,  4420,  4427,  4430,  4435,  4438,
- 4441,  4448,  4451,  4458,  4463,  4472,  4479,  4484,  4489,  4496,
- 4499,  4502,  4513,  4516,  4519,  4524,  4529,  4096,  4096,  4096,
- 4096,  4096,  4532,  4539,  4096,  4096,  4542,  4551,  4554,  4559,
- 4096,  4562,  4565,  4570,  4577,  4582,  4585,  4096,  4592,  4096,
- 4595,  4600,  4609,  4612,  4615,  4096,  4096,  4096,  4620,  4096,
- 4623,  4096,  4626,  4635,  4096,  4638,  4641,  4096,  4646,  4651,
- 4096,  4096,  4096,  4654,  4096,  4096,  4096,  4659,  4662,  4096,
- 4096,  4671,  4096,  4674,  4677,  4680,  4685,  4096,  4096,  4096,
- 4688,  4691,  4694,  4697,  4702,  4705,  4714,  4096,  4719,  4096,
- 4096,  4722,  4096,  4096,  4725,  4728,  4096,  4731,  4096,  4096,
- 4736,  4739,  4096,  4096,  4744,  4749,  4754,  4757,  4766,  4773,
- 4780,  4787,  4792,  4801,  4806,  4811,  4096,  4096,  4818,  4825,
- 4096,  4828,  4833,  4096,  4836,  4096,  4839,  4844,  4851,  4858,
- 4865,  4870,  4879,  4886,  4895,  4096,  4096,  4096,  4900,  4907,
- 4910,  4913,  4918,  4921,  4096,  4096,  4096,  4096,  4096,  4096,
- 4096,  4096,  4924,  4096,  4096,  4927,  4930,  4937,  4944,  4947,
- 4950,  4096,  4955,  4096,  4096,  4958,  4096,  4961,  4964,  4967,
- 4096,  4096,  4970,  4975,  4984,  4987,  4992,  4997,  5002,  5009,
- 5018,  5023,  5026,  5031,  5034,  4096,  5037,  5040,  4096,  5043,
- 5046,  5053,  5056,  4096,  5061,  5064,  5067,  5072,  5077,  5084,
- 5089,  5094,  5101,  5108,  5119,  5124,  5131,  4096,  4096,  4096,
- 5136,  5139,  5142,  5147,  5150,  4096,  5153,  5158,  4096,  5161,
- 4096,  5164,  5167,  5170,  4096,  5177,  4096,  4096,  4096,  4096,
- 5180,  4096,  5187,  5190,  5197,  5200,  5205,  5208,  4096,  5213,
- 5216,  4096,  5219,  5224,  5227,  4096,  5234,  5239,  5244,  5247,
- 5250,  5257,  5264,  4096,  5267,  4096,  5270,  5273,  4096,  5276,
- 5279,  5286,  4096,  5289,  4096,  5294,  4096,  4096,  5297,  5302,
- 4096,  5305,  5308,  4096,  5315,  4096,  5318,  5323,  4096,  5326,
- 5329,  5334,  4096,  5339,  5344,  5347,  5350,  5353,  5358,  4096,
- 5361,  5368,  4096,  5371,  4096,  4096,  5380,  5383,  5390,  5395,
- 5402,  5405,  5410,  5419,  5424,  5427,  5430,  5433,  5436,  5441,
- 5444,  5449,  5454,  4096,  5457,  4096,  5460,  5463,  4096,  5466,
- 4096,  5469,  5474,  4096,  5477,  4096,  5482,  5487,  4096,  5492,
- 5495,  5500,  5505,  4096,  4096,  5512,  5515,  5520,  5525,  5532,
- 5535,  5540,  5547,  5550,  4096,  5555,  4096,  5558,  5565,  5568,
- 4096,  4096,  4096,  4096,  4096,  4096,  5571,  4096,  5574,  5577,
- 5584,  5593,  5600,  5605,  5608,  4096,  5615,  4096,  4096,  5618,
- 5621,  4096,  4096,  5624,  5627,  5632,  5635,  4096,  4096,  5638,
- 4096,  5641,  4096,  5646,  5651,  5654,  4096,  5657,  5662,  5667,
- 4096,  5674,  5679,  5682,  5685,  5690,  4096,  5695,  5698,  4096,
- 5701,  5704,  5709,  5714,  5719,  5724,  5731,  5736,  5743,  5750,
- 5755,  5762,  5767,  5778,  5783,  5788,  5791,  5794,  5797,  4096,
- 5800,  5809,  5814,  5817,  5822,  5825,  4096,  5830,  5833,  5838,
- 5841,  4096,  5844,  5847,  5850,  5857,  5866,  5873,  5880,  5883,
- 5888,  5891,  4096,  5898,  5903,  5910,  5913,  5916,  5921,  5926,
- 5929,  5932,  5941,  5948,  5955,  5960,  4096,  5963,  4096,  4096,
- 5968,  5971,  4096,  5974,  4096,  5981,  5984,  5987,  4096,  5990,
- 5993,  5996,  6001,  4096,  6004,  6007,  6010,  6015,  4096,  6020,
- 4096,  4096,  6023,  6030,  6033,  6036,  6041,  6044,  6049,  6054,
- 6059,  6062,  6065,  4096,  6068,  6073,  4096,  4096,  4096,  4096,
- 6080,  4096,  6087,  4096,  6090,  6095,  6098,  4096,  6101,  6108,
- 6113,  6116,  6121,  6126,  6131,  6134,  6141,  4096,  4096,  6146,
- 6149,  6152,  4096,  6155,  6158,  6163,  6166,  4096,  4096,  6169,
- 4096,  4096,  6174,  6179,  4096,  6182,  6187,  4096,  6192,  4096,
- 6197,  6200,  6205,  4096,  6212,  6215,  4096,  6218,  6223,  6228,
- 6231,  4096,  6234,  4096,  6237,  6240,  6247,  6250,  4096,  4096,
- 6253,  4096,  4096,  6256,  6259,  4096,  6266,  6273,  6276,  6279,
- 6284,  4096,  6287,  6292,  6295,  6298,  6303,  6306,  4096,  4096,
- 6309,  6314,  6317,  6320,  6325,  6328,  4096,  4096,  6333,  4096,
- 6338,  6341,  4096,  6344,  4096,  6349,  4096,  4096,  6356,  4096,
- 6361,  6366,  4096,  6369,  4096,  4096,  4096,  6374,  6377,  6380,
- 6385,  4096,  4096,  6388,  6391,  6398,  6401,  6416,  6419,  6424,
- 6429,  6440,  6445,  6450,  6453,  6458,  6465,  4096,  6470,  6475,
- 6478,  4096,  6481,  4096,  4096,  4096,  6484,  6487,  6490,  4096,
- 6493,  6498,  6501,  6506,  6511,  6518,  4096,  4096,  6523,  4096,
- 6528,  6531,  4096,  4096,  4096,  4096,  6534,  4096,  6541,  6548,
- 4096,  4096,  4096,  6551,  4096,  6556,  6561,  6570,  6573,  6578,
- 6581,  6584,  4096,  6589,  6592,  6597,  6600,  6607,  4096,  6610,
- 6613,  6620,  6625,  4096,  4096,  4096,  4096,  6628,  4096,  4096,
- 6631,  6634,  6637,  4096,  4096,  4096,  6642,  4096,  4096,  6645,
- 6648,  6653,  6660,  6665,  6668,  6671,  4096,  6676,  6681,  6688,
- 6693,  6698,  6703,  6710,  6717,  6722,  6727,  6730,  6733,  6736,
- 6741,  6746,  6751,  6754,  4096,  6757,  6760,  6767,  6770,  6775,
- 6778,  6781,  6786,  4096,  4096,  6789,  4096,  4096,  4096,  4096,
- 6798,  6803,  4096,  4096,  6808,  4096,  4096,  6811,  4096,  6814,
- 6817,  6822,  6827,  4096,  6830,  6835,  6838,  6843,  6854,  6857,
- 6862,  6865,  4096,  6868,  4096,  6871,  6874,  4096,  4096,  4096,
- 6879,  6882,  4096,  4096,  6889,  6892,  6895,  6898,  6901,  6906,
- 6909,  4096,  4096,  6912,  4096,  6915,  6918,  6923,  4096,  6926,
- 4096,  6931,  6936,  4096,  6941,  4096,  6948,  4096,  4096,  6953,
- 4096,  4096,  4096,  4096,  6960,  6963,  6966,  4096,  6969,  6972,
- 4096,  6977,  6980,  6989,  4096,  6992,  6995,  4096,  6998,  7005,
- 7008,  4096,  7011,  7016,  7021,  7024,  7031,  7036,  7041,  7050,
- 7055,  7062,  7069,  7078,  7087,  7092,  7101,  4096,  7104,  7107,
- 7110,  7117,  7122,  4096,  4096,  7129,  7132,  7137,  7144,  7149,
- 7154,  7157,  7166,  4096,  4096,  7171,  4096,  7174,  4096,  7177,
- 7180,  7183,  7186,  4096,  7189,  7192,  7199,  7202,  7205,  4096,
- 7208,  7213,  7216,  7219,  7222,  4096,  7229,  7236,  7245,  7248,
- 7251,  7254,  7257,  7260,  7265,  7274,  7279,  7286,  7291,  7294,
- 4096,  7297,  7308,  7311,  4096,  7314,  7317,  7322,  7325,  7328,
- 7333,  7338,  7341,  7344,  7347,  7350,  7353,  7358,  7361,  7364,
- 7369,  7376,  7379,  4096,  7382,  7387,  7392,  7397,  7400,  7403,
- 7410,  7415,  7426,  7429,  7434,  7437,  4096,  4096,  4096,  7444,
- 4096,  4096,  4096,  4096,  7449,  7452,  4096,  7457,  7468,  4096,
- 4096,  7473,  4096,  4096,  4096,  4096,  7478,  7487,  7496,  7501,
- 7508,  7513,  7518,  7521,  4096,  4096,  7526,  7529,  7532,  7535,
- 7538,  7541,  4096,  4096,  4096,  7544,  7547,  7550,  4096,  7555,
- 4096,  4096,  7560,  4096,  7563,  7568,  7571,  7574,  7577,  4096,
- 7580,  7583,  4096,  7592,  7597,  7600,  7603,  4096,  7608,  7611,
- 4096,  4096,  4096,  4096,  7614,  4096,  7617,  7620,  7627,  4096,
- 7630,  7641,  7646,  7653,  7656,  7659,  7664,  7669,  7672,  7675,
- 7680,  7683,  7686,  4096,  7689,  7698,  7701,  7704,  7707,  7710,
- 7715,  7718,  7723,  4096,  7726,  4096,  4096,  4096,  7729,  7732,
- 7735,  4096,  7744,  7749,  4096,  7756,  7763,  7770,  7775,  7784,
- 7787,  7790,  4096,  7795,  7802,  7805,  4096,  7810,  7813,  4096,
- 7816,  4096,  7823,  7830,  7833,  7840,  4096,  7843,  4096,  7848,
- 4096,  4096,  7851,  7854,  4096,  7859,  7862,  7865,  4096,  7868,
- 7873,  4096,  4096,  4096,  7876,  7879,  7882,  4096,  7885,  4096,
- 7888,  4096,  7891,  7896,  7899,  7904,  4096,  7909,  4096,  7912,
- 4096,  4096,  4096,  7919,  7924,  7927,  7930,  4096,  7933,  7936,
- 7941,  7946,  7951,  7958,  7963,  7968,  7977,  7982,  7989,  7994,
- 8003,  4096,  4096,  4096,  8010,  8015,  8022,  8029,  8034,  8047,
- 8052,  8057,  4096,  4096,  8060,  8065,  8068,  8071,  8074,  8077,
- 8080,  4096,  4096,  4096,  8083,  8086,  8089,  8092,  4096,  8095,
- 4096,  8098,  8105,  8108,  4096,  4096,  4096,  8113,  8116,  4096,
- 8123,  8130,  8133,  8136,  8143,  8150,  4096,  4096,  4096,  8153,
- 8156,  8163,  8166,  8169,  8172,  8179,  8184,  8191,  8194,  4096,
- 4096,  8197,  8200,  8203,  4096,  8206,  8209,  4096,  4096,  8214,
- 8217,  8220,  8229,  8236,  8241,  8246,  8251,  8254,  8265,  4096,
- 4096,  8270,  8273,  8276,  8279,  8282,  8285,  8288,  4096,  8293,
- 8298,  8301,  4096,  8310,  4096,  8315,  8318,  8323,  8326,  8333,
- 8338,  8345,  8348,  8353,  8358,  8363,  8368,  8373,  4096,  4096,
- 8378,  4096,  8387,  8390,  8393,  8396,  8401,  8408,  8413,  4096,
- 4096,  4096,  4096,  8416,  8419,  4096,  8422,  4096,  4096,  8425,
- 8432,  8439,  4096,  4096,  8442,  8447,  8450,  8453,  8458,  4096,
- 4096,  8465,  8468,  8473,  8476,  4096,  8481,  4096,  8484,  8489,
- 8492,  4096,  8495,  8498,  8503,  8506,  8509,  8516,  4096,  8521,
- 8524,  4096,  8527,  8532,  8537,  8542,  8545,  4096,  8552,  8555,
- 8558,  4096,  8561,  8564,  8569,  8574,  8577,  8582,  4096,  8585,
- 8588,  8593,  8598,  8607,  4096,  8610,  4096,  8617,  8620,  4096,
- 8623,  8632,  8637,  8640,  8647,  8652,  8655,  4096,  8660,  8663,
- 8668,  8671,  4096,  4096,  8676,  8681,  8684,  4096,  8687,  8692,
- 4096,  4096,  8695,  8700,  8703,  8712,  8717,  8722,  8725,  8728,
- 4096,  8731,  8736,  8739,  4096,  8744,  8749,  4096,  8752,  8755,
- 8758,  8761,  8764,  8767,  8770,  8775,  8782,  8785,  8790,  4096,
- 8793,  4096,  8796,  8799,  4096,  4096,  4096,  4096,  8802,  8805,
- 8810,  8813,  4096,  8816,  8821,  8824,  8831,  8836,  4096,  8843,
- 8848,  4096,  4096,  8851,  4096,  8854,  4096,  8861,  8868,  8875,
- 8878,  8883,  8888,  8893,  8902,  8905,  8914,  8919,  8928,  8931,
- 8942,  8949,  8954,  8957,  8962,  8965,  8968,  8971,  4096,  8976,
- 4096,  4096,  8983,  8986,  8989,  8996,  9001,  9006,  9009,  9012,
- 9015,  9018,  9021,  9024,  4096,  9033,  9036,  4096,  4096,  9039,
- 9042,  4096,  4096,  9045,  9050,  9055,  4096,  9058,  9061,  9068,
- 9075,  9078,  4096,  4096,  4096,  9081,  9084,  9087,  9092,  9099,
- 9106,  9115,  9124,  4096,  9127,  9134,  9137,  9140,  4096,  9143,
- 9146,  9153,  9160,  9167,  9170,  9173,  9180,  4096,  9183,  4096,
- 9186,  4096,  9189,  4096,  9194,  9199,  9204,  9207,  4096,  9210,
- 9217,  9222,  9225,  9230,  9239,  9242,  9249,  9256,  9269,  9274,
- 9285,  9292,  9295,  9298,  4096,  9301,  9310,  9317,  9320,  9323,
- 9328,  9331,  9334,  4096,  9341,  9344,  9349,  9352,  9355,  9358,
- 4096,  9361,  9366,  9373,  4096,  4096,  9376,  9379,  9382,  9385,
- 9388,  4096,  9391,  9394,  9397,  9400,  4096,  9403,  9406,  4096,
- 9409,  9412,  4096,  4096,  9415,  9418,  9423,  9426,  9431,  9434,
- 9437,  9440,  9443,  9448,  4096,  4096,  9453,  4096,  9456,  9459,
- 9462,  9465,  4096,  4096,  9468,  9477,  9480,  9483,  9486,  9493,
- 9496,  9501,  9506,  4096,  9509,  4096,  9512,  9515,  9518,  9521,
- 9528,  9537,  9542,  4096,  4096,  4096,  9547,  9550,  4096,  9555,
- 9558,  9563,  9566,  9569,  9572,  9579,  9582,  9585,  9588,  9591,
- 4096,  9594,  4096,  4096,  9597,  9600,  4096,  9603,  9606,  9611,
- 9616,  9619,  9624,  9627,  9630,  9639,  9642,  4096,  4096,  9647,
- 9652,  9655,  9658,  9663,  9668,  9671,  9682,  9687,  4096,  9692,
- 9695,  9698,  9705,  9708,  9715,  9724,  9727,  4096,  4096,  4096,
- 4096,  9730,  9733,  9740,  9745,  9748,  4096,  9753,  9758,  9761,
- 9764,  9769,  9772,  9775,  9780,  9783,  9788,  4096,  9793,  4096,
- 9796,  4096,  9799,  4096,  9804,  9807,  9812,  9815,  9820,  9827,
- 9834,  9841,  9844,  9851,  9854,  9859,  9862,  9867,  4096,  9874,
- 9877,  9880,  4096,  4096,  9885,  9888,  9891,  9900,  9903,  9908,
- 9911,  9914,  4096,  9917,  9922,  9927,  9932,  9935,  9944,  9949,
- 9958,  9965,  9974,  9981,  9988,  9993,  9996,  9999, 10004, 10007,
-10010, 10017, 10022, 10029, 10038, 10047, 10052, 10059, 10062, 10069,
- 4096, 10072, 10077,  4096, 10080,  4096,  4096,  4096, 10085,  4096,
- 4096, 10092,  4096, 10095, 10104, 10109,  4096, 10116,  4096, 10121,
- 4096, 10126, 10133,  4096,  4096, 10138, 10141, 10144, 10149, 10152,
-10155, 10158, 10165, 10168,  4096,  4096, 10173, 10176, 10181,  4096,
-10184,  4096, 10187, 10190, 10197, 10200, 10203, 10210, 10217, 10222,
-10227, 10232, 10235, 10242, 10245,  4096,  4096, 10252,  4096,  4096,
- 4096, 10259, 10262, 10267,  4096, 10270,  4096,  4096,  4096, 10275,
- 4096,  4096, 10278,  4096,  4096,  4096, 10283, 10288, 10291, 10294,
-10297,  4096,  4096, 10300,  4096,  4096,  4096, 10305,  4096, 10308,
-10311,  4096, 10314, 10321, 10326, 10333, 10338, 10347, 10354, 10357,
-10362, 10365, 10372,  4096, 10375, 10378, 10383,  4096,  4096, 10386,
-10395, 10398, 10401, 10404, 10409, 10414, 10423, 10426, 10435, 10438,
-10443, 10446, 10449, 10454,  4096,  4096, 10457,  4096,  4096,  4096,
- 4096,  4096, 10462, 10467, 10470, 10473, 10476,  4096, 10479, 10484,
- 4096, 10487, 10490,  4096,  4096,  4096,  4096,  4096, 10497,  4096,
- 4096, 10500, 10503, 10506, 10511, 10514, 10519, 10526, 10529,  4096,
-10532,  4096,  4096, 10535, 10538, 10541,  4096, 10544, 10547, 10558,
-10561, 10566, 10571, 10576, 10581, 10590, 10595, 10602, 10605, 10608,
-10613, 10624, 10627, 10632,  4096, 10635,  4096,  4096, 10638,  4096,
-10641, 10644, 10649, 10656, 10665, 10668, 10671, 10674, 10683, 10686,
- 4096,  4096, 10691,  4096,  4096, 10694, 10697, 10700, 10705, 10708,
-10711, 10718,  4096,  4096,  4096, 10723, 10728, 10731, 10734,  4096,
- 4096,  4096,  4096, 10741, 10746,  4096, 10753, 10758, 10763, 10768,
-10775, 10778, 10783, 10792, 10795, 10800, 10805,  4096, 10814, 10821,
-10824, 10827, 10834, 10837, 10840, 10847, 10854,  4096,  4096, 10857,
-10862, 10869,  4096, 10874, 10877, 10882, 10885, 10892,  4096, 10897,
-10904, 10907, 10910,  4096,  4096, 10913, 10916, 10921, 10924, 10927,
- 4096, 10934, 10937, 10940, 10943, 10948, 10955, 10958, 10963, 10968,
-10971, 10976, 10985, 10990, 10997, 11000, 11005, 11008, 11013, 11016,
-11023,  4096,  4096, 11026, 11029, 11032, 11039,  4096,  4096, 11042,
-11047, 11054,  4096, 11057, 11062, 11065, 11070,  4096, 11077, 11080,
- 4096, 11083, 11086, 11091, 11096, 11103, 11106, 11109, 11112, 11119,
- 4096, 11124, 11133, 11138, 11143, 11146, 11151, 11158, 11161, 11168,
-11173, 11178,  4096, 11181,  4096, 11184,  4096, 11189, 11192,  4096,
-11195, 11200, 11205, 11208, 11215, 11220, 11227,  4096, 11232,  4096,
-11235, 11242, 11245, 11250, 11255, 11258, 11261, 11264, 11273,  4096,
- 4096, 11276, 11281, 11284,  4096, 11287, 11292,  4096, 11295,  4096,
- 4096,  4096,  4096, 11298, 11301, 11304, 11307, 11310, 11313, 11316,
- 4096, 11319, 11322, 11325,  4096, 11332,  4096, 11335, 11338, 11345,
-11350, 11353, 11358, 11361, 11366, 11369,  4096, 11378,  4096, 11383,
-11386,  4096, 11389, 11394,  4096, 11397, 11404, 11407, 11412,  4096,
-11421,  4096,  4096, 11424,  4096, 11427, 11440, 11445, 11452,  4096,
-11457,  4096,  4096, 11460,  4096, 11463, 11468, 11471,  4096, 11474,
- 4096, 11479,  4096, 11484, 11489, 11492, 11497,  4096, 11502, 11505,
-11508, 11511, 11520, 11523, 11526, 11531, 11534, 11541, 11550, 11553,
-11560, 11565, 11568, 11573, 11576, 11579,  4096,  4096, 11582,  4096,
-11585, 11588,  4096, 11593,  4096, 11598, 11601,  4096,  4096,  4096,
-11608,  4096, 11611, 11616,  4096, 11621,  4096, 11626,  4096, 11629,
-11634,  4096, 11637, 11642, 11647, 11660, 11665, 11670, 11677, 11682,
-11685, 11694, 11699, 11702, 11707, 11712, 11715,  4096, 11718, 11727,
-11730, 11735, 11738, 11741, 11746, 11749, 11752, 11757, 11762, 11767,
-11772, 11777, 11780, 11785, 11788,  4096, 11793,  4096,  4096, 11798,
-11803, 11806,  4096, 11811, 11814,  4096, 11817, 11822, 11827, 11832,
-11835, 11844, 11853, 11860, 11867, 11876, 11885, 11892, 11897, 11906,
-11911, 11914, 11919,  4096, 11922,  4096, 11925, 11928, 11931, 11936,
-11945, 11952, 11955, 11960, 11963, 11966,  4096, 11971, 11976, 11979,
- 4096, 11982, 11985, 11990, 11993, 11998, 12001, 12008, 12011, 12016,
-12021, 12026, 12031, 12034, 12041, 12046, 12049, 12056, 12059, 12064,
- 4096, 12069, 12076, 12079, 12086, 12089, 12096, 12105, 12114, 12121,
-12124, 12129, 12132, 12143, 12148, 12151, 12154, 12159, 12164, 12169,
- 4096,  4096, 12174, 12177, 12180, 12183, 12192, 12195, 12198, 12209,
-12214, 12217,  4096, 12224, 12227,  4096, 12232,  4096, 12237,  4096,
-12242, 12245,  4096, 12250, 12253, 12256,  4096,  4096, 12261, 12266,
-12269,  4096, 12274, 12277,  4096, 12282, 12285, 12292, 12295,  4096,
-12298, 12303, 12312, 12315, 12318, 12325, 12328, 12331, 12334, 12337,
-12344, 12353, 12356, 12359, 12366, 12369, 12378, 12381, 12386, 12391,
-12394, 12397, 12400,  4096,  4096, 12405,  4096, 12408, 12417,  4096,
- 4096,  4096, 12422, 12427,  4096,  4096, 12430, 12433, 12436, 12439,
- 4096,  4096, 12442, 12447, 12450,  4096, 12457, 12464,  4096, 12469,
-12474,  4096,  4096,  4096, 12477, 12486,  4096,  4096,  4096, 12493,
- 4096, 12500,  4096, 12503, 12506, 12509,  4096, 12512,  4096,  4096,
-12515, 12518, 12521,  4096, 12526,  4096, 12531,  4096, 12536,  4096,
- 4096,  4096,  4096, 12539, 12544,  4096,  4096,  4096, 12547, 12552,
-12555,  4096,  4096, 12558, 12561,  4096, 12566,  4096,  4096, 12569,
- 4096, 12574,  4096, 12579, 12582, 12587, 12592, 12599, 12602, 12605,
-12610, 12613,  4096, 12618, 12621,  4096,  4096,  4096, 12624,  4096,
-12633,  4096,  4096,  4096,  4096,  4096, 12646, 12655, 12658,  4096,
-12663, 12666, 12669,  4096,  4096,  4096, 12672, 12677, 12682, 12685,
-12688, 12691, 12696,  4096,  4096,  4096, 12701, 12704, 12707, 12712,
-12715, 12718, 12721, 12724,  4096,  4096, 12727, 12730, 12733,  4096,
-12736,  4096,  4096, 12743, 12750, 12755,  4096, 12760,  4096,  4096,
-12763, 12768,  4096,  4096,  4096, 12771, 12774, 12777, 12782, 12785,
-12788, 12791, 12794, 12797, 12800,  4096, 12803, 12806,  4096,  4096,
-12809, 12816, 12819,  4096,  4096,  4096,  4096, 12824, 12829,  4096,
-12832, 12835, 12840, 12843, 12852, 12859, 12862,  4096,  4096, 12869,
- 4096, 12874,  4096, 12877, 12880,  4096, 12885,  4096, 12890,  4096,
-12893,  4096,  4096,  4096, 12898, 12901,  4096, 12906, 12909, 12916,
-12921, 12924, 12931,  4096,  4096, 12938, 12943, 12946, 12953, 12958,
-12963, 12966, 12969, 12974, 12979, 12982,  4096, 12985, 12990, 12993,
- 4096, 12996, 13001,  4096, 13004, 13011, 13014, 13017,  4096, 13020,
-13031, 13042, 13045, 13052, 13055, 13062, 13065, 13068,  4096, 13073,
-13080, 13083, 13086, 13093,  4096, 13096, 13099, 13102, 13105,  4096,
-13108, 13111, 13114, 13119, 13126, 13129, 13134, 13141, 13148, 13155,
-13162, 13167, 13172, 13177,  4096, 13180,  4096, 13183, 13188,  4096,
- 4096,  4096, 13193, 13196, 13199, 13202, 13211, 13216, 13223, 13228,
-13235, 13238, 13245, 13248, 13255, 13260, 13271, 13276,  4096, 13281,
-13284, 13287, 13290, 13295, 13300, 13303, 13306, 13309, 13314, 13317,
- 4096,  4096, 13320, 13327,  4096, 13330, 13333, 13336, 13343, 13346,
-13353, 13358, 13365, 13368, 13377, 13386,  4096, 13389,  4096, 13392,
- 4096, 13395, 13398, 13405, 13408,  4096,  4096, 13411, 13414, 13419,
-13424, 13429, 13434, 13437, 13440, 13447,  4096, 13452, 13457, 13464,
-13471, 13476, 13485, 13494, 13501, 13508, 13519,  4096, 13522, 13525,
- 4096,  4096, 13530,  4096,  4096, 13533, 13536, 13539, 13544,  4096,
-13551, 13554, 13557, 13562, 13565, 13570, 13573, 13580, 13585, 13588,
-13595, 13600, 13607, 13612, 13617, 13622, 13633, 13640, 13649, 13654,
-13661, 13666, 13673, 13678, 13685, 13688, 13693,  4096, 13696,  4096,
-13703,  4096, 13706, 13715, 13724,  4096, 13729,  4096, 13740, 13745,
-13748, 13751, 13756, 13759, 13764,  4096,  4096,  4096, 13771,  4096,
- 4096,  4096, 13774, 13777, 13780, 13785, 13790, 13799,  4096,  4096,
-13802, 13805, 13808, 13813,  4096,  4096,  4096, 13816, 13823, 13826,
-13831, 13834, 13837, 13844, 13847, 13854, 13859, 13864, 13867, 13870,
-13873, 13878, 13883, 13888,  4096,  4096,  4096,  4096, 13891, 13894,
- 4096, 13897, 13900, 13905,  4096, 13914, 13919, 13924,  4096, 13929,
- 4096, 13932, 13937, 13940, 13943, 13952, 13955,  4096,  4096,  4096,
-13958,  4096, 13961, 13964, 13971,  4096, 13976, 13979, 13982, 13985,
-13988, 13993, 13998, 14001,  4096, 14006, 14011, 14016, 14019, 14024,
-14027, 14030, 14035, 14040, 14045, 14050,  4096, 14057,  4096, 14060,
-14067, 14074, 14079, 14088, 14097,  4096, 14102, 14105, 14110,  4096,
- 4096, 14115, 14118, 14121,  4096, 14126, 14131, 14134, 14141, 14144,
-14149, 14156, 14163, 14166, 14169, 14174,  4096, 14177, 14180,  4096,
-14185,  4096,  4096, 14188, 14193,  4096, 14200, 14205, 14210, 14215,
-14220, 14225, 14230, 14233,  4096, 14236, 14239, 14242, 14245, 14250,
-14257, 14264, 14269, 14274, 14279, 14284, 14287,  4096, 14296, 14301,
- 4096,  4096,  4096, 14306, 14311, 14314, 14317, 14322, 14325, 14328,
-14331,  4096, 14334, 14339, 14344,  4096, 14349, 14352, 14355, 14358,
-14363, 14366,  4096, 14371, 14374, 14381, 14386, 14389,  4096, 14396,
- 4096, 14399,  4096, 14402, 14407,  4096, 14410, 14419, 14422,  4096,
-14427,  4096,  4096, 14434, 14439, 14444, 14447,  4096, 14452, 14457,
-14462, 14467, 14472, 14477, 14482,  4096, 14487,  4096,  4096, 14490,
- 4096, 14497, 14502, 14505,  4096, 14508, 14511,  4096,  4096, 14514,
- 4096, 14519, 14522,  4096, 14525,  4096,  4096,  4096, 14528,  4096,
- 4096, 14533,  4096, 14538, 14541,  4096, 14544,  4096, 14547, 14550,
-14557, 14564, 14569, 14576, 14579, 14588,  4096,  4096,  4096, 14593,
-14598, 14607, 14612,  4096, 14619, 14624, 14629, 14636, 14639, 14642,
-14645, 14650, 14655, 14660,  4096,  4096, 14663, 14666, 14669,  4096,
- 4096, 14672,  4096, 14675,  4096, 14682,  4096, 14685, 14688,  4096,
- 4096,  4096,  4096, 14691,  4096,  4096, 14698, 14703, 14710, 14715,
-14724, 14727, 14734, 14737, 14742,  4096, 14747,  4096, 14754,  4096,
-14759, 14764,  4096,  4096, 14767, 14772,  4096, 14775,  4096,  4096,
-14778, 14781,  4096,  4096, 14784,  4096, 14791,  4096,  4096,  4096,
-14794, 14797, 14802, 14805, 14808,  4096, 14811,  4096, 14816, 14819,
-14824, 14827,  4096, 14830, 14833, 14838, 14841, 14848, 14851, 14858,
-14861,  4096, 14864, 14867,  4096, 14872, 14875, 14878, 14883,  4096,
- 4096,  4096,  4096, 14886, 14891, 14894,  4096,  4096,  4096,  4096,
-14899,  4096,  4096, 14902, 14905, 14910, 14917, 14922, 14927,  4096,
- 4096,  4096,  4096, 14932,  4096, 14935, 14942, 14949, 14952, 14957,
-14964, 14969, 14974, 14979, 14982, 14987, 14990, 14993, 14996,  4096,
- 4096,  4096,  4096, 15003,  4096, 15006,  4096, 15011, 15014, 15017,
-15020, 15027, 15032,  4096, 15035, 15040, 15043, 15048, 15055,  4096,
-15060, 15063,  4096, 15066,  4096, 15069,  4096,  4096,  4096, 15072,
-15075, 15078, 15081, 15086, 15089, 15092, 15095,  4096, 15100, 15103,
-15106,  4096, 15109, 15112, 15117,  4096,  4096, 15122, 15125, 15128,
- 4096, 15131, 15136,  4096,  4096,  4096, 15139, 15142,  4096,  4096,
- 4096,  4096,  4096, 15147, 15156, 15159,  4096, 15166, 15171,  4096,
- 4096, 15176, 15181, 15184, 15187,  4096, 15192, 15195, 15200, 15203,
-15208, 15211,  4096, 15214, 15217, 15220,  4096, 15225, 15234, 15239,
-15244, 15247, 15254, 15257, 15264,  4096, 15269, 15276, 15279,  4096,
-15282, 15285, 15290,  4096, 15293,  4096, 15300, 15303, 15306,  4096,
-15309,  4096,  4096, 15314, 15317, 15322, 15325,  4096, 15328, 15331,
- 4096,  4096, 15334, 15341, 15346, 15349,  4096, 15356, 15359,  4096,
- 4096, 15362, 15369,  4096, 15376, 15379,  4096, 15384,  4096, 15387,
-15392, 15397,  4096, 15402, 15407, 15414, 15417, 15424, 15429, 15434,
-15439, 15442,  4096,  4096, 15449, 15456,  4096,  4096, 15461, 15464,
-15471,  4096, 15476,  4096, 15483, 15486, 15489, 15492, 15499, 15504,
-15507,  4096, 15510,  4096, 15513,  4096, 15516, 15521, 15524,  4096,
- 4096, 15527, 15530, 15537, 15540,  4096,  4096,  4096,  4096, 15543,
-15546, 15551, 15556, 15559, 15568, 15573, 15578, 15587, 15594, 15601,
-15606, 15609, 15612,  4096, 15617, 15620, 15623, 15626, 15631, 15638,
-15647, 15656, 15661, 15666, 15673,  4096, 15684, 15689, 15694,  4096,
- 4096, 15699, 15702, 15707, 15710, 15721, 15728, 15735, 15738, 15741,
-15746,  4096, 15749, 15752, 15755, 15758, 15763, 15766, 15769, 15772,
-15777, 15788, 15795, 15802, 15811, 15814, 15817,  4096, 15820, 15823,
-15826,  4096, 15831, 15838,  4096, 15843, 15848,  4096, 15853,  4096,
-15858, 15861, 15866, 15869, 15874, 15879,  4096,  4096,  4096,  4096,
-15884, 15887,  4096,  4096, 15890, 15895,  4096, 15898, 15903, 15906,
-15909, 15914,  4096, 15919,  4096, 15924, 15931,  4096, 15936, 15943,
- 4096, 15946, 15949, 15952, 15955, 15964, 15969, 15976, 15979, 15984,
-15991, 15994,  4096, 15997, 16002,  4096,  4096,  4096, 16007, 16012,
-16019, 16024, 16031, 16038, 16043, 16046, 16053,  4096,  4096, 16056,
-16059, 16062,  4096, 16065,  4096, 16068, 16071, 16074, 16083, 16088,
-16093, 16096, 16101,  4096, 16104,  4096, 16107, 16116, 16119, 16124,
- 4096,  4096,  4096,  4096, 16127, 16130, 16133,  4096, 16138, 16141,
- 4096,  4096,  4096, 16146, 16153, 16156, 16161, 16164, 16167, 16170,
-16173, 16176, 16181,  4096,  4096, 16184, 16187, 16192,  4096, 16195,
-16198, 16201, 16208, 16213,  4096, 16220, 16225, 16230, 16235, 16242,
-16245, 16252, 16257, 16262,  4096,  4096, 16271, 16274, 16277,  4096,
-16280, 16283, 16288,  4096,  4096, 16291, 16294, 16297, 16302, 16305,
-16308,  4096, 16311,  4096, 16314, 16323, 16328,  4096, 16331,  4096,
-16336, 16341,  4096, 16346,  4096, 16351,  4096, 16358,  4096, 16361,
- 4096,  4096, 16364, 16369,  4096, 16372, 16375,  4096, 16382,  4096,
- 4096,  4096,  4096, 16385, 16388, 16395, 16400, 16409, 16418, 16433,
-16440, 16451, 16456, 16463, 16466, 16477,  4096, 16482, 16491, 16496,
-16499, 16502, 16511, 16514, 16519,  4096,  4096, 16524, 16527, 16530,
-16533, 16538, 16541, 16546, 16549, 16556, 16561,  4096, 16566, 16571,
-16580, 16589,  4096, 16596, 16601,  4096,  4096, 16606,  4096, 16611,
-16616, 16619, 16622,  4096, 16625,  4096,  4096, 16630, 16633, 16636,
- 4096, 16641, 16646, 16649,  4096,  4096,  4096, 16652, 16655,  4096,
-16658,  4096,  4096, 16661, 16664, 16667, 16672, 16675, 16678, 16681,
-16684, 16687,  4096,  4096,  4096,  4096, 16690, 16695, 16698, 16703,
- 4096, 16708, 16713, 16720, 16725, 16732, 16739, 16742, 16747, 16752,
-16755,  4096, 16758,  4096, 16761, 16768, 16771, 16774,  4096,  4096,
-16777, 16782, 16787, 16790,  4096,  4096, 16793, 16798, 16805, 16810,
-16813, 16820, 16823,  4096, 16828,  4096, 16833,  4096,  4096,  4096,
-16836, 16839,  4096, 16842, 16845, 16848, 16853, 16856, 16859,  4096,
-16864,  4096,  4096, 16867,  4096, 16870, 16873, 16878, 16885, 16888,
-16901, 16904, 16909, 16914, 16921, 16924, 16929, 16934, 16943, 16952,
- 4096,  4096,  4096, 16955,  4096, 16960, 16963, 16966, 16969,  4096,
- 4096, 16972, 16975,  4096, 16978,  4096,  4096,  4096, 16981, 16984,
- 4096, 16989, 16994, 16997, 17000, 17003, 17006, 17013, 17018, 17023,
-17028, 17033,  4096,  4096,  4096, 17038,  4096,  4096, 17041,  4096,
- 4096, 17046,  4096,  4096,  4096, 17049,  4096, 17052, 17057, 17062,
-17065, 17068,  4096, 17071, 17074, 17077,  4096, 17086, 17089, 17092,
-17095, 17102, 17105, 17110, 17115,  4096, 17118, 17121, 17126,  4096,
-17129, 17134,  4096, 17137,  4096,  4096, 17140, 17143,  4096,  4096,
- 4096, 17146, 17149, 17152, 17159, 17166, 17169,  4096, 17172, 17175,
-17180, 17189, 17196, 17199, 17202, 17205, 17210,  4096,  4096,  4096,
- 4096, 17213,  4096, 17218, 17221,  4096, 17228,  4096, 17233, 17238,
-17241,  4096, 17244, 17249, 17252, 17257, 17260, 17267, 17270, 17275,
-17278, 17283,  4096,  4096, 17286,  4096, 17291,  4096, 17298, 17307,
-17312, 17317, 17324, 17329, 17332, 17335, 17338, 17341, 17344, 17347,
-17352, 17357, 17362, 17367, 17372, 17375, 17382, 17389, 17392, 17403,
-17408,  4096, 17411, 17414, 17421, 17426, 17433, 17438, 17443,  4096,
-17448,  4096, 17451,  4096, 17454, 17461, 17468,  4096, 17471, 17476,
-17483,  4096, 17486, 17489, 17492,  4096,  4096, 17497, 17500, 17503,
- 4096,  4096,  4096,  4096, 17510, 17517,  4096, 17520, 17523, 17530,
-17533, 17536,  4096, 17539,  4096, 17542, 17545,  4096,  4096, 17548,
-17553, 17556, 17559, 17562, 17565, 17570, 17573, 17578, 17581,  4096,
-17586,  4096, 17589,  4096,  4096, 17592,     0,     1,   565,  8621,
-    1,   700, 60856,     1,   999, 12549,     1,  3802,  2910,     1,
-  342, 40903,     1,  3036, 20684,     1,  3082, 39925,     1,   677,
-62074,     1,  2498, 28221,     1,   890, 46293,     2,  2965, 61355,
- 3510, 56632,     1,  2481, 49074,     1,  2165, 59737,     1,  1086,
-10411,     2,  1997, 43325,  3417, 36851,     1,  3808, 26552,     1,
- 1763,  6093,     2,   335, 62685,  1889, 11249,     1,  2260,  8987,
-    1,  2144, 11294,     2,   503, 44554,  3378, 20788,     1,  2970,
-33396,     2,    52, 24850,  2406, 35377,     2,   423, 34819,  2220,
-37979,     1,  3743, 57855,     1,  1550,  3049,     1,  2373, 55510,
-    2,  2484, 15723,  3418, 44945,     2,   912, 58597,  1714, 36070,
-    1,   145, 13698,     2,   319, 53997,  2535, 55031,     1,   639,
-37910,     3,  2985, 65354,  3325,  2453,  4027, 13852,     2,  3141,
- 9862,  3202,  5240,     3,   644, 22080,  2832, 20467,  4115, 12015,
-    1,  4624, 28030,     2,   521, 57619,  4179, 46154,     2,   431,
-34969,  2177,  5353,     1,   432, 34969,     1,   117, 21934,     1,
- 1782,  5258,     1,  2765, 22156,     1,  2132, 11349,     1,  2239,
-11629,     1,  4186, 33411,     2,  1862, 52977,  1911, 29829,     1,
- 1061,  4783,     2,   268, 39503,  3852, 49539,     1,  1502, 36198,
-    2,   281, 35245,  2022, 18852,     1,  3812, 35726,     2,   168,
-46517,  3020, 13198,     1,  1693, 20494,     3,   974, 53203,  2426,
-42382,  4100, 31469,     1,  2133, 24768,     5,   113, 15505,   246,
-44635,   525, 24345,   725, 19012,  2716, 47072,     2,  1978, 11004,
- 4985, 32380,     1,  5025, 32380,     1,  5065, 32380,     3,   368,
-42146,  4622, 63423,  5105, 32380,     2,  1757, 40187,  5145, 32380,
-    1,  5185, 32380,     1,  5225, 32380,     1,  3841, 22412,     2,
-  867, 44063,  3531, 42722,     1,  3260, 18054,     1,   754, 12262,
-    1,  1264, 60025,     1,  1081, 44543,     1,  4682, 63644,     4,
-  643, 28932,   817, 62878,  1906, 11073,  4722, 63644,     2,  1001,
-11950,  4762, 63644,     1,  4802, 63644,     3,   334, 10466,   688,
-35285,  4842, 63644,     2,  3451, 36801,  4882, 63644,     3,  2051,
-41086,  4922, 63644,  5003, 14274,     2,  4962, 63644,  5043, 14274,
-    3,  1030, 49574,  2527, 40152,  5083, 14274,     1,  5123, 14274,
-    3,  2488, 24341,  4061, 21252,  5163, 14274,     1,  5203, 14274,
-    2,   404, 61257,  5243, 14274,     1,  3476, 40573,     1,  1935,
-40209,     3,  1111, 52961,  1813, 15014,  3643, 40265,     1,  4691,
-40309,     3,  2418, 60233,  2603, 54457,  4731, 40309,     2,  1123,
-30366,  4771, 40309,     4,   667,  6544,  2400, 31976,  3424, 29647,
- 4811, 40309,     3,  2905, 51298,  3014, 11901,  4851, 40309,     2,
- 4891, 40309,  4987,  9066,     2,  4931, 40309,  5027,  9066,     3,
- 3683,  6339,  4971, 40309,  5067,  9066,     1,  5107,  9066,     1,
- 5147,  9066,     5,  1311,  2729,  1474, 52410,  2627, 63753,  2668,
- 5182,  5187,  9066,     1,  5227,  9066,     1,  3585, 61675,     2,
- 1381, 55360,  1943, 59431,     2,  3389, 37852,  3503, 58724,     1,
- 3324, 29157,     3,   442, 32842,  1760, 30594,  2170, 14646,     1,
- 4137, 30918,     4,    78, 40351,  1566, 11656,  1806, 31564,  2625,
-21395,     1,  1724, 10672,     2,  3254, 17865,  3703, 63522,     1,
- 1290,  2341,     1,  2529, 63959,     2,    27, 51816,  2947,  8159,
-    3,  1933, 44711,  2307, 43425,  2935, 51260,     2,  2926, 17997,
- 2974, 50244,     1,  1898, 47453,     3,   118, 43648,  1204,  8060,
- 3882,  8464,     1,  3574, 61344,     2,  1223, 49812,  4636, 37379,
-    4,   171, 41372,  1931, 47768,  2996,  9673,  3822, 55874,     1,
-  242, 56676,     1,  2176, 49744,     2,  1025, 48620,  2698, 19985,
-    1,  4648, 38867,     1,  2408, 64491,     4,  1006, 64135,  3392,
-18801,  3675, 63330,  3767, 28960,     1,  4053, 24133,     1,  2565,
-48575,     2,  1738, 62632,  3733, 58465,     2,  1958, 37210,  3426,
-51283,     1,  1775,  4237,     2,  2195,  1975,  4196, 14692,     1,
- 2574,  9769,     4,   374, 46683,   603, 57055,  2355, 11799,  4101,
-18875,     1,  2341, 15357,     1,  3481, 16660,     1,   991, 32652,
-    2,  1559, 40759,  3663, 64437,     1,  1077, 58285,     1,  3785,
-21862,     1,  2616, 30424,     1,  3728, 49193,     2,   578, 42162,
- 2098,   607,     1,  1764,  5955,     4,    72,  1636,  2403, 50620,
- 3517, 57409,  4644, 53994,     2,   560,   118,  3021, 50901,     1,
- 3837, 46929,     1,  3068, 65309,     1,   543, 61057,     1,  1574,
- 1171,     2,    26,  5383,  2496,  7959,     1,   928, 21498,     2,
- 1788, 57277,  3365,  8451,     2,   682, 13269,  4610, 37872,     2,
- 3088, 35422,  3781, 54517,     1,  4673, 35615,     4,   951, 48155,
- 1346, 32759,  3541, 49421,  4713, 35615,     3,  2494, 13492,  3951,
- 5811,  4753, 35615,     3,   211,  6787,  1856,  5438,  4793, 35615,
-    3,  1250, 61510,  4609, 51487,  4833, 35615,     2,   612,   745,
- 4873, 35615,     4,   131, 49641,  1554, 64738,  3596,  3744,  4913,
-35615,     2,  1360, 20482,  4953, 35615,     2,  1672, 19151,  3108,
-46008,     3,  2291, 17998,  3357, 20331,  3736, 21491,     3,    85,
-57075,   989, 20964,  1532, 49831,     1,  2881, 20026,     2,   576,
-42731,  2635, 18144,     1,  3458, 16632,     1,   638, 10750,     2,
-  731, 13850,  3351, 17930,     3,  1318, 19471,  1561, 47159,  4423,
-19574,     3,  2823, 19029,  4430,  8853,  4449, 19574,     3,  2818,
-48192,  4456,  8853,  4475, 19574,     2,  4482,  8853,  4501, 19574,
-    4,  2829, 40280,  3089, 62710,  4508,  8853,  4527, 19574,     3,
- 3905, 57922,  4534,  8853,  4553, 19574,     4,  2495, 38658,  2632,
- 5225,  4560,  8853,  4579, 19574,     2,  1220, 42935,  4586,  8853,
-    3,   694,  1484,   841, 25404,  3197, 33435,     1,  3164, 34695,
-    1,  3263, 16431,     2,   226, 30501,  2310, 53707,     1,  2619,
-39411,     1,  3701, 18058,     1,  3935, 45485,     1,  3147, 43792,
-    3,   314, 60715,  2686,   704,  4107, 62351,     3,   696, 10801,
- 1341,   956,  2259, 26202,     1,  1537, 35738,     1,  3191, 28587,
-    2,  2657, 12644,  3597, 30214,     1,  3860, 55788,     1,   328,
-42062,     1,  3780,  7245,     1,   295, 27183,     1,  3219,  4306,
-    2,    32, 11748,  5010,  6213,     4,   248, 60963,   302, 22514,
- 4605, 16499,  5050,  6213,     1,  5090,  6213,     2,  2421, 50439,
- 5130,  6213,     2,  2598,   496,  5170,  6213,     2,  5008, 55488,
- 5210,  6213,     3,  3182, 62290,  5048, 55488,  5250,  6213,     4,
-  422, 26288,  3642, 27124,  3956, 30177,  5088, 55488,     2,  1251,
-12160,  5128, 55488,     1,  5168, 55488,     2,   889, 62131,  5208,
-55488,     1,  5248, 55488,     1,  3687,  2540,     1,  2143, 59198,
-    1,  2500, 33068,     1,  2672, 58064,     3,   994, 60450,  1635,
-24965,  3832, 46256,     1,  1749, 48656,     2,  1229, 41014,  2906,
-35236,     1,  4140,  7127,     1,  1451, 34878,     2,  1668, 62471,
- 2211,  3340,     2,  1232,  9979,  1942, 40147,     3,  2200,  6420,
- 2207, 36952,  4150,  1318,     2,  4217,  1598,  4669, 44049,     2,
- 4243,  1598,  4709, 44049,     3,  2725, 35812,  4269,  1598,  4749,
-44049,     3,  1265, 33016,  4295,  1598,  4789, 44049,     5,   265,
-32605,  3464, 40839,  3894, 60753,  4321,  1598,  4829, 44049,     2,
- 4347,  1598,  4869, 44049,     3,  3637,  9286,  4373,  1598,  4909,
-44049,     2,  4399,  1598,  4949, 44049,     1,  2718,  7571,     1,
-  692, 51295,     2,   882, 21991,  3766, 23956,     1,   624, 29873,
-    1,  1126, 20705,     2,   818, 35182,  1659,  3029,     1,   235,
-33622,     1,   322,  8435,     1,  2792, 15256,     1,  1413, 61370,
-    3,   470,   451,  2900, 17439,  3371,  1336,     1,   484, 60073,
-    3,   927, 48859,  1456, 18073,  4014, 13914,     1,   480, 52993,
-    3,  2287, 30972,  3838,  8767,  4168, 53668,     1,  1417, 32838,
-    2,   558,  8529,  3275, 29778,     1,  3185, 54845,     2,  1538,
-25133,  3924, 18165,     1,   377, 16285,     1,   623, 51570,     2,
-  752, 10546,  1312, 34397,     1,  3271, 15927,     3,  1640, 40966,
- 3273, 24897,  4136, 27968,     2,  2299, 62063,  3183, 49902,     2,
-  541, 17117,  4630, 14122,     1,   481, 54009,     1,  1194, 57083,
-    3,  2412, 52821,  2576, 25490,  3162, 33524,     3,  2909, 57773,
- 3431, 16073,  3759,  1675,     1,  1116, 24405,     1,    83,  4512,
-    1,  2379, 61099,     1,  2154, 48648,     1,  2162, 28022,     3,
-  758, 57038,  2660, 11168,  5266, 18451,     1,   940, 26484,     2,
- 1954, 49566,  2892, 47967,     1,   887, 47107,     2,  3096, 23041,
- 4212, 44013,     1,  2001, 39122,     1,  3547, 24815,     3,    49,
-44013,  3231,   865,  4603,  8579,     1,  2476, 51212,     2,  1771,
-23331,  4211, 47097,     1,  1192, 21696,     1,  3393, 55538,     2,
- 1053, 39560,  3908, 23903,     2,  3806, 11038,  4003, 57499,     2,
-   64, 61386,  2774, 30329,     1,  3148, 14002,     1,  3236, 10990,
-    1,   360,  9319,     2,  3444, 44381,  3471, 57369,     1,  1774,
-32276,     3,   110, 54694,  3314, 40523,  3965, 28681,     1,  4632,
-63295,     4,   962, 32175,  1138, 11499,  3668, 43920,  3930, 41356,
-    1,   251, 14887,     3,  1022, 35237,  1330, 30246,  1589, 35329,
-    2,  2638, 11102,  5012, 29565,     3,   240, 33531,   869, 28695,
- 5052, 29565,     1,  5092, 29565,     2,  2513, 20620,  5132, 29565,
-    4,   709, 16712,   967, 59149,  1556, 19799,  5172, 29565,     2,
- 1327, 50726,  5212, 29565,     1,  5252, 29565,     1,   436, 38661,
-    1,  2675, 25574,     1,  2636, 39468,     2,   490, 38215,  1443,
- 6328,     1,   491, 38215,     2,   755, 48994,  4048, 31034,     2,
- 3208, 54704,  3469, 33153,     1,  3994, 39102,     1,  1049,  7490,
-    1,   266, 53674,     1,  1713, 12537,     1,  3890, 21172,     2,
- 3407, 43431,  3814, 19782,     1,   390,   660,     2,    44, 18941,
- 1446, 48528,     2,  2208, 24192,  2876, 62543,     2,  2074, 22771,
- 2894, 62826,     1,  5265, 63261,     2,  3029,  4493,  3552, 56801,
-    2,   444, 58663,  2290, 53526,     3,  2634, 31092,  3352, 50456,
- 3691, 46868,     1,  4685, 54087,     2,  3602,  4813,  4725, 54087,
-    2,  2357, 19430,  4765, 54087,     3,   659, 54625,  1976, 62962,
- 4805, 54087,     1,  4845, 54087,     2,  1158, 44520,  4885, 54087,
-    3,  2255, 20703,  2409,  1207,  4925, 54087,     1,  4965, 54087,
-    2,   632, 37052,  1618, 63085,     1,  2327, 63035,     3,   789,
-56350,  2313, 16029,  3305, 64340,     1,   212, 64246,     1,   229,
-  947,     1,   112, 30471,     1,  3551, 16378,     3,  1504,  5820,
- 3087, 15219,  3600, 57051,     4,   749, 52360,  1287, 32736,  1636,
-54256,  3515, 12659,     3,   880, 61303,  3079, 58357,  3613, 30767,
-    2,  3494, 42053,  4089, 42173,     1,  3176, 18330,     3,  1074,
-62437,  1225, 52854,  3206, 26311,     1,  3561, 28045,     1,  3214,
-60301,     1,    34, 16521,     1,  2217, 34104,     2,  2122, 40343,
- 3807,  6774,     1,   103, 41809,     1,  2369, 14867,     1,  3072,
-43015,     2,   614,   392,   954, 65353,     2,  1583, 26142,  3619,
-21101,     1,  2701, 43695,     1,  1009, 33119,     2,   466, 17258,
- 3918,  7259,     2,   569, 56684,  4018, 52237,     3,  1035, 62521,
- 1989,  8355,  2971, 54192,     2,  1050, 30243,  2514, 58552,     1,
-  537, 43092,     1,   274, 12637,     2,  1234, 31419,  2096, 31168,
-    2,   843, 43779,  3658, 45949,     1,  4062, 49823,     1,   561,
-32106,     1,  3113, 54908,     2,  3516, 33551,  4429, 44372,     2,
- 3346, 47233,  4455, 44372,     2,  3146, 48061,  4481, 44372,     2,
-  864, 44420,  4507, 44372,     3,  1754, 45208,  2316, 22229,  4533,
-44372,     2,  4559, 44372,  5013, 44243,     3,  1973, 11645,  4585,
-44372,  5053, 44243,     3,  2071, 63733,  4427, 16876,  5093, 44243,
-    2,  4453, 16876,  5133, 44243,     3,  3242, 41504,  4479, 16876,
- 5173, 44243,     2,  4505, 16876,  5213, 44243,     5,  1257, 17096,
- 2968, 60323,  4531, 16876,  5253, 44243,  5267, 51313,     2,   784,
-22294,  4557, 16876,     2,  1201, 39748,  4583, 16876,     1,   228,
-41678,     1,  3475, 23067,     1,  1525,  3379,     1,  1607, 59410,
-    4,   733,  9740,  1073, 54312,  2990, 11583,  4001, 18588,     2,
-   28, 41136,  3606, 49541,     1,  2140, 23463,     2,   715, 49969,
- 3605,   479,     1,  1066, 57871,     2,   965, 59277,  3758, 12078,
-    1,   708, 49699,     2,  1310, 26695,  4102,  5384,     1,  2673,
-14481,     1,  1927, 18116,     1,  4000, 47543,     1,  3761, 22952,
-    3,   877, 46352,  1778, 40460,  4230, 37180,     4,   477,  3078,
- 1255, 17926,  3031, 53502,  4256, 37180,     3,   345, 43279,  4054,
-40077,  4282, 37180,     3,  2546, 48188,  2999, 18538,  4308, 37180,
-    1,  4334, 37180,     2,  3237, 47968,  4360, 37180,     1,  4386,
-37180,     3,   350, 16849,  4133, 42853,  4412, 37180,     2,   468,
- 6949,  1054, 41456,     3,   796, 42119,  1288, 46920,  4174, 32781,
-    1,   719, 46591,     1,  4238, 10640,     2,   363, 27607,  4264,
-10640,     2,    10, 51927,  4290, 10640,     1,  4316, 10640,     1,
- 4342, 10640,     4,   791,  6196,  1203, 23817,  3107, 37142,  4368,
-10640,     3,  1383, 52357,  2324, 62694,  4394, 10640,     3,   354,
- 7681,  1253, 11060,  4420, 10640,     2,  1605, 53815,  2008, 33705,
-    1,  3595, 49832,     2,   372, 60940,  3358, 51409,     1,  2364,
-20758,     1,  3995, 33192,     3,   193, 29426,  1832, 19665,  2524,
-15507,     1,  3985,  5552,     1,  3875,  3155,     1,  4080, 21515,
-    1,  2448, 48303,     1,  3410, 59436,     2,  2795, 13322,  2830,
-51090,     1,  2784, 50060,     1,  1358, 62045,     1,  2346, 25451,
-    2,  1614, 64862,  2665, 62992,     2,  2552, 20821,  2932, 48602,
-    1,  2149, 43530,     3,   712, 26886,  3362, 19847,  4655, 52270,
-    1,  4695, 52270,     1,  4735, 52270,     2,  1716, 21078,  4775,
-52270,     1,  4815, 52270,     2,  2539, 51422,  4855, 52270,     2,
-  286, 17898,  4895, 52270,     2,  2497, 60067,  4935, 52270,     1,
- 2258, 39379,     1,  3359, 14149,     1,  2891, 41081,     2,   904,
-58431,  1098, 33602,     3,   101, 35667,  3881, 64701,  4608, 13541,
-    3,   202, 61426,  2223, 53567,  3343, 55066,     1,  2526, 42968,
-    2,   550,  5180,  5269, 29595,     1,  3251, 23416,     1,  1127,
-17931,     3,  2853, 34781,  3824, 31105,  4041, 53367,     2,  2225,
-21521,  4690,  4160,     1,  4730,  4160,     2,  1389, 23981,  4770,
- 4160,     2,  3245, 62178,  4810,  4160,     2,  4006, 43162,  4850,
- 4160,     1,  4890,  4160,     3,    22, 30305,   312,  4714,  4930,
- 4160,     2,  2183, 21557,  4970,  4160,     1,   568, 57802,     1,
- 3571, 38423,     1,   473, 62774,     1,  3009, 38592,     2,  1385,
-24514,  3169, 31076,     1,   129,  1475,     1,  3998, 34297,     2,
- 2003, 32844,  3400,  9366,     2,  1131, 24098,  3926,  6955,     1,
- 3535,  5017,     2,  1433,  9759,  1884, 23906,     2,   366, 22154,
- 1513, 37159,     2,  1063, 30297,  1219, 39391,     1,  3864, 15725,
-    2,  1027, 60439,  2044, 59055,     3,  1056, 17639,  1407,  5170,
- 4052,  6314,     1,  2300, 50338,     1,   333, 15516,     2,   249,
-25686,  1665,  1108,     2,  3229,  8280,  3928, 30530,     1,   361,
- 8277,     1,  2453, 57538,     1,  3710, 56945,     1,  4635, 23011,
-    3,  1405, 17261,  1684,  7350,  3690, 42800,     1,   584, 11593,
-    1,   751, 49169,     1,   802, 55151,     1,  4154, 51077,     3,
- 1285, 54357,  1305,  4246,  2609, 56461,     3,  2610, 59961,  3212,
-45482,  3705, 59598,     1,  3319, 27091,     1,  2168, 46461,     2,
- 1846, 16628,  2848, 47047,     1,  2109, 23929,     2,   161, 36340,
- 3969, 26517,     1,   177, 50018,     1,  3896, 50158,     2,   726,
-26601,  1897,   962,     1,  2621, 58356,     1,  2171, 17603,     2,
- 2343, 37723,  3228,  4378,     1,  1463,  8838,     1,  1470, 64024,
-    2,  3662, 43043,  4623, 49101,     1,  2851, 57856,     2,   620,
-30775,  2472, 32501,     2,  1103,  5824,  2559, 13945,     1,  3724,
-27184,     1,  2085,  5625,     2,   910,  2405,  2800, 21960,     3,
- 1314, 12144,  3825, 31960,  4023,  7404,     2,  1338, 27858,  3738,
-54611,     2,    96, 15170,  1188,  5121,     1,   892,  4397,     2,
- 1412,  3195,  3609, 17244,     1,  3987, 57985,     1,  1847, 24956,
-    2,  2907, 49754,  3583, 31960,     1,  1243, 61958,     1,  4686,
-13759,     3,  2266, 58474,  3976, 42484,  4726, 13759,     1,  4766,
-13759,     7,   318, 49585,   950, 50028,  1275, 31055,  2180, 32528,
- 2936, 41529,  3569, 65008,  4806, 13759,     1,  4846, 13759,     2,
-  804, 65127,  4886, 13759,     2,  4926, 13759,  5007, 29925,     5,
- 2475,  4426,  3174, 39349,  3330,  9913,  4966, 13759,  5047, 29925,
-    2,  3607, 21817,  5087, 29925,     2,  3787, 52684,  5127, 29925,
-    1,  5167, 29925,     2,  1689, 55409,  5207, 29925,     3,  2579,
-  390,  3943, 39266,  5247, 29925,     2,    15, 65322,  2904, 47992,
-    2,   642, 49021,  2007, 40744,     1,  1414, 25536,     1,  1902,
-14257,     1,  1751, 44004,     1,  1379, 30834,     1,  4645, 61217,
-    1,   259, 28572,     2,  2419, 41222,  4204, 17014,     1,   658,
-63102,     2,   263, 25966,  1202, 37611,     2,  2530, 34094,  3830,
-61119,     3,  1855, 59664,  2845, 18123,  4030,  5715,     2,  2349,
-27442,  2978,  9012,     2,   580,  5251,  2402, 36394,     1,  2962,
- 7152,     1,  4176, 37965,     3,   139,  3800,  1984,  9998,  2961,
- 2131,     3,   441, 19569,  2213, 19418,  2793, 33378,     1,  3686,
-57893,     2,  1519, 32794,  3992, 12861,     2,   371,  9922,  2849,
-25878,     4,  1291, 28726,  2023, 12806,  3098, 38052,  3179, 42347,
-    1,  2827, 53577,     2,   966, 34466,  1703, 64468,     1,  3010,
-52650,     1,  3304, 47232,     2,  1679, 26817,  3534, 43442,     1,
- 2462, 59609,     2,  2246, 32194,  4173, 59602,     1,  1675, 45935,
-    3,   676, 29460,  1924, 54797,  3203,  8980,     1,  1370, 62491,
-    1,  1612, 50915,     3,   606, 12151,  2548, 37452,  4169, 57494,
-    2,  1368, 12046,  2509, 18752,     1,   365, 58831,     1,  3077,
-18908,     1,   182,  4772,     1,  3247, 40440,     2,  1617,  3294,
- 2991, 30440,     1,  2401, 49495,     1,  4974, 36341,     2,  2142,
-20454,  5014, 36341,     3,  1886, 24572,  3788,  5370,  5054, 36341,
-    2,  3955, 25303,  5094, 36341,     1,  5134, 36341,     1,  5174,
-36341,     2,   944, 31306,  5214, 36341,     2,   586, 49273,   819,
-27881,     3,  1712,  2987,  2669, 59811,  4656,  9309,     2,  1905,
-31647,  4696,  9309,     2,  4237, 46876,  4736,  9309,     2,  4263,
-46876,  4776,  9309,     3,  1333, 23078,  4289, 46876,  4816,  9309,
-    3,  2474,  7662,  4315, 46876,  4856,  9309,     2,  4341, 46876,
- 4896,  9309,     2,  4367, 46876,  4936,  9309,     1,  4393, 46876,
-    1,  4419, 46876,     1,  3138, 58873,     2,  3456, 42687,  3845,
-20277,     2,   831, 46069,  3945, 23342,     2,   832, 46069,  2594,
-26515,     1,  3049, 16517,     1,  3519, 27973,     1,  1639, 13664,
-    3,   908, 33602,  1085,  4170,  2516, 48923,     1,  2562, 49392,
-    2,  1174, 39442,  1321, 58762,     1,  1280, 15007,     1,  3391,
-29597,     2,   577,  4069,  1587, 15255,     1,  2126, 58319,     4,
-  894, 36113,  1552,  7485,  2411, 52587,  3294, 29090,     2,  2054,
-17612,  3771,  3241,     2,  2280, 60525,  3819, 52742,     1,  2821,
-31799,     1,  1364, 37783,     1,  1303, 48921,     2,   782, 56284,
- 1742, 28849,     2,  2010, 31376,  4651, 42926,     1,  4164, 39577,
-    2,   729, 52322,  2264, 25355,     1,  4443, 14108,     2,  1493,
-31932,  4469, 14108,     5,  3055, 24587,  3576,  4682,  4191, 39767,
- 4495, 14108,  4629, 21194,     1,  4521, 14108,     2,  3921, 43416,
- 4547, 14108,     1,  4573, 14108,     1,  4599, 14108,     1,  1940,
-14863,     1,  2241, 58262,     2,  2118,  2318,  3317, 28190,     1,
-  111, 65526,     3,  1043, 33526,  1919, 26397,  2560, 19548,     1,
-  247, 20005,     1,  3313, 20633,     1,  3811, 41812,     1,    31,
- 5027,     2,   287, 23803,  1454, 35085,     1,  1164, 53733,     1,
- 3910, 34093,     1,  3225, 14618,     1,  2232, 18626,     2,  1276,
-23388,  2817, 11862,     1,  1444, 51926,     2,    36, 25674,  2190,
-34040,     2,    65, 19431,  1128, 58455,     2,  1072, 26460,  1831,
- 9859,     3,  1058,   179,  3252, 39969,  3647, 52683,     2,   141,
- 9955,  1359, 47114,     3,  2269, 14279,  2742, 27085,  3829, 50115,
-    1,  1695, 47881,     1,  1438,  3533,     1,  1959, 18793,     1,
- 4138, 30395,     2,  1102, 11205,  1809, 41251,     1,  4197, 15813,
-    4,   924, 29737,  1034, 31721,  3046,  2791,  3332, 17977,     1,
-  687, 65267,     1,  3572, 36459,     1,  1207, 11917,     3,   172,
-24762,  3281,  3413,  3844, 24043,     1,  2801,  6414,     1,  3093,
-53266,     2,  3523, 37320,  4426,  1877,     2,  3139, 42463,  4452,
- 1877,     1,  4478,  1877,     3,   548, 25426,  2890, 49440,  4504,
- 1877,     2,  3066, 37379,  4530,  1877,     2,   256, 53007,  4556,
- 1877,     4,  2588, 41178,  2988, 54304,  3698, 61149,  4582,  1877,
-    2,  4213, 12838,  4984, 50444,     3,  1620,  4080,  4239, 12838,
- 5024, 50444,     3,  3751, 46308,  4265, 12838,  5064, 50444,     4,
- 1094, 19397,  3514,  3829,  4291, 12838,  5104, 50444,     4,  1866,
-24609,  3990, 39562,  4317, 12838,  5144, 50444,     2,  4343, 12838,
- 5184, 50444,     4,   875,  3205,  2415, 22686,  4369, 12838,  5224,
-50444,     1,  4395, 12838,     1,  2593, 48658,     1,  4134, 42660,
-    3,   735, 38769,  1807,  8837,  4019, 31967,     2,  2706, 62005,
- 3679,  1008,     3,   203, 54398,   836, 15977,  3441, 42346,     1,
- 4233, 35064,     2,  3712, 51635,  4259, 35064,     3,  1329, 28823,
- 2047, 44383,  4285, 35064,     2,  4075,  5708,  4311, 35064,     2,
- 3745,  4875,  4337, 35064,     1,  4363, 35064,     4,   427, 44464,
- 1075, 30817,  1702, 26715,  4389, 35064,     2,  3681, 32125,  4415,
-35064,     1,  3853, 50276,     1,  1722, 32517,     1,  2061, 24663,
-    1,  1945, 30693,     1,  2330, 36578,     1,   822, 27140,     1,
- 2397, 53755,     3,    39, 13658,  2358, 38732,  4028, 39828,     1,
- 1860,  6881,     1,   970, 16279,     1,  2387, 64670,     2,  1642,
-35223,  3961,  4825,     1,  1348, 59741,     1,  3549, 20097,     1,
- 3269, 54956,     3,   382, 47051,  3727, 13993,  4032, 52384,     3,
- 2127,  2730,  2502, 29641,  3649, 29959,     4,  1121,  6400,  3297,
-32118,  4016, 44824,  4129, 64213,     1,  1005,  5142,     1,  2684,
-50821,     1,  4215, 30382,     1,  4241, 30382,     1,  4267, 30382,
-    2,  2506, 51994,  4293, 30382,     4,   998, 15790,  2141,  2381,
- 3577, 16020,  4319, 30382,     2,   839, 48558,  4345, 30382,     3,
-  483,  1529,  1036, 29729,  4371, 30382,     2,  1498, 54466,  4397,
-30382,     1,   958, 26208,     1,  3972,  8168,     5,  1021, 48030,
- 1521, 23865,  2735, 20151,  3486, 62713,  3661, 51729,     1,   969,
-63499,     1,   364, 15808,     1,  2719,  4179,     2,   160, 30206,
- 2745, 14516,     1,   290, 18700,     1,  1184, 50097,     2,   891,
-52419,  3038,  5612,     2,   134, 20773,  2877, 23925,     1,  3292,
- 1662,     1,  3570, 59621,     1,  3809, 12017,     1,  4180, 26247,
-    1,    98, 15170,     2,  2182,  4474,  2350, 24421,     1,  3856,
-32402,     1,  1658, 29647,     2,  1120, 20609,  2493, 62876,     3,
- 1023, 36969,  1186, 50983,  5268, 39848,     1,  3789, 18623,     1,
- 3136, 15195,     2,   582, 40520,  1057, 19247,     2,  3608, 23829,
- 3773, 34823,     2,   460, 37776,  4978, 50402,     1,  5018, 50402,
-    1,  5058, 50402,     3,  1535, 33231,  1854, 55360,  5098, 50402,
-    2,  2825, 58942,  5138, 50402,     5,   116, 59648,   651, 36433,
- 2855, 41475,  3617, 57855,  5178, 50402,     1,  5218, 50402,     2,
- 1032, 24798,  3233, 64212,     1,   933, 27480,     3,   178,  5157,
- 2461,  9479,  2468, 63466,     2,  1594, 48703,  2079, 29966,     1,
- 1260, 50814,     2,  1409, 56536,  3131, 31521,     5,  1007, 27979,
- 1732, 51913,  2711, 10878,  3137,  4391,  4098, 42803,     2,  2449,
-27978,  3276, 17664,     2,  1570, 59258,  1896, 13700,     4,  1680,
-25960,  1800,  2745,  3580, 19484,  4236, 51942,     4,  2687, 17510,
- 3002, 55057,  3059, 47738,  4262, 51942,     2,  3983, 24199,  4288,
-51942,     3,  1685, 16272,  1974, 51384,  4314, 51942,     2,  1397,
-  392,  4340, 51942,     2,  1236, 36135,  4366, 51942,     1,  4392,
-51942,     2,  1815, 41022,  4418, 51942,     1,  1878, 42610,     1,
-  531, 31758,     1,  3094, 29425,     1,   434, 29798,     1,   435,
-29798,     1,   592, 24099,     1,   716, 22542,     1,   777, 60765,
-    2,  1350, 20330,  2734, 23007,     2,  1386, 62318,  3798,  9391,
-    1,  3550, 35288,     2,  1426, 60893,  2759, 25793,     1,  3320,
-12412,     1,  1515,  5536,     1,  4065, 57729,     1,   920, 53689,
-    1,    71, 20454,     4,  1547, 52188,  3775, 50995,  4132,  5886,
- 4653, 59438,     2,   456, 15402,  2212, 24950,     1,  1985, 36530,
-    1,  2222, 43858,     2,  3898, 27406,  3981, 16429,     1,  3156,
- 5419,     1,   605, 31503,     1,  3579, 60703,     1,  3433,  2048,
-    3,   294, 61166,  1969, 12252,  2106, 34645,     1,  2014, 21699,
-    5,   673, 28300,  1673, 56155,  1814, 53142,  3315,  4952,  4683,
-42137,     2,   301,  8450,  4723, 42137,     3,   411,  8874,  3340,
-55420,  4763, 42137,     1,  4803, 42137,     1,  4843, 42137,     2,
-  739, 43855,  4883, 42137,     2,  2376, 35584,  4923, 42137,     1,
- 4963, 42137,     1,  1157, 37347,     2,   104,  6073,  3989, 25552,
-    1,  2326,  7210,     1,  2611,  3068,     1,  3243, 57393,     4,
-   95, 65064,  2036,   136,  2637,  9650,  3248,  6668,     1,   463,
-47761,     1,   276, 49357,     1,   464, 47761,     1,  2802, 27868,
-    2,  1258, 59069,  3546, 30062,     1,  3858, 49992,     2,  3011,
-49346,  4155, 10948,     1,  3633, 41907,     1,  1880, 42985,     1,
- 4050, 60345,     1,  2362, 29888,     4,   184, 10120,   827, 10258,
- 1808, 49691,  1992, 53209,     2,   690, 14413,  1170, 10714,     3,
- 1100,  8618,  1637, 19161,  3640, 40520,     3,   183, 20527,  4436,
-20195,  4637,  9757,     3,  2754, 38715,  2815, 20133,  4462, 20195,
-    2,   488,  6221,  4488, 20195,     4,  1820, 43858,  4068, 13668,
- 4160, 26949,  4514, 20195,     1,  4540, 20195,     1,  4566, 20195,
-    2,   551,  9457,  4592, 20195,     3,   630, 20884,  2199,  3779,
- 3938,  6456,     1,  3272, 58961,     2,  2238, 62425,  2263, 61894,
-    1,  3097, 43137,     1,   376, 38115,     3,  1522, 23873,  2620,
-24854,  3902,  3963,     3,  2521, 33033,  2607, 39857,  2647, 11642,
-    1,   173,  7834,     3,   169, 31091,   471, 59886,  2026, 33259,
-    1,  1599, 54252,     2,  1424, 32066,  4118, 51343,     1,  1588,
-24348,     1,  1557, 59923,     2,   828, 10258,  2780, 46497,     1,
- 2303, 62516,     1,  3734,  3384,     1,   406, 10684,     2,  2758,
-13392,  4117, 54007,     1,  1108, 17711,     1,  2626,  1724,     1,
- 1233, 51802,     1,  3566, 22099,     1,  1489, 47398,     1,  1401,
-27884,     2,  1339, 39103,  1648, 57292,     1,  2757, 20135,     2,
-  138,  2050,   282, 43546,     2,   200, 60554,  2422, 53036,     1,
-   79, 36166,     3,  1524, 38680,  2351, 11736,  3828, 35356,     2,
- 3022, 16483,  3735, 57055,     1,  3226, 14218,     1,  2813,  5984,
-    1,  3723, 58445,     1,  1473, 49698,     2,  1107, 24723,  1643,
-41600,     2,  2694, 48096,  4126,  1715,     2,  1268, 58624,  1652,
-59085,     3,  2691, 36867,  3114, 26024,  4199, 13884,     2,  1485,
-36993,  4433, 46721,     2,  1139, 56720,  4459, 46721,     4,  1180,
-50235,  1656, 12322,  4153, 11151,  4485, 46721,     2,  1937,  6474,
- 4511, 46721,     3,   510, 63297,  1191, 13153,  4537, 46721,     2,
-  953, 53527,  4563, 46721,     4,   732, 52348,  1633, 38807,  2226,
-49999,  4589, 46721,     3,  1455, 59133,  3111, 16451,  4146, 10640,
-    2,  3413, 52617,  4676, 53860,     3,  2807, 34649,  2977, 32011,
- 4716, 53860,     3,     9, 28902,   532, 19875,  4756, 53860,     2,
- 2368, 57095,  4796, 53860,     6,   526, 25423,  1812, 52305,  2034,
-55045,  2872, 26425,  3118, 31483,  4836, 53860,     2,  2380, 36037,
- 4876, 53860,     2,  2568, 23314,  4916, 53860,     1,  4956, 53860,
-    2,  1646, 11857,  2308,  7784,     1,  1558, 20669,     1,  2288,
-58793,     1,  4073, 53208,     1,  1543, 39563,     1,   189,  2601,
-    1,  1402, 26968,     1,   308, 31308,     1,   224,  3502,     1,
-   91, 15725,     1,  3460,  2127,     1,  1162, 36073,     3,  3432,
-22486,  3557, 47886,  4157, 42143,     1,    41, 20221,     2,   514,
-28331,  3626, 20531,     1,   742, 33156,     3,  1002, 43496,  2435,
-50119,  3040, 25128,     3,   332, 39597,  1362, 36400,  4189, 12836,
-    1,  3634,  9231,     1,  4210, 57180,     3,  1721, 32355,  1802,
-10686,  3746, 46492,     3,  1406, 61757,  2048, 36078,  3559, 63075,
-    1,  2633, 11960,     1,  1462,  3618,     3,   341, 48827,  3909,
-17262,  4983, 59336,     1,  5023, 59336,     1,  5063, 59336,     1,
- 5103, 59336,     3,   833, 15241,  1916,  6388,  5143, 59336,     2,
-  834, 15241,  5183, 59336,     3,   163,  5275,  2812, 56998,  5223,
-59336,     1,   746, 60130,     1,  2811, 26508,     1,   449,  3140,
-    1,  3532, 32477,     1,   615, 31638,     1,  4122, 32360,     2,
- 1459, 51849,  3470, 13877,     1,  1478, 55141,     1,  1871, 63757,
-    4,   766, 30736,  1195, 41014,  2655,  6788,  4677, 59846,     3,
- 2912, 49033,  2986, 57580,  4717, 59846,     2,  3034, 33198,  4757,
-59846,     2,  2945, 64351,  4797, 59846,     2,   557, 57537,  4837,
-59846,     1,  4877, 59846,     5,   180, 22512,  2803, 18709,  2898,
-11069,  3603, 50761,  4917, 59846,     2,   997, 57375,  4957, 59846,
-    1,  2683, 30964,     1,   375, 57334,     1,  4059,  9021,     1,
-  617, 26692,     1,  2099, 19807,     1,   806, 28596,     2,  2836,
-26857,  3700, 34439,     2,  2566, 10784,  3699, 47158,     1,  2589,
-21224,     4,   567, 53587,  1701, 31890,  2383,  1271,  2940, 35336,
-    2,  1415, 10930,  3873,  8184,     1,  4672, 57122,     2,  3235,
-39258,  4712, 57122,     1,  4752, 57122,     3,  1222, 53342,  1968,
-10185,  4792, 57122,     2,  1256, 41828,  4832, 57122,     3,   959,
-12281,  3868, 33611,  4872, 57122,     1,  4912, 57122,     2,   148,
-56913,  4952, 57122,     2,  2596, 62235,  3287, 12882,     2,  1874,
-31502,  2025,  5594,     2,  2273, 31234,  2601, 41423,     2,  1014,
- 3589,  3865, 16048,     2,   373, 52106,  2973, 49538,     4,   380,
- 9807,  1464, 13503,  3629, 36393,  3887, 16671,     1,   598,  5041,
-    1,   261,  4278,     1,  3813,  4983,     2,   957, 38965,  2722,
-13356,     3,   253, 11602,  1572, 50802,  4083, 37975,     2,  2295,
-51264,  4184,   857,     1,  2240, 30205,     1,  2873, 56181,     1,
-  306, 21533,     1,   949, 31853,     3,   938,  9771,  2050,  4572,
- 3347, 50618,     3,  2272, 11622,  3311, 23665,  3594, 57577,     1,
- 2235,  8407,     2,  1296,  6883,  1998, 10841,     1,   919, 23387,
-    1,   231, 40461,     2,  3238, 26170,  4642, 43633,     3,  1796,
-24854,  2433, 39677,  2659, 49243,     1,  3520, 39960,     2,  1596,
-31297,  3285, 31235,     1,    84, 11735,     2,    12, 58971,  3404,
-59089,     1,   579, 55999,     2,   448, 61013,  1411, 57216,     1,
- 3109,  1881,     1,   564,  4316,     1,    60, 52612,     2,  1858,
-23585,  2125, 52044,     1,  2575, 50726,     1,  2201,  1513,     3,
- 2743, 50022,  2913, 57757,  3296,   980,     2,  1062, 45832,  1590,
-62842,     1,   107, 22765,     1,  4097, 59991,     2,  1467, 58633,
- 3670,  9578,     2,   100, 22961,   934, 32809,     2,   977, 44751,
- 3194, 11611,     1,  1031, 49024,     3,   668, 30732,  1282, 41738,
- 2015, 16694,     1,   857, 65131,     1,  3007, 53992,     1,  1395,
-42453,     1,  2585, 37491,     2,  3267, 43267,  3820,  3129,     2,
- 1677, 51925,  2751, 54304,     1,  1603, 26319,     2,  1965, 10573,
- 2964, 40281,     1,  2781, 23628,     1,  2120, 19350,     2,  2993,
-26081,  4202,   620,     2,  2707,  6259,  3720, 36681,     4,   788,
-37900,  1286, 21152,  1324,  5952,  2944, 39173,     1,  4163,  8122,
-    3,   622, 27047,  2159, 14524,  2365, 50411,     1,   909,  8618,
-    1,   257,   928,     4,    38, 17788,  1797, 51034,  2730, 36875,
- 3962, 60130,     2,   996, 40317,  1140,  7911,     1,  1531, 31032,
-    3,  2766, 24984,  3181, 16021,  4038, 35964,     2,   215, 64022,
- 2000, 53812,     1,  2959, 21123,     2,   509, 24026,  1654, 61935,
-    1,  3848, 53203,     2,    70, 11652,  3101,  7687,     1,  2315,
-33613,     2,  1272, 34431,  2685, 21740,     2,   801, 64043,  1134,
-60546,     1,  2381, 14619,     1,  1548, 14230,     2,  3442, 33269,
- 3638, 51360,     1,  3895, 17353,     2,   323,  8393,  4161, 55224,
-    1,   213, 46716,     4,   369, 36554,   975, 41352,  1723, 33615,
- 2234, 50574,     2,  1662,  1474,  3216,  6226,     2,   271, 21899,
- 3861, 43604,     1,  4147, 10627,     1,  1445, 42985,     1,  3512,
-33401,     2,   649, 55163,   979, 23624,     1,  3836,  7373,     2,
- 2131, 55571,  3473, 41015,     2,  3799, 51428,  4114, 51563,     1,
- 3796, 42312,     1,   250, 18914,     1,  2210, 39305,     1,  4671,
-42399,     1,  4711, 42399,     1,  4751, 42399,     1,  4791, 42399,
-    2,  3722, 32507,  4831, 42399,     3,  1440, 23932,  3693, 37659,
- 4871, 42399,     1,  4911, 42399,     2,  1189, 56194,  4951, 42399,
-    1,   981, 15950,     1,  3715, 28137,     1,  1109, 28256,     1,
-  756, 32344,     1,  2152, 15310,     2,  2069, 59925,  2528, 51881,
-    1,  3632,  9180,     1,  2360,  4121,     2,  3078, 45394,  3542,
-18597,     1,  2772, 64212,     3,  1307,  2270,  2153, 50078,  3904,
- 6837,     2,  3307, 10667,  3974, 65531,     3,  1492, 56372,  2958,
- 2382,  3341, 38498,     2,  1990, 28876,  2405, 63825,     1,  2622,
-56453,     1,  3353, 29119,     3,   150, 44684,  1900, 58199,  3833,
-22990,     3,  2846, 34179,  2886, 49025,  3472,  2398,     3,  2161,
-54240,  2339, 25526,  4688, 37428,     1,  4728, 37428,     2,  3110,
-55182,  4768, 37428,     2,  1309, 62275,  4808, 37428,     2,  3337,
-21145,  4848, 37428,     4,   321, 34671,  2236,  3991,  3800, 19948,
- 4888, 37428,     1,  4928, 37428,     4,  2760, 46305,  3645, 61106,
- 4219, 34272,  4968, 37428,     2,   590, 27881,  4245, 34272,     4,
-    5, 24899,   723, 36623,  4271, 34272,  4650, 55732,     1,  4297,
-34272,     5,  1244, 37500,  3752,  8366,  3967,  6842,  4064, 17221,
- 4323, 34272,     3,   931, 64033,  1770, 64522,  4349, 34272,     2,
- 3074, 56536,  4375, 34272,     1,  4401, 34272,     2,  1439, 65066,
- 4074, 29407,     1,  3539, 14515,     1,  4162, 53767,     1,  3871,
- 8243,     2,   858, 48068,  1284, 39621,     3,   876,  6670,  1293,
-21524,  3005, 12304,     1,  1366, 44690,     1,  1298, 38179,     3,
-  600, 24673,  1437, 57657,  4228, 20471,     2,   462, 60390,  4254,
-20471,     2,  3709, 28711,  4280, 20471,     1,  4306, 20471,     1,
- 4332, 20471,     1,  4358, 20471,     1,  4384, 20471,     1,  4410,
-20471,     1,  1844, 28257,     4,   230, 64296,  1698, 17244,  2649,
- 2099,  2788,  3496,     1,  2679, 26913,     1,   820, 22224,     1,
- 3978, 55000,     1,  3964, 33537,     2,  3360, 64168,  4049, 16012,
-    2,   767, 19661,  2859, 21454,     1,   144, 60087,     1,  3791,
-49194,     3,   309, 59165,  3115, 52867,  3997, 38568,     3,  1269,
-42832,  1899, 29140,  2077, 23040,     1,   208, 19872,     1,  1756,
-43949,     1,  3744, 43460,     1,  4980, 13051,     2,   410, 40472,
- 5020, 13051,     3,    55, 60951,  1252,  1772,  5060, 13051,     3,
-  589,  2584,   618, 20723,  5100, 13051,     4,   367, 42986,   812,
-13656,  1436, 31204,  5140, 13051,     4,   663, 13471,  2761, 43395,
- 3369, 15598,  5180, 13051,     1,  5220, 13051,     3,  1962, 59009,
- 2483, 42204,  3907, 23431,     1,   860, 64927,     1,  2746, 11745,
-    1,   520, 14479,     1,  4994, 47091,     3,  1313, 17117,  1995,
-36094,  5034, 47091,     3,  1932, 52412,  2191, 24497,  5074, 47091,
-    3,  1088, 53982,  2429, 64607,  5114, 47091,     1,  5154, 47091,
-    1,  5194, 47091,     3,  2298, 47234,  2305, 45452,  5234, 47091,
-    1,  4079, 56320,     1,  3140, 28235,     1,  2148, 27398,     2,
-  562, 38521,  3001, 23519,     2,  3012, 18812,  3436, 51992,     2,
- 2618,  2219,  2951, 44084,     1,  2366,   354,     1,   900, 43854,
-    3,   901, 35849,  1748, 61825,  2617, 38211,     2,  2398, 17863,
- 3054, 44237,     1,  3874, 65176,     2,   496,  8791,  3312, 15298,
-    4,   497,  8791,   720,  2864,  2544, 50537,  3200,  5494,     1,
- 4435, 23087,     3,  2700, 62926,  4461, 23087,  4668, 38674,     3,
- 3999, 15305,  4487, 23087,  4708, 38674,     6,   205, 50447,  1505,
-16592,  1582, 35413,  3779, 56124,  4513, 23087,  4748, 38674,     2,
- 4539, 23087,  4788, 38674,     5,   223,  4871,   241, 34671,  2345,
-24415,  4565, 23087,  4828, 38674,     3,  1231, 34981,  4591, 23087,
- 4868, 38674,     1,  4908, 38674,     1,  4948, 38674,     1,   264,
-30758,     4,   393, 39877,  1630, 56993,  2337, 14258,  4128, 13480,
-    3,  2501, 36765,  3157, 13730,  3931, 53648,     1,  2997, 18222,
-    1,  2333,  8331,     2,   413, 41233,  2444, 33524,     1,  4094,
- 3585,     1,  1602, 30239,     3,   114, 61274,   710, 63901,  1780,
-48256,     1,  1791, 47250,     2,   336, 54392,  2806, 14110,     1,
-  554, 23819,     1,  2024, 40475,     1,  2103, 19570,     1,  3501,
-22053,     2,   232, 53242,  1810,  3958,     3,  2247,  4655,  3604,
-32352,  3616, 49972,     1,  2187, 13421,     1,  2615, 22471,     1,
- 2667, 50124,     1,   795, 22068,     1,  2111, 22476,     1,   489,
- 8886,     1,  1597, 10110,     1,  2644, 40983,     1,  2218, 61262,
-    1,  4044,  3921,     1,  4175, 16949,     1,  2868, 40615,     1,
- 1864, 41960,     1,  3303, 47038,     1,   722,  9667,     2,   855,
-52415,  3166, 49767,     1,  4643, 17164,     2,  2629, 43056,  3504,
-36085,     1,  2525, 37590,     1,   825, 49235,     1,  4090, 29943,
-    1,  2062,  4261,     2,  1208, 59313,  2231,  5725,     2,    25,
-18807,  1710, 24059,     1,  2378, 20291,     1,  2728, 46502,     1,
- 4021, 56842,     1,   237, 25805,     1,  4099, 20481,     4,  1699,
-49315,  1798, 50003,  2363, 59103,  3624, 25738,     1,  2499, 39134,
-    1,  1173, 62960,     1,  1922, 29133,     3,   128, 30977,  2245,
-36075,  2938, 57674,     1,  1827, 14532,     2,  3211, 24570,  3975,
-31336,     2,  1752, 36844,  2816, 37532,     1,  3540,  3472,     1,
- 1161, 51830,     1,  2018, 60427,     1,  2447, 45766,     1,  1759,
-24763,     3,   522, 46733,  1065, 47568,  3763, 30027,     4,   613,
-62726,  1354, 65304,  3286, 23608,  4071, 62771,     2,   599, 53647,
- 1611, 12652,     2,   826, 49235,  2987, 34314,     1,  2923, 32903,
-    2,  2736, 64671,  3739, 28997,     1,  1390, 13141,     2,  3772,
-42598,  3952, 53867,     1,  1375, 45574,     1,  3917, 62391,     1,
- 1544, 18132,     3,  1725, 54126,  2438, 20521,  3130, 12816,     1,
-  626,  7601,     1,  2696, 40420,     1,  2658, 11625,     1,   187,
-49484,     1,  1486,  5774,     1,  2157, 55961,     1,   492, 45567,
-    1,  2705, 15232,     1,  4680, 43632,     2,  2425, 56853,  4720,
-43632,     2,  2992, 44208,  4760, 43632,     1,  4800, 43632,     2,
- 3711,  8172,  4840, 43632,     1,  4880, 43632,     1,  4920, 43632,
-    4,  1573,  3086,  1949, 46396,  3646,  2208,  4960, 43632,     1,
- 3872,  5622,     2,  3555, 15334,  3888, 59332,     2,  1283, 32952,
- 4638, 56406,     1,  4220, 43911,     1,  4246, 43911,     2,  2819,
-37849,  4272, 43911,     2,  1761, 21082,  4298, 43911,     1,  4324,
-43911,     5,   556, 45970,  1691, 42678,  2354, 63519,  4350, 43911,
- 4627, 11743,     2,  2551, 32593,  4376, 43911,     2,  2843, 48952,
- 4402, 43911,     1,   971, 59441,     1,  5001, 46703,     3,  1686,
-12478,  3525,  8213,  5041, 46703,     1,  5081, 46703,     3,  2507,
-15183,  3621, 63297,  5121, 46703,     4,   133, 41740,  1848, 40175,
- 2252, 43585,  5161, 46703,     1,  5201, 46703,     1,  5241, 46703,
-    1,  4149, 57715,     3,   397, 20679,  2480, 33576,  3484,  3467,
-    2,   122, 54960,  2770, 62908,     1,   303,  6342,     2,  1852,
-53020,  3491, 48673,     2,  1682, 60837,  4078, 16512,     1,  3929,
-64254,     1,  1020, 54540,     2,   425, 54753,  3768, 15348,     1,
- 3284,  3189,     1,  3732, 54059,     2,  1344,  6973,  1683, 36791,
-    1,   307,  4190,     2,   244, 30590,  1777, 53383,     2,  2394,
-28218,  3676, 50461,     1,  1632,  1052,     1,  2645, 17624,     2,
- 2984, 39993,  3295, 21416,     1,  2206,  3982,     2,  1099, 23685,
- 2228, 37318,     1,  4664,  7486,     2,  1994, 51662,  4704,  7486,
-    3,  2320, 18365,  3826, 45267,  4744,  7486,     3,  1142,  5993,
- 3398, 27723,  4784,  7486,     3,   856, 64545,  1479, 59884,  4824,
- 7486,     1,  4864,  7486,     3,  2271,  4429,  2463, 28932,  4904,
- 7486,     1,  4944,  7486,     2,  2202, 51623,  2856, 41613,     1,
-  596, 50504,     2,   394, 46067,  3941, 38424,     3,  3527, 46717,
- 3543, 47873,  3680,   571,     1,  3430, 45099,     1,  4185, 48116,
-    2,   201, 54947,  1441,  8609,     1,  4998, 19359,     1,  5038,
-19359,     4,   337, 58227,   450, 41629,  1829, 44342,  5078, 19359,
-    1,  5118, 19359,     2,  1151, 13084,  5158, 19359,     1,  5198,
-19359,     1,  5238, 19359,     1,   893,  7104,     2,   166, 11387,
- 1200, 38977,     2,  1912, 64539,  3241, 26205,     2,  3447, 29903,
- 4076, 10989,     1,  1961, 14115,     4,   437, 55682,  1491,  8221,
- 1571,  1228,  4231,  5895,     2,  2882, 51250,  4257,  5895,     4,
- 1224, 19448,  2523,  2549,  3901, 48663,  4283,  5895,     3,  1371,
-44293,  3300, 30856,  4309,  5895,     4,   929, 22696,  2285, 59669,
- 4058, 62955,  4335,  5895,     3,  1908, 32873,  3650, 38573,  4361,
- 5895,     3,   633, 33697,  3495, 31260,  4387,  5895,     2,  4037,
-58342,  4413,  5895,     1,  3091, 50664,     1,   776,  4606,     2,
- 2455, 31310,  4234, 41419,     1,  4260, 41419,     1,  4286, 41419,
-    3,   283, 33996,  3652,  6371,  4312, 41419,     2,  1872, 36994,
- 4338, 41419,     3,  1834, 42748,  4364, 41419,  4675, 38472,     4,
- 2390, 36207,  3262, 10539,  4390, 41419,  4715, 38472,     4,  2151,
-16531,  2292, 61512,  4416, 41419,  4755, 38472,     2,  1726, 56096,
- 4795, 38472,     3,     1, 48137,  1136, 17590,  4835, 38472,     1,
- 4875, 38472,     3,   744, 40683,  1914, 36736,  4915, 38472,     1,
- 4955, 38472,     2,  2052,  5907,  3857, 62772,     1,    47, 25514,
-    2,  1776, 14334,  2783, 24053,     3,  1634, 15230,  3103,  1967,
- 4008, 17587,     1,  2805, 24361,     4,     7,  1918,   453, 26948,
- 1861, 47858,  2731, 22177,     2,  2458, 46868,  3452, 18200,     3,
- 1182, 23196,  1221,  8989,  2555,  5117,     2,  2414, 41532,  3195,
-26919,     2,    67, 38570,  3748, 36425,     3,  2173, 17416,  2229,
-31153,  2749, 44582,     2,  1421, 60614,  3591, 41952,     1,  3379,
-45766,     1,  2130, 25273,     2,   142, 13428,  3599,  7944,     1,
-  721, 55786,     1,  3959, 65124,     1,  2708, 33764,     3,   359,
- 6580,  1539,  5512,  2027, 28055,     1,  3310, 12440,     2,  2857,
- 2740,  3397, 54903,     1,  2946, 25562,     2,  2952, 26745,  4156,
-30115,     1,   946, 48012,     1,  3265, 17993,     1,  3308, 43448,
-    3,   549, 45886,   640, 27797,  2249, 23107,     1,   135, 48129,
-    1,  3810, 27910,     3,   126, 12222,  1096, 56754,  4979, 58280,
-    3,  1497, 16267,  1753, 33506,  5019, 58280,     2,  1951, 11591,
- 5059, 58280,     2,  4007, 30091,  5099, 58280,     2,   753, 21547,
- 5139, 58280,     1,  5179, 58280,     3,   311, 53389,  2842,  2142,
- 5219, 58280,     1,   222, 19254,     3,   108, 53695,  1793, 30262,
- 2033,  6857,     3,   269, 20355,  1013, 49113,  1838,  3456,     1,
- 1651, 55988,     2,  1112,  8822,  1567, 62300,     1,  3288,  3580,
-    2,  1238,  4965,  3697, 37110,     1,  1789, 24550,     2,  1316,
-40674,  3209, 40700,     2,  2586, 30490,  3003, 43182,     1,  3455,
-18573,     1,  2787, 36062,     1,   741, 40123,     1,  3232, 26117,
-    2,  3707, 18216,  3903, 42809,     1,  4170, 52927,     1,  2602,
-50744,     1,  3474,  4806,     3,  1690,  3685,  2840, 30577,  3042,
-63346,     2,  3412, 45806,  4438, 47296,     3,  1267, 39999,  3084,
-25567,  4464, 47296,     2,  3671, 50890,  4490, 47296,     4,  2692,
-61588,  3306, 17393,  4063, 51927,  4516, 47296,     3,   695, 20552,
- 2866, 62125,  4542, 47296,     1,  4568, 47296,     2,  1185, 11676,
- 4594, 47296,     1,  4086, 47344,     3,   258, 23991,  1783, 25670,
- 2762, 44340,     1,  3026, 57719,     1,  2377,  5006,     2,  1118,
- 5237,  3867,   644,     1,  2340, 35922,     4,  1979, 11146,  2323,
-59776,  2450, 58501,  2804, 18372,     1,  4232, 23945,     1,  4258,
-23945,     1,  4284, 23945,     2,  1380, 24676,  4310, 23945,     2,
-  881, 28024,  4336, 23945,     4,    40, 33038,  1183, 12972,  1708,
-45099,  4362, 23945,     1,  4388, 23945,     4,   272, 15831,  2477,
-57088,  3886, 25213,  4414, 23945,     1,  2606, 63799,     2,   574,
-36226,  3706, 57741,     1,  1801, 16177,     1,  3582, 59842,     2,
- 3982, 54821,  4639, 27077,     1,  2058, 61191,     2,  2136, 60810,
- 2181, 22592,     2,  3171,  4503,  4634, 19180,     1,  2948, 27337,
-    1,  3915, 39426,     1,  3984, 48871,     1,  3948, 30697,     2,
- 1171, 30525,  3958, 64561,     1,  2676,  6188,     1,   389, 23845,
-    3,  3170,  8809,  3264, 41922,  3513, 29734,     1,  3988, 24933,
-    1,  2274, 64323,     1,  4439, 63477,     2,  1078, 41615,  4465,
-63477,     1,  4491, 63477,     2,   666, 39900,  4517, 63477,     3,
- 1304, 52226,  3855, 28028,  4543, 63477,     1,  4569, 63477,     1,
- 4595, 63477,     1,   234, 12834,     1,  3522, 36872,     1,  2278,
- 2916,     1,  2046, 18171,     1,   778, 63995,     5,  1418, 50415,
- 1767, 26886,  2517, 24087,  3058, 46392,  4997,  8848,     1,  5037,
- 8848,     2,  3434, 45290,  5077,  8848,     2,   878, 49083,  5117,
- 8848,     2,  3149,  3131,  5157,  8848,     2,  4222, 26085,  5197,
- 8848,     4,   916, 37670,  2942, 47100,  4248, 26085,  5237,  8848,
-    2,  3932, 17068,  4274, 26085,     3,  1664, 61144,  3390, 60891,
- 4300, 26085,     1,  4326, 26085,     1,  4352, 26085,     2,   813,
-37657,  4378, 26085,     5,   499, 38326,   523, 31546,   961,  6913,
- 3485, 54793,  4404, 26085,     1,   524, 31546,     2,   516, 31546,
- 5255, 19242,     1,  3478,  8484,     1,  3963, 14725,     1,   214,
- 2394,     1,  3019, 47606,     2,   978,  8868,  2934, 21976,     3,
- 1067, 63089,  1484, 12311,  4235, 34188,     4,   409, 34958,  2537,
-35894,  2661, 22849,  4261, 34188,     1,  4287, 34188,     1,  4313,
-34188,     1,  4339, 34188,     4,   254,  3567,  1082, 40442,  3651,
-50434,  4365, 34188,     1,  4391, 34188,     2,  1374, 31150,  4417,
-34188,     1,    97, 19959,     1,  2043, 39849,     1,  3665, 57178,
-    2,   386, 62397,  4013, 25261,     1,    46, 26313,     1,   937,
-23839,     3,   538, 51223,   907, 55652,  1317, 60909,     2,   945,
- 9102,  3849, 34061,     2,  1335, 40713,  2090, 60734,     1,  1929,
-13080,     1,   262, 65087,     3,   399, 40242,   948, 60379,  3816,
-27734,     2,  1581,  6071,  2393, 37872,     3,  1915,  4399,  2440,
-22842,  2753,  5571,     2,   588, 52498,  1132, 12995,     2,  1015,
-39587,  1494, 16230,     2,  1867,  8662,  2531,  2684,     3,  2864,
-16708,  3916, 26502,  4661, 15736,     1,  4701, 15736,     2,  2794,
-36121,  4741, 15736,     4,   446, 20497,   922, 42321,   972, 37568,
- 4781, 15736,     1,  4821, 15736,     2,   181, 46167,  4861, 15736,
-    2,   291, 11984,  4901, 15736,     4,   911, 40346,  1394, 47910,
- 2065, 31350,  4941, 15736,     3,  3382, 23164,  3408, 23084,  4224,
-52618,     1,  4250, 52618,     1,  4276, 52618,     3,  2059, 51547,
- 3090, 14338,  4302, 52618,     1,  4328, 52618,     1,  4354, 52618,
-    3,  1551, 40727,  2643, 21870,  4380, 52618,     3,  2254, 12730,
- 3217, 55334,  4406, 52618,     1,    18, 52003,     2,  1650, 61754,
- 2179, 42341,     3,   344, 20825,  2436, 55375,  2955, 23737,     2,
- 1527, 63752,  4625, 25365,     1,  4109, 60334,     2,   800, 15830,
- 1430, 32042,     1,  1212, 36810,     3,   192,  9374,  1213, 36810,
- 2293, 44321,     2,  1214, 36810,  3403, 10465,     3,   293, 29685,
- 1155,  7310,  2591, 43320,     1,  3536, 15943,     1,  3922, 49654,
-    1,  1792, 51604,     1,  4022, 33304,     2,   662, 29883,   793,
-57990,     1,  1239, 55332,     1,    68, 50637,     3,  1160,  2051,
- 1249, 22054,  3356, 58494,     1,   902, 26965,     1,  3290, 46073,
-    1,   903, 18960,     2,  1092,  4878,  3835, 20159,     3,  1496,
- 9608,  1509, 59915,  1644, 57852,     1,  4981, 60552,     2,  3592,
-54613,  5021, 60552,     2,  4614, 60935,  5061, 60552,     1,  5101,
-60552,     2,  4106,  4469,  5141, 60552,     4,  2485,  6396,  2614,
-50987,  4223, 63084,  5181, 60552,     2,  4249, 63084,  5221, 60552,
-    3,  3063, 41874,  4043, 43791,  4275, 63084,     1,  4301, 63084,
-    2,  1661, 60631,  4327, 63084,     1,  4353, 63084,     2,  1980,
-44483,  4379, 63084,     1,  4405, 63084,     3,  1210, 11417,  1215,
-36810,  3524, 61765,     1,  1216, 36810,     1,  1129,  6114,     1,
- 3083, 14973,     3,   233, 55853,  2209, 51876,  3381, 56305,     1,
-  906, 10711,     2,  1466, 25011,  3544, 62949,     3,  2356, 12767,
- 2473, 45570,  2764, 10376,     1,  2914, 28562,     2,  2184, 21224,
- 4093,  8540,     1,  2257, 65162,     2,   932, 52922,  4613, 25934,
-    3,   426,  7574,  1166, 58553,  4066, 38993,     1,   634, 15290,
-    1,  3770, 21043,     1,  3521, 64707,     2,  2863, 61521,  4687,
-10836,     2,  1704, 20895,  4727, 10836,     3,  1113, 40973,  2666,
-61158,  4767, 10836,     1,  4807, 10836,     1,  4847, 10836,     1,
- 4887, 10836,     3,  2717, 21447,  3309, 44195,  4927, 10836,     2,
- 3749, 45632,  4967, 10836,     4,   210,  1478,  1501, 57051,  4142,
-20584,  4658, 61105,     2,  2427,  3225,  4698, 61105,     2,  1217,
-36810,  4738, 61105,     1,  4778, 61105,     2,  2590, 50155,  4818,
-61105,     3,  1882, 45886,  2721, 43202,  4858, 61105,     1,  4898,
-61105,     3,  2011, 19916,  4017, 39939,  4938, 61105,     2,  2028,
-17947,  2424, 32491,     2,   539,  1159,   636, 56196,     1,  1608,
-19658,     1,  1340,  2410,     2,  1190, 45125,  2704, 28572,     1,
- 3099, 59084,     1,  3792, 36937,     2,  1328, 25419,  4178, 38712,
-    2,  1960, 39734,  3215,  1017,     1,  2572,  5691,     3,  1562,
-59363,  1982, 24892,  4205,  4150,     2,   816, 26484,  2534,  2826,
-    3,   280, 30636,  3057, 35487,  4172, 45352,     2,  2262, 61425,
- 3920, 19409,     1,  2670, 36887,     3,  2623, 43976,  3427, 10290,
- 3578, 24159,     1,  4977, 31740,     2,  1240, 13086,  5017, 31740,
-    2,  4144, 45877,  5057, 31740,     1,  5097, 31740,     1,  5137,
-31740,     1,  5177, 31740,     4,   370, 41925,  1700, 52511,  2489,
-42347,  5217, 31740,     1,  2860, 49513,     2,  1388, 55200,  2370,
-61086,     1,  3900, 26600,     1,   536, 61284,     2,   379, 54190,
- 3459, 59971,     1,  3817, 35949,     1,  1647, 14272,     1,  3593,
-15711,     1,   628, 43886,     1,  1177,  3560,     1,  3725, 16534,
-    1,  3220, 27830,     1,  3977, 25046,     1,  3301, 55598,     1,
- 1772, 26677,     1,  3518, 54146,     3,   482, 11988,  1750, 35271,
- 4015, 23943,     1,  2248, 25198,     1,  1122, 22251,     3,   157,
-35996,  1199, 54734,  1289, 10848,     2,  2512, 32479,  4422,  2197,
-    1,  4448,  2197,     2,  2135, 32421,  4474,  2197,     1,  4500,
- 2197,     2,  3032, 16099,  4526,  2197,     1,  4552,  2197,     4,
-  149, 18788,   339, 55340,  1510, 64616,  4578,  2197,     2,   501,
-38313,  3846, 55222,     1,  2503, 46896,     1,  1301, 31406,     2,
- 1163, 49389,  2374, 11139,     1,  3933, 16509,     3,   840, 20534,
- 3750, 40116,  3893,  9636,     1,   455,  5300,     2,   507, 24827,
-  529, 58935,     4,   506,  7102,  1175, 12586,  3173, 35391,  3688,
- 9277,     1,  3198, 13914,     1,    56, 44155,     6,  1087,  9463,
- 1616, 14225,  2102, 22848,  3717, 55478,  4056, 42010,  4125, 62817,
-    2,   859, 61033,  1744, 49545,     3,  1352,   229,  1817, 40583,
- 3757, 37315,     2,  1179,  8852,  2284, 51674,     1,  2695, 32883,
-    1,  1745, 31074,     2,   724,  7682,   821, 50767,     1,  2538,
-45706,     1,   595, 23831,     2,   130,  7595,  2582,  2298,     2,
-  132, 18600,  1934, 15160,     2,   405,  8612,  1895, 48746,     1,
-  785, 50380,     2,    61, 55617,   679, 22342,     2,  2778, 27136,
- 3075, 12345,     1,  1452, 10832,     1,   992, 35176,     1,   798,
-14113,     4,   814, 18173,  2581, 24212,  2750,  5558,  3708, 50755,
-    1,  2089, 23988,     1,  3127, 58761,     2,  1606, 54623,  3778,
- 8876,     1,  4440,  3768,     3,   844, 52072,  3496, 15197,  4466,
- 3768,     4,   164,  3386,  1237, 17467,  3240, 30697,  4492,  3768,
-    1,  4518,  3768,     3,  3256,  1904,  3511, 15927,  4544,  3768,
-    2,  2219, 54521,  4570,  3768,     1,  4596,  3768,     2,  1706,
-63565,  3274, 39015,     1,   865, 21408,     1,  3692, 12567,     1,
- 2404,  7658,     1,  4033,  9649,     1,   811, 28412,     2,  1925,
-14606,  4628, 46848,     2,  2457,  5510,  3080,  1466,     1,    51,
-19083,     3,    45, 24707,  1026, 20866,  1580, 12378,     1,   185,
-30858,     2,   278, 11547,  3672, 34063,     2,    76,  4780,  1660,
-  861,     2,  2871, 62914,  3355, 44525,     1,  3344, 42123,     2,
- 1977, 63104,  2543, 33073,     1,  3673, 24256,     2,  1625,   747,
- 4442, 56121,     2,  3623, 43364,  4468, 56121,     6,   654, 39642,
- 2306,  9640,  2399, 13082,  3153, 36394,  3477, 60381,  4494, 56121,
-    2,  2197, 12410,  4520, 56121,     2,  3395, 58080,  4546, 56121,
-    3,  2005, 40648,  2608, 47547,  4572, 56121,     2,  4141, 19328,
- 4598, 56121,     1,  4446, 23444,     4,  1975,  5298,  2714, 56114,
- 3048, 65501,  4472, 23444,     2,  1143,  7510,  4498, 23444,     1,
- 4524, 23444,     2,  2558,  1335,  4550, 23444,     2,   381, 61004,
- 4576, 23444,     1,  4602, 23444,     1,   358, 46660,     4,   607,
-30709,   787, 61350,   872, 13314,  2204, 44601,     1,  2979, 59178,
-    2,  2178, 46078,  3073, 55687,     1,  1012,  3283,     1,  3765,
-21102,     2,   542, 19054,  4035,  6411,     1,  3070,  4870,     1,
- 2741, 40733,     2,  2573, 28536,  3189, 10824,     2,  1964, 18914,
- 2998, 11222,     2,   986, 55552,  3498, 49564,     2,  1039, 17868,
- 3949,  6304,     2,  1541, 55466,  3581, 36756,     1,   106, 17546,
-    2,  1165, 29691,  3134, 58594,     1,  1357, 54000,     2,   657,
-52957,  2950,  4308,     2,     8, 36679,  3947, 56955,     2,  3420,
-26806,  3648, 10083,     1,  2441, 10492,     2,  1545, 34217,  3350,
-19098,     1,   279,   923,     1,  3620, 21243,     2,   153,  8519,
- 3221, 17426,     2,   652, 11283,  4666,  1292,     2,  2648,  4300,
- 4706,  1292,     1,  4746,  1292,     4,  1159,  2521,  4425, 52736,
- 4786,  1292,  4989, 11827,     4,  3373, 47122,  4451, 52736,  4826,
- 1292,  5029, 11827,     3,  4477, 52736,  4866,  1292,  5069, 11827,
-    3,  4503, 52736,  4906,  1292,  5109, 11827,     4,  3335, 19575,
- 4529, 52736,  4946,  1292,  5149, 11827,     4,  1472,  9723,  3258,
-22343,  4555, 52736,  5189, 11827,     3,  2060, 62865,  4581, 52736,
- 5229, 11827,     2,   854, 25768,  3151, 45132,     4,   583, 15741,
- 2479, 57132,  2972,  5011,  3777, 19778,     2,  1609, 37889,  3677,
-31319,     1,  2710, 11405,     2,  3027, 19175,  4612, 55082,     1,
- 2567,  6109,     1,  2847,  2693,     1,  1909, 16572,     1,   730,
-19760,     2,   317, 55939,  1299, 11212,     4,  1853, 60224,  2072,
-63875,  3045, 61866,  3180, 19958,     3,  1564, 27237,  2504, 21316,
- 2954, 25725,     1,  2439, 26371,     2,   151, 24943,   221, 44118,
-    1,  3689, 55394,     1,  3991, 64610,     2,   672,  6465,  3899,
-26659,     2,  2960, 15270,  3227, 43119,     1,  2275, 45515,     1,
- 4646, 12332,     1,   349,  3436,     2,   829, 45467,  1169, 18562,
-    1,  2752, 37445,     2,  1804, 31035,  3827, 52621,     1,  1347,
- 1367,     3,  1784, 32965,  1921, 23340,  3387, 52320,     1,  1845,
- 1382,     2,   883,  7733,   988,  1335,     2,  2138, 13892,  4167,
-20205,     2,   146, 51386,  1487, 64281,     2,  1150, 50377,  2134,
- 5865,     1,  2276, 28874,     3,    62, 41330,  2557, 63359,  4432,
-32474,     2,  1755, 43367,  4458, 32474,     1,  4484, 32474,     3,
-  476,  3220,  2702, 11021,  4510, 32474,     1,  4536, 32474,     2,
- 3375, 47440,  4562, 32474,     2,   873,  6387,  4588, 32474,     3,
- 3338, 61022,  3713, 35968,  5256, 35567,     1,  2776, 24122,     3,
-  763, 63843,   807, 40328,  2437, 61255,     1,  3018, 19043,     3,
-  260, 13498,  2445, 65473,  4660, 30184,     4,   743, 33160,   853,
-59593,  3321, 22511,  4700, 30184,     4,   245, 47690,  1819,  5127,
- 3230, 51830,  4740, 30184,     3,  1125, 34673,  3795, 17310,  4780,
-30184,     1,  4820, 30184,     2,  1367, 65152,  4860, 30184,     1,
- 4900, 30184,     5,   935, 17211,  1019, 29496,  1653, 41146,  2652,
-47012,  4940, 30184,     2,  2167,  8967,  2727, 24344,     1,  3684,
-57726,     1,  2009, 33847,     2,  1105, 28533,  1297, 14583,     2,
-  575, 28941,  2639, 45750,     2,   947, 48078,  3190, 64423,     2,
- 2244, 45499,  2744, 55994,     1,  2041, 38808,     1,  1837, 28786,
-    1,   647, 45466,     4,   353, 65044,   956, 10619,  2158, 42492,
- 4444, 10158,     1,  4470, 10158,     1,  4496, 10158,     5,  2715,
-28423,  3158, 61831,  3719, 55537,  4081, 21657,  4522, 10158,     2,
- 2835, 26710,  4548, 10158,     1,  4574, 10158,     3,  1300, 50264,
- 2798,  8985,  4600, 10158,     1,  2858, 61080,     2,  2911, 15674,
- 3067,  8281,     2,    14, 31121,  2267, 43730,     2,   815, 29529,
- 1419, 52402,     1,  4195, 31755,     2,  1670, 54603,  2697, 47645,
-    1,  1263, 44176,     1,  3133, 13473,     2,  3402, 49454,  3804,
-38543,     2,  1218, 60132,  1563,  8268,     1,  3587, 44374,     2,
- 4012, 23744,  4024, 60955,     1,   982,  3250,     2,   995,  7495,
- 2289, 41426,     1,   553, 25327,     3,    29, 55180,  2104, 61185,
- 3939, 25830,     1,   494,  9083,     1,  2097,   464,     2,  1499,
-46786,  4982, 58263,     4,   976, 56983,  1326, 22235,  3674, 24227,
- 5022, 58263,     1,  5062, 58263,     1,  5102, 58263,     3,   348,
-54417,  3892,   268,  5142, 58263,     1,  5182, 58263,     1,  5222,
-58263,     1,  4995, 24406,     1,  5035, 24406,     3,   347, 48639,
- 2854, 34923,  5075, 24406,     4,   917, 62321,  3553, 61214,  5115,
-24406,  5264,  9940,     1,  5155, 24406,     1,  5195, 24406,     3,
- 2342, 55263,  3193, 20225,  5235, 24406,     1,  3187,  4313,     4,
- 1410, 27166,  1741, 57802,  1773, 29797,  4226, 36921,     1,  4252,
-36921,     2,   458, 30233,  4278, 36921,     2,   805, 60768,  4304,
-36921,     1,  4330, 36921,     1,  4356, 36921,     1,  4382, 36921,
-    2,   304, 26823,  4408, 36921,     1,  4182, 24644,     4,   109,
-45106,  1064, 58122,  3155, 49562,  3367, 47552,     2,   593, 23671,
- 2391, 35765,     2,   194, 12248,  1850, 24050,     1,  2522, 57371,
-    1,   960, 25730,     1,  3135, 22924,     1,   136, 10592,     1,
- 2756, 62130,     2,  2599, 43380,  2874, 59620,     1,  2395, 59123,
-    3,   591, 20421,  1667, 18211,  2929,  6940,     3,  1881, 63992,
- 3764,  8683,  4616, 16169,     2,   217, 45668,  1729, 57266,     2,
- 2681, 11635,  3188, 25744,     1,   362,  8419,     4,   398, 29110,
- 1133, 27055,  1857, 38532,  2115, 50561,     3,   236, 58908,  1512,
-25167,  2550, 33025,     3,   330, 12224,  1987, 65518,  2459, 53273,
-    1,  3685, 32392,     1,   846,  4911,     1,   587, 20557,     1,
- 2432, 19945,     1,  1040, 53702,     1,  2301, 65080,     1,   664,
-15112,     2,  1266, 64079,  3409, 61848,     2,   775,  7083,   913,
-34444,     2,  1306, 61904,  3644, 11018,     1,  2396, 51657,     2,
- 2519, 36974,  4621,  8420,     1,  2677, 44381,     2,  3006, 65003,
- 3889, 50681,     1,  1442, 39362,     1,  3064, 37472,     1,  1825,
-47899,     2,  2123,  4905,  3863, 32655,     1,    63, 17228,     2,
- 1003, 17372,  3533, 26577,     2,   195, 20583,  2924, 23174,     1,
- 3043, 37642,     2,  2442,  9946,  3224,   232,     2,   653, 33602,
-  774,  2693,     3,   414,  8813,  1274, 45420,  1824, 10589,     1,
- 1481, 40950,     1,  2086, 40404,     2,   504, 44361,  1678, 55540,
-    1,  3411,  7039,     2,   674,  2981,  2312, 53021,     1,  3406,
-26372,     1,  1423, 25787,     4,  1331,  9607,  1818, 41500,  3465,
- 5203,  4148, 33749,     6,  1247, 28144,  1399,   725,  1471, 26564,
- 2747, 30696,  3004, 36108,  3636,  9143,     4,    59,   643,  1480,
-61242,  2029,    48,  2124, 53681,     1,  3050, 25937,     2,  1211,
-31271,  2884, 21677,     1,  3537, 60733,     1,  2921, 57107,     1,
- 4188, 15588,     2,   559, 21921,  1938, 32255,     2,  2049, 29154,
- 2624, 22210,     1,   156,  4792,     1,  2466, 56410,     1,  2536,
-49149,     2,  2713, 54117,  3044, 29165,     2,  3598, 19283,  5263,
- 9940,     1,  1187, 24403,     1,  1322, 65526,     2,  2613, 65460,
- 2862, 36328,     1,  2733, 28465,     1,  3508, 30248,     1,  1349,
-14069,     1,  1294,  1373,     1,  1332,  3745,     1,  3793, 63504,
-    1,  2160, 14922,     1,  1619,   237,     3,  1719, 40438,  2773,
-42815,  3584, 36028,     3,  1198,  4955,  1262,  9419,  2302, 27733,
-    2,  1373, 21168,  3013, 42014,     2,  1149, 57668,  2224, 43773,
-    1,  3132, 65123,     2,   401, 51902,  3612, 45576,     1,  1913,
-44263,     1,  3667, 28847,     1,  3919,  4017,     2,  1692, 65335,
- 3105, 33060,     1,  2108, 60567,     1,   669, 44791,     1,  3500,
-38976,     1,  1529, 14240,     1,   656, 54399,     1,  3483, 30080,
-    1,   127, 50937,     1,   418, 39060,     1,  1135, 12613,     3,
- 1178, 25613,  1671, 34195,  1805, 10225,     1,  2147, 32457,     2,
- 2382, 53494,  3104, 31017,     2,  1083, 25292,  1730, 61106,     1,
- 3253, 24164,     1,  4421, 30445,     2,  2583, 22605,  4447, 30445,
-    1,  4473, 30445,     4,    21, 64258,   616, 22994,  4499, 30445,
- 5260,  7130,     3,   952,  3624,  1206, 49466,  4525, 30445,     1,
- 4551, 30445,     3,  3611,  8194,  4209, 12951,  4577, 30445,     2,
- 2511, 34663,  2796,  1035,     1,   830, 62020,     1,   619, 43459,
-    2,   220, 58580,  2101, 34804,     2,  3323, 32927,  3435, 29376,
-    1,  1733, 62975,     2,  1227, 23589,  1892, 50362,     1,  3839,
-29346,     2,    90, 13885,  1565, 20182,     1,  3696,  2764,     3,
- 2446,  2984,  3016, 52082,  3492, 41087,     2,  1011, 62489,  1153,
-32866,     1,   165, 47468,     3,     3, 28480,  3488, 48618,  4060,
-23331,     3,  2121, 38287,  2388, 13877,  3502,  6652,     2,  2595,
-27356,  4181, 48247,     1,  4679, 41588,     3,  1549, 64894,  4619,
-60955,  4719, 41588,     2,   270, 19402,  4759, 41588,     2,  1403,
-54663,  4799, 41588,     1,  4839, 41588,     1,  4879, 41588,     2,
- 1560, 41095,  4919, 41588,     2,  1936, 62630,  4959, 41588,     1,
- 1091, 11068,     1,  1508, 41529,     2,   267, 20495,  2532, 61520,
-    1,  1450, 51469,     1,  3244, 39036,     2,  1420, 42309,  5254,
-37121,     1,   517, 61013,     3,   297, 62101,  1196,  7142,  4159,
-51716,     1,  1308, 65240,     1,  1828, 55553,     1,   713, 57624,
-    5,  1461, 22501,  1593,  5061,  2470, 38056,  3092,  3857,  4684,
-12331,     5,   115,  3157,  1836, 15085,  2035, 38912,  2767, 19831,
- 4724, 12331,     1,  4764, 12331,     3,  2953, 14067,  3610,  2025,
- 4804, 12331,     1,  4844, 12331,     3,   387, 30933,  1999, 38107,
- 4884, 12331,     1,  4924, 12331,     1,  4964, 12331,     2,  1145,
-18589,  2981, 26183,     3,  1740, 19675,  3061,  6962,  3782, 53464,
-    1,  3923, 63757,     1,  1378, 64806,     3,  1147,  7079,  2344,
-19307,  2487,  6646,     1,  1986, 20170,     1,  1627,  7261,     1,
- 4633, 52713,     1,  2824, 31849,     1,  3756, 45652,     1,   120,
-40063,     1,  2017, 32245,     2,  2317, 60657,  5005, 15402,     3,
- 3298, 56708,  3590, 28717,  5045, 15402,     1,  5085, 15402,     2,
- 2361, 55810,  5125, 15402,     3,  2674, 19128,  4221, 64894,  5165,
-15402,     3,  1059, 31353,  4247, 64894,  5205, 15402,     3,  2319,
-25054,  4273, 64894,  5245, 15402,     3,   794, 64470,  1319, 38227,
- 4299, 64894,     2,    37, 25816,  4325, 64894,     2,  1518, 62764,
- 4351, 64894,     2,  2068, 27109,  4377, 64894,     1,  4403, 64894,
-    1,  4124, 28440,     2,  2128, 49668,  3927, 19248,     2,  2189,
-18363,  2569, 54539,     1,   383, 43059,     1,  4976, 45059,     1,
- 5016, 45059,     4,   866, 51008,  1948, 18340,  3589, 38187,  5056,
-45059,     2,  2114, 29242,  5096, 45059,     3,  2689,  2318,  3913,
-36163,  5136, 45059,     2,  3364, 13383,  5176, 45059,     3,  2896,
-14566,  4663, 47474,  5216, 45059,     1,  4703, 47474,     3,   745,
-38210,  2389,   431,  4743, 47474,     1,  4783, 47474,     3,    66,
-20767,  2726,  2619,  4823, 47474,     2,  1037, 58610,  4863, 47474,
-    5,   351,  5675,   868, 13797,  2423, 27821,  2995, 48501,  4903,
-47474,     2,  2073, 13500,  4943, 47474,     2,  2146, 14082,  3704,
-18906,     1,    50, 39912,     1,  4992, 50028,     1,  5032, 50028,
-    2,  1928, 62207,  5072, 50028,     2,   698, 14201,  5112, 50028,
-    1,  5152, 50028,     1,  5192, 50028,     1,  5232, 50028,     2,
-  179, 42174,   331, 42499,     1,  3386,  4881,     1,  4026, 28400,
-    3,   356, 11600,   478, 46734,  1766, 15319,     1,  3499, 62626,
-    1,  2920, 37601,     1,  4657, 38694,     3,  1786, 12981,  2654,
-12143,  4697, 38694,     1,  4737, 38694,     3,  3204, 18026,  4069,
-41776,  4777, 38694,     2,   711,  2991,  4817, 38694,     3,  1046,
- 7333,  3085, 43601,  4857, 38694,     1,  4897, 38694,     4,  3023,
-32942,  3279, 62730,  3615, 43488,  4937, 38694,     4,  2797, 47564,
- 3283,  8282,  3753, 62222,  3986, 58464,     1,  2221, 58061,     1,
- 1833,  6586,     1,  3656, 41955,     1,  3289, 11825,     3,  1228,
-51292,  1425, 50382,  1629, 33442,     1,  3126, 57877,     1,  3457,
-28451,     1,  4229, 38155,     2,   420, 40480,  4255, 38155,     2,
-  884, 35090,  4281, 38155,     2,  4131, 20877,  4307, 38155,     2,
-  147, 15446,  4333, 38155,     1,  4359, 38155,     1,  4385, 38155,
-    3,   433, 46707,  1849, 11726,  4411, 38155,     2,   440, 46707,
- 2452, 34942,     2,  1888,  4996,  4113, 50883,     3,  1408, 31447,
- 2561, 49182,  4091,  9641,     3,   546, 63930,   943, 13348,  4445,
-39586,     2,  1822, 64612,  4471, 39586,     4,  1315, 63340,  2322,
-55313,  2768, 55606,  4497, 39586,     4,   416, 17383,  1483, 45661,
- 2577, 40399,  4523, 39586,     3,  1762, 28748,  2918, 39002,  4549,
-39586,     3,   227,  7605,   396, 34193,  4575, 39586,     5,   641,
-26687,  2933, 11374,  3150, 24721,  3529, 59418,  4601, 39586,     1,
- 3405, 33521,     1,  3468, 44087,     2,   391, 27600,  1623, 25710,
-    1,  3192,  9830,     1,   773, 61174,     1,  4103, 43870,     2,
-  206, 29555,  3039, 65228,     3,  1781, 28090,  3348, 44250,  4110,
-28159,     1,  1507, 62228,     1,   424,  1030,     2,  1130, 62259,
- 3207, 55878,     1,  1242, 38395,     2,   327,  3501,  2174, 19533,
-    1,  1292, 38562,     3,  2492, 55902,  2919, 26982,  3095, 54622,
-    2,  1051, 19895,  4665, 50629,     1,  4705, 50629,     3,  2328,
-25010,  3944, 56871,  4745, 50629,     2,   809, 39262,  4785, 50629,
-    3,  2893, 57501,  3957, 10936,  4825, 50629,     2,  3017, 41761,
- 4865, 50629,     2,  1052,  9655,  4905, 50629,     2,  4437, 13953,
- 4945, 50629,     5,   140, 61178,   505, 42206,  2242,  1556,  2650,
-26497,  4463, 13953,     3,  1137, 33940,  3440, 61772,  4489, 13953,
-    4,  2837, 11210,  3291, 51863,  4515, 13953,  4692, 40614,     2,
- 4541, 13953,  4732, 40614,     3,  1024, 24134,  4567, 13953,  4772,
-40614,     2,  4593, 13953,  4812, 40614,     3,   123, 20732,  1785,
-39467,  4852, 40614,     2,  2486, 11750,  4892, 40614,     3,  1859,
-30080,  3462, 34874,  4932, 40614,     1,  4972, 40614,     2,  1811,
- 8983,  2782, 52742,     1,  2075,  1408,     3,  1428, 60558,  3056,
-55137,  3548, 51575,     1,  2465, 11941,     4,  2216,   792,  2454,
-50225,  2510, 61696,  3618, 57997,     4,   395,  4155,  1117, 60806,
- 1432, 53321,  3401,  3921,     2,  2755,  4111,  4072, 21159,     5,
- 3282, 31309,  3361, 32025,  3979, 44360,  4025, 60027,  4112, 59702,
-    2,  2732, 15092,  4031, 47678,     1,   984, 14866,     1,  1835,
- 8177,     2,  1230, 54477,  2186, 63793,     1,  1245,  8336,     2,
- 1448,  8507,  3573, 12124,     3,   897, 60530,  1534, 51308,  2416,
-49710,     1,  3654, 25358,     1,   502, 12386,     1,  1495, 36437,
-    2,   797, 35935,  3399,  9223,     2,  3769, 50119,  4640, 17209,
-    4,  1696, 43763,  2975, 30401,  3053, 61593,  3425, 58729,     1,
- 3950, 33016,     1,  2196,  8457,     1,  3786, 26426,     2,  1523,
-53679,  5259, 30283,     1,  1879, 31605,     3,  1869, 60143,  2331,
-23331,  3497,  2279,     1,    11, 19010,     2,   338, 22575,  1500,
-46126,     1,  1038, 54388,     1,  3186, 42094,     3,   645, 10789,
- 1891,  2833,  2831, 47857,     1,  1840, 36041,     3,   305, 29735,
- 3831, 56112,  4152, 16573,     2,  1279, 26338,  4166, 37354,     2,
- 1628, 17975,  3562, 64094,     1,   990, 43590,     1,   635, 56074,
-    1,  3326, 24547,     2,  1181,  2311,  2431, 62165,     2,  3655,
-46271,  3664, 11341,     2,  2119, 61021,  2870, 60996,     1,  3345,
-13222,     1,  4617, 28975,     1,  3239, 63185,     1,    33, 21793,
-    2,  1641, 52594,  2790, 15802,     4,  1944, 29640,  3726, 18007,
- 3854, 55801,  4029, 33859,     2,  3380, 35023,  3760, 30958,     2,
- 1890,  3302,  3487, 30969,     2,   728, 51536,  2556, 40065,     1,
- 2304, 14645,     2,  1398, 12486,  3394, 47948,     1,  3783, 48425,
-    1,  3755, 13672,     4,  2740, 50525,  2878, 12658,  3052, 38183,
- 3554, 59414,     1,  2879, 12658,     1,   926,  3339,     1,  2922,
-16552,     1,  2233, 46874,     3,     4, 23290,   158, 14645,  2094,
-49038,     2,   316,  9293,  2166, 63553,     1,  1530, 11781,     1,
- 4999, 61705,     1,  5039, 61705,     1,  5079, 61705,     2,  1372,
-56551,  5119, 61705,     2,  2664,  6296,  5159, 61705,     1,  5199,
-61705,     2,  3168, 44859,  5239, 61705,     2,  2703, 19859,  3443,
-25188,     2,   429, 38263,  2612, 45551,     1,  3970, 48734,     2,
- 4105, 56996,  4689, 40787,     1,  4729, 40787,     1,  4769, 40787,
-    2,  2088,  3347,  4809, 40787,     2,  2268, 27536,  4849, 40787,
-    2,  3178, 44760,  4889, 40787,     2,  1277, 22662,  4929, 40787,
-    3,   888, 14008,  1110, 34923,  4969, 40787,     1,   555, 35888,
-    3,   973,  3273,  1010, 21621,  3316, 53055,     3,   255, 62560,
- 3106, 17896,  3740, 53292,     2,   443, 54648,  1176, 13271,     4,
-  388, 22494,   439, 27125,  2956, 20795,  3278, 12008,     4,   585,
-13595,  1047,  4043,  3422, 24970,  3912, 51532,     2,  2294, 57004,
- 3145, 58500,     1,  1728, 24150,     2,   689, 40124,  2353, 21151,
-    2,  2653, 60465,  3223, 24289,     1,   191, 47738,     1,   300,
-37918,     2,  2006, 40601,  4145, 26818,     2,   465, 16290,  2297,
-10967,     1,  3047, 32934,     3,    88, 15583,   415, 33506,  4218,
-37789,     1,  4244, 37789,     2,   384, 41110,  4270, 37789,     3,
- 1709, 46511,  3506,  5560,  4296, 37789,     3,  2917, 37070,  4322,
-37789,  4604, 57356,     1,  4348, 37789,     1,  4374, 37789,     2,
-  980, 63264,  4400, 37789,     1,  2335, 61490,     1,  2748, 58081,
-    2,   188, 45627,  3419, 29995,     1,   665, 28622,     2,  1592,
- 3085,  4193, 60616,     3,   296, 57895,  1526, 54326,  3564, 43001,
-    2,  2822, 44094,  4674, 43131,     2,  1278, 35859,  4714, 43131,
-    2,  3884, 54409,  4754, 43131,     2,  3370, 60368,  4794, 43131,
-    2,   783, 51396,  4834, 43131,     2,  3936, 57072,  4874, 43131,
-    1,  4914, 43131,     1,  4954, 43131,     1,  4659, 45456,     1,
- 4699, 45456,     1,  4739, 45456,     2,  1093, 15253,  4779, 45456,
-    3,  1095,  2901,  2063, 24065,  4819, 45456,     3,   430, 51918,
-  681, 49561,  4859, 45456,     2,  1821,  3822,  4899, 45456,     2,
- 4647, 53948,  4939, 45456,     2,   650, 25894,  3906, 47162,     2,
- 2139, 39505,  5258, 30283,     1,  3702,  8096,     4,   648, 50623,
-  768, 15230,  1431, 57682,  2712, 44803,     2,  2553, 16006,  3259,
-43030,     2,   190, 20563,  1649, 50261,     2,  1396, 46107,  4662,
-61343,     1,  4702, 61343,     1,  4742, 61343,     2,  2777, 28715,
- 4782, 61343,     1,  4822, 61343,     1,  4862, 61343,     1,  4902,
-61343,     1,  4942, 61343,     2,  1193, 61306,  1392, 58172,     2,
-  573, 27424,  1334, 58534,     2,  1060, 29841,  5262,  9940,     1,
-  899, 44226,     1,  1894,  9481,     1,  4009, 56097,     2,  2194,
-52307,  4010, 56097,     1,   886, 52445,     2,  1469, 48335,  3377,
-26899,     1,  4641, 52158,     3,   137, 40869,  1097, 18137,  3384,
-12756,     2,  3815, 37345,  3870, 62042,     1,  3823, 25476,     3,
- 2430, 19873,  2597, 30037,  3210, 47808,     1,  1342, 57949,     1,
- 2420, 49006,     2,   493, 51061,  3129, 11002,     1,  1577, 59769,
-    4,   243, 43302,   779, 52902,  4123, 18854,  4190, 10076,     1,
- 3439, 34748,     2,  1295,   802,  4084, 21583,     3,  2723, 37746,
- 3526,  9728,  3885, 11411,     2,   792,  7203,  2901, 44119,     2,
- 2456, 31149,  3421, 29226,     1,    58, 10068,     2,  1016, 13539,
- 1624, 44085,     2,   154, 15193,  5000, 63613,     2,  3163, 55896,
- 5040, 63613,     2,   159, 42791,  5080, 63613,     2,  2927, 26665,
- 5120, 63613,     2,  2834, 51496,  5160, 63613,     2,   545,  9810,
- 5200, 63613,     2,  1363, 39081,  5240, 63613,     1,  2038,  5846,
-    3,   964, 30332,  2110, 37055,  2215,  1998,     2,   392, 39179,
- 3575, 62520,     1,  1400, 59569,     1,  2592, 58006,     1,  1104,
-29561,     1,  2682, 25054,     2,  1416, 12972,  2192, 13558,     1,
-  655, 24146,     1,    74, 64772,     1,  3859, 24459,     2,  1517,
-14279,  3911, 34192,     2,  2064, 54628,  2861, 47287,     1,  2839,
-52385,     1,  3196, 18019,     1,  2663, 41251,     1,  3428, 26759,
-    3,    77, 11204,  3142, 48574,  4991, 22922,     3,  1971,  7262,
- 2016, 41111,  5031, 22922,     2,   445,  1788,  5071, 22922,     3,
-  451, 14107,  2814,  5307,  5111, 22922,     1,  5151, 22922,     4,
- 1391, 60170,  2371, 53580,  3842, 31271,  5191, 22922,     2,  3033,
-30506,  5231, 22922,     2,   885,  9748,  1568, 53410,     4,   204,
-54086,  1045, 20974,  1903,   150,  3184, 59719,     2,   474, 62838,
-  955, 18911,     3,   343, 36333,   925, 61943,  4120, 31620,     2,
- 2937,  4809,  4104, 54103,     2,   495, 26931,  4681, 17302,     3,
- 2100, 19949,  4143, 24510,  4721, 17302,     1,  4761, 17302,     1,
- 4801, 17302,     1,  4841, 17302,     2,  4206, 28528,  4881, 17302,
-    2,  2799, 41437,  4921, 17302,     2,  2515, 58488,  4961, 17302,
-    1,  1167, 38133,     1,  1248, 46791,     1,  3446, 45896,     1,
- 3128, 42257,     1,  3869, 33753,     3,  2928, 24873,  3416, 13149,
- 4095, 53644,     1,  2482,  2545,     1,  3463, 16806,     1,  3299,
-29518,     3,  1794,  2467,  2150, 61057,  3466, 26256,     2,  1893,
-31346,  3784,  7540,     3,   747, 60479,   863, 41505,  3143, 16409,
-    2,  2296, 51406,  4441, 43007,     4,    19, 50140,  1873, 60089,
- 3657, 32061,  4467, 43007,     1,  4493, 43007,     3,   810, 38505,
- 2155, 12807,  4519, 43007,     1,  4545, 43007,     2,    89, 44325,
- 4571, 43007,     2,   740, 55254,  4597, 43007,     3,  1320, 54134,
- 3161, 47335,  3556, 50881,     2,   602, 14159,  1197, 50768,     2,
-  963, 63562,  3840, 27863,     1,  3776, 59776,     2,   761, 30948,
- 2443, 62207,     1,   686, 19144,     1,   143, 31011,     1,  2688,
-58203,     1,  1621, 53817,     3,   238, 20775,   803, 15070,  3528,
-49985,     1,  1337,  1680,     1,  1482, 26940,     2,  1106,  4756,
- 2949, 56888,     1,  3250, 25034,     1,  3160, 38467,     1,   611,
- 4047,     2,  1148, 24467,  2925, 40545,     1,   680,  7740,     2,
- 1514, 20984,  2282, 45507,     1,  3121, 43751,     1,   629, 49570,
-    1,    35, 36192,     2,    20, 30554,  3222, 29328,     1,  1356,
-38827,     3,  1144,   109,  2809, 35683,  3862, 64582,     1,  1124,
-61225,     3,  2385, 60079,  3368, 27739,  4092, 52349,     1,   461,
-14914,     1,  3116, 57031,     1,  3429, 21682,     2,   727, 47233,
- 1435, 39271,     1,  1490,  3055,     1,  3538, 56550,     2,   452,
-11321,  3086, 43284,     1,  4151, 31050,     2,   346, 37995,  3015,
-62810,     1,  3754, 48544,     2,  1000, 36715,  3201, 22430,     1,
-  457, 29352,     1,  2032, 61844,     2,  1645, 41564,  2941, 60171,
-    3,   479, 23340,   513, 25646,  2564,  7027,     2,  2314, 51142,
- 3177, 48111,     2,  2066, 64772,  2989,  1792,     2,   879, 16013,
- 3878, 56467,     1,  3165, 62355,     3,   167, 46216,   378, 12234,
- 4227, 60277,     3,   207, 42759,  3051, 57292,  4253, 60277,     1,
- 4279, 60277,     2,  3897,  6858,  4305, 60277,     3,  1956, 51603,
- 3993, 49697,  4331, 60277,     2,   714, 63854,  4357, 60277,     2,
- 2943, 31651,  4383, 60277,     2,  4040,  7709,  4409, 60277,     1,
- 4002,  9183,     2,  1972, 25460,  4171, 58070,     1,  3065, 16352,
-    1,  3293, 21591,     1,  3270, 58840,     3,   218, 24868,   874,
- 5649,  4198, 57200,     1,   500,  7123,     2,   737, 43285,  2056,
-48230,     1,   225, 47477,     1,  1841, 23463,     1,  1578, 21574,
-    3,  2505, 52874,  2852, 42027,  4042, 26797,     2,    30, 17980,
- 1029, 42152,     1,  2739, 36905,     2,  2091, 61204,  2628, 24085,
-    1,  1246, 43168,     2,  2428, 54528,  3803,  8171,     3,  1302,
- 6161,  1655, 45132,  2318, 29181,     2,   871, 38976,  2604, 49013,
-    1,   438, 61050,     1,  4203, 15057,     1,   419, 61189,     1,
-  993, 12792,     1,  3797, 63814,     1,  2070, 60067,     1,  3122,
- 4244,     2,  1830, 30976,  2549, 15569,     1,  1731, 47449,     1,
- 2869, 58473,     1,   983,  4403,     2,  1156,  1089,  1361, 56483,
-    1,  1114,  9036,     1,  2662, 41310,     1,   315, 61748,     1,
- 1967, 22523,     2,    24, 13785,  2541, 14804,     2,  1353, 59424,
- 3843, 46397,     1,  2786, 55736,     1,  2789, 52277,     1,  1868,
-40287,     2,   915, 45805,  3449, 23340,     1,  2230, 18345,     1,
- 1758, 35687,     2,  1613, 42898,  3558,  6915,     4,   693, 64979,
- 2348, 55180,  2709,  6033,  3071, 53089,     1,  1070, 15122,     3,
- 1468, 50818,  2417, 40256,  4088, 54052,     2,   571, 16288,  1503,
-25559,     2,   170,  4276,  1068, 44949,     2,    23, 63719,  2175,
-62873,     1,  1966, 31227,     1,   799, 15953,     2,   930, 61057,
- 1404, 33621,     1,  3630, 55600,     2,   508, 49225,  2880, 40417,
-    1,  4615,  5555,     2,  2081, 46289,  3741,    45,     1,  1488,
-59128,     1,  3123, 11942,     1,  2013, 21556,     1,   239, 12718,
-    2,   544, 37296,  4127, 43919,     4,   417,  4767,  2193, 27877,
- 4020,  7767,  4993, 61184,     2,   780, 56203,  5033, 61184,     2,
- 4207, 24893,  5073, 61184,     1,  5113, 61184,     3,  1261, 32757,
- 3249, 53608,  5153, 61184,     1,  5193, 61184,     3,  1734, 59233,
- 4606, 36838,  5233, 61184,     2,   736, 13264,  1042, 22156,     3,
-  459,  1515,  1516, 26505,  1865, 41758,     1,  2250, 37278,     1,
- 1241, 55205,     1,   102, 16928,     2,  2309, 63181,  4039, 17754,
-    1,  3119, 55088,     3,  3120, 63661,  3545, 29919,  4631,  1284,
-    1,     2, 46303,     1,  4119, 40322,     1,  1460, 17934,     2,
- 1387, 36416,  3280, 38499,     1,   845, 27178,     2,   849, 27178,
- 3565, 23273,     1,  1991, 53066,     1,   594,  6688,     1,   487,
-49439,     1,   718, 41966,     3,    87, 22351,  2214, 62572,  3851,
-42915,     2,  1839, 59650,  4067, 13525,     1,   566, 47231,     3,
-  326, 49598,  1345, 51902,  2642, 51379,     1,  2281, 48268,     1,
-  186, 27361,     3,    17,  9911,  3100, 39141,  3366, 37955,     3,
- 1520,  3737,  1604, 48315,  2037, 65505,     1,  1765, 37404,     2,
- 1904, 57907,  2763, 20917,     1,  3880, 49321,     2,  1917, 41462,
- 2163, 63697,     2,   407, 29281,  1152, 29875,     2,   340, 52408,
- 3505, 36122,     2,  1918, 55858,  2243, 60188,     3,  2808, 53820,
- 3423, 29538,  3774, 20955,     1,  2888, 31271,     3,   847, 27178,
- 2605, 13341,  3866,  2275,     2,   851, 27178,  1851, 42444,     2,
- 1799, 17995,  2057, 53052,     2,  1511, 43602,  2699, 12496,     1,
- 4649, 38968,     3,   914, 45205,  1595, 53751,  3966, 45427,     3,
- 2083, 20093,  3261, 10969,  3942, 45471,     2,  3152, 38045,  4070,
-  803,     1,  3205, 22489,     3,  2931,  8615,  3980,  9335,  4201,
-59418,     2,  2885, 51871,  3331,  6443,     3,  2729, 10321,  2887,
-36643,  3334, 62501,     1,   697, 10307,     1,  1154, 44072,     1,
- 2117, 12131,     3,   475, 52765,  1910, 13251,  3302, 64099,     2,
- 2478, 20388,  3641, 27154,     1,   288, 19544,     1,  2055, 47068,
-    1,  3318, 21278,     1,  2076, 20085,     2,  1883, 35504,  1946,
-38016,     1,  1254, 52146,     1,  1717, 26528,     1,  2957, 56075,
-    3,    75, 16808,  1427, 28321,  2554, 43356,     1,   942, 63913,
-    1,  3821, 39007,     1,  3622, 18304,     2,   625, 47726,  5002,
- 3100,     2,  2053, 65509,  5042,  3100,     1,  5082,  3100,     4,
- 1584, 65125,  2164, 41987,  2631, 58793,  5122,  3100,     2,  1422,
-25283,  5162,  3100,     2,   412, 13237,  5202,  3100,     4,  1816,
-32983,  3414, 29606,  3818, 41797,  5242,  3100,     3,   759, 20914,
- 1877, 38716,  2464, 18374,     3,   402, 57571,  1823,  4476,  1963,
-14290,     2,  1631, 36728,  2520, 27170,     1,  1542, 46443,     1,
-  699, 52596,     2,   870, 43998,  3453, 23343,     1,  3277, 14812,
-    1,  1688, 33445,     1,  1576, 64325,     2,   355, 19773,  4975,
-20978,     3,  2641, 56990,  4988, 31070,  5015, 20978,     4,  2270,
-58398,  2311, 62719,  5028, 31070,  5055, 20978,     4,   105,  1686,
- 4135, 24994,  5068, 31070,  5095, 20978,     2,  5108, 31070,  5135,
-20978,     2,  5148, 31070,  5175, 20978,     3,  2897, 17403,  5188,
-31070,  5215, 20978,     5,  2994, 27993,  3625, 28535,  3737, 42834,
- 3946, 61636,  5228, 31070,     2,  3954, 36320,  5257, 30283,     2,
-  704, 62446,  3172, 55543,     2,   472, 54197,  2844, 53805,     1,
- 3081, 32340,     2,  3035, 42752,  4225, 64965,     1,  4251, 64965,
-    5,   273, 23992,  1449, 51003,  1476, 15771,  3729,  9702,  4277,
-64965,     3,   848, 36741,  2542, 18920,  4303, 64965,     3,  2253,
-56963,  3383, 17244,  4329, 64965,     1,  4355, 64965,     1,  4381,
-64965,     2,  2082, 32163,  4407, 64965,     1,   515, 18233,     1,
- 3560, 65298,     1,   152, 41224,     1,  3960, 63308,     2,  1887,
-52245,  2237, 20325,     1,  4194, 27147,     1,  4428,  7284,     1,
- 4454,  7284,     2,  4480,  7284,  4678, 26403,     5,   535, 23382,
- 1711, 10044,  2469, 26611,  4506,  7284,  4718, 26403,     3,  2584,
-30441,  4532,  7284,  4758, 26403,     3,  2095, 49054,  4558,  7284,
- 4798, 26403,     4,  2434,  3266,  2533, 31313,  4584,  7284,  4838,
-26403,     1,  4878, 26403,     1,  4918, 26403,     1,  4958, 26403,
-    1,  3479, 51354,     1,  2347, 18075,     2,  1235, 52299,  3374,
-38609,     3,   324, 30908,   670, 35753,  1141,  6490,     2,  2820,
-17394,  2967, 31747,     2,  2490, 11548,  4626,  9968,     2,  1615,
-24673,  3801, 13315,     2,  2833, 42294,  4082,  1457,     1,  1079,
-35960,     2,   757, 64438,  3507, 52082,     1,  2384,  4335,     2,
- 2976, 31147,  3062, 17728,     2,    93, 30397,  1076,  6091,     2,
-   94, 38533,   570, 18957,     1,  2547, 35625,     1,   421, 23318,
-    2,  2261,  4859,  2325,  6090,     1,  4192, 42849,     2,   198,
- 5789,   637, 57616,     1,  1790, 39174,     1,  1669, 31339,     2,
-  527,   998,  2145, 28246,     2,  1355, 59183,  3937, 60563,     2,
- 2021,  4666,  2116, 59916,     3,  1885, 11316,  1941, 23744,  2775,
-52173,     2,  2680, 42717,  3372, 40602,     3,  1281, 11190,  2826,
- 5447,  3322, 18212,     1,  1115, 55599,     1,  2491, 28869,     1,
- 2578,   729,     1,  3567, 45682,     4,  2198, 64259,  3257, 37473,
- 3530, 19355,  4216,  4852,     2,  2279, 23045,  4242,  4852,     3,
- 2004, 34409,  3328,  4772,  4268,  4852,     1,  4294,  4852,     2,
- 1575, 31809,  4320,  4852,     3,   923, 36885,  3914, 35008,  4346,
- 4852,     1,  4372,  4852,     1,  4398,  4852,     2,   608, 48463,
- 1447, 11720,     2,   896, 19139,  2889, 17570,     2,  2336, 25363,
- 2875, 17551,     3,  1720, 26701,  2693, 59626,  4424, 29072,     2,
- 3234, 61654,  4450, 29072,     3,   252, 11459,  1779, 45990,  4476,
-29072,     3,  1970, 32049,  3213, 50692,  4502, 29072,     2,  1585,
-28532,  4528, 29072,     1,  4554, 29072,     3,  3117, 55050,  3971,
-28545,  4580, 29072,     1,  1365, 16611,     1,  1598, 62248,     1,
- 3396, 28607,     1,  2283, 56504,     1,  2915, 17720,     1,  4693,
-60918,     1,  4733, 60918,     4,   485, 60835,  1271, 55850,  3385,
-37699,  4773, 60918,     2,   285, 42267,  4813, 60918,     2,   808,
-18788,  4853, 60918,     1,  4893, 60918,     2,  3154, 55036,  4933,
-60918,     1,  4973, 60918,     1,   400, 28619,     4,   905, 34051,
- 2251, 18184,  2865, 50966,  3415, 54996,     1,  1343, 65372,     2,
-  765, 22428,   790, 27195,     1,  1041, 42939,     1,  2107, 24156,
-    1,  2413, 12993,     2,  1988, 34929,  4077, 11131,     1,  2203,
-30795,     2,  1084, 49258,  1506, 52017,     3,   786, 26652,  2375,
-64626,  3601, 43235,     1,  3714, 51457,     2,   610,  5400,  2651,
- 7437,     1,   174, 64626,     1,  3349,  8283,     1,  1803,  4704,
-    1,  3742, 10434,     1,  3060,  5616,     2,  1555, 20272,  3716,
-63270,     1,  3266, 28313,     1,  1393, 42310,     2,  2321, 43816,
- 3509,  9806,     1,   683, 15049,     1,  2563, 40571,     1,  4055,
-64549,     3,    57, 26587,    99, 45178,   175, 63908,     2,  2460,
-60879,  4005, 15367,     3,    54, 25656,  2105, 23018,  2895, 39060,
-    2,  1743, 29068,  2407, 54893,     2,     6, 59391,  4214, 55672,
-    2,  1055, 35517,  4240, 55672,     3,  2630, 33961,  3076, 45068,
- 4266, 55672,     1,  4292, 55672,     3,   124, 31354,  2227,  2194,
- 4318, 55672,     2,  2042, 35328,  4344, 55672,     2,   552, 25021,
- 4370, 55672,     4,  3454, 10477,  3669, 20501,  4200, 64668,  4396,
-55672,     1,  2785, 43725,     1,  3482, 40192,     1,  3718, 29566,
-    1,  1071, 23421,     2,  3112, 24522,  3586, 57981,     1,  3000,
-61499,     1,  3996, 62596,     1,  4611, 40740,     2,  1586, 59275,
- 2838,  3105,     1,  2188, 62521,     1,  2646, 62607,     1,  2129,
-17489,     1,  2359, 27516,     4,   209, 43003,   528, 51618,  1957,
-45477,  2334,  7602,     2,   661, 62223,  2910, 35943,     1,  3437,
-58496,     2,   519, 31537,   835, 64063,     2,   987, 19922,  1952,
-10811,     2,   277, 22594,   320, 23948,     2,  1939, 43025,  2969,
-14165,     3,  1697, 31176,  2966, 59890,  4607, 26662,     1,  3568,
-15004,     1,  1376, 37099,     2,  2045,  1100,  2720, 50931,     1,
- 1458, 39439,     1,  1715, 11029,     3,   939, 36491,  1553, 22888,
- 4047, 55486,     1,  2828, 13849,     1,  2137, 44757,     3,  3461,
-48476,  3695,  3880,  5006, 60836,     2,   299, 32233,  5046, 60836,
-    4,  1089,  1302,  3438, 32014,  5004, 13728,  5086, 60836,     4,
- 2338, 31071,  4667, 59852,  5044, 13728,  5126, 60836,     7,   703,
-10552,  1735, 51390,  2903, 24152,  3493, 39063,  4707, 59852,  5084,
-13728,  5166, 60836,     3,  4747, 59852,  5124, 13728,  5206, 60836,
-    5,   469, 53447,   842,  5000,  4787, 59852,  5164, 13728,  5246,
-60836,     2,  4827, 59852,  5204, 13728,     3,  2092, 41262,  4867,
-59852,  5244, 13728,     1,  4907, 59852,     5,    16, 52539,   534,
-54702,   701, 59975,  3448, 49315,  4947, 59852,     2,  1600, 65093,
- 3631,  9037,     4,   454, 46021,  3037,  8437,  3339, 57941,  4011,
-55304,     2,  2078, 34669,  4986, 42654,     1,  5026, 42654,     1,
- 5066, 42654,     4,  1325, 60636,  2600,  7880,  3588,  5094,  5106,
-42654,     1,  5146, 42654,     2,  2963, 34080,  5186, 42654,     2,
-   69,   175,  5226, 42654,     1,  2410, 38691,     1,  4654, 44791,
-    1,  4694, 44791,     2,   284, 59010,  4734, 44791,     1,  4774,
-44791,     2,   219, 27005,  4814, 44791,     1,  4854, 44791,     3,
- 3159, 15447,  3628, 58789,  4894, 44791,     2,  2352, 55426,  4934,
-44791,     2,  2329, 26297,  4096,  7633,     2,  1382, 39980,  1676,
-21480,     4,   852, 57289,  1457,  1474,  1826, 45965,  2372,  9345,
-    4,   329, 53099,  1870, 11105,  3024, 27933,  3069,  2093,     3,
-   43, 27621,  4087, 47486,  4139, 33390,     2,  3879,  6036,  3973,
-52041,     2,    82, 24260,  1273, 44765,     2,   581, 22684,  4130,
-39687,     2,  2256, 31628,  3246, 48448,     1,   838, 62825,     1,
-  197, 35084,     1,   850, 55116,     2,  4116, 13184,  4165, 16959,
-    1,  1477, 45275,     1,  3953,  3744,     2,  3354, 20169,  4036,
-11488,     2,   403, 61388,  1923, 61025,     1,  1736, 16615,     1,
- 1705, 51326,     1,  4618, 59443,     1,  3329,  6834,     1,  1146,
-52437,     1,    80, 36106,     1,   678, 40150,     2,  1746, 42586,
- 4620, 58506,     1,    81, 24488,     1,  2265, 25566,     1,  4034,
- 6115,     1,  1004, 32283,     1,  1101, 13266,     1,  1769, 61175,
-    2,   646, 65534,  3041, 55405,     1,  1533, 28357,     2,   533,
-60018,  3030, 24195,     2,  1226, 65310,  4652, 60808,     2,   895,
-31658,  2067, 21856,     3,  2678, 37355,  2850,  3214,  4431, 50172,
-    2,    48, 60808,  4457, 50172,     3,   734, 15085,  2771, 36351,
- 4483, 50172,     3,  2580, 13492,  2930, 32181,  4509, 50172,     1,
- 4535, 50172,     2,  1955, 54846,  4561, 50172,     2,  2040, 61478,
- 4587, 50172,     1,  2983, 30805,     1,  1739, 61432,     1,   823,
-49302,     3,   968, 59459,  1336, 28189,  3333,  3325,     1,   660,
-62231,     1,  2392,  9064,     1,  1663, 44223,     2,   162, 49255,
-  609,  6251,     2,  1453, 26821,  2508, 20087,     1,  2367, 16575,
-    1,  3255, 19705,     2,  4057,  1430,  4108,   411,     3,    13,
-57660,  1205, 57838,  3747,  8105,     2,  1610, 22884,  3666, 25582,
-    1,  1626, 63800,     3,   310, 64728,   597, 23105,  2724, 60876,
-    1,  3968, 10542,     2,  3124, 13568,  3877,  6135,     2,   918,
-42151,  3694, 55601,     1,  1017, 58539,     1,  2172,  8092,     1,
-  447, 18430,     1,  1674, 11343,     1,   512, 11988,     2,   824,
-49302,  2286, 47401,     1,   604, 37451,     1,  1044, 26558,     2,
-  675, 38885,  1033, 58177,     1,  2080, 16423,     1,  2030, 36825,
-    1,  1875,  1062,     2,  3635, 57949,  4434, 38764,     3,   898,
-17890,  1259,  6398,  4460, 38764,     1,  4486, 38764,     6,    53,
-26455,  1270, 38217,  1876, 39122,  3762, 40942,  3925, 57750,  4512,
-38764,     1,  4538, 38764,     2,  1657,  4048,  4564, 38764,     2,
- 1687,  9729,  4590, 38764,     3,  1168, 41572,  1569, 34190,  4996,
- 7917,     1,  5036,  7917,     2,  4187, 36135,  5076,  7917,     2,
- 3327, 17234,  5116,  7917,     4,   352, 36444,   707, 16610,  1950,
- 6420,  5156,  7917,     4,   770, 48056,  1953,  3362,  3489, 19045,
- 5196,  7917,     1,  5236,  7917,     2,   313, 29701,  4045, 27087,
-    1,  2791, 49557,     1,   511, 17896,     1,  4121, 26703,     1,
-  563, 47018,     1,  3730, 31596,     1,  3660, 52352,     1,  3199,
-64998,     1,  4183, 64092,     2,  2841, 11534,  2883, 43291,     2,
-  196, 12513,  4208,  7212,     1,  3731, 64240,     1,   357, 59172,
-    1,   738, 45227,     1,  2205, 55543,     3,  2169, 46038,  3376,
-50731,  3721, 19208,     2,  2020,   622,  3025, 46988,     2,   408,
-16232,  1996, 64423,     2,   861, 44392,  3834,  5275,     2,   702,
-47045,  2587, 45414,     2,   936, 55222,   941, 21013,     1,  1901,
- 5848,     2,  1090, 27280,  2908, 39677,     1,  1377, 12991,     1,
-   73,  4988,     2,  2471, 65362,  3102, 44622,     2,   621, 10615,
- 1540, 14601,     1,  2540, 27846,     1,  1591, 58506,     1,  1907,
-23081,     1,  2690, 61438,     1,    86, 36249,     4,   119, 59717,
- 1601, 58589,  2867, 64582,  3450, 23340,     1,   691, 43560,     1,
- 3388, 54198,     1,  1727, 19933,     3,  1694, 53755,  3336, 30822,
- 3847,   535,     1,   601, 16900,     2,   760,  4512,  2185, 57860,
-    2,   199,  5986,  3891, 23999,     1,  2467, 12837,     1,  2087,
-49970,     2,   685,  1140,  3363, 28019,     1,  1981, 44625,     2,
- 3144,  7885,  3682, 54010,     1,  2571, 58703,     1,  2656, 45704,
-    1,  2332, 11209,     1,  1638, 30780,     1,  2093, 52507,     1,
-  717, 18283,     3,   547, 18862,  1008, 16776,  2451, 38215,     3,
-  748, 59921,  2019, 14696,  2779, 42866,     1,   325, 64742,     1,
- 1622, 17394,     1,  3940,   780,     2,  2810, 55178,  4670,  7276,
-    4,   121, 40205,  1842, 16758,  2737, 61555,  4710,  7276,     3,
-  769,  7829,  3467, 11696,  4750,  7276,     1,  4790,  7276,     1,
- 4830,  7276,     1,  4870,  7276,     2,  4158, 33796,  4910,  7276,
-    1,  4950,  7276,     2,   771, 44158,  2916,  5490,     1,  1579,
- 6904,     3,    92, 41933,   292, 44713,  3934, 19735,     2,   627,
-12175,   921, 42920,     2,   862, 63355,  1528,  9183,     1,  2012,
-20058,     1,  2031, 52675,     2,  1080, 49337,  4004, 36661,     1,
- 2002, 18019,     2,  1768, 50063,  2518, 39761,     1,   216, 37349,
-    3,   705, 45726,  1947, 57327,  2113,  5877,     1,  2156, 20522,
-    2,   684, 40693,  3794, 46354,     1,  2640, 63403,     2,  3490,
-48530,  3659, 46473,     1,     0,  7644,     2,  1863,  3207,  1983,
-25034,     3,  1475, 60379,  1546,  1549,  1843, 17276,     4,  1465,
-33519,  1737, 42321,  3678,  2900,  5011, 19477,     2,  3218, 20001,
- 5051, 19477,     2,  1930, 44422,  5091, 19477,     3,  2671, 26159,
- 3008, 47425,  5131, 19477,     2,   764, 15833,  5171, 19477,     1,
- 5211, 19477,     1,  5251, 19477,     1,   518, 25647,     1,  4990,
-43531,     1,  5030, 43531,     1,  5070, 43531,     2,  1018, 38259,
- 5110, 43531,     2,   530, 14563,  5150, 43531,     2,  1351, 47174,
- 5190, 43531,     2,  1993, 51519,  5230, 43531,     2,   498,   566,
- 3627, 14509,     1,  3850, 26647,     3,   572, 35819,  1028, 46840,
- 2899,  2935,     3,  1384, 35606,  1787, 54555,  3445, 61208,     1,
- 1429, 62771,     5,   155, 17129,   289, 47768,   385, 19697,   428,
-55050,  1048,  5079,     2,   985, 60229,  2386, 26786,     1,  3175,
- 9911,     1,  1209, 33108,     3,   750,  9387,  3790,  7993,  4111,
-26112,     2,  3167, 27341,  3639, 33841,     3,   176, 53073,  2982,
-21033,  3876,  6194,     2,   671, 24074,  4177, 40674,     2,  2902,
-18922,  4085, 16310,     2,  1323, 53989,  4051, 24843,     1,  2039,
-10913,     1,  3653, 38989,     3,   631, 27824,  2939, 14947,  2980,
-44312,     3,   762, 40146,  2570,  9678,  3125, 64474,     1,    42,
-24074,     2,   467, 32566,  2769,  8269,     3,  1718, 21282,  3480,
-53760,  5261, 26805,     1,  1747, 41117,     1,   706, 32733,     1,
-  540, 61418,     2,  1920, 29620,  3805, 19100,     1,  2277, 26927,
-    1,  1172, 13636,     3,  2084, 57413,  3883,  8404,  4046, 37244,
-    3,   486, 37813,  1069, 28955,  3563, 24389,     1,   781,  8994,
-    1,   837,  4843,     3,   125, 59174,  1926, 57942,  2112, 21275,
-    1,  1795, 57245,     1,  1707,  1041,     1,  3342, 38438,     1,
-  298,  2928,     1,   772, 58359,     1,  2545, 49169,     2,  1369,
-46678,  2738, 63238,     1,  1119, 29764,     1,  5009, 35274,     1,
- 5049, 35274,     1,  5089, 35274,     2,  3028,  1727,  5129, 35274,
-    1,  5169, 35274,     2,  1666, 49889,  5209, 35274,     1,  5249,
-35274,     2,  1681,  3087,  3614, 56148,     1,  1536, 47683,     1,
-  275,  7144,     2,  1434, 63534,  3268,  4837,
+const unsigned short DictKeyPerfectHash[] = {
+ 2635,  5270,     2, 32770, 32793,     4,     1,     7,     0,     1,
+    1, 32806,     1,     2,     0,     0,     2,     2,     1,     0,
+    3,     3,     0,     0,     5,     4, 32808,     1,     2, 32809,
+   14,     5, 32827,     2,     6, 32838,     2, 32840, 32851, 32863,
+32873,     0, 32884, 32887,     3,     0, 32888,     5,     0,     4,
+    1,     7, 32896, 32902, 32912,     2,     4,     0,     0,    14,
+32936,     0, 32941,     1,     2,     0, 32945,     1,     0,     0,
+    1,     0,     1,    15,    10,     9,     0,     5, 32958,     1,
+32972,     1,    11, 32982,     2,     6,     1,     4,    13,     4,
+32987,     0, 32998,     0, 33007,     3, 33008,     4,     0, 33015,
+    1,     0, 33030,     1,     2,     4,     2,     6,     0,     0,
+    1,    17, 33038,     1,    10,    10,     1,     2,    11,     1,
+33048,     0,     1,     9, 33056,     8,     6,     9, 33085,     1,
+    0,     3,     1,     0,     3, 33091, 33093, 33094,     1,     1,
+33106,     1,    32,     2,     5, 33114,     0,     3,     1,     0,
+33120, 33121, 33133,     2,     0,     9,     0,     0,     5, 33141,
+    1,    15,     3, 33143, 33146,     0,     1,     3,     3,    15,
+33156,     4, 33159, 33189, 33194,     8,     0, 33201, 33202,     0,
+    0,     2,     7,     0,     1,     8,     0, 33211,     3,     1,
+    0,    20,     6,     6,     2, 33216, 33217,     0,     7, 33218,
+33222,     1,     3,     6,    10, 33223,     1,     0,     0,    11,
+33235,     7,     0,     1,     1,     0,     3, 33239,     4,     3,
+   10, 33251,     0,    38,     2,    10,     5,     1,     0, 33261,
+33262,     8, 33266,     0,     2, 33271,    12,     3,    15,     4,
+   15, 33280,     8,     0,     3,     0, 33283,    10,     3,     0,
+    1, 33288,     2,     4, 33304,     2,     2, 33305,    24,     0,
+    1,     4, 33309, 33316,     0,     2, 33327, 33331, 33336,     8,
+    9,    12,     1, 33343,     2, 33346, 33350, 33356,     4, 33359,
+    2,     1,     5,     0, 33378,     1,     0, 33379,     0,     0,
+33388, 33391, 33411,     9,    15,     5, 33416, 33425, 33433,     4,
+    2,     3,     2,     2, 33434,     1, 33449, 33461,     1,     2,
+    1,     0,     1,     6,     0,     4,     1,     6,     1,     0,
+   13,     1,     1, 33475,     1, 33479,     4,     0,    28,     4,
+    0, 33484,     4, 33498,     2,     1, 33500,     3,     0, 33510,
+    4,    22,     3, 33515, 33518,     3,     0, 33522,     1,     4,
+    5,     0,     5, 33523,     8,     0, 33526,    40,     0,     1,
+33530,    15,     3, 33531,     2, 33533,     1,     0, 33535,     2,
+    0,     3,    13, 33542,     6,     2,     1,     0,     2,     7,
+33569,     0,     1,     2,     1,     2,     1,     6,     2, 33585,
+    4,    16,     4,     4, 33591,     0, 33598,     1,    13, 33602,
+    6,     3,     2,     5,     5,     1, 33616,     1,     6,     1,
+33617,     0,     2,    10, 33629,     9, 33632,    18, 33634, 33635,
+    1,     1,     0, 33677,     2,    27,     1, 33678,     3,     3,
+    1,     1,     0,     6,     3,     1,    15,     9, 33691,     1,
+33693, 33694, 33697,     2,    12,     0, 33698,     9,     4, 33703,
+33704,     3,     2,     0,     1,     2,     3, 33731, 33744, 33753,
+    3, 33758, 33760,     6,     2,     9,     0,     0,     2, 33767,
+    1,     1, 33773,     0,     1, 33779,     0, 33795, 33800,     3,
+    8, 33805, 33813,     0,     1,     2,     0,     0,     0, 33838,
+33842,     0,     0, 33875,    12,     0,     2,     1,     4,     5,
+   19,     1, 33879,     1,     3, 33895,     0,     0,     4, 33916,
+    7, 33921,     4, 33926,     1,     7,     7,    10,     9,     3,
+   14, 33938,     1,     3, 33944,     2, 33953,     2, 33971,     0,
+33973,     4,     1,     0,     0, 33976,     9,     5,     3,     0,
+    0,     6,     1,     2,     1,     2,     1,     2,     0,     4,
+    5,     0,     4,     6, 33983,     1,     5,     1,     1,    11,
+    0,     3,     3,     9,     0,     6, 33984,     8,     2,     0,
+33987, 33997, 34001,     9,     8, 34017,     1, 34020,     0,     0,
+    0, 34021,    12,     1,     7,     8,     1, 34036,     2,     2,
+    7,     0, 34049,     3, 34064,     9,     0, 34080,     0, 34082,
+34095,    13,     8,     3, 34105, 34118, 34122, 34139,     0,     0,
+    2,     1,     4,     5,     0,     3,     1, 34140,     8,    17,
+    0, 34151,     8,     0, 34155,     7,     2,     8,     1,     1,
+    8,     2,     4, 34164,     1,     2,     4,     1,     0,     0,
+34170, 34176,     9,     3,     2,     9,     1,     1,     1,     0,
+    1,     0,     3,     7, 34192,    12,     0,    17,     2,    17,
+    9, 34193,     0, 34197,     0, 34202,     9, 34218,     9, 34228,
+34255,     7,     1,     0, 34268, 34273,     0,     0,     3,     0,
+    7,     2,     3,     0,     2,     7,     1,     0,     8,     1,
+    0,     4,     3,    25,     0, 34288, 34308, 34322,    30,    28,
+34329,     1, 34333,     1,     5,     2,    22,     0,     4, 34336,
+34337,     1,    12, 34345,     1,     0,     0,     1, 34348,    20,
+    1, 34351, 34361,     1,     0,     0,    12,     3,     1,     1,
+    1, 34378,    16, 34379,     1, 34386,     1,    12,    17,     1,
+34387,    13,     0,     2,    28,     0,     1,     9, 34424,    30,
+34427,     9,     5, 34432,     1,     0,     1, 34443,     0,     4,
+    3,     3,     0, 34463,     1, 34469,     0, 34498, 34499,    18,
+    9,    29,     4,     0,     3,     1,     0,     7, 34509, 34515,
+    5,     0, 34516,     1,     1,     2,    15, 34536,     6,     2,
+34537, 34539,    12, 34552,     4,    10,     5,     5,     3,    29,
+    3,     1,    10,    13, 34555,     3, 34562,     0,     1,     2,
+    1, 34568,     2,     2, 34576,    30,    11,     4, 34581,     0,
+    1,     9,     0, 34590, 34592,     2,     3, 34614,    30,     0,
+34619,     4, 34627,     6, 34629, 34640,     5,    42,     1, 34652,
+    7, 34655, 34677,    11,     0, 34679, 34680, 34684,     4,     1,
+    1,    11,     4,     8,     0,    19,     7,    22,     2,     3,
+    0,     0,     3, 34705, 34715, 34716,     1,     3, 34718, 34720,
+34733,     0,    10,    10,     3,    10,     0,    31,     2,     1,
+    1,     1,     2, 34737,    10,     0,    10,    10,    54, 34744,
+    2,    21,     4,     0,     7,     3,     2,     0,     3,     1,
+    0,     0,     0, 34754,     1,     0,     4,     1,     1, 34755,
+   13,     0, 34759,     5,     9,     2,     1,     2,     3, 34784,
+    1,     1,     1,    19,     0,     8, 34788,     2,     8, 34791,
+   10,     1,     2, 34794,     0,    25,    11, 34803,     6, 34806,
+   11, 34817,     0,     2,     1, 34818, 34821, 34825, 34831,     0,
+    3,     4,     0,    16,     6,     2,    10,     6,     2,     3,
+    4,     9,     2,     0, 34832,     5, 34834,     2,    11,     4,
+    3,     0,    16,     3,    13,     0,    10, 34840,     1,     1,
+34841,     1,     2,     1,     1,     0,     1,     3,     6, 34855,
+    0,     4, 34863,     5,    15,    25,     4, 34864, 34883,     3,
+    3,     1, 34896,     3,    13,     4,     4, 34899,     4,     4,
+   59,     1,     6,     1, 34900,     1,    24, 34911,     2,    28,
+    0,     1, 34913, 34916,     0, 34917, 34922,     2,     0,     2,
+    0,     1,     1, 34928,     6,     1,     5,     3,     5,     2,
+   16, 34933,    32,     5, 34936,     3,     0,     6, 34943,    28,
+    5,    38,     0,     9, 34944,    15,    10,     1,     2, 34946,
+   16,     3, 34956, 34979, 34984,    13,     0,     6,     2,     2,
+    1,     0,     5, 34996,    24,     2,     0,     3, 34999,     0,
+    2,    13, 35002,    17,     5, 35003,    18,     2, 35016, 35025,
+    8,     2,     4,     2,     3,     0,     4,     1,     5, 35032,
+35035, 35037, 35051, 35056,     8,     4,     1,     3,     4,     4,
+    4, 35076,     5,     4,     4,    16,     3,    17,     1,    35,
+    7,     7, 35082,     5,     5,     2,     3,     0, 35098,     8,
+   10,     0,    22,     0,     6,     2,     2, 35100,     2, 35109,
+    0,     0,     2, 35131,     1,     1,     0,    15,    10, 35140,
+    0,     4,     2,     6,     2, 35143,    19, 35155,    18,    11,
+35161,     1, 35167,     2,     0,     0,    17,     1,     7,    14,
+    1,    16,     6, 35169, 35188,     1,     5,    11,     1,     2,
+    0,     5,    15,    13,    18,     3, 35189, 35197,    21,     0,
+35201, 35202,    23,     2,     0,     1, 35220,    29,    10,     6,
+35224,     0,    35,     6, 35228,     0,     3,     8,     4,     4,
+    4,     5,    15, 35233,     8,     0,    27,    14,     7, 35236,
+    4, 35241,     6,     4, 35242,     4,     6,     0,     0,     7,
+    3, 35246, 35267,     2,     9,    31,     2,    11,     1, 35269,
+   16,    14, 35270,     1, 35275,     7,    19,     1,     3,    13,
+    2,     7,     0,     6,     1,     5,     3, 35281,     2,     1,
+35308, 35311,     0,    23,     0, 35313, 35322,     2,     1,     0,
+    5,     0,     3,     1,     7,     2,     0,     8,     0,     1,
+    2, 35323,     6, 35326,     1,     0,     2,    36, 35337,     0,
+35351,     4,     1,     1,     3, 35354,     9,     5, 35356,     0,
+    2,    13,     1,    21,     0,     1,     2,     2, 35370,     0,
+   10, 35394, 35399, 35411,     2, 35416, 35426,     6, 35430,    10,
+   18,     1,     8,     1, 35431,    10,    17,    58, 35433,    30,
+    0, 35464,     0, 35488,    14, 35492,    27, 35496, 35505,     1,
+35506, 35511,     8, 35519,    49,    11, 35525, 35543, 35555,     3,
+    1,     3, 35568,     7,     8,     2,     5,     3,    33, 35582,
+    9, 35605,     1,     8,     9,    15,     2,     3,     1,     7,
+   14,     3,     0,     2,    69, 35627,     1,     4,     7,    19,
+   21,     0,    12, 35628,     3,     0, 35636,     1,     0, 35642,
+    6, 35647, 35667,     5,     4, 35672, 35675,     3,     3,    18,
+35677,    19,     6,    18,     0, 35700, 35703, 35718,     1,    11,
+    2,     3,    48,     3,     0,     2,    46,     0, 35721,     1,
+35729,     1, 35731,     6, 35752,     0,    13,     0,    20,     2,
+35764,     3,     5,     3, 35779,     0,     9, 35783,     4, 35786,
+    0, 35787,     0,     6,     0,     6, 35800,    33,     8, 35802,
+    2, 35807, 35820, 35824,     0,     1,     5,     7,     2,     2,
+35830, 35832,     5,    68, 35839, 35843,    13,     0,     0,    38,
+    1,     1,     0, 35851, 35871,     0,     0, 35876,     0,     9,
+    1,    12, 35886, 35887,     4,     0,     7, 35889, 35890, 35898,
+   32,     3,    12, 35900,     4, 35901,     3,    13,     1,     4,
+    0,     4,     7, 35905,     3,     0,     4,     0,     3, 35906,
+   54,     1,    39,     2,     3,     5,     8,     3,     8,    12,
+    2, 35908, 35909,     0,    37,    40,    41, 35911, 35919,     4,
+    0,     2,     3,    11,     7,     0,     5,     5,    12,    40,
+35935, 35947,     3,    33,     8, 35956,    54,     3,     0,     3,
+35963,    33, 35964,     2,     1,    17,     1, 35972,     0,     3,
+   24,     9,     0,    40,     4, 35974,     0,    20,     1,    10,
+    0, 35975,     3, 35976,     6,     0, 35989,     3, 35993,     3,
+    9, 36012,     1,     6,    33,     8, 36015, 36025,    17,    10,
+36028,     0, 36032,    60,     1,    13,     0, 36037,     0,     7,
+   18,     7, 36048,    35,    13,     2,     1, 36054,     2, 36067,
+    6, 36075, 36105,    17,     4,     3,    15, 36116,     0,    17,
+    0,     1,     4,     1, 36122,     1, 36130, 36132,     9,    16,
+    3,    18,    14,     0,     1,     2,    21,    92,     1,     1,
+36143,     5,     0, 36144,     1,    10,     7,     0, 36147,    10,
+36159,    10,     3,     2,     1,     1,    11,     1, 36160,    15,
+    0,    13,     0,    22,     5,     0,     3, 36163,     7,     1,
+36170,     2,     7,    11,     0,     1,    12,     2,     1,     0,
+    2,     1,    39,     0,     2,     5,    24,    13,    35,    32,
+    9,    25,     4,     0,     7, 36175,     1, 36190,    13, 36191,
+    6, 36202,     0,    14,     3,     0,    18,    10,     2,     2,
+36205,    16,     8,     1,     1,     2, 36206, 36208,     4,     0,
+36211,     0,    60,    24,     3, 36216,     9,     1,    23, 36220,
+    2, 36221,    71,     5,     3, 36225, 36240,    34,    17,     1,
+    3,     9,     6,     4, 36244,     2,     0,    67, 36259, 36280,
+36289,     0,     0,     0,     5, 36301,     1,     0,     2,     8,
+36310,     8,     0,     4,     0,     0, 36311,    28,    21,     2,
+    1,     1,    50, 36348,    51,     2, 36359, 36363,     1,     4,
+   21, 36367,    11, 36370,    70, 36372,     2, 36374,     7,    23,
+    7,    61,     2, 36376, 36417,     5,    17, 36421, 36427, 36435,
+   12, 36445, 36463,    42, 36474,     1,     0,     3,    16,     0,
+    1,     0,    22, 36487,     0,   146,     0,     5,     0, 36497,
+    2,    25,     3, 36498,     8,    17,    16,    23, 36510,    16,
+    5, 36514, 36519,    34,    11,     0,    11, 36530,     4, 36532,
+    0, 36551,     2,     6, 36556, 36563,     3,     1,    48, 36575,
+    0, 36594,     0,     6,     6,     1,     4,     2, 36611,     7,
+    4,    45,     6, 36616,    31,     1,     2,    15,     7,     7,
+   73,     1,     9, 36629,     0,    14,     4,    29,     2,    60,
+   18, 36631,    31, 36633,    13, 36646, 36657,    20,     0,    15,
+    2,     5,    26,    11, 36675, 36681, 36687,     2,     1,    14,
+    1,    10,     3,    51,     8, 36691, 36704,    40,     5,     0,
+    7, 36709, 36710,    15,    12,     1,    15, 36711,     0,     2,
+36727,     1,     5,    65,    79,    26,     0,     9,     1,     5,
+    5,     2, 36741, 36749,     4,    64,     1, 36750,    17, 36754,
+36762,     2, 36763,     0,     1,     2,    63,    30,     3,     4,
+36768,    35, 36770,    32,     4,    13,     0, 36778,     2,     0,
+    3, 36779, 36783,     5,    40,    35,    42,    20,     2,     2,
+    3, 36785,   129,    47, 36821,    12,    13,     4,    68,     1,
+   54,     3,     7, 36838,     4,    18,    11,     0,    26,     1,
+    2,     1,    40,     1,    74,     1,     0,     0,    73,    36,
+    6, 36859, 36865,     0,     0, 36866,     0,     3,    16,    12,
+36882,    10, 36892,     4,    33,     2,     4, 36893,     7,     1,
+    3,    16,     7,     2,     8,    22,     2, 36894,     8, 36908,
+   33,     0,     0,     3, 36910,    17,     2,    17,     3, 36911,
+  127,     3,     2,     4, 36928, 36930,     3,     0, 36942,    41,
+36949, 36961,     0,    23, 36965, 36967,    40, 36988, 36993, 36996,
+37007,     0,    12, 37011,     8, 37014,     3,    20,     1,    96,
+   18,     1,     9,   117, 37020,     0,    16,     6,     0,     0,
+37033,    13, 37063,    50,     2, 37087,    73,     0,     0,     0,
+    0, 37102,    85,     8,     1,     1,     3,    21, 37108,     9,
+    4, 37111,     1,    48,     0, 37117,   134,    12,    13,    16,
+    0, 37120,    37,     1,    14,     2,     4,    10,     6,     1,
+   28,    30,    14, 37121,     9, 37125,     3,     3,    21,    12,
+    2,    19, 37130, 37134,    19,     0, 37137,     0,     0, 37138,
+   94, 37139,    16, 37147,     6, 37157,     5,     1, 37171,     2,
+    0, 37172,     4,     0,     0,    22,    66,     0, 37176,    41,
+    1,     3,     0, 37190,     6, 37194,     7, 37211,     3,    19,
+   39, 37214,     0,    64,     6,    21,     0,     0,     0,    15,
+    0, 37215,     1, 37216, 37229,     9,    71,     0, 37236, 37237,
+37241, 37242,     9, 37249,   135,     1, 37250,    11,     0, 37256,
+   15,     2,     7,     0,    14, 37261, 37266,     7,    11, 37272,
+    0,    13, 37273,     0, 37274,    25, 37301,     1,    32,     1,
+   12,     2, 37303, 37306, 37309,     0,     5,     7,     7, 37311,
+    0, 37317,     1,    28, 37320,    11, 37325,     9, 37329, 37333,
+    0,    22,     2, 37334,    16,    40,    23,     9,     0, 37346,
+   39,     9,    70,     0,    23, 37347,    14,     1,    44, 37351,
+    2,     4,    41,    13,     6,    27,     1, 37360,     3,     1,
+37362,     4, 37379,   110, 37394,    18,   103, 37401,    13, 37403,
+37405, 37409, 37422,    10,     2,    24,     1,     1,    26,     2,
+37423, 37425,    23,    12, 37426, 37429,     0,    20,    18,    10,
+    8,    12,    79,     0,     7, 37433,     2,    10,    71,     1,
+   31, 37452,    12,     4,     6,    60, 37453,    21,     2,     9,
+37455,    58, 37456,    26, 37457,    40,     3,     4,     6,    35,
+    0,     1,     0,    27,    23,     8, 37471,    81,    58,     0,
+    3,     7,     0,     0,     0, 37477,     0,     0,    24,    15,
+  269,     0, 37480,     1, 37482, 37483, 37493,     3,    23,    10,
+   10,    70, 37495,    23,    37,     1, 37508,    39, 37510, 37523,
+    1,     2,    46,     7,     1,     1,    22,    70,    15,   397,
+    6,    10,    48,    25, 37531,    10,     0,    23,    29, 37543,
+   39,     0,   121,     0, 37563, 37565,   233,     1,     4, 37567,
+   28,     5, 37569,     5, 37570,     2,    39,     0, 37577,    28,
+37580,     7,     3,     8,    17,    76, 37586, 37589,     0, 37595,
+37598,    89,   188, 37608,    20,    10,    91,     2,     6,   124,
+    0,     0,   166, 37625,    34,     0,     2,    21, 37641,    56,
+    0, 37649, 37661,     2,    12,     0,    22,     0, 37664,    64,
+    0,    45,     2,    37,    73,    20,    76, 37666, 37671,     0,
+37673,    33,     8,     4, 37680, 37697,     3, 37724,    95,    95,
+37728,     0,   126,    12,     7,   100,     0,    42, 37738,     2,
+   23,     2,    21,    26,     0,    52,     0,    38,    23, 37742,
+    9,   200,   126,    10,     6,   157,     7,     9,    12,     0,
+   20,     0,    40,     0,    38,    44,     6,     0, 37749,    53,
+37754,     3, 37756,    51,     5, 37763, 37774,    52,     2, 37780,
+    0, 37783, 37818,    47,   249,    63,     2, 37819,     2,     0,
+   82, 37821, 37827, 37829, 37834,     9, 37836,    47,     4, 37845,
+    6,     0, 37848, 37865,     8, 37880,     0,    90,   113,    16,
+   17,     3, 37882,    14, 37897,     5,    11,    17,     9, 37899,
+  151,     2, 37905,    16, 37910,     0,     1,     7,    75,    18,
+   38, 37911, 37912,     0,    23,     6,     5,     6,     0,     1,
+    4,   179,     7,     0, 37915,     0,     1,    16,     0,     0,
+   35, 37924, 37928,    11, 37939, 37940,    19, 37944,    75,   102,
+    1,    56, 37948,     2, 37954, 37957,    10, 37959,    26, 37969,
+  156, 37975,    20,     2, 37977, 37982,     6,     3,     1,    12,
+   32, 37999,     6,    37,     0, 38000,    81, 38003,    11,     2,
+38017,     9, 38021, 38026,     2,     3,     0,  1894,  1788,  3111,
+  556,  1964,  1841,  3458,  3292,  4095,  1985,  1353,  2260,  4631,
+ 3028,  4912,  1645,  4805,  1287,   708,  4935,  4895,   858,  2140,
+ 4358,  4508,  2058,  2576,  1812,  3191,    67,    81,   886,  3439,
+ 3277,  2581,  4145,  1054,  1934,  2799,  1212,  2246,  4897,  1411,
+ 1854,  4647,  1596,  2892,  2932,  3535,  4639,  1688,  2178,  5105,
+ 1978,  3775,  3552,  2443,  4550,  1258,  1412,  4973,  4933,   983,
+ 5148,  5219,  1973,  2257,  1927,  3335,   518,  4258,  2258,  4057,
+ 2265,   914,  4536,   295,    50,  1890,   471,  4376,  4310,  4597,
+ 1511,  4266,  3764,  4379,  3242,  2683,  4884,  4604,   815,   938,
+ 1383,   250,  2092,  1492,  4397,   586,  1464,  2341,  2054,  1520,
+ 2176,  4964,  1224,  2106,  1029,  2984,   736,  4487,  3333,  4469,
+ 4704,  4196,  1926,  4102,  5250,  2082,  4922,   626,   940,  2673,
+ 2364,  5132,  4915,  4875,  4386,  2934,  2591,   918,  2731,  4850,
+ 3218,    37,  1242,  4945,   157,  2980,  1735,  2000,  2802,  2161,
+ 4194,  4635,  3862,  4767,  1516,  1080,  4156,   777,  1485,  3523,
+  571,  1195,  4723,  5227,  4203,  5031,  2711,  1415,  2893,  3993,
+  716,  2366,  2192,   873,    62,  3425,  5137,  5045,  1519,  2120,
+ 3130,   383,   960,  3185,  1048,  4706,   454,  2481,  3403,  5215,
+ 3772,  2232,  5124,  2471,  3976,  4718,   449,  2336,  2499,  1063,
+ 3491,  2948,    20,  4112,  2498,  1139,   882,  1584,  1935,    42,
+ 1480,  4776,   590,  1277,   596,  3610,   124,  2401,  5248,   497,
+ 1594,  1503,  2722,  2974,  2025,  3706,  2468,  1283,  2024,  3471,
+ 3353,  2885,  3032,   332,  3906,   147,   603,  1995,  3935,  4801,
+ 4224,  4207,  3864,  2493,  1136,  4526,  2395,  2674,  5217,  2084,
+ 1319,  4029,  1559,  2868,  5091,  2435,  3733,  3645,  4040,  2602,
+ 1526,   752,  1783,  5247,  2645,  2107,  1804,  3656,  3080,  3365,
+ 5022,  1825,  3017,   839,  3464,  1711,  3894,   791,  3637,  2113,
+ 3568,  3612,  3592,  1810,  4667,  1347,  4659,  4091,  5192,  3146,
+ 2464,  3663,  4651,  2005,  3272,  4019,  2483,   688,  3723,  1409,
+ 5223,   507,  1314,  5008,  3936,  2889,  4780,  4971,  4104,  4886,
+ 1915,  4498,  4276,   338,  4322,  4865,  2526,  2073,  1330,  4365,
+ 3118,  4339,  1290,  1971,  3625,   686,  4294,  2160,  2590,  2865,
+  154,  2696,  1676,  3222,  4571,  2136,   900,   512,   725,   953,
+ 2918,  2609,  3586,   504,  2440,   216,  1844,  4628,  3952,  4840,
+ 2693,  2407,  2292,  1507,  2565,  1817,  3781,  3555,  4195,   176,
+ 3343,  3883,  3376,  2128,   587,  2515,   377,   645,  1017,  2436,
+ 3593,  3244,  4944,  2225,  1235,  3308,  1972,  1771,  4877,  5103,
+  243,   727,  4681,  1595,  3866,  1879,   991,   346,  2004,  1335,
+  294,  2271,  3232,  1880,  1802,  1425,  2846,  4596,  2417,  1684,
+ 3599,  4089,  5220,  2897,  1800,  3225,  2714,   296,  4683,  2899,
+ 4634,  3001,  3796,  3629,  3172,   317,  2507,  4697,  5125,  5259,
+ 1358,  2775,  4542,  2373,  2181,  4389,  1197,  4330,  5213,  1259,
+ 3481,  4005,  4241,  3580,  1334,   406,  2032,  4383,  3070,  2937,
+ 4658,  2936,  2941,  3720,  1885,  1248,    29,  1379,  3558,  4142,
+ 3880,  1131,  1714,   916,   550,  2523,  3765,   214,  2108,  3221,
+ 3369,   784,  4132,  3791,  2724,  3309,   677,  3503,  2145,  1007,
+  834,  5051,  4033,  4289,   546,  2231,  1284,  3005,  2411,   305,
+ 5151,  2741,  3268,   906,  2393,  4213,   961,  4868,  4694,   201,
+ 3213,  1071,  3598,  3938,  1060,  1443,  2307,  4431,  1155,  3556,
+ 4078,  2375,  1901,  4563,  3844,  3045,  2672,  1377,  4135,  2740,
+ 2519,  4001,  3658,  4357,  4170,  2287,    66,   775,  2540,   933,
+ 1337,  4024,  2831,  1293,  2237,  4340,  2324,  4512,  2083,  1784,
+ 3842,  2536,  4122,   637,  3336,  1000,  1500,   997,   802,  2976,
+   97,  2964,  4257,  2074,  1147,  5048,  4177,  2726,  4355,  2121,
+ 2374,  3037,  3872,  2062,  2089,  2189,  1451,   257,  1984,  2703,
+ 1220,  1870,  2152,  1249,  3456,  3515,  2554,  1037,  3689,  4579,
+ 1191,   161,  5190,  4242,  5150,   452,   581,   578,  4636,  4184,
+ 2228,  1572,  5046,  4575,  2101,   670,  1528,   658,  2702,  4672,
+ 3774,   825,  4910,  3208,  3917,   130,   190,  3444,  5255,  3504,
+ 1830,  2779,  4314,  2511,   901,   806,  1556,  4461,  1429,  3466,
+  439,  4403,   734,   684,  1338,   373,  2844,  4494,  4883,  3235,
+ 2642,   884,  2304,  4174,  4837,  1925,  1897,  1552,  1308,   646,
+ 1468,  1775,  4585,  3340,   678,  4393,  4060,  3267,  4244,  3925,
+ 4118,  3228,  4406,  4027,  3381,  3337,  4198,  1876,   330,  3014,
+ 2887,  1450,   972,  2051,  1035,  2736,   968,   919,  3961,  1959,
+ 5165,  3718,   262,  2191,  5109,  1299,  2485,  4151,  3670,   223,
+ 4464,  3039,  1657,  1546,  2118,  1474,  1510,  2023,  2486,  3946,
+  913,   446,  5155,  3492,  1504,  1523,  4210,  3161,  4788,   656,
+ 3042,  4703,  1824,  2466,  3109,  2429,  1815,  4221,  2505,  2751,
+ 1154,  4413,  4715,  4387,  2370,  1763,   661,   724,  5100,  3441,
+  465,    21,  4691,  2426,     5,   509,  5026,   364,   532,  2685,
+ 3013,  2184,  2982,  1607,   756,  5111,  2807,  5249,   396,   284,
+ 3981,  3238,  3974,  3431,  4042,  4451,    30,  2278,  1163,  2389,
+ 4388,  4968,  3607,  3106,  4736,  1954,  2649,  1076,  4965,  1624,
+  652,   306,  5207,  4199,  4587,  5135,  3344,  4150,  2446,  2144,
+ 4305,  1138,  1527,  3205,  3429,   904,  4673,  3378,  2534,   163,
+ 4369,  4069,   776,  4067,   985,  3893,  3909,  2771,  4569,   852,
+ 5233,  3729,  3867,  3427,  3170,  2544,  5073,   308,  5118,  5145,
+ 4054,   448,  1678,  3766,  4821,   379,  1691,   592,  1449,  4989,
+    0,   759,  3339,  1051,  2019,   951,  1270,  1025,  3869,    43,
+ 2748,   419,  1232,  4668,  2261,   174,  4906,  3485,  4090,  2425,
+  988,  3351,  3614,  4240,  2550,  2445,  3317,   870,  1206,  2079,
+ 1652,   800,   649,  5047,   181,  4445,  1418,  3531,  4080,  2680,
+  422,  4346,   609,  2175,  3826,  2415,  1592,  2849,  2321,  3722,
+ 1481,     2,   134,  2143,  3627,  3155,  2647,  4783,  2352,  3773,
+ 3012,  4809,  3999,  4130,  2406,  4999,  3326,  4360,  3506,  1928,
+ 4197,  4328,  4700,  1004,   148,  4083,  3078,  3673,  1047,  4976,
+   39,  3100,  4085,  3296,  4455,  1811,  4034,   929,  4222,  1509,
+ 3445,   189,  4059,  5140,  3931,  4432,  4702,  4185,  2506,  2652,
+ 4133,   798,  1064,  5036,  4641,  1226,  1537,  1340,  4041,   515,
+ 4684,  3550,     7,  4786,  5210,  1367,  1840,  1315,  1112,    41,
+ 4637,  3779,  2560,  1472,  2911,  1446,  4620,  4642,   499,  2243,
+ 2882,  4110,  4773,   869,  1427,  4404,  2608,  5267,  4962,  1895,
+ 2199,  2448,   266,  2403,   516,   524,   925,  3239,  4347,  4677,
+ 2878,  1945,  1944,  1349,   411,  1386,  5123,  2873,  5083,   136,
+  301,  3151,  4480,  4454,  1188,  4343,  1529,  4202,  4806,  1568,
+ 3652,   666,  2777,  4119,  3553,  4272,  4499,  3726,  1647,  1096,
+ 1244,  3895,  1264,  2960,  1273,  3728,  3545,  2223,  4679,  2819,
+ 3664,  3127,  1981,  2282,  3474,  3219,  1365,  3060,  1404,  2428,
+ 1127,  1653,  2715,  4331,  2371,   371,  2110,  1865,  3255,  2105,
+ 4496,  1826,  1350,  1441,  2555,  4564,  5053,   891,  1821,  2644,
+  412,  4460,  4531,  2627,  2822,  4065,   835,  1687,  4269,   453,
+  418,  2119,  3782,  4745,  4378,  4693,  4998,  2102,  3018,  4869,
+  357,  2883,   534,  3318,  3480,  1132,  5108,  2900,  4081,  2857,
+ 1515,  2044,  2512,   145,   274,   549,  4966,  1629,  1225,   436,
+  728,   622,   370,  3837,  4504,  5122,  2770,  2299,   485,  4728,
+ 1145,  2356,  4892,  4698,  1102,  2100,   319,  1193,  1256,  1739,
+ 3054,   845,   211,  2212,  2659,  2708,  4128,  2397,  1149,  2804,
+ 4181,  1370,  4784,  4025,   300,  1213,  1398,  2069,  3817,  1321,
+ 2220,  4984,  1759,  3714,  3488,  3582,   657,   121,  1557,  4394,
+  952,   387,  4342,  3349,  1123,  2569,  3315,  4660,  3910,  1344,
+ 1893,  1721,   861,  3057,  4686,  1988,  4593,  3495,  3797,  3494,
+ 1872,  5264,  4926,  1455,   748,  1142,  2124,  1428,  1030,  3110,
+ 4052,  4423,   959,   647,  4214,  2621,  1620,  4625,  5164,  5018,
+ 2721,  4978,  4375,  2390,   362,  2071,  3000,  4356,  1432,  2716,
+  895,  2165,  2217,  2635,  1276,  3459,  3986,  4798,  2303,   425,
+ 1059,   642,  2134,  4810,    51,  3623,  3257,  2539,   513,   322,
+ 1623,  3128,  1602,  3941,  4159,  5268,  1137,  2042,   801,  2954,
+ 3786,   879,  1581,  2601,  2284,   278,  2572,   280,  3312,  5163,
+ 1760,   162,  3475,   529,  4251,  4225,  2419,  5263,   318,   837,
+ 2789,  3346,   627,   426,  1932,   931,  2686,  3199,   298,  1205,
+  213,  3489,  3423,  4299,  5009,   511,  1570,   283,  2295,   225,
+ 1183,  2053,  3966,  3564,   612,  2382,  1281,  3926,  4669,  3808,
+ 4724,  3405,  2224,  3331,  5095,   742,  2168,  2358,   848,  4279,
+  290,   758,  1156,  3418,  3373,  1310,   547,  2254,  2607,  4411,
+ 1625,  3661,  5232,   183,  4557,  2651,  2757,  3139,  1942,  1262,
+ 1681,   711,  4283,  4714,  2951,  5129,   591,  4974,  3282,   321,
+ 2940,  5149,  2929,  2183,  3182,  5029,   335,  5188,  1082,  3624,
+  883,  3226,  5166,  1028,  1940,  1604,  5257,   508,   917,  4048,
+ 4716,   820,  4364,   476,  2430,  4344,  4318,   980,  3357,   863,
+ 2218,   943,  1550,  4952,    13,  3759,   553,   260,  2502,  1997,
+ 1779,  4366,   563,  1919,  2096,  1208,   473,  2922,  3512,  1105,
+  288,  3783,   159,  2656,  2915,  1395,  2173,  2981,  4236,  3462,
+ 4281,  2055,  1608,  3147,   788,  4351,  4992,  4465,  1435,  3207,
+ 4957,  2847,   840,  1170,   177,   894,  2301,  2335,  4740,  1090,
+ 2072,  3059,  4094,   390,  1827,  2641,  1567,  4066,  2678,  4847,
+ 4070,  2872,  2157,   316,   380,  4562,  4261,   662,  5143,  1741,
+  588,   468,  3136,  3896,  2151,  4662,  4405,  2692,  5245,    23,
+  862,   227,  4624,  2027,  1922,  1751,  3279,  1553,  2219,  3856,
+ 1823,   279,  1261,   126,   963,  3216,  4710,  2179,  3647,  2836,
+ 1158,  1993,   156,   892,  1858,   241,  3511,  2733,  3517,  2599,
+ 3688,  1695,  3073,  4997,  1855,  2959,  3291,  1701,  3587,   617,
+   28,  2894,   877,  2835,   140,  1302,  4164,   428,   444,  1733,
+ 2758,  2455,  1294,  3611,  2564,   957,  4277,  1837,   226,  4395,
+ 2684,  2614,  3767,  1384,  3804,  1917,  2871,  1056,   827,  4711,
+ 4956,  5147,   149,  3699,  1849,  3771,  2383,  5034,  2790,  4483,
+ 3215,  4457,  3874,  4006,  1617,  2735,  1990,  2349,  3757,  2187,
+ 2416,  1074,  3589,  4259,  3293,  3632,  1230,  1589,   259,  1616,
+  480,  3345,  2725,  3198,  1524,  1999,   388,  3853,   973,   966,
+ 4779,  4444,  4739,  3806,   857,  1240,  3327,   939,  3260,  1850,
+ 2155,  2193,  4117,  4171,  1027,  5240,  5113,   392,  3350,  2738,
+ 3432,  5086,  5256,  4087,  4861,  2126,   309,  4981,  1852,  3476,
+  478,  3813,  4265,  3960,  1561,  1217,  3985,  2116,  1631,  2662,
+ 4300,  2148,  1686,  2588,  2248,  3280,  1467,   841,  1034,  1463,
+  382,  2660,  1948,  3323,  5181,   327,  3735,  4972,   292,  2944,
+ 1768,  4491,  3262,   876,  1685,  3354,  3708,   173,  2009,   614,
+ 3834,  1560,  4856,  1372,  2704,  2612,  2489,  1204,  1857,   525,
+ 3865,  1767,   860,  1881,  4167,  1712,  4543,  3522,  4517,   703,
+ 5171,  4849,  4106,   168,  4231,  3465,  1253,  2917,  5011,  2853,
+ 2159,  4316,  1709,  3744,  3096,  1394,  1803,    11,  4893,  3530,
+ 1445,  5179,  4098,  4014,  4988,  3115,   853,  2016,  4759,  1705,
+ 3507,   310,  3321,   129,  1019,  4900,   110,   166,    31,   635,
+ 2125,  4502,  2855,  3043,  5204,   208,  1146,  5177,  4401,  2006,
+ 3023,  3830,  1655,  2582,  1046,  3683,  5081,   430,  4293,  4709,
+ 4918,  4878,  4670,  1908,  4012,  1831,  1378,  3520,  4630,  3163,
+  165,    18,  2309,  1736,  2290,  3283,  2632,  1083,   423,  3258,
+ 3634,  2958,  1807,  1829,  5012,   722,   885,  1769,  4629,  1952,
+ 2495,  3590,    70,   803,  2008,  3009,  4037,   660,   946,  1298,
+ 4532,  3538,   340,  1275,    93,  1611,  4463,  4160,  3684,  3748,
+ 2939,  3270,  3891,  1654,  3965,  4671,  3761,  3055,  3876,  1470,
+ 1263,  1813,   115,  1936,  2747,  3750,   102,   630,  5017,   659,
+ 3594,  3863,  4746,  3513,  1869,  5090,  3231,   264,  2732,   194,
+ 2630,  4163,  4013,  3382,    32,   668,  1593,  3752,  2978,  3355,
+ 3977,  2359,  4819,  3812,  1499,  2761,  1087,  4521,   277,   786,
+  196,   160,  4173,   336,  1587,   783,  4834,  2432,     1,  1563,
+ 1731,  1621,  4674,  4785,   258,  2615,  3628,  4602,   733,  2998,
+  413,  3392,  3347,  2877,   291,  1883,  3860,   519,  2584,  1541,
+ 3314,  2392,  3913,  2250,  5027,  4208,  2340,  2749,   138,  5230,
+  844,  4282,  4488,  4719,   714,   602,  1518,  1190,  1756,   526,
+  142,  4341,  1356,  4459,   817,   750,  4126,  2270,  2322,  3332,
+  842,  3457,  2989,  2816,  1180,  5238,  2952,  4857,  4817,  4565,
+  538,  2755,  2091,  2664,  3803,  4333,  2487,  3997,   956,  4757,
+ 1983,  4790,  5032,  2329,    25,   896,  2881,  1947,  5039,  4993,
+ 3959,  4030,  4136,  5000,  2461,  4985,  2864,  2433,   521,  2589,
+ 2817,  4661,   315,  3307,  4927,  3719,  4031,   653,   103,  2595,
+ 1670,   238,  3679,  1075,  4428,  2197,   520,  2276,  3472,  1390,
+ 4286,   888,  3310,  3394,  3104,  4519,  2537,  5098,  2150,  3200,
+  328,  4275,   188,  1632,  3142,   819,  3176,  5161,  1257,  3927,
+ 2202,  2398,  3674,  4614,  3794,  4228,  2229,  4611,  3159,  5195,
+ 1397,   180,  2687,  2504,  2914,  3486,  3711,   947,  2803,  1661,
+ 5266,  2787,  4273,  4940,   545,  1745,  3077,  4842,  2620,  2988,
+ 3201,  2050,   199,   709,  1658,  1241,  4407,  5246,     4,   889,
+ 1176,  3725,  5106,    73,  2377,  1203,    26,  2546,  2345,  2901,
+ 3760,  5194,   326,  1910,  2880,  4854,   826,  4761,  4298,  3972,
+ 3819,  3742,  3901,  1125,  5060,   905,  3982,  2728,   537,  4911,
+ 4816,  3695,  3138,  2166,  3396,   455,  1341,   620,  3036,  4646,
+ 3113,  2413,  4812,  2925,  4032,  2387,  2579,  2449,  4982,  3947,
+ 1251,  1874,  1630,  2839,  3585,  1586,  2020,  4470,  1342,  5093,
+ 3408,   650,  4044,  3740,  4963,  1210,  2719,  2215,  2078,  2447,
+ 4335,  4295,  4794,  3433,   244,  2076,  5088,  1772,  3230,  1301,
+ 4705,  1719,  1909,   695,  1151,  4781,  1304,  1303,  3468,    99,
+ 1667,  2913,  5254,  5189,  2209,   693,  4398,   192,  2933,  3715,
+ 4726,  3184,   618,  2421,  1058,  4582,   712,  1585,  4888,   719,
+ 2650,  4656,  3098,   932,   706,  4914,  2528,  1749,  4549,  4643,
+ 4079,  4725,  2402,  1986,  3062,  2768,  3736,   267,  3090,  4713,
+ 4028,  3615,  3412,   605,   822,  1456,  3908,  2327,  4262,  1606,
+  540,  2521,  4062,    45,  3919,  3962,  3107,  4889,  3058,  2603,
+ 2367,  5079,  5120,  2648,  1540,  3659,  2056,  1360,   237,  3380,
+ 1289,  1820,  1992,   682,  2438,  2796,  3389,  5016,  3898,  4139,
+ 1015,  2444,  4617,  1355,  2930,   868,  1522,  4489,  3788,  3117,
+ 2262,  3508,  2830,  4114,  4138,  2423,  1438,  3559,  3022,    60,
+  282,  5205,  1045,  1814,  1237,   922,   285,   144,   640,  5201,
+ 4323,  3411,  1165,  1551,  4306,  4227,  4720,  2829,  4436,  2718,
+ 3487,  2781,  2332,   606,  3671,   797,  3158,  2048,  2288,  4633,
+ 2437,  1998,  2613,  3233,  1662,  4961,  2162,  2208,  3730,  2992,
+ 2919,  3561,  2850,  2518,  3140,  4061,   790,   109,  1279,  1434,
+ 1175,    88,  4232,  3710,  4329,  1351,  1296,  4218,   424,  4506,
+ 4588,  2319,  3823,  4071,  3287,  1448,  3636,  2516,  2902,    98,
+ 2828,  2805,  3606,  4980,  3165,  4853,  1839,  2067,  4592,   915,
+ 3870,  4414,  2477,  3875,  1366,  3179,  1103,  1066,  2573,  1419,
+ 3975,  5130,  4311,  5138,  2138,    94,  3285,   557,  4075,  1656,
+  641,  4140,  4678,  1375,  1024,  1748,  4995,  1965,  2797,  3566,
+ 3574,  3928,  2253,   356,  2038,   648,   941,  2533,   248,  1413,
+  675,   324,  2007,  1391,  4002,  3496,  3851,  1506,  2956,  3240,
+ 1674,  2473,  3224,  4941,  4165,  2592,  3148,  1577,  3643,  1331,
+  420,  1743,  3899,  4125,  3501,   958,  1269,  4994,  3691,  2567,
+ 1452,  3089,  4796,  4987,  4949,  1848,  1023,   690,  3003,   849,
+ 3984,  5202,  3103,  4696,  2465,  2094,   246,  2453,  2834,  4885,
+ 2970,  2031,   623,  4523,  1752,  1003,  3649,  3500,  4855,  3387,
+ 3667,  3035,  1535,   832,   286,   403,  1903,   969,  4590,  3734,
+ 1950,  4538,  2312,  4943,   460,  5002,  3399,  4598,   979,  1484,
+ 1457,   573,  3945,  2361,  4124,   813,   467,  2543,   488,  2776,
+ 4820,  2556,  3384,  1864,  3437,  2691,  5260,   120,   111,  5172,
+ 3682,   431,  4533,  1116,  3011,    68,    74,  1115,  2548,  5269,
+ 4141,    44,  4983,  4201,  4846,   935,  1414,  2015,  5070,   265,
+ 1359,  1501,  5116,  3145,   975,  2801,   255,  4844,  1325,  1122,
+ 3066,   570,   458,  4408,   320,  2247,  4829,  4073,  4319,  5258,
+ 4958,  4086,  3214,  2571,   151,  1085,  3443,  3833,  1099,  2263,
+ 3195,   528,  2170,  2127,  3820,  2111,  4827,  4325,  1789,  4663,
+ 1878,   995,   239,   224,  4835,  3967,  3247,  4797,  1601,  2821,
+  850,  4645,  2950,  1153,  1843,  3573,  3541,  1107,  2041,  2860,
+ 1233,  5262,   992,  4648,  1494,  4687,  2557,  2737,  2147,  3839,
+ 1723,  1496,  3884,  3622,   440,  4554,  2679,  2739,  1517,  2633,
+ 4263,  2859,  4424,  4076,  3749,  3289,  1730,  4514,  1512,  2200,
+ 4826,   118,   856,   531,  1442,  4558,  4666,  1682,  5050,  1357,
+ 3662,   170,   447,  4975,   741,   978,  3737,  1795,  5035,   141,
+ 3137,  3401,  1996,   673,   651,  3329,   522,  2895,  3807,   119,
+ 4418,  1628,  4583,  4082,   334,  1380,  2404,  2524,  1796,  1832,
+  672,  3847,  3212,  2343,  2646,  3162,  1278,  3320,  2808,  5003,
+ 3762,  3286,  3793,   663,  2866,  3482,  4612,  3076,  2256,  2463,
+ 2916,  2022,  2552,   880,  4566,  5089,   544,   971,  1970,    17,
+ 3554,  4396,  4370,  3675,  2029,  3840,  3832,  2949,  4813,   433,
+ 4537,  1906,  4644,  3603,  4845,  2315,  2874,  4765,  1152,  3154,
+ 3569,  3067,  3991,  2967,  3125,  4937,  2331,  1651,   491,  1530,
+ 4056,  1868,   492,  3143,  2203,   760,  4744,  5144,  3166,  2794,
+  253,  1194,   222,  3414,  5199,  2957,   202,  2766,  5158,  1639,
+ 1513,   696,  1221,   838,   104,  5025,  2547,   146,  5176,  4524,
+ 4909,  1265,  1292,  2064,  4559,  3668,  1734,  2149,   307,  3654,
+ 1086,  1640,  1189,  2386,  3978,   275,  2063,  4510,   753,  4484,
+ 4216,  2991,   924,  4789,   242,  1904,  5178,  1305,  4353,  5235,
+ 4327,   713,  3871,  1228,  4650,  4772,  4349,  4100,  2657,  3848,
+ 4800,  3253,  3818,  1856,  3236,    12,  4777,  1532,  3435,  3245,
+ 2167,  1627,  4097,  3755,  4435,  1067,  5157,  4229,  4243,  2011,
+ 4743,  2227,   391,  4955,  1534,  2705,   514,  3397,   970,  2636,
+ 4748,  3769,  1014,   313,  1588,  3828,  2742,  3473,  1962,  2039,
+ 3447,  3648,   907,  4153,  1403,  4654,  3446,  3792,  4515,  3056,
+ 4936,   890,  1238,  3177,  2251,  2782,  3451,  1859,  2103,  4551,
+ 4734,   402,  1664,   505,  4473,  4607,  1363,  3548,  2422,  4540,
+  381,  1231,  5004,  1715,  3633,  3798,  2348,  3470,  4337,   167,
+ 4278,  2085,   872,  2661,  2355,  4603,  4205,  2264,   429,  3943,
+ 1941,  1505,  2109,  2046,  2681,  1951,  2676,   289,  3434,  2484,
+  372,  2577,  1282,  1407,   799,  2551,  4399,  3540,  4373,  3479,
+ 1946,  2093,  1665,   744,  5211,  2086,  2313,  3562,  2995,  5126,
+ 3497,  4368,   249,  3094,  2813,  1160,  4518,  2026,  3085,  1436,
+ 2798,  2285,  5071,  4239,  2286,  4887,   462,  2431,  5251,  4372,
+ 4500,  1637,  3428,   875,  4255,  2372,  1020,  4362,  3717,  1790,
+ 2825,  3295,  4015,  2057,  1549,    78,  4601,  1899,   409,   937,
+ 2369,  4103,    52,  4799,  4172,   269,  2255,  3305,  1219,  4253,
+  772,  3542,  4430,  1863,  5196,   789,  3843,  3724,  4288,  5184,
+ 3904,  3563,  4595,  5152,  1073,  4969,  2132,  1778,  4453,  3313,
+ 4427,  3604,  4217,  2081,   613,  3194,  3914,  1610,  2034,  2600,
+ 4038,  1245,   502,  1953,   702,  2920,  2623,  4084,  1424,  3646,
+ 2439,  4391,  3879,   345,  1531,   229,  3483,   664,  1100,   560,
+ 2884,  1816,  4822,  2365,   843,   575,  1329,  2975,  5218,  4545,
+ 2784,  2905,  2987,  3091,  2604,  4026,  4832,  2314,  2637,   568,
+  268,  3768,   694,   435,  4830,  3838,  1861,  1533,  1562,  3407,
+ 2357,  3596,  2347,  3025,  2112,  1659,  2380,  3141,   738,  3046,
+ 1052,  1031,  1174,  1819,   610,  1012,  1761,  1120,  1921,  2908,
+ 3915,  1036,  1010,  1975,  3311,  3006,  1938,  2272,  2216,  3074,
+ 4230,   256,  1040,  5226,  4296,   219,  3505,  2104,   457,  3816,
+ 3417,  2146,  4570,   193,   584,  1776,  2388,  4317,  4402,  1134,
+ 4072,  5236,  2667,  3190,  2298,   726,    77,  3398,  3892,  3281,
+ 2619,  3442,  2912,  4193,  3929,  5005,  3882,   510,  1053,  1229,
+ 4363,  5170,  4320,  5001,   251,  5133,  1818,   314,  2823,  2625,
+ 4758,   479,  3738,  4443,  5075,  2631,  1422,  2545,  3902,  1167,
+   61,  2174,  3635,  1476,  3809,   152,  3988,   604,  4737,  2049,
+ 4302,   634,   987,  3174,  3685,  4851,  2014,  4811,    38,  5198,
+  721,   414,  1239,  2279,   930,  3452,    53,  3971,   811,  4308,
+ 1327,  3004,  2164,  3770,  5114,  4250,  1598,  2586,  1001,  2235,
+ 1600,   893,  5067,  3252,  3031,  2655,  2695,  1692,  2206,  2205,
+ 1489,   579,   965,  1376,  3990,   132,  1889,  1124,  4762,  4618,
+ 3027,  2861,  5136,  5021,  2317,   974,  1717,  2500,  4873,  4833,
+ 3608,  4055,  3989,  3363,  1968,   624,  3306,   902,  3187,  4870,
+  451,  1016,  5224,   874,  4143,  2566,  2043,  1642,  4105,  4682,
+  729,    48,    95,  3546,  1916,  4022,  1716,   828,  4420,  1668,
+ 4860,  2764,  4986,  4655,  1770,  5069,   353,  4741,  4701,  1747,
+ 3602,   967,  2985,  2852,  4908,  2476,  4326,   231,  1041,  1989,
+ 1838,  2542,   164,  1307,  4268,   763,   771,  4782,  5110,  4610,
+ 1579,  2462,  3038,    55,  1845,  5101,  2983,  5061,  4872,  3850,
+  299,   437,  5241,  4410,  4732,  1326,  3509,   593,  4332,  1320,
+ 4505,  1288,  1576,  2396,  2979,  1113,  4824,   191,  4657,  1618,
+ 5237,  2842,  3211,  3787,  3887,  1323,  2346,  5252,  2503,  4586,
+ 1486,  4468,  3440,  1699,  4917,  4689,  2938,  3368,   361,  3754,
+  823,  2935,  1050,   955,  2709,  3665,  5243,   128,  5052,  2622,
+ 4608,  4096,  4807,    85,  4541,  4429,  4380,  1286,  2568,  4235,
+ 5180,  1032,  4881,  3846,   793,  2973,  4009,  4234,  4990,  1851,
+ 1033,  3600,   489,  4183,  2350,  4448,  1805,   535,  2360,  4712,
+ 3334,  1009,  2875,  3751,  1185,  3002,  3377,  2496,    46,   218,
+ 2688,  2236,  3533,  4359,  2137,  2409,   397,  3493,  3304,  3859,
+ 4770,  3259,  3696,  5153,  2182,  3534,  2845,  1963,  3030,  3712,
+  261,  1871,  2238,  3799,  2529,   542,   576,  4675,  3047,  3923,
+  100,   350,  4771,  1956,  5131,   127,    87,  1766,   818,  5043,
+ 2837,   785,  4092,   198,  3071,  2457,  3529,  1649,   311,   704,
+ 2391,  3049,  5209,  4916,  2891,  2075,  3133,  4220,   365,  4919,
+ 4879,  2824,  4839,  3123,  2458,  3460,   746,  2268,  4589,  4898,
+ 4115,   182,  2744,  4511,  1765,  1161,   551,  3164,  2968,  1991,
+ 4107,  4007,  2363,  3264,   195,    56,   517,  4482,  4456,   779,
+ 4162,  3957,  4573,   928,  3093,  1931,   934,  1216,   679,  1786,
+ 2898,  3703,  2122,  1612,  4572,   270,  3284,  4520,  5200,  3302,
+ 3102,  3642,   343,  3421,  2928,  3330,  3254,  1497,  2689,  1097,
+ 3601,  3420,  1192,  2870,  2927,   527,  2318,  4417,  3229,  5028,
+ 1680,   982,  3112,  2068,  1777,  3951,  1564,  4902,  2414,  3653,
+  927,  3680,  3263,  1663,    76,  2710,  3274,  3134,  2344,  4924,
+ 1104,  2638,  1260,  1842,  3135,  1057,  1979,  3393,  5007,  3034,
+ 4120,  2514,  3324,  3528,  3173,   999,   155,  1026,   445,  1078,
+ 4513,  1348,  1114,  2240,  2997,  2597,  3092,  2585,  4823,  4003,
+ 1374,  1737,  2624,  5212,  1164,  5160,  1200,  3251,   577,   859,
+ 2289,   636,   323,  3171,  3237,    36,  3243,  4238,  2323,  1542,
+ 1508,  4754,  3375,   200,  2381,  4303,  3784,  3033,   778,  4522,
+  463,   417,   621,  2497,  4206,  3815,  1081,  3082,  4742,   597,
+  143,  3278,   655,  2513,  2291,   781,  3526,  4441,  4131,  3016,
+ 2765,  4249,     3,   347,  4415,  1742,  4146,  3801,  2910,  1095,
+ 4649,  1373,  3595,   234,  4215,  3249,  4409,  1891,  2351,   898,
+  796,  3220,  2018,  3570,  1930,  3097,  2717,  1108,  2376,   486,
+ 2626,  4149,  4442,  4385,   761,  3156,  2059,  5063,  2470,    80,
+ 2095,  1862,  2774,  2772,   171,  5056,  1488,  2221,  4825,  2198,
+   10,   561,  5066,  1400,  3298,  1643,   936,  3998,  1887,   302,
+ 4934,  5174,  4440,  2077,  2791,  1780,  4774,  1094,  4552,  2210,
+  866,   795,   386,   252,  4152,  5062,  1867,   407,  4264,  2047,
+ 4336,    15,  4938,  4284,   685,  4858,   312,   743,  2792,  2418,
+ 2943,  1846,   730,  2756,   408,  3081,  5015,   669,  1186,  3015,
+ 3732,  1084,  2999,  2639,  3026,  3873,  3498,     8,  2061,  3693,
+   14,   230,  2320,   654,  3824,   395,  4434,  5239,  5193,  2296,
+ 3973,  2617,  2003,  1011,  3527,   287,  5078,  2201,  3660,  1574,
+  113,   629,  2583,  2788,   681,  2867,  2570,   564,  3544,  1913,
+ 3756,   341,  4578,  2482,  2139,  4836,  3609,  4274,  4248,  4039,
+  354,  1157,  4862,  1900,  2682,  4312,  4766,  4292,   106,  1309,
+ 2338,  4529,   543,  3379,   698,  3810,  4433,  3463,  2707,  3362,
+ 4471,  1458,  4880,   881,  1202,  2783,  4775,   474,   459,   351,
+ 4158,  1884,   583,  1306,  4204,  3273,   897,  2903,  1465,  3666,
+ 4664,  1471,  4907,  2778,   809,   794,  1697,   962,  2955,  3616,
+  209,  2820,    92,   780,   633,  4334,  3778,  1388,  4290,  3669,
+ 3064,  2522,  3651,  2634,  4967,  3297,   847,  4270,  5139,  2605,
+  833,  1753,  2578,  1421,  4951,  4008,  1898,  2658,  3924,  4763,
+  131,   450,  2653,  2017,  1039,   384,   639,  4191,  4476,   500,
+ 3083,  1280,  3518,  3426,  5084,  3052,   767,  3741,  4209,  1698,
+ 5121,  3835,  4735,  1732,  4256,  3467,  3630,  2294,   611,  4838,
+ 3206,  3700,  4051,  2267,  5253,  1977,  1580,  3051,  4939,  3409,
+ 4899,  4859,  4093,  4591,  3120,  4707,  4247,  1460,  3739,   926,
+ 4795,  1976,  2379,   864,  4717,   700,  1886,  2727,  1729,  1675,
+ 1332,  4011,  1924,  2527,  2427,   944,  3122,  3360,   349,  3020,
+ 1285,   766,  3371,  5214,  5154,  3565,  1514,  1444,  5187,   344,
+ 3950,   565,  1703,  2690,   812,  4959,   723,  2452,  1437,  1644,
+ 4129,  1635,   206,  1673,  4462,  4977,  4271,  1346,   304,  1475,
+ 4925,  1089,   112,  3918,   483,  3916,  3261,  3727,  3841,  5055,
+ 2947,   281,  2969,   984,  1354,   854,  2606,  2963,  3588,  4606,
+  687,  3209,  4699,   732,  2316,  1679,  3129,  5261,   139,  2424,
+ 3370,  2972,  1583,  2001,   530,  3416,  1431,  2517,    35,  1093,
+ 3532,   472,  5038,  2412,  3795,  3021,  4237,   475,   498,  1002,
+ 2325,  3897,  2400,  1590,   331,  3968,  1393,   135,   105,  1646,
+ 3932,  1683,  1758,  3888,  2266,  4058,  2800,  4338,  1135,   212,
+ 2559,  1565,  3007,  3721,  2848,  5042,  2242,  3979,  4688,  3019,
+  755,  4425,  4497,  2186,  4685,  4950,  4384,  2909,  4815,  2478,
+   54,  3223,  2701,   232,  4004,  2694,  3438,  4547,  3068,  2677,
+  846,   981,  2730,    82,  4863,  3861,  3356,  4377,  1937,  3836,
+ 3964,  4111,  1196,  4769,  2226,  3075,  5080,   548,  2117,  3186,
+ 3322,  1847,  1669,   910,   878,  1578,  2530,  2535,   851,  4621,
+ 3940,  4507,   352,  4481,  5059,   948,  5019,  4036,   996,  1368,
+ 3490,  4871,   228,  3413,   899,   628,  2194,  1943,  3857,  3907,
+  487,  1297,  4493,  2328,  4467,  4996,  4421,  2131,  4605,  2214,
+ 1166,  4866,   867,  1246,  2827,  3415,  4438,  4749,  2712,  4267,
+ 1227,  1797,  2441,  4187,  1021,  2065,  4113,  3983,  3576,  1774,
+ 1498,  3514,  4814,  2961,  4018,  5037,  2362,  2239,  1381,   808,
+ 4729,  1061,  1666,  3410,  2923,  4755,  3845,   523,  2245,   831,
+  438,   644,  4905,  1718,  5206,  1022,  4190,  4615,  2474,  1710,
+ 4063,  2066,  2840,   358,  1822,  2252,  1311,  4492,  4640,  4088,
+ 3131,   598,   792,   355,  2907,  4064,  4876,   942,  1369,  2204,
+ 3328,   233,  4613,  1371,   950,  5044,  1399,  4180,  2302,  2233,
+ 2668,  1490,  2945,  5141,  1038,  3169,  1799,   773,  5010,  1704,
+ 1361,  2088,  1750,  1291,  2520,  1410,  2773,  3572,  3709,  1911,
+ 3210,  2305,  4043,  2456,   477,  1300,  3934,   720,  1806,   558,
+  562,  4486,  3800,  2832,  3290,  3994,  1118,  5208,    84,  3551,
+ 3050,  4584,   469,  4623,  3821,  1834,  4901,  1967,  2762,  3676,
+ 2904,  2097,  2574,    71,  4016,  3640,  2863,  3789,  1110,  1479,
+ 4352,  1209,  3855,   567,  2035,  1328,   689,  1689,  4390,   325,
+  769,  3063,  4556,  1720,  2896,  1693,  5221,  3626,   205,  4768,
+ 1352,  2942,   333,  1316,  3204,  5127,  2420,   782,  4920,  2510,
+ 1923,  3167,  1706,   735,   466,  4021,  3366,  3114,   490,  4101,
+ 1322,  3227,  3890,  2811,  1214,  2553,  4307,  1417,  2169,  1801,
+ 2028,   385,  1295,  5159,  1318,   816,  3557,  2862,   762,  1092,
+ 3536,  4638,   399,  2501,  3008,   555,   461,  3996,   739,  5096,
+ 2021,  4676,  2135,  1364,  3084,   410,  4525,  1573,  4567,  2734,
+ 1798,  5107,    79,  3900,  4843,  1362,  2780,   977,  4458,  3188,
+ 4577,  4260,  2965,  1544,  1980,  4426,  4121,   805,  1271,  3955,
+ 3455,   443,  3180,  4752,  4223,  3811,  4382,  3825,  3400,  1912,
+ 3567,  4695,  1566,  4680,  5076,   912,  2996,  4354,  1126,  3202,
+ 4890,  3560,  3922,   804,  4947,  4793,  1433,  5077,  2310,  1079,
+ 2480,  4753,  3175,    19,    57,  1793,   207,   976,   184,   122,
+ 4954,  2326,  4077,  2405,  2045,  1402,   569,   221,   366,  1406,
+ 3619,  3048,   757,  1077,  2953,  1614,  2030,  2760,    49,  5231,
+ 5191,  5228,  3681,  2856,  3690,  1707,   749,   153,  4721,  2012,
+ 4166,  3575,  2207,  2222,  2769,  2114,  2924,   680,  1633,  1274,
+ 1426,  2786,  3388,  4010,  2663,  5216,  1787,  1575,  3970,  4285,
+ 3358,  5142,  4192,  4074,  4953,  4913,  5099,  4560,  4017,  4534,
+ 1939,  1521,  2040,  2886,  1140,  2472,   667,  4904,  3352,  1907,
+ 1159,  4882,  4050,   751,  4802,  3124,  3539,   368,  4361,  4321,
+ 1173,  4309,  4485,  2675,  4581,   236,  2699,  5183,  3644,  2342,
+ 4137,  3920,  1483,  2087,  3069,  4188,  3422,  2385,  4291,  2141,
+ 5074,  3319,   921,  3361,  1473,  2196,  1168,   810,  2080,  1405,
+ 4942,  2563,  2858,  1150,  4921,  4211,  1312,  4530,  2752,  2190,
+  692,  5082,  3731,  4828,  4503,  4477,  4738,  4233,  4852,  2158,
+ 5087,  4960,  3753,  3969,  1339,  4371,  1065,  2098,    33,  4622,
+ 4134,   745,  2469,  1313,  4539,  1641,  3196,  4175,  1809,  3449,
+ 4903,  3701,  5064,  5024,  3150,  3743,  2806,  1791,  1933,  5225,
+  137,  1677,  3903,   158,  2475,   998,  3911,  3937,  4049,  1243,
+ 3372,  2368,  3348,  1619,   235,   263,  4948,  2330,  1599,  2230,
+ 2812,   493,   464,   178,  4313,  4287,   559,  2333,  5182,  1836,
+ 3886,    91,    64,  2354,  3933,  5030,  1148,  4108,  3303,   599,
+ 3359,  3519,  5058,  3831,  1088,  3087,  1764,  3583,  3126,  4516,
+  245,  3157,  4345,  3579,  4528,  3698,  3116,   293,  1892,  3905,
+ 4928,  3453,  5013,   774,  3745,  1957,  4053,  1582,  2090,  2508,
+  389,  1744,   363,  3692,  1401,  1613,  1044,  2810,  2562,  2442,
+  705,  3461,  1487,  4864,  1389,  1792,  3948,  3419,  3374,  1708,
+ 3949,   303,  1447,  2587,  5146,  1317,  1636,  1660,   421,  2467,
+ 3584,   254,  5234,  3776,   821,  4626,  4894,  2994,  1754,  4350,
+  580,  1013,  1182,  1130,  1236,   701,  4450,   169,  3450,  4509,
+ 1605,  3521,  5097,   964,  5057,   731,  1548,  1914,   533,  3010,
+ 1462,  2669,  3088,  2531,  2654,     6,   197,  2281,  2408,  1603,
+ 2434,  1929,   172,  1141,  1833,  4147,  1218,  3618,  2580,  3086,
+ 1525,  1453,  1109,  1049,  1267,  3854,   441,  2643,  4627,  3621,
+ 2213,  3391,  3234,  2249,  2785,   496,  5168,  1569,  3404,  1385,
+ 2002,  2099,  2618,  1782,  2921,  3747,  4576,   665,  1860,   203,
+  117,   360,  3478,  3677,  2180,   114,  1905,  4991,  5014,  3852,
+ 5169,  2234,  1672,   482,  4416,   272,  4169,   415,  2809,    27,
+ 2746,  1333,   855,   574,  4478,   830,   697,  4818,  4778,   836,
+ 3827,  4186,  5102,  3256,   754,   339,  2745,  3694,  3889,   572,
+ 3241,  2841,  4246,  5085,  2172,  4157,  1111,  3181,  1738,  2640,
+ 3577,  2558,  1387,    83,  3275,  4212,  3549,   470,  4116,   416,
+ 4930,  1069,  5119,  4439,  2274,  4652,    89,  2750,  5040,  2337,
+  908,  3053,   217,   271,  1179,   367,  1005,   116,  2754,  3299,
+  737,   949,  1117,  1873,    34,  1070,   108,  2490,  2598,  1671,
+  375,  1882,  4619,  4803,  2833,  3189,  2869,  4580,  5094,  4179,
+ 4168,   484,  3995,  4046,  1958,  2843,  1853,  4301,  3868,  4946,
+ 3678,   123,  5197,  3939,  2795,  3338,  5203,   187,  4574,  4280,
+ 4254,  2188,  3341,  3386,  3385,  2906,  4495,  2525,   993,  3294,
+ 1482,  1713,   638,  5117,  1626,  1757,  1478,   619,  1785,   954,
+ 1343,  3246,  3858,  3942,  3502,  3591,  2706,  2743,  1008,  2133,
+ 4891,  2549,  3638,   215,  4446,  4419,  2815,   133,  3657,  3499,
+ 2185,  3790,  1875,  2666,   175,  3829,  3650,   770,  2931,   348,
+  566,  1345,  4751,   747,  4324,  1454,  3178,  3805,  3620,  2698,
+ 3383,  4447,  2611,   107,  1638,  2993,  1430,  1558,  3958,  3061,
+  240,  5156,  5162,  2275,  4304,   401,  5222,   986,  4226,  5175,
+ 4127,  1545,  4535,  3785,   185,  1181,  2753,   101,  3963,  1966,
+ 2946,  4690,  1469,  2037,  4176,  1184,  1408,  2594,  3484,   807,
+ 2977,  1143,  3192,  3402,  3877,  3041,  3639,  4929,  4616,  2561,
+  359,  5128,  4000,    69,  1055,  4733,  4315,    40,  4665,  5006,
+ 3193,   632,  1987,    47,  1222,   405,  2450,  4200,  2070,  3716,
+ 1960,  3525,  3390,  3704,  3885,   539,  4099,  4474,   671,  4020,
+ 1696,  2306,  3605,  1121,  3266,  4297,  3406,  3597,  3316,   541,
+  787,  1144,   923,  4932,  3581,  5167,  4653,  1877,  1250,  4466,
+ 1439,  1201,  3655,  2759,   615,   814,  2241,  1234,  3183,  3029,
+ 3849,  1336,  2488,  1974,  1043,  2244,  2399,  1440,  5041,  3469,
+ 5112,  3641,  1725,  4546,  1694,  2990,  1255,  1252,   276,  3454,
+ 4412,   501,   601,   707,  2575,  4023,  5023,  2541,  4400,  1690,
+ 4374,  4348,  2729,  2297,  2154,  5068,  3430,  3065,  5265,   552,
+ 2334,   369,  4923,  4189,  4144,  2394,  4553,   683,  4045,  2378,
+ 4475,  1128,   710,    16,   920,  3987,    72,  5244,   204,  1888,
+ 1808,   297,  2311,  4764,  4568,  2854,  1062,  4692,  4722,  2130,
+  434,  4760,  1828,  4750,  3954,  2033,  2339,  3203,  1198,  4970,
+  494,  1171,  2926,  2013,  2156,   329,  3822,   376,  4154,  1726,
+   96,  1223,   393,  4747,  2451,  2723,  2273,  1539,  1392,  1994,
+ 2986,  3424,  1794,  1098,   554,  1555,  2720,  1591,  2171,   674,
+ 5186,  3631,   220,  1162,   495,  3921,  2491,  1902,     9,  4544,
+ 1177,    58,  1650,  4831,  2596,  4841,  3713,  4449,  3168,   608,
+ 3524,  3510,   210,  2610,  2123,  3930,   718,  3578,  1178,  1254,
+ 4178,    63,  3044,  2052,  1835,  1781,  5020,  3367,  4219,   989,
+ 2410,  4252,  1495,   398,  2115,  1423,  3248,  4155,  4632,  3276,
+ 4600,  2283,  3119,  4730,  1068,  1702,  4392,  5173,  3436,  5185,
+ 3992,  1571,   691,  4727,  1538,  1268,  3153,  3571,  2300,  2384,
+ 2697,    65,  1615,   699,   829,   865,  3250,  3537,  1106,  3763,
+  342,   768,   903,  1727,  1461,  2971,   247,  3072,   582,  2479,
+ 1416,  2826,   676,  3672,  1896,  1722,  1006,  3802,  3686,  1382,
+ 5049,   506,  1982,  4422,  3878,    90,  2671,  5242,  3265,   337,
+ 2838,  3746,  4555,  1396,   400,  1536,  1866,   715,  2060,  3613,
+  994,    75,  3024,  3547,   740,  1755,  1609,  2763,  3160,  2353,
+ 3814,  1634,  1622,  4599,  1187,  1211,  4808,   585,   125,  1502,
+ 3543,   456,  5104,  3944,  1491,   824,  4479,  1955,  1728,   594,
+ 1961,  3953,  5033,  1477,  3697,   481,  2509,  4123,  2767,  1129,
+ 4047,   150,  2616,  3777,  2129,  4472,   432,  3448,  2195,  2593,
+ 4367,   536,  1324,  3099,  2259,  1101,  2492,  4708,  2494,  1169,
+ 4068,  4527,  2153,  4501,  3217,  3095,  1266,  3758,  4452,  5054,
+   22,  1740,  2713,  2177,  2888,  4804,  4594,  4792,  2793,  1091,
+ 1547,  4609,   990,  3364,  1272,  3395,   378,   643,  3881,  2460,
+ 1746,  1554,  3956,  3149,  2876,  3271,  1920,  3288,   911,  2142,
+ 4035,   631,  4867,  3342,  1172,  4787,  2890,   503,  2211,  5092,
+ 2665,  3325,  3121,  1420,  1543,   909,  4931,  4182,   442,  2879,
+ 2532,  4161,  4381,  1207,  4109,  3687,   625,  2628,  3477,    86,
+   24,  2454,  4979,  2277,  2818,  2308,  3617,   595,  4791,  1459,
+ 2851,  4848,  3301,  3079,  2459,   616,  3197,  4561,   871,  1648,
+ 2966,  4896,  3040,   717,   607,  1762,  2269,  4490,  1215,  1119,
+  374,  4245,  1133,   945,  1042,  3105,  1918,  2163,  3702,  2036,
+ 3912,  3705,  5115,  2629,  2670,   427,  5072,  4548,  1724,  1700,
+ 3707,  3108,   887,   186,  4148,  5229,  3980,  5065,   404,  2962,
+ 2700,  1018,   765,  4874,   273,  3132,   179,   394,  1072,  4731,
+ 3300,  1969,  3101,  2010,  2280,  3152,  1597,   600,  1949,  1493,
+ 4756,  4437,  2814,  3269,  5134,  1466,  1247,  1773,   589,  2538,
+ 2293,  3144,  1199,  3780,   764,  3516,    59,
 };
 
 } // end anonymous namespace
 
 vtkDICOMDictionary::Dict vtkDICOMDictionary::DictData = {
 "DICOM",
-4096,
+0,
 5270,
-DictTagHashTable,
-DictKeyHashTable,
-DictContents
+NULL,
+NULL,
+DictContents,
+DictTagPerfectHash,
+DictKeyPerfectHash
 };
@@ -420,7 +420,9 @@ vtkDICOMDictionary::Dict Dict001Data = {
 43,
 Dict001TagHashTable,
 Dict001KeyHashTable,
-Dict001Contents
+Dict001Contents,
+NULL,
+NULL
 };
 
 // ----- SVISION -----
@@ -588,7 +590,9 @@ vtkDICOMDictionary::Dict Dict002Data = {
 88,
 Dict002TagHashTable,
 Dict002KeyHashTable,
-Dict002Contents
+Dict002Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_XR3DCAL_01 -----
@@ -611,7 +615,9 @@ vtkDICOMDictionary::Dict Dict003Data = {
 1,
 Dict003TagHashTable,
 Dict003KeyHashTable,
-Dict003Contents
+Dict003Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_IMPS_01 -----
@@ -658,7 +664,9 @@ vtkDICOMDictionary::Dict Dict004Data = {
 15,
 Dict004TagHashTable,
 Dict004KeyHashTable,
-Dict004Contents
+Dict004Contents,
+NULL,
+NULL
 };
 
 // ----- Applicare/Centricity Radiology Web/Version 2.0 -----
@@ -682,7 +690,9 @@ vtkDICOMDictionary::Dict Dict005Data = {
 2,
 Dict005TagHashTable,
 Dict005KeyHashTable,
-Dict005Contents
+Dict005Contents,
+NULL,
+NULL
 };
 
 // ----- TOSHIBA_MEC_OT3 -----
@@ -705,7 +715,9 @@ vtkDICOMDictionary::Dict Dict006Data = {
 1,
 Dict006TagHashTable,
 Dict006KeyHashTable,
-Dict006Contents
+Dict006Contents,
+NULL,
+NULL
 };
 
 // ----- GEIIS -----
@@ -752,7 +764,9 @@ vtkDICOMDictionary::Dict Dict007Data = {
 15,
 Dict007TagHashTable,
 Dict007KeyHashTable,
-Dict007Contents
+Dict007Contents,
+NULL,
+NULL
 };
 
 // ----- Philips NM Private Group -----
@@ -775,7 +789,9 @@ vtkDICOMDictionary::Dict Dict008Data = {
 1,
 Dict008TagHashTable,
 Dict008KeyHashTable,
-Dict008Contents
+Dict008Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_ACRQA_1.0 BLOCK1 -----
@@ -813,7 +829,9 @@ vtkDICOMDictionary::Dict Dict009Data = {
 10,
 Dict009TagHashTable,
 Dict009KeyHashTable,
-Dict009Contents
+Dict009Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_ACRQA_1.0 BLOCK3 -----
@@ -851,7 +869,9 @@ vtkDICOMDictionary::Dict Dict010Data = {
 10,
 Dict010TagHashTable,
 Dict010KeyHashTable,
-Dict010Contents
+Dict010Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_ACRQA_1.0 BLOCK2 -----
@@ -889,7 +909,9 @@ vtkDICOMDictionary::Dict Dict011Data = {
 10,
 Dict011TagHashTable,
 Dict011KeyHashTable,
-Dict011Contents
+Dict011Contents,
+NULL,
+NULL
 };
 
 // ----- Siemens Ultrasound Miscellaneous -----
@@ -912,7 +934,9 @@ vtkDICOMDictionary::Dict Dict012Data = {
 1,
 Dict012TagHashTable,
 Dict012KeyHashTable,
-Dict012Contents
+Dict012Contents,
+NULL,
+NULL
 };
 
 // ----- SPI -----
@@ -947,7 +971,9 @@ vtkDICOMDictionary::Dict Dict013Data = {
 8,
 Dict013TagHashTable,
 Dict013KeyHashTable,
-Dict013Contents
+Dict013Contents,
+NULL,
+NULL
 };
 
 // ----- GE ??? From Adantage Review CS -----
@@ -979,7 +1005,9 @@ vtkDICOMDictionary::Dict Dict014Data = {
 6,
 Dict014TagHashTable,
 Dict014KeyHashTable,
-Dict014Contents
+Dict014Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SMS-AX  QUANT 1.0 -----
@@ -1016,7 +1044,9 @@ vtkDICOMDictionary::Dict Dict015Data = {
 9,
 Dict015TagHashTable,
 Dict015KeyHashTable,
-Dict015Contents
+Dict015Contents,
+NULL,
+NULL
 };
 
 // ----- AgilityRuntime -----
@@ -1051,7 +1081,9 @@ vtkDICOMDictionary::Dict Dict016Data = {
 8,
 Dict016TagHashTable,
 Dict016KeyHashTable,
-Dict016Contents
+Dict016Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS RA GEN -----
@@ -1218,7 +1250,9 @@ vtkDICOMDictionary::Dict Dict017Data = {
 87,
 Dict017TagHashTable,
 Dict017KeyHashTable,
-Dict017Contents
+Dict017Contents,
+NULL,
+NULL
 };
 
 // ----- Mayo/IBM Archive Project -----
@@ -1278,7 +1312,9 @@ vtkDICOMDictionary::Dict Dict018Data = {
 23,
 Dict018TagHashTable,
 Dict018KeyHashTable,
-Dict018Contents
+Dict018Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SIENET -----
@@ -1301,7 +1337,9 @@ vtkDICOMDictionary::Dict Dict019Data = {
 1,
 Dict019TagHashTable,
 Dict019KeyHashTable,
-Dict019Contents
+Dict019Contents,
+NULL,
+NULL
 };
 
 // ----- MDS NORDION OTP ANATOMY MODELLING -----
@@ -1339,7 +1377,9 @@ vtkDICOMDictionary::Dict Dict020Data = {
 10,
 Dict020TagHashTable,
 Dict020KeyHashTable,
-Dict020Contents
+Dict020Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS CT APPL DATASET -----
@@ -1450,7 +1490,9 @@ vtkDICOMDictionary::Dict Dict021Data = {
 52,
 Dict021TagHashTable,
 Dict021KeyHashTable,
-Dict021Contents
+Dict021Contents,
+NULL,
+NULL
 };
 
 // ----- DCMTK_ANONYMIZER -----
@@ -1482,7 +1524,9 @@ vtkDICOMDictionary::Dict Dict022Data = {
 6,
 Dict022TagHashTable,
 Dict022KeyHashTable,
-Dict022Contents
+Dict022Contents,
+NULL,
+NULL
 };
 
 // ----- CMR42 CIRCLECVI -----
@@ -1509,7 +1553,9 @@ vtkDICOMDictionary::Dict Dict023Data = {
 3,
 Dict023TagHashTable,
 Dict023KeyHashTable,
-Dict023Contents
+Dict023Contents,
+NULL,
+NULL
 };
 
 // ----- syngoDynamics -----
@@ -1536,7 +1582,9 @@ vtkDICOMDictionary::Dict Dict024Data = {
 3,
 Dict024TagHashTable,
 Dict024KeyHashTable,
-Dict024Contents
+Dict024Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SYNGO ULTRA-SOUND TOYON DATA STREAMING -----
@@ -1564,7 +1612,9 @@ vtkDICOMDictionary::Dict Dict025Data = {
 4,
 Dict025TagHashTable,
 Dict025KeyHashTable,
-Dict025Contents
+Dict025Contents,
+NULL,
+NULL
 };
 
 // ----- Hipaa Private Creator -----
@@ -1659,7 +1709,9 @@ vtkDICOMDictionary::Dict Dict026Data = {
 42,
 Dict026TagHashTable,
 Dict026KeyHashTable,
-Dict026Contents
+Dict026Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_GNHD_01 -----
@@ -1683,7 +1735,9 @@ vtkDICOMDictionary::Dict Dict027Data = {
 2,
 Dict027TagHashTable,
 Dict027KeyHashTable,
-Dict027Contents
+Dict027Contents,
+NULL,
+NULL
 };
 
 // ----- PAPYRUS 3.0 -----
@@ -1729,7 +1783,9 @@ vtkDICOMDictionary::Dict Dict028Data = {
 14,
 Dict028TagHashTable,
 Dict028KeyHashTable,
-Dict028Contents
+Dict028Contents,
+NULL,
+NULL
 };
 
 // ----- Philips MR Imaging DD 003 -----
@@ -1752,7 +1808,9 @@ vtkDICOMDictionary::Dict Dict029Data = {
 1,
 Dict029TagHashTable,
 Dict029KeyHashTable,
-Dict029Contents
+Dict029Contents,
+NULL,
+NULL
 };
 
 // ----- ACUSON -----
@@ -1810,7 +1868,9 @@ vtkDICOMDictionary::Dict Dict030Data = {
 22,
 Dict030TagHashTable,
 Dict030KeyHashTable,
-Dict030Contents
+Dict030Contents,
+NULL,
+NULL
 };
 
 // ----- Philips MR Imaging DD 001 -----
@@ -2119,7 +2179,9 @@ vtkDICOMDictionary::Dict Dict031Data = {
 166,
 Dict031TagHashTable,
 Dict031KeyHashTable,
-Dict031Contents
+Dict031Contents,
+NULL,
+NULL
 };
 
 // ----- Philips MR Imaging DD 005 -----
@@ -2304,7 +2366,9 @@ vtkDICOMDictionary::Dict Dict032Data = {
 93,
 Dict032TagHashTable,
 Dict032KeyHashTable,
-Dict032Contents
+Dict032Contents,
+NULL,
+NULL
 };
 
 // ----- Philips MR Imaging DD 004 -----
@@ -2488,7 +2552,9 @@ vtkDICOMDictionary::Dict Dict033Data = {
 93,
 Dict033TagHashTable,
 Dict033KeyHashTable,
-Dict033Contents
+Dict033Contents,
+NULL,
+NULL
 };
 
 // ----- dcm4che/archive -----
@@ -2525,7 +2591,9 @@ vtkDICOMDictionary::Dict Dict034Data = {
 9,
 Dict034TagHashTable,
 Dict034KeyHashTable,
-Dict034Contents
+Dict034Contents,
+NULL,
+NULL
 };
 
 // ----- AMI Annotations_02 -----
@@ -2548,7 +2616,9 @@ vtkDICOMDictionary::Dict Dict035Data = {
 1,
 Dict035TagHashTable,
 Dict035KeyHashTable,
-Dict035Contents
+Dict035Contents,
+NULL,
+NULL
 };
 
 // ----- TERARECON AQUARIUS -----
@@ -2604,7 +2674,9 @@ vtkDICOMDictionary::Dict Dict036Data = {
 20,
 Dict036TagHashTable,
 Dict036KeyHashTable,
-Dict036Contents
+Dict036Contents,
+NULL,
+NULL
 };
 
 // ----- TOSHIBA COMAPL OOG -----
@@ -2631,7 +2703,9 @@ vtkDICOMDictionary::Dict Dict037Data = {
 3,
 Dict037TagHashTable,
 Dict037KeyHashTable,
-Dict037Contents
+Dict037Contents,
+NULL,
+NULL
 };
 
 // ----- SYNARC_1.0 -----
@@ -2660,7 +2734,9 @@ vtkDICOMDictionary::Dict Dict038Data = {
 5,
 Dict038TagHashTable,
 Dict038KeyHashTable,
-Dict038Contents
+Dict038Contents,
+NULL,
+NULL
 };
 
 // ----- LORAD Selenia -----
@@ -2726,7 +2802,9 @@ vtkDICOMDictionary::Dict Dict039Data = {
 26,
 Dict039TagHashTable,
 Dict039KeyHashTable,
-Dict039Contents
+Dict039Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SYNGO LAYOUT PROTOCOL -----
@@ -2931,7 +3009,9 @@ vtkDICOMDictionary::Dict Dict040Data = {
 106,
 Dict040TagHashTable,
 Dict040KeyHashTable,
-Dict040Contents
+Dict040Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MR VA0  RAW -----
@@ -3005,7 +3085,9 @@ vtkDICOMDictionary::Dict Dict041Data = {
 30,
 Dict041TagHashTable,
 Dict041KeyHashTable,
-Dict041Contents
+Dict041Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS CM VA0  LAB -----
@@ -3041,7 +3123,9 @@ vtkDICOMDictionary::Dict Dict042Data = {
 8,
 Dict042TagHashTable,
 Dict042KeyHashTable,
-Dict042Contents
+Dict042Contents,
+NULL,
+NULL
 };
 
 // ----- CoActiv_PvtTags -----
@@ -3069,7 +3153,9 @@ vtkDICOMDictionary::Dict Dict043Data = {
 4,
 Dict043TagHashTable,
 Dict043KeyHashTable,
-Dict043Contents
+Dict043Contents,
+NULL,
+NULL
 };
 
 // ----- MDDX -----
@@ -3101,7 +3187,9 @@ vtkDICOMDictionary::Dict Dict044Data = {
 6,
 Dict044TagHashTable,
 Dict044KeyHashTable,
-Dict044Contents
+Dict044Contents,
+NULL,
+NULL
 };
 
 // ----- http://www.gemedicalsystems.com/it_solutions/orthoview/2.1 -----
@@ -3133,7 +3221,9 @@ vtkDICOMDictionary::Dict Dict045Data = {
 6,
 Dict045TagHashTable,
 Dict045KeyHashTable,
-Dict045Contents
+Dict045Contents,
+NULL,
+NULL
 };
 
 // ----- PHILIPS NM -Private -----
@@ -3183,7 +3273,9 @@ vtkDICOMDictionary::Dict Dict046Data = {
 17,
 Dict046TagHashTable,
 Dict046KeyHashTable,
-Dict046Contents
+Dict046Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS WH SR 1.0 -----
@@ -3207,7 +3299,9 @@ vtkDICOMDictionary::Dict Dict047Data = {
 2,
 Dict047TagHashTable,
 Dict047KeyHashTable,
-Dict047Contents
+Dict047Contents,
+NULL,
+NULL
 };
 
 // ----- PMOD_1 -----
@@ -3236,7 +3330,9 @@ vtkDICOMDictionary::Dict Dict048Data = {
 5,
 Dict048TagHashTable,
 Dict048KeyHashTable,
-Dict048Contents
+Dict048Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MED MG -----
@@ -3271,7 +3367,9 @@ vtkDICOMDictionary::Dict Dict049Data = {
 8,
 Dict049TagHashTable,
 Dict049KeyHashTable,
-Dict049Contents
+Dict049Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_CTHD_01 -----
@@ -3294,7 +3392,9 @@ vtkDICOMDictionary::Dict Dict050Data = {
 1,
 Dict050TagHashTable,
 Dict050KeyHashTable,
-Dict050Contents
+Dict050Contents,
+NULL,
+NULL
 };
 
 // ----- astm.org/diconde/iod/Component -----
@@ -3341,7 +3441,9 @@ vtkDICOMDictionary::Dict Dict051Data = {
 15,
 Dict051TagHashTable,
 Dict051KeyHashTable,
-Dict051Contents
+Dict051Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_IDI_01 -----
@@ -3374,7 +3476,9 @@ vtkDICOMDictionary::Dict Dict052Data = {
 7,
 Dict052TagHashTable,
 Dict052KeyHashTable,
-Dict052Contents
+Dict052Contents,
+NULL,
+NULL
 };
 
 // ----- PMOD_GENPET -----
@@ -3401,7 +3505,9 @@ vtkDICOMDictionary::Dict Dict053Data = {
 3,
 Dict053TagHashTable,
 Dict053KeyHashTable,
-Dict053Contents
+Dict053Contents,
+NULL,
+NULL
 };
 
 // ----- SHS MagicView 300 -----
@@ -3425,7 +3531,9 @@ vtkDICOMDictionary::Dict Dict054Data = {
 2,
 Dict054TagHashTable,
 Dict054KeyHashTable,
-Dict054Contents
+Dict054Contents,
+NULL,
+NULL
 };
 
 // ----- INTELERAD MEDICAL SYSTEMS INTELEVIEWER -----
@@ -3460,7 +3568,9 @@ vtkDICOMDictionary::Dict Dict055Data = {
 8,
 Dict055TagHashTable,
 Dict055KeyHashTable,
-Dict055Contents
+Dict055Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS IKM CKS CXRCAD FINDINGS -----
@@ -3483,7 +3593,9 @@ vtkDICOMDictionary::Dict Dict056Data = {
 1,
 Dict056TagHashTable,
 Dict056KeyHashTable,
-Dict056Contents
+Dict056Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS NUMARIS II -----
@@ -3510,7 +3622,9 @@ vtkDICOMDictionary::Dict Dict057Data = {
 3,
 Dict057TagHashTable,
 Dict057KeyHashTable,
-Dict057Contents
+Dict057Contents,
+NULL,
+NULL
 };
 
 // ----- REPORT_FROM_APP -----
@@ -3533,7 +3647,9 @@ vtkDICOMDictionary::Dict Dict058Data = {
 1,
 Dict058TagHashTable,
 Dict058KeyHashTable,
-Dict058Contents
+Dict058Contents,
+NULL,
+NULL
 };
 
 // ----- KINETDX -----
@@ -3566,7 +3682,9 @@ vtkDICOMDictionary::Dict Dict059Data = {
 7,
 Dict059TagHashTable,
 Dict059KeyHashTable,
-Dict059Contents
+Dict059Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SYNGO WORKFLOW -----
@@ -3650,7 +3768,9 @@ vtkDICOMDictionary::Dict Dict060Data = {
 36,
 Dict060TagHashTable,
 Dict060KeyHashTable,
-Dict060Contents
+Dict060Contents,
+NULL,
+NULL
 };
 
 // ----- INTELERAD MEDICAL SYSTEMS -----
@@ -3720,7 +3840,9 @@ vtkDICOMDictionary::Dict Dict061Data = {
 28,
 Dict061TagHashTable,
 Dict061KeyHashTable,
-Dict061Contents
+Dict061Contents,
+NULL,
+NULL
 };
 
 // ----- DVMInsight Receiver Tracking -----
@@ -3756,7 +3878,9 @@ vtkDICOMDictionary::Dict Dict062Data = {
 9,
 Dict062TagHashTable,
 Dict062KeyHashTable,
-Dict062Contents
+Dict062Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SYNGO FUNCTION ASSIGNMENT -----
@@ -3779,7 +3903,9 @@ vtkDICOMDictionary::Dict Dict063Data = {
 1,
 Dict063TagHashTable,
 Dict063KeyHashTable,
-Dict063Contents
+Dict063Contents,
+NULL,
+NULL
 };
 
 // ----- FFP DATA -----
@@ -3802,7 +3928,9 @@ vtkDICOMDictionary::Dict Dict064Data = {
 1,
 Dict064TagHashTable,
 Dict064KeyHashTable,
-Dict064Contents
+Dict064Contents,
+NULL,
+NULL
 };
 
 // ----- astm.org/diconde/iod/ComponentStudy -----
@@ -3825,7 +3953,9 @@ vtkDICOMDictionary::Dict Dict065Data = {
 1,
 Dict065TagHashTable,
 Dict065KeyHashTable,
-Dict065Contents
+Dict065Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SYNGO INDEX SERVICE -----
@@ -3872,7 +4002,9 @@ vtkDICOMDictionary::Dict Dict066Data = {
 15,
 Dict066TagHashTable,
 Dict066KeyHashTable,
-Dict066Contents
+Dict066Contents,
+NULL,
+NULL
 };
 
 // ----- http://www.gemedicalsystems.com/it_solutions/rad_pacs/ -----
@@ -3899,7 +4031,9 @@ vtkDICOMDictionary::Dict Dict067Data = {
 3,
 Dict067TagHashTable,
 Dict067KeyHashTable,
-Dict067Contents
+Dict067Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS CT APPL TMP DATAMODEL -----
@@ -3922,7 +4056,9 @@ vtkDICOMDictionary::Dict Dict068Data = {
 1,
 Dict068TagHashTable,
 Dict068KeyHashTable,
-Dict068Contents
+Dict068Contents,
+NULL,
+NULL
 };
 
 // ----- CTP -----
@@ -3950,7 +4086,9 @@ vtkDICOMDictionary::Dict Dict069Data = {
 4,
 Dict069TagHashTable,
 Dict069KeyHashTable,
-Dict069Contents
+Dict069Contents,
+NULL,
+NULL
 };
 
 // ----- PixelMed Publishing -----
@@ -4009,7 +4147,9 @@ vtkDICOMDictionary::Dict Dict070Data = {
 22,
 Dict070TagHashTable,
 Dict070KeyHashTable,
-Dict070Contents
+Dict070Contents,
+NULL,
+NULL
 };
 
 // ----- POLYTRON-SMS 2.5 -----
@@ -4037,7 +4177,9 @@ vtkDICOMDictionary::Dict Dict071Data = {
 4,
 Dict071TagHashTable,
 Dict071KeyHashTable,
-Dict071Contents
+Dict071Contents,
+NULL,
+NULL
 };
 
 // ----- Philips Imaging DD 129 -----
@@ -4060,7 +4202,9 @@ vtkDICOMDictionary::Dict Dict072Data = {
 1,
 Dict072TagHashTable,
 Dict072KeyHashTable,
-Dict072Contents
+Dict072Contents,
+NULL,
+NULL
 };
 
 // ----- Philips Imaging DD 124 -----
@@ -4083,7 +4227,9 @@ vtkDICOMDictionary::Dict Dict073Data = {
 1,
 Dict073TagHashTable,
 Dict073KeyHashTable,
-Dict073Contents
+Dict073Contents,
+NULL,
+NULL
 };
 
 // ----- PMS-THORA-5.1 -----
@@ -4106,7 +4252,9 @@ vtkDICOMDictionary::Dict Dict074Data = {
 1,
 Dict074TagHashTable,
 Dict074KeyHashTable,
-Dict074Contents
+Dict074Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MED SMS USG S2000 -----
@@ -4216,7 +4364,9 @@ vtkDICOMDictionary::Dict Dict075Data = {
 51,
 Dict075TagHashTable,
 Dict075KeyHashTable,
-Dict075Contents
+Dict075Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MED OCS SS VERSION INFO -----
@@ -4239,7 +4389,9 @@ vtkDICOMDictionary::Dict Dict076Data = {
 1,
 Dict076TagHashTable,
 Dict076KeyHashTable,
-Dict076Contents
+Dict076Contents,
+NULL,
+NULL
 };
 
 // ----- ELSCINT1 -----
@@ -4664,7 +4816,9 @@ vtkDICOMDictionary::Dict Dict077Data = {
 241,
 Dict077TagHashTable,
 Dict077KeyHashTable,
-Dict077Contents
+Dict077Contents,
+NULL,
+NULL
 };
 
 // ----- Brainlab-S9-History -----
@@ -4691,7 +4845,9 @@ vtkDICOMDictionary::Dict Dict078Data = {
 3,
 Dict078TagHashTable,
 Dict078KeyHashTable,
-Dict078Contents
+Dict078Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS IMAGE SHADOW ATTRIBUTES -----
@@ -4799,7 +4955,9 @@ vtkDICOMDictionary::Dict Dict079Data = {
 52,
 Dict079TagHashTable,
 Dict079KeyHashTable,
-Dict079Contents
+Dict079Contents,
+NULL,
+NULL
 };
 
 // ----- Harmony R1.0 -----
@@ -5014,7 +5172,9 @@ vtkDICOMDictionary::Dict Dict080Data = {
 115,
 Dict080TagHashTable,
 Dict080KeyHashTable,
-Dict080Contents
+Dict080Contents,
+NULL,
+NULL
 };
 
 // ----- FDMS 1.0 -----
@@ -5222,7 +5382,9 @@ vtkDICOMDictionary::Dict Dict081Data = {
 110,
 Dict081TagHashTable,
 Dict081KeyHashTable,
-Dict081Contents
+Dict081Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SYNGO SOP CLASS PACKING -----
@@ -5276,7 +5438,9 @@ vtkDICOMDictionary::Dict Dict082Data = {
 19,
 Dict082TagHashTable,
 Dict082KeyHashTable,
-Dict082Contents
+Dict082Contents,
+NULL,
+NULL
 };
 
 // ----- Sound Technologies -----
@@ -5352,7 +5516,9 @@ vtkDICOMDictionary::Dict Dict083Data = {
 31,
 Dict083TagHashTable,
 Dict083KeyHashTable,
-Dict083Contents
+Dict083Contents,
+NULL,
+NULL
 };
 
 // ----- PHILIPS XCT -Private -----
@@ -5376,7 +5542,9 @@ vtkDICOMDictionary::Dict Dict084Data = {
 2,
 Dict084TagHashTable,
 Dict084KeyHashTable,
-Dict084Contents
+Dict084Contents,
+NULL,
+NULL
 };
 
 // ----- Siemens: Thorax/Multix FD Image Stamp -----
@@ -5405,7 +5573,9 @@ vtkDICOMDictionary::Dict Dict085Data = {
 5,
 Dict085TagHashTable,
 Dict085KeyHashTable,
-Dict085Contents
+Dict085Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_PARM_01 -----
@@ -5689,7 +5859,9 @@ vtkDICOMDictionary::Dict Dict086Data = {
 152,
 Dict086TagHashTable,
 Dict086KeyHashTable,
-Dict086Contents
+Dict086Contents,
+NULL,
+NULL
 };
 
 // ----- MedIns HP Extensions -----
@@ -5712,7 +5884,9 @@ vtkDICOMDictionary::Dict Dict087Data = {
 1,
 Dict087TagHashTable,
 Dict087KeyHashTable,
-Dict087Contents
+Dict087Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS CM VA0  ACQU -----
@@ -5741,7 +5915,9 @@ vtkDICOMDictionary::Dict Dict088Data = {
 5,
 Dict088TagHashTable,
 Dict088KeyHashTable,
-Dict088Contents
+Dict088Contents,
+NULL,
+NULL
 };
 
 // ----- PHILIPS MR/LAST -----
@@ -5854,7 +6030,9 @@ vtkDICOMDictionary::Dict Dict089Data = {
 54,
 Dict089TagHashTable,
 Dict089KeyHashTable,
-Dict089Contents
+Dict089Contents,
+NULL,
+NULL
 };
 
 // ----- AEGIS_DICOM_2.00 -----
@@ -5885,7 +6063,9 @@ vtkDICOMDictionary::Dict Dict090Data = {
 6,
 Dict090TagHashTable,
 Dict090KeyHashTable,
-Dict090Contents
+Dict090Contents,
+NULL,
+NULL
 };
 
 // ----- MeVis eD: Absolute Temporal Positions -----
@@ -5914,7 +6094,9 @@ vtkDICOMDictionary::Dict Dict091Data = {
 5,
 Dict091TagHashTable,
 Dict091KeyHashTable,
-Dict091Contents
+Dict091Contents,
+NULL,
+NULL
 };
 
 // ----- NQLeft -----
@@ -6037,7 +6219,9 @@ vtkDICOMDictionary::Dict Dict092Data = {
 58,
 Dict092TagHashTable,
 Dict092KeyHashTable,
-Dict092Contents
+Dict092Contents,
+NULL,
+NULL
 };
 
 // ----- iCAD PK Study -----
@@ -6105,7 +6289,9 @@ vtkDICOMDictionary::Dict Dict093Data = {
 28,
 Dict093TagHashTable,
 Dict093KeyHashTable,
-Dict093Contents
+Dict093Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P-Private_ICS Release 1;3 -----
@@ -6129,7 +6315,9 @@ vtkDICOMDictionary::Dict Dict094Data = {
 2,
 Dict094TagHashTable,
 Dict094KeyHashTable,
-Dict094Contents
+Dict094Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P-Private_ICS Release 1;2 -----
@@ -6174,7 +6362,9 @@ vtkDICOMDictionary::Dict Dict095Data = {
 14,
 Dict095TagHashTable,
 Dict095KeyHashTable,
-Dict095Contents
+Dict095Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P-Private_ICS Release 1;1 -----
@@ -6224,7 +6414,9 @@ vtkDICOMDictionary::Dict Dict096Data = {
 17,
 Dict096TagHashTable,
 Dict096KeyHashTable,
-Dict096Contents
+Dict096Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS CT VA0  GEN -----
@@ -6329,7 +6521,9 @@ vtkDICOMDictionary::Dict Dict097Data = {
 49,
 Dict097TagHashTable,
 Dict097KeyHashTable,
-Dict097Contents
+Dict097Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P-Private_ICS Release 1;5 -----
@@ -6353,7 +6547,9 @@ vtkDICOMDictionary::Dict Dict098Data = {
 2,
 Dict098TagHashTable,
 Dict098KeyHashTable,
-Dict098Contents
+Dict098Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P-Private_ICS Release 1;4 -----
@@ -6388,7 +6584,9 @@ vtkDICOMDictionary::Dict Dict099Data = {
 8,
 Dict099TagHashTable,
 Dict099KeyHashTable,
-Dict099Contents
+Dict099Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P-GV-CT Release 1 -----
@@ -6501,7 +6699,9 @@ vtkDICOMDictionary::Dict Dict100Data = {
 56,
 Dict100TagHashTable,
 Dict100KeyHashTable,
-Dict100Contents
+Dict100Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_ADWSoft_DPO1 -----
@@ -6524,7 +6724,9 @@ vtkDICOMDictionary::Dict Dict101Data = {
 1,
 Dict101TagHashTable,
 Dict101KeyHashTable,
-Dict101Contents
+Dict101Contents,
+NULL,
+NULL
 };
 
 // ----- PHILIPS MR R5.5/PART -----
@@ -6547,7 +6749,9 @@ vtkDICOMDictionary::Dict Dict102Data = {
 1,
 Dict102TagHashTable,
 Dict102KeyHashTable,
-Dict102Contents
+Dict102Contents,
+NULL,
+NULL
 };
 
 // ----- iCAD PK -----
@@ -6677,7 +6881,9 @@ vtkDICOMDictionary::Dict Dict103Data = {
 65,
 Dict103TagHashTable,
 Dict103KeyHashTable,
-Dict103Contents
+Dict103Contents,
+NULL,
+NULL
 };
 
 // ----- AGFA_ADC_Compact -----
@@ -6719,7 +6925,9 @@ vtkDICOMDictionary::Dict Dict104Data = {
 12,
 Dict104TagHashTable,
 Dict104KeyHashTable,
-Dict104Contents
+Dict104Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SMS-AX  ACQ 1.0 -----
@@ -6899,7 +7107,9 @@ vtkDICOMDictionary::Dict Dict105Data = {
 91,
 Dict105TagHashTable,
 Dict105KeyHashTable,
-Dict105Contents
+Dict105Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P-CTBE-Private Release 1 -----
@@ -6922,7 +7132,9 @@ vtkDICOMDictionary::Dict Dict106Data = {
 1,
 Dict106TagHashTable,
 Dict106KeyHashTable,
-Dict106Contents
+Dict106Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SYNGO VOLUME -----
@@ -6963,7 +7175,9 @@ vtkDICOMDictionary::Dict Dict107Data = {
 11,
 Dict107TagHashTable,
 Dict107KeyHashTable,
-Dict107Contents
+Dict107Contents,
+NULL,
+NULL
 };
 
 // ----- Applicare/RadWorks/Version 6.0 -----
@@ -7015,7 +7229,9 @@ vtkDICOMDictionary::Dict Dict108Data = {
 18,
 Dict108TagHashTable,
 Dict108KeyHashTable,
-Dict108Contents
+Dict108Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MED SP DXMG WH AWS 1 -----
@@ -7066,7 +7282,9 @@ vtkDICOMDictionary::Dict Dict109Data = {
 17,
 Dict109TagHashTable,
 Dict109KeyHashTable,
-Dict109Contents
+Dict109Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MR PS 04 -----
@@ -7089,7 +7307,9 @@ vtkDICOMDictionary::Dict Dict110Data = {
 1,
 Dict110TagHashTable,
 Dict110KeyHashTable,
-Dict110Contents
+Dict110Contents,
+NULL,
+NULL
 };
 
 // ----- UCSF BIRP PRIVATE CREATOR 011710xx -----
@@ -7155,7 +7375,9 @@ vtkDICOMDictionary::Dict Dict111Data = {
 27,
 Dict111TagHashTable,
 Dict111KeyHashTable,
-Dict111Contents
+Dict111Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_Ultrasound_MovieGroup_001 -----
@@ -7248,7 +7470,9 @@ vtkDICOMDictionary::Dict Dict112Data = {
 43,
 Dict112TagHashTable,
 Dict112KeyHashTable,
-Dict112Contents
+Dict112Contents,
+NULL,
+NULL
 };
 
 // ----- CARESTREAM IMAGE INFORMATION -----
@@ -7281,7 +7505,9 @@ vtkDICOMDictionary::Dict Dict113Data = {
 7,
 Dict113TagHashTable,
 Dict113KeyHashTable,
-Dict113Contents
+Dict113Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_DL_STUDY_01 -----
@@ -7345,7 +7571,9 @@ vtkDICOMDictionary::Dict Dict114Data = {
 25,
 Dict114TagHashTable,
 Dict114KeyHashTable,
-Dict114Contents
+Dict114Contents,
+NULL,
+NULL
 };
 
 // ----- Silhouette VRS 3.0 -----
@@ -7395,7 +7623,9 @@ vtkDICOMDictionary::Dict Dict115Data = {
 17,
 Dict115TagHashTable,
 Dict115KeyHashTable,
-Dict115Contents
+Dict115Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_HELIOS_01 -----
@@ -7482,7 +7712,9 @@ vtkDICOMDictionary::Dict Dict116Data = {
 38,
 Dict116TagHashTable,
 Dict116KeyHashTable,
-Dict116Contents
+Dict116Contents,
+NULL,
+NULL
 };
 
 // ----- Kodak Image Information -----
@@ -7513,7 +7745,9 @@ vtkDICOMDictionary::Dict Dict117Data = {
 6,
 Dict117TagHashTable,
 Dict117KeyHashTable,
-Dict117Contents
+Dict117Contents,
+NULL,
+NULL
 };
 
 // ----- QUASAR_INTERNAL_USE -----
@@ -7605,7 +7839,9 @@ vtkDICOMDictionary::Dict Dict118Data = {
 42,
 Dict118TagHashTable,
 Dict118KeyHashTable,
-Dict118Contents
+Dict118Contents,
+NULL,
+NULL
 };
 
 // ----- VEPRO BROKER 1.0 -----
@@ -7628,7 +7864,9 @@ vtkDICOMDictionary::Dict Dict119Data = {
 1,
 Dict119TagHashTable,
 Dict119KeyHashTable,
-Dict119Contents
+Dict119Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS CT VA0  COAD -----
@@ -7733,7 +7971,9 @@ vtkDICOMDictionary::Dict Dict120Data = {
 49,
 Dict120TagHashTable,
 Dict120KeyHashTable,
-Dict120Contents
+Dict120Contents,
+NULL,
+NULL
 };
 
 // ----- PHILIPS MR -----
@@ -7757,7 +7997,9 @@ vtkDICOMDictionary::Dict Dict121Data = {
 2,
 Dict121TagHashTable,
 Dict121KeyHashTable,
-Dict121Contents
+Dict121Contents,
+NULL,
+NULL
 };
 
 // ----- MeVis BreastCare -----
@@ -7781,7 +8023,9 @@ vtkDICOMDictionary::Dict Dict122Data = {
 2,
 Dict122TagHashTable,
 Dict122KeyHashTable,
-Dict122Contents
+Dict122Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_MR_RAW_01 -----
@@ -7822,7 +8066,9 @@ vtkDICOMDictionary::Dict Dict123Data = {
 11,
 Dict123TagHashTable,
 Dict123KeyHashTable,
-Dict123Contents
+Dict123Contents,
+NULL,
+NULL
 };
 
 // ----- VEPRO VIF 3.0 DATA -----
@@ -7849,7 +8095,9 @@ vtkDICOMDictionary::Dict Dict124Data = {
 3,
 Dict124TagHashTable,
 Dict124KeyHashTable,
-Dict124Contents
+Dict124Contents,
+NULL,
+NULL
 };
 
 // ----- MeVis eatDicom -----
@@ -7873,7 +8121,9 @@ vtkDICOMDictionary::Dict Dict125Data = {
 2,
 Dict125TagHashTable,
 Dict125KeyHashTable,
-Dict125Contents
+Dict125Contents,
+NULL,
+NULL
 };
 
 // ----- DIGISCAN IMAGE -----
@@ -7901,7 +8151,9 @@ vtkDICOMDictionary::Dict Dict126Data = {
 4,
 Dict126TagHashTable,
 Dict126KeyHashTable,
-Dict126Contents
+Dict126Contents,
+NULL,
+NULL
 };
 
 // ----- MITRA OBJECT UTF8 ATTRIBUTES 1.0 -----
@@ -7942,7 +8194,9 @@ vtkDICOMDictionary::Dict Dict127Data = {
 12,
 Dict127TagHashTable,
 Dict127KeyHashTable,
-Dict127Contents
+Dict127Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_Ultrasound_ExamGroup_001 -----
@@ -7966,7 +8220,9 @@ vtkDICOMDictionary::Dict Dict128Data = {
 2,
 Dict128TagHashTable,
 Dict128KeyHashTable,
-Dict128Contents
+Dict128Contents,
+NULL,
+NULL
 };
 
 // ----- VEPRO BROKER 1.0 DATA REPLACE -----
@@ -7999,7 +8255,9 @@ vtkDICOMDictionary::Dict Dict129Data = {
 7,
 Dict129TagHashTable,
 Dict129KeyHashTable,
-Dict129Contents
+Dict129Contents,
+NULL,
+NULL
 };
 
 // ----- PHILIPS-MR-1 -----
@@ -8027,7 +8285,9 @@ vtkDICOMDictionary::Dict Dict130Data = {
 4,
 Dict130TagHashTable,
 Dict130KeyHashTable,
-Dict130Contents
+Dict130Contents,
+NULL,
+NULL
 };
 
 // ----- MERGE TECHNOLOGIES, INC. -----
@@ -8050,7 +8310,9 @@ vtkDICOMDictionary::Dict Dict131Data = {
 1,
 Dict131TagHashTable,
 Dict131KeyHashTable,
-Dict131Contents
+Dict131Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS DLR.01 -----
@@ -8147,7 +8409,9 @@ vtkDICOMDictionary::Dict Dict132Data = {
 44,
 Dict132TagHashTable,
 Dict132KeyHashTable,
-Dict132Contents
+Dict132Contents,
+NULL,
+NULL
 };
 
 // ----- Agfa ADC NX -----
@@ -8197,7 +8461,9 @@ vtkDICOMDictionary::Dict Dict133Data = {
 17,
 Dict133TagHashTable,
 Dict133KeyHashTable,
-Dict133Contents
+Dict133Contents,
+NULL,
+NULL
 };
 
 // ----- Imaging Dynamics Company Ltd. -----
@@ -8221,7 +8487,9 @@ vtkDICOMDictionary::Dict Dict134Data = {
 2,
 Dict134TagHashTable,
 Dict134KeyHashTable,
-Dict134Contents
+Dict134Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS DFR.01 ORIGINAL -----
@@ -8314,7 +8582,9 @@ vtkDICOMDictionary::Dict Dict135Data = {
 43,
 Dict135TagHashTable,
 Dict135KeyHashTable,
-Dict135Contents
+Dict135Contents,
+NULL,
+NULL
 };
 
 // ----- NQHeader -----
@@ -8349,7 +8619,9 @@ vtkDICOMDictionary::Dict Dict136Data = {
 8,
 Dict136TagHashTable,
 Dict136KeyHashTable,
-Dict136Contents
+Dict136Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS CT APPL PRESENTATION -----
@@ -8389,7 +8661,9 @@ vtkDICOMDictionary::Dict Dict137Data = {
 11,
 Dict137TagHashTable,
 Dict137KeyHashTable,
-Dict137Contents
+Dict137Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SYNGO PRINT SERVICE -----
@@ -8412,7 +8686,9 @@ vtkDICOMDictionary::Dict Dict138Data = {
 1,
 Dict138TagHashTable,
 Dict138KeyHashTable,
-Dict138Contents
+Dict138Contents,
+NULL,
+NULL
 };
 
 // ----- Siemens: Thorax/Multix FD Raw Image Settings -----
@@ -8498,7 +8774,9 @@ vtkDICOMDictionary::Dict Dict139Data = {
 38,
 Dict139TagHashTable,
 Dict139KeyHashTable,
-Dict139Contents
+Dict139Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS CT VA0  ORI -----
@@ -8522,7 +8800,9 @@ vtkDICOMDictionary::Dict Dict140Data = {
 2,
 Dict140TagHashTable,
 Dict140KeyHashTable,
-Dict140Contents
+Dict140Contents,
+NULL,
+NULL
 };
 
 // ----- Philips X-ray Imaging DD 001 -----
@@ -8595,7 +8875,9 @@ vtkDICOMDictionary::Dict Dict141Data = {
 31,
 Dict141TagHashTable,
 Dict141KeyHashTable,
-Dict141Contents
+Dict141Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SMS-AX  VIEW 1.0 -----
@@ -8672,7 +8954,9 @@ vtkDICOMDictionary::Dict Dict142Data = {
 32,
 Dict142TagHashTable,
 Dict142KeyHashTable,
-Dict142Contents
+Dict142Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P-Private_CDS Release 1 -----
@@ -8699,7 +8983,9 @@ vtkDICOMDictionary::Dict Dict143Data = {
 3,
 Dict143TagHashTable,
 Dict143KeyHashTable,
-Dict143Contents
+Dict143Contents,
+NULL,
+NULL
 };
 
 // ----- astm.org/diconde/iod/NdeCtImage -----
@@ -8723,7 +9009,9 @@ vtkDICOMDictionary::Dict Dict144Data = {
 2,
 Dict144TagHashTable,
 Dict144KeyHashTable,
-Dict144Contents
+Dict144Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SYNGO TIME POINT SERVICE -----
@@ -8750,7 +9038,9 @@ vtkDICOMDictionary::Dict Dict145Data = {
 3,
 Dict145TagHashTable,
 Dict145KeyHashTable,
-Dict145Contents
+Dict145Contents,
+NULL,
+NULL
 };
 
 // ----- Silhouette Line V1.0 -----
@@ -8804,7 +9094,9 @@ vtkDICOMDictionary::Dict Dict146Data = {
 19,
 Dict146TagHashTable,
 Dict146KeyHashTable,
-Dict146Contents
+Dict146Contents,
+NULL,
+NULL
 };
 
 // ----- BrainLAB_BeamProfile -----
@@ -8836,7 +9128,9 @@ vtkDICOMDictionary::Dict Dict147Data = {
 6,
 Dict147TagHashTable,
 Dict147KeyHashTable,
-Dict147Contents
+Dict147Contents,
+NULL,
+NULL
 };
 
 // ----- astm.org/diconde/iod/NdeDxCalibrationData -----
@@ -8879,7 +9173,9 @@ vtkDICOMDictionary::Dict Dict148Data = {
 13,
 Dict148TagHashTable,
 Dict148KeyHashTable,
-Dict148Contents
+Dict148Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_XELPRV_01 -----
@@ -8935,7 +9231,9 @@ vtkDICOMDictionary::Dict Dict149Data = {
 21,
 Dict149TagHashTable,
 Dict149KeyHashTable,
-Dict149Contents
+Dict149Contents,
+NULL,
+NULL
 };
 
 // ----- AgilityOverlay -----
@@ -9024,7 +9322,9 @@ vtkDICOMDictionary::Dict Dict150Data = {
 40,
 Dict150TagHashTable,
 Dict150KeyHashTable,
-Dict150Contents
+Dict150Contents,
+NULL,
+NULL
 };
 
 // ----- VEPRO VIM 5.0 DATA -----
@@ -9053,7 +9353,9 @@ vtkDICOMDictionary::Dict Dict151Data = {
 5,
 Dict151TagHashTable,
 Dict151KeyHashTable,
-Dict151Contents
+Dict151Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS DICOM -----
@@ -9077,7 +9379,9 @@ vtkDICOMDictionary::Dict Dict152Data = {
 2,
 Dict152TagHashTable,
 Dict152KeyHashTable,
-Dict152Contents
+Dict152Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MED NM -----
@@ -9427,7 +9731,9 @@ vtkDICOMDictionary::Dict Dict153Data = {
 192,
 Dict153TagHashTable,
 Dict153KeyHashTable,
-Dict153Contents
+Dict153Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P-XSB-DCI Release 1 -----
@@ -9457,7 +9763,9 @@ vtkDICOMDictionary::Dict Dict154Data = {
 5,
 Dict154TagHashTable,
 Dict154KeyHashTable,
-Dict154Contents
+Dict154Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_AWSOFT_CD1 -----
@@ -9494,7 +9802,9 @@ vtkDICOMDictionary::Dict Dict155Data = {
 9,
 Dict155TagHashTable,
 Dict155KeyHashTable,
-Dict155Contents
+Dict155Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_SEND_02 -----
@@ -9528,7 +9838,9 @@ vtkDICOMDictionary::Dict Dict156Data = {
 8,
 Dict156TagHashTable,
 Dict156KeyHashTable,
-Dict156Contents
+Dict156Contents,
+NULL,
+NULL
 };
 
 // ----- PRIVATE_CODE_STRING_1003 -----
@@ -9594,7 +9906,9 @@ vtkDICOMDictionary::Dict Dict157Data = {
 26,
 Dict157TagHashTable,
 Dict157KeyHashTable,
-Dict157Contents
+Dict157Contents,
+NULL,
+NULL
 };
 
 // ----- Applicare/Workflow/Version 1.0 -----
@@ -9646,7 +9960,9 @@ vtkDICOMDictionary::Dict Dict158Data = {
 18,
 Dict158TagHashTable,
 Dict158KeyHashTable,
-Dict158Contents
+Dict158Contents,
+NULL,
+NULL
 };
 
 // ----- Nautilus Medical -----
@@ -9674,7 +9990,9 @@ vtkDICOMDictionary::Dict Dict159Data = {
 4,
 Dict159TagHashTable,
 Dict159KeyHashTable,
-Dict159Contents
+Dict159Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MR EXTRACTED CSA HEADER -----
@@ -9701,7 +10019,9 @@ vtkDICOMDictionary::Dict Dict160Data = {
 3,
 Dict160TagHashTable,
 Dict160KeyHashTable,
-Dict160Contents
+Dict160Contents,
+NULL,
+NULL
 };
 
 // ----- KRETZ_US -----
@@ -9724,7 +10044,9 @@ vtkDICOMDictionary::Dict Dict161Data = {
 1,
 Dict161TagHashTable,
 Dict161KeyHashTable,
-Dict161Contents
+Dict161Contents,
+NULL,
+NULL
 };
 
 // ----- GEIIS PACS -----
@@ -9761,7 +10083,9 @@ vtkDICOMDictionary::Dict Dict162Data = {
 9,
 Dict162TagHashTable,
 Dict162KeyHashTable,
-Dict162Contents
+Dict162Contents,
+NULL,
+NULL
 };
 
 // ----- PRIVATE_CODE_STRING_0021 -----
@@ -9794,7 +10118,9 @@ vtkDICOMDictionary::Dict Dict163Data = {
 7,
 Dict163TagHashTable,
 Dict163KeyHashTable,
-Dict163Contents
+Dict163Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS CT VA0  IDE -----
@@ -9830,7 +10156,9 @@ vtkDICOMDictionary::Dict Dict164Data = {
 9,
 Dict164TagHashTable,
 Dict164KeyHashTable,
-Dict164Contents
+Dict164Contents,
+NULL,
+NULL
 };
 
 // ----- SCHICK TECHNOLOGIES - Note List Creator ID -----
@@ -9854,7 +10182,9 @@ vtkDICOMDictionary::Dict Dict165Data = {
 2,
 Dict165TagHashTable,
 Dict165KeyHashTable,
-Dict165Contents
+Dict165Contents,
+NULL,
+NULL
 };
 
 // ----- Mortara_Inc -----
@@ -9892,7 +10222,9 @@ vtkDICOMDictionary::Dict Dict166Data = {
 10,
 Dict166TagHashTable,
 Dict166KeyHashTable,
-Dict166Contents
+Dict166Contents,
+NULL,
+NULL
 };
 
 // ----- SMIL_PB79 -----
@@ -9952,7 +10284,9 @@ vtkDICOMDictionary::Dict Dict167Data = {
 22,
 Dict167TagHashTable,
 Dict167KeyHashTable,
-Dict167Contents
+Dict167Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS IKM CKS LUNGCAD BMK -----
@@ -9975,7 +10309,9 @@ vtkDICOMDictionary::Dict Dict168Data = {
 1,
 Dict168TagHashTable,
 Dict168KeyHashTable,
-Dict168Contents
+Dict168Contents,
+NULL,
+NULL
 };
 
 // ----- APEX_PRIVATE -----
@@ -9998,7 +10334,9 @@ vtkDICOMDictionary::Dict Dict169Data = {
 1,
 Dict169TagHashTable,
 Dict169KeyHashTable,
-Dict169Contents
+Dict169Contents,
+NULL,
+NULL
 };
 
 // ----- PRIVATE_CODE_STRING_0019 -----
@@ -10027,7 +10365,9 @@ vtkDICOMDictionary::Dict Dict170Data = {
 5,
 Dict170TagHashTable,
 Dict170KeyHashTable,
-Dict170Contents
+Dict170Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_IMAG_01 -----
@@ -10111,7 +10451,9 @@ vtkDICOMDictionary::Dict Dict171Data = {
 36,
 Dict171TagHashTable,
 Dict171KeyHashTable,
-Dict171Contents
+Dict171Contents,
+NULL,
+NULL
 };
 
 // ----- Silhouette ROI V1.0 -----
@@ -10174,7 +10516,9 @@ vtkDICOMDictionary::Dict Dict172Data = {
 24,
 Dict172TagHashTable,
 Dict172KeyHashTable,
-Dict172Contents
+Dict172Contents,
+NULL,
+NULL
 };
 
 // ----- DZDICOM 4.3.0 -----
@@ -10237,7 +10581,9 @@ vtkDICOMDictionary::Dict Dict173Data = {
 25,
 Dict173TagHashTable,
 Dict173KeyHashTable,
-Dict173Contents
+Dict173Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SERIES SHADOW ATTRIBUTES -----
@@ -10337,7 +10683,9 @@ vtkDICOMDictionary::Dict Dict174Data = {
 47,
 Dict174TagHashTable,
 Dict174KeyHashTable,
-Dict174Contents
+Dict174Contents,
+NULL,
+NULL
 };
 
 // ----- DL_INTERNAL_USE -----
@@ -10360,7 +10708,9 @@ vtkDICOMDictionary::Dict Dict175Data = {
 1,
 Dict175TagHashTable,
 Dict175KeyHashTable,
-Dict175Contents
+Dict175Contents,
+NULL,
+NULL
 };
 
 // ----- HOLOGIC, Inc. -----
@@ -10476,7 +10826,9 @@ vtkDICOMDictionary::Dict Dict176Data = {
 55,
 Dict176TagHashTable,
 Dict176KeyHashTable,
-Dict176Contents
+Dict176Contents,
+NULL,
+NULL
 };
 
 // ----- AMI StudyExtensions_01 -----
@@ -10499,7 +10851,9 @@ vtkDICOMDictionary::Dict Dict177Data = {
 1,
 Dict177TagHashTable,
 Dict177KeyHashTable,
-Dict177Contents
+Dict177Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P-Private-DCI Release 1 -----
@@ -10534,7 +10888,9 @@ vtkDICOMDictionary::Dict Dict178Data = {
 8,
 Dict178TagHashTable,
 Dict178KeyHashTable,
-Dict178Contents
+Dict178Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_FALCON_03 -----
@@ -10568,7 +10924,9 @@ vtkDICOMDictionary::Dict Dict179Data = {
 8,
 Dict179TagHashTable,
 Dict179KeyHashTable,
-Dict179Contents
+Dict179Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS CM VA0  CMS -----
@@ -10710,7 +11068,9 @@ vtkDICOMDictionary::Dict Dict180Data = {
 70,
 Dict180TagHashTable,
 Dict180KeyHashTable,
-Dict180Contents
+Dict180Contents,
+NULL,
+NULL
 };
 
 // ----- PHILIPS MR/PART 7 -----
@@ -10733,7 +11093,9 @@ vtkDICOMDictionary::Dict Dict181Data = {
 1,
 Dict181TagHashTable,
 Dict181KeyHashTable,
-Dict181Contents
+Dict181Contents,
+NULL,
+NULL
 };
 
 // ----- PHILIPS MR/PART 6 -----
@@ -10756,7 +11118,9 @@ vtkDICOMDictionary::Dict Dict182Data = {
 1,
 Dict182TagHashTable,
 Dict182KeyHashTable,
-Dict182Contents
+Dict182Contents,
+NULL,
+NULL
 };
 
 // ----- PHILIPS MR/PART -----
@@ -11034,7 +11398,9 @@ vtkDICOMDictionary::Dict Dict183Data = {
 151,
 Dict183TagHashTable,
 Dict183KeyHashTable,
-Dict183Contents
+Dict183Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_DL_IMG_01 -----
@@ -11276,7 +11642,9 @@ vtkDICOMDictionary::Dict Dict184Data = {
 127,
 Dict184TagHashTable,
 Dict184KeyHashTable,
-Dict184Contents
+Dict184Contents,
+NULL,
+NULL
 };
 
 // ----- ESOFT_DICOM_ECAT_OWNERCODE -----
@@ -11299,7 +11667,9 @@ vtkDICOMDictionary::Dict Dict185Data = {
 1,
 Dict185TagHashTable,
 Dict185KeyHashTable,
-Dict185Contents
+Dict185Contents,
+NULL,
+NULL
 };
 
 // ----- KINETDX_GRAPHICS -----
@@ -11322,7 +11692,9 @@ vtkDICOMDictionary::Dict Dict186Data = {
 1,
 Dict186TagHashTable,
 Dict186KeyHashTable,
-Dict186Contents
+Dict186Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_SENOCRYSTAL_V1 -----
@@ -11357,7 +11729,9 @@ vtkDICOMDictionary::Dict Dict187Data = {
 8,
 Dict187TagHashTable,
 Dict187KeyHashTable,
-Dict187Contents
+Dict187Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_PETD_01 -----
@@ -11959,7 +12333,9 @@ vtkDICOMDictionary::Dict Dict188Data = {
 335,
 Dict188TagHashTable,
 Dict188KeyHashTable,
-Dict188Contents
+Dict188Contents,
+NULL,
+NULL
 };
 
 // ----- ISI -----
@@ -11982,7 +12358,9 @@ vtkDICOMDictionary::Dict Dict189Data = {
 1,
 Dict189TagHashTable,
 Dict189KeyHashTable,
-Dict189Contents
+Dict189Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_DRS_1 -----
@@ -12014,7 +12392,9 @@ vtkDICOMDictionary::Dict Dict190Data = {
 6,
 Dict190TagHashTable,
 Dict190KeyHashTable,
-Dict190Contents
+Dict190Contents,
+NULL,
+NULL
 };
 
 // ----- RamSoft Race Identifier -----
@@ -12037,7 +12417,9 @@ vtkDICOMDictionary::Dict Dict191Data = {
 1,
 Dict191TagHashTable,
 Dict191KeyHashTable,
-Dict191Contents
+Dict191Contents,
+NULL,
+NULL
 };
 
 // ----- TOSHIBA MDW NON-IMAGE -----
@@ -12064,7 +12446,9 @@ vtkDICOMDictionary::Dict Dict192Data = {
 3,
 Dict192TagHashTable,
 Dict192KeyHashTable,
-Dict192Contents
+Dict192Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MED OCS PUBLIC RT PLAN ATTRIBUTES -----
@@ -12087,7 +12471,9 @@ vtkDICOMDictionary::Dict Dict193Data = {
 1,
 Dict193TagHashTable,
 Dict193KeyHashTable,
-Dict193Contents
+Dict193Contents,
+NULL,
+NULL
 };
 
 // ----- DR Systems, Inc. -----
@@ -12120,7 +12506,9 @@ vtkDICOMDictionary::Dict Dict194Data = {
 7,
 Dict194TagHashTable,
 Dict194KeyHashTable,
-Dict194Contents
+Dict194Contents,
+NULL,
+NULL
 };
 
 // ----- SCHICK TECHNOLOGIES - Change Item Creator ID -----
@@ -12149,7 +12537,9 @@ vtkDICOMDictionary::Dict Dict195Data = {
 5,
 Dict195TagHashTable,
 Dict195KeyHashTable,
-Dict195Contents
+Dict195Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS AX INSPACE_EP -----
@@ -12173,7 +12563,9 @@ vtkDICOMDictionary::Dict Dict196Data = {
 2,
 Dict196TagHashTable,
 Dict196KeyHashTable,
-Dict196Contents
+Dict196Contents,
+NULL,
+NULL
 };
 
 // ----- AGFA-AG_HPState -----
@@ -12248,7 +12640,9 @@ vtkDICOMDictionary::Dict Dict197Data = {
 32,
 Dict197TagHashTable,
 Dict197KeyHashTable,
-Dict197Contents
+Dict197Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P-Private_ICS Release 1 -----
@@ -12311,7 +12705,9 @@ vtkDICOMDictionary::Dict Dict198Data = {
 25,
 Dict198TagHashTable,
 Dict198KeyHashTable,
-Dict198Contents
+Dict198Contents,
+NULL,
+NULL
 };
 
 // ----- RadWorksTBR -----
@@ -12335,7 +12731,9 @@ vtkDICOMDictionary::Dict Dict199Data = {
 2,
 Dict199TagHashTable,
 Dict199KeyHashTable,
-Dict199Contents
+Dict199Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SYNGO REGISTRATION -----
@@ -12359,7 +12757,9 @@ vtkDICOMDictionary::Dict Dict200Data = {
 2,
 Dict200TagHashTable,
 Dict200KeyHashTable,
-Dict200Contents
+Dict200Contents,
+NULL,
+NULL
 };
 
 // ----- AMI Sequence AnnotElements_01 -----
@@ -12383,7 +12783,9 @@ vtkDICOMDictionary::Dict Dict201Data = {
 2,
 Dict201TagHashTable,
 Dict201KeyHashTable,
-Dict201Contents
+Dict201Contents,
+NULL,
+NULL
 };
 
 // ----- AMI ImageTransform_01 -----
@@ -12415,7 +12817,9 @@ vtkDICOMDictionary::Dict Dict202Data = {
 6,
 Dict202TagHashTable,
 Dict202KeyHashTable,
-Dict202Contents
+Dict202Contents,
+NULL,
+NULL
 };
 
 // ----- SECTRA_ImageInfo_01 -----
@@ -12443,7 +12847,9 @@ vtkDICOMDictionary::Dict Dict203Data = {
 4,
 Dict203TagHashTable,
 Dict203KeyHashTable,
-Dict203Contents
+Dict203Contents,
+NULL,
+NULL
 };
 
 // ----- HMC - CT - ID -----
@@ -12467,7 +12873,9 @@ vtkDICOMDictionary::Dict Dict204Data = {
 2,
 Dict204TagHashTable,
 Dict204KeyHashTable,
-Dict204Contents
+Dict204Contents,
+NULL,
+NULL
 };
 
 // ----- VEPRO DICOM RECEIVE DATA 1.0 -----
@@ -12504,7 +12912,9 @@ vtkDICOMDictionary::Dict Dict205Data = {
 9,
 Dict205TagHashTable,
 Dict205KeyHashTable,
-Dict205Contents
+Dict205Contents,
+NULL,
+NULL
 };
 
 // ----- ADAC_IMG -----
@@ -12532,7 +12942,9 @@ vtkDICOMDictionary::Dict Dict206Data = {
 4,
 Dict206TagHashTable,
 Dict206KeyHashTable,
-Dict206Contents
+Dict206Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MEDCOM HEADER2 -----
@@ -12555,7 +12967,9 @@ vtkDICOMDictionary::Dict Dict207Data = {
 1,
 Dict207TagHashTable,
 Dict207KeyHashTable,
-Dict207Contents
+Dict207Contents,
+NULL,
+NULL
 };
 
 // ----- Philips MR Imaging DD 002 -----
@@ -12616,7 +13030,9 @@ vtkDICOMDictionary::Dict Dict208Data = {
 23,
 Dict208TagHashTable,
 Dict208KeyHashTable,
-Dict208Contents
+Dict208Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS CSA HEADER -----
@@ -12648,7 +13064,9 @@ vtkDICOMDictionary::Dict Dict209Data = {
 6,
 Dict209TagHashTable,
 Dict209KeyHashTable,
-Dict209Contents
+Dict209Contents,
+NULL,
+NULL
 };
 
 // ----- MEDISO-1 -----
@@ -12708,7 +13126,9 @@ vtkDICOMDictionary::Dict Dict210Data = {
 23,
 Dict210TagHashTable,
 Dict210KeyHashTable,
-Dict210Contents
+Dict210Contents,
+NULL,
+NULL
 };
 
 // ----- MeVis eD: Geometry Information -----
@@ -12731,7 +13151,9 @@ vtkDICOMDictionary::Dict Dict211Data = {
 1,
 Dict211TagHashTable,
 Dict211KeyHashTable,
-Dict211Contents
+Dict211Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SYNGO 3D FUSION MATRIX -----
@@ -12758,7 +13180,9 @@ vtkDICOMDictionary::Dict Dict212Data = {
 3,
 Dict212TagHashTable,
 Dict212KeyHashTable,
-Dict212Contents
+Dict212Contents,
+NULL,
+NULL
 };
 
 // ----- Philips Imaging DD 001 -----
@@ -12990,7 +13414,9 @@ vtkDICOMDictionary::Dict Dict213Data = {
 121,
 Dict213TagHashTable,
 Dict213KeyHashTable,
-Dict213Contents
+Dict213Contents,
+NULL,
+NULL
 };
 
 // ----- Philips Imaging DD 002 -----
@@ -13094,7 +13520,9 @@ vtkDICOMDictionary::Dict Dict214Data = {
 49,
 Dict214TagHashTable,
 Dict214KeyHashTable,
-Dict214Contents
+Dict214Contents,
+NULL,
+NULL
 };
 
 // ----- KONICA1.0 -----
@@ -13438,7 +13866,9 @@ vtkDICOMDictionary::Dict Dict215Data = {
 192,
 Dict215TagHashTable,
 Dict215KeyHashTable,
-Dict215Contents
+Dict215Contents,
+NULL,
+NULL
 };
 
 // ----- Applicare/Centricity Radiology Web/Version 1.0 -----
@@ -13465,7 +13895,9 @@ vtkDICOMDictionary::Dict Dict216Data = {
 3,
 Dict216TagHashTable,
 Dict216KeyHashTable,
-Dict216Contents
+Dict216Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS Ultrasound S2000 -----
@@ -13489,7 +13921,9 @@ vtkDICOMDictionary::Dict Dict217Data = {
 2,
 Dict217TagHashTable,
 Dict217KeyHashTable,
-Dict217Contents
+Dict217Contents,
+NULL,
+NULL
 };
 
 // ----- 1.2.840.113708.794.1.1.2.0 -----
@@ -13518,7 +13952,9 @@ vtkDICOMDictionary::Dict Dict218Data = {
 5,
 Dict218TagHashTable,
 Dict218KeyHashTable,
-Dict218Contents
+Dict218Contents,
+NULL,
+NULL
 };
 
 // ----- TOSHIBA MDW HEADER -----
@@ -13550,7 +13986,9 @@ vtkDICOMDictionary::Dict Dict219Data = {
 6,
 Dict219TagHashTable,
 Dict219KeyHashTable,
-Dict219Contents
+Dict219Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_IQTB_IDEN_47 -----
@@ -13573,7 +14011,9 @@ vtkDICOMDictionary::Dict Dict220Data = {
 1,
 Dict220TagHashTable,
 Dict220KeyHashTable,
-Dict220Contents
+Dict220Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_ACQU_01 -----
@@ -13915,7 +14355,9 @@ vtkDICOMDictionary::Dict Dict221Data = {
 185,
 Dict221TagHashTable,
 Dict221KeyHashTable,
-Dict221Contents
+Dict221Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_IT_US_REPORT -----
@@ -13942,7 +14384,9 @@ vtkDICOMDictionary::Dict Dict222Data = {
 3,
 Dict222TagHashTable,
 Dict222KeyHashTable,
-Dict222Contents
+Dict222Contents,
+NULL,
+NULL
 };
 
 // ----- SCHICK TECHNOLOGIES - Change List Creator ID -----
@@ -13966,7 +14410,9 @@ vtkDICOMDictionary::Dict Dict223Data = {
 2,
 Dict223TagHashTable,
 Dict223KeyHashTable,
-Dict223Contents
+Dict223Contents,
+NULL,
+NULL
 };
 
 // ----- astm.org/diconde/iod/NdeCtDetector -----
@@ -13999,7 +14445,9 @@ vtkDICOMDictionary::Dict Dict224Data = {
 7,
 Dict224TagHashTable,
 Dict224KeyHashTable,
-Dict224Contents
+Dict224Contents,
+NULL,
+NULL
 };
 
 // ----- DLX_PATNT_01 -----
@@ -14022,7 +14470,9 @@ vtkDICOMDictionary::Dict Dict225Data = {
 1,
 Dict225TagHashTable,
 Dict225KeyHashTable,
-Dict225Contents
+Dict225Contents,
+NULL,
+NULL
 };
 
 // ----- MEDIFACE -----
@@ -14055,7 +14505,9 @@ vtkDICOMDictionary::Dict Dict226Data = {
 7,
 Dict226TagHashTable,
 Dict226KeyHashTable,
-Dict226Contents
+Dict226Contents,
+NULL,
+NULL
 };
 
 // ----- MITRA OBJECT ATTRIBUTES 1.0 -----
@@ -14084,7 +14536,9 @@ vtkDICOMDictionary::Dict Dict227Data = {
 5,
 Dict227TagHashTable,
 Dict227KeyHashTable,
-Dict227Contents
+Dict227Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MR DATAMAPPING ATTRIBUTES -----
@@ -14131,7 +14585,9 @@ vtkDICOMDictionary::Dict Dict228Data = {
 15,
 Dict228TagHashTable,
 Dict228KeyHashTable,
-Dict228Contents
+Dict228Contents,
+NULL,
+NULL
 };
 
 // ----- SET WINDOW -----
@@ -14155,7 +14611,9 @@ vtkDICOMDictionary::Dict Dict229Data = {
 2,
 Dict229TagHashTable,
 Dict229KeyHashTable,
-Dict229Contents
+Dict229Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS CSA NON-IMAGE -----
@@ -14183,7 +14641,9 @@ vtkDICOMDictionary::Dict Dict230Data = {
 4,
 Dict230TagHashTable,
 Dict230KeyHashTable,
-Dict230Contents
+Dict230Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_ADWSoft_DPO -----
@@ -14212,7 +14672,9 @@ vtkDICOMDictionary::Dict Dict231Data = {
 5,
 Dict231TagHashTable,
 Dict231KeyHashTable,
-Dict231Contents
+Dict231Contents,
+NULL,
+NULL
 };
 
 // ----- EMAGEON STUDY HOME -----
@@ -14236,7 +14698,9 @@ vtkDICOMDictionary::Dict Dict232Data = {
 2,
 Dict232TagHashTable,
 Dict232KeyHashTable,
-Dict232Contents
+Dict232Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MR IMA -----
@@ -14259,7 +14723,9 @@ vtkDICOMDictionary::Dict Dict233Data = {
 1,
 Dict233TagHashTable,
 Dict233KeyHashTable,
-Dict233Contents
+Dict233Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MED PT -----
@@ -14287,7 +14753,9 @@ vtkDICOMDictionary::Dict Dict234Data = {
 4,
 Dict234TagHashTable,
 Dict234KeyHashTable,
-Dict234Contents
+Dict234Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MED -----
@@ -14335,7 +14803,9 @@ vtkDICOMDictionary::Dict Dict235Data = {
 16,
 Dict235TagHashTable,
 Dict235KeyHashTable,
-Dict235Contents
+Dict235Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_AWSoft_SB1 -----
@@ -14363,7 +14833,9 @@ vtkDICOMDictionary::Dict Dict236Data = {
 4,
 Dict236TagHashTable,
 Dict236KeyHashTable,
-Dict236Contents
+Dict236Contents,
+NULL,
+NULL
 };
 
 // ----- ShowcaseAppearance -----
@@ -14392,7 +14864,9 @@ vtkDICOMDictionary::Dict Dict237Data = {
 5,
 Dict237TagHashTable,
 Dict237KeyHashTable,
-Dict237Contents
+Dict237Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SYNGO INSTANCE MANIFEST -----
@@ -14416,7 +14890,9 @@ vtkDICOMDictionary::Dict Dict238Data = {
 2,
 Dict238TagHashTable,
 Dict238KeyHashTable,
-Dict238Contents
+Dict238Contents,
+NULL,
+NULL
 };
 
 // ----- Image (ID, Version, Size, Dump, GUID) -----
@@ -14445,7 +14921,9 @@ vtkDICOMDictionary::Dict Dict239Data = {
 5,
 Dict239TagHashTable,
 Dict239KeyHashTable,
-Dict239Contents
+Dict239Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SYNGO ENHANCED IDATASET API -----
@@ -14472,7 +14950,9 @@ vtkDICOMDictionary::Dict Dict240Data = {
 3,
 Dict240TagHashTable,
 Dict240KeyHashTable,
-Dict240Contents
+Dict240Contents,
+NULL,
+NULL
 };
 
 // ----- astm.org/diconde/iod/NdeUsEquipmentSettings -----
@@ -14557,7 +15037,9 @@ vtkDICOMDictionary::Dict Dict241Data = {
 37,
 Dict241TagHashTable,
 Dict241KeyHashTable,
-Dict241Contents
+Dict241Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MR HEADER -----
@@ -14644,7 +15126,9 @@ vtkDICOMDictionary::Dict Dict242Data = {
 38,
 Dict242TagHashTable,
 Dict242KeyHashTable,
-Dict242Contents
+Dict242Contents,
+NULL,
+NULL
 };
 
 // ----- AGFA KOSD 1.0 -----
@@ -14668,7 +15152,9 @@ vtkDICOMDictionary::Dict Dict243Data = {
 2,
 Dict243TagHashTable,
 Dict243KeyHashTable,
-Dict243Contents
+Dict243Contents,
+NULL,
+NULL
 };
 
 // ----- Siemens: Thorax/Multix FD Version -----
@@ -14692,7 +15178,9 @@ vtkDICOMDictionary::Dict Dict244Data = {
 2,
 Dict244TagHashTable,
 Dict244KeyHashTable,
-Dict244Contents
+Dict244Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P-Private-DiDi Release 1 -----
@@ -14719,7 +15207,9 @@ vtkDICOMDictionary::Dict Dict245Data = {
 3,
 Dict245TagHashTable,
 Dict245KeyHashTable,
-Dict245Contents
+Dict245Contents,
+NULL,
+NULL
 };
 
 // ----- BioscanMedisoScivisNanoSPECT -----
@@ -14742,7 +15232,9 @@ vtkDICOMDictionary::Dict Dict246Data = {
 1,
 Dict246TagHashTable,
 Dict246KeyHashTable,
-Dict246Contents
+Dict246Contents,
+NULL,
+NULL
 };
 
 // ----- NUMACALC-INVENTORY -----
@@ -14819,7 +15311,9 @@ vtkDICOMDictionary::Dict Dict247Data = {
 33,
 Dict247TagHashTable,
 Dict247KeyHashTable,
-Dict247Contents
+Dict247Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SMS-AX  ORIGINAL IMAGE INFO 1.0 -----
@@ -14881,7 +15375,9 @@ vtkDICOMDictionary::Dict Dict248Data = {
 23,
 Dict248TagHashTable,
 Dict248KeyHashTable,
-Dict248Contents
+Dict248Contents,
+NULL,
+NULL
 };
 
 // ----- SIENET -----
@@ -14941,7 +15437,9 @@ vtkDICOMDictionary::Dict Dict249Data = {
 23,
 Dict249TagHashTable,
 Dict249KeyHashTable,
-Dict249Contents
+Dict249Contents,
+NULL,
+NULL
 };
 
 // ----- TOSHIBA_MEC_CT3 -----
@@ -15079,7 +15577,9 @@ vtkDICOMDictionary::Dict Dict250Data = {
 67,
 Dict250TagHashTable,
 Dict250KeyHashTable,
-Dict250Contents
+Dict250Contents,
+NULL,
+NULL
 };
 
 // ----- Silhouette Annot V1.0 -----
@@ -15161,7 +15661,9 @@ vtkDICOMDictionary::Dict Dict251Data = {
 35,
 Dict251TagHashTable,
 Dict251KeyHashTable,
-Dict251Contents
+Dict251Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS CT APPL MEASUREMENT -----
@@ -15188,7 +15690,9 @@ vtkDICOMDictionary::Dict Dict252Data = {
 3,
 Dict252TagHashTable,
 Dict252KeyHashTable,
-Dict252Contents
+Dict252Contents,
+NULL,
+NULL
 };
 
 // ----- QCA Results -----
@@ -15236,7 +15740,9 @@ vtkDICOMDictionary::Dict Dict253Data = {
 16,
 Dict253TagHashTable,
 Dict253KeyHashTable,
-Dict253Contents
+Dict253Contents,
+NULL,
+NULL
 };
 
 // ----- RadWorksMarconi -----
@@ -15259,7 +15765,9 @@ vtkDICOMDictionary::Dict Dict254Data = {
 1,
 Dict254TagHashTable,
 Dict254KeyHashTable,
-Dict254Contents
+Dict254Contents,
+NULL,
+NULL
 };
 
 // ----- A.L.I. Technologies, Inc. -----
@@ -15300,7 +15808,9 @@ vtkDICOMDictionary::Dict Dict255Data = {
 11,
 Dict255TagHashTable,
 Dict255KeyHashTable,
-Dict255Contents
+Dict255Contents,
+NULL,
+NULL
 };
 
 // ----- SEGAMI MIML -----
@@ -15323,7 +15833,9 @@ vtkDICOMDictionary::Dict Dict256Data = {
 1,
 Dict256TagHashTable,
 Dict256KeyHashTable,
-Dict256Contents
+Dict256Contents,
+NULL,
+NULL
 };
 
 // ----- EMAGEON JPEG2K INFO -----
@@ -15347,7 +15859,9 @@ vtkDICOMDictionary::Dict Dict257Data = {
 2,
 Dict257TagHashTable,
 Dict257KeyHashTable,
-Dict257Contents
+Dict257Contents,
+NULL,
+NULL
 };
 
 // ----- FOEM 1.0 -----
@@ -15375,7 +15889,9 @@ vtkDICOMDictionary::Dict Dict258Data = {
 4,
 Dict258TagHashTable,
 Dict258KeyHashTable,
-Dict258Contents
+Dict258Contents,
+NULL,
+NULL
 };
 
 // ----- MeVis eD: Timepoint Information -----
@@ -15404,7 +15920,9 @@ vtkDICOMDictionary::Dict Dict259Data = {
 5,
 Dict259TagHashTable,
 Dict259KeyHashTable,
-Dict259Contents
+Dict259Contents,
+NULL,
+NULL
 };
 
 // ----- Harmony R2.0 -----
@@ -15467,7 +15985,9 @@ vtkDICOMDictionary::Dict Dict260Data = {
 25,
 Dict260TagHashTable,
 Dict260KeyHashTable,
-Dict260Contents
+Dict260Contents,
+NULL,
+NULL
 };
 
 // ----- PAPYRUS -----
@@ -15528,7 +16048,9 @@ vtkDICOMDictionary::Dict Dict261Data = {
 23,
 Dict261TagHashTable,
 Dict261KeyHashTable,
-Dict261Contents
+Dict261Contents,
+NULL,
+NULL
 };
 
 // ----- Philips Imaging DD 070 -----
@@ -15564,7 +16086,9 @@ vtkDICOMDictionary::Dict Dict262Data = {
 9,
 Dict262TagHashTable,
 Dict262KeyHashTable,
-Dict262Contents
+Dict262Contents,
+NULL,
+NULL
 };
 
 // ----- TOSHIBA_MEC_XA3 -----
@@ -15733,7 +16257,9 @@ vtkDICOMDictionary::Dict Dict263Data = {
 89,
 Dict263TagHashTable,
 Dict263KeyHashTable,
-Dict263Contents
+Dict263Contents,
+NULL,
+NULL
 };
 
 // ----- Philips Imaging DD 073 -----
@@ -15764,7 +16290,9 @@ vtkDICOMDictionary::Dict Dict264Data = {
 6,
 Dict264TagHashTable,
 Dict264KeyHashTable,
-Dict264Contents
+Dict264Contents,
+NULL,
+NULL
 };
 
 // ----- SEGAMI_HEADER -----
@@ -15788,7 +16316,9 @@ vtkDICOMDictionary::Dict Dict265Data = {
 2,
 Dict265TagHashTable,
 Dict265KeyHashTable,
-Dict265Contents
+Dict265Contents,
+NULL,
+NULL
 };
 
 // ----- IMS s.r.l. Mammography Private Code -----
@@ -15909,7 +16439,9 @@ vtkDICOMDictionary::Dict Dict266Data = {
 57,
 Dict266TagHashTable,
 Dict266KeyHashTable,
-Dict266Contents
+Dict266Contents,
+NULL,
+NULL
 };
 
 // ----- Silhouette Sequence Ids V1.0 -----
@@ -15936,7 +16468,9 @@ vtkDICOMDictionary::Dict Dict267Data = {
 3,
 Dict267TagHashTable,
 Dict267KeyHashTable,
-Dict267Contents
+Dict267Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SYNGO ADVANCED PRESENTATION -----
@@ -16284,7 +16818,9 @@ vtkDICOMDictionary::Dict Dict268Data = {
 187,
 Dict268TagHashTable,
 Dict268KeyHashTable,
-Dict268Contents
+Dict268Contents,
+NULL,
+NULL
 };
 
 // ----- MITRA PRESENTATION 1.0 -----
@@ -16323,7 +16859,9 @@ vtkDICOMDictionary::Dict Dict269Data = {
 10,
 Dict269TagHashTable,
 Dict269KeyHashTable,
-Dict269Contents
+Dict269Contents,
+NULL,
+NULL
 };
 
 // ----- CAMTRONICS IP -----
@@ -16351,7 +16889,9 @@ vtkDICOMDictionary::Dict Dict270Data = {
 4,
 Dict270TagHashTable,
 Dict270KeyHashTable,
-Dict270Contents
+Dict270Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_VXTL_USERDATA_01 -----
@@ -16374,7 +16914,9 @@ vtkDICOMDictionary::Dict Dict271Data = {
 1,
 Dict271TagHashTable,
 Dict271KeyHashTable,
-Dict271Contents
+Dict271Contents,
+NULL,
+NULL
 };
 
 // ----- MITRA OBJECT DOCUMENT 1.0 -----
@@ -16398,7 +16940,9 @@ vtkDICOMDictionary::Dict Dict272Data = {
 2,
 Dict272TagHashTable,
 Dict272KeyHashTable,
-Dict272Contents
+Dict272Contents,
+NULL,
+NULL
 };
 
 // ----- QTUltrasound -----
@@ -16421,7 +16965,9 @@ vtkDICOMDictionary::Dict Dict273Data = {
 1,
 Dict273TagHashTable,
 Dict273KeyHashTable,
-Dict273Contents
+Dict273Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MED SMS USG ANTARES -----
@@ -16528,7 +17074,9 @@ vtkDICOMDictionary::Dict Dict274Data = {
 51,
 Dict274TagHashTable,
 Dict274KeyHashTable,
-Dict274Contents
+Dict274Contents,
+NULL,
+NULL
 };
 
 // ----- PI Private Block (0781:3000 - 0781:30FF) -----
@@ -16556,7 +17104,9 @@ vtkDICOMDictionary::Dict Dict275Data = {
 4,
 Dict275TagHashTable,
 Dict275KeyHashTable,
-Dict275Contents
+Dict275Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MED MAMMO -----
@@ -16579,7 +17129,9 @@ vtkDICOMDictionary::Dict Dict276Data = {
 1,
 Dict276TagHashTable,
 Dict276KeyHashTable,
-Dict276Contents
+Dict276Contents,
+NULL,
+NULL
 };
 
 // ----- PM -----
@@ -16603,7 +17155,9 @@ vtkDICOMDictionary::Dict Dict277Data = {
 2,
 Dict277TagHashTable,
 Dict277KeyHashTable,
-Dict277Contents
+Dict277Contents,
+NULL,
+NULL
 };
 
 // ----- MITRA MARKUP 1.0 -----
@@ -16650,7 +17204,9 @@ vtkDICOMDictionary::Dict Dict278Data = {
 15,
 Dict278TagHashTable,
 Dict278KeyHashTable,
-Dict278Contents
+Dict278Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS_FLCOMPACT_VA01A_PROC -----
@@ -16779,7 +17335,9 @@ vtkDICOMDictionary::Dict Dict279Data = {
 65,
 Dict279TagHashTable,
 Dict279KeyHashTable,
-Dict279Contents
+Dict279Contents,
+NULL,
+NULL
 };
 
 // ----- Applicare/RadStore/Version 1.0 -----
@@ -16869,7 +17427,9 @@ vtkDICOMDictionary::Dict Dict280Data = {
 40,
 Dict280TagHashTable,
 Dict280KeyHashTable,
-Dict280Contents
+Dict280Contents,
+NULL,
+NULL
 };
 
 // ----- Siemens: Thorax/Multix FD Post Processing -----
@@ -16937,7 +17497,9 @@ vtkDICOMDictionary::Dict Dict281Data = {
 27,
 Dict281TagHashTable,
 Dict281KeyHashTable,
-Dict281Contents
+Dict281Contents,
+NULL,
+NULL
 };
 
 // ----- AMICAS0 -----
@@ -16970,7 +17532,9 @@ vtkDICOMDictionary::Dict Dict282Data = {
 7,
 Dict282TagHashTable,
 Dict282KeyHashTable,
-Dict282Contents
+Dict282Contents,
+NULL,
+NULL
 };
 
 // ----- RamSoft Custom Report Identifier -----
@@ -16994,7 +17558,9 @@ vtkDICOMDictionary::Dict Dict283Data = {
 2,
 Dict283TagHashTable,
 Dict283KeyHashTable,
-Dict283Contents
+Dict283Contents,
+NULL,
+NULL
 };
 
 // ----- Applicare/RadWorks/Version 5.0 -----
@@ -17098,7 +17664,9 @@ vtkDICOMDictionary::Dict Dict284Data = {
 48,
 Dict284TagHashTable,
 Dict284KeyHashTable,
-Dict284Contents
+Dict284Contents,
+NULL,
+NULL
 };
 
 // ----- Voxar 2.16.124.113543.6003.1999.12.20.12.5.0 -----
@@ -17143,7 +17711,9 @@ vtkDICOMDictionary::Dict Dict285Data = {
 14,
 Dict285TagHashTable,
 Dict285KeyHashTable,
-Dict285Contents
+Dict285Contents,
+NULL,
+NULL
 };
 
 // ----- astm.org/diconde/iod/NDEGeometry -----
@@ -17190,7 +17760,9 @@ vtkDICOMDictionary::Dict Dict286Data = {
 15,
 Dict286TagHashTable,
 Dict286KeyHashTable,
-Dict286Contents
+Dict286Contents,
+NULL,
+NULL
 };
 
 // ----- BRAINWAVE: 1.2.840.113819.3 -----
@@ -17269,7 +17841,9 @@ vtkDICOMDictionary::Dict Dict287Data = {
 33,
 Dict287TagHashTable,
 Dict287KeyHashTable,
-Dict287Contents
+Dict287Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_CT_VES_01 -----
@@ -17292,7 +17866,9 @@ vtkDICOMDictionary::Dict Dict288Data = {
 1,
 Dict288TagHashTable,
 Dict288KeyHashTable,
-Dict288Contents
+Dict288Contents,
+NULL,
+NULL
 };
 
 // ----- AMI Sequence Annotations_01 -----
@@ -17335,7 +17911,9 @@ vtkDICOMDictionary::Dict Dict289Data = {
 13,
 Dict289TagHashTable,
 Dict289KeyHashTable,
-Dict289Contents
+Dict289Contents,
+NULL,
+NULL
 };
 
 // ----- AMI Sequence Annotations_02 -----
@@ -17378,7 +17956,9 @@ vtkDICOMDictionary::Dict Dict290Data = {
 13,
 Dict290TagHashTable,
 Dict290KeyHashTable,
-Dict290Contents
+Dict290Contents,
+NULL,
+NULL
 };
 
 // ----- GE LUT Asymmetry Parameter -----
@@ -17401,7 +17981,9 @@ vtkDICOMDictionary::Dict Dict291Data = {
 1,
 Dict291TagHashTable,
 Dict291KeyHashTable,
-Dict291Contents
+Dict291Contents,
+NULL,
+NULL
 };
 
 // ----- ACUSON:1.2.840.113680.1.0:0910 -----
@@ -17433,7 +18015,9 @@ vtkDICOMDictionary::Dict Dict292Data = {
 6,
 Dict292TagHashTable,
 Dict292KeyHashTable,
-Dict292Contents
+Dict292Contents,
+NULL,
+NULL
 };
 
 // ----- MATAKINA_10 -----
@@ -17460,7 +18044,9 @@ vtkDICOMDictionary::Dict Dict293Data = {
 3,
 Dict293TagHashTable,
 Dict293KeyHashTable,
-Dict293Contents
+Dict293Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS CT VA0  OST -----
@@ -17484,7 +18070,9 @@ vtkDICOMDictionary::Dict Dict294Data = {
 2,
 Dict294TagHashTable,
 Dict294KeyHashTable,
-Dict294Contents
+Dict294Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MED DISPLAY 0000 -----
@@ -17512,7 +18100,9 @@ vtkDICOMDictionary::Dict Dict295Data = {
 4,
 Dict295TagHashTable,
 Dict295KeyHashTable,
-Dict295Contents
+Dict295Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MED DISPLAY 0001 -----
@@ -17540,7 +18130,9 @@ vtkDICOMDictionary::Dict Dict296Data = {
 4,
 Dict296TagHashTable,
 Dict296KeyHashTable,
-Dict296Contents
+Dict296Contents,
+NULL,
+NULL
 };
 
 // ----- Picker NM Private Group -----
@@ -17587,7 +18179,9 @@ vtkDICOMDictionary::Dict Dict297Data = {
 16,
 Dict297TagHashTable,
 Dict297KeyHashTable,
-Dict297Contents
+Dict297Contents,
+NULL,
+NULL
 };
 
 // ----- PHILIPS MR SPECTRO;1 -----
@@ -17692,7 +18286,9 @@ vtkDICOMDictionary::Dict Dict298Data = {
 50,
 Dict298TagHashTable,
 Dict298KeyHashTable,
-Dict298Contents
+Dict298Contents,
+NULL,
+NULL
 };
 
 // ----- astm.org/diconde/iod/NdeIndication -----
@@ -17736,7 +18332,9 @@ vtkDICOMDictionary::Dict Dict299Data = {
 13,
 Dict299TagHashTable,
 Dict299KeyHashTable,
-Dict299Contents
+Dict299Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_LUNAR_RAW -----
@@ -17764,7 +18362,9 @@ vtkDICOMDictionary::Dict Dict300Data = {
 4,
 Dict300TagHashTable,
 Dict300KeyHashTable,
-Dict300Contents
+Dict300Contents,
+NULL,
+NULL
 };
 
 // ----- PRIVATE_CODE_STRING_3007 -----
@@ -17794,7 +18394,9 @@ vtkDICOMDictionary::Dict Dict301Data = {
 5,
 Dict301TagHashTable,
 Dict301KeyHashTable,
-Dict301Contents
+Dict301Contents,
+NULL,
+NULL
 };
 
 // ----- TELEMIS -----
@@ -17817,7 +18419,9 @@ vtkDICOMDictionary::Dict Dict302Data = {
 1,
 Dict302TagHashTable,
 Dict302KeyHashTable,
-Dict302Contents
+Dict302Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS Selma -----
@@ -17857,7 +18461,9 @@ vtkDICOMDictionary::Dict Dict303Data = {
 11,
 Dict303TagHashTable,
 Dict303KeyHashTable,
-Dict303Contents
+Dict303Contents,
+NULL,
+NULL
 };
 
 // ----- ETIAM DICOMDIR -----
@@ -17880,7 +18486,9 @@ vtkDICOMDictionary::Dict Dict304Data = {
 1,
 Dict304TagHashTable,
 Dict304KeyHashTable,
-Dict304Contents
+Dict304Contents,
+NULL,
+NULL
 };
 
 // ----- MAROTECH Inc. -----
@@ -17908,7 +18516,9 @@ vtkDICOMDictionary::Dict Dict305Data = {
 4,
 Dict305TagHashTable,
 Dict305KeyHashTable,
-Dict305Contents
+Dict305Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_DL_FRAME_01 -----
@@ -18005,7 +18615,9 @@ vtkDICOMDictionary::Dict Dict306Data = {
 43,
 Dict306TagHashTable,
 Dict306KeyHashTable,
-Dict306Contents
+Dict306Contents,
+NULL,
+NULL
 };
 
 // ----- PHILIPS MR/PART 12 -----
@@ -18028,7 +18640,9 @@ vtkDICOMDictionary::Dict Dict307Data = {
 1,
 Dict307TagHashTable,
 Dict307KeyHashTable,
-Dict307Contents
+Dict307Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MR N3D -----
@@ -18241,7 +18855,9 @@ vtkDICOMDictionary::Dict Dict308Data = {
 110,
 Dict308TagHashTable,
 Dict308KeyHashTable,
-Dict308Contents
+Dict308Contents,
+NULL,
+NULL
 };
 
 // ----- Camtronics image level data -----
@@ -18272,7 +18888,9 @@ vtkDICOMDictionary::Dict Dict309Data = {
 6,
 Dict309TagHashTable,
 Dict309KeyHashTable,
-Dict309Contents
+Dict309Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MED HG -----
@@ -18307,7 +18925,9 @@ vtkDICOMDictionary::Dict Dict310Data = {
 8,
 Dict310TagHashTable,
 Dict310KeyHashTable,
-Dict310Contents
+Dict310Contents,
+NULL,
+NULL
 };
 
 // ----- SCIVIS-1 -----
@@ -18348,7 +18968,9 @@ vtkDICOMDictionary::Dict Dict311Data = {
 12,
 Dict311TagHashTable,
 Dict311KeyHashTable,
-Dict311Contents
+Dict311Contents,
+NULL,
+NULL
 };
 
 // ----- BrainLAB_PatientSetup -----
@@ -18372,7 +18994,9 @@ vtkDICOMDictionary::Dict Dict312Data = {
 2,
 Dict312TagHashTable,
 Dict312KeyHashTable,
-Dict312Contents
+Dict312Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_CT_CARDIAC_001 -----
@@ -18426,7 +19050,9 @@ vtkDICOMDictionary::Dict Dict313Data = {
 19,
 Dict313TagHashTable,
 Dict313KeyHashTable,
-Dict313Contents
+Dict313Contents,
+NULL,
+NULL
 };
 
 // ----- MMCPrivate -----
@@ -18883,7 +19509,9 @@ vtkDICOMDictionary::Dict Dict314Data = {
 251,
 Dict314TagHashTable,
 Dict314KeyHashTable,
-Dict314Contents
+Dict314Contents,
+NULL,
+NULL
 };
 
 // ----- IDEXX -----
@@ -18910,7 +19538,9 @@ vtkDICOMDictionary::Dict Dict315Data = {
 3,
 Dict315TagHashTable,
 Dict315KeyHashTable,
-Dict315Contents
+Dict315Contents,
+NULL,
+NULL
 };
 
 // ----- VEPRO DICOM TRANSFER 1.0 -----
@@ -18933,7 +19563,9 @@ vtkDICOMDictionary::Dict Dict316Data = {
 1,
 Dict316TagHashTable,
 Dict316KeyHashTable,
-Dict316Contents
+Dict316Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P Release 1 -----
@@ -19109,7 +19741,9 @@ vtkDICOMDictionary::Dict Dict317Data = {
 91,
 Dict317TagHashTable,
 Dict317KeyHashTable,
-Dict317Contents
+Dict317Contents,
+NULL,
+NULL
 };
 
 // ----- Philips EV Imaging DD 022 -----
@@ -19132,7 +19766,9 @@ vtkDICOMDictionary::Dict Dict318Data = {
 1,
 Dict318TagHashTable,
 Dict318KeyHashTable,
-Dict318Contents
+Dict318Contents,
+NULL,
+NULL
 };
 
 // ----- TOSHIBA ENCRYPTED SR DATA -----
@@ -19155,7 +19791,9 @@ vtkDICOMDictionary::Dict Dict319Data = {
 1,
 Dict319TagHashTable,
 Dict319KeyHashTable,
-Dict319Contents
+Dict319Contents,
+NULL,
+NULL
 };
 
 // ----- SECTRA_OverlayInfo_01 -----
@@ -19178,7 +19816,9 @@ vtkDICOMDictionary::Dict Dict320Data = {
 1,
 Dict320TagHashTable,
 Dict320KeyHashTable,
-Dict320Contents
+Dict320Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS CSA ENVELOPE -----
@@ -19202,7 +19842,9 @@ vtkDICOMDictionary::Dict Dict321Data = {
 2,
 Dict321TagHashTable,
 Dict321KeyHashTable,
-Dict321Contents
+Dict321Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS RA PLANE A -----
@@ -19447,7 +20089,9 @@ vtkDICOMDictionary::Dict Dict322Data = {
 133,
 Dict322TagHashTable,
 Dict322KeyHashTable,
-Dict322Contents
+Dict322Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS RA PLANE B -----
@@ -19692,7 +20336,9 @@ vtkDICOMDictionary::Dict Dict323Data = {
 133,
 Dict323TagHashTable,
 Dict323KeyHashTable,
-Dict323Contents
+Dict323Contents,
+NULL,
+NULL
 };
 
 // ----- Silhouette V1.0 -----
@@ -19773,7 +20419,9 @@ vtkDICOMDictionary::Dict Dict324Data = {
 36,
 Dict324TagHashTable,
 Dict324KeyHashTable,
-Dict324Contents
+Dict324Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MED PT WAVEFORM -----
@@ -19803,7 +20451,9 @@ vtkDICOMDictionary::Dict Dict325Data = {
 5,
 Dict325TagHashTable,
 Dict325KeyHashTable,
-Dict325Contents
+Dict325Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_STDY_01 -----
@@ -19837,7 +20487,9 @@ vtkDICOMDictionary::Dict Dict326Data = {
 8,
 Dict326TagHashTable,
 Dict326KeyHashTable,
-Dict326Contents
+Dict326Contents,
+NULL,
+NULL
 };
 
 // ----- TOSHIBA COMAPL HEADER -----
@@ -19869,7 +20521,9 @@ vtkDICOMDictionary::Dict Dict327Data = {
 6,
 Dict327TagHashTable,
 Dict327KeyHashTable,
-Dict327Contents
+Dict327Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_GDXE_FALCON_04 -----
@@ -19957,7 +20611,9 @@ vtkDICOMDictionary::Dict Dict328Data = {
 39,
 Dict328TagHashTable,
 Dict328KeyHashTable,
-Dict328Contents
+Dict328Contents,
+NULL,
+NULL
 };
 
 // ----- PHILIPS IMAGING DD 001 -----
@@ -20189,7 +20845,9 @@ vtkDICOMDictionary::Dict Dict329Data = {
 121,
 Dict329TagHashTable,
 Dict329KeyHashTable,
-Dict329Contents
+Dict329Contents,
+NULL,
+NULL
 };
 
 // ----- NQRight -----
@@ -20312,7 +20970,9 @@ vtkDICOMDictionary::Dict Dict330Data = {
 58,
 Dict330TagHashTable,
 Dict330KeyHashTable,
-Dict330Contents
+Dict330Contents,
+NULL,
+NULL
 };
 
 // ----- Siemens: Thorax/Multix FD Lab Settings -----
@@ -20366,7 +21026,9 @@ vtkDICOMDictionary::Dict Dict331Data = {
 19,
 Dict331TagHashTable,
 Dict331KeyHashTable,
-Dict331Contents
+Dict331Contents,
+NULL,
+NULL
 };
 
 // ----- CAD Sciences -----
@@ -20394,7 +21056,9 @@ vtkDICOMDictionary::Dict Dict332Data = {
 4,
 Dict332TagHashTable,
 Dict332KeyHashTable,
-Dict332Contents
+Dict332Contents,
+NULL,
+NULL
 };
 
 // ----- V1 -----
@@ -20427,7 +21091,9 @@ vtkDICOMDictionary::Dict Dict333Data = {
 7,
 Dict333TagHashTable,
 Dict333KeyHashTable,
-Dict333Contents
+Dict333Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_SERS_01 -----
@@ -20465,7 +21131,9 @@ vtkDICOMDictionary::Dict Dict334Data = {
 10,
 Dict334TagHashTable,
 Dict334KeyHashTable,
-Dict334Contents
+Dict334Contents,
+NULL,
+NULL
 };
 
 // ----- astm.org/diconde/iod/NdeUsEquipment -----
@@ -20523,7 +21191,9 @@ vtkDICOMDictionary::Dict Dict335Data = {
 21,
 Dict335TagHashTable,
 Dict335KeyHashTable,
-Dict335Contents
+Dict335Contents,
+NULL,
+NULL
 };
 
 // ----- AMI ImageContext_01 -----
@@ -20560,7 +21230,9 @@ vtkDICOMDictionary::Dict Dict336Data = {
 9,
 Dict336TagHashTable,
 Dict336KeyHashTable,
-Dict336Contents
+Dict336Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P-XSB-VISUB Release 1 -----
@@ -20620,7 +21292,9 @@ vtkDICOMDictionary::Dict Dict337Data = {
 23,
 Dict337TagHashTable,
 Dict337KeyHashTable,
-Dict337Contents
+Dict337Contents,
+NULL,
+NULL
 };
 
 // ----- 2.16.840.1.114059.1.1.6.1.50.1 -----
@@ -20655,7 +21329,9 @@ vtkDICOMDictionary::Dict Dict338Data = {
 8,
 Dict338TagHashTable,
 Dict338KeyHashTable,
-Dict338Contents
+Dict338Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS RIS -----
@@ -20698,7 +21374,9 @@ vtkDICOMDictionary::Dict Dict339Data = {
 13,
 Dict339TagHashTable,
 Dict339KeyHashTable,
-Dict339Contents
+Dict339Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_YMHD_01 -----
@@ -20722,7 +21400,9 @@ vtkDICOMDictionary::Dict Dict340Data = {
 2,
 Dict340TagHashTable,
 Dict340KeyHashTable,
-Dict340Contents
+Dict340Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P-CTBE Release 1 -----
@@ -20767,7 +21447,9 @@ vtkDICOMDictionary::Dict Dict341Data = {
 14,
 Dict341TagHashTable,
 Dict341KeyHashTable,
-Dict341Contents
+Dict341Contents,
+NULL,
+NULL
 };
 
 // ----- ISG shadow -----
@@ -20794,7 +21476,9 @@ vtkDICOMDictionary::Dict Dict342Data = {
 3,
 Dict342TagHashTable,
 Dict342KeyHashTable,
-Dict342Contents
+Dict342Contents,
+NULL,
+NULL
 };
 
 // ----- METAEMOTION GINKGO RETINAL -----
@@ -20821,7 +21505,9 @@ vtkDICOMDictionary::Dict Dict343Data = {
 3,
 Dict343TagHashTable,
 Dict343KeyHashTable,
-Dict343Contents
+Dict343Contents,
+NULL,
+NULL
 };
 
 // ----- Riverain Medical -----
@@ -20854,7 +21540,9 @@ vtkDICOMDictionary::Dict Dict344Data = {
 7,
 Dict344TagHashTable,
 Dict344KeyHashTable,
-Dict344Contents
+Dict344Contents,
+NULL,
+NULL
 };
 
 // ----- HOLOGIC -----
@@ -20896,7 +21584,9 @@ vtkDICOMDictionary::Dict Dict345Data = {
 12,
 Dict345TagHashTable,
 Dict345KeyHashTable,
-Dict345Contents
+Dict345Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_ACRQA_2.0 BLOCK1 -----
@@ -20934,7 +21624,9 @@ vtkDICOMDictionary::Dict Dict346Data = {
 10,
 Dict346TagHashTable,
 Dict346KeyHashTable,
-Dict346Contents
+Dict346Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_ACRQA_2.0 BLOCK2 -----
@@ -20972,7 +21664,9 @@ vtkDICOMDictionary::Dict Dict347Data = {
 10,
 Dict347TagHashTable,
 Dict347KeyHashTable,
-Dict347Contents
+Dict347Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_ACRQA_2.0 BLOCK3 -----
@@ -21014,7 +21708,9 @@ vtkDICOMDictionary::Dict Dict348Data = {
 12,
 Dict348TagHashTable,
 Dict348KeyHashTable,
-Dict348Contents
+Dict348Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_3DSTATE_001 -----
@@ -21043,7 +21739,9 @@ vtkDICOMDictionary::Dict Dict349Data = {
 5,
 Dict349TagHashTable,
 Dict349KeyHashTable,
-Dict349Contents
+Dict349Contents,
+NULL,
+NULL
 };
 
 // ----- RamSoft File Kind Identifier -----
@@ -21066,7 +21764,9 @@ vtkDICOMDictionary::Dict Dict350Data = {
 1,
 Dict350TagHashTable,
 Dict350KeyHashTable,
-Dict350Contents
+Dict350Contents,
+NULL,
+NULL
 };
 
 // ----- SEGAMI__PAGE -----
@@ -21090,7 +21790,9 @@ vtkDICOMDictionary::Dict Dict351Data = {
 2,
 Dict351TagHashTable,
 Dict351KeyHashTable,
-Dict351Contents
+Dict351Contents,
+NULL,
+NULL
 };
 
 // ----- Sound Eklin -----
@@ -21162,7 +21864,9 @@ vtkDICOMDictionary::Dict Dict352Data = {
 29,
 Dict352TagHashTable,
 Dict352KeyHashTable,
-Dict352Contents
+Dict352Contents,
+NULL,
+NULL
 };
 
 // ----- SECTRA_Ident_01 -----
@@ -21194,7 +21898,9 @@ vtkDICOMDictionary::Dict Dict353Data = {
 6,
 Dict353TagHashTable,
 Dict353KeyHashTable,
-Dict353Contents
+Dict353Contents,
+NULL,
+NULL
 };
 
 // ----- STENTOR -----
@@ -21223,7 +21929,9 @@ vtkDICOMDictionary::Dict Dict354Data = {
 5,
 Dict354TagHashTable,
 Dict354KeyHashTable,
-Dict354Contents
+Dict354Contents,
+NULL,
+NULL
 };
 
 // ----- ObjectModel (ID, Version, Place, PlaceDescription) -----
@@ -21247,7 +21955,9 @@ vtkDICOMDictionary::Dict Dict355Data = {
 2,
 Dict355TagHashTable,
 Dict355KeyHashTable,
-Dict355Contents
+Dict355Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_3D_INTVL_01 -----
@@ -21333,7 +22043,9 @@ vtkDICOMDictionary::Dict Dict356Data = {
 37,
 Dict356TagHashTable,
 Dict356KeyHashTable,
-Dict356Contents
+Dict356Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS CSA REPORT -----
@@ -21361,7 +22073,9 @@ vtkDICOMDictionary::Dict Dict357Data = {
 4,
 Dict357TagHashTable,
 Dict357KeyHashTable,
-Dict357Contents
+Dict357Contents,
+NULL,
+NULL
 };
 
 // ----- astm.org/diconde/iod/ComponentSeries -----
@@ -21385,7 +22099,9 @@ vtkDICOMDictionary::Dict Dict358Data = {
 2,
 Dict358TagHashTable,
 Dict358KeyHashTable,
-Dict358Contents
+Dict358Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_0039 -----
@@ -21408,7 +22124,9 @@ vtkDICOMDictionary::Dict Dict359Data = {
 1,
 Dict359TagHashTable,
 Dict359KeyHashTable,
-Dict359Contents
+Dict359Contents,
+NULL,
+NULL
 };
 
 // ----- PHILIPS MR IMAGING DD 001 -----
@@ -21662,7 +22380,9 @@ vtkDICOMDictionary::Dict Dict360Data = {
 133,
 Dict360TagHashTable,
 Dict360KeyHashTable,
-Dict360Contents
+Dict360Contents,
+NULL,
+NULL
 };
 
 // ----- GE_GENESIS_REV3.0 -----
@@ -21709,7 +22429,9 @@ vtkDICOMDictionary::Dict Dict361Data = {
 15,
 Dict361TagHashTable,
 Dict361KeyHashTable,
-Dict361Contents
+Dict361Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MR VA0  COAD -----
@@ -21807,7 +22529,9 @@ vtkDICOMDictionary::Dict Dict362Data = {
 45,
 Dict362TagHashTable,
 Dict362KeyHashTable,
-Dict362Contents
+Dict362Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_PATI_01 -----
@@ -21830,7 +22554,9 @@ vtkDICOMDictionary::Dict Dict363Data = {
 1,
 Dict363TagHashTable,
 Dict363KeyHashTable,
-Dict363Contents
+Dict363Contents,
+NULL,
+NULL
 };
 
 // ----- NNT -----
@@ -21902,7 +22628,9 @@ vtkDICOMDictionary::Dict Dict364Data = {
 30,
 Dict364TagHashTable,
 Dict364KeyHashTable,
-Dict364Contents
+Dict364Contents,
+NULL,
+NULL
 };
 
 // ----- agfa/displayableImages -----
@@ -21926,7 +22654,9 @@ vtkDICOMDictionary::Dict Dict365Data = {
 2,
 Dict365TagHashTable,
 Dict365KeyHashTable,
-Dict365Contents
+Dict365Contents,
+NULL,
+NULL
 };
 
 // ----- Brainlab-S32-SO -----
@@ -21950,7 +22680,9 @@ vtkDICOMDictionary::Dict Dict366Data = {
 2,
 Dict366TagHashTable,
 Dict366KeyHashTable,
-Dict366Contents
+Dict366Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_Ultrasound_ImageGroup_001 -----
@@ -21978,7 +22710,9 @@ vtkDICOMDictionary::Dict Dict367Data = {
 4,
 Dict367TagHashTable,
 Dict367KeyHashTable,
-Dict367Contents
+Dict367Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MEDCOM HEADER -----
@@ -22048,7 +22782,9 @@ vtkDICOMDictionary::Dict Dict368Data = {
 28,
 Dict368TagHashTable,
 Dict368KeyHashTable,
-Dict368Contents
+Dict368Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SYNGO EVIDENCE DOCUMENT DATA -----
@@ -22090,7 +22826,9 @@ vtkDICOMDictionary::Dict Dict369Data = {
 12,
 Dict369TagHashTable,
 Dict369KeyHashTable,
-Dict369Contents
+Dict369Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_DL_SERIES_01 -----
@@ -22122,7 +22860,9 @@ vtkDICOMDictionary::Dict Dict370Data = {
 6,
 Dict370TagHashTable,
 Dict370KeyHashTable,
-Dict370Contents
+Dict370Contents,
+NULL,
+NULL
 };
 
 // ----- Canon Inc. -----
@@ -22166,7 +22906,9 @@ vtkDICOMDictionary::Dict Dict371Data = {
 13,
 Dict371TagHashTable,
 Dict371KeyHashTable,
-Dict371Contents
+Dict371Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_GENIE_1 -----
@@ -22681,7 +23423,9 @@ vtkDICOMDictionary::Dict Dict372Data = {
 286,
 Dict372TagHashTable,
 Dict372KeyHashTable,
-Dict372Contents
+Dict372Contents,
+NULL,
+NULL
 };
 
 // ----- CT IMG ACQUISITION -----
@@ -22757,7 +23501,9 @@ vtkDICOMDictionary::Dict Dict373Data = {
 32,
 Dict373TagHashTable,
 Dict373KeyHashTable,
-Dict373Contents
+Dict373Contents,
+NULL,
+NULL
 };
 
 // ----- SCHICK TECHNOLOGIES - Image Security Creator ID -----
@@ -22780,7 +23526,9 @@ vtkDICOMDictionary::Dict Dict374Data = {
 1,
 Dict374TagHashTable,
 Dict374KeyHashTable,
-Dict374Contents
+Dict374Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MR VA0  GEN -----
@@ -22941,7 +23689,9 @@ vtkDICOMDictionary::Dict Dict375Data = {
 81,
 Dict375TagHashTable,
 Dict375KeyHashTable,
-Dict375Contents
+Dict375Contents,
+NULL,
+NULL
 };
 
 // ----- Hologic -----
@@ -22983,7 +23733,9 @@ vtkDICOMDictionary::Dict Dict376Data = {
 12,
 Dict376TagHashTable,
 Dict376KeyHashTable,
-Dict376Contents
+Dict376Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_DL_PATNT_01 -----
@@ -23011,7 +23763,9 @@ vtkDICOMDictionary::Dict Dict377Data = {
 4,
 Dict377TagHashTable,
 Dict377KeyHashTable,
-Dict377Contents
+Dict377Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_CT_FLRO_01 -----
@@ -23035,7 +23789,9 @@ vtkDICOMDictionary::Dict Dict378Data = {
 2,
 Dict378TagHashTable,
 Dict378KeyHashTable,
-Dict378Contents
+Dict378Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SYNGO FRAME SET -----
@@ -23067,7 +23823,9 @@ vtkDICOMDictionary::Dict Dict379Data = {
 6,
 Dict379TagHashTable,
 Dict379KeyHashTable,
-Dict379Contents
+Dict379Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MR CM 03 -----
@@ -23091,7 +23849,9 @@ vtkDICOMDictionary::Dict Dict380Data = {
 2,
 Dict380TagHashTable,
 Dict380KeyHashTable,
-Dict380Contents
+Dict380Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS Ultrasound SC2000 -----
@@ -23188,7 +23948,9 @@ vtkDICOMDictionary::Dict Dict381Data = {
 44,
 Dict381TagHashTable,
 Dict381KeyHashTable,
-Dict381Contents
+Dict381Contents,
+NULL,
+NULL
 };
 
 // ----- TOSHIBA_MEC_1.0 -----
@@ -23234,7 +23996,9 @@ vtkDICOMDictionary::Dict Dict382Data = {
 15,
 Dict382TagHashTable,
 Dict382KeyHashTable,
-Dict382Contents
+Dict382Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MED SMS USG S2000 3D VOLUME -----
@@ -23426,7 +24190,9 @@ vtkDICOMDictionary::Dict Dict383Data = {
 99,
 Dict383TagHashTable,
 Dict383KeyHashTable,
-Dict383Contents
+Dict383Contents,
+NULL,
+NULL
 };
 
 // ----- Picker MR Private Group -----
@@ -23461,7 +24227,9 @@ vtkDICOMDictionary::Dict Dict384Data = {
 8,
 Dict384TagHashTable,
 Dict384KeyHashTable,
-Dict384Contents
+Dict384Contents,
+NULL,
+NULL
 };
 
 // ----- DLX_SERIE_01 -----
@@ -23539,7 +24307,9 @@ vtkDICOMDictionary::Dict Dict385Data = {
 33,
 Dict385TagHashTable,
 Dict385KeyHashTable,
-Dict385Contents
+Dict385Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SYNGO ENCAPSULATED DOCUMENT DATA -----
@@ -23566,7 +24336,9 @@ vtkDICOMDictionary::Dict Dict386Data = {
 3,
 Dict386TagHashTable,
 Dict386KeyHashTable,
-Dict386Contents
+Dict386Contents,
+NULL,
+NULL
 };
 
 // ----- 1.2.840.113663.1 -----
@@ -23590,7 +24362,9 @@ vtkDICOMDictionary::Dict Dict387Data = {
 2,
 Dict387TagHashTable,
 Dict387KeyHashTable,
-Dict387Contents
+Dict387Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MED OCS BEAM DISPLAY INFO -----
@@ -23613,7 +24387,9 @@ vtkDICOMDictionary::Dict Dict388Data = {
 1,
 Dict388TagHashTable,
 Dict388KeyHashTable,
-Dict388Contents
+Dict388Contents,
+NULL,
+NULL
 };
 
 // ----- ULTRAVISUAL_TAG_SET1 -----
@@ -23656,7 +24432,9 @@ vtkDICOMDictionary::Dict Dict389Data = {
 13,
 Dict389TagHashTable,
 Dict389KeyHashTable,
-Dict389Contents
+Dict389Contents,
+NULL,
+NULL
 };
 
 // ----- Applicare/RadWorks/Version 6.0/Summary -----
@@ -23685,7 +24463,9 @@ vtkDICOMDictionary::Dict Dict390Data = {
 5,
 Dict390TagHashTable,
 Dict390KeyHashTable,
-Dict390Contents
+Dict390Contents,
+NULL,
+NULL
 };
 
 // ----- CARDIO-D.R. 1.0 -----
@@ -23737,7 +24517,9 @@ vtkDICOMDictionary::Dict Dict391Data = {
 18,
 Dict391TagHashTable,
 Dict391KeyHashTable,
-Dict391Contents
+Dict391Contents,
+NULL,
+NULL
 };
 
 // ----- LODOX_STATSCAN -----
@@ -23772,7 +24554,9 @@ vtkDICOMDictionary::Dict Dict392Data = {
 8,
 Dict392TagHashTable,
 Dict392KeyHashTable,
-Dict392Contents
+Dict392Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MED SMS USG ANTARES 3D VOLUME -----
@@ -24028,7 +24812,9 @@ vtkDICOMDictionary::Dict Dict393Data = {
 136,
 Dict393TagHashTable,
 Dict393KeyHashTable,
-Dict393Contents
+Dict393Contents,
+NULL,
+NULL
 };
 
 // ----- 1.2.840.113681 -----
@@ -24056,7 +24842,9 @@ vtkDICOMDictionary::Dict Dict394Data = {
 4,
 Dict394TagHashTable,
 Dict394KeyHashTable,
-Dict394Contents
+Dict394Contents,
+NULL,
+NULL
 };
 
 // ----- Philips PET Private Group -----
@@ -24123,7 +24911,9 @@ vtkDICOMDictionary::Dict Dict395Data = {
 27,
 Dict395TagHashTable,
 Dict395KeyHashTable,
-Dict395Contents
+Dict395Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS-IT/Centricity RA600/7.0 -----
@@ -24146,7 +24936,9 @@ vtkDICOMDictionary::Dict Dict396Data = {
 1,
 Dict396TagHashTable,
 Dict396KeyHashTable,
-Dict396Contents
+Dict396Contents,
+NULL,
+NULL
 };
 
 // ----- syngoDynamics_Reporting -----
@@ -24169,7 +24961,9 @@ vtkDICOMDictionary::Dict Dict397Data = {
 1,
 Dict397TagHashTable,
 Dict397KeyHashTable,
-Dict397Contents
+Dict397Contents,
+NULL,
+NULL
 };
 
 // ----- Harmony R1.0 C3 -----
@@ -24260,7 +25054,9 @@ vtkDICOMDictionary::Dict Dict398Data = {
 42,
 Dict398TagHashTable,
 Dict398KeyHashTable,
-Dict398Contents
+Dict398Contents,
+NULL,
+NULL
 };
 
 // ----- Harmony R1.0 C2 -----
@@ -24324,7 +25120,9 @@ vtkDICOMDictionary::Dict Dict399Data = {
 26,
 Dict399TagHashTable,
 Dict399KeyHashTable,
-Dict399Contents
+Dict399Contents,
+NULL,
+NULL
 };
 
 // ----- SEGAMI__MEMO -----
@@ -24348,7 +25146,9 @@ vtkDICOMDictionary::Dict Dict400Data = {
 2,
 Dict400TagHashTable,
 Dict400KeyHashTable,
-Dict400Contents
+Dict400Contents,
+NULL,
+NULL
 };
 
 // ----- AGFA -----
@@ -24408,7 +25208,9 @@ vtkDICOMDictionary::Dict Dict401Data = {
 23,
 Dict401TagHashTable,
 Dict401KeyHashTable,
-Dict401Contents
+Dict401Contents,
+NULL,
+NULL
 };
 
 // ----- Philips Imaging DD 067 -----
@@ -24436,7 +25238,9 @@ vtkDICOMDictionary::Dict Dict402Data = {
 4,
 Dict402TagHashTable,
 Dict402KeyHashTable,
-Dict402Contents
+Dict402Contents,
+NULL,
+NULL
 };
 
 // ----- DLX_EXAMS_01 -----
@@ -24463,7 +25267,9 @@ vtkDICOMDictionary::Dict Dict403Data = {
 3,
 Dict403TagHashTable,
 Dict403KeyHashTable,
-Dict403Contents
+Dict403Contents,
+NULL,
+NULL
 };
 
 // ----- Philips Imaging DD 065 -----
@@ -24486,7 +25292,9 @@ vtkDICOMDictionary::Dict Dict404Data = {
 1,
 Dict404TagHashTable,
 Dict404KeyHashTable,
-Dict404Contents
+Dict404Contents,
+NULL,
+NULL
 };
 
 // ----- GE_GROUP -----
@@ -24509,7 +25317,9 @@ vtkDICOMDictionary::Dict Dict405Data = {
 1,
 Dict405TagHashTable,
 Dict405KeyHashTable,
-Dict405Contents
+Dict405Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS SYNGO OBJECT GRAPHICS -----
@@ -24743,7 +25553,9 @@ vtkDICOMDictionary::Dict Dict406Data = {
 122,
 Dict406TagHashTable,
 Dict406KeyHashTable,
-Dict406Contents
+Dict406Contents,
+NULL,
+NULL
 };
 
 // ----- Visus Change -----
@@ -24772,7 +25584,9 @@ vtkDICOMDictionary::Dict Dict407Data = {
 5,
 Dict407TagHashTable,
 Dict407KeyHashTable,
-Dict407Contents
+Dict407Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS ISI -----
@@ -24862,7 +25676,9 @@ vtkDICOMDictionary::Dict Dict408Data = {
 40,
 Dict408TagHashTable,
 Dict408KeyHashTable,
-Dict408Contents
+Dict408Contents,
+NULL,
+NULL
 };
 
 // ----- PHILIPS MR R5.6/PART -----
@@ -24885,7 +25701,9 @@ vtkDICOMDictionary::Dict Dict409Data = {
 1,
 Dict409TagHashTable,
 Dict409KeyHashTable,
-Dict409Contents
+Dict409Contents,
+NULL,
+NULL
 };
 
 // ----- METAEMOTION GINKGO -----
@@ -24909,7 +25727,9 @@ vtkDICOMDictionary::Dict Dict410Data = {
 2,
 Dict410TagHashTable,
 Dict410KeyHashTable,
-Dict410Contents
+Dict410Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_IDEN_01 -----
@@ -24957,7 +25777,9 @@ vtkDICOMDictionary::Dict Dict411Data = {
 16,
 Dict411TagHashTable,
 Dict411KeyHashTable,
-Dict411Contents
+Dict411Contents,
+NULL,
+NULL
 };
 
 // ----- Silhouette Graphics Export V1.0 -----
@@ -24980,7 +25802,9 @@ vtkDICOMDictionary::Dict Dict412Data = {
 1,
 Dict412TagHashTable,
 Dict412KeyHashTable,
-Dict412Contents
+Dict412Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MED ECAT FILE INFO -----
@@ -25004,7 +25828,9 @@ vtkDICOMDictionary::Dict Dict413Data = {
 2,
 Dict413TagHashTable,
 Dict413KeyHashTable,
-Dict413Contents
+Dict413Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS CT APPL EVIDENCEDOCUMENT -----
@@ -25027,7 +25853,9 @@ vtkDICOMDictionary::Dict Dict414Data = {
 1,
 Dict414TagHashTable,
 Dict414KeyHashTable,
-Dict414Contents
+Dict414Contents,
+NULL,
+NULL
 };
 
 // ----- Viewing Protocol -----
@@ -25050,7 +25878,9 @@ vtkDICOMDictionary::Dict Dict415Data = {
 1,
 Dict415TagHashTable,
 Dict415KeyHashTable,
-Dict415Contents
+Dict415Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS DFR.01 MANIPULATED -----
@@ -25119,7 +25949,9 @@ vtkDICOMDictionary::Dict Dict416Data = {
 28,
 Dict416TagHashTable,
 Dict416KeyHashTable,
-Dict416Contents
+Dict416Contents,
+NULL,
+NULL
 };
 
 // ----- BioPri -----
@@ -25157,7 +25989,9 @@ vtkDICOMDictionary::Dict Dict417Data = {
 10,
 Dict417TagHashTable,
 Dict417KeyHashTable,
-Dict417Contents
+Dict417Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_FUNCTOOL_01 -----
@@ -25201,7 +26035,9 @@ vtkDICOMDictionary::Dict Dict418Data = {
 13,
 Dict418TagHashTable,
 Dict418KeyHashTable,
-Dict418Contents
+Dict418Contents,
+NULL,
+NULL
 };
 
 // ----- Vital Images SW 3.4 -----
@@ -25249,7 +26085,9 @@ vtkDICOMDictionary::Dict Dict419Data = {
 16,
 Dict419TagHashTable,
 Dict419KeyHashTable,
-Dict419Contents
+Dict419Contents,
+NULL,
+NULL
 };
 
 // ----- AMI Annotations_01 -----
@@ -25272,7 +26110,9 @@ vtkDICOMDictionary::Dict Dict420Data = {
 1,
 Dict420TagHashTable,
 Dict420KeyHashTable,
-Dict420Contents
+Dict420Contents,
+NULL,
+NULL
 };
 
 // ----- CAMTRONICS -----
@@ -25305,7 +26145,9 @@ vtkDICOMDictionary::Dict Dict421Data = {
 7,
 Dict421TagHashTable,
 Dict421KeyHashTable,
-Dict421Contents
+Dict421Contents,
+NULL,
+NULL
 };
 
 // ----- Applicare/Print/Version 5.1 -----
@@ -25342,7 +26184,9 @@ vtkDICOMDictionary::Dict Dict422Data = {
 9,
 Dict422TagHashTable,
 Dict422KeyHashTable,
-Dict422Contents
+Dict422Contents,
+NULL,
+NULL
 };
 
 // ----- GEHC_CT_ADVAPP_001 -----
@@ -25471,7 +26315,9 @@ vtkDICOMDictionary::Dict Dict423Data = {
 62,
 Dict423TagHashTable,
 Dict423KeyHashTable,
-Dict423Contents
+Dict423Contents,
+NULL,
+NULL
 };
 
 // ----- NUD_PRIVATE -----
@@ -25495,7 +26341,9 @@ vtkDICOMDictionary::Dict Dict424Data = {
 2,
 Dict424TagHashTable,
 Dict424KeyHashTable,
-Dict424Contents
+Dict424Contents,
+NULL,
+NULL
 };
 
 // ----- astm.org/diconde/iod/NdeCtCalibrationData -----
@@ -25538,7 +26386,9 @@ vtkDICOMDictionary::Dict Dict425Data = {
 13,
 Dict425TagHashTable,
 Dict425KeyHashTable,
-Dict425Contents
+Dict425Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P-Private-CWS Release 1 -----
@@ -25565,7 +26415,9 @@ vtkDICOMDictionary::Dict Dict426Data = {
 3,
 Dict426TagHashTable,
 Dict426KeyHashTable,
-Dict426Contents
+Dict426Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_SENO_02 -----
@@ -25752,7 +26604,9 @@ vtkDICOMDictionary::Dict Dict427Data = {
 95,
 Dict427TagHashTable,
 Dict427KeyHashTable,
-Dict427Contents
+Dict427Contents,
+NULL,
+NULL
 };
 
 // ----- BioPri3D -----
@@ -25803,7 +26657,9 @@ vtkDICOMDictionary::Dict Dict428Data = {
 18,
 Dict428TagHashTable,
 Dict428KeyHashTable,
-Dict428Contents
+Dict428Contents,
+NULL,
+NULL
 };
 
 // ----- TOSHIBA_SR -----
@@ -25827,7 +26683,9 @@ vtkDICOMDictionary::Dict Dict429Data = {
 2,
 Dict429TagHashTable,
 Dict429KeyHashTable,
-Dict429Contents
+Dict429Contents,
+NULL,
+NULL
 };
 
 // ----- DIDI TO PCR 1.1 -----
@@ -25921,7 +26779,9 @@ vtkDICOMDictionary::Dict Dict430Data = {
 42,
 Dict430TagHashTable,
 Dict430KeyHashTable,
-Dict430Contents
+Dict430Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MEDCOM OOG -----
@@ -25948,7 +26808,9 @@ vtkDICOMDictionary::Dict Dict431Data = {
 3,
 Dict431TagHashTable,
 Dict431KeyHashTable,
-Dict431Contents
+Dict431Contents,
+NULL,
+NULL
 };
 
 // ----- astm.org/diconde/iod/NdeDxDetector -----
@@ -25981,7 +26843,9 @@ vtkDICOMDictionary::Dict Dict432Data = {
 7,
 Dict432TagHashTable,
 Dict432KeyHashTable,
-Dict432Contents
+Dict432Contents,
+NULL,
+NULL
 };
 
 // ----- PMTF INFORMATION DATA -----
@@ -26015,7 +26879,9 @@ vtkDICOMDictionary::Dict Dict433Data = {
 8,
 Dict433TagHashTable,
 Dict433KeyHashTable,
-Dict433Contents
+Dict433Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MED DISPLAY -----
@@ -26061,7 +26927,9 @@ vtkDICOMDictionary::Dict Dict434Data = {
 14,
 Dict434TagHashTable,
 Dict434KeyHashTable,
-Dict434Contents
+Dict434Contents,
+NULL,
+NULL
 };
 
 // ----- MITRA LINKED ATTRIBUTES 1.0 -----
@@ -26084,7 +26952,9 @@ vtkDICOMDictionary::Dict Dict435Data = {
 1,
 Dict435TagHashTable,
 Dict435KeyHashTable,
-Dict435Contents
+Dict435Contents,
+NULL,
+NULL
 };
 
 // ----- BRIT Systems, Inc. -----
@@ -26208,7 +27078,9 @@ vtkDICOMDictionary::Dict Dict436Data = {
 59,
 Dict436TagHashTable,
 Dict436KeyHashTable,
-Dict436Contents
+Dict436Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS CT VA0  RAW -----
@@ -26245,7 +27117,9 @@ vtkDICOMDictionary::Dict Dict437Data = {
 9,
 Dict437TagHashTable,
 Dict437KeyHashTable,
-Dict437Contents
+Dict437Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P Release 2;1 -----
@@ -26272,7 +27146,9 @@ vtkDICOMDictionary::Dict Dict438Data = {
 3,
 Dict438TagHashTable,
 Dict438KeyHashTable,
-Dict438Contents
+Dict438Contents,
+NULL,
+NULL
 };
 
 // ----- SPI RELEASE 1 -----
@@ -26307,7 +27183,9 @@ vtkDICOMDictionary::Dict Dict439Data = {
 8,
 Dict439TagHashTable,
 Dict439KeyHashTable,
-Dict439Contents
+Dict439Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MI RWVM SUV -----
@@ -26330,7 +27208,9 @@ vtkDICOMDictionary::Dict Dict440Data = {
 1,
 Dict440TagHashTable,
 Dict440KeyHashTable,
-Dict440Contents
+Dict440Contents,
+NULL,
+NULL
 };
 
 // ----- MeVis eD: Slice Information -----
@@ -26353,7 +27233,9 @@ vtkDICOMDictionary::Dict Dict441Data = {
 1,
 Dict441TagHashTable,
 Dict441KeyHashTable,
-Dict441Contents
+Dict441Contents,
+NULL,
+NULL
 };
 
 // ----- AGFA PACS Archive Mirroring 1.0 -----
@@ -26377,7 +27259,9 @@ vtkDICOMDictionary::Dict Dict442Data = {
 2,
 Dict442TagHashTable,
 Dict442KeyHashTable,
-Dict442Contents
+Dict442Contents,
+NULL,
+NULL
 };
 
 // ----- Brainlab-S23-ProjectiveFusion -----
@@ -26400,7 +27284,9 @@ vtkDICOMDictionary::Dict Dict443Data = {
 1,
 Dict443TagHashTable,
 Dict443KeyHashTable,
-Dict443Contents
+Dict443Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P Release 1;3 -----
@@ -26438,7 +27324,9 @@ vtkDICOMDictionary::Dict Dict444Data = {
 10,
 Dict444TagHashTable,
 Dict444KeyHashTable,
-Dict444Contents
+Dict444Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P Release 1;2 -----
@@ -26467,7 +27355,9 @@ vtkDICOMDictionary::Dict Dict445Data = {
 5,
 Dict445TagHashTable,
 Dict445KeyHashTable,
-Dict445Contents
+Dict445Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P Release 1;1 -----
@@ -26551,7 +27441,9 @@ vtkDICOMDictionary::Dict Dict446Data = {
 36,
 Dict446TagHashTable,
 Dict446KeyHashTable,
-Dict446Contents
+Dict446Contents,
+NULL,
+NULL
 };
 
 // ----- SPI-P-PCR Release 2 -----
@@ -26628,7 +27520,9 @@ vtkDICOMDictionary::Dict Dict447Data = {
 33,
 Dict447TagHashTable,
 Dict447KeyHashTable,
-Dict447Contents
+Dict447Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MR PHOENIX ATTRIBUTES -----
@@ -26656,7 +27550,9 @@ vtkDICOMDictionary::Dict Dict448Data = {
 4,
 Dict448TagHashTable,
 Dict448KeyHashTable,
-Dict448Contents
+Dict448Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MR SDI 02 -----
@@ -26835,7 +27731,9 @@ vtkDICOMDictionary::Dict Dict449Data = {
 91,
 Dict449TagHashTable,
 Dict449KeyHashTable,
-Dict449Contents
+Dict449Contents,
+NULL,
+NULL
 };
 
 // ----- Biospace Med : EOS Tag -----
@@ -26893,7 +27791,9 @@ vtkDICOMDictionary::Dict Dict450Data = {
 21,
 Dict450TagHashTable,
 Dict450KeyHashTable,
-Dict450Contents
+Dict450Contents,
+NULL,
+NULL
 };
 
 // ----- AMI ImageContextExt_01 -----
@@ -26917,7 +27817,9 @@ vtkDICOMDictionary::Dict Dict451Data = {
 2,
 Dict451TagHashTable,
 Dict451KeyHashTable,
-Dict451Contents
+Dict451Contents,
+NULL,
+NULL
 };
 
 // ----- IMS s.r.l. Biopsy Private Code -----
@@ -26954,7 +27856,9 @@ vtkDICOMDictionary::Dict Dict452Data = {
 9,
 Dict452TagHashTable,
 Dict452KeyHashTable,
-Dict452Contents
+Dict452Contents,
+NULL,
+NULL
 };
 
 // ----- PMI Private Calibration Module Version 2.0 -----
@@ -26998,7 +27902,9 @@ vtkDICOMDictionary::Dict Dict453Data = {
 13,
 Dict453TagHashTable,
 Dict453KeyHashTable,
-Dict453Contents
+Dict453Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_ADWSoft_3D1 -----
@@ -27110,7 +28016,9 @@ vtkDICOMDictionary::Dict Dict454Data = {
 52,
 Dict454TagHashTable,
 Dict454KeyHashTable,
-Dict454Contents
+Dict454Contents,
+NULL,
+NULL
 };
 
 // ----- INFINITT_FMX -----
@@ -27134,7 +28042,9 @@ vtkDICOMDictionary::Dict Dict455Data = {
 2,
 Dict455TagHashTable,
 Dict455KeyHashTable,
-Dict455Contents
+Dict455Contents,
+NULL,
+NULL
 };
 
 // ----- PRIVATE_CODE_STRING_1001 -----
@@ -27272,7 +28182,9 @@ vtkDICOMDictionary::Dict Dict456Data = {
 67,
 Dict456TagHashTable,
 Dict456KeyHashTable,
-Dict456Contents
+Dict456Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MR SDS 01 -----
@@ -27446,7 +28358,9 @@ vtkDICOMDictionary::Dict Dict457Data = {
 90,
 Dict457TagHashTable,
 Dict457KeyHashTable,
-Dict457Contents
+Dict457Contents,
+NULL,
+NULL
 };
 
 // ----- GEMS_RELA_01 -----
@@ -27538,7 +28452,9 @@ vtkDICOMDictionary::Dict Dict458Data = {
 41,
 Dict458TagHashTable,
 Dict458KeyHashTable,
-Dict458Contents
+Dict458Contents,
+NULL,
+NULL
 };
 
 // ----- SIEMENS MR MRS 05 -----
@@ -27587,7 +28503,9 @@ vtkDICOMDictionary::Dict Dict459Data = {
 16,
 Dict459TagHashTable,
 Dict459KeyHashTable,
-Dict459Contents
+Dict459Contents,
+NULL,
+NULL
 };
 
 // ----- TOSHIBA_MEC_CT_1.0 -----
@@ -27652,7 +28570,9 @@ vtkDICOMDictionary::Dict Dict460Data = {
 26,
 Dict460TagHashTable,
 Dict460KeyHashTable,
-Dict460Contents
+Dict460Contents,
+NULL,
+NULL
 };
 
 // ----- SPI Release 1 -----
@@ -27689,103 +28609,106 @@ vtkDICOMDictionary::Dict Dict461Data = {
 9,
 Dict461TagHashTable,
 Dict461KeyHashTable,
-Dict461Contents
+Dict461Contents,
+NULL,
+NULL
 };
 
+// sorted by name, for vtkDICOMDictionary::AddPrivateDictionaryList()
 vtkDICOMDictionary::Dict *PrivateDictData[] = {
-&Dict001Data, &Dict002Data, &Dict003Data, &Dict004Data, &Dict005Data,
-&Dict006Data, &Dict007Data, &Dict008Data, &Dict009Data, &Dict010Data,
-&Dict011Data, &Dict012Data, &Dict013Data, &Dict014Data, &Dict015Data,
-&Dict016Data, &Dict017Data, &Dict018Data, &Dict019Data, &Dict020Data,
-&Dict021Data, &Dict022Data, &Dict023Data, &Dict024Data, &Dict025Data,
-&Dict026Data, &Dict027Data, &Dict028Data, &Dict029Data, &Dict030Data,
-&Dict031Data, &Dict032Data, &Dict033Data, &Dict034Data, &Dict035Data,
-&Dict036Data, &Dict037Data, &Dict038Data, &Dict039Data, &Dict040Data,
-&Dict041Data, &Dict042Data, &Dict043Data, &Dict044Data, &Dict045Data,
-&Dict046Data, &Dict047Data, &Dict048Data, &Dict049Data, &Dict050Data,
-&Dict051Data, &Dict052Data, &Dict053Data, &Dict054Data, &Dict055Data,
-&Dict056Data, &Dict057Data, &Dict058Data, &Dict059Data, &Dict060Data,
-&Dict061Data, &Dict062Data, &Dict063Data, &Dict064Data, &Dict065Data,
-&Dict066Data, &Dict067Data, &Dict068Data, &Dict069Data, &Dict070Data,
-&Dict071Data, &Dict072Data, &Dict073Data, &Dict074Data, &Dict075Data,
-&Dict076Data, &Dict077Data, &Dict078Data, &Dict079Data, &Dict080Data,
-&Dict081Data, &Dict082Data, &Dict083Data, &Dict084Data, &Dict085Data,
-&Dict086Data, &Dict087Data, &Dict088Data, &Dict089Data, &Dict090Data,
-&Dict091Data, &Dict092Data, &Dict093Data, &Dict094Data, &Dict095Data,
-&Dict096Data, &Dict097Data, &Dict098Data, &Dict099Data, &Dict100Data,
-&Dict101Data, &Dict102Data, &Dict103Data, &Dict104Data, &Dict105Data,
-&Dict106Data, &Dict107Data, &Dict108Data, &Dict109Data, &Dict110Data,
-&Dict111Data, &Dict112Data, &Dict113Data, &Dict114Data, &Dict115Data,
-&Dict116Data, &Dict117Data, &Dict118Data, &Dict119Data, &Dict120Data,
-&Dict121Data, &Dict122Data, &Dict123Data, &Dict124Data, &Dict125Data,
-&Dict126Data, &Dict127Data, &Dict128Data, &Dict129Data, &Dict130Data,
-&Dict131Data, &Dict132Data, &Dict133Data, &Dict134Data, &Dict135Data,
-&Dict136Data, &Dict137Data, &Dict138Data, &Dict139Data, &Dict140Data,
-&Dict141Data, &Dict142Data, &Dict143Data, &Dict144Data, &Dict145Data,
-&Dict146Data, &Dict147Data, &Dict148Data, &Dict149Data, &Dict150Data,
-&Dict151Data, &Dict152Data, &Dict153Data, &Dict154Data, &Dict155Data,
-&Dict156Data, &Dict157Data, &Dict158Data, &Dict159Data, &Dict160Data,
-&Dict161Data, &Dict162Data, &Dict163Data, &Dict164Data, &Dict165Data,
-&Dict166Data, &Dict167Data, &Dict168Data, &Dict169Data, &Dict170Data,
-&Dict171Data, &Dict172Data, &Dict173Data, &Dict174Data, &Dict175Data,
-&Dict176Data, &Dict177Data, &Dict178Data, &Dict179Data, &Dict180Data,
-&Dict181Data, &Dict182Data, &Dict183Data, &Dict184Data, &Dict185Data,
-&Dict186Data, &Dict187Data, &Dict188Data, &Dict189Data, &Dict190Data,
-&Dict191Data, &Dict192Data, &Dict193Data, &Dict194Data, &Dict195Data,
-&Dict196Data, &Dict197Data, &Dict198Data, &Dict199Data, &Dict200Data,
-&Dict201Data, &Dict202Data, &Dict203Data, &Dict204Data, &Dict205Data,
-&Dict206Data, &Dict207Data, &Dict208Data, &Dict209Data, &Dict210Data,
-&Dict211Data, &Dict212Data, &Dict213Data, &Dict214Data, &Dict215Data,
-&Dict216Data, &Dict217Data, &Dict218Data, &Dict219Data, &Dict220Data,
-&Dict221Data, &Dict222Data, &Dict223Data, &Dict224Data, &Dict225Data,
-&Dict226Data, &Dict227Data, &Dict228Data, &Dict229Data, &Dict230Data,
-&Dict231Data, &Dict232Data, &Dict233Data, &Dict234Data, &Dict235Data,
-&Dict236Data, &Dict237Data, &Dict238Data, &Dict239Data, &Dict240Data,
-&Dict241Data, &Dict242Data, &Dict243Data, &Dict244Data, &Dict245Data,
-&Dict246Data, &Dict247Data, &Dict248Data, &Dict249Data, &Dict250Data,
-&Dict251Data, &Dict252Data, &Dict253Data, &Dict254Data, &Dict255Data,
-&Dict256Data, &Dict257Data, &Dict258Data, &Dict259Data, &Dict260Data,
-&Dict261Data, &Dict262Data, &Dict263Data, &Dict264Data, &Dict265Data,
-&Dict266Data, &Dict267Data, &Dict268Data, &Dict269Data, &Dict270Data,
-&Dict271Data, &Dict272Data, &Dict273Data, &Dict274Data, &Dict275Data,
-&Dict276Data, &Dict277Data, &Dict278Data, &Dict279Data, &Dict280Data,
-&Dict281Data, &Dict282Data, &Dict283Data, &Dict284Data, &Dict285Data,
-&Dict286Data, &Dict287Data, &Dict288Data, &Dict289Data, &Dict290Data,
-&Dict291Data, &Dict292Data, &Dict293Data, &Dict294Data, &Dict295Data,
-&Dict296Data, &Dict297Data, &Dict298Data, &Dict299Data, &Dict300Data,
-&Dict301Data, &Dict302Data, &Dict303Data, &Dict304Data, &Dict305Data,
-&Dict306Data, &Dict307Data, &Dict308Data, &Dict309Data, &Dict310Data,
-&Dict311Data, &Dict312Data, &Dict313Data, &Dict314Data, &Dict315Data,
-&Dict316Data, &Dict317Data, &Dict318Data, &Dict319Data, &Dict320Data,
-&Dict321Data, &Dict322Data, &Dict323Data, &Dict324Data, &Dict325Data,
-&Dict326Data, &Dict327Data, &Dict328Data, &Dict329Data, &Dict330Data,
-&Dict331Data, &Dict332Data, &Dict333Data, &Dict334Data, &Dict335Data,
-&Dict336Data, &Dict337Data, &Dict338Data, &Dict339Data, &Dict340Data,
-&Dict341Data, &Dict342Data, &Dict343Data, &Dict344Data, &Dict345Data,
-&Dict346Data, &Dict347Data, &Dict348Data, &Dict349Data, &Dict350Data,
-&Dict351Data, &Dict352Data, &Dict353Data, &Dict354Data, &Dict355Data,
-&Dict356Data, &Dict357Data, &Dict358Data, &Dict359Data, &Dict360Data,
-&Dict361Data, &Dict362Data, &Dict363Data, &Dict364Data, &Dict365Data,
-&Dict366Data, &Dict367Data, &Dict368Data, &Dict369Data, &Dict370Data,
-&Dict371Data, &Dict372Data, &Dict373Data, &Dict374Data, &Dict375Data,
-&Dict376Data, &Dict377Data, &Dict378Data, &Dict379Data, &Dict380Data,
-&Dict381Data, &Dict382Data, &Dict383Data, &Dict384Data, &Dict385Data,
-&Dict386Data, &Dict387Data, &Dict388Data, &Dict389Data, &Dict390Data,
-&Dict391Data, &Dict392Data, &Dict393Data, &Dict394Data, &Dict395Data,
-&Dict396Data, &Dict397Data, &Dict398Data, &Dict399Data, &Dict400Data,
-&Dict401Data, &Dict402Data, &Dict403Data, &Dict404Data, &Dict405Data,
-&Dict406Data, &Dict407Data, &Dict408Data, &Dict409Data, &Dict410Data,
-&Dict411Data, &Dict412Data, &Dict413Data, &Dict414Data, &Dict415Data,
-&Dict416Data, &Dict417Data, &Dict418Data, &Dict419Data, &Dict420Data,
-&Dict421Data, &Dict422Data, &Dict423Data, &Dict424Data, &Dict425Data,
-&Dict426Data, &Dict427Data, &Dict428Data, &Dict429Data, &Dict430Data,
-&Dict431Data, &Dict432Data, &Dict433Data, &Dict434Data, &Dict435Data,
-&Dict436Data, &Dict437Data, &Dict438Data, &Dict439Data, &Dict440Data,
-&Dict441Data, &Dict442Data, &Dict443Data, &Dict444Data, &Dict445Data,
-&Dict446Data, &Dict447Data, &Dict448Data, &Dict449Data, &Dict450Data,
-&Dict451Data, &Dict452Data, &Dict453Data, &Dict454Data, &Dict455Data,
-&Dict456Data, &Dict457Data, &Dict458Data, &Dict459Data, &Dict460Data,
-&Dict461Data, NULL
+&Dict387Data, &Dict394Data, &Dict218Data, &Dict338Data, &Dict255Data,
+&Dict030Data, &Dict292Data, &Dict206Data, &Dict090Data, &Dict401Data,
+&Dict243Data, &Dict442Data, &Dict197Data, &Dict104Data, &Dict420Data,
+&Dict035Data, &Dict451Data, &Dict336Data, &Dict202Data, &Dict201Data,
+&Dict289Data, &Dict290Data, &Dict177Data, &Dict282Data, &Dict169Data,
+&Dict133Data, &Dict150Data, &Dict016Data, &Dict216Data, &Dict005Data,
+&Dict422Data, &Dict280Data, &Dict284Data, &Dict108Data, &Dict390Data,
+&Dict158Data, &Dict287Data, &Dict436Data, &Dict417Data, &Dict428Data,
+&Dict246Data, &Dict450Data, &Dict147Data, &Dict312Data, &Dict443Data,
+&Dict366Data, &Dict078Data, &Dict332Data, &Dict421Data, &Dict270Data,
+&Dict391Data, &Dict113Data, &Dict023Data, &Dict373Data, &Dict069Data,
+&Dict309Data, &Dict371Data, &Dict043Data, &Dict022Data, &Dict430Data,
+&Dict126Data, &Dict403Data, &Dict225Data, &Dict385Data, &Dict175Data,
+&Dict194Data, &Dict062Data, &Dict173Data, &Dict077Data, &Dict257Data,
+&Dict232Data, &Dict185Data, &Dict304Data, &Dict081Data, &Dict064Data,
+&Dict258Data, &Dict014Data, &Dict291Data, &Dict423Data, &Dict007Data,
+&Dict162Data, &Dict396Data, &Dict359Data, &Dict349Data, &Dict356Data,
+&Dict221Data, &Dict009Data, &Dict011Data, &Dict010Data, &Dict346Data,
+&Dict347Data, &Dict348Data, &Dict454Data, &Dict231Data, &Dict101Data,
+&Dict155Data, &Dict236Data, &Dict050Data, &Dict313Data, &Dict378Data,
+&Dict288Data, &Dict306Data, &Dict184Data, &Dict377Data, &Dict370Data,
+&Dict114Data, &Dict190Data, &Dict179Data, &Dict418Data, &Dict328Data,
+&Dict372Data, &Dict027Data, &Dict116Data, &Dict411Data, &Dict052Data,
+&Dict171Data, &Dict004Data, &Dict220Data, &Dict222Data, &Dict300Data,
+&Dict123Data, &Dict086Data, &Dict363Data, &Dict188Data, &Dict458Data,
+&Dict156Data, &Dict187Data, &Dict427Data, &Dict334Data, &Dict326Data,
+&Dict128Data, &Dict367Data, &Dict112Data, &Dict271Data, &Dict149Data,
+&Dict003Data, &Dict340Data, &Dict361Data, &Dict405Data, &Dict204Data,
+&Dict345Data, &Dict176Data, &Dict080Data, &Dict399Data, &Dict398Data,
+&Dict260Data, &Dict026Data, &Dict376Data, &Dict315Data, &Dict452Data,
+&Dict266Data, &Dict455Data, &Dict061Data, &Dict055Data, &Dict342Data,
+&Dict189Data, &Dict239Data, &Dict134Data, &Dict059Data, &Dict186Data,
+&Dict215Data, &Dict161Data, &Dict117Data, &Dict392Data, &Dict039Data,
+&Dict305Data, &Dict293Data, &Dict044Data, &Dict020Data, &Dict226Data,
+&Dict210Data, &Dict131Data, &Dict410Data, &Dict343Data, &Dict435Data,
+&Dict278Data, &Dict227Data, &Dict272Data, &Dict127Data, &Dict269Data,
+&Dict314Data, &Dict018Data, &Dict122Data, &Dict091Data, &Dict211Data,
+&Dict441Data, &Dict259Data, &Dict125Data, &Dict087Data, &Dict166Data,
+&Dict364Data, &Dict136Data, &Dict092Data, &Dict330Data, &Dict424Data,
+&Dict247Data, &Dict159Data, &Dict355Data, &Dict261Data, &Dict028Data,
+&Dict329Data, &Dict121Data, &Dict360Data, &Dict102Data, &Dict409Data,
+&Dict298Data, &Dict089Data, &Dict183Data, &Dict307Data, &Dict182Data,
+&Dict181Data, &Dict046Data, &Dict084Data, &Dict130Data, &Dict275Data,
+&Dict277Data, &Dict453Data, &Dict048Data, &Dict053Data, &Dict074Data,
+&Dict433Data, &Dict071Data, &Dict170Data, &Dict163Data, &Dict456Data,
+&Dict157Data, &Dict301Data, &Dict318Data, &Dict213Data, &Dict214Data,
+&Dict404Data, &Dict402Data, &Dict262Data, &Dict264Data, &Dict073Data,
+&Dict072Data, &Dict031Data, &Dict208Data, &Dict029Data, &Dict033Data,
+&Dict032Data, &Dict008Data, &Dict395Data, &Dict141Data, &Dict384Data,
+&Dict297Data, &Dict070Data, &Dict253Data, &Dict273Data, &Dict118Data,
+&Dict058Data, &Dict254Data, &Dict199Data, &Dict283Data, &Dict350Data,
+&Dict191Data, &Dict344Data, &Dict195Data, &Dict223Data, &Dict374Data,
+&Dict165Data, &Dict311Data, &Dict353Data, &Dict203Data, &Dict320Data,
+&Dict256Data, &Dict265Data, &Dict400Data, &Dict351Data, &Dict229Data,
+&Dict054Data, &Dict196Data, &Dict088Data, &Dict180Data, &Dict042Data,
+&Dict321Data, &Dict209Data, &Dict230Data, &Dict357Data, &Dict021Data,
+&Dict414Data, &Dict252Data, &Dict137Data, &Dict068Data, &Dict120Data,
+&Dict097Data, &Dict164Data, &Dict140Data, &Dict294Data, &Dict437Data,
+&Dict416Data, &Dict135Data, &Dict152Data, &Dict132Data, &Dict056Data,
+&Dict168Data, &Dict079Data, &Dict408Data, &Dict235Data, &Dict434Data,
+&Dict295Data, &Dict296Data, &Dict413Data, &Dict310Data, &Dict276Data,
+&Dict049Data, &Dict153Data, &Dict388Data, &Dict193Data, &Dict076Data,
+&Dict234Data, &Dict325Data, &Dict274Data, &Dict393Data, &Dict075Data,
+&Dict383Data, &Dict109Data, &Dict368Data, &Dict207Data, &Dict431Data,
+&Dict440Data, &Dict380Data, &Dict228Data, &Dict160Data, &Dict242Data,
+&Dict233Data, &Dict459Data, &Dict308Data, &Dict448Data, &Dict110Data,
+&Dict449Data, &Dict457Data, &Dict362Data, &Dict375Data, &Dict041Data,
+&Dict057Data, &Dict017Data, &Dict322Data, &Dict323Data, &Dict339Data,
+&Dict174Data, &Dict019Data, &Dict105Data, &Dict248Data, &Dict015Data,
+&Dict142Data, &Dict212Data, &Dict268Data, &Dict386Data, &Dict240Data,
+&Dict369Data, &Dict379Data, &Dict063Data, &Dict066Data, &Dict238Data,
+&Dict040Data, &Dict406Data, &Dict138Data, &Dict200Data, &Dict082Data,
+&Dict145Data, &Dict025Data, &Dict107Data, &Dict060Data, &Dict303Data,
+&Dict217Data, &Dict381Data, &Dict047Data, &Dict279Data, &Dict249Data,
+&Dict167Data, &Dict013Data, &Dict439Data, &Dict461Data, &Dict317Data,
+&Dict446Data, &Dict445Data, &Dict444Data, &Dict438Data, &Dict341Data,
+&Dict106Data, &Dict100Data, &Dict447Data, &Dict426Data, &Dict178Data,
+&Dict245Data, &Dict143Data, &Dict198Data, &Dict096Data, &Dict095Data,
+&Dict094Data, &Dict099Data, &Dict098Data, &Dict154Data, &Dict337Data,
+&Dict354Data, &Dict002Data, &Dict038Data, &Dict237Data, &Dict012Data,
+&Dict085Data, &Dict331Data, &Dict281Data, &Dict139Data, &Dict244Data,
+&Dict251Data, &Dict412Data, &Dict146Data, &Dict172Data, &Dict267Data,
+&Dict324Data, &Dict115Data, &Dict352Data, &Dict083Data, &Dict302Data,
+&Dict036Data, &Dict327Data, &Dict037Data, &Dict319Data, &Dict219Data,
+&Dict192Data, &Dict382Data, &Dict250Data, &Dict460Data, &Dict006Data,
+&Dict263Data, &Dict429Data, &Dict111Data, &Dict389Data, &Dict333Data,
+&Dict119Data, &Dict129Data, &Dict205Data, &Dict316Data, &Dict124Data,
+&Dict151Data, &Dict415Data, &Dict407Data, &Dict419Data, &Dict285Data,
+&Dict001Data, &Dict365Data, &Dict051Data, &Dict358Data, &Dict065Data,
+&Dict286Data, &Dict425Data, &Dict224Data, &Dict144Data, &Dict148Data,
+&Dict432Data, &Dict299Data, &Dict335Data, &Dict241Data, &Dict034Data,
+&Dict045Data, &Dict067Data, &Dict103Data, &Dict093Data, &Dict024Data,
+&Dict397Data, NULL
 };
 
 } // end anonymous namespace
@@ -27796,10 +28719,8 @@ vtkDICOMDictPrivateInitializer::vtkDICOMDictPrivateInitializer()
 {
   if (vtkDICOMDictPrivateInitializerCounter++ == 0)
   {
-    for (vtkDICOMDictionary::Dict **dp = PrivateDictData; *dp != NULL; dp++)
-    {
-      vtkDICOMDictionary::AddPrivateDictionary(*dp);
-    }
+    // the dictionaries are added on demand, when first looked up
+    vtkDICOMDictionary::AddPrivateDictionaryList(PrivateDictData);
   }
 }
 
@@ -27807,9 +28728,6 @@ vtkDICOMDictPrivateInitializer::~vtkDICOMDictPrivateInitializer()
 {
   if (--vtkDICOMDictPrivateInitializerCounter == 0)
   {
-    for (vtkDICOMDictionary::Dict **dp = PrivateDictData; *dp != NULL; dp++)
-    {
-     vtkDICOMDictionary::RemovePrivateDictionary((*dp)->Name);
-    }
+    vtkDICOMDictionary::RemovePrivateDictionaryList(PrivateDictData);
   }
 }
@@ -16,12 +16,17 @@
 #include "vtkDICOMVM.h"
 #include "vtkDICOMTag.h"
 #include "vtkDICOMDictEntry.h"
+#include "vtkDICOMReferenceCount.h"
 
 // Including this forces the loading of the private dictionaries.
 #include "vtkDICOMDictPrivate.h"
 
+#include "vtkMutexLock.h"
+
 #include <string.h>
 
+#include <vector>
+
 //----------------------------------------------------------------------------
 struct vtkDICOMDictionary::DictHashEntry
 {
@@ -32,6 +37,29 @@ struct vtkDICOMDictionary::DictHashEntry
 vtkDICOMDictionary::DictHashEntry *
   vtkDICOMDictionary::PrivateDictTable[DICT_PRIVATE_TABLE_SIZE];
 
+//----------------------------------------------------------------------------
+// A list of dictionaries that are added to PrivateDictTable on demand.
+// The lists are never freed until exit, so they can be read without a lock.
+struct vtkDICOMDictionary::DictList
+{
+  vtkDICOMDictionary::Dict **Dicts;
+  int Size;
+  bool Removed;
+  // for each dict, whether it has been added or removed (or null)
+  char *Claimed;
+  DictList *Next;
+};
+
+vtkDICOMDictionary::DictList *vtkDICOMDictionary::PrivateDictLists;
+
+// The rows of PrivateDictTable are never modified after they are stored
+// in the table, instead they are replaced, so that the table can be read
+// without a lock.  Replaced rows are kept until the program exits, since
+// other threads might still be reading them.
+static vtkSimpleMutexLock *vtkDICOMDictionaryLock;
+static std::vector<vtkDICOMDictionary::DictHashEntry *> *
+  vtkDICOMDictionaryRetiredRows;
+
 //----------------------------------------------------------------------------
 // A helper class to delete static variables when program exits.
 static unsigned int vtkDICOMDictionaryInitializerCounter;
@@ -45,6 +73,10 @@ vtkDICOMDictionaryInitializer::vtkDICOMDictionaryInitializer()
     {
       vtkDICOMDictionary::PrivateDictTable[i] = 0;
     }
+    vtkDICOMDictionaryLock = new vtkSimpleMutexLock;
+    vtkDICOMDictionaryRetiredRows =
+      new std::vector<vtkDICOMDictionary::DictHashEntry *>;
+    vtkDICOMDictionary::PrivateDictLists = 0;
   }
 }
 
@@ -56,7 +88,23 @@ vtkDICOMDictionaryInitializer::~vtkDICOMDictionaryInitializer()
     for (int i = 0; i < DICT_PRIVATE_TABLE_SIZE; i++)
     {
       delete [] vtkDICOMDictionary::PrivateDictTable[i];
+      vtkDICOMDictionary::PrivateDictTable[i] = 0;
     }
+    for (size_t j = 0; j < vtkDICOMDictionaryRetiredRows->size(); j++)
+    {
+      delete [] (*vtkDICOMDictionaryRetiredRows)[j];
+    }
+    delete vtkDICOMDictionaryRetiredRows;
+    vtkDICOMDictionary::DictList *l = vtkDICOMDictionary::PrivateDictLists;
+    while (l)
+    {
+      vtkDICOMDictionary::DictList *next = l->Next;
+      delete [] l->Claimed;
+      delete l;
+      l = next;
+    }
+    vtkDICOMDictionary::PrivateDictLists = 0;
+    delete vtkDICOMDictionaryLock;
   }
 }
 
@@ -89,19 +137,13 @@ unsigned int vtkDICOMDictionary::HashLongString(
 }
 
 //----------------------------------------------------------------------------
-vtkDICOMDictionary::Dict *vtkDICOMDictionary::FindPrivateDict(
-  const char *name)
+vtkDICOMDictionary::Dict *vtkDICOMDictionary::LookupPrivateDict(
+  const char stripname[64], unsigned int h)
 {
   unsigned int m = DICT_PRIVATE_TABLE_SIZE - 1;
-  DictHashEntry **htable = vtkDICOMDictionary::PrivateDictTable;
-  DictHashEntry *hptr;
+  DictHashEntry *hptr = vtkDICOMDictionary::PrivateDictTable[h & m];
 
-  // strip trailing spaces and compute the hash
-  char stripname[64];
-  unsigned int h = vtkDICOMDictionary::HashLongString(name, stripname);
-  unsigned int i = (h & m);
-
-  if (htable && (hptr = htable[i]) != NULL)
+  if (hptr != NULL)
   {
     while (hptr->Dict != 0)
     {
@@ -117,21 +159,180 @@ vtkDICOMDictionary::Dict *vtkDICOMDictionary::FindPrivateDict(
 }
 
 //----------------------------------------------------------------------------
-vtkDICOMDictEntry vtkDICOMDictionary::FindDictEntry(
-  const vtkDICOMTag tag, const char *dictname)
+vtkDICOMDictionary::Dict *vtkDICOMDictionary::FindPrivateDict(
+  const char *name)
 {
-  unsigned short group = tag.GetGroup();
-  unsigned short element = tag.GetElement();
+  // strip trailing spaces and compute the hash
+  char stripname[64];
+  unsigned int h = vtkDICOMDictionary::HashLongString(name, stripname);
+
+  Dict *dict = vtkDICOMDictionary::LookupPrivateDict(stripname, h);
+  if (dict == 0 && vtkDICOMDictionary::PrivateDictLists != 0)
+  {
+    dict = vtkDICOMDictionary::FindListedDict(name, stripname);
+  }
 
-  // compute the hash table index
-  unsigned int h = tag.ComputeHash();
-  unsigned int i = (h & (DICT_HASH_TABLE_SIZE - 1));
+  return dict;
+}
 
+//----------------------------------------------------------------------------
+namespace {
+
+// Binary search for a dictionary in a sorted list, return -1 if not found.
+int vtkDICOMDictSearchList(
+  vtkDICOMDictionary::Dict **dicts, int n, const char stripname[64])
+{
+  int lo = 0;
+  int hi = n;
+  while (lo < hi)
+  {
+    int mid = (lo + hi)/2;
+    int c = strncmp(stripname, dicts[mid]->Name, 64);
+    if (c == 0)
+    {
+      return mid;
+    }
+    else if (c < 0)
+    {
+      hi = mid;
+    }
+    else
+    {
+      lo = mid + 1;
+    }
+  }
+  return -1;
+}
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+vtkDICOMDictionary::Dict *vtkDICOMDictionary::FindListedDict(
+  const char *name, const char stripname[64])
+{
+  for (DictList *l = vtkDICOMDictionary::PrivateDictLists; l; l = l->Next)
+  {
+    int i = vtkDICOMDictSearchList(l->Dicts, l->Size, stripname);
+    if (i >= 0)
+    {
+      // check again with the lock held, another thread might have added
+      // the dictionary, or the user might have replaced or removed it
+      vtkDICOMDictionaryLock->Lock();
+      char stripped[64];
+      unsigned int h = vtkDICOMDictionary::HashLongString(name, stripped);
+      Dict *dict = vtkDICOMDictionary::LookupPrivateDict(stripped, h);
+      if (dict == 0 && !l->Removed &&
+          (l->Claimed == 0 || l->Claimed[i] == 0))
+      {
+        if (l->Claimed == 0)
+        {
+          l->Claimed = new char[l->Size];
+          memset(l->Claimed, 0, l->Size);
+        }
+        l->Claimed[i] = 1;
+        dict = l->Dicts[i];
+        vtkDICOMDictionary::ReplacePrivateDictionary(dict->Name, dict);
+      }
+      vtkDICOMDictionaryLock->Unlock();
+      if (dict)
+      {
+        return dict;
+      }
+    }
+  }
+
+  return 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDictionary::ClaimListedDict(const char *name)
+{
+  char stripname[64];
+  vtkDICOMDictionary::HashLongString(name, stripname);
+
+  for (DictList *l = vtkDICOMDictionary::PrivateDictLists; l; l = l->Next)
+  {
+    int i = vtkDICOMDictSearchList(l->Dicts, l->Size, stripname);
+    if (i >= 0)
+    {
+      if (l->Claimed == 0)
+      {
+        l->Claimed = new char[l->Size];
+        memset(l->Claimed, 0, l->Size);
+      }
+      l->Claimed[i] = 1;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+namespace {
+
+// Scramble a 32-bit hash value with a multiplicative hash.
+// This must match the perfecthash() function in makedict.py.
+inline unsigned int vtkDICOMPerfectHash(unsigned int x)
+{
+  return x*0x9E3779B1u;
+}
+
+// Look up a hash in a minimal perfect hash table that was generated
+// by makedict.py, and return the index of the only entry that might
+// match, or return 0xFFFF if the table is empty.  The hash is mapped
+// to the range [0,n) with a multiply and shift, instead of a modulus.
+inline unsigned int vtkDICOMPerfectHashLookup(
+  const unsigned short *table, unsigned int x)
+{
+  unsigned int r = table[0];
+  unsigned int m = table[1];
+  if (m == 0)
+  {
+    return 0xFFFF;
+  }
+  unsigned int h = vtkDICOMPerfectHash(x);
+  unsigned int d = table[2 + static_cast<unsigned int>(
+    (static_cast<unsigned long long>(h)*r) >> 32)];
+  // if high bit is set, the bucket has one key that is stored directly,
+  // otherwise the displacement is mixed into the hash (see perfectslot()
+  // in makedict.py), both are computed to avoid an unpredictable branch
+  unsigned int k1 = (d & 0x7FFF);
+  unsigned int k2 = static_cast<unsigned int>(
+    (static_cast<unsigned long long>((h ^ d)*0x85EBCA6Bu)*m) >> 32);
+  return table[2 + r + ((d & 0x8000) != 0 ? k1 : k2)];
+}
+
+// Look up a tag in the ordered perfect hash table that was generated by
+// makedict.py, and return the index of the only entry that might match.
+// The group is scrambled but the element is not, so the elements of a
+// group fall into consecutive buckets, and each bucket's slots follow
+// those of the previous bucket, which keeps in-order lookups local.
+// This must match tagbucket() and orderedslot() in makedict.py.
+inline unsigned int vtkDICOMOrderedHashLookup(
+  const unsigned short *table, vtkDICOMTag tag)
+{
+  unsigned int r = table[0];
+  unsigned int e = tag.GetElement();
+  unsigned int b = ((vtkDICOMPerfectHash(tag.GetGroup()) >> 16) +
+                    (e ^ ((e >> 12)*0x9E3u))) & (r - 1);
+  // each bucket is a (base, seed) pair, and the following bucket's base
+  // gives the number of slots "n" (for an empty bucket, the slot that is
+  // probed belongs to another bucket or to the final 0xFFFF slot)
+  const unsigned short *bucket = table + 2 + 2*b;
+  unsigned int n = bucket[2] - bucket[0];
+  unsigned int y = ((tag.GetKey() ^ bucket[1])*0x85EBCA6Bu) >> 16;
+  return table[2 + 2*(r + 1) + bucket[0] + ((y*n) >> 16)];
+}
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+vtkDICOMDictEntry vtkDICOMDictionary::FindDictEntry(
+  const vtkDICOMTag tag, const char *dictname)
+{
   // default to the standard dictionary
   vtkDICOMDictionary::Dict *dict = &vtkDICOMDictionary::DictData;
 
   // for odd group number, only search the private dictionary
-  if ((group & 1) != 0 && dictname != 0)
+  if ((tag.GetGroup() & 1) != 0 && dictname != 0)
   {
     dict = vtkDICOMDictionary::FindPrivateDict(dictname);
     if (dict == 0)
@@ -139,12 +340,38 @@ vtkDICOMDictEntry vtkDICOMDictionary::FindDictEntry(
       // private dictionary not found
       return vtkDICOMDictEntry();
     }
-    i = (h % dict->HashSize);
   }
 
-  // search the hash table
-  const unsigned short *hptr = &dict->TagHashTable[dict->TagHashTable[i]];
+  return vtkDICOMDictionary::FindDictEntryInDict(tag, dict);
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMDictEntry vtkDICOMDictionary::FindDictEntryInDict(
+  const vtkDICOMTag tag, const Dict *dict)
+{
+  unsigned short group = tag.GetGroup();
+  unsigned short element = tag.GetElement();
+
   const vtkDICOMDictEntry::Entry *dptr = dict->Contents;
+
+  if (dict->TagPerfectHash)
+  {
+    // a single probe of the perfect hash table
+    unsigned int k = vtkDICOMOrderedHashLookup(dict->TagPerfectHash, tag);
+    if (k < dict->DataSize)
+    {
+      const vtkDICOMDictEntry::Entry *entry = &dptr[k];
+      if (entry->Element == element && entry->Group == group)
+      {
+        return vtkDICOMDictEntry(entry);
+      }
+    }
+    return vtkDICOMDictEntry();
+  }
+
+  // search the chained hash table
+  unsigned int i = (tag.ComputeHash() % dict->HashSize);
+  const unsigned short *hptr = &dict->TagHashTable[dict->TagHashTable[i]];
   for (unsigned short n = *hptr; n != 0; --n)
   {
     ++hptr;
@@ -186,20 +413,37 @@ vtkDICOMDictEntry vtkDICOMDictionary::FindDictEntry(
     }
   }
 
-  unsigned short i = static_cast<unsigned short>(h % dict->HashSize);
-  unsigned short j = static_cast<unsigned short>(h / dict->HashSize);
-
-  // search the hash table
-  const unsigned short *hptr = &dict->KeyHashTable[dict->KeyHashTable[i]];
   const vtkDICOMDictEntry::Entry *dptr = dict->Contents;
-  for (unsigned short n = *hptr; n != 0; --n)
+
+  if (dict->KeyPerfectHash)
   {
-    ++hptr;
-    const vtkDICOMDictEntry::Entry *entry = &dptr[*hptr];
-    ++hptr;
-    if (*hptr == j && strncmp(stripkey, entry->Name, 64) == 0)
+    // a single probe of the perfect hash table
+    unsigned int k = vtkDICOMPerfectHashLookup(dict->KeyPerfectHash, h);
+    if (k < dict->DataSize)
     {
-      return vtkDICOMDictEntry(entry);
+      const vtkDICOMDictEntry::Entry *entry = &dptr[k];
+      if (strncmp(stripkey, entry->Name, 64) == 0)
+      {
+        return vtkDICOMDictEntry(entry);
+      }
+    }
+  }
+  else
+  {
+    // search the chained hash table
+    unsigned short i = static_cast<unsigned short>(h % dict->HashSize);
+    unsigned short j = static_cast<unsigned short>(h / dict->HashSize);
+    const unsigned short *hptr =
+      &dict->KeyHashTable[dict->KeyHashTable[i]];
+    for (unsigned short n = *hptr; n != 0; --n)
+    {
+      ++hptr;
+      const vtkDICOMDictEntry::Entry *entry = &dptr[*hptr];
+      ++hptr;
+      if (*hptr == j && strncmp(stripkey, entry->Name, 64) == 0)
+      {
+        return vtkDICOMDictEntry(entry);
+      }
     }
   }
 
@@ -223,84 +467,133 @@ vtkDICOMDictEntry vtkDICOMDictionary::FindDictEntry(
 }
 
 //----------------------------------------------------------------------------
-void vtkDICOMDictionary::AddPrivateDictionary(Dict *dict)
+void vtkDICOMDictionary::ReplacePrivateDictionary(
+  const char *name, Dict *dict)
 {
   unsigned int m = DICT_PRIVATE_TABLE_SIZE - 1;
   DictHashEntry **htable = vtkDICOMDictionary::PrivateDictTable;
 
   // strip trailing spaces and compute the hash
   char stripname[64];
-  unsigned int h = vtkDICOMDictionary::HashLongString(dict->Name, stripname);
+  unsigned int h = vtkDICOMDictionary::HashLongString(name, stripname);
   unsigned int i = (h & m);
-  DictHashEntry *hptr = htable[i];
 
-  // create hash table row if it is empty
-  if (hptr == 0)
-  {
-    htable[i] = new DictHashEntry[2];
-    hptr = htable[i];
-    hptr->Hash = 0;
-    hptr->Dict = 0;
-  }
-
-  // go to the end of the row in the hash table
+  // count the entries in the row, other than the one being replaced
+  DictHashEntry *oldrow = htable[i];
   int n = 0;
-  while (hptr->Dict != 0)
+  int k = -1;
+  if (oldrow)
   {
-    n++;
-    hptr++;
+    for (int j = 0; oldrow[j].Dict != 0; j++)
+    {
+      if (oldrow[j].Hash == h &&
+          strncmp(oldrow[j].Dict->Name, stripname, 64) == 0)
+      {
+        k = j;
+      }
+      else
+      {
+        n++;
+      }
+    }
   }
 
-  // if n+1 is a power of two, double allocated space
-  if (n > 0 && (n & (n+1)) == 0)
+  if (dict != 0 || k >= 0)
   {
-    DictHashEntry *oldptr = htable[i];
-    hptr = new DictHashEntry[2*(n+1)];
-    htable[i] = hptr;
-    // copy the old list
-    for (int j = 0; j < n; j++)
+    // build a new row, with a null entry to terminate it
+    DictHashEntry *row = new DictHashEntry[n + 2];
+    DictHashEntry *hptr = row;
+    for (int j = 0; j < n + (k >= 0); j++)
     {
-      *hptr++ = oldptr[j];
+      if (j != k)
+      {
+        *hptr++ = oldrow[j];
+      }
     }
-    delete [] oldptr;
-  }
+    if (dict != 0)
+    {
+      hptr->Hash = h;
+      hptr->Dict = dict;
+      hptr++;
+    }
+    hptr->Hash = 0;
+    hptr->Dict = 0;
 
-  hptr->Hash = h;
-  hptr->Dict = dict;
+    // the row must be complete before other threads can see it
+    vtkDICOMReferenceCount::Fence();
+    htable[i] = row;
 
-  hptr++;
-  hptr->Hash = 0;
-  hptr->Dict = 0;
+    if (oldrow)
+    {
+      vtkDICOMDictionaryRetiredRows->push_back(oldrow);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDictionary::AddPrivateDictionary(Dict *dict)
+{
+  vtkDICOMDictionaryLock->Lock();
+  vtkDICOMDictionary::ClaimListedDict(dict->Name);
+  vtkDICOMDictionary::ReplacePrivateDictionary(dict->Name, dict);
+  vtkDICOMDictionaryLock->Unlock();
 }
 
 //----------------------------------------------------------------------------
 void vtkDICOMDictionary::RemovePrivateDictionary(const char *name)
 {
-  unsigned int m = DICT_PRIVATE_TABLE_SIZE - 1;
-  DictHashEntry **htable = vtkDICOMDictionary::PrivateDictTable;
-  DictHashEntry *hptr;
+  vtkDICOMDictionaryLock->Lock();
+  vtkDICOMDictionary::ClaimListedDict(name);
+  vtkDICOMDictionary::ReplacePrivateDictionary(name, 0);
+  vtkDICOMDictionaryLock->Unlock();
+}
 
-  // strip trailing spaces and compute the hash
-  char stripname[64];
-  unsigned int h = vtkDICOMDictionary::HashLongString(name, stripname);
-  unsigned int i = (h & m);
+//----------------------------------------------------------------------------
+void vtkDICOMDictionary::AddPrivateDictionaryList(Dict **dicts)
+{
+  DictList *l = new DictList;
+  l->Dicts = dicts;
+  l->Size = 0;
+  while (dicts[l->Size] != 0)
+  {
+    l->Size++;
+  }
+  l->Removed = false;
+  l->Claimed = 0;
+
+  vtkDICOMDictionaryLock->Lock();
+  l->Next = vtkDICOMDictionary::PrivateDictLists;
+  // the list must be complete before other threads can see it
+  vtkDICOMReferenceCount::Fence();
+  vtkDICOMDictionary::PrivateDictLists = l;
+  vtkDICOMDictionaryLock->Unlock();
+}
 
-  if (htable && (hptr = htable[i]) != NULL)
+//----------------------------------------------------------------------------
+void vtkDICOMDictionary::RemovePrivateDictionaryList(Dict **dicts)
+{
+  vtkDICOMDictionaryLock->Lock();
+  for (DictList *l = vtkDICOMDictionary::PrivateDictLists; l; l = l->Next)
   {
-    while (hptr->Dict != 0)
+    if (l->Dicts == dicts && !l->Removed)
     {
-      if (hptr->Hash == h && strncmp(hptr->Dict->Name, stripname, 64) == 0)
+      // the list itself is kept until exit, since other threads
+      // might be searching it
+      l->Removed = true;
+      for (int i = 0; l->Claimed && i < l->Size; i++)
       {
-        break;
+        char stripname[64];
+        Dict *dict = dicts[i];
+        unsigned int h =
+          vtkDICOMDictionary::HashLongString(dict->Name, stripname);
+        if (l->Claimed[i] &&
+            vtkDICOMDictionary::LookupPrivateDict(stripname, h) == dict)
+        {
+          vtkDICOMDictionary::ReplacePrivateDictionary(dict->Name, 0);
+        }
       }
-      hptr++;
-    }
-
-    // erase
-    while (hptr->Dict != 0)
-    {
-      *hptr = *(hptr + 1);
-      hptr++;
+      break;
     }
   }
+  vtkDICOMDictionaryLock->Unlock();
 }
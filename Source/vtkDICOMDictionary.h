@@ -18,8 +18,7 @@
 #include "vtkDICOMDictEntry.h"
 #include "vtkDICOMDictHash.h"
 
-//! The size of the hash table for the dicom dictionary.
-#define DICT_HASH_TABLE_SIZE 4096
+//! The size of the hash table for the private dictionaries.
 #define DICT_PRIVATE_TABLE_SIZE 512
 
 //! Provide access to the DICOM tag dictionary.
@@ -27,6 +26,17 @@ class VTKDICOM_EXPORT vtkDICOMDictionary
 {
 public:
   //! A struct to store a DICOM dictionary hash table.
+  /*!
+   *  The dictionaries that are generated by makedict.py provide minimal
+   *  perfect hash tables for the tags and the keys, so that each lookup
+   *  needs only a single probe.  The key table holds the number of
+   *  buckets "r", the number of slots "m", "r" displacements, and then
+   *  "m" indices into Contents.  The tag table holds "r" and "m", then
+   *  "r+1" (base, seed) pairs for buckets that follow the element order,
+   *  and then "m+1" indices into Contents.  Dictionaries that do not
+   *  provide perfect hash tables (and leave them NULL) must instead
+   *  provide the older chained hash tables, with HashSize buckets.
+   */
   struct Dict
   {
     const char *Name;
@@ -35,6 +45,8 @@ public:
     const unsigned short *TagHashTable;
     const unsigned short *KeyHashTable;
     const vtkDICOMDictEntry::Entry *Contents;
+    const unsigned short *TagPerfectHash;
+    const unsigned short *KeyPerfectHash;
   };
 
   struct DictHashEntry;
@@ -72,22 +84,63 @@ public:
     const char *key, const char *privateDict);
   //@}
 
+  //@{
+  //! Find the private dictionary for the given creator.
+  /*!
+   *  This returns NULL if there is no dictionary for the creator.  The
+   *  result can be given to FindDictEntryInDict(), so that a parser
+   *  can look up the creator only once for each private block.
+   */
+  static const Dict *FindPrivateDictionary(const char *privateDict) {
+    return vtkDICOMDictionary::FindPrivateDict(privateDict); }
+
+  //! Find the entry for the tag within the given dictionary.
+  /*!
+   *  For private tags, the high byte of the element must be zero,
+   *  in the same way as for FindDictEntry().
+   */
+  static vtkDICOMDictEntry FindDictEntryInDict(
+    const vtkDICOMTag tag, const Dict *dict);
+  //@}
+
   //@{
   //! Add the hash table for a private dictionary.
   /*!
    *  The name should be the text that appears in the PrivateCreator
-   *  element of the data set when this dictionary is used.  The value
-   *  of "n" is the size of the provided hash table.
+   *  element of the data set when this dictionary is used.  If a
+   *  dictionary with the same name has already been added, then it
+   *  will be replaced.  Dictionaries can be added and removed while
+   *  other threads are doing lookups, but the Dict itself must remain
+   *  valid until the program exits.
    */
   static void AddPrivateDictionary(Dict *dict);
 
   //! Remove a private dictionary.
   static void RemovePrivateDictionary(const char *name);
+
+  //! Add a list of private dictionaries that will be added on demand.
+  /*!
+   *  The list must be sorted by name (in strcmp() order) and must be
+   *  terminated by NULL.  Each dictionary in the list is added the first
+   *  time that a lookup is done for its name, so a long list adds nothing
+   *  to the startup time.  This is used for the built-in dictionaries.
+   *  The list must remain valid until the program exits.
+   */
+  static void AddPrivateDictionaryList(Dict **dicts);
+
+  //! Remove a list of private dictionaries.
+  /*!
+   *  Any dictionaries in the list that have already been added will be
+   *  removed, unless they have since been replaced.
+   */
+  static void RemovePrivateDictionaryList(Dict **dicts);
   //@}
 
 private:
   friend class vtkDICOMDictionaryInitializer;
 
+  struct DictList;
+
   //! Compute a string hash for a DICOM text value.
   /*!
    *  The final trailing space will be stripped, if present.  The
@@ -102,11 +155,35 @@ private:
    */
   static Dict *FindPrivateDict(const char *name);
 
+  //! Look up a private dictionary in the hash table only.
+  static Dict *LookupPrivateDict(const char stripname[64], unsigned int h);
+
+  //! Search the lists for a private dictionary that has not been added.
+  /*!
+   *  If the dictionary is found, it is added to the hash table.
+   */
+  static Dict *FindListedDict(const char *name, const char stripname[64]);
+
+  //! Mark a dictionary in the lists as added or removed by the user.
+  /*!
+   *  This keeps it from being added on demand.  The lock must be held.
+   */
+  static void ClaimListedDict(const char *name);
+
+  //! Add, replace, or (if dict is null) remove a private dictionary.
+  /*!
+   *  The lock must be held when this is called.
+   */
+  static void ReplacePrivateDictionary(const char *name, Dict *dict);
+
   //! The lookup table for the dictionary.
   static Dict DictData;
 
   //! The lookup table for private dictionaries.
   static DictHashEntry *PrivateDictTable[DICT_PRIVATE_TABLE_SIZE];
+
+  //! The lists of dictionaries that are added on demand.
+  static DictList *PrivateDictLists;
 };
 
 //! @cond
@@ -14,12 +14,14 @@
 #include "vtkDICOMDirectory.h"
 
 #include "vtkDICOMFile.h"
+#include "vtkDICOMFileBatch.h"
 #include "vtkDICOMFileDirectory.h"
 #include "vtkDICOMFilePath.h"
 #include "vtkDICOMItem.h"
 #include "vtkDICOMMetaData.h"
 #include "vtkDICOMSequence.h"
 #include "vtkDICOMParser.h"
+#include "vtkDICOMQueryMatcher.h"
 #include "vtkDICOMUtilities.h"
 #include "vtkDICOMVR.h"
 
@@ -30,6 +32,9 @@
 #include "vtkErrorCode.h"
 #include "vtkCommand.h"
 #include "vtkUnsignedShortArray.h"
+#include "vtkMultiThreader.h"
+#include "vtkMutexLock.h"
+#include "vtkConditionVariable.h"
 
 #ifdef DICOM_USE_SQLITE
 #include <sqlite3.h>
@@ -39,6 +44,8 @@
 #include <sstream>
 #include <vector>
 #include <list>
+#include <deque>
+#include <set>
 #include <map>
 #include <algorithm>
 #include <utility>
@@ -56,6 +63,10 @@ struct vtkDICOMDirectory::SeriesItem
   vtkDICOMItem Record;
   vtkSmartPointer<vtkStringArray> Files;
   vtkSmartPointer<vtkDICOMMetaData> Meta;
+  vtkIdType FirstFile;
+  vtkIdType NumberOfFiles;
+  int ScanIndex;
+  bool KeepFiles;
 };
 
 struct vtkDICOMDirectory::StudyItem
@@ -74,7 +85,11 @@ struct vtkDICOMDirectory::PatientItem
 
 class vtkDICOMDirectory::SeriesVector
   : public std::vector<vtkDICOMDirectory::SeriesItem>
-{};
+{
+public:
+  // Guards the arrays that are built from the compact file names.
+  vtkSimpleMutexLock FilesLock;
+};
 
 class vtkDICOMDirectory::StudyVector
   : public std::vector<vtkDICOMDirectory::StudyItem>
@@ -84,10 +99,486 @@ class vtkDICOMDirectory::PatientVector
   : public std::vector<vtkDICOMDirectory::PatientItem>
 {};
 
-class vtkDICOMDirectory::VisitedVector
-  : public std::vector<std::string>
+// Compact storage for the file names of all the series.  Each directory
+// is stored only once, and the rest of each file name is stored in a
+// shared array of characters, so that there is no allocation per file.
+class vtkDICOMDirectory::FileNameStore
+{
+public:
+  FileNameStore() : LastDirectory(0) {}
+
+  // Add a file name, and return its index.
+  vtkIdType Append(const std::string& path);
+
+  // Get the file name at the given index.
+  std::string Get(vtkIdType i) const;
+
+  // Get the number of file names.
+  vtkIdType GetNumberOfFileNames() const {
+    return static_cast<vtkIdType>(this->Entries.size()); }
+
+  // Remove the file names from index i onwards.
+  void Truncate(vtkIdType i);
+
+  // Remove all of the file names.
+  void Clear();
+
+  // Get the number of bytes that are used.
+  size_t GetMemorySize() const;
+
+private:
+  struct Entry
+  {
+    size_t Offset;
+    unsigned int Directory;
+  };
+
+  typedef std::map<std::string, unsigned int> DirectoryMap;
+
+  DirectoryMap DirectoryIndex;
+  std::vector<const std::string *> Directories;
+  unsigned int LastDirectory;
+  std::vector<char> Arena;
+  std::vector<Entry> Entries;
+};
+
+vtkIdType vtkDICOMDirectory::FileNameStore::Append(const std::string& path)
+{
+  // the directory includes the trailing separator, so that joining the
+  // directory and the rest of the name will give the original path
+  size_t pos = path.find_last_of("/\\");
+  pos = (pos == std::string::npos ? 0 : pos + 1);
+
+  // files are usually added in runs that share the same directory
+  unsigned int d = this->LastDirectory;
+  if (d >= this->Directories.size() ||
+      this->Directories[d]->length() != pos ||
+      path.compare(0, pos, *this->Directories[d]) != 0)
+  {
+    d = static_cast<unsigned int>(this->Directories.size());
+    std::pair<DirectoryMap::iterator, bool> r =
+      this->DirectoryIndex.insert(std::make_pair(path.substr(0, pos), d));
+    if (r.second)
+    {
+      this->Directories.push_back(&r.first->first);
+    }
+    d = r.first->second;
+    this->LastDirectory = d;
+  }
+
+  Entry e;
+  e.Offset = this->Arena.size();
+  e.Directory = d;
+  this->Arena.insert(this->Arena.end(), path.begin() + pos, path.end());
+  this->Arena.push_back('\0');
+  this->Entries.push_back(e);
+
+  return static_cast<vtkIdType>(this->Entries.size() - 1);
+}
+
+std::string vtkDICOMDirectory::FileNameStore::Get(vtkIdType i) const
+{
+  const Entry& e = this->Entries[i];
+  std::string path = *this->Directories[e.Directory];
+  path.append(&this->Arena[e.Offset]);
+  return path;
+}
+
+void vtkDICOMDirectory::FileNameStore::Truncate(vtkIdType i)
+{
+  if (i < this->GetNumberOfFileNames())
+  {
+    this->Arena.resize(this->Entries[i].Offset);
+    this->Entries.resize(i);
+  }
+}
+
+void vtkDICOMDirectory::FileNameStore::Clear()
+{
+  this->DirectoryIndex.clear();
+  this->Directories.clear();
+  this->LastDirectory = 0;
+  std::vector<char>().swap(this->Arena);
+  std::vector<Entry>().swap(this->Entries);
+}
+
+size_t vtkDICOMDirectory::FileNameStore::GetMemorySize() const
+{
+  size_t s = this->Arena.capacity();
+  s += this->Entries.capacity()*sizeof(Entry);
+  s += this->Directories.capacity()*sizeof(const std::string *);
+  for (DirectoryMap::const_iterator iter = this->DirectoryIndex.begin();
+       iter != this->DirectoryIndex.end(); ++iter)
+  {
+    // approximate size of a map node
+    s += sizeof(*iter) + 4*sizeof(void *) + iter->first.capacity();
+  }
+  return s;
+}
+
+//----------------------------------------------------------------------------
+// An in-memory index of every series that was found by a scan, so that
+// repeated queries can be answered without scanning the files again.
+
+class vtkDICOMDirectory::AttributeIndex
+{
+public:
+  // The records and the files of one series.
+  struct SeriesEntry
+  {
+    int Patient;
+    int Study;
+    vtkDICOMItem PatientRecord;
+    vtkDICOMItem StudyRecord;
+    vtkDICOMItem SeriesRecord;
+    std::vector<vtkDICOMItem> ImageRecords;
+    vtkIdType FirstFile;
+    bool Scanned;
+    bool Osirix;
+  };
+
+  // The distinct values of one attribute, and the series that have
+  // each value (the series for value i are at Offsets[i] to Offsets[i+1]).
+  // The Unknown series have no value for the attribute in the index.
+  struct Column
+  {
+    vtkDICOMTag Tag;
+    std::vector<vtkDICOMValue> Values;
+    std::vector<size_t> Offsets;
+    std::vector<int> SeriesList;
+    std::vector<int> Unknown;
+  };
+
+  AttributeIndex() : Valid(false), NumberOfPatients(0), NumberOfStudies(0),
+    ErrorCode(0), ScanDepth(0), IgnoreDicomdir(0), RequirePixelData(0),
+    FollowSymlinks(0), ShowHidden(0), OverrideCharacterSet(false) {}
+
+  // Add a series to the index.
+  void AddSeries(int patient, int study, vtkStringArray *files,
+                 const vtkDICOMItem& patientRecord,
+                 const vtkDICOMItem& studyRecord,
+                 const vtkDICOMItem& seriesRecord,
+                 const vtkDICOMItem *imageRecords[],
+                 bool scanned, bool osirix);
+
+  // Build the columns for the index tags, after all series are added.
+  void BuildColumns();
+
+  // Get the series that might match the query, in their original order.
+  void Select(const vtkDICOMItem *query, const vtkDICOMQueryMatcher& matcher,
+              std::vector<int> *selection) const;
+
+  // Remove everything from the index, except for the tags.
+  void Clear();
+
+  std::vector<vtkDICOMTag> Tags;
+  bool Valid;
+  int NumberOfPatients;
+  int NumberOfStudies;
+  std::vector<SeriesEntry> Series;
+  std::vector<Column> Columns;
+  FileNameStore FileNames;
+
+  // The results of the scan, other than the series.
+  unsigned long ErrorCode;
+  std::string FileSetID;
+
+  // The settings that were used for the scan.
+  vtkTimeStamp BuildTime;
+  int ScanDepth;
+  int IgnoreDicomdir;
+  int RequirePixelData;
+  int FollowSymlinks;
+  int ShowHidden;
+  vtkDICOMCharacterSet DefaultCharacterSet;
+  bool OverrideCharacterSet;
+};
+
+void vtkDICOMDirectory::AttributeIndex::AddSeries(
+  int patient, int study, vtkStringArray *files,
+  const vtkDICOMItem& patientRecord,
+  const vtkDICOMItem& studyRecord,
+  const vtkDICOMItem& seriesRecord,
+  const vtkDICOMItem *imageRecords[], bool scanned, bool osirix)
+{
+  vtkIdType n = files->GetNumberOfValues();
+  if (n == 0)
+  {
+    return;
+  }
+
+  this->Series.push_back(SeriesEntry());
+  SeriesEntry& entry = this->Series.back();
+  entry.Patient = patient;
+  entry.Study = study;
+  entry.PatientRecord = patientRecord;
+  entry.StudyRecord = studyRecord;
+  entry.SeriesRecord = seriesRecord;
+  entry.ImageRecords.resize(n);
+  entry.FirstFile = this->FileNames.GetNumberOfFileNames();
+  entry.Scanned = scanned;
+  entry.Osirix = osirix;
+  for (vtkIdType i = 0; i < n; i++)
+  {
+    entry.ImageRecords[i] = *imageRecords[i];
+    this->FileNames.Append(files->GetValue(i));
+  }
+
+  this->NumberOfPatients = std::max(this->NumberOfPatients, patient + 1);
+  this->NumberOfStudies = std::max(this->NumberOfStudies, study + 1);
+}
+
+void vtkDICOMDirectory::AttributeIndex::BuildColumns()
+{
+  this->Columns.clear();
+  this->Columns.resize(this->Tags.size());
+
+  for (size_t j = 0; j < this->Tags.size(); j++)
+  {
+    Column& column = this->Columns[j];
+    vtkDICOMTag tag = this->Tags[j];
+    column.Tag = tag;
+
+    // the distinct values are found via a key made from the VR, the
+    // character set, and the text, since all three affect matching
+    typedef std::map<std::string, int> ValueMap;
+    ValueMap valueMap;
+    std::vector<std::pair<int, int> > pairs;
+
+    int numberOfSeries = static_cast<int>(this->Series.size());
+    for (int k = 0; k < numberOfSeries; k++)
+    {
+      const SeriesEntry& entry = this->Series[k];
+      if (entry.Osirix)
+      {
+        // the Osirix database needs its own loose matching
+        column.Unknown.push_back(k);
+        continue;
+      }
+
+      // the value is either in one of the records, or in every image
+      const vtkDICOMItem *records[3] = {
+        &entry.PatientRecord, &entry.StudyRecord, &entry.SeriesRecord };
+      const vtkDICOMValue *recordValue = 0;
+      for (int r = 0; r < 3 && recordValue == 0; r++)
+      {
+        const vtkDICOMValue& v = records[r]->Get(tag);
+        recordValue = (v.IsValid() ? &v : 0);
+      }
+
+      bool unknown = false;
+      size_t numberOfPairs = pairs.size();
+      size_t m = (recordValue ? 1 : entry.ImageRecords.size());
+      for (size_t i = 0; i < m && !unknown; i++)
+      {
+        const vtkDICOMValue& v =
+          (recordValue ? *recordValue : entry.ImageRecords[i].Get(tag));
+        const char *cp = v.GetCharData();
+        if (cp == 0 || v.GetVR() == vtkDICOMVR::SQ)
+        {
+          // the value is missing, or is not text
+          unknown = true;
+        }
+        else
+        {
+          std::string key = v.GetVR().GetText();
+          key.push_back(static_cast<char>(v.GetCharacterSet().GetKey()));
+          key.append(cp, v.GetVL());
+          std::pair<ValueMap::iterator, bool> r = valueMap.insert(
+            std::make_pair(key, static_cast<int>(column.Values.size())));
+          if (r.second)
+          {
+            column.Values.push_back(v);
+          }
+          pairs.push_back(std::make_pair(r.first->second, k));
+        }
+      }
+
+      if (unknown)
+      {
+        pairs.resize(numberOfPairs);
+        column.Unknown.push_back(k);
+      }
+    }
+
+    // sort by value, then by series, and remove repeats
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+    size_t numberOfValues = column.Values.size();
+    column.Offsets.resize(numberOfValues + 1);
+    column.SeriesList.resize(pairs.size());
+    size_t p = 0;
+    for (size_t i = 0; i < numberOfValues; i++)
+    {
+      column.Offsets[i] = p;
+      while (p < pairs.size() && pairs[p].first == static_cast<int>(i))
+      {
+        column.SeriesList[p] = pairs[p].second;
+        p++;
+      }
+    }
+    column.Offsets[numberOfValues] = p;
+  }
+}
+
+void vtkDICOMDirectory::AttributeIndex::Select(
+  const vtkDICOMItem *query, const vtkDICOMQueryMatcher& matcher,
+  std::vector<int> *selection) const
+{
+  size_t numberOfSeries = this->Series.size();
+  std::vector<char> selected(numberOfSeries, 1);
+
+  if (query)
+  {
+    std::vector<char> found;
+    for (size_t j = 0; j < this->Columns.size(); j++)
+    {
+      const Column& column = this->Columns[j];
+      const vtkDICOMValue& q = query->Get(column.Tag);
+      if (!q.IsValid() || q.GetVL() == 0 || q.GetVR() == vtkDICOMVR::SQ ||
+          column.Tag == DC::SpecificCharacterSet ||
+          column.Tag.GetGroup() == 0x0004)
+      {
+        // these keys are not matched against the records
+        continue;
+      }
+
+      // check each distinct value against the query only once
+      found.assign(numberOfSeries, 0);
+      for (size_t i = 0; i < column.Unknown.size(); i++)
+      {
+        found[column.Unknown[i]] = 1;
+      }
+      for (size_t i = 0; i < column.Values.size(); i++)
+      {
+        if (matcher.Matches(column.Tag, column.Values[i]))
+        {
+          for (size_t p = column.Offsets[i]; p < column.Offsets[i+1]; p++)
+          {
+            found[column.SeriesList[p]] = 1;
+          }
+        }
+      }
+      for (size_t k = 0; k < numberOfSeries; k++)
+      {
+        selected[k] &= found[k];
+      }
+    }
+  }
+
+  selection->clear();
+  for (size_t k = 0; k < numberOfSeries; k++)
+  {
+    if (selected[k])
+    {
+      selection->push_back(static_cast<int>(k));
+    }
+  }
+}
+
+void vtkDICOMDirectory::AttributeIndex::Clear()
+{
+  this->Valid = false;
+  this->NumberOfPatients = 0;
+  this->NumberOfStudies = 0;
+  std::vector<SeriesEntry>().swap(this->Series);
+  std::vector<Column>().swap(this->Columns);
+  this->FileNames.Clear();
+  this->ErrorCode = 0;
+  this->FileSetID.clear();
+}
+
+// The directories that have been visited, by device and inode number
+class vtkDICOMDirectory::VisitedSet
+  : public std::set<std::pair<vtkDICOMFile::Size, vtkDICOMFile::Size> >
 {};
 
+namespace {
+
+// The position of a file in the order given by a serial walk.  For files
+// found by the DirectoryWalker, this is the directory node and the index
+// of the file within the directory, otherwise the node is -1 and this is
+// the index of the file within the input files.
+struct FilePosition
+{
+  FilePosition() : Node(-1), Index(0) {}
+  FilePosition(int node, vtkIdType idx) : Node(node), Index(idx) {}
+
+  int Node;
+  vtkIdType Index;
+};
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+// A helper class for building a sorted list of unique tags
+class SortedTags : public std::vector<vtkDICOMTag>
+{
+public:
+  void SetFrom(const vtkDICOMItem& patientRecord,
+               const vtkDICOMItem& studyRecord,
+               const vtkDICOMItem& seriesRecord);
+  void Trim(vtkDICOMItem *item) const;
+};
+
+void SortedTags::SetFrom(const vtkDICOMItem& patientRecord,
+                         const vtkDICOMItem& studyRecord,
+                         const vtkDICOMItem& seriesRecord)
+{
+  this->clear();
+  this->reserve(patientRecord.GetNumberOfDataElements() +
+                studyRecord.GetNumberOfDataElements() +
+                seriesRecord.GetNumberOfDataElements());
+
+  const vtkDICOMItem *records[3] = {
+    &patientRecord, &studyRecord, &seriesRecord
+  };
+
+  for (int i = 0; i < 3; i++)
+  {
+    vtkDICOMDataElementIterator iter = records[i]->Begin();
+    vtkDICOMDataElementIterator iterEnd = records[i]->End();
+
+    while (iter != iterEnd)
+    {
+      vtkDICOMTag tag = iter->GetTag();
+      std::vector<vtkDICOMTag>::iterator pos =
+        std::lower_bound(begin(), end(), tag);
+      if (*pos != tag)
+      {
+        this->insert(pos, tag);
+      }
+
+      ++iter;
+    }
+  }
+}
+
+void SortedTags::Trim(vtkDICOMItem *item) const
+{
+  // Remove the tags from the item, but keep SpecificCharacterSet
+  vtkDICOMItem trimmed;
+  const_iterator skip = this->begin();
+  vtkDICOMDataElementIterator iter = item->Begin();
+  vtkDICOMDataElementIterator iterEnd = item->End();
+  while (iter != iterEnd)
+  {
+    vtkDICOMTag tag = iter->GetTag();
+    while (skip != this->end() && *skip < tag)
+    {
+      ++skip;
+    }
+    if (tag == DC::SpecificCharacterSet || skip == this->end() ||
+        tag != *skip)
+    {
+      trimmed.Set(tag, iter->GetValue());
+    }
+    ++iter;
+  }
+  *item = trimmed;
+}
+
 //----------------------------------------------------------------------------
 // Information used to sort DICOM files.
 
@@ -97,6 +588,7 @@ struct vtkDICOMDirectory::FileInfo
   const char *FileName;
   vtkDICOMValue ImageUID;
   vtkDICOMItem ImageRecord;
+  bool Reported;
 };
 
 struct vtkDICOMDirectory::SeriesInfo
@@ -116,12 +608,463 @@ struct vtkDICOMDirectory::SeriesInfo
   unsigned int SeriesNumber;
   std::vector<FileInfo> Files;
   bool QueryMatched;
+  // -- SCAN --
+  int ScanIndex;
+  FilePosition RecordPosition; // the file the records came from
+  bool Updated;
 };
 
 bool vtkDICOMDirectory::CompareInstance(
   const FileInfo &fi1, const FileInfo &fi2)
 {
-  return (fi1.InstanceNumber < fi2.InstanceNumber);
+  // use the file name to break ties, so that the order does not
+  // depend on the order in which the files were found
+  return (fi1.InstanceNumber < fi2.InstanceNumber ||
+          (fi1.InstanceNumber == fi2.InstanceNumber &&
+           strcmp(fi1.FileName, fi2.FileName) < 0));
+}
+
+int vtkDICOMDirectory::CompareSeries(
+  const SeriesInfo &si1, const SeriesInfo &si2)
+{
+  // Compare patient, then study, then series.
+  const char *patientName = si2.PatientName.GetCharData();
+  patientName = (patientName ? patientName : "");
+  const char *patientID = si2.PatientID.GetCharData();
+  patientID = (patientID ? patientID : "");
+  const char *patientName2 = si1.PatientName.GetCharData();
+  patientName2 = (patientName2 ? patientName2 : "");
+  const char *patientID2 = si1.PatientID.GetCharData();
+  patientID2 = (patientID2 ? patientID2 : "");
+  int c = strcmp(patientID2, patientID);
+  if (c != 0 || patientID[0] == '\0')
+  {
+    // Use ID to identify patient, but use name to sort.
+    int c2 = strcmp(patientName2, patientName);
+    c = (c2 == 0 ? c : c2);
+  }
+  if (c == 0)
+  {
+    const char *studyUID = si2.StudyUID.GetCharData();
+    c = vtkDICOMUtilities::CompareUIDs(
+      studyUID, si1.StudyUID.GetCharData());
+    if (c != 0 || studyUID == 0)
+    {
+      // Use UID to identify study, but use date to sort.
+      int c2 = 0;
+      const char *studyDate = si2.StudyDate.GetCharData();
+      const char *studyDate2 = si1.StudyDate.GetCharData();
+      if (studyDate && studyDate2)
+      {
+        c2 = strcmp(studyDate2, studyDate);
+        if (c2 == 0)
+        {
+          const char *studyTime = si2.StudyTime.GetCharData();
+          const char *studyTime2 = si1.StudyTime.GetCharData();
+          if (studyTime2 && studyTime)
+          {
+            c2 = strcmp(studyTime, studyTime2);
+          }
+        }
+      }
+      c = (c2 == 0 ? c : c2);
+    }
+    if (c == 0)
+    {
+      const char *seriesUID = si2.SeriesUID.GetCharData();
+      c = vtkDICOMUtilities::CompareUIDs(
+        seriesUID, si1.SeriesUID.GetCharData());
+      if (c != 0 || seriesUID == 0)
+      {
+        // Use UID to identify series, but use series number to sort.
+        int c2 = si1.SeriesNumber - si2.SeriesNumber;
+        c = (c2 == 0 ? c : c2);
+      }
+    }
+  }
+  return c;
+}
+
+//----------------------------------------------------------------------------
+// A work queue for walking directory trees with several threads.  The
+// files are handed to SortFiles() as soon as they are found, along with
+// their position in the order that a serial walk would give, so that the
+// results do not depend on which thread happened to read which directory.
+
+class vtkDICOMDirectory::DirectoryWalker
+{
+public:
+  DirectoryWalker(vtkDICOMDirectory *self) : Self(self), InputFiles(0),
+    NumberOfThreads(1), Busy(0), Running(false), Finished(false),
+    Abort(false) {}
+
+  // Clear the queue, and set the number of threads that will be used.
+  void Reset(int numberOfThreads);
+
+  // Check whether directories should be given to the walker.
+  bool IsEnabled() { return (this->NumberOfThreads > 1); }
+
+  // Check whether the walk is in progress.
+  bool IsRunning() { return this->Running; }
+
+  // Check whether any directories are waiting to be walked.
+  bool HasWork() { return !this->Pending.empty(); }
+
+  // Add a directory to be walked (the caller must mark it as visited).
+  // Its files will go before the input file at the given position.
+  void AddDirectory(const char *dirname, int depth, vtkIdType position);
+
+  // Walk the directories, while SortFiles() runs in the calling thread.
+  void Execute(vtkStringArray *files);
+
+  // Called from SortFiles() to collect the files that have been found,
+  // their positions, and the directories that could not be read.  This
+  // waits until there is something to report, and returns false after
+  // the walk is done.
+  bool GetFiles(
+    std::deque<std::string> *files, std::vector<FilePosition> *positions,
+    std::vector<std::string> *failed);
+
+  // Check whether a serial walk would find the first file before the
+  // second (this can be called while the walk is in progress).
+  bool Precedes(const FilePosition& p1, const FilePosition& p2);
+
+  // List the files and the subdirectories of a directory.
+  static bool ListDirectory(
+    vtkDICOMDirectory *self, const char *dirname,
+    std::vector<std::string> *files, std::vector<std::string> *subdirs);
+
+private:
+  struct DirectoryEntry
+  {
+    std::string Name;
+    int Depth;
+    int Node;
+  };
+
+  // The path to a directory through the tree, for ordering its files:
+  // roots begin with twice the position that they were added at, then
+  // the order in which they were added, and subdirectories append one
+  // plus their index within their parent.  A file in the directory then
+  // goes at the path plus zero plus its index, and the input file at a
+  // position goes at twice the position plus one.
+  struct DirectoryNode
+  {
+    std::vector<vtkIdType> Path;
+  };
+
+  // Walk the directories until the queue is empty.
+  void Walk();
+
+  // Get the nth element of the sort key for a file position.
+  vtkIdType GetKey(const FilePosition& p, size_t n, size_t *length);
+
+  // The entry point for all the threads.
+  static VTK_THREAD_RETURN_TYPE ThreadMethod(void *arg);
+
+  vtkDICOMDirectory *Self;
+  vtkStringArray *InputFiles;
+  int NumberOfThreads;
+  std::vector<DirectoryEntry> Pending;
+  std::vector<DirectoryNode> Nodes;
+  std::vector<std::string> Found;
+  std::vector<FilePosition> FoundPositions;
+  std::vector<std::string> Failed;
+  int Busy;
+  bool Running;
+  bool Finished;
+  bool Abort;
+  vtkSimpleMutexLock Lock;
+  vtkSimpleConditionVariable Condition;
+};
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::DirectoryWalker::Reset(int numberOfThreads)
+{
+  this->NumberOfThreads = numberOfThreads;
+  this->Pending.clear();
+  this->Nodes.clear();
+  this->Found.clear();
+  this->FoundPositions.clear();
+  this->Failed.clear();
+  this->Busy = 0;
+  this->Running = false;
+  this->Finished = false;
+  this->Abort = false;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::DirectoryWalker::AddDirectory(
+  const char *dirname, int depth, vtkIdType position)
+{
+  int node = static_cast<int>(this->Nodes.size());
+  this->Nodes.push_back(DirectoryNode());
+  this->Nodes.back().Path.push_back(2*position);
+  this->Nodes.back().Path.push_back(node);
+  this->Pending.push_back(DirectoryEntry());
+  this->Pending.back().Name = dirname;
+  this->Pending.back().Depth = depth;
+  this->Pending.back().Node = node;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::DirectoryWalker::Execute(vtkStringArray *files)
+{
+  // walk the directories in the order in which they were added
+  std::reverse(this->Pending.begin(), this->Pending.end());
+
+  this->InputFiles = files;
+  this->Running = true;
+
+  vtkMultiThreader *threader = vtkMultiThreader::New();
+  threader->SetNumberOfThreads(this->NumberOfThreads);
+  if (threader->GetNumberOfThreads() > 1)
+  {
+    threader->SetSingleMethod(&DirectoryWalker::ThreadMethod, this);
+    threader->SingleMethodExecute();
+  }
+  else
+  {
+    // no threads available, so walk first and then sort
+    this->Walk();
+    this->Self->SortFiles(files);
+  }
+  threader->Delete();
+
+  this->Reset(this->NumberOfThreads);
+}
+
+//----------------------------------------------------------------------------
+VTK_THREAD_RETURN_TYPE vtkDICOMDirectory::DirectoryWalker::ThreadMethod(
+  void *arg)
+{
+  vtkMultiThreader::ThreadInfo *info =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  DirectoryWalker *walker = static_cast<DirectoryWalker *>(info->UserData);
+
+  if (info->ThreadID == 0)
+  {
+    // the first thread sorts the files as the other threads find them
+    walker->Self->SortFiles(walker->InputFiles);
+
+    // if SortFiles() returned early, then stop the walk
+    walker->Lock.Lock();
+    walker->Abort = true;
+    walker->Condition.Broadcast();
+    walker->Lock.Unlock();
+  }
+  else
+  {
+    walker->Walk();
+  }
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::DirectoryWalker::Walk()
+{
+  std::vector<std::string> files;
+  std::vector<std::string> subdirs;
+  std::vector<bool> known;
+
+  this->Lock.Lock();
+  for (;;)
+  {
+    // wait until there is a directory to read, or until all is done
+    while (this->Pending.empty() && this->Busy > 0 && !this->Abort)
+    {
+      this->Condition.Wait(this->Lock);
+    }
+    if (this->Pending.empty() || this->Abort)
+    {
+      this->Finished = true;
+      this->Condition.Broadcast();
+      break;
+    }
+
+    DirectoryEntry entry = this->Pending.back();
+    this->Pending.pop_back();
+    this->Busy++;
+    this->Lock.Unlock();
+
+    // read the directory without holding the lock
+    files.clear();
+    subdirs.clear();
+    bool success = ListDirectory(
+      this->Self, entry.Name.c_str(), &files, &subdirs);
+
+    // get the identity of each subdirectory, for finding cycles
+    size_t n = (entry.Depth > 1 ? subdirs.size() : 0);
+    std::vector<std::pair<vtkDICOMFile::Size, vtkDICOMFile::Size> > ids(n);
+    known.assign(n, false);
+    for (size_t i = 0; i < n; i++)
+    {
+      known[i] = vtkDICOMFile::GetFileIndex(
+        subdirs[i].c_str(), &ids[i].first, &ids[i].second);
+    }
+
+    this->Lock.Lock();
+    if (!success && entry.Depth == this->Self->ScanDepth)
+    {
+      // only report failures at the initial depth
+      this->Failed.push_back(entry.Name);
+    }
+    this->Found.insert(this->Found.end(), files.begin(), files.end());
+    for (size_t i = 0; i < files.size(); i++)
+    {
+      this->FoundPositions.push_back(
+        FilePosition(entry.Node, static_cast<vtkIdType>(i)));
+    }
+    size_t m = this->Pending.size();
+    for (size_t i = 0; i < n; i++)
+    {
+      if (!known[i] || this->Self->Visited->insert(ids[i]).second)
+      {
+        int node = static_cast<int>(this->Nodes.size());
+        this->Nodes.push_back(DirectoryNode());
+        this->Nodes.back().Path = this->Nodes[entry.Node].Path;
+        this->Nodes.back().Path.push_back(static_cast<vtkIdType>(i + 1));
+        this->Pending.push_back(DirectoryEntry());
+        this->Pending.back().Name = subdirs[i];
+        this->Pending.back().Depth = entry.Depth - 1;
+        this->Pending.back().Node = node;
+      }
+    }
+    // reverse the new entries, so that they will be popped in order
+    std::reverse(this->Pending.begin() + m, this->Pending.end());
+    this->Busy--;
+    this->Condition.Broadcast();
+  }
+  this->Lock.Unlock();
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMDirectory::DirectoryWalker::GetFiles(
+  std::deque<std::string> *files, std::vector<FilePosition> *positions,
+  std::vector<std::string> *failed)
+{
+  this->Lock.Lock();
+  while (this->Found.empty() && this->Failed.empty() && !this->Finished)
+  {
+    this->Condition.Wait(this->Lock);
+  }
+  files->insert(files->end(), this->Found.begin(), this->Found.end());
+  positions->insert(positions->end(),
+    this->FoundPositions.begin(), this->FoundPositions.end());
+  failed->insert(failed->end(), this->Failed.begin(), this->Failed.end());
+  this->Found.clear();
+  this->FoundPositions.clear();
+  this->Failed.clear();
+  bool result = !this->Finished;
+  this->Lock.Unlock();
+
+  return result;
+}
+
+//----------------------------------------------------------------------------
+vtkIdType vtkDICOMDirectory::DirectoryWalker::GetKey(
+  const FilePosition& p, size_t n, size_t *length)
+{
+  if (p.Node < 0)
+  {
+    *length = 1;
+    return 2*p.Index + 1;
+  }
+
+  const std::vector<vtkIdType>& path = this->Nodes[p.Node].Path;
+  *length = path.size() + 2;
+  if (n < path.size())
+  {
+    return path[n];
+  }
+  return (n == path.size() ? 0 : p.Index);
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMDirectory::DirectoryWalker::Precedes(
+  const FilePosition& p1, const FilePosition& p2)
+{
+  if (p1.Node < 0 && p2.Node < 0)
+  {
+    return (p1.Index < p2.Index);
+  }
+
+  // compare the keys, while the walker threads cannot add nodes
+  bool result = false;
+  this->Lock.Lock();
+  size_t l1 = 1;
+  size_t l2 = 1;
+  for (size_t i = 0; i < l1 && i < l2; i++)
+  {
+    vtkIdType k1 = this->GetKey(p1, i, &l1);
+    vtkIdType k2 = this->GetKey(p2, i, &l2);
+    if (k1 != k2)
+    {
+      result = (k1 < k2);
+      break;
+    }
+  }
+  this->Lock.Unlock();
+
+  return result;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMDirectory::DirectoryWalker::ListDirectory(
+  vtkDICOMDirectory *self, const char *dirname,
+  std::vector<std::string> *files, std::vector<std::string> *subdirs)
+{
+  vtkDICOMFileDirectory d(dirname);
+  if (d.GetError() != 0)
+  {
+    return false;
+  }
+
+  // Find the path to the directory.
+  vtkDICOMFilePath path(dirname);
+
+  int n = d.GetNumberOfEntries();
+  for (int i = 0; i < n; i++)
+  {
+    const char *fname = d.GetEntry(i);
+    if ((fname[0] != '.' || (fname[1] != '\0' &&
+         (fname[1] != '.' || fname[2] != '\0'))) &&
+        strcmp(fname, "DICOMDIR") != 0)
+    {
+      path.PushBack(fname);
+      std::string fileString = path.AsString();
+      path.PopBack();
+      if (d.IsSymlink(i) && !self->FollowSymlinks)
+      {
+        // Do nothing unless FollowSymlinks is On
+      }
+#ifdef _WIN32
+      else if (!self->ShowHidden && d.IsHidden(i))
+#else
+      else if (!self->ShowHidden && (d.IsHidden(i) || fname[0] == '.'))
+#endif
+      {
+        // Do nothing for hidden files unless ShowHidden is On
+        // (on Linux and OS X, consider "." files to be hidden)
+      }
+      else if (d.IsDirectory(i))
+      {
+        subdirs->push_back(fileString);
+      }
+      else if (self->FilePattern == 0 || self->FilePattern[0] == '\0' ||
+               vtkDICOMUtilities::PatternMatches(
+                 self->FilePattern, fileString.c_str()))
+      {
+        if (!d.IsSpecial(i) && !d.IsBroken(i))
+        {
+          files->push_back(fileString);
+        }
+      }
+    }
+  }
+
+  return true;
 }
 
 //----------------------------------------------------------------------------
@@ -129,6 +1072,34 @@ bool vtkDICOMDirectory::CompareInstance(
 
 namespace {
 
+// Append the files from "first" to "last" to the read order, after
+// sorting them by their location on disk
+void AppendReadOrder(
+  std::vector<vtkIdType> *readOrder, vtkStringArray *input,
+  const std::deque<std::string>& found, vtkIdType first, vtkIdType last,
+  int order)
+{
+  vtkIdType numberOfInputs = input->GetNumberOfValues();
+  int n = static_cast<int>(last - first);
+  if (n > 0)
+  {
+    std::vector<const char *> names(n);
+    std::vector<int> indices(n);
+    for (int i = 0; i < n; i++)
+    {
+      vtkIdType j = first + i;
+      names[i] = (j < numberOfInputs ?
+                  input->GetValue(j).c_str() :
+                  found[j - numberOfInputs].c_str());
+    }
+    vtkDICOMFile::SortByLocation(&names[0], n, &indices[0], order);
+    for (int i = 0; i < n; i++)
+    {
+      readOrder->push_back(first + indices[i]);
+    }
+  }
+}
+
 static const DC::EnumType ScanTags[] = {
   // basic required information
   DC::SpecificCharacterSet, // 1C
@@ -205,49 +1176,6 @@ class vtkDICOMDirectory::SeriesInfoList
   : public std::list<vtkDICOMDirectory::SeriesInfo>
 {};
 
-//----------------------------------------------------------------------------
-// A helper class for building a sorted list of unique tags
-class SortedTags : public std::vector<vtkDICOMTag>
-{
-public:
-  void SetFrom(const vtkDICOMItem& patientRecord,
-               const vtkDICOMItem& studyRecord,
-               const vtkDICOMItem& seriesRecord);
-};
-
-void SortedTags::SetFrom(const vtkDICOMItem& patientRecord,
-                         const vtkDICOMItem& studyRecord,
-                         const vtkDICOMItem& seriesRecord)
-{
-  this->clear();
-  this->reserve(patientRecord.GetNumberOfDataElements() +
-                studyRecord.GetNumberOfDataElements() +
-                seriesRecord.GetNumberOfDataElements());
-
-  const vtkDICOMItem *records[3] = {
-    &patientRecord, &studyRecord, &seriesRecord
-  };
-
-  for (int i = 0; i < 3; i++)
-  {
-    vtkDICOMDataElementIterator iter = records[i]->Begin();
-    vtkDICOMDataElementIterator iterEnd = records[i]->End();
-
-    while (iter != iterEnd)
-    {
-      vtkDICOMTag tag = iter->GetTag();
-      std::vector<vtkDICOMTag>::iterator pos =
-        std::lower_bound(begin(), end(), tag);
-      if (*pos != tag)
-      {
-        this->insert(pos, tag);
-      }
-
-      ++iter;
-    }
-  }
-}
-
 //----------------------------------------------------------------------------
 vtkDICOMDirectory::vtkDICOMDirectory()
 {
@@ -259,8 +1187,18 @@ vtkDICOMDirectory::vtkDICOMDirectory()
   this->Series = new SeriesVector;
   this->Studies = new StudyVector;
   this->Patients = new PatientVector;
-  this->Visited = new VisitedVector;
+  this->FileNames = new FileNameStore;
+  this->Index = new AttributeIndex;
+  this->Index->Tags.push_back(DC::PatientID);
+  this->Index->Tags.push_back(DC::StudyDate);
+  this->Index->Tags.push_back(DC::Modality);
+  this->BuildingIndex = false;
+  this->Visited = new VisitedSet;
+  this->Walker = new DirectoryWalker(this);
+  this->RecordWalker = 0;
   this->FileSetID = 0;
+  this->NumberOfReads = 0;
+  this->NumberOfBytesRead = 0;
   this->InternalFileName = 0;
   this->QueryFiles = -1;
   this->IgnoreDicomdir = 0;
@@ -268,9 +1206,17 @@ vtkDICOMDirectory::vtkDICOMDirectory()
   this->FollowSymlinks = 1;
   this->ShowHidden = 1;
   this->ScanDepth = 1;
+  this->NumberOfThreads = 0;
+  this->ReadOrder = vtkDICOMFile::NameOrder;
+  this->ReadAhead = 0;
+  this->Incremental = 0;
+  this->KeepIndex = 0;
   this->Query = 0;
+  this->QueryMatcher = new vtkDICOMQueryMatcher;
   this->FindLevel = vtkDICOMDirectory::IMAGE;
   this->UsingOsirixDatabase = false;
+  this->NumberOfScannedSeries = 0;
+  this->NextScanIndex = -1;
   this->CurrentPatientRecord = 0;
   this->CurrentStudyRecord = 0;
   this->CurrentSeriesRecord = 0;
@@ -292,9 +1238,13 @@ vtkDICOMDirectory::~vtkDICOMDirectory()
   delete this->Series;
   delete this->Studies;
   delete this->Patients;
+  delete this->FileNames;
+  delete this->Index;
   delete this->Visited;
+  delete this->Walker;
   delete [] this->FileSetID;
   delete this->Query;
+  delete this->QueryMatcher;
 }
 
 //----------------------------------------------------------------------------
@@ -328,12 +1278,29 @@ void vtkDICOMDirectory::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "FollowSymlinks: "
      << (this->FollowSymlinks ? "On\n" : "Off\n");
 
+  os << indent << "NumberOfThreads: " << this->NumberOfThreads << "\n";
+
+  os << indent << "ReadOrder: "
+     << (this->ReadOrder == vtkDICOMFile::IndexOrder ? "Index\n" :
+         (this->ReadOrder == vtkDICOMFile::PhysicalOrder ?
+          "Physical\n" : "Name\n"));
+
+  os << indent << "ReadAhead: " << this->ReadAhead << "\n";
+
+  os << indent << "Incremental: "
+     << (this->Incremental ? "On\n" : "Off\n");
+
+  os << indent << "KeepIndex: "
+     << (this->KeepIndex ? "On\n" : "Off\n");
+
   os << indent << "NumberOfSeries: " << this->GetNumberOfSeries() << "\n";
   os << indent << "NumberOfStudies: " << this->GetNumberOfStudies() << "\n";
   os << indent << "NumberOfPatients: " << this->GetNumberOfPatients() << "\n";
 
   os << indent << "FileSetID: "
      << (this->FileSetID ? this->FileSetID : "(NULL)") << "\n";
+  os << indent << "NumberOfReads: " << this->NumberOfReads << "\n";
+  os << indent << "NumberOfBytesRead: " << this->NumberOfBytesRead << "\n";
 }
 
 //----------------------------------------------------------------------------
@@ -354,6 +1321,7 @@ void vtkDICOMDirectory::SetDirectoryName(const char *name)
     strcpy(cp, name);
     this->DirectoryName = cp;
   }
+  this->InputTime.Modified();
   this->Modified();
 }
 
@@ -375,6 +1343,7 @@ void vtkDICOMDirectory::SetFilePattern(const char *name)
     strcpy(cp, name);
     this->FilePattern = cp;
   }
+  this->InputTime.Modified();
   this->Modified();
 }
 
@@ -395,6 +1364,7 @@ void vtkDICOMDirectory::SetInputFileNames(vtkStringArray *sa)
       }
       this->InputFileNames->DeepCopy(sa);
     }
+    this->InputTime.Modified();
     this->Modified();
   }
 }
@@ -413,6 +1383,7 @@ void vtkDICOMDirectory::AddInputFileNames(vtkStringArray *sa)
     {
       this->InputFileNames->InsertNextValue(sa->GetValue(i));
     }
+    this->InputTime.Modified();
     this->Modified();
   }
 }
@@ -424,11 +1395,15 @@ void vtkDICOMDirectory::SetFindQuery(const vtkDICOMItem& item)
   {
     delete this->Query;
     this->Query = 0;
+    this->QueryMatcher->Clear();
     if (!item.IsEmpty())
     {
       this->Query = new vtkDICOMItem;
       *(this->Query) = item;
+      // prepare the query once, since it is used for every record
+      this->QueryMatcher->SetQuery(item);
     }
+    this->Modified();
   }
 }
 
@@ -450,6 +1425,40 @@ void vtkDICOMDirectory::SetFindLevel(int level)
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::AddIndexTag(vtkDICOMTag tag)
+{
+  std::vector<vtkDICOMTag>& tags = this->Index->Tags;
+  if (std::find(tags.begin(), tags.end(), tag) == tags.end())
+  {
+    tags.push_back(tag);
+    // the files must be scanned again to get the values
+    this->InputTime.Modified();
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::RemoveAllIndexTags()
+{
+  if (!this->Index->Tags.empty())
+  {
+    this->Index->Tags.clear();
+    this->InputTime.Modified();
+    this->Modified();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::ClearIndex()
+{
+  if (this->Index->Valid)
+  {
+    this->Index->Clear();
+    this->Modified();
+  }
+}
+
 //----------------------------------------------------------------------------
 int vtkDICOMDirectory::GetNumberOfSeries()
 {
@@ -471,55 +1480,243 @@ int vtkDICOMDirectory::GetNumberOfStudies()
 //----------------------------------------------------------------------------
 const vtkDICOMItem& vtkDICOMDirectory::GetStudyRecord(int study)
 {
-  return (*this->Studies)[study].Record;
+  return (*this->Studies)[study].Record;
+}
+
+//----------------------------------------------------------------------------
+const vtkDICOMItem& vtkDICOMDirectory::GetPatientRecordForStudy(int study)
+{
+  return (*this->Studies)[study].PatientRecord;
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMDirectory::GetFirstSeriesForStudy(int study)
+{
+  return (*this->Studies)[study].FirstSeries;
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMDirectory::GetLastSeriesForStudy(int study)
+{
+  return (*this->Studies)[study].LastSeries;
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMDirectory::GetNumberOfPatients()
+{
+  return static_cast<int>(this->Patients->size());
+}
+
+//----------------------------------------------------------------------------
+const vtkDICOMItem& vtkDICOMDirectory::GetPatientRecord(int patient)
+{
+  return (*this->Patients)[patient].Record;
+}
+
+//----------------------------------------------------------------------------
+vtkIntArray *vtkDICOMDirectory::GetStudiesForPatient(int patient)
+{
+  return (*this->Patients)[patient].Studies;
+}
+
+//----------------------------------------------------------------------------
+vtkStringArray *vtkDICOMDirectory::GetFileNamesForSeries(int i)
+{
+  SeriesItem& item = (*this->Series)[i];
+  this->Series->FilesLock.Lock();
+  if (!item.Files && item.FirstFile >= 0)
+  {
+    // build the array from the compact storage on first request
+    vtkStringArray *files = vtkStringArray::New();
+    this->GetFileNamesForSeries(i, files);
+    item.Files = files;
+    files->Delete();
+  }
+  // once an array has been requested, it is kept until ReleaseSeries()
+  item.KeepFiles = true;
+  vtkStringArray *files = item.Files;
+  this->Series->FilesLock.Unlock();
+  return files;
 }
 
 //----------------------------------------------------------------------------
-const vtkDICOMItem& vtkDICOMDirectory::GetPatientRecordForStudy(int study)
+void vtkDICOMDirectory::GetFileNamesForSeries(int i, vtkStringArray *output)
 {
-  return (*this->Studies)[study].PatientRecord;
+  // this reads only the compact storage, so it needs no lock
+  const SeriesItem& item = (*this->Series)[i];
+  output->Initialize();
+  if (item.FirstFile >= 0)
+  {
+    output->SetNumberOfValues(item.NumberOfFiles);
+    for (vtkIdType j = 0; j < item.NumberOfFiles; j++)
+    {
+      output->SetValue(j, this->FileNames->Get(item.FirstFile + j));
+    }
+  }
 }
 
 //----------------------------------------------------------------------------
-int vtkDICOMDirectory::GetFirstSeriesForStudy(int study)
+int vtkDICOMDirectory::GetNumberOfFilesForSeries(int i)
 {
-  return (*this->Studies)[study].FirstSeries;
+  return static_cast<int>((*this->Series)[i].NumberOfFiles);
 }
 
 //----------------------------------------------------------------------------
-int vtkDICOMDirectory::GetLastSeriesForStudy(int study)
+vtkDICOMMetaData *vtkDICOMDirectory::GetMetaDataForSeries(int i)
 {
-  return (*this->Studies)[study].LastSeries;
+  return (*this->Series)[i].Meta;
 }
 
 //----------------------------------------------------------------------------
-int vtkDICOMDirectory::GetNumberOfPatients()
+int vtkDICOMDirectory::GetScanIndexForSeries(int i)
 {
-  return static_cast<int>(this->Patients->size());
+  return (*this->Series)[i].ScanIndex;
 }
 
 //----------------------------------------------------------------------------
-const vtkDICOMItem& vtkDICOMDirectory::GetPatientRecord(int patient)
+void vtkDICOMDirectory::ReleaseSeries(int i)
 {
-  return (*this->Patients)[patient].Record;
+  SeriesItem& item = (*this->Series)[i];
+  item.Files = NULL;
+  item.Meta = NULL;
+  if (item.FirstFile >= 0 &&
+      item.FirstFile + item.NumberOfFiles ==
+        this->FileNames->GetNumberOfFileNames())
+  {
+    // reclaim the storage if these are the most recent file names, as
+    // is the case when series are released as they arrive
+    this->FileNames->Truncate(item.FirstFile);
+  }
+  item.FirstFile = -1;
+  item.NumberOfFiles = 0;
 }
 
 //----------------------------------------------------------------------------
-vtkIntArray *vtkDICOMDirectory::GetStudiesForPatient(int patient)
+namespace {
+
+// Estimate the memory used by a value, including sequence items.
+size_t EstimateValueSize(const vtkDICOMValue& v);
+
+// Estimate the memory used by the data elements of an item.
+size_t EstimateElementsSize(
+  vtkDICOMDataElementIterator iter, vtkDICOMDataElementIterator iterEnd)
 {
-  return (*this->Patients)[patient].Studies;
+  size_t s = 0;
+  for (; iter != iterEnd; ++iter)
+  {
+    s += sizeof(vtkDICOMDataElement) + EstimateValueSize(iter->GetValue());
+  }
+  return s;
 }
 
-//----------------------------------------------------------------------------
-vtkStringArray *vtkDICOMDirectory::GetFileNamesForSeries(int i)
+size_t EstimateValueSize(const vtkDICOMValue& v)
 {
-  return (*this->Series)[i].Files;
+  // the size of the reference-counted header of each value
+  const size_t headerSize = 24;
+
+  size_t s = 0;
+  if (v.IsValid())
+  {
+    s = headerSize;
+    size_t n = v.GetNumberOfValues();
+    const vtkDICOMValue *vptr = v.GetMultiplexData();
+    const vtkDICOMItem *items = v.GetSequenceData();
+    if (vptr)
+    {
+      for (size_t i = 0; i < n; i++)
+      {
+        s += sizeof(vtkDICOMValue) + EstimateValueSize(vptr[i]);
+      }
+    }
+    else if (items)
+    {
+      for (size_t i = 0; i < n; i++)
+      {
+        s += sizeof(vtkDICOMItem) +
+          EstimateElementsSize(items[i].Begin(), items[i].End());
+      }
+    }
+    else
+    {
+      s += v.GetVL();
+    }
+  }
+  return s;
 }
 
+} // end anonymous namespace
+
 //----------------------------------------------------------------------------
-vtkDICOMMetaData *vtkDICOMDirectory::GetMetaDataForSeries(int i)
+unsigned long vtkDICOMDirectory::GetActualMemorySize()
 {
-  return (*this->Series)[i].Meta;
+  size_t s = this->FileNames->GetMemorySize();
+
+  for (SeriesVector::iterator iter = this->Series->begin();
+       iter != this->Series->end(); ++iter)
+  {
+    s += sizeof(SeriesItem);
+    s += EstimateElementsSize(iter->Record.Begin(), iter->Record.End());
+    if (iter->Meta)
+    {
+      s += EstimateElementsSize(iter->Meta->Begin(), iter->Meta->End());
+    }
+    if (iter->Files)
+    {
+      for (vtkIdType i = 0; i < iter->Files->GetNumberOfValues(); i++)
+      {
+        s += sizeof(std::string) + iter->Files->GetValue(i).capacity();
+      }
+    }
+  }
+
+  for (StudyVector::iterator iter = this->Studies->begin();
+       iter != this->Studies->end(); ++iter)
+  {
+    s += sizeof(StudyItem);
+    s += EstimateElementsSize(iter->Record.Begin(), iter->Record.End());
+  }
+
+  for (PatientVector::iterator iter = this->Patients->begin();
+       iter != this->Patients->end(); ++iter)
+  {
+    s += sizeof(PatientItem);
+    s += EstimateElementsSize(iter->Record.Begin(), iter->Record.End());
+  }
+
+  s += this->Index->FileNames.GetMemorySize();
+  std::vector<AttributeIndex::SeriesEntry>::iterator eiter;
+  for (eiter = this->Index->Series.begin();
+       eiter != this->Index->Series.end(); ++eiter)
+  {
+    s += sizeof(AttributeIndex::SeriesEntry);
+    s += EstimateElementsSize(
+      eiter->PatientRecord.Begin(), eiter->PatientRecord.End());
+    s += EstimateElementsSize(
+      eiter->StudyRecord.Begin(), eiter->StudyRecord.End());
+    s += EstimateElementsSize(
+      eiter->SeriesRecord.Begin(), eiter->SeriesRecord.End());
+    for (size_t i = 0; i < eiter->ImageRecords.size(); i++)
+    {
+      s += sizeof(vtkDICOMItem) + EstimateElementsSize(
+        eiter->ImageRecords[i].Begin(), eiter->ImageRecords[i].End());
+    }
+  }
+
+  std::vector<AttributeIndex::Column>::iterator citer;
+  for (citer = this->Index->Columns.begin();
+       citer != this->Index->Columns.end(); ++citer)
+  {
+    s += sizeof(AttributeIndex::Column);
+    s += citer->Offsets.capacity()*sizeof(size_t);
+    s += (citer->SeriesList.capacity() + citer->Unknown.capacity())*sizeof(int);
+    for (size_t i = 0; i < citer->Values.size(); i++)
+    {
+      s += sizeof(vtkDICOMValue) + EstimateValueSize(citer->Values[i]);
+    }
+  }
+
+  // convert to kibibytes, like vtkDataObject::GetActualMemorySize()
+  return static_cast<unsigned long>((s + 1023)/1024);
 }
 
 //----------------------------------------------------------------------------
@@ -670,7 +1867,7 @@ bool vtkDICOMDirectory::MatchesQuery(
           }
           else
           {
-            matched = u.Matches(v);
+            matched = this->QueryMatcher->Matches(tag, u);
           }
           if (matched)
           {
@@ -722,7 +1919,7 @@ int vtkDICOMDirectory::MatchesImageQuery(
             {
               fullyMatched = false;
             }
-            else if (!u.Matches(v))
+            else if (!this->QueryMatcher->Matches(tag, u))
             {
               misMatched = true;
               break;
@@ -840,6 +2037,10 @@ void vtkDICOMDirectory::AddSeriesWithQuery(
     // Create a new set of image records for the extra info
     std::vector<vtkDICOMItem> storeImageRecords(n);
     std::vector<const vtkDICOMItem *> newImageRecords;
+    for (vtkIdType i = 0; i < n; i++)
+    {
+      storeImageRecords[i] = *imageRecords[i];
+    }
     if (this->FindLevel < vtkDICOMDirectory::IMAGE)
     {
       newImageRecords.resize(n);
@@ -885,6 +2086,8 @@ void vtkDICOMDirectory::AddSeriesWithQuery(
         this->SetInternalFileName(fileName.c_str());
         parser->SetFileName(fileName.c_str());
         parser->Update();
+        this->NumberOfReads += parser->GetNumberOfReads();
+        this->NumberOfBytesRead += parser->GetNumberOfBytesRead();
         // Clear info used by RelayError
         this->CurrentPatientRecord = 0;
         this->CurrentStudyRecord = 0;
@@ -990,6 +2193,17 @@ void vtkDICOMDirectory::AddSeriesFileNames(
     return;
   }
 
+  if (this->BuildingIndex)
+  {
+    // the output will be made from the index after the scan, note
+    // that only series from SortFiles() come with a scan index
+    this->Index->AddSeries(patient, study, files,
+      patientRecord, studyRecord, seriesRecord, imageRecords,
+      (this->NextScanIndex >= 0), this->UsingOsirixDatabase);
+    this->NextScanIndex = -1;
+    return;
+  }
+
   // create an object to hold the meta data for each series
   vtkSmartPointer<vtkDICOMMetaData> meta =
     vtkSmartPointer<vtkDICOMMetaData>::New();
@@ -1007,12 +2221,103 @@ void vtkDICOMDirectory::AddSeriesFileNames(
   this->CopyRecord(meta, &studyRecord, -1);
   this->CopyRecord(meta, &patientRecord, -1);
 
-  (*this->Studies)[study].LastSeries = series++;
+  // series that were not seen during a scan (e.g. series from a DICOMDIR)
+  // are reported here, so that every file is reported exactly once
+  int scanIndex = this->NextScanIndex;
+  this->NextScanIndex = -1;
+  if (scanIndex < 0)
+  {
+    scanIndex = this->NumberOfScannedSeries++;
+    if (this->Incremental)
+    {
+      this->ReportPartialSeries(scanIndex, files, files,
+        patientRecord, studyRecord, seriesRecord);
+    }
+  }
+
+  (*this->Studies)[study].LastSeries = series;
   this->Series->push_back(SeriesItem());
   SeriesItem& item = this->Series->back();
   item.Record = seriesRecord;
   item.Files = files;
   item.Meta = meta;
+  item.FirstFile = this->FileNames->GetNumberOfFileNames();
+  item.NumberOfFiles = ni;
+  item.ScanIndex = scanIndex;
+  item.KeepFiles = false;
+  for (int ii = 0; ii < ni; ii++)
+  {
+    this->FileNames->Append(files->GetValue(ii));
+  }
+
+  // allow observers to consume the series as it arrives
+  this->InvokeEvent(vtkCommand::UpdateDataEvent, &series);
+
+  // keep only the compact copy of the file names, unless an observer
+  // asked for the array (if so, it is kept for later requests)
+  if (series < static_cast<int>(this->Series->size()) &&
+      !(*this->Series)[series].KeepFiles)
+  {
+    (*this->Series)[series].Files = NULL;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::ReportPartialSeries(
+  int scanIndex, vtkStringArray *files, vtkStringArray *newFiles,
+  const vtkDICOMItem& patientRecord,
+  const vtkDICOMItem& studyRecord,
+  const vtkDICOMItem& seriesRecord)
+{
+  if (this->BuildingIndex)
+  {
+    // the series will be reported when the output is made from the index
+    return;
+  }
+
+  PartialSeries callData;
+  callData.ScanIndex = scanIndex;
+  callData.FileNames = files;
+  callData.NewFileNames = newFiles;
+  callData.PatientRecord = &patientRecord;
+  callData.StudyRecord = &studyRecord;
+  callData.SeriesRecord = &seriesRecord;
+
+  this->InvokeEvent(PartialSeriesEvent, &callData);
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::ReportPartialSeries(SeriesInfo *info)
+{
+  info->Updated = false;
+  if (!info->QueryMatched)
+  {
+    // the files will be reported if a later file matches the query
+    return;
+  }
+
+  vtkSmartPointer<vtkStringArray> files =
+    vtkSmartPointer<vtkStringArray>::New();
+  vtkSmartPointer<vtkStringArray> newFiles =
+    vtkSmartPointer<vtkStringArray>::New();
+  vtkIdType n = static_cast<vtkIdType>(info->Files.size());
+  files->SetNumberOfValues(n);
+  for (vtkIdType i = 0; i < n; i++)
+  {
+    FileInfo& fileInfo = info->Files[i];
+    files->SetValue(i, fileInfo.FileName);
+    if (!fileInfo.Reported)
+    {
+      newFiles->InsertNextValue(fileInfo.FileName);
+      fileInfo.Reported = true;
+    }
+  }
+
+  if (newFiles->GetNumberOfValues() > 0)
+  {
+    this->ReportPartialSeries(info->ScanIndex, files, newFiles,
+      info->PatientRecord, info->StudyRecord, info->SeriesRecord);
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -1104,6 +2409,11 @@ void vtkDICOMDirectory::FillImageRecord(
   {
     while (iter != iterEnd && iter->GetTag().GetGroup() <= 0x0002)
     {
+      // keep the transfer syntax, since a DICOMDIR record needs it
+      if (iter->GetTag() == DC::TransferSyntaxUID)
+      {
+        item->Set(DC::TransferSyntaxUID, iter->GetValue());
+      }
       ++iter;
     }
   }
@@ -1116,7 +2426,7 @@ void vtkDICOMDirectory::FillImageRecord(
     {
       ++skip;
     }
-    if (tag == DC::SpecificCharacterSet || tag != *skip)
+    if (tag == DC::SpecificCharacterSet || skip == skipEnd || tag != *skip)
     {
       item->Set(tag, iter->GetValue());
     }
@@ -1176,6 +2486,8 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
     vtkCommand::ErrorEvent, this, &vtkDICOMDirectory::RelayError);
 
   parser->SetMetaData(meta);
+  parser->SetCheckFileFormat(true);
+  parser->SetAdaptiveBufferSize(true);
 
   for (const DC::EnumType *tagPtr = ScanTags;
        *tagPtr != DC::ItemDelimitationItem;
@@ -1185,6 +2497,17 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
     query->Set(*tagPtr, vtkDICOMValue(vr));
   }
 
+  if (this->BuildingIndex)
+  {
+    // add elements that will be stored in the index
+    std::vector<vtkDICOMTag>::const_iterator iter;
+    for (iter = this->Index->Tags.begin();
+         iter != this->Index->Tags.end(); ++iter)
+    {
+      query->Set(*iter, vtkDICOMValue(query->FindDictVR(0, *iter)));
+    }
+  }
+
   if (this->Query)
   {
     // add elements that the user requested for the query
@@ -1202,23 +2525,125 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
   parser->SetQuery(query);
 
   // To hold a list of tags to skip at the image level, because they
-  // will be stored at patient, study, or series level instead
+  // will be stored at patient, study, or series level instead (the image
+  // records are trimmed after the scan, since the patient, study, and
+  // series records can be replaced by those of an earlier file)
   SortedTags skip;
 
   // List of files
   SeriesInfoList sortedFiles;
   SeriesInfoList::iterator li;
 
-  vtkIdType numberOfStrings = input->GetNumberOfValues();
+  vtkIdType numberOfInputs = input->GetNumberOfValues();
+  vtkIdType numberOfStrings = numberOfInputs;
+
+  // The order in which to read the files, if not the given order
+  bool reorder = (this->ReadOrder != vtkDICOMFile::NameOrder);
+  std::vector<vtkIdType> readOrder;
+  if (reorder)
+  {
+    AppendReadOrder(&readOrder, input, std::deque<std::string>(),
+                    0, numberOfInputs, this->ReadOrder);
+  }
+
+  // The directory walker, if it is running, will provide more files
+  DirectoryWalker *walker = (this->Walker->IsRunning() ? this->Walker : 0);
+  bool walking = (walker != 0);
+  std::deque<std::string> foundFiles; // deque never moves its elements
+  std::vector<FilePosition> foundPositions;
+  std::vector<std::string> failedDirs;
+
+  // Read the headers of upcoming files in the background
+  vtkDICOMFileBatch *readAhead = 0;
+  vtkIdType readAheadIdx = 0;
+  if (this->ReadAhead > 0 && (numberOfStrings > 1 || walking))
+  {
+    readAhead = new vtkDICOMFileBatch(this->ReadAhead);
+  }
 
-  for (vtkIdType j = 0; j < numberOfStrings; j++)
+  // The series that have changed since they were last reported
+  std::vector<SeriesInfo *> updatedSeries;
+  double lastReportTime = 0.0;
+
+  for (vtkIdType j = 0; j < numberOfStrings || walking; j++)
   {
-    const std::string& fileName = input->GetValue(j);
+    // Report the changed series, at most four times per second unless
+    // we are about to wait for the walker
+    if (!updatedSeries.empty())
+    {
+      double t = 1e-6*vtkDICOMUtilities::GetUniversalTime();
+      if (t - lastReportTime >= 0.25 || j == numberOfStrings)
+      {
+        for (size_t k = 0; k < updatedSeries.size(); k++)
+        {
+          this->ReportPartialSeries(updatedSeries[k]);
+        }
+        updatedSeries.clear();
+        lastReportTime = t;
+      }
+    }
+
+    // Wait for the walker if all the files found so far have been sorted
+    while (j == numberOfStrings && walking)
+    {
+      walking = walker->GetFiles(&foundFiles, &foundPositions, &failedDirs);
+      vtkIdType first = numberOfStrings;
+      numberOfStrings =
+        numberOfInputs + static_cast<vtkIdType>(foundFiles.size());
+      if (reorder)
+      {
+        AppendReadOrder(&readOrder, input, foundFiles,
+                        first, numberOfStrings, this->ReadOrder);
+      }
+      for (size_t i = 0; i < failedDirs.size(); i++)
+      {
+        vtkErrorMacro(<< "Could not read directory " << failedDirs[i]);
+        this->ErrorCode = vtkErrorCode::CannotOpenFileError;
+      }
+      failedDirs.clear();
+    }
+    if (j == numberOfStrings)
+    {
+      break;
+    }
+
+    vtkIdType jj = (reorder ? readOrder[j] : j);
+    const std::string& fileName = (jj < numberOfInputs ?
+      input->GetValue(jj) : foundFiles[jj - numberOfInputs]);
+    FilePosition position = (jj < numberOfInputs ?
+      FilePosition(-1, jj) : foundPositions[jj - numberOfInputs]);
+
+    if (readAhead)
+    {
+      readAheadIdx = (readAheadIdx > j ? readAheadIdx : j + 1);
+      while (readAheadIdx < numberOfStrings &&
+             readAheadIdx <= j + this->ReadAhead)
+      {
+        vtkIdType kk = (reorder ? readOrder[readAheadIdx] : readAheadIdx);
+        const std::string& aheadName = (kk < numberOfInputs ?
+          input->GetValue(kk) : foundFiles[kk - numberOfInputs]);
+        readAhead->Prefetch(aheadName.c_str(), 0, parser->GetBufferSize());
+        readAheadIdx++;
+      }
+    }
+
+    // Read the file metadata, unless the file doesn't look like DICOM
+    meta->Initialize();
+    this->SetInternalFileName(fileName.c_str());
+    parser->SetFileName(fileName.c_str());
+    parser->Update();
+    this->NumberOfReads += parser->GetNumberOfReads();
+    this->NumberOfBytesRead += parser->GetNumberOfBytesRead();
 
     // Skip anything that does not look like a DICOM file.
-    if (!vtkDICOMUtilities::IsDICOMFile(fileName.c_str()))
+    if (!parser->GetFileIsDICOM())
     {
-      int code = vtkDICOMFile::Access(fileName.c_str(), vtkDICOMFile::In);
+      // If the file couldn't be read, find out why
+      int code = 0;
+      if (parser->GetFileError() != 0)
+      {
+        code = vtkDICOMFile::Access(fileName.c_str(), vtkDICOMFile::In);
+      }
       if (code != 0 && vtkDICOMFilePath(fileName.c_str()).IsSymlink())
       {
         if (code == vtkDICOMFile::AccessDenied)
@@ -1253,11 +2678,6 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
       continue;
     }
 
-    // Read the file metadata
-    meta->Initialize();
-    this->SetInternalFileName(fileName.c_str());
-    parser->SetFileName(fileName.c_str());
-    parser->Update();
     if (!parser->GetPixelDataFound())
     {
       if (!this->ErrorCode)
@@ -1271,7 +2691,15 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
     }
 
     // Check for abort and update progress at 1% intervals
-    if (!this->AbortExecute)
+    if (walking)
+    {
+      // the total is not yet known, but check for abort
+      if (j % 100 == 0)
+      {
+        this->UpdateProgress(0.0);
+      }
+    }
+    else if (!this->AbortExecute)
     {
       double progress = (j + 1.0)/numberOfStrings;
       if (progress == 1.0 || progress > this->GetProgress() + 0.01)
@@ -1282,6 +2710,7 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
     }
     if (this->AbortExecute)
     {
+      delete readAhead;
       return;
     }
 
@@ -1295,78 +2724,27 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
     // Insert the file into the sorted list
     FileInfo fileInfo;
     fileInfo.InstanceNumber = meta->Get(DC::InstanceNumber).AsUnsignedInt();
-    fileInfo.FileName = fileName.c_str(); // stored in input StringArray
+    fileInfo.FileName = fileName.c_str(); // stored in input or foundFiles
     fileInfo.ImageUID = meta->Get(DC::SOPInstanceUID);
-
-    const vtkDICOMValue& patientNameValue = meta->Get(DC::PatientName);
-    const vtkDICOMValue& patientIDValue = meta->Get(DC::PatientID);
-    const vtkDICOMValue& studyDateValue = meta->Get(DC::StudyDate);
-    const vtkDICOMValue& studyTimeValue = meta->Get(DC::StudyTime);
-    const vtkDICOMValue& studyUIDValue = meta->Get(DC::StudyInstanceUID);
-    const vtkDICOMValue& seriesUIDValue = meta->Get(DC::SeriesInstanceUID);
-    unsigned int seriesNumber = meta->Get(DC::SeriesNumber).AsUnsignedInt();
-
-    const char *patientName = patientNameValue.GetCharData();
-    const char *patientID = patientIDValue.GetCharData();
-    const char *studyDate = studyDateValue.GetCharData();
-    const char *studyTime = studyTimeValue.GetCharData();
-    const char *studyUID = studyUIDValue.GetCharData();
-    const char *seriesUID = seriesUIDValue.GetCharData();
+    fileInfo.Reported = false;
+
+    // The sort keys for the series that the file belongs to
+    SeriesInfo key;
+    key.PatientName = meta->Get(DC::PatientName);
+    key.PatientID = meta->Get(DC::PatientID);
+    key.StudyDate = meta->Get(DC::StudyDate);
+    key.StudyTime = meta->Get(DC::StudyTime);
+    key.StudyUID = meta->Get(DC::StudyInstanceUID);
+    key.SeriesUID = meta->Get(DC::SeriesInstanceUID);
+    key.SeriesNumber = meta->Get(DC::SeriesNumber).AsUnsignedInt();
+
+    const char *seriesUID = key.SeriesUID.GetCharData();
     const char *imageUID = fileInfo.ImageUID.GetCharData();
 
-    patientName = (patientName ? patientName : "");
-    patientID = (patientID ? patientID : "");
-
     bool foundSeries = false;
     for (li = sortedFiles.begin(); li != sortedFiles.end(); ++li)
     {
-      // Compare patient, then study, then series.
-      const char *patientName2 = li->PatientName.GetCharData();
-      patientName2 = (patientName2 ? patientName2 : "");
-      const char *patientID2 = li->PatientID.GetCharData();
-      patientID2 = (patientID2 ? patientID2 : "");
-      int c = strcmp(patientID2, patientID);
-      if (c != 0 || patientID[0] == '\0')
-      {
-        // Use ID to identify patient, but use name to sort.
-        int c2 = strcmp(patientName2, patientName);
-        c = (c2 == 0 ? c : c2);
-      }
-      if (c == 0)
-      {
-        c = vtkDICOMUtilities::CompareUIDs(
-          studyUID, li->StudyUID.GetCharData());
-        if (c != 0 || studyUID == 0)
-        {
-          // Use UID to identify study, but use date to sort.
-          int c2 = 0;
-          const char *studyDate2 = li->StudyDate.GetCharData();
-          if (studyDate && studyDate2)
-          {
-            c2 = strcmp(studyDate2, studyDate);
-            if (c2 == 0)
-            {
-              const char *studyTime2 = li->StudyTime.GetCharData();
-              if (studyTime2 && studyTime)
-              {
-                c2 = strcmp(studyTime, studyTime2);
-              }
-            }
-          }
-          c = (c2 == 0 ? c : c2);
-        }
-        if (c == 0)
-        {
-          c = vtkDICOMUtilities::CompareUIDs(
-            seriesUID, li->SeriesUID.GetCharData());
-          if (c != 0 || seriesUID == 0)
-          {
-            // Use UID to identify series, but use series number to sort.
-            int c2 = li->SeriesNumber - seriesNumber;
-            c = (c2 == 0 ? c : c2);
-          }
-        }
-      }
+      int c = CompareSeries(*li, key);
       if (c == 0 && seriesUID != 0)
       {
         // Use UID to identify the image, but use instance number to sort.
@@ -1401,12 +2779,43 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
           continue;
         }
 
+        // the records come from the first file in the input, so that
+        // they do not depend on the order in which the files are read
+        if (this->Walker->Precedes(position, li->RecordPosition))
+        {
+          li->RecordPosition = position;
+          this->FillPatientRecord(&li->PatientRecord, meta);
+          this->FillStudyRecord(&li->StudyRecord, meta);
+          this->FillSeriesRecord(&li->SeriesRecord, meta);
+
+          // the sort keys come from the records, so the series might move
+          li->PatientName = key.PatientName;
+          li->PatientID = key.PatientID;
+          li->StudyDate = key.StudyDate;
+          li->StudyTime = key.StudyTime;
+          li->StudyUID = key.StudyUID;
+          li->SeriesUID = key.SeriesUID;
+          li->SeriesNumber = key.SeriesNumber;
+          SeriesInfoList::iterator lj = sortedFiles.begin();
+          while (lj != sortedFiles.end() &&
+                 (lj == li || CompareSeries(*lj, *li) < 0))
+          {
+            ++lj;
+          }
+          sortedFiles.splice(lj, sortedFiles, li);
+        }
+
         std::vector<FileInfo>::iterator pos =
           li->Files.insert(
             std::upper_bound(li->Files.begin(), li->Files.end(), fileInfo,
               CompareInstance), fileInfo);
-        this->FillImageRecord(&pos->ImageRecord, meta, &skip[0], skip.size());
+        this->FillImageRecord(&pos->ImageRecord, meta, 0, 0);
         li->QueryMatched |= queryMatched;
+        if (this->Incremental && !li->Updated)
+        {
+          li->Updated = true;
+          updatedSeries.push_back(&(*li));
+        }
         foundSeries = true;
         break;
       }
@@ -1418,24 +2827,32 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
 
     if (!foundSeries)
     {
-      li = sortedFiles.insert(li, SeriesInfo());
-      li->PatientName = patientNameValue;
-      li->PatientID = patientIDValue;
-      li->StudyDate = studyDateValue;
-      li->StudyUID = studyUIDValue;
-      li->SeriesUID = seriesUIDValue;
-      li->SeriesNumber = seriesNumber;
+      li = sortedFiles.insert(li, key);
       li->Files.push_back(fileInfo);
       li->QueryMatched = queryMatched;
+      li->ScanIndex = this->NumberOfScannedSeries++;
+      li->RecordPosition = position;
+      li->Updated = false;
+      if (this->Incremental)
+      {
+        li->Updated = true;
+        updatedSeries.push_back(&(*li));
+      }
       this->FillPatientRecord(&li->PatientRecord, meta);
       this->FillStudyRecord(&li->StudyRecord, meta);
       this->FillSeriesRecord(&li->SeriesRecord, meta);
-      skip.SetFrom(li->PatientRecord, li->StudyRecord, li->SeriesRecord);
-      this->FillImageRecord(&li->Files.back().ImageRecord, meta,
-                            &skip[0], skip.size());
+      this->FillImageRecord(&li->Files.back().ImageRecord, meta, 0, 0);
     }
   }
 
+  delete readAhead;
+
+  // Report any files that have not yet been reported
+  for (size_t k = 0; k < updatedSeries.size(); k++)
+  {
+    this->ReportPartialSeries(updatedSeries[k]);
+  }
+
   // Visit each series and call AddSeriesFileNames
   int patientCount = this->GetNumberOfPatients();
   int studyCount = this->GetNumberOfStudies();
@@ -1467,14 +2884,20 @@ void vtkDICOMDirectory::SortFiles(vtkStringArray *input)
     vtkIdType n = static_cast<vtkIdType>(v.Files.size());
     sa->SetNumberOfValues(n);
     std::vector<const vtkDICOMItem *> imageRecords(n);
+    skip.SetFrom(v.PatientRecord, v.StudyRecord, v.SeriesRecord);
     for (vtkIdType i = 0; i < n; i++)
     {
       sa->SetValue(i, v.Files[i].FileName);
+      skip.Trim(&v.Files[i].ImageRecord);
       imageRecords[i] = &v.Files[i].ImageRecord;
     }
+    this->NextScanIndex = v.ScanIndex;
     this->AddSeriesFileNames(
       patientCount-1, studyCount-1, sa,
       v.PatientRecord, v.StudyRecord, v.SeriesRecord, &imageRecords[0]);
+
+    // the image records are no longer needed
+    std::vector<FileInfo>().swap(v.Files);
   }
 }
 
@@ -2008,140 +3431,262 @@ void vtkDICOMDirectory::ProcessOsirixDatabase(const char *fname)
 }
 
 //----------------------------------------------------------------------------
-void vtkDICOMDirectory::ProcessDirectoryFile(
-  const char *dirname, vtkDICOMMetaData *meta)
+// Helpers for walking the records in a DICOMDIR
+
+namespace {
+
+// The levels of the directory records that are of interest
+enum DirectoryRecordLevel
 {
-  // Get the ID of this file set (informative only).
-  if (meta->Has(DC::FileSetID))
+  PatientLevel,
+  StudyLevel,
+  SeriesLevel,
+  ImageLevel,
+  OtherLevel
+};
+
+// Get the level of a directory record
+int GetDirectoryRecordLevel(const vtkDICOMItem& item)
+{
+  const vtkDICOMValue& v = item.Get(DC::DirectoryRecordType);
+  std::string entryType = v.AsString();
+  if (entryType == "PATIENT")
   {
-    std::string fileSetID = meta->Get(DC::FileSetID).AsString();
-    this->FileSetID = new char[fileSetID.length() + 1];
-    strcpy(this->FileSetID, fileSetID.c_str());
+    return PatientLevel;
+  }
+  else if (entryType == "STUDY")
+  {
+    return StudyLevel;
+  }
+  else if (entryType == "SERIES")
+  {
+    return SeriesLevel;
   }
+  else if (entryType == "IMAGE")
+  {
+    return ImageLevel;
+  }
+  return OtherLevel;
+}
 
-  // Get the directory as a sequence.
-  const vtkDICOMValue& seq = meta->Get(DC::DirectoryRecordSequence);
-  unsigned int n = static_cast<unsigned int>(seq.GetNumberOfValues());
-  const vtkDICOMItem *items = seq.GetSequenceData();
+// An image record from a DICOMDIR, with its file name
+struct DirectoryImageEntry
+{
+  int InstanceNumber;
+  vtkDICOMItem Record;
+  std::string FileName;
+};
+
+bool CompareDirectoryImageEntry(
+  const DirectoryImageEntry& a, const DirectoryImageEntry& b)
+{
+  return (a.InstanceNumber < b.InstanceNumber);
+}
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+// Walk the records of a DICOMDIR while the records are being read.  The
+// records are linked by their byte offsets, and they are usually stored
+// in the same order as they are walked, so each series can be added as
+// soon as its records have been read.  Records that have been read but
+// not yet walked are kept in an offset index, and records are released
+// as soon as the walk has finished with them.
+class vtkDICOMDirectory::DirectoryRecordWalker
+{
+public:
+  DirectoryRecordWalker(
+    vtkDICOMDirectory *self, const char *dirname, vtkDICOMMetaData *meta);
+
+  // Set the size of the DICOMDIR, for progress reporting.
+  void SetSize(vtkTypeInt64 size) { this->Size = size; }
+
+  // Add a record, and walk as far as the records read so far allow.
+  void AddRecord(const vtkDICOMItem& record);
+
+  // Walk the remaining records, after the last record has been added.
+  void Finish();
+
+  // Get the number of series that have been added to the output.
+  int GetNumberOfSeriesAdded() { return this->NumberOfSeriesAdded; }
+
+private:
+  // Start the walk, the offset is used if the first offset is not set.
+  void Start(unsigned int offset);
+
+  // Walk the records, and if "final" is false, stop when a record
+  // is needed that has not been read yet.
+  void Walk(bool final);
+
+  // Add the images that were collected for the current series.
+  void AddSeries();
+
+  vtkDICOMDirectory *Self;
+  std::string DirName;
+  vtkDICOMMetaData *MetaData;
+  vtkTypeInt64 Size;
+  // the records that have been read, but not yet walked
+  std::map<unsigned int, vtkDICOMItem> Records;
+  unsigned int LastOffset;
+  bool Started;
+  // the state of the walk
+  unsigned int Offset;
+  std::vector<std::pair<unsigned int, int> > OffsetStack;
+  int EntryType;
+  int PatientIdx;
+  int StudyIdx;
+  vtkDICOMItem PatientRecord;
+  vtkDICOMItem StudyRecord;
+  vtkDICOMItem SeriesRecord;
+  std::vector<DirectoryImageEntry> Images;
+  int NumberOfSeriesAdded;
+};
+
+//----------------------------------------------------------------------------
+vtkDICOMDirectory::DirectoryRecordWalker::DirectoryRecordWalker(
+  vtkDICOMDirectory *self, const char *dirname, vtkDICOMMetaData *meta) :
+  Self(self), DirName(dirname), MetaData(meta), Size(0), LastOffset(0),
+  Started(false), Offset(0), EntryType(OtherLevel), NumberOfSeriesAdded(0)
+{
+  this->PatientIdx = self->GetNumberOfPatients();
+  this->StudyIdx = self->GetNumberOfStudies();
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::DirectoryRecordWalker::Start(unsigned int offset)
+{
+  // The attributes that precede the sequence are in the meta data.
+  vtkDICOMMetaData *meta = this->MetaData;
 
-  // The DICOMDIR uses byte offsets to identify items in the sequence.
-  std::map<unsigned int, unsigned int> offsetToIndexMap;
-  for (unsigned int i = 0; i < n; i++)
+  // Get the ID of this file set (informative only).
+  if (meta->Has(DC::FileSetID))
   {
-    offsetToIndexMap[items[i].GetByteOffset()] = i;
+    std::string fileSetID = meta->Get(DC::FileSetID).AsString();
+    this->Self->FileSetID = new char[fileSetID.length() + 1];
+    strcpy(this->Self->FileSetID, fileSetID.c_str());
   }
 
   // Get the first entry.
-  unsigned int offset =
+  this->Offset =
     meta->Get(DC::OffsetOfTheFirstDirectoryRecordOfTheRootDirectoryEntity)
         .AsUnsignedInt();
 
   // This check is just for insurance.
-  if (offset == 0 && n > 0)
+  if (this->Offset == 0)
   {
-    offset = items[0].GetByteOffset();
+    this->Offset = offset;
   }
 
-  // To track progress, count number of items processed.
-  unsigned int itemCounter = 0;
+  this->Started = true;
+}
 
-  // Check for abort.
-  if (!this->AbortExecute)
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::DirectoryRecordWalker::Finish()
+{
+  if (!this->Started)
   {
-    this->UpdateProgress(0.0);
+    // There were no records.
+    this->Start(0);
   }
-  if (this->AbortExecute)
+  this->Walk(true);
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::DirectoryRecordWalker::AddRecord(
+  const vtkDICOMItem& record)
+{
+  unsigned int offset = record.GetByteOffset();
+
+  if (!this->Started)
   {
-    return;
+    this->Start(offset);
   }
 
-  // A stack to track the directory level.
-  std::vector<std::pair<unsigned int, std::string> > offsetStack;
-  int patientIdx = this->GetNumberOfPatients();
-  int studyIdx = this->GetNumberOfStudies();
-  unsigned int patientItem = 0;
-  unsigned int studyItem = 0;
-  unsigned int seriesItem = 0;
+  // The records are read in file order, i.e. in order of their offsets.
+  this->Records.insert(this->Records.end(), std::make_pair(offset, record));
+  if (offset > this->LastOffset)
+  {
+    this->LastOffset = offset;
+  }
 
-  // List of filenames for the current series.
-  vtkSmartPointer<vtkStringArray> fileNames =
-    vtkSmartPointer<vtkStringArray>::New();
-  std::vector<const vtkDICOMItem *> imageRecords;
+  this->Walk(false);
+}
 
-  // The entry type that is currently being processed.
-  std::string entryType;
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::DirectoryRecordWalker::Walk(bool final)
+{
+  vtkDICOMDirectory *self = this->Self;
 
   // Go through the directory, using the "next" and "child" pointers.
-  while (offset != 0)
+  while (this->Offset != 0 && !self->AbortExecute)
   {
+    std::map<unsigned int, vtkDICOMItem>::iterator iter =
+      this->Records.find(this->Offset);
+
+    if (iter == this->Records.end() && !final &&
+        this->Offset > this->LastOffset)
+    {
+      // Wait until the record has been read.
+      return;
+    }
+
+    unsigned int offset = 0;
     unsigned int offsetOfChild = 0;
-    std::map<unsigned int, unsigned int>::iterator iter =
-      offsetToIndexMap.find(offset);
-    offset = 0;
 
-    if (iter != offsetToIndexMap.end() && iter->second != 0xffffffffu)
+    // A record is removed when it is walked, so that a loop in the
+    // links will find a missing record and stop.
+    if (iter != this->Records.end())
     {
-      // Get the item index, mark the item as used.
-      unsigned int j = iter->second;
-      iter->second = 0xffffffffu;
+      vtkDICOMItem record = iter->second;
+      this->Records.erase(iter);
 
-      offset = items[j].Get(
+      offset = record.Get(
         DC::OffsetOfTheNextDirectoryRecord).AsUnsignedInt();
 
-      offsetOfChild = items[j].Get(
+      offsetOfChild = record.Get(
         DC::OffsetOfReferencedLowerLevelDirectoryEntity).AsUnsignedInt();
 
-      entryType = items[j].Get(
-        DC::DirectoryRecordType).AsString();
+      this->EntryType = GetDirectoryRecordLevel(record);
 
-      if (entryType == "PATIENT")
+      if (this->EntryType == PatientLevel)
       {
-        patientItem = j;
+        this->PatientRecord = record;
       }
-      else if (entryType == "STUDY")
+      else if (this->EntryType == StudyLevel)
       {
-        studyItem = j;
+        this->StudyRecord = record;
       }
-      else if (entryType == "SERIES")
+      else if (this->EntryType == SeriesLevel)
       {
-        seriesItem = j;
+        this->SeriesRecord = record;
       }
-      else if (entryType == "IMAGE" || !this->RequirePixelData)
+      else if (this->EntryType == ImageLevel || !self->RequirePixelData)
       {
-        const vtkDICOMValue& fileID = items[j].Get(DC::ReferencedFileID);
-        if (fileID.IsValid())
+        const vtkDICOMValue& fileID = record.Get(DC::ReferencedFileID);
+        size_t m = fileID.GetNumberOfValues();
+        if (m > 0)
         {
-          size_t m = fileID.GetNumberOfValues();
-          if (m > 0)
+          vtkDICOMFilePath path(this->DirName);
+          for (size_t k = 0; k < m; k++)
           {
-            vtkDICOMFilePath path(dirname);
-            for (size_t k = 0; k < m; k++)
-            {
-              path.PushBack(fileID.GetString(k));
-            }
-            vtkIdType ki = fileNames->InsertNextValue(path.AsString());
-            imageRecords.push_back(&items[j]);
-            // sort the files by instance number, they will almost always
-            // already be in order so we use a simple algorithm
-            int inst = items[j].Get(DC::InstanceNumber).AsInt();
-            while (ki > 0)
-            {
-              const vtkDICOMItem *prev = imageRecords[--ki];
-              int inst2 = prev->Get(DC::InstanceNumber).AsInt();
-              if (inst < inst2)
-              {
-                std::string s = fileNames->GetValue(ki + 1);
-                fileNames->SetValue(ki + 1, fileNames->GetValue(ki));
-                fileNames->SetValue(ki, s);
-                std::swap(imageRecords[ki], imageRecords[ki + 1]);
-              }
-              else
-              {
-                // sorting is finished!
-                break;
-              }
-            }
+            path.PushBack(fileID.GetString(k));
           }
+          this->Images.push_back(DirectoryImageEntry());
+          DirectoryImageEntry& image = this->Images.back();
+          image.InstanceNumber = record.Get(DC::InstanceNumber).AsInt();
+          image.Record = record;
+          image.FileName = path.AsString();
+        }
+      }
+
+      // Update the progress at 1% intervals
+      if (this->Size > 0)
+      {
+        double progress = static_cast<double>(this->Offset)/this->Size;
+        if (progress > self->GetProgress() + 0.01)
+        {
+          progress = static_cast<int>(progress*100.0)/100.0;
+          self->UpdateProgress(progress);
         }
       }
     }
@@ -2149,61 +3694,126 @@ void vtkDICOMDirectory::ProcessDirectoryFile(
     if (offsetOfChild != 0)
     {
       // Go up one directory level.
-      offsetStack.push_back(std::make_pair(offset, entryType));
+      this->OffsetStack.push_back(std::make_pair(offset, this->EntryType));
       offset = offsetOfChild;
     }
     else
     {
       // Pop the stack until the next offset is not zero.
-      while (offset == 0 && offsetStack.size() > 0)
+      while (offset == 0 && this->OffsetStack.size() > 0)
       {
         // Go down one directory level.
-        offset = offsetStack.back().first;
-        entryType = offsetStack.back().second;
-        offsetStack.pop_back();
+        offset = this->OffsetStack.back().first;
+        this->EntryType = this->OffsetStack.back().second;
+        this->OffsetStack.pop_back();
 
-        if (entryType == "PATIENT")
+        if (this->EntryType == PatientLevel)
         {
           // Get current max patient index plus one
-          patientIdx = this->GetNumberOfPatients();
+          this->PatientIdx = self->GetNumberOfPatients();
         }
-        else if (entryType == "STUDY")
+        else if (this->EntryType == StudyLevel)
         {
           // Get current max study index plus one
-          studyIdx = this->GetNumberOfStudies();
+          this->StudyIdx = self->GetNumberOfStudies();
         }
-        else if (entryType == "SERIES")
+        else if (this->EntryType == SeriesLevel)
         {
-          if (!imageRecords.empty())
-          {
-            // Add the series if it passes the query
-            this->AddSeriesWithQuery(
-              patientIdx, studyIdx, fileNames,
-              items[patientItem], items[studyItem], items[seriesItem],
-              &imageRecords[0]);
-
-            fileNames = vtkSmartPointer<vtkStringArray>::New();
-            imageRecords.clear();
-          }
+          this->AddSeries();
         }
       }
     }
 
-    // Check for abort and update progress at 1% intervals
-    if (!this->AbortExecute)
-    {
-      double progress = (itemCounter + 1.0)/n;
-      if (progress == 1.0 || progress > this->GetProgress() + 0.01)
-      {
-        progress = static_cast<int>(progress*100.0)/100.0;
-        this->UpdateProgress(progress);
-      }
-    }
-    if (this->AbortExecute)
-    {
-      return;
-    }
-    ++itemCounter;
+    this->Offset = offset;
+  }
+
+  if (final)
+  {
+    // Release any records that were never reached.
+    this->Records.clear();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::DirectoryRecordWalker::AddSeries()
+{
+  if (this->Images.empty())
+  {
+    return;
+  }
+
+  // Sort by instance number, and keep the DICOMDIR order for
+  // images that have the same instance number
+  std::stable_sort(this->Images.begin(), this->Images.end(),
+                   CompareDirectoryImageEntry);
+
+  size_t m = this->Images.size();
+  vtkSmartPointer<vtkStringArray> fileNames =
+    vtkSmartPointer<vtkStringArray>::New();
+  fileNames->SetNumberOfValues(static_cast<vtkIdType>(m));
+  std::vector<const vtkDICOMItem *> imageRecords(m);
+  for (size_t k = 0; k < m; k++)
+  {
+    fileNames->SetValue(static_cast<vtkIdType>(k),
+                        this->Images[k].FileName);
+    imageRecords[k] = &this->Images[k].Record;
+  }
+
+  // Add the series if it passes the query
+  this->Self->AddSeriesWithQuery(
+    this->PatientIdx, this->StudyIdx, fileNames,
+    this->PatientRecord, this->StudyRecord, this->SeriesRecord,
+    &imageRecords[0]);
+
+  // Release the image records
+  this->Images.clear();
+  this->NumberOfSeriesAdded++;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::ProcessDirectoryFile(
+  const char *dirname, vtkDICOMMetaData *meta)
+{
+  // Get the directory as a sequence.
+  const vtkDICOMValue& seq = meta->Get(DC::DirectoryRecordSequence);
+  unsigned int n = static_cast<unsigned int>(seq.GetNumberOfValues());
+  const vtkDICOMItem *items = seq.GetSequenceData();
+
+  // Check for abort.
+  if (!this->AbortExecute)
+  {
+    this->UpdateProgress(0.0);
+  }
+  if (this->AbortExecute)
+  {
+    return;
+  }
+
+  // Walk the records, using the offset of the last record for progress.
+  DirectoryRecordWalker walker(this, dirname, meta);
+  walker.SetSize(n > 0 ? items[n-1].GetByteOffset() + 1 : 0);
+  for (unsigned int i = 0; i < n && !this->AbortExecute; i++)
+  {
+    walker.AddRecord(items[i]);
+  }
+  walker.Finish();
+
+  if (!this->AbortExecute)
+  {
+    this->UpdateProgress(1.0);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::AddDirectoryRecord(
+  vtkObject *o, unsigned long e, void *data)
+{
+  vtkDICOMParser *parser = vtkDICOMParser::SafeDownCast(o);
+  if (e == vtkDICOMParser::SequenceItemEvent && parser &&
+      this->RecordWalker && !this->AbortExecute)
+  {
+    this->RecordWalker->SetSize(parser->GetFileSize());
+    this->RecordWalker->AddRecord(*static_cast<vtkDICOMItem *>(data));
   }
 }
 
@@ -2213,15 +3823,9 @@ void vtkDICOMDirectory::ProcessDirectory(
 {
   // Check if the directory has been visited yet.  This avoids infinite
   // recursion when following circular links.
-  std::string realname = vtkDICOMFilePath(dirname).GetRealPath();
-  std::vector<std::string>::iterator viter =
-    std::lower_bound(this->Visited->begin(), this->Visited->end(), realname);
-  if (viter == this->Visited->end() || *viter != realname)
-  {
-    // Add this directory to the "visited" list.
-    this->Visited->insert(viter, realname);
-  }
-  else
+  vtkDICOMFile::Size device, index;
+  if (vtkDICOMFile::GetFileIndex(dirname, &device, &index) &&
+      !this->Visited->insert(std::make_pair(device, index)).second)
   {
     // This directory has already been visited.
     return;
@@ -2248,23 +3852,50 @@ void vtkDICOMDirectory::ProcessDirectory(
       parser->AddObserver(
         vtkCommand::ErrorEvent, this, &vtkDICOMDirectory::RelayError);
       parser->SetMetaData(meta);
+      // A DICOMDIR can be many megabytes, so use fewer, larger reads
+      parser->SetBufferSize(65536);
       this->SetInternalFileName(dicomdir.c_str());
       parser->SetFileName(dicomdir.c_str());
+
+      // Walk the directory records while they are being read, rather
+      // than keeping all of the records in the meta data.
+      if (!this->AbortExecute)
+      {
+        this->UpdateProgress(0.0);
+      }
+      DirectoryRecordWalker walker(this, dirname, meta);
+      this->RecordWalker = &walker;
+      parser->SetStreamingTag(DC::DirectoryRecordSequence);
+      parser->AddObserver(vtkDICOMParser::SequenceItemEvent,
+        this, &vtkDICOMDirectory::AddDirectoryRecord);
       parser->Update();
+      this->RecordWalker = 0;
+      this->NumberOfReads += parser->GetNumberOfReads();
+      this->NumberOfBytesRead += parser->GetNumberOfBytesRead();
       unsigned long errorCode = parser->GetErrorCode();
       parser->Delete();
 
-      if (errorCode && depth == 0)
+      if (this->AbortExecute)
       {
-        // Only fail if depth is zero.  Otherwise, we can ignore the
-        // DICOMDIR and look for the DICOM files directly.
-        this->ErrorCode = errorCode;
         return;
       }
-      else if (errorCode == 0)
+      else if (errorCode == 0 || walker.GetNumberOfSeriesAdded() > 0)
+      {
+        // Walk the records that are left.  If only part of the DICOMDIR
+        // could be read, keep the series that were already added.
+        walker.Finish();
+        this->UpdateProgress(1.0);
+        if (errorCode && depth == 0)
+        {
+          this->ErrorCode = errorCode;
+        }
+        return;
+      }
+      else if (depth == 0)
       {
-        // Process the DICOMDIR file.
-        this->ProcessDirectoryFile(dirname, meta);
+        // Only fail if depth is zero.  Otherwise, we can ignore the
+        // DICOMDIR and look for the DICOM files directly.
+        this->ErrorCode = errorCode;
         return;
       }
     }
@@ -2286,8 +3917,16 @@ void vtkDICOMDirectory::ProcessDirectory(
     return;
   }
 
-  vtkDICOMFileDirectory d(dirname);
-  if (d.GetError() != 0)
+  if (this->Walker->IsEnabled())
+  {
+    // Let the walker threads read the directory tree.
+    this->Walker->AddDirectory(dirname, depth, files->GetNumberOfValues());
+    return;
+  }
+
+  std::vector<std::string> fileList;
+  std::vector<std::string> subdirList;
+  if (!DirectoryWalker::ListDirectory(this, dirname, &fileList, &subdirList))
   {
     // Only fail at the initial depth.
     if (depth == this->ScanDepth)
@@ -2298,46 +3937,16 @@ void vtkDICOMDirectory::ProcessDirectory(
     }
   }
 
-  int n = d.GetNumberOfEntries();
-  for (int i = 0; i < n; i++)
+  for (size_t i = 0; i < fileList.size(); i++)
   {
-    const char *fname = d.GetEntry(i);
-    if ((fname[0] != '.' || (fname[1] != '\0' &&
-         (fname[1] != '.' || fname[2] != '\0'))) &&
-        strcmp(fname, "DICOMDIR") != 0)
+    files->InsertNextValue(fileList[i]);
+  }
+
+  if (depth > 1)
+  {
+    for (size_t i = 0; i < subdirList.size(); i++)
     {
-      path.PushBack(fname);
-      std::string fileString = path.AsString();
-      path.PopBack();
-      if (d.IsSymlink(i) && !this->FollowSymlinks)
-      {
-        // Do nothing unless FollowSymlinks is On
-      }
-#ifdef _WIN32
-      else if (!this->ShowHidden && d.IsHidden(i))
-#else
-      else if (!this->ShowHidden && (d.IsHidden(i) || fname[0] == '.'))
-#endif
-      {
-        // Do nothing for hidden files unless ShowHidden is On
-        // (on Linux and OS X, consider "." files to be hidden)
-      }
-      else if (d.IsDirectory(i))
-      {
-        if (depth > 1)
-        {
-          this->ProcessDirectory(fileString.c_str(), depth-1, files);
-        }
-      }
-      else if (this->FilePattern == 0 || this->FilePattern[0] == '\0' ||
-               vtkDICOMUtilities::PatternMatches(
-                 this->FilePattern, fileString.c_str()))
-      {
-        if (!d.IsSpecial(i) && !d.IsBroken(i))
-        {
-          files->InsertNextValue(fileString);
-        }
-      }
+      this->ProcessDirectory(subdirList[i].c_str(), depth-1, files);
     }
   }
 }
@@ -2349,13 +3958,49 @@ void vtkDICOMDirectory::Execute()
   this->Series->clear();
   this->Studies->clear();
   this->Patients->clear();
+  this->FileNames->Clear();
   this->Visited->clear();
   delete [] this->FileSetID;
+  this->NumberOfScannedSeries = 0;
+  this->NextScanIndex = -1;
+
+  // Decide whether to use threads to walk the directories
+  int numberOfThreads = this->NumberOfThreads;
+  if (numberOfThreads <= 0)
+  {
+    numberOfThreads = vtkMultiThreader::GetGlobalDefaultNumberOfThreads();
+  }
+  this->Walker->Reset(numberOfThreads);
   this->FileSetID = 0;
+  this->NumberOfReads = 0;
+  this->NumberOfBytesRead = 0;
   this->ErrorCode = 0;
 
   this->InvokeEvent(vtkCommand::StartEvent);
 
+  if (this->KeepIndex)
+  {
+    if (!this->IndexIsCurrent() && !this->BuildIndex())
+    {
+      return;
+    }
+    this->ProcessIndex();
+  }
+  else
+  {
+    this->Index->Clear();
+    if (!this->ScanInputs())
+    {
+      return;
+    }
+  }
+
+  this->InvokeEvent(vtkCommand::EndEvent);
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMDirectory::ScanInputs()
+{
   vtkSmartPointer<vtkStringArray> files =
     vtkSmartPointer<vtkStringArray>::New();
 
@@ -2384,25 +4029,25 @@ void vtkDICOMDirectory::Execute()
       {
         this->ErrorCode = vtkErrorCode::FileNotFoundError;
         vtkErrorMacro("File or directory not found: " << fname.c_str());
-        return;
+        return false;
       }
       else if (code == vtkDICOMFile::AccessDenied)
       {
         this->ErrorCode = vtkErrorCode::CannotOpenFileError;
         vtkErrorMacro("Permission denied: " << fname.c_str());
-        return;
+        return false;
       }
       else if (code == vtkDICOMFile::ImpossiblePath)
       {
         this->ErrorCode = vtkErrorCode::CannotOpenFileError;
         vtkErrorMacro("Bad file path: " << fname.c_str());
-        return;
+        return false;
       }
       else if (code != 0)
       {
         this->ErrorCode = vtkErrorCode::UnknownError;
         vtkErrorMacro("Unknown file error: " << fname.c_str());
-        return;
+        return false;
       }
       else if (vtkDICOMUtilities::PatternMatches("*.sql", fname.c_str()))
       {
@@ -2421,7 +4066,7 @@ void vtkDICOMDirectory::Execute()
     if (this->DirectoryName == 0)
     {
       // No directory is a valid input.  Return an empty output.
-      return;
+      return false;
     }
 
     int code = vtkDICOMFile::Access(this->DirectoryName, vtkDICOMFile::In);
@@ -2433,31 +4078,31 @@ void vtkDICOMDirectory::Execute()
     {
       this->ErrorCode = vtkErrorCode::FileNotFoundError;
       vtkErrorMacro("Directory not found: " << this->DirectoryName);
-      return;
+      return false;
     }
     else if (code == vtkDICOMFile::AccessDenied)
     {
       this->ErrorCode = vtkErrorCode::CannotOpenFileError;
       vtkErrorMacro("Permission denied: " << this->DirectoryName);
-      return;
+      return false;
     }
     else if (code == vtkDICOMFile::ImpossiblePath)
     {
       this->ErrorCode = vtkErrorCode::CannotOpenFileError;
       vtkErrorMacro("Bad file path: " << this->DirectoryName);
-      return;
+      return false;
     }
     else if (code != 0)
     {
       this->ErrorCode = vtkErrorCode::UnknownError;
       vtkErrorMacro("Unknown error: " << this->DirectoryName);
-      return;
+      return false;
     }
     else
     {
       this->ErrorCode = vtkErrorCode::CannotOpenFileError;
       vtkErrorMacro("Found a file, not a directory: " << this->DirectoryName);
-      return;
+      return false;
     }
   }
 
@@ -2468,15 +4113,160 @@ void vtkDICOMDirectory::Execute()
   }
   if (this->AbortExecute)
   {
-    return;
+    return false;
   }
 
-  if (files->GetNumberOfValues() > 0)
+  if (this->Walker->HasWork())
+  {
+    // Walk the directories while sorting the files
+    this->Walker->Execute(files);
+  }
+  else if (files->GetNumberOfValues() > 0)
   {
     this->SortFiles(files);
   }
 
-  this->InvokeEvent(vtkCommand::EndEvent);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMDirectory::BuildIndex()
+{
+  AttributeIndex *index = this->Index;
+  index->Clear();
+
+  // scan without the query, so that every series goes into the index
+  vtkDICOMItem *query = this->Query;
+  this->Query = 0;
+  this->BuildingIndex = true;
+  bool success = this->ScanInputs();
+  this->BuildingIndex = false;
+  this->Query = query;
+
+  // the patients and studies were counted while scanning
+  this->Studies->clear();
+  this->Patients->clear();
+  this->NumberOfScannedSeries = 0;
+
+  if (!success || this->AbortExecute)
+  {
+    index->Clear();
+    return false;
+  }
+
+  index->BuildColumns();
+  index->ErrorCode = this->ErrorCode;
+  index->FileSetID = (this->FileSetID ? this->FileSetID : "");
+  index->ScanDepth = this->ScanDepth;
+  index->IgnoreDicomdir = this->IgnoreDicomdir;
+  index->RequirePixelData = this->RequirePixelData;
+  index->FollowSymlinks = this->FollowSymlinks;
+  index->ShowHidden = this->ShowHidden;
+  index->DefaultCharacterSet = this->DefaultCharacterSet;
+  index->OverrideCharacterSet = this->OverrideCharacterSet;
+  index->BuildTime.Modified();
+  index->Valid = true;
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMDirectory::IndexIsCurrent()
+{
+  const AttributeIndex *index = this->Index;
+  return (index->Valid &&
+          index->BuildTime.GetMTime() > this->InputTime.GetMTime() &&
+          index->ScanDepth == this->ScanDepth &&
+          index->IgnoreDicomdir == this->IgnoreDicomdir &&
+          index->RequirePixelData == this->RequirePixelData &&
+          index->FollowSymlinks == this->FollowSymlinks &&
+          index->ShowHidden == this->ShowHidden &&
+          index->DefaultCharacterSet == this->DefaultCharacterSet &&
+          index->OverrideCharacterSet == this->OverrideCharacterSet);
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectory::ProcessIndex()
+{
+  const AttributeIndex *index = this->Index;
+
+  // restore the results of the scan
+  this->ErrorCode = index->ErrorCode;
+  delete [] this->FileSetID;
+  this->FileSetID = 0;
+  if (!index->FileSetID.empty())
+  {
+    this->FileSetID = new char[index->FileSetID.length() + 1];
+    strcpy(this->FileSetID, index->FileSetID.c_str());
+  }
+
+  // use the indexed values to skip series that cannot match
+  std::vector<int> selection;
+  index->Select(this->Query, *this->QueryMatcher, &selection);
+
+  // the patients and studies are renumbered as series are added
+  std::vector<int> patientMap(index->NumberOfPatients, -1);
+  std::vector<int> studyMap(index->NumberOfStudies, -1);
+  std::vector<const vtkDICOMItem *> imageRecords;
+
+  size_t n = selection.size();
+  for (size_t j = 0; j < n; j++)
+  {
+    const AttributeIndex::SeriesEntry& entry = index->Series[selection[j]];
+    int patient = patientMap[entry.Patient];
+    int study = studyMap[entry.Study];
+    patient = (patient >= 0 ? patient : this->GetNumberOfPatients());
+    study = (study >= 0 ? study : this->GetNumberOfStudies());
+
+    vtkIdType m = static_cast<vtkIdType>(entry.ImageRecords.size());
+    vtkSmartPointer<vtkStringArray> files =
+      vtkSmartPointer<vtkStringArray>::New();
+    files->SetNumberOfValues(m);
+    imageRecords.resize(m);
+    for (vtkIdType i = 0; i < m; i++)
+    {
+      files->SetValue(i, index->FileNames.Get(entry.FirstFile + i));
+      imageRecords[i] = &entry.ImageRecords[i];
+    }
+
+    // for scanned files, the query must be applied to every file, as it
+    // would have been during the scan, so QueryFiles "Never" is ignored
+    int queryFiles = this->QueryFiles;
+    if (entry.Scanned && queryFiles == 0)
+    {
+      this->QueryFiles = -1;
+    }
+
+    int numberOfSeries = this->GetNumberOfSeries();
+    this->UsingOsirixDatabase = entry.Osirix;
+    this->AddSeriesWithQuery(
+      patient, study, files,
+      entry.PatientRecord, entry.StudyRecord, entry.SeriesRecord,
+      &imageRecords[0]);
+    this->UsingOsirixDatabase = false;
+    this->QueryFiles = queryFiles;
+
+    if (this->GetNumberOfSeries() > numberOfSeries)
+    {
+      patientMap[entry.Patient] = patient;
+      studyMap[entry.Study] = study;
+    }
+
+    // Check for abort and update progress at 1% intervals
+    if (!this->AbortExecute)
+    {
+      double progress = (j + 1.0)/n;
+      if (progress == 1.0 || progress > this->GetProgress() + 0.01)
+      {
+        progress = static_cast<int>(progress*100.0)/100.0;
+        this->UpdateProgress(progress);
+      }
+    }
+    if (this->AbortExecute)
+    {
+      return;
+    }
+  }
 }
 
 //----------------------------------------------------------------------------
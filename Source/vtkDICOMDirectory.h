@@ -15,14 +15,17 @@
 #define vtkDICOMDirectory_h
 
 #include "vtkAlgorithm.h"
+#include "vtkCommand.h" // For UserEvent
 #include "vtkDICOMModule.h" // For export macro
 #include "vtkDICOMCharacterSet.h" // For character sets
+#include "vtkDICOMFile.h" // For read orders
 
 class vtkStringArray;
 class vtkIntArray;
 class vtkDICOMMetaData;
 class vtkDICOMItem;
 class vtkDICOMTag;
+class vtkDICOMQueryMatcher;
 
 //! Get information about all DICOM files within a directory.
 /*!
@@ -47,6 +50,29 @@ public:
     PATIENT, STUDY, SERIES, IMAGE, FRAME
   };
 
+  //! Event that reports a partial series during an incremental scan.
+  enum {
+    PartialSeriesEvent = vtkCommand::UserEvent + 2357
+  };
+
+  //! The call data for PartialSeriesEvent.
+  /*!
+   *  The ScanIndex identifies the series for the duration of the scan,
+   *  and GetScanIndexForSeries() can be used to find it in the final
+   *  results.  FileNames holds all of the files found so far for the
+   *  series, in sorted order, and NewFileNames holds the files that
+   *  have been found since the previous event for the series.
+   */
+  struct PartialSeries
+  {
+    int ScanIndex;
+    vtkStringArray *FileNames;
+    vtkStringArray *NewFileNames;
+    const vtkDICOMItem *PatientRecord;
+    const vtkDICOMItem *StudyRecord;
+    const vtkDICOMItem *SeriesRecord;
+  };
+
   //@{
   //! Set the input directory.
   /*!
@@ -104,6 +130,46 @@ public:
   void SetFindQuery(const vtkDICOMItem& query);
   //@}
 
+  //@{
+  //! Keep an index of the files, for answering repeated queries.
+  /*!
+   *  When this is On, the first Update() scans the files without the
+   *  find query, and keeps the patient, study, series, and image records
+   *  of every series in memory.  Any later Update() for which only the
+   *  find query, find level, or QueryFiles setting has changed will
+   *  apply the query to the index instead of scanning the files again.
+   *  The files are read only if the query has attributes that are not
+   *  in the index.  Changing the input, or any setting that affects
+   *  which files are found, will cause the files to be scanned again.
+   *  The default is Off.
+   */
+  vtkSetMacro(KeepIndex, int);
+  vtkBooleanMacro(KeepIndex, int);
+  int GetKeepIndex() { return this->KeepIndex; }
+
+  //! Add an attribute to be stored in the index.
+  /*!
+   *  The index always holds the attributes of the patient, study, and
+   *  series records, plus the image attributes that are needed to sort
+   *  the files.  The values of the attributes added here are kept for
+   *  every file, so that queries can use them without reading the files.
+   *  For each of these attributes, the distinct values are indexed, so
+   *  that each distinct value is checked against the query only once.
+   *  The default index tags are PatientID, StudyDate, and Modality.
+   */
+  void AddIndexTag(vtkDICOMTag tag);
+
+  //! Remove all of the index tags.
+  void RemoveAllIndexTags();
+
+  //! Discard the index, so that the next Update() will scan the files.
+  /*!
+   *  This should be called if the files might have changed since the
+   *  index was built.
+   */
+  void ClearIndex();
+  //@}
+
   //@{
   //! Specify the find level.
   /*!
@@ -184,16 +250,62 @@ public:
   int GetLastSeriesForStudy(int study);
 
   //! Get the file names for a specific series.
+  /*!
+   *  The file names are stored compactly, and the array is built the
+   *  first time it is requested for the series.  After that, the same
+   *  array is returned until ReleaseSeries() is called or until the
+   *  next update, and it belongs to this object.  It is safe to call
+   *  this method from several threads at once.  To go through the file
+   *  names of many series without keeping an array for each one, use
+   *  the method below that fills an array that is provided by the caller.
+   */
   vtkStringArray *GetFileNamesForSeries(int i);
 
+  //! Get the file names for a specific series, into the given array.
+  /*!
+   *  This reads the compact storage of the file names, without building
+   *  or keeping an array within this object, and it is thread-safe.
+   */
+  void GetFileNamesForSeries(int i, vtkStringArray *output);
+
+  //! Get the number of files in a specific series.
+  int GetNumberOfFilesForSeries(int i);
+
   //! Get the meta data for a specific series.
   /*!
    *  This provides a subset of the meta data of each file in the series.
    *  To be specific, it contains all the information from the patient,
    *  study, and, at the very minimum, the SOPClassUID, SOPInstanceUID,
-   *  and InstanceNumber for each file.
+   *  and InstanceNumber for each file.  If the files were scanned, or
+   *  if the DICOMDIR provided it, the TransferSyntaxUID is also given.
    */
   vtkDICOMMetaData *GetMetaDataForSeries(int i);
+
+  //! Get the index that a series had in the PartialSeriesEvent calls.
+  int GetScanIndexForSeries(int i);
+
+  //! Release the file names and meta data for a series.
+  /*!
+   *  Every time a series is added, an UpdateDataEvent is invoked with
+   *  a pointer to the series index as the call data.  An observer that
+   *  consumes each series as it arrives can call this method when it
+   *  is done with the series, in order to keep the memory use bounded
+   *  during large scans.  Afterwards, GetFileNamesForSeries() and
+   *  GetMetaDataForSeries() will return NULL for this series, but the
+   *  series, study, and patient records will remain.
+   */
+  void ReleaseSeries(int i);
+
+  //! Get the approximate memory used for the results, in kibibytes.
+  /*!
+   *  This includes the file names, the records, and the meta data for
+   *  each series that has not been released.  The file names are stored
+   *  compactly, but an array is created for each series whose file names
+   *  have been requested.  If KeepIndex is On, the index is included.
+   *  Values that are shared between records are counted once per record,
+   *  so this is an upper bound.
+   */
+  unsigned long GetActualMemorySize();
   //@}
 
   //! Set when to query the files, rather than just the DICOMDIR index.
@@ -219,6 +331,20 @@ public:
   const char *GetFileSetID() { return this->FileSetID; }
   //@}
 
+  //@{
+  //! Get the number of read calls that were used by the last Update().
+  /*!
+   *  This is the total for all of the files that were parsed, including
+   *  the DICOMDIR, and it shows how many round trips the scan needed on
+   *  high-latency storage.  It is zero if the query was answered from
+   *  the index (see KeepIndex) without reading any files.
+   */
+  vtkTypeInt64 GetNumberOfReads() { return this->NumberOfReads; }
+
+  //! Get the number of bytes that were read by the last Update().
+  vtkTypeInt64 GetNumberOfBytesRead() { return this->NumberOfBytesRead; }
+  //@}
+
   //@{
   //! Get the filename associated with the error code.
   const char *GetInternalFileName() { return this->InternalFileName; }
@@ -264,6 +390,73 @@ public:
   int GetShowHidden() { return this->ShowHidden; }
   //@}
 
+  //@{
+  //! Set the number of threads to use when walking directory trees.
+  /*!
+   *  When subdirectories are to be scanned, the directories are read
+   *  by several threads at once, and the files are scanned as soon as
+   *  they are found rather than after the whole tree has been walked.
+   *  This greatly reduces the scan time on network filesystems.  The
+   *  results do not depend on the number of threads, since the records
+   *  are taken from the file that a walk with one thread would find
+   *  first.  The default value of zero means that the VTK global default
+   *  number of threads will be used, while a value of one causes the
+   *  directories to be read one at a time before the files are scanned.
+   */
+  vtkSetMacro(NumberOfThreads, int);
+  int GetNumberOfThreads() { return this->NumberOfThreads; }
+  //@}
+
+  //@{
+  //! Set the order in which the files are scanned.
+  /*!
+   *  By default, the files are scanned in the order in which they were
+   *  found.  On spinning disks or on tape-backed storage, scanning the
+   *  files in the order of their location on disk can be several times
+   *  faster, because it avoids a seek for each file.  The IndexOrder
+   *  uses the inode number as a proxy for the location, while the
+   *  PhysicalOrder asks the filesystem where the file's data is stored.
+   *  The order of the results is not affected.
+   */
+  vtkSetMacro(ReadOrder, int);
+  void SetReadOrderToName() { this->SetReadOrder(vtkDICOMFile::NameOrder); }
+  void SetReadOrderToIndex() { this->SetReadOrder(vtkDICOMFile::IndexOrder); }
+  void SetReadOrderToPhysical() {
+    this->SetReadOrder(vtkDICOMFile::PhysicalOrder); }
+  int GetReadOrder() { return this->ReadOrder; }
+  //@}
+
+  //@{
+  //! Set the number of files to read ahead while scanning.
+  /*!
+   *  While each file is scanned, the headers of the next few files are
+   *  read into the system's file cache in the background, so that the
+   *  storage device is kept busy with several requests at once.  This
+   *  uses io_uring on Linux, or a small pool of threads otherwise (see
+   *  vtkDICOMFileBatch).  The default is zero, which disables it, and a
+   *  value of 16 is a good choice for network or spinning-disk storage.
+   */
+  vtkSetMacro(ReadAhead, int);
+  int GetReadAhead() { return this->ReadAhead; }
+  //@}
+
+  //@{
+  //! Report each series while the scan is still in progress.
+  /*!
+   *  When this is On, a PartialSeriesEvent is invoked whenever a series
+   *  is found or new files are added to it, at most a few times per
+   *  second, so that the first results can be used long before a large
+   *  scan is complete.  Every file that ends up in the results is given
+   *  as a "new" file exactly once, though a series given by one event
+   *  can be merged with later files into a different sorted order.  The
+   *  final results (and the UpdateDataEvent for each series) are the
+   *  same as when this is Off.  The default is Off.
+   */
+  vtkSetMacro(Incremental, int);
+  vtkBooleanMacro(Incremental, int);
+  int GetIncremental() { return this->Incremental; }
+  //@}
+
   //@{
   //! Set the character set to use if SpecificCharacterSet is missing.
   /*!
@@ -300,12 +493,18 @@ protected:
   int IgnoreDicomdir;
   int RequirePixelData;
   int FollowSymlinks;
+  int NumberOfThreads;
+  int ReadOrder;
+  int ReadAhead;
+  int Incremental;
+  int KeepIndex;
   int ShowHidden;
   int ScanDepth;
   vtkDICOMCharacterSet DefaultCharacterSet;
   bool OverrideCharacterSet;
 
   vtkTimeStamp UpdateTime;
+  vtkTimeStamp InputTime;
   char *InternalFileName;
 
   //! Fill the output filename array.
@@ -382,14 +581,31 @@ protected:
   void SetErrorCode(unsigned long e) { this->ErrorCode = e; }
 #endif
 
+  //! Scan the input files and directories, returns false on failure.
+  bool ScanInputs();
+
+  //! Scan the inputs without the query, and keep all records in the index.
+  bool BuildIndex();
+
+  //! Check whether the index was built with the current inputs.
+  bool IndexIsCurrent();
+
+  //! Add the series from the index that match the query.
+  void ProcessIndex();
+
   //! Add all of the series listed in a DICOMDIR file.
   /*!
    *  The provided directory should be the directory that contains
    *  the DICOMDIR file, rather than the DICOMDIR file itself.  The
    *  DICOMDIR file should be parsed before this method is called.
+   *  ProcessDirectory() does not use this method, instead it walks
+   *  the records while the DICOMDIR is being parsed.
    */
   void ProcessDirectoryFile(const char *dirname, vtkDICOMMetaData *meta);
 
+  //! Receive a DICOMDIR record from the parser, while it is parsing.
+  void AddDirectoryRecord(vtkObject *o, unsigned long e, void *data);
+
   //! Process a directory, and subdirs to the specified depth.
   void ProcessDirectory(
     const char *dirname, int depth, vtkStringArray *files);
@@ -397,6 +613,13 @@ protected:
   //! Process an OsiriX sqlite database file.
   void ProcessOsirixDatabase(const char *fname);
 
+  //! Invoke a PartialSeriesEvent for files that have not been reported.
+  void ReportPartialSeries(
+    int scanIndex, vtkStringArray *files, vtkStringArray *newFiles,
+    const vtkDICOMItem& patientRecord,
+    const vtkDICOMItem& studyRecord,
+    const vtkDICOMItem& seriesRecord);
+
   //! Copy attributes into a meta data object.
   void CopyRecord(
     vtkDICOMMetaData *meta, const vtkDICOMItem *item, int instance);
@@ -419,16 +642,30 @@ private:
   struct FileInfo;
   struct SeriesInfo;
   class SeriesInfoList;
-  class VisitedVector;
+  class FileNameStore;
+  class AttributeIndex;
+  class VisitedSet;
+  class DirectoryWalker;
+  class DirectoryRecordWalker;
 
   vtkDICOMItem *Query;
+  vtkDICOMQueryMatcher *QueryMatcher;
   int FindLevel;
   SeriesVector *Series;
   StudyVector *Studies;
   PatientVector *Patients;
-  VisitedVector *Visited;
+  FileNameStore *FileNames;
+  AttributeIndex *Index;
+  bool BuildingIndex;
+  VisitedSet *Visited;
+  DirectoryWalker *Walker;
+  DirectoryRecordWalker *RecordWalker;
   char *FileSetID;
+  vtkTypeInt64 NumberOfReads;
+  vtkTypeInt64 NumberOfBytesRead;
   bool UsingOsirixDatabase;
+  int NumberOfScannedSeries;
+  int NextScanIndex;
 
   const vtkDICOMItem *CurrentPatientRecord;
   const vtkDICOMItem *CurrentStudyRecord;
@@ -437,6 +674,12 @@ private:
 
   //! Compare FileInfo entries by instance number
   static bool CompareInstance(const FileInfo &fi1, const FileInfo &fi2);
+
+  //! Compare SeriesInfo entries by patient, study, and series.
+  static int CompareSeries(const SeriesInfo &si1, const SeriesInfo &si2);
+
+  //! Report the files of a series that were found since the last report.
+  void ReportPartialSeries(SeriesInfo *info);
 };
 
 #endif
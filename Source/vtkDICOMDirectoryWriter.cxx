@@ -0,0 +1,711 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDICOMDirectoryWriter.h"
+#include "vtkDICOMDirectory.h"
+#include "vtkDICOMCompiler.h"
+#include "vtkDICOMDictionary.h"
+#include "vtkDICOMFilePath.h"
+#include "vtkDICOMItem.h"
+#include "vtkDICOMMetaData.h"
+#include "vtkDICOMParser.h"
+#include "vtkDICOMSequence.h"
+
+#include "vtkObjectFactory.h"
+#include "vtkSmartPointer.h"
+#include "vtkStringArray.h"
+#include "vtkErrorCode.h"
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+
+vtkStandardNewMacro(vtkDICOMDirectoryWriter);
+
+//----------------------------------------------------------------------------
+// Information about each series that has been added.
+struct vtkDICOMDirectoryWriter::SeriesItem
+{
+  vtkDICOMItem PatientRecord;
+  vtkDICOMItem StudyRecord;
+  vtkDICOMItem SeriesRecord;
+  vtkSmartPointer<vtkDICOMMetaData> Meta;
+  vtkSmartPointer<vtkStringArray> Files;
+};
+
+class vtkDICOMDirectoryWriter::SeriesVector
+  : public std::vector<vtkDICOMDirectoryWriter::SeriesItem>
+{};
+
+//----------------------------------------------------------------------------
+namespace {
+
+// The MediaStorageSOPClassUID for a DICOMDIR
+const char *MediaStorageDirectoryStorage = "1.2.840.10008.1.3.10";
+
+// The record types for non-image SOP classes, a trailing period
+// indicates that the UID is a prefix for a family of SOP classes
+struct RecordTypeEntry
+{
+  const char *ClassUID;
+  const char *RecordType;
+};
+
+const RecordTypeEntry RecordTypes[] = {
+  { "1.2.840.10008.5.1.4.1.1.4.2", "SPECTROSCOPY" },
+  { "1.2.840.10008.5.1.4.1.1.9.", "WAVEFORM" },
+  { "1.2.840.10008.5.1.4.1.1.11.", "PRESENTATION" },
+  { "1.2.840.10008.5.1.4.1.1.66", "RAW DATA" },
+  { "1.2.840.10008.5.1.4.1.1.66.1", "REGISTRATION" },
+  { "1.2.840.10008.5.1.4.1.1.66.2", "FIDUCIAL" },
+  { "1.2.840.10008.5.1.4.1.1.66.3", "REGISTRATION" },
+  { "1.2.840.10008.5.1.4.1.1.66.5", "SURFACE" },
+  { "1.2.840.10008.5.1.4.1.1.67", "VALUE MAP" },
+  { "1.2.840.10008.5.1.4.1.1.88.59", "KEY OBJECT DOC" },
+  { "1.2.840.10008.5.1.4.1.1.88.", "SR DOCUMENT" },
+  { "1.2.840.10008.5.1.4.1.1.104.", "ENCAP DOC" },
+  { "1.2.840.10008.5.1.4.1.1.481.2", "RT DOSE" },
+  { "1.2.840.10008.5.1.4.1.1.481.3", "RT STRUCTURE SET" },
+  { "1.2.840.10008.5.1.4.1.1.481.4", "RT TREAT RECORD" },
+  { "1.2.840.10008.5.1.4.1.1.481.5", "RT PLAN" },
+  { "1.2.840.10008.5.1.4.1.1.481.6", "RT TREAT RECORD" },
+  { "1.2.840.10008.5.1.4.1.1.481.7", "RT TREAT RECORD" },
+  { "1.2.840.10008.5.1.4.1.1.481.8", "RT PLAN" },
+  { 0, 0 }
+};
+
+// Attributes that are required in each type of record (type 1 or 2)
+const DC::EnumType PatientKeys[] = {
+  DC::PatientName,
+  DC::PatientID,
+  DC::ItemDelimitationItem
+};
+
+const DC::EnumType StudyKeys[] = {
+  DC::StudyDate,
+  DC::StudyTime,
+  DC::AccessionNumber,
+  DC::StudyDescription,
+  DC::StudyInstanceUID,
+  DC::StudyID,
+  DC::ItemDelimitationItem
+};
+
+const DC::EnumType SeriesKeys[] = {
+  DC::Modality,
+  DC::SeriesInstanceUID,
+  DC::SeriesNumber,
+  DC::ItemDelimitationItem
+};
+
+const DC::EnumType ImageKeys[] = {
+  DC::InstanceNumber,
+  DC::ItemDelimitationItem
+};
+
+// Create a directory record from the given attributes
+vtkDICOMItem MakeRecord(
+  const char *recordType, const vtkDICOMItem& attributes,
+  const DC::EnumType *keys)
+{
+  vtkDICOMItem item;
+
+  // the offsets are set after the positions of the records are known
+  item.Set(DC::OffsetOfTheNextDirectoryRecord,
+           vtkDICOMValue(vtkDICOMVR::UL, 0u));
+  item.Set(DC::RecordInUseFlag,
+           vtkDICOMValue(vtkDICOMVR::US, 0xFFFFu));
+  item.Set(DC::OffsetOfReferencedLowerLevelDirectoryEntity,
+           vtkDICOMValue(vtkDICOMVR::UL, 0u));
+  item.Set(DC::DirectoryRecordType,
+           vtkDICOMValue(vtkDICOMVR::CS, recordType));
+
+  // skip the meta header and any DICOMDIR attributes
+  vtkDICOMDataElementIterator iter = attributes.Begin();
+  vtkDICOMDataElementIterator iterEnd = attributes.End();
+  for (; iter != iterEnd; ++iter)
+  {
+    unsigned short group = iter->GetTag().GetGroup();
+    if (group != 0x0002 && group != 0x0004)
+    {
+      item.Set(iter->GetTag(), iter->GetValue());
+    }
+  }
+
+  // add empty values for any missing keys
+  for (const DC::EnumType *key = keys; *key != DC::ItemDelimitationItem;
+       key++)
+  {
+    if (!item.Get(*key).IsValid())
+    {
+      item.Set(*key, vtkDICOMValue(item.FindDictVR(*key)));
+    }
+  }
+
+  return item;
+}
+
+// Set the offset attributes of a record
+void SetRecordOffsets(
+  vtkDICOMItem *item, unsigned int next, unsigned int lower)
+{
+  item->Set(DC::OffsetOfTheNextDirectoryRecord,
+            vtkDICOMValue(vtkDICOMVR::UL, next));
+  item->Set(DC::OffsetOfReferencedLowerLevelDirectoryEntity,
+            vtkDICOMValue(vtkDICOMVR::UL, lower));
+}
+
+// A helper class for converting file names into ReferencedFileID paths
+class FileIDMaker
+{
+public:
+  FileIDMaker(const char *dicomdir);
+
+  // The results of MakeFileID().
+  enum Result
+  {
+    Good,
+    OutsideDirectory,  // the file is not within the DICOMDIR directory
+    InvalidPath        // the path cannot be used as a ReferencedFileID
+  };
+
+  // Get the path relative to the DICOMDIR as a multi-valued string.
+  int MakeFileID(const std::string& fileName, std::string *fileID);
+
+  // Check that a path component is valid: at most 8 characters from
+  // the set A-Z, 0-9, and underscore.
+  static bool IsValidComponent(const std::string& s);
+
+private:
+  std::string BaseDir;
+  // real paths of directories, to avoid resolving them for every file
+  std::map<std::string, std::string> RealDirs;
+};
+
+FileIDMaker::FileIDMaker(const char *dicomdir)
+{
+  vtkDICOMFilePath path(dicomdir);
+  path.PopBack();
+  if (path.IsEmpty())
+  {
+    path = vtkDICOMFilePath(".");
+  }
+  this->BaseDir = path.GetRealPath();
+}
+
+bool FileIDMaker::IsValidComponent(const std::string& s)
+{
+  if (s.empty() || s.length() > 8)
+  {
+    return false;
+  }
+  for (size_t i = 0; i < s.length(); i++)
+  {
+    char c = s[i];
+    if ((c < 'A' || c > 'Z') && (c < '0' || c > '9') && c != '_')
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+int FileIDMaker::MakeFileID(const std::string& fileName, std::string *fileID)
+{
+  vtkDICOMFilePath path(fileName);
+  std::string name = path.GetBack();
+  path.PopBack();
+  if (path.IsEmpty())
+  {
+    path = vtkDICOMFilePath(".");
+  }
+
+  std::map<std::string, std::string>::iterator iter =
+    this->RealDirs.find(path.AsString());
+  if (iter == this->RealDirs.end())
+  {
+    iter = this->RealDirs.insert(
+      std::make_pair(path.AsString(), path.GetRealPath())).first;
+  }
+
+  // go up from the file's directory until the base directory is reached
+  std::vector<std::string> components;
+  vtkDICOMFilePath dirpath(iter->second);
+  while (dirpath.AsString() != this->BaseDir)
+  {
+    if (dirpath.IsRoot() || dirpath.IsEmpty())
+    {
+      // the file is not within the base directory
+      return OutsideDirectory;
+    }
+    components.push_back(dirpath.GetBack());
+    dirpath.PopBack();
+  }
+
+  // the file ID can have at most 8 components, including the file
+  if (components.size() >= 8 || !IsValidComponent(name))
+  {
+    return InvalidPath;
+  }
+  for (size_t i = 0; i < components.size(); i++)
+  {
+    if (!IsValidComponent(components[i]))
+    {
+      return InvalidPath;
+    }
+  }
+
+  // the components of the path are separated by backslashes
+  fileID->clear();
+  for (size_t i = components.size(); i > 0; i--)
+  {
+    fileID->append(components[i-1]);
+    fileID->push_back('\\');
+  }
+  fileID->append(name);
+
+  return Good;
+}
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+vtkDICOMDirectoryWriter::vtkDICOMDirectoryWriter()
+{
+  this->FileName = NULL;
+  this->FileSetID = NULL;
+  this->ErrorCode = 0;
+  this->Series = new SeriesVector;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMDirectoryWriter::~vtkDICOMDirectoryWriter()
+{
+  delete [] this->FileName;
+  delete [] this->FileSetID;
+  delete this->Series;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectoryWriter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "FileName: "
+     << (this->FileName ? this->FileName : "(NULL)") << "\n";
+  os << indent << "FileSetID: "
+     << (this->FileSetID ? this->FileSetID : "(NULL)") << "\n";
+  os << indent << "NumberOfSeries: " << this->GetNumberOfSeries() << "\n";
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectoryWriter::AddDirectory(vtkDICOMDirectory *dir)
+{
+  int n = dir->GetNumberOfSeries();
+  for (int i = 0; i < n; i++)
+  {
+    this->AddSeries(dir, i);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectoryWriter::AddSeries(
+  vtkDICOMDirectory *dir, int series, vtkStringArray *fileNames)
+{
+  vtkStringArray *files = dir->GetFileNamesForSeries(series);
+  vtkDICOMMetaData *meta = dir->GetMetaDataForSeries(series);
+  if (files == 0 || meta == 0)
+  {
+    vtkErrorMacro("AddSeries: Series " << series << " was released.");
+    return;
+  }
+  if (fileNames)
+  {
+    if (fileNames->GetNumberOfValues() != files->GetNumberOfValues())
+    {
+      vtkErrorMacro("AddSeries: Series " << series << " has "
+                    << files->GetNumberOfValues() << " files, but "
+                    << fileNames->GetNumberOfValues() << " were given.");
+      return;
+    }
+    files = fileNames;
+  }
+
+  // find the study that the series belongs to
+  int study = 0;
+  int numberOfStudies = dir->GetNumberOfStudies();
+  while (study < numberOfStudies &&
+         dir->GetLastSeriesForStudy(study) < series)
+  {
+    study++;
+  }
+
+  this->Series->push_back(SeriesItem());
+  SeriesItem& item = this->Series->back();
+  item.PatientRecord = dir->GetPatientRecordForStudy(study);
+  item.StudyRecord = dir->GetStudyRecord(study);
+  item.SeriesRecord = dir->GetSeriesRecord(series);
+  item.Meta = meta;
+  item.Files = vtkSmartPointer<vtkStringArray>::New();
+  item.Files->DeepCopy(files);
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMDirectoryWriter::GetNumberOfSeries()
+{
+  return static_cast<int>(this->Series->size());
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectoryWriter::RemoveAllSeries()
+{
+  this->Series->clear();
+}
+
+//----------------------------------------------------------------------------
+const char *vtkDICOMDirectoryWriter::GetRecordType(const char *classUID)
+{
+  if (classUID)
+  {
+    for (const RecordTypeEntry *entry = RecordTypes; entry->ClassUID;
+         entry++)
+    {
+      size_t n = strlen(entry->ClassUID);
+      if (strncmp(classUID, entry->ClassUID, n) == 0 &&
+          (classUID[n] == '\0' || entry->ClassUID[n-1] == '.'))
+      {
+        return entry->RecordType;
+      }
+    }
+  }
+
+  return "IMAGE";
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMDirectoryWriter::Write()
+{
+  this->ErrorCode = 0;
+
+  if (!this->FileName)
+  {
+    this->ErrorCode = vtkErrorCode::NoFileNameError;
+    vtkErrorMacro("Write: No file name has been set");
+    return;
+  }
+
+  // The records in the order in which they will be written (patient,
+  // then its first study, then the study's first series, then images),
+  // and the indices of the "next" and "lower level" records for each
+  std::vector<vtkDICOMItem> records;
+  std::vector<int> nextRecord;
+  std::vector<int> lowerRecord;
+
+  // The patients, studies, and series that have been added so far
+  std::map<std::string, int> patientMap;
+  std::map<std::string, int> studyMap;
+  std::map<std::string, int> seriesMap;
+  std::vector<int> patients;
+
+  FileIDMaker fileIDMaker(this->FileName);
+  vtkSmartPointer<vtkDICOMParser> parser;
+  vtkSmartPointer<vtkDICOMMetaData> fileMeta;
+
+  // To make sure that each record is added below its parent, the records
+  // are first collected into a tree and then flattened
+  std::vector<std::vector<int> > children;
+
+  for (SeriesVector::iterator si = this->Series->begin();
+       si != this->Series->end(); ++si)
+  {
+    // Skip the series if all of its files were left out
+    vtkIdType n = si->Files->GetNumberOfValues();
+    vtkIdType m = 0;
+    while (m < n && si->Files->GetValue(m).empty())
+    {
+      m++;
+    }
+    if (m == n)
+    {
+      continue;
+    }
+
+    // Get the patient record, or create it
+    std::string key = si->PatientRecord.Get(DC::PatientID).AsString();
+    key += '\\';
+    key += si->PatientRecord.Get(DC::PatientName).AsString();
+    std::map<std::string, int>::iterator pi = patientMap.find(key);
+    int patient;
+    if (pi != patientMap.end())
+    {
+      patient = pi->second;
+    }
+    else
+    {
+      patient = static_cast<int>(records.size());
+      records.push_back(
+        MakeRecord("PATIENT", si->PatientRecord, PatientKeys));
+      children.push_back(std::vector<int>());
+      patientMap[key] = patient;
+      patients.push_back(patient);
+    }
+
+    // Get the study record, or create it
+    key = si->StudyRecord.Get(DC::StudyInstanceUID).AsString();
+    std::map<std::string, int>::iterator ti = studyMap.find(key);
+    int study;
+    if (ti != studyMap.end())
+    {
+      study = ti->second;
+    }
+    else
+    {
+      study = static_cast<int>(records.size());
+      records.push_back(MakeRecord("STUDY", si->StudyRecord, StudyKeys));
+      children.push_back(std::vector<int>());
+      children[patient].push_back(study);
+      studyMap[key] = study;
+    }
+
+    // Get the series record, or create it
+    key = si->SeriesRecord.Get(DC::SeriesInstanceUID).AsString();
+    std::map<std::string, int>::iterator ri = seriesMap.find(key);
+    int series;
+    if (ri != seriesMap.end())
+    {
+      series = ri->second;
+    }
+    else
+    {
+      series = static_cast<int>(records.size());
+      records.push_back(MakeRecord("SERIES", si->SeriesRecord, SeriesKeys));
+      children.push_back(std::vector<int>());
+      children[study].push_back(series);
+      seriesMap[key] = series;
+    }
+
+    // The attributes that are stored at a higher level
+    std::set<vtkDICOMTag> higherLevel;
+    const vtkDICOMItem *higherRecords[3] = {
+      &si->PatientRecord, &si->StudyRecord, &si->SeriesRecord };
+    for (int k = 0; k < 3; k++)
+    {
+      vtkDICOMDataElementIterator iter = higherRecords[k]->Begin();
+      vtkDICOMDataElementIterator iterEnd = higherRecords[k]->End();
+      for (; iter != iterEnd; ++iter)
+      {
+        if (iter->GetTag() != DC::SpecificCharacterSet)
+        {
+          higherLevel.insert(iter->GetTag());
+        }
+      }
+    }
+
+    // Create the image records
+    vtkDICOMMetaData *meta = si->Meta;
+    for (vtkIdType i = m; i < n; i++)
+    {
+      const std::string& fileName = si->Files->GetValue(i);
+      if (fileName.empty())
+      {
+        // the file was left out of the DICOMDIR
+        continue;
+      }
+      std::string fileID;
+      int result = fileIDMaker.MakeFileID(fileName, &fileID);
+      if (result == FileIDMaker::OutsideDirectory)
+      {
+        this->ErrorCode = vtkErrorCode::FileFormatError;
+        vtkErrorMacro("Write: The file " << fileName << " is not within "
+                      "the directory of " << this->FileName);
+        return;
+      }
+      else if (result != FileIDMaker::Good)
+      {
+        this->ErrorCode = vtkErrorCode::FileFormatError;
+        vtkErrorMacro("Write: The path of " << fileName << " cannot be "
+                      "used in a DICOMDIR, which allows at most 8 levels, "
+                      "each with at most 8 characters from A-Z, 0-9, or _");
+        return;
+      }
+
+      // Collect the image-level attributes for this file
+      vtkDICOMItem attributes;
+      std::string classUID;
+      std::string instanceUID;
+      std::string transferSyntax;
+      vtkDICOMDataElementIterator iter = meta->Begin();
+      vtkDICOMDataElementIterator iterEnd = meta->End();
+      for (; iter != iterEnd; ++iter)
+      {
+        vtkDICOMTag tag = iter->GetTag();
+        const vtkDICOMValue& v = iter->GetValue(static_cast<int>(i));
+        if (tag == DC::SOPClassUID)
+        {
+          classUID = v.AsString();
+        }
+        else if (tag == DC::SOPInstanceUID)
+        {
+          instanceUID = v.AsString();
+        }
+        else if (tag == DC::TransferSyntaxUID)
+        {
+          transferSyntax = v.AsString();
+        }
+        else if (higherLevel.find(tag) == higherLevel.end())
+        {
+          attributes.Set(tag, v);
+        }
+      }
+
+      // The transfer syntax is only known if the files were scanned,
+      // so it might have to be read from the file itself
+      if (transferSyntax.empty())
+      {
+        if (!parser)
+        {
+          parser = vtkSmartPointer<vtkDICOMParser>::New();
+          fileMeta = vtkSmartPointer<vtkDICOMMetaData>::New();
+          parser->SetMetaData(fileMeta);
+        }
+        fileMeta->Initialize();
+        parser->SetFileName(fileName.c_str());
+        parser->Update();
+        transferSyntax = fileMeta->Get(DC::TransferSyntaxUID).AsString();
+      }
+
+      int image = static_cast<int>(records.size());
+      records.push_back(MakeRecord(
+        GetRecordType(classUID.c_str()), attributes, ImageKeys));
+      children.push_back(std::vector<int>());
+      children[series].push_back(image);
+
+      vtkDICOMItem& record = records.back();
+      record.Set(DC::ReferencedFileID,
+                 vtkDICOMValue(vtkDICOMVR::CS, fileID));
+      record.Set(DC::ReferencedSOPClassUIDInFile,
+                 vtkDICOMValue(vtkDICOMVR::UI, classUID));
+      record.Set(DC::ReferencedSOPInstanceUIDInFile,
+                 vtkDICOMValue(vtkDICOMVR::UI, instanceUID));
+      if (!transferSyntax.empty())
+      {
+        record.Set(DC::ReferencedTransferSyntaxUIDInFile,
+                   vtkDICOMValue(vtkDICOMVR::UI, transferSyntax));
+      }
+    }
+  }
+
+  // Flatten the tree, so that each record is followed by its children
+  size_t numberOfRecords = records.size();
+  std::vector<int> order;
+  order.reserve(numberOfRecords);
+  std::vector<int> stack;
+  nextRecord.resize(numberOfRecords, -1);
+  lowerRecord.resize(numberOfRecords, -1);
+  for (size_t k = patients.size(); k > 0; k--)
+  {
+    // pushed in reverse, so they will pop in the order they were added
+    stack.push_back(patients[k-1]);
+    if (k < patients.size())
+    {
+      nextRecord[patients[k-1]] = patients[k];
+    }
+  }
+  while (!stack.empty())
+  {
+    int r = stack.back();
+    stack.pop_back();
+    order.push_back(r);
+    const std::vector<int>& c = children[r];
+    if (!c.empty())
+    {
+      lowerRecord[r] = c[0];
+      for (size_t k = 1; k < c.size(); k++)
+      {
+        nextRecord[c[k-1]] = c[k];
+      }
+      for (size_t k = c.size(); k > 0; k--)
+      {
+        stack.push_back(c[k-1]);
+      }
+    }
+  }
+
+  // Build the DICOMDIR with all of the offsets set to zero
+  vtkSmartPointer<vtkDICOMMetaData> meta =
+    vtkSmartPointer<vtkDICOMMetaData>::New();
+  meta->Set(DC::MediaStorageSOPClassUID,
+            vtkDICOMValue(vtkDICOMVR::UI, MediaStorageDirectoryStorage));
+  meta->Set(DC::FileSetID,
+            vtkDICOMValue(vtkDICOMVR::CS,
+                          (this->FileSetID ? this->FileSetID : "")));
+  meta->Set(DC::OffsetOfTheFirstDirectoryRecordOfTheRootDirectoryEntity,
+            vtkDICOMValue(vtkDICOMVR::UL, 0u));
+  meta->Set(DC::OffsetOfTheLastDirectoryRecordOfTheRootDirectoryEntity,
+            vtkDICOMValue(vtkDICOMVR::UL, 0u));
+  meta->Set(DC::FileSetConsistencyFlag,
+            vtkDICOMValue(vtkDICOMVR::US, 0u));
+
+  vtkDICOMSequence seq(static_cast<unsigned int>(numberOfRecords));
+  for (size_t k = 0; k < numberOfRecords; k++)
+  {
+    seq.SetItem(k, records[order[k]]);
+  }
+  meta->Set(DC::DirectoryRecordSequence, seq);
+
+  // Find out where each record will be written
+  vtkSmartPointer<vtkDICOMCompiler> compiler =
+    vtkSmartPointer<vtkDICOMCompiler>::New();
+  compiler->SetFileName(this->FileName);
+  compiler->SetMetaData(meta);
+  std::vector<unsigned int> offsets(numberOfRecords + 1);
+  if (!compiler->ComputeDirectoryRecordOffsets(&offsets[0]))
+  {
+    this->ErrorCode = compiler->GetErrorCode();
+    return;
+  }
+
+  // Set the offsets, which does not change the size of the records
+  std::vector<unsigned int> recordOffsets(numberOfRecords, 0u);
+  for (size_t k = 0; k < numberOfRecords; k++)
+  {
+    recordOffsets[order[k]] = offsets[k];
+  }
+  vtkDICOMSequence finalSeq(static_cast<unsigned int>(numberOfRecords));
+  for (size_t k = 0; k < numberOfRecords; k++)
+  {
+    int r = order[k];
+    vtkDICOMItem record = records[r];
+    SetRecordOffsets(&record,
+      (nextRecord[r] >= 0 ? recordOffsets[nextRecord[r]] : 0u),
+      (lowerRecord[r] >= 0 ? recordOffsets[lowerRecord[r]] : 0u));
+    finalSeq.SetItem(k, record);
+  }
+  meta->Set(DC::DirectoryRecordSequence, finalSeq);
+
+  if (numberOfRecords > 0)
+  {
+    meta->Set(DC::OffsetOfTheFirstDirectoryRecordOfTheRootDirectoryEntity,
+              vtkDICOMValue(vtkDICOMVR::UL, offsets[0]));
+    meta->Set(DC::OffsetOfTheLastDirectoryRecordOfTheRootDirectoryEntity,
+              vtkDICOMValue(vtkDICOMVR::UL,
+                            recordOffsets[patients.back()]));
+  }
+
+  compiler->WriteHeader();
+  compiler->Close();
+  this->ErrorCode = compiler->GetErrorCode();
+}
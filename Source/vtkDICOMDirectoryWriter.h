@@ -0,0 +1,120 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkDICOMDirectoryWriter_h
+#define vtkDICOMDirectoryWriter_h
+
+#include "vtkObject.h"
+#include "vtkDICOMModule.h" // For export macro
+
+class vtkStringArray;
+class vtkDICOMDirectory;
+
+//! Write a DICOMDIR file to index the DICOM files in a directory.
+/*!
+ *  This class takes the series that were found by vtkDICOMDirectory,
+ *  and writes a DICOMDIR file that lists them by patient, study, series,
+ *  and image.  When vtkDICOMDirectory is later used on the directory
+ *  that contains the DICOMDIR, it reads the DICOMDIR instead of reading
+ *  every file.  All of the files must be within the directory that will
+ *  contain the DICOMDIR, or within its subdirectories.
+ *
+ *  The DICOM standard restricts the path of each file to at most eight
+ *  components, each of which must have at most eight characters from the
+ *  set A-Z, 0-9, and underscore.  This class does not rename any files,
+ *  so Write() will fail with an error if any path does not follow these
+ *  rules.
+ */
+class VTKDICOM_EXPORT vtkDICOMDirectoryWriter : public vtkObject
+{
+public:
+  //! Create a new vtkDICOMDirectoryWriter instance.
+  static vtkDICOMDirectoryWriter *New();
+
+  //! VTK dynamic type information macro.
+  vtkTypeMacro(vtkDICOMDirectoryWriter, vtkObject);
+
+  //! Print a summary of the contents of this object.
+#ifdef VTK_OVERRIDE
+  void PrintSelf(ostream& os, vtkIndent indent) VTK_OVERRIDE;
+#else
+  void PrintSelf(ostream& os, vtkIndent indent);
+#endif
+
+  //@{
+  //! Set the name of the DICOMDIR file to write.
+  vtkSetStringMacro(FileName);
+  vtkGetStringMacro(FileName);
+
+  //! Set the File Set ID, which can have up to 16 characters.
+  vtkSetStringMacro(FileSetID);
+  vtkGetStringMacro(FileSetID);
+  //@}
+
+  //@{
+  //! Add all of the series that were found by a vtkDICOMDirectory.
+  void AddDirectory(vtkDICOMDirectory *dir);
+
+  //! Add one series that was found by a vtkDICOMDirectory.
+  /*!
+   *  If file names are provided, they will be listed in the DICOMDIR
+   *  instead of the file names that the vtkDICOMDirectory found.  This
+   *  is for when the files have been copied, and there must be one file
+   *  name for each file in the series, in the same order.  A file with
+   *  an empty name is left out (e.g. if it could not be copied).
+   */
+  void AddSeries(vtkDICOMDirectory *dir, int series,
+                 vtkStringArray *fileNames=0);
+
+  //! Get the number of series that have been added.
+  int GetNumberOfSeries();
+
+  //! Remove all of the series.
+  void RemoveAllSeries();
+  //@}
+
+  //@{
+  //! Write the DICOMDIR file.
+  virtual void Write();
+
+  //! Get the IO error code.
+  unsigned long GetErrorCode() { return this->ErrorCode; }
+  //@}
+
+protected:
+  vtkDICOMDirectoryWriter();
+  ~vtkDICOMDirectoryWriter();
+
+  //! Get the DirectoryRecordType to use for a SOP class.
+  static const char *GetRecordType(const char *classUID);
+
+  char *FileName;
+  char *FileSetID;
+  unsigned long ErrorCode;
+
+private:
+#ifdef VTK_DELETE_FUNCTION
+  vtkDICOMDirectoryWriter(const vtkDICOMDirectoryWriter&) VTK_DELETE_FUNCTION;
+  void operator=(const vtkDICOMDirectoryWriter&) VTK_DELETE_FUNCTION;
+#else
+  vtkDICOMDirectoryWriter(const vtkDICOMDirectoryWriter&);
+  void operator=(const vtkDICOMDirectoryWriter&);
+#endif
+
+  struct SeriesItem;
+  class SeriesVector;
+
+  SeriesVector *Series;
+};
+
+#endif /* vtkDICOMDirectoryWriter_h */
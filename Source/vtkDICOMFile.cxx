@@ -21,6 +21,14 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <errno.h>
+#if defined(__linux__)
+// for in-kernel copies and reflinks
+#include <sys/sendfile.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/fs.h>
+#include <linux/fiemap.h>
+#endif
 #elif defined(VTK_DICOM_WIN32_IO)
 #include <windows.h>
 #else
@@ -37,6 +45,28 @@
 
 #include <string.h>
 
+#include <algorithm>
+#include <vector>
+
+namespace {
+
+// The sort key for SortByLocation
+struct FileLocation
+{
+  vtkDICOMFile::Size Device;
+  vtkDICOMFile::Size Location;
+  int Index;
+
+  bool operator<(const FileLocation& o) const
+  {
+    return (Device < o.Device ||
+            (Device == o.Device && (Location < o.Location ||
+             (Location == o.Location && Index < o.Index))));
+  }
+};
+
+} // end anonymous namespace
+
 //----------------------------------------------------------------------------
 vtkDICOMFile::vtkDICOMFile(const char *filename, Mode mode)
 {
@@ -378,6 +408,138 @@ vtkDICOMFile::Size vtkDICOMFile::GetSize()
 #endif
 }
 
+//----------------------------------------------------------------------------
+bool vtkDICOMFile::Advise(Size offset, Size size, int advice)
+{
+#if defined(VTK_DICOM_POSIX_IO) && defined(POSIX_FADV_WILLNEED)
+  static const int advices[5] = {
+    POSIX_FADV_NORMAL, POSIX_FADV_SEQUENTIAL, POSIX_FADV_RANDOM,
+    POSIX_FADV_WILLNEED, POSIX_FADV_DONTNEED };
+  if (advice < NormalAccess || advice > DontNeed)
+  {
+    return false;
+  }
+  return (posix_fadvise(this->Handle, static_cast<off_t>(offset),
+                        static_cast<off_t>(size), advices[advice]) == 0);
+#else
+  (void)offset;
+  (void)size;
+  (void)advice;
+  return false;
+#endif
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMFile::Size vtkDICOMFile::WriteFrom(vtkDICOMFile *infile, Size size)
+{
+  Size n = 0;
+
+#if defined(VTK_DICOM_POSIX_IO) && defined(__linux__)
+  // copy within the kernel, chunks are limited to avoid overflow of ssize_t
+  const size_t chunksize = 1024*1024*1024;
+#if defined(SYS_copy_file_range)
+  // copy_file_range() can share or offload storage on some filesystems
+  bool useCopyRange = true;
+#else
+  bool useCopyRange = false;
+#endif
+  bool useSendFile = true;
+  while (n < size && !infile->Eof && (useCopyRange || useSendFile))
+  {
+    size_t l = (size - n < chunksize ? size - n : chunksize);
+    ssize_t r = -1;
+#if defined(SYS_copy_file_range)
+    if (useCopyRange)
+    {
+      r = syscall(SYS_copy_file_range,
+                  infile->Handle, NULL, this->Handle, NULL, l, 0u);
+    }
+    else
+#endif
+    {
+      r = sendfile(this->Handle, infile->Handle, NULL, l);
+    }
+    if (r > 0)
+    {
+      n += r;
+    }
+    else if (r == 0)
+    {
+      // some files (e.g. in procfs, or on some FUSE filesystems) give
+      // zero even though data remains, so only read() can signal EOF
+      useCopyRange = false;
+      useSendFile = false;
+    }
+    else if (errno == EINTR)
+    {
+      errno = 0;
+    }
+    else if (n == 0 && (errno == ENOSYS || errno == EXDEV ||
+                        errno == EINVAL || errno == EOPNOTSUPP))
+    {
+      // not supported for these files, try the next method
+      if (useCopyRange)
+      {
+        useCopyRange = false;
+      }
+      else
+      {
+        useSendFile = false;
+      }
+      errno = 0;
+    }
+    else
+    {
+      if (errno == ENOSPC)
+      {
+        this->Error = OutOfSpace;
+      }
+      else
+      {
+        this->Error = UnknownError;
+      }
+      return n;
+    }
+  }
+#endif
+
+  // copy through a buffer
+  if (n < size && !infile->Eof)
+  {
+    const size_t bufsize = 65536;
+    unsigned char *buffer = new unsigned char[bufsize];
+    while (n < size && !infile->Eof)
+    {
+      size_t l = (size - n < bufsize ? static_cast<size_t>(size - n) : bufsize);
+      size_t r = infile->Read(buffer, l);
+      if (r == 0)
+      {
+        break;
+      }
+      size_t w = this->Write(buffer, r);
+      n += w;
+      if (w != r)
+      {
+        break;
+      }
+    }
+    delete [] buffer;
+  }
+
+  return n;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMFile::Clone(vtkDICOMFile *infile)
+{
+#if defined(VTK_DICOM_POSIX_IO) && defined(__linux__) && defined(FICLONE)
+  return (ioctl(this->Handle, FICLONE, infile->Handle) == 0);
+#else
+  (void)infile;
+  return false;
+#endif
+}
+
 //----------------------------------------------------------------------------
 int vtkDICOMFile::Access(const char *filename, Mode mode)
 {
@@ -553,3 +715,159 @@ bool vtkDICOMFile::SameFile(const char *file1, const char *file2)
 #endif
   return result;
 }
+
+//----------------------------------------------------------------------------
+bool vtkDICOMFile::GetFileIndex(
+  const char *filename, Size *device, Size *index)
+{
+  bool result = false;
+#ifdef _WIN32
+  vtkDICOMFilePath fpath(filename);
+  const wchar_t *widepath = fpath.Wide();
+  HANDLE h = CreateFileW(widepath,
+    GENERIC_READ, FILE_SHARE_READ , NULL, OPEN_EXISTING,
+    FILE_FLAG_BACKUP_SEMANTICS, NULL);
+  if (h != INVALID_HANDLE_VALUE)
+  {
+    BY_HANDLE_FILE_INFORMATION buf;
+    if (GetFileInformationByHandle(h, &buf))
+    {
+      *device = buf.dwVolumeSerialNumber;
+      *index = (static_cast<Size>(buf.nFileIndexHigh) << 32) |
+               buf.nFileIndexLow;
+      result = true;
+    }
+    CloseHandle(h);
+  }
+#else
+  struct stat st;
+  if (stat(filename, &st) == 0)
+  {
+    *device = static_cast<Size>(st.st_dev);
+    *index = static_cast<Size>(st.st_ino);
+    result = true;
+  }
+#endif
+  return result;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFile::SortByLocation(
+  const char *const *filenames, int n, int *order, int readOrder)
+{
+  std::vector<FileLocation> keys(n);
+  for (int i = 0; i < n; i++)
+  {
+    FileLocation& key = keys[i];
+    key.Device = 0;
+    key.Location = 0;
+    key.Index = i;
+    if (readOrder == NameOrder ||
+        !GetFileIndex(filenames[i], &key.Device, &key.Location))
+    {
+      continue;
+    }
+#if defined(VTK_DICOM_POSIX_IO) && defined(FS_IOC_FIEMAP)
+    if (readOrder == PhysicalOrder)
+    {
+      // ask for the first extent of the file
+      Size storage[(sizeof(struct fiemap) +
+                    sizeof(struct fiemap_extent) + 7)/8];
+      memset(storage, 0, sizeof(storage));
+      struct fiemap *request = reinterpret_cast<struct fiemap *>(storage);
+      request->fm_start = 0;
+      request->fm_length = ~0ull;
+      request->fm_extent_count = 1;
+      int fd = open(filenames[i], O_RDONLY);
+      if (fd != -1)
+      {
+        if (ioctl(fd, FS_IOC_FIEMAP, request) == 0 &&
+            request->fm_mapped_extents > 0)
+        {
+          key.Location = request->fm_extents[0].fe_physical;
+        }
+        close(fd);
+      }
+    }
+#endif
+  }
+
+  if (readOrder != NameOrder)
+  {
+    std::sort(keys.begin(), keys.end());
+  }
+
+  for (int i = 0; i < n; i++)
+  {
+    order[i] = keys[i].Index;
+  }
+}
+
+//----------------------------------------------------------------------------
+int vtkDICOMFile::Link(const char *target, const char *linkname)
+{
+#ifdef _WIN32
+  int errorCode = UnknownError;
+  vtkDICOMFilePath fpath1(target);
+  vtkDICOMFilePath fpath2(linkname);
+  const wchar_t *widepath1 = fpath1.Wide();
+  const wchar_t *widepath2 = fpath2.Wide();
+  if (widepath1 && widepath2)
+  {
+    errorCode = 0;
+    if (!CreateHardLinkW(widepath2, widepath1, NULL))
+    {
+      DWORD lastError = GetLastError();
+      if (lastError == ERROR_ACCESS_DENIED ||
+          lastError == ERROR_SHARING_VIOLATION)
+      {
+        errorCode = AccessDenied;
+      }
+      else if (lastError == ERROR_FILE_NOT_FOUND)
+      {
+        errorCode = FileNotFound;
+      }
+      else if (lastError == ERROR_PATH_NOT_FOUND)
+      {
+        errorCode = ImpossiblePath;
+      }
+      else if (lastError == ERROR_DISK_FULL)
+      {
+        errorCode = OutOfSpace;
+      }
+      else
+      {
+        errorCode = UnknownError;
+      }
+    }
+  }
+  return errorCode;
+#else
+  int errorCode = 0;
+  if (link(target, linkname) != 0)
+  {
+    int e = errno;
+    if (e == EACCES || e == EPERM)
+    {
+      errorCode = AccessDenied;
+    }
+    else if (e == ENOENT)
+    {
+      errorCode = FileNotFound;
+    }
+    else if (e == ENOTDIR)
+    {
+      errorCode = ImpossiblePath;
+    }
+    else if (e == ENOSPC)
+    {
+      errorCode = OutOfSpace;
+    }
+    else
+    {
+      errorCode = UnknownError;
+    }
+  }
+  return errorCode;
+#endif
+}
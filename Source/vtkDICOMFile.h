@@ -51,6 +51,24 @@ public:
     OutOfSpace         // disk full or quota exceeded
   };
 
+  //! Orders in which a group of files can be read.
+  enum ReadOrder
+  {
+    NameOrder,         // the order in which the files were given
+    IndexOrder,        // by device and index (inode number)
+    PhysicalOrder      // by device and location of first block on disk
+  };
+
+  //! Hints about how a file will be read, see Advise().
+  enum Advice
+  {
+    NormalAccess,      // no special treatment
+    SequentialAccess,  // read from start to finish, increase read-ahead
+    RandomAccess,      // read in bits and pieces, disable read-ahead
+    WillNeed,          // the data will be needed soon, start reading it
+    DontNeed           // the data will not be needed again
+  };
+
   //! Typedef for a file size.
   typedef unsigned long long Size;
 
@@ -92,6 +110,33 @@ public:
   //! Check the size of the file, returns ULLONG_MAX on error.
   Size GetSize();
 
+  //! Tell the system how a part of the file will be read.
+  /*!
+   *  This is only a hint, which the system is free to ignore.  A size
+   *  of zero means the rest of the file.  The return value is false if
+   *  the system does not support the hint (e.g. on Windows).
+   */
+  bool Advise(Size offset, Size size, int advice);
+
+  //! Copy data from another file into this file.
+  /*!
+   *  Data is copied from the current position in the input file until
+   *  the end of the input file is reached or until "size" bytes have been
+   *  copied.  Where the system allows it, the data is copied within the
+   *  kernel instead of passing through a buffer in user space.  The number
+   *  of bytes that were copied is returned.  Check GetError() on both
+   *  files to see if an error occurred.
+   */
+  Size WriteFrom(vtkDICOMFile *infile, Size size);
+
+  //! Make this file share the storage of another file (copy-on-write).
+  /*!
+   *  This is only possible on filesystems that support reflinks, and only
+   *  if both files are on the same filesystem.  If false is returned,
+   *  nothing was done and the data must be copied instead.
+   */
+  bool Clone(vtkDICOMFile *infile);
+
   //! Check for the end-of-file indicator.
   bool EndOfFile() { return this->Eof; }
 
@@ -124,6 +169,39 @@ public:
    *  accessible, then it returns false.
    */
   static bool SameFile(const char *file1, const char *file2);
+
+  //! Get the device and the index (inode number) of a file.
+  /*!
+   *  Together, these two numbers uniquely identify a file or directory
+   *  on the system, no matter what path was used to reach it.  The
+   *  return value is false if the file does not exist or is otherwise
+   *  not accessible.
+   */
+  static bool GetFileIndex(
+    const char *filename, Size *device, Size *index);
+
+  //! Sort a group of files by their location on disk.
+  /*!
+   *  On return, the "order" array will contain the indices 0 to n-1,
+   *  arranged so that reading the files in this order will require as
+   *  few disk seeks as possible.  For IndexOrder, the files are sorted
+   *  by device and index (inode number), which only requires a stat().
+   *  For PhysicalOrder, the files are sorted by the location of their
+   *  first block where the system can provide it (FIEMAP on Linux),
+   *  otherwise by index.  For NameOrder, the order is unchanged.
+   */
+  static void SortByLocation(
+    const char *const *filenames, int n, int *order, int readOrder);
+
+  //! Create a hard link to a file (static method).
+  /*!
+   *  The new name "linkname" will refer to the same disk file as the
+   *  existing file "target".  This fails if the two names are on
+   *  different filesystems, or if a file named "linkname" already exists.
+   *  The return value is zero if successful, otherwise an error code is
+   *  returned.
+   */
+  static int Link(const char *target, const char *linkname);
   //@}
 
   //! @cond
@@ -0,0 +1,734 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDICOMFileBatch.h"
+#include "vtkDICOMConfig.h"
+
+#include "vtkMultiThreader.h"
+#include "vtkMutexLock.h"
+#include "vtkConditionVariable.h"
+
+#if defined(DICOM_USE_IO_URING)
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <linux/io_uring.h>
+#if !defined(__NR_io_uring_setup)
+#undef DICOM_USE_IO_URING
+#endif
+#endif
+
+#include <string.h>
+
+#include <string>
+#include <deque>
+
+//----------------------------------------------------------------------------
+// Each submitted read is held in a slot until it is complete
+struct vtkDICOMFileBatch::Request
+{
+  enum StateType
+  {
+    Free,
+    Opening,
+    Reading
+  };
+
+  std::string FileName;
+  Size Offset;
+  Size Length;
+  void *Buffer;
+  int Id;
+  int State;
+  int Handle;
+  Size BytesRead;
+  int Error;
+};
+
+#if defined(DICOM_USE_IO_URING)
+//----------------------------------------------------------------------------
+// The io_uring backend.  The system calls are made directly, so that
+// liburing is not needed.  Each request is carried out as two operations,
+// an OPENAT followed by a READ (or a FADVISE for prefetches).
+class vtkDICOMFileBatch::IOUring
+{
+public:
+  // Create the ring, or return NULL if io_uring is not available.
+  static IOUring *New(unsigned int entries);
+  ~IOUring();
+
+  // Queue an operation for the request (not started until Enter).
+  void Open(Request *r, unsigned int slot);
+  void Read(Request *r, unsigned int slot);
+
+  // Start the queued operations, and optionally wait for a completion.
+  bool Enter(bool wait);
+
+  // Get a completion, if there is one.
+  bool Reap(unsigned int *slot, int *result);
+
+private:
+  IOUring() : Fd(-1), RingSize(0), Ring(MAP_FAILED), SQEs(MAP_FAILED),
+              ToSubmit(0) {}
+
+  io_uring_sqe *GetSQE(unsigned int slot);
+  void PushSQE();
+
+  int Fd;
+  size_t RingSize;
+  size_t SQEsSize;
+  void *Ring;
+  void *SQEs;
+  io_uring_params Params;
+  unsigned int ToSubmit;
+};
+
+//----------------------------------------------------------------------------
+vtkDICOMFileBatch::IOUring *vtkDICOMFileBatch::IOUring::New(
+  unsigned int entries)
+{
+  IOUring *ring = new IOUring;
+  io_uring_params *p = &ring->Params;
+  memset(p, 0, sizeof(io_uring_params));
+  ring->Fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, p));
+  if (ring->Fd < 0 || (p->features & IORING_FEAT_SINGLE_MMAP) == 0)
+  {
+    // io_uring not present (or too old, before linux 5.4), or not allowed
+    delete ring;
+    return 0;
+  }
+
+  // Check that the kernel can do all the operations that will be used
+  // (OPENAT, READ, and FADVISE require linux 5.6)
+  const int n = IORING_OP_LAST;
+  char probeData[sizeof(io_uring_probe) + n*sizeof(io_uring_probe_op)];
+  io_uring_probe *probe = reinterpret_cast<io_uring_probe *>(probeData);
+  memset(probeData, 0, sizeof(probeData));
+  static const int ops[3] = {
+    IORING_OP_OPENAT, IORING_OP_READ, IORING_OP_FADVISE };
+  if (syscall(__NR_io_uring_register, ring->Fd,
+              IORING_REGISTER_PROBE, probe, n) < 0)
+  {
+    delete ring;
+    return 0;
+  }
+  for (int i = 0; i < 3; i++)
+  {
+    if (ops[i] > probe->last_op ||
+        (probe->ops[ops[i]].flags & IO_URING_OP_SUPPORTED) == 0)
+    {
+      delete ring;
+      return 0;
+    }
+  }
+
+  // Map the submission and completion rings, which share one mapping
+  size_t sqSize = p->sq_off.array + p->sq_entries*sizeof(unsigned int);
+  size_t cqSize = p->cq_off.cqes + p->cq_entries*sizeof(io_uring_cqe);
+  ring->RingSize = (sqSize > cqSize ? sqSize : cqSize);
+  ring->Ring = mmap(0, ring->RingSize, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ring->Fd, IORING_OFF_SQ_RING);
+  ring->SQEsSize = p->sq_entries*sizeof(io_uring_sqe);
+  ring->SQEs = mmap(0, ring->SQEsSize, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ring->Fd, IORING_OFF_SQES);
+  if (ring->Ring == MAP_FAILED || ring->SQEs == MAP_FAILED)
+  {
+    delete ring;
+    return 0;
+  }
+
+  return ring;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMFileBatch::IOUring::~IOUring()
+{
+  if (this->SQEs != MAP_FAILED)
+  {
+    munmap(this->SQEs, this->SQEsSize);
+  }
+  if (this->Ring != MAP_FAILED)
+  {
+    munmap(this->Ring, this->RingSize);
+  }
+  if (this->Fd >= 0)
+  {
+    close(this->Fd);
+  }
+}
+
+//----------------------------------------------------------------------------
+io_uring_sqe *vtkDICOMFileBatch::IOUring::GetSQE(unsigned int slot)
+{
+  // Only this thread writes the tail, so it can be read without a barrier.
+  // The ring never overflows, since each slot uses at most one entry.
+  char *ring = static_cast<char *>(this->Ring);
+  unsigned int tail =
+    *reinterpret_cast<unsigned int *>(ring + this->Params.sq_off.tail);
+  unsigned int mask =
+    *reinterpret_cast<unsigned int *>(ring + this->Params.sq_off.ring_mask);
+  unsigned int *array =
+    reinterpret_cast<unsigned int *>(ring + this->Params.sq_off.array);
+
+  unsigned int index = (tail & mask);
+  io_uring_sqe *sqe = static_cast<io_uring_sqe *>(this->SQEs) + index;
+  memset(sqe, 0, sizeof(io_uring_sqe));
+  sqe->user_data = slot;
+  array[index] = index;
+
+  return sqe;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFileBatch::IOUring::PushSQE()
+{
+  // The kernel must see the entry before it sees the new tail
+  char *ring = static_cast<char *>(this->Ring);
+  unsigned int *tailPtr =
+    reinterpret_cast<unsigned int *>(ring + this->Params.sq_off.tail);
+  __atomic_store_n(tailPtr, *tailPtr + 1, __ATOMIC_RELEASE);
+  this->ToSubmit++;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFileBatch::IOUring::Open(Request *r, unsigned int slot)
+{
+  io_uring_sqe *sqe = this->GetSQE(slot);
+  sqe->opcode = IORING_OP_OPENAT;
+  sqe->fd = AT_FDCWD;
+  sqe->addr = reinterpret_cast<unsigned long>(r->FileName.c_str());
+  sqe->open_flags = O_RDONLY | O_CLOEXEC;
+  this->PushSQE();
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFileBatch::IOUring::Read(Request *r, unsigned int slot)
+{
+  // A single operation can only read 32 bits worth of data
+  const Size maxLength = 0x40000000;
+  Size length = r->Length - r->BytesRead;
+  length = (length < maxLength ? length : maxLength);
+
+  io_uring_sqe *sqe = this->GetSQE(slot);
+  sqe->fd = r->Handle;
+  sqe->off = r->Offset + r->BytesRead;
+  sqe->len = static_cast<unsigned int>(length);
+  if (r->Buffer)
+  {
+    sqe->opcode = IORING_OP_READ;
+    sqe->addr = reinterpret_cast<unsigned long>(
+      static_cast<char *>(r->Buffer) + r->BytesRead);
+  }
+  else
+  {
+    sqe->opcode = IORING_OP_FADVISE;
+    sqe->fadvise_advice = POSIX_FADV_WILLNEED;
+  }
+  this->PushSQE();
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMFileBatch::IOUring::Enter(bool wait)
+{
+  unsigned int flags = (wait ? IORING_ENTER_GETEVENTS : 0);
+  for (;;)
+  {
+    if (this->ToSubmit == 0 && !wait)
+    {
+      return true;
+    }
+    long n = syscall(__NR_io_uring_enter, this->Fd,
+                     this->ToSubmit, (wait ? 1 : 0), flags, 0, 0);
+    if (n >= 0)
+    {
+      this->ToSubmit -= static_cast<unsigned int>(n);
+      if (this->ToSubmit == 0)
+      {
+        return true;
+      }
+    }
+    else if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+    {
+      return false;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMFileBatch::IOUring::Reap(unsigned int *slot, int *result)
+{
+  char *ring = static_cast<char *>(this->Ring);
+  unsigned int *headPtr =
+    reinterpret_cast<unsigned int *>(ring + this->Params.cq_off.head);
+  unsigned int *tailPtr =
+    reinterpret_cast<unsigned int *>(ring + this->Params.cq_off.tail);
+  unsigned int mask =
+    *reinterpret_cast<unsigned int *>(ring + this->Params.cq_off.ring_mask);
+  io_uring_cqe *cqes =
+    reinterpret_cast<io_uring_cqe *>(ring + this->Params.cq_off.cqes);
+
+  unsigned int head = *headPtr;
+  if (head == __atomic_load_n(tailPtr, __ATOMIC_ACQUIRE))
+  {
+    return false;
+  }
+
+  io_uring_cqe *cqe = &cqes[head & mask];
+  *slot = static_cast<unsigned int>(cqe->user_data);
+  *result = cqe->res;
+
+  // Tell the kernel that the entry can be reused
+  __atomic_store_n(headPtr, head + 1, __ATOMIC_RELEASE);
+
+  return true;
+}
+
+//----------------------------------------------------------------------------
+namespace {
+
+// Convert an errno value into a vtkDICOMFile error code
+int ErrorFromErrno(int e)
+{
+  if (e == EACCES || e == EPERM)
+  {
+    return vtkDICOMFile::AccessDenied;
+  }
+  else if (e == EISDIR)
+  {
+    return vtkDICOMFile::FileIsDirectory;
+  }
+  else if (e == ENOENT || e == ENOTDIR)
+  {
+    return vtkDICOMFile::FileNotFound;
+  }
+  return vtkDICOMFile::UnknownError;
+}
+
+} // end anonymous namespace
+
+#else /* DICOM_USE_IO_URING */
+
+// A placeholder, for systems without io_uring
+class vtkDICOMFileBatch::IOUring
+{
+};
+
+#endif /* DICOM_USE_IO_URING */
+
+//----------------------------------------------------------------------------
+// The thread pool backend, which works on all systems
+class vtkDICOMFileBatch::ThreadPool
+{
+public:
+  ThreadPool(Request *requests, int n);
+  ~ThreadPool();
+
+  // Add a request to the work queue.
+  void Push(int slot);
+
+  // Get a completed request, and optionally wait for one.
+  bool Pop(int *slot, bool wait);
+
+private:
+  static VTK_THREAD_RETURN_TYPE ThreadMethod(void *arg);
+  static void Execute(Request *r);
+
+  Request *Requests;
+  vtkMultiThreader *Threader;
+  int NumberOfThreads;
+  int *ThreadIds;
+  std::deque<int> Queue;
+  std::deque<int> Finished;
+  bool Stop;
+  vtkSimpleMutexLock Lock;
+  vtkSimpleConditionVariable WorkCondition;
+  vtkSimpleConditionVariable DoneCondition;
+};
+
+//----------------------------------------------------------------------------
+vtkDICOMFileBatch::ThreadPool::ThreadPool(Request *requests, int n)
+{
+  this->Requests = requests;
+  this->Stop = false;
+  this->Threader = vtkMultiThreader::New();
+  this->NumberOfThreads = n;
+  this->ThreadIds = new int[n];
+  for (int i = 0; i < n; i++)
+  {
+    this->ThreadIds[i] = this->Threader->SpawnThread(
+      &ThreadPool::ThreadMethod, this);
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMFileBatch::ThreadPool::~ThreadPool()
+{
+  this->Lock.Lock();
+  this->Stop = true;
+  this->WorkCondition.Broadcast();
+  this->Lock.Unlock();
+
+  for (int i = 0; i < this->NumberOfThreads; i++)
+  {
+    if (this->ThreadIds[i] >= 0)
+    {
+      this->Threader->TerminateThread(this->ThreadIds[i]);
+    }
+  }
+
+  delete [] this->ThreadIds;
+  this->Threader->Delete();
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFileBatch::ThreadPool::Push(int slot)
+{
+  this->Lock.Lock();
+  this->Queue.push_back(slot);
+  this->WorkCondition.Signal();
+  this->Lock.Unlock();
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMFileBatch::ThreadPool::Pop(int *slot, bool wait)
+{
+  this->Lock.Lock();
+  while (wait && this->Finished.empty())
+  {
+    this->DoneCondition.Wait(this->Lock);
+  }
+  bool found = !this->Finished.empty();
+  if (found)
+  {
+    *slot = this->Finished.front();
+    this->Finished.pop_front();
+  }
+  this->Lock.Unlock();
+  return found;
+}
+
+//----------------------------------------------------------------------------
+VTK_THREAD_RETURN_TYPE vtkDICOMFileBatch::ThreadPool::ThreadMethod(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *info =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  ThreadPool *pool = static_cast<ThreadPool *>(info->UserData);
+
+  pool->Lock.Lock();
+  for (;;)
+  {
+    while (pool->Queue.empty() && !pool->Stop)
+    {
+      pool->WorkCondition.Wait(pool->Lock);
+    }
+    if (pool->Queue.empty())
+    {
+      break;
+    }
+    int slot = pool->Queue.front();
+    pool->Queue.pop_front();
+    pool->Lock.Unlock();
+
+    ThreadPool::Execute(&pool->Requests[slot]);
+
+    pool->Lock.Lock();
+    pool->Finished.push_back(slot);
+    pool->DoneCondition.Signal();
+  }
+  pool->Lock.Unlock();
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFileBatch::ThreadPool::Execute(Request *r)
+{
+  vtkDICOMFile infile(r->FileName.c_str(), vtkDICOMFile::In);
+  r->Error = infile.GetError();
+  if (r->Error != 0 || (r->Offset != 0 && !infile.SetPosition(r->Offset)))
+  {
+    r->Error = (r->Error ? r->Error : infile.GetError());
+    return;
+  }
+
+  // A prefetch reads through a small buffer, which fills the file cache
+  unsigned char scratch[16384];
+  while (r->BytesRead < r->Length)
+  {
+    unsigned char *data = scratch;
+    size_t length = sizeof(scratch);
+    if (r->Buffer)
+    {
+      data = static_cast<unsigned char *>(r->Buffer) + r->BytesRead;
+      length = static_cast<size_t>(-1);
+    }
+    if (r->Length - r->BytesRead < length)
+    {
+      length = static_cast<size_t>(r->Length - r->BytesRead);
+    }
+    size_t n = infile.Read(data, length);
+    r->BytesRead += n;
+    if (n < length)
+    {
+      r->Error = infile.GetError();
+      break;
+    }
+  }
+
+  if (!r->Buffer)
+  {
+    r->BytesRead = 0;
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMFileBatch::vtkDICOMFileBatch(int depth, int backend)
+{
+  depth = (depth > 1 ? depth : 1);
+  this->Depth = depth;
+  this->Pending = 0;
+  this->Requests = new Request[depth];
+  this->FreeSlots = new int[depth];
+  this->NumberOfFreeSlots = depth;
+  for (int i = 0; i < depth; i++)
+  {
+    this->Requests[i].State = Request::Free;
+    this->FreeSlots[i] = depth - i - 1;
+  }
+  this->Ring = 0;
+  this->Pool = 0;
+
+#if defined(DICOM_USE_IO_URING)
+  if (backend != ThreadBackend)
+  {
+    this->Ring = IOUring::New(depth);
+  }
+#else
+  (void)backend;
+#endif
+
+  if (this->Ring)
+  {
+    this->Method = IOUringBackend;
+  }
+  else
+  {
+    // More than a few threads gives little benefit for prefetching
+    this->Method = ThreadBackend;
+    this->Pool = new ThreadPool(this->Requests, (depth < 8 ? depth : 8));
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMFileBatch::~vtkDICOMFileBatch()
+{
+  int id;
+  Size bytesRead;
+  int error;
+  while (this->Wait(&id, &bytesRead, &error)) {}
+
+  delete this->Pool;
+#if defined(DICOM_USE_IO_URING)
+  delete this->Ring;
+#endif
+  delete [] this->FreeSlots;
+  delete [] this->Requests;
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMFileBatch::Submit(
+  const char *filename, Size offset, Size size, void *buffer, int id)
+{
+  if (this->NumberOfFreeSlots == 0)
+  {
+    return false;
+  }
+
+  int slot = this->FreeSlots[--this->NumberOfFreeSlots];
+  Request *r = &this->Requests[slot];
+  r->FileName = filename;
+  r->Offset = offset;
+  r->Length = size;
+  r->Buffer = buffer;
+  r->Id = id;
+  r->State = Request::Opening;
+  r->Handle = -1;
+  r->BytesRead = 0;
+  r->Error = 0;
+  this->Pending++;
+
+#if defined(DICOM_USE_IO_URING)
+  if (this->Ring)
+  {
+    this->Ring->Open(r, slot);
+    return true;
+  }
+#endif
+
+  this->Pool->Push(slot);
+  return true;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFileBatch::Prefetch(const char *filename, Size offset, Size size)
+{
+  int id;
+  Size bytesRead;
+  int error;
+  while (this->Poll(&id, &bytesRead, &error)) {}
+  if (this->NumberOfFreeSlots == 0)
+  {
+    this->Wait(&id, &bytesRead, &error);
+  }
+  this->Submit(filename, offset, size, 0, 0);
+  this->Flush();
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMFileBatch::Flush()
+{
+#if defined(DICOM_USE_IO_URING)
+  if (this->Ring)
+  {
+    this->Ring->Enter(false);
+  }
+#endif
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMFileBatch::Poll(int *id, Size *bytesRead, int *error)
+{
+  return this->Complete(id, bytesRead, error, false);
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMFileBatch::Wait(int *id, Size *bytesRead, int *error)
+{
+  return this->Complete(id, bytesRead, error, true);
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMFileBatch::Complete(
+  int *id, Size *bytesRead, int *error, bool wait)
+{
+  if (this->Pending == 0)
+  {
+    return false;
+  }
+
+  int slot = -1;
+
+#if defined(DICOM_USE_IO_URING)
+  while (this->Ring && slot < 0)
+  {
+    unsigned int s;
+    int result;
+    while (slot < 0 && this->Ring->Reap(&s, &result))
+    {
+      Request *r = &this->Requests[s];
+      if (r->State == Request::Opening)
+      {
+        if (result >= 0)
+        {
+          r->Handle = result;
+          r->State = Request::Reading;
+          if (r->Length > 0)
+          {
+            this->Ring->Read(r, s);
+            continue;
+          }
+        }
+        else
+        {
+          r->Error = ErrorFromErrno(-result);
+        }
+      }
+      else if (result == -EINTR || result == -EAGAIN)
+      {
+        this->Ring->Read(r, s);
+        continue;
+      }
+      else if (result < 0)
+      {
+        r->Error = ErrorFromErrno(-result);
+      }
+      else if (r->Buffer)
+      {
+        // Keep reading until the end of file, or until done
+        r->BytesRead += static_cast<unsigned int>(result);
+        if (result > 0 && r->BytesRead < r->Length)
+        {
+          this->Ring->Read(r, s);
+          continue;
+        }
+      }
+
+      if (r->Handle >= 0)
+      {
+        close(r->Handle);
+        r->Handle = -1;
+      }
+      slot = static_cast<int>(s);
+    }
+
+    if (slot < 0 && !this->Ring->Enter(wait))
+    {
+      // The ring has failed, so fail the pending requests one at a time
+      // (this should never happen in practice)
+      for (int i = 0; i < this->Depth && slot < 0; i++)
+      {
+        Request *r = &this->Requests[i];
+        if (r->State != Request::Free)
+        {
+          if (r->Handle >= 0)
+          {
+            close(r->Handle);
+            r->Handle = -1;
+          }
+          r->Error = vtkDICOMFile::UnknownError;
+          slot = i;
+        }
+      }
+    }
+    else if (slot >= 0)
+    {
+      // Start any reads that were queued while reaping
+      this->Ring->Enter(false);
+    }
+    else if (!wait)
+    {
+      // Nothing is complete yet
+      return false;
+    }
+  }
+#endif
+
+  if (this->Pool && !this->Pool->Pop(&slot, wait))
+  {
+    return false;
+  }
+
+  Request *r = &this->Requests[slot];
+  *id = r->Id;
+  *bytesRead = (r->Buffer ? r->BytesRead : 0);
+  *error = r->Error;
+  r->State = Request::Free;
+  r->FileName.clear();
+  this->FreeSlots[this->NumberOfFreeSlots++] = slot;
+  this->Pending--;
+
+  return true;
+}
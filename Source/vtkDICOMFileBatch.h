@@ -0,0 +1,141 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkDICOMFileBatch_h
+#define vtkDICOMFileBatch_h
+
+#include "vtkSystemIncludes.h"
+#include "vtkDICOMModule.h" // For export macro
+#include "vtkDICOMFile.h" // For vtkDICOMFile::Size
+
+//! Read from many files at once, with several reads in flight.
+/*!
+ *  A batch allows a number of reads (each of which opens a file, reads
+ *  from it, and closes it) to be submitted without waiting for any of
+ *  them to finish.  The completions are then collected with Wait(), in
+ *  whatever order the system finishes them.  This keeps the storage
+ *  device busy with several requests at once, which is much faster than
+ *  reading the files one-by-one on SSDs and on network filesystems.
+ *
+ *  On Linux, io_uring is used if the kernel supports it.  Otherwise, a
+ *  small pool of threads performs the reads.  A read that is given a
+ *  NULL buffer is a prefetch: the data is brought into the system's
+ *  file cache, so that a subsequent read of the file will not block.
+ */
+class VTKDICOM_EXPORT vtkDICOMFileBatch
+{
+public:
+  //! The method used to perform the reads.
+  enum Backend
+  {
+    DefaultBackend,    // use io_uring if available, else threads
+    IOUringBackend,    // use the Linux io_uring interface
+    ThreadBackend      // use a pool of threads
+  };
+
+  //! Typedef for a file size.
+  typedef vtkDICOMFile::Size Size;
+
+  //@{
+  //! Construct a batch that allows "depth" reads to be in flight.
+  /*!
+   *  If the requested backend is not available, then ThreadBackend
+   *  will be used instead.
+   */
+  vtkDICOMFileBatch(int depth, int backend=DefaultBackend);
+
+  //! Destruct the batch, after waiting for pending reads to finish.
+  ~vtkDICOMFileBatch();
+  //@}
+
+  //@{
+  //! Submit a read of "size" bytes, starting at "offset".
+  /*!
+   *  The "id" is returned by Wait() when the read is complete.  If the
+   *  buffer is NULL, the data is only brought into the file cache.  The
+   *  buffer must remain valid until the read is complete.  The return
+   *  value is false if the batch is full, in which case Wait() must be
+   *  called before another read can be submitted.
+   */
+  bool Submit(
+    const char *filename, Size offset, Size size, void *buffer, int id);
+
+  //! Prefetch part of a file into the file cache.
+  /*!
+   *  This is a convenience method for reading ahead.  It collects the
+   *  completions of earlier prefetches, waits if the batch is full, and
+   *  then submits and starts a prefetch for the given file.  It should
+   *  not be mixed with calls to Submit() on the same batch.
+   */
+  void Prefetch(const char *filename, Size offset, Size size);
+
+  //! Start all submitted reads, without waiting for them.
+  /*!
+   *  Submitted reads are started in one go when Flush(), Poll(), or
+   *  Wait() is called, so that the cost of the system call is shared.
+   */
+  void Flush();
+
+  //! Wait for any submitted read to complete.
+  /*!
+   *  The "id" given to Submit() is stored in "id", the number of bytes
+   *  read is stored in "bytesRead" (always zero for a prefetch), and the
+   *  error code (as given by vtkDICOMFile::GetError()) is stored in
+   *  "error".  The return value is false if no reads were pending.
+   */
+  bool Wait(int *id, Size *bytesRead, int *error);
+
+  //! Check for a completed read, without waiting.
+  /*!
+   *  This is like Wait(), except that it returns false immediately if
+   *  none of the pending reads are complete.
+   */
+  bool Poll(int *id, Size *bytesRead, int *error);
+  //@}
+
+  //@{
+  //! Get the backend that is being used.
+  int GetBackend() { return this->Method; }
+
+  //! Get the maximum number of reads that can be in flight.
+  int GetDepth() { return this->Depth; }
+
+  //! Get the number of reads that have been submitted but not waited for.
+  int GetNumberOfPending() { return this->Pending; }
+  //@}
+
+  //! @cond
+  // Internal classes, public only so that the backends can use them.
+  struct Request;
+  class IOUring;
+  class ThreadPool;
+  //! @endcond
+
+private:
+  vtkDICOMFileBatch(const vtkDICOMFileBatch&); // = delete;
+  vtkDICOMFileBatch& operator=(const vtkDICOMFileBatch&); // = delete;
+
+  bool Complete(int *id, Size *bytesRead, int *error, bool wait);
+
+  int Method;
+  int Depth;
+  int Pending;
+  Request *Requests;
+  int *FreeSlots;
+  int NumberOfFreeSlots;
+  IOUring *Ring;
+  ThreadPool *Pool;
+};
+
+#endif /* vtkDICOMFileBatch_h */
+// VTK-HeaderTest-Exclude: vtkDICOMFileBatch.h
@@ -154,7 +154,33 @@ vtkDICOMFileDirectory::vtkDICOMFileDirectory(const char *dirname)
     {
       if (strcmp(d->d_name, ".") != 0 && strcmp(d->d_name, "..") != 0)
       {
-        this->AddEntry(d->d_name, 0, 0);
+        unsigned short flags = 0;
+        unsigned short mask = 0;
+#ifdef DT_UNKNOWN
+        // use the file type from readdir(), to avoid calling stat()
+        // on every entry (not all filesystems provide the type)
+        if (d->d_type == DT_REG)
+        {
+          mask = (TypeSymlink | TypeBroken | TypeDirectory | TypeSpecial);
+        }
+        else if (d->d_type == DT_DIR)
+        {
+          flags = TypeDirectory;
+          mask = (TypeSymlink | TypeBroken | TypeDirectory | TypeSpecial);
+        }
+        else if (d->d_type == DT_LNK)
+        {
+          // stat() is still needed to find the type of the target
+          flags = TypeSymlink;
+          mask = TypeSymlink;
+        }
+        else if (d->d_type != DT_UNKNOWN)
+        {
+          flags = TypeSpecial;
+          mask = (TypeSymlink | TypeBroken | TypeDirectory | TypeSpecial);
+        }
+#endif
+        this->AddEntry(d->d_name, flags, mask);
       }
     }
     closedir(dir);
@@ -579,3 +605,57 @@ int vtkDICOMFileDirectory::Create(const char *name)
 
   return result;
 }
+
+//----------------------------------------------------------------------------
+int vtkDICOMFileDirectory::Remove(const char *dirname)
+{
+  int result = 0;
+
+#ifdef _WIN32
+  vtkDICOMFilePath dirpath(dirname);
+  const wchar_t *widename = dirpath.Wide();
+  if (widename == 0)
+  {
+    result = UnknownError;
+  }
+  else if (!RemoveDirectoryW(widename))
+  {
+    DWORD e = GetLastError();
+    if (e == ERROR_ACCESS_DENIED ||
+        e == ERROR_SHARING_VIOLATION ||
+        e == ERROR_DIR_NOT_EMPTY)
+    {
+      result = AccessDenied;
+    }
+    else if (e == ERROR_FILE_NOT_FOUND ||
+             e == ERROR_PATH_NOT_FOUND)
+    {
+      result = FileNotFound;
+    }
+    else
+    {
+      result = UnknownError;
+    }
+  }
+#else
+  if (rmdir(dirname) != 0)
+  {
+    int e = errno;
+    if (e == EACCES || e == EPERM || e == ENOTEMPTY || e == EEXIST ||
+        e == EBUSY)
+    {
+      result = AccessDenied;
+    }
+    else if (e == ENOENT || e == ENOTDIR)
+    {
+      result = FileNotFound;
+    }
+    else
+    {
+      result = UnknownError;
+    }
+  }
+#endif
+
+  return result;
+}
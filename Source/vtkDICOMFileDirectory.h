@@ -110,6 +110,14 @@ public:
    *  returned.
    */
   static int Create(const char *dirname);
+
+  //! Remove an empty directory (static method).
+  /*!
+   *  The return value is zero for success.  Otherwise, one of the error
+   *  codes is returned.  The directory must be empty, or AccessDenied
+   *  will be returned.
+   */
+  static int Remove(const char *dirname);
   //@}
 
   //@{
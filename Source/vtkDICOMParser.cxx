@@ -17,6 +17,8 @@
 #include "vtkDICOMMetaData.h"
 #include "vtkDICOMSequence.h"
 #include "vtkDICOMItem.h"
+#include "vtkDICOMQueryMatcher.h"
+#include "vtkDICOMUtilities.h"
 
 #include "vtkObjectFactory.h"
 #include "vtkUnsignedShortArray.h"
@@ -31,7 +33,6 @@
 
 vtkStandardNewMacro(vtkDICOMParser);
 vtkCxxSetObjectMacro(vtkDICOMParser, MetaData, vtkDICOMMetaData);
-vtkCxxSetObjectMacro(vtkDICOMParser, Query, vtkDICOMMetaData);
 vtkCxxSetObjectMacro(vtkDICOMParser, Groups, vtkUnsignedShortArray);
 
 /*----------------------------------------------------------------------------
@@ -116,7 +117,7 @@ public:
     CurrentTag(0,0), DefaultCharacterSet(dcs),
     CharacterSet(ocs ? dcs :
                  vtkDICOMCharacterSet(vtkDICOMCharacterSet::Unknown)),
-    VRForXS(vtkDICOMVR::XX) {}
+    VRForXS(vtkDICOMVR::XX), PrivateDictMask(0) {}
 
   // Construct from the current item.
   DecoderContext(vtkDICOMItem *item, vtkDICOMCharacterSet dcs, bool ocs) :
@@ -124,7 +125,7 @@ public:
     CurrentTag(0,0), DefaultCharacterSet(dcs),
     CharacterSet(ocs ? dcs :
                  vtkDICOMCharacterSet(vtkDICOMCharacterSet::Unknown)),
-    VRForXS(vtkDICOMVR::XX) {}
+    VRForXS(vtkDICOMVR::XX), PrivateDictMask(0) {}
 
   // Find an element within the current context.  This is used
   // by FindDictVR() to disambiguate VRs that could be either US
@@ -141,6 +142,15 @@ public:
   // Get the VR to use for XS by checking PixelRepresentation.
   vtkDICOMVR GetVRForXS();
 
+  // Get the private dictionary for a private creator tag, the result
+  // is cached so that the creator is only looked up once per block.
+  const vtkDICOMDictionary::Dict *GetPrivateDict(vtkDICOMTag ctag);
+
+  // Discard the cached dictionary for a private creator tag, this must
+  // be called whenever a new value is stored for the creator.
+  void ClearPrivateDict(vtkDICOMTag ctag) {
+    this->PrivateDictMask &= ~(1u << (ctag.GetElement() & 0x0F)); }
+
   // Set the previous context.
   void SetPrev(DecoderContext *context) { this->Prev = context; }
   DecoderContext *GetPrev() { return this->Prev; }
@@ -160,6 +170,11 @@ private:
   vtkDICOMCharacterSet DefaultCharacterSet;
   vtkDICOMCharacterSet CharacterSet;
   vtkDICOMVR VRForXS;
+  // a small cache of private dictionaries, indexed by the low four bits
+  // of the creator element, with one bit of the mask for each slot
+  unsigned int PrivateDictMask;
+  vtkDICOMTag PrivateDictTags[16];
+  const vtkDICOMDictionary::Dict *PrivateDicts[16];
 };
 
 //----------------------------------------------------------------------------
@@ -231,6 +246,35 @@ vtkDICOMVR DecoderContext::GetVRForXS()
   return vr;
 }
 
+//----------------------------------------------------------------------------
+const vtkDICOMDictionary::Dict *DecoderContext::GetPrivateDict(
+  vtkDICOMTag ctag)
+{
+  unsigned int i = (ctag.GetElement() & 0x0F);
+  if ((this->PrivateDictMask & (1u << i)) != 0 &&
+      this->PrivateDictTags[i] == ctag)
+  {
+    return this->PrivateDicts[i];
+  }
+
+  const vtkDICOMDictionary::Dict *dict = 0;
+  const vtkDICOMValue& v = this->Get(ctag);
+  if (v.IsValid())
+  {
+    const char *creator = v.GetCharData();
+    if (creator)
+    {
+      dict = vtkDICOMDictionary::FindPrivateDictionary(creator);
+    }
+    // only cache the result once the creator element has been read
+    this->PrivateDictMask |= (1u << i);
+    this->PrivateDictTags[i] = ctag;
+    this->PrivateDicts[i] = dict;
+  }
+
+  return dict;
+}
+
 //----------------------------------------------------------------------------
 vtkDICOMVR DecoderContext::FindDictVR(vtkDICOMTag tag)
 {
@@ -250,17 +294,22 @@ vtkDICOMVR DecoderContext::FindDictVR(vtkDICOMTag tag)
   else
   {
     vtkDICOMDictEntry de;
-    if ((tag.GetGroup() & 0x1) == 0)
+    unsigned short group = tag.GetGroup();
+    unsigned short element = tag.GetElement();
+    if ((group & 0x1) == 0 || element < 0x0100)
     {
       de = vtkDICOMDictionary::FindDictEntry(tag);
     }
-    else if (this->Item)
-    {
-      de = this->Item->FindDictEntry(tag);
-    }
-    else if (this->MetaData)
+    else
     {
-      de = this->MetaData->FindDictEntry(tag);
+      // use the private creator for this block to find the dictionary
+      const vtkDICOMDictionary::Dict *dict =
+        this->GetPrivateDict(vtkDICOMTag(group, element >> 8));
+      if (dict)
+      {
+        de = vtkDICOMDictionary::FindDictEntryInDict(
+          vtkDICOMTag(group, element & 0x00FF), dict);
+      }
     }
     if (de.IsValid())
     {
@@ -307,10 +356,12 @@ public:
   // Pop the current item context.
   void PopContext();
 
-  // The query with which to filter the data.
+  // The query with which to filter the data, and a matcher that has
+  // been prepared from the same query.
   void SetQuery(
     const vtkDICOMDataElementIterator& iter,
-    const vtkDICOMDataElementIterator& iterEnd);
+    const vtkDICOMDataElementIterator& iterEnd,
+    const vtkDICOMQueryMatcher *matcher);
 
   // Read l bytes of data, or until delimiter tag found.
   // Set l to 0xffffffff to ignore length completely.
@@ -393,7 +444,7 @@ protected:
     Parser(parser), BaseContext(data,idx,parser->GetDefaultCharacterSet(),
       parser->GetOverrideCharacterSet()),
     Item(0), MetaData(data), Index(idx), ImplicitVR(false),
-    HasQuery(false), QueryMatched(false),
+    HasQuery(false), QueryMatched(false), Matcher(0),
     LastVL(0) { this->Context = &this->BaseContext; }
 
   // an internal implicit little-endian decoder
@@ -418,6 +469,8 @@ protected:
   vtkDICOMDataElementIterator Query;
   vtkDICOMDataElementIterator QueryEnd;
   vtkDICOMDataElementIterator QuerySave;
+  // the prepared query, only valid at the top level (not within items)
+  const vtkDICOMQueryMatcher *Matcher;
   // this is set to the last tag that was read.
   vtkDICOMTag LastTag;
   vtkDICOMVR  LastVR;
@@ -607,7 +660,8 @@ inline void DecoderBase::PopContext()
 //----------------------------------------------------------------------------
 void DecoderBase::SetQuery(
   const vtkDICOMDataElementIterator& iter,
-  const vtkDICOMDataElementIterator& iterEnd)
+  const vtkDICOMDataElementIterator& iterEnd,
+  const vtkDICOMQueryMatcher *matcher)
 {
   if (iter != iterEnd)
   {
@@ -616,6 +670,7 @@ void DecoderBase::SetQuery(
     this->Query = iter;
     this->QueryEnd = iterEnd;
     this->QuerySave = iter;
+    this->Matcher = matcher;
   }
   else
   {
@@ -880,7 +935,14 @@ bool DecoderBase::QueryMatches(const vtkDICOMValue& v)
         ((tag.GetGroup() & 1) == 0 || tag.GetElement() > 0x00ff))
     {
       // if above conditions don't apply, check if the query key matches
-      matched = v.Matches(this->Query->GetValue());
+      if (this->Matcher)
+      {
+        matched = this->Matcher->Matches(tag, v);
+      }
+      else
+      {
+        matched = v.Matches(this->Query->GetValue());
+      }
     }
   }
   else
@@ -1301,6 +1363,9 @@ size_t Decoder<E>::ReadElementValue(
       vtkDICOMTag tag = this->LastTag;
       vtkDICOMSequence seq;
       bool queryMatched = false;
+      // only the items of a top-level sequence can be streamed
+      bool streaming = (this->Item == 0 &&
+                        tag == this->Parser->GetStreamingTag());
       l = 0;
       while (l < static_cast<size_t>(vl) || vl == HxFFFFFFFF)
       {
@@ -1324,21 +1389,32 @@ size_t Decoder<E>::ReadElementValue(
                                  this->Parser->GetOverrideCharacterSet());
           this->PushContext(&context, tag);
 
+          bool keepItem = true;
           if (this->HasQuery)
           {
-            if (this->QueryOneItem(cp, ep, il, endtag, l))
-            {
-              queryMatched = true;
-              seq.AddItem(item);
-            }
+            keepItem = this->QueryOneItem(cp, ep, il, endtag, l);
+            queryMatched |= keepItem;
           }
           else
           {
             this->ReadElements(cp, ep, il, endtag, l);
-            seq.AddItem(item);
           }
 
           this->PopContext();
+
+          if (keepItem)
+          {
+            if (streaming)
+            {
+              // pass the item to the observers instead of storing it
+              this->Parser->InvokeEvent(
+                vtkDICOMParser::SequenceItemEvent, &item);
+            }
+            else
+            {
+              seq.AddItem(item);
+            }
+          }
         }
         else if (g == HxFFFE && e == HxE0DD)
         {
@@ -1503,6 +1579,13 @@ bool Decoder<E>::ReadElements(
 
     tl += rl;
 
+    // a new creator value changes the dictionary for its private block
+    if ((tag.GetGroup() & 0x1) != 0 &&
+        tag.GetElement() >= 0x0010 && tag.GetElement() < 0x0100)
+    {
+      this->Context->ClearPrivateDict(tag);
+    }
+
     // store the value
     if (this->Item)
     {
@@ -1559,6 +1642,10 @@ bool Decoder<E>::QueryOneItem(
   vtkDICOMDataElementIterator query = this->Query;
   vtkDICOMDataElementIterator queryEnd = this->QueryEnd;
   vtkDICOMDataElementIterator querySave = this->QuerySave;
+  const vtkDICOMQueryMatcher *matcher = this->Matcher;
+
+  // the matcher only has the top-level keys, so it can't be used here
+  this->Matcher = 0;
 
   // if query element is empty, then use universal matching:
   // set default HasQuery to 'false' to match everything
@@ -1595,6 +1682,7 @@ bool Decoder<E>::QueryOneItem(
   this->Query = query;
   this->QueryEnd = queryEnd;
   this->QuerySave = querySave;
+  this->Matcher = matcher;
 
   return matched;
 }
@@ -1731,7 +1819,9 @@ vtkDICOMParser::vtkDICOMParser()
   this->MetaData = NULL;
   this->Query = NULL;
   this->QueryItem = NULL;
+  this->QueryMatcher = new vtkDICOMQueryMatcher;
   this->Groups = NULL;
+  this->StreamingTag = vtkDICOMTag();
   this->InputFile = NULL;
   this->BytesRead = 0;
   this->FileOffset = 0;
@@ -1739,10 +1829,19 @@ vtkDICOMParser::vtkDICOMParser()
   this->Buffer = NULL;
   this->BufferSize = 8192;
   this->ChunkSize = 0;
+  this->AdaptiveBufferSize = false;
+  this->HeaderSizeEstimate = 0;
+  this->ReadLatency = 0.0;
+  this->ReadTime = 0;
+  this->NumberOfReads = 0;
+  this->NumberOfBytesRead = 0;
   this->Index = -1;
   this->PixelDataVL = 0;
   this->PixelDataFound = false;
   this->QueryMatched = false;
+  this->CheckFileFormat = false;
+  this->FileIsDICOM = false;
+  this->FileError = 0;
   this->DefaultCharacterSet = vtkDICOMCharacterSet::GetGlobalDefault();
   this->OverrideCharacterSet = vtkDICOMCharacterSet::GetGlobalOverride();
   this->ErrorCode = 0;
@@ -1753,6 +1852,7 @@ vtkDICOMParser::~vtkDICOMParser()
 {
   delete [] this->FileName;
   delete this->QueryItem;
+  delete this->QueryMatcher;
 
   if (this->MetaData)
   {
@@ -1768,6 +1868,25 @@ vtkDICOMParser::~vtkDICOMParser()
   }
 }
 
+//----------------------------------------------------------------------------
+void vtkDICOMParser::SetQuery(vtkDICOMMetaData *query)
+{
+  if (this->Query != query)
+  {
+    if (this->Query)
+    {
+      this->Query->Delete();
+    }
+    this->Query = query;
+    if (this->Query)
+    {
+      this->Query->Register(this);
+    }
+    this->UpdateQueryMatcher();
+    this->Modified();
+  }
+}
+
 //----------------------------------------------------------------------------
 void vtkDICOMParser::SetQueryItem(const vtkDICOMItem& query)
 {
@@ -1782,6 +1901,26 @@ void vtkDICOMParser::SetQueryItem(const vtkDICOMItem& query)
   {
     this->QueryItem = new vtkDICOMItem(query);
   }
+  this->UpdateQueryMatcher();
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMParser::UpdateQueryMatcher()
+{
+  // prepare the query once, rather than for every file
+  if (this->Query)
+  {
+    this->QueryMatcher->SetQuery(this->Query->Begin(), this->Query->End());
+  }
+  else if (this->QueryItem)
+  {
+    this->QueryMatcher->SetQuery(*this->QueryItem);
+  }
+  else
+  {
+    this->QueryMatcher->Clear();
+  }
+  this->QueryMatcherTime.Modified();
 }
 
 //----------------------------------------------------------------------------
@@ -1845,6 +1984,11 @@ bool vtkDICOMParser::ReadFile(vtkDICOMMetaData *data, int idx)
   this->QueryMatched = (this->Query != 0 || this->QueryItem != 0);
   this->FileOffset = 0;
   this->FileSize = 0;
+  this->FileIsDICOM = false;
+  this->FileError = 0;
+  this->NumberOfReads = 0;
+  this->NumberOfBytesRead = 0;
+  this->ReadTime = 0;
 
   // Check that the file name has been set.
   if (!this->FileName)
@@ -1856,7 +2000,13 @@ bool vtkDICOMParser::ReadFile(vtkDICOMMetaData *data, int idx)
 
   // Make sure that the file is readable.
   vtkDICOMFile infile(this->FileName, vtkDICOMFile::In);
-  if (infile.GetError())
+  if (infile.GetError() && this->CheckFileFormat)
+  {
+    // The caller will decide whether this is worth reporting
+    this->FileError = infile.GetError();
+    return false;
+  }
+  else if (infile.GetError())
   {
     this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
     const char *errText = "Can't open the file ";
@@ -1874,15 +2024,42 @@ bool vtkDICOMParser::ReadFile(vtkDICOMMetaData *data, int idx)
 
   this->InputFile = &infile;
   this->FileSize = infile.GetSize();
-  this->Buffer = new unsigned char [this->BufferSize + 8];
   this->BytesRead = 0;
   // guard against anyone changing BufferSize while reading
   this->ChunkSize = this->BufferSize;
+  if (this->AdaptiveBufferSize)
+  {
+    this->ChunkSize = this->ComputeChunkSize();
+    if (this->FileSize > this->ChunkSize)
+    {
+      // only part of the file will be read, so system read-ahead would
+      // mostly fetch data that will be skipped (e.g. the pixel data)
+      infile.Advise(0, 0, vtkDICOMFile::RandomAccess);
+      if (this->HeaderSizeEstimate > this->ChunkSize)
+      {
+        infile.Advise(this->ChunkSize,
+          this->HeaderSizeEstimate - this->ChunkSize, vtkDICOMFile::WillNeed);
+      }
+    }
+  }
+  this->Buffer = new unsigned char [this->ChunkSize + 8];
 
   const unsigned char *cp = NULL;
   const unsigned char *ep = NULL;
   this->FillBuffer(cp, ep);
 
+  // Reject the file if the first buffer doesn't look like DICOM
+  if (this->CheckFileFormat &&
+      !vtkDICOMUtilities::IsDICOMFile(cp, static_cast<size_t>(ep - cp)))
+  {
+    this->FileError = infile.GetError();
+    delete [] this->Buffer;
+    infile.Close();
+    this->InputFile = NULL;
+    return false;
+  }
+  this->FileIsDICOM = true;
+
   if (ep - cp >= 132 &&
       cp[128] == 'D' && cp[129] == 'I' && cp[130] == 'C' && cp[131] == 'M')
   {
@@ -1903,9 +2080,73 @@ bool vtkDICOMParser::ReadFile(vtkDICOMMetaData *data, int idx)
   infile.Close();
   this->InputFile = NULL;
 
+  if (this->AdaptiveBufferSize)
+  {
+    // the estimate rises quickly, but decays slowly
+    vtkTypeInt64 size = (this->PixelDataFound ?
+      this->FileOffset : this->GetBytesProcessed(cp, ep));
+    vtkTypeInt64 decay = this->HeaderSizeEstimate - this->HeaderSizeEstimate/8;
+    this->HeaderSizeEstimate = (size > decay ? size : decay);
+
+    // keep a running average of the time per read
+    if (this->NumberOfReads > 0)
+    {
+      double t = static_cast<double>(this->ReadTime)/this->NumberOfReads;
+      this->ReadLatency = (this->ReadLatency == 0.0 ? t :
+                           0.75*this->ReadLatency + 0.25*t);
+    }
+  }
+
   return true;
 }
 
+//----------------------------------------------------------------------------
+int vtkDICOMParser::ComputeChunkSize()
+{
+  // reads that take over a millisecond suggest network storage, where
+  // one large read is much faster than several small ones
+  vtkTypeInt64 maxSize = (this->ReadLatency > 1000.0 ? 1048576 : 65536);
+  vtkTypeInt64 size = this->HeaderSizeEstimate;
+  if (size > maxSize)
+  {
+    size = maxSize;
+  }
+  if (size > this->FileSize)
+  {
+    size = this->FileSize;
+  }
+
+  // round up to a multiple of the typical disk block size
+  size = (size + 4095) & ~static_cast<vtkTypeInt64>(4095);
+  if (size < this->BufferSize)
+  {
+    size = this->BufferSize;
+  }
+
+  return static_cast<int>(size);
+}
+
+//----------------------------------------------------------------------------
+size_t vtkDICOMParser::ReadFromFile(unsigned char *data, size_t size)
+{
+  long long t = 0;
+  if (this->AdaptiveBufferSize)
+  {
+    t = vtkDICOMUtilities::GetUniversalTime();
+  }
+
+  size_t n = this->InputFile->Read(data, size);
+
+  if (this->AdaptiveBufferSize)
+  {
+    this->ReadTime += vtkDICOMUtilities::GetUniversalTime() - t;
+  }
+  this->NumberOfReads++;
+  this->NumberOfBytesRead += n;
+
+  return n;
+}
+
 //----------------------------------------------------------------------------
 bool vtkDICOMParser::ReadMetaHeader(
   const unsigned char* &cp, const unsigned char* &ep,
@@ -2021,6 +2262,12 @@ bool vtkDICOMParser::ReadMetaData(
 
   if (hasQuery)
   {
+    // the query meta data might have been modified since it was set
+    if (this->Query && this->Query->GetMTime() > this->QueryMatcherTime)
+    {
+      this->UpdateQueryMatcher();
+    }
+
     // skip any elements in groups less than 0002
     while (iter != iterEnd && iter->GetTag().GetGroup() < 0x0002)
     {
@@ -2048,7 +2295,8 @@ bool vtkDICOMParser::ReadMetaData(
       {
         if (metaIter->GetTag() == iter->GetTag())
         {
-          matched &= metaIter->GetValue(this->Index).Matches(iter->GetValue());
+          matched &= this->QueryMatcher->Matches(
+            iter->GetTag(), metaIter->GetValue(this->Index));
           ++iter;
           ++metaIter;
         }
@@ -2068,7 +2316,7 @@ bool vtkDICOMParser::ReadMetaData(
     }
 
     // set the query for the decoder so it can scan the rest of the file
-    decoder->SetQuery(iter, iterEnd);
+    decoder->SetQuery(iter, iterEnd, this->QueryMatcher);
   }
 
   // make a list of the groups of interest
@@ -2252,7 +2500,7 @@ bool vtkDICOMParser::FillBuffer(
   }
 
   // read at most n bytes
-  n = this->InputFile->Read(dp, nbytes);
+  n = this->ReadFromFile(dp, nbytes);
 
   // get number of chars read
   this->BytesRead += n;
@@ -2275,14 +2523,42 @@ bool vtkDICOMParser::SeekBuffer(
     return true;
   }
 
-  // otherwise, seek within the file
   vtkTypeInt64 pos = this->GetBytesProcessed(ucp, ep);
-  if (!this->InputFile->GetError() &&
-      this->InputFile->SetPosition(pos + offset))
+  vtkTypeInt64 gap = pos + offset - this->BytesRead;
+  if (this->InputFile->GetError())
+  {
+    return false;
+  }
+
+  // if the new position is within one buffer of what has been read, then
+  // read through to it, since one read is cheaper than a seek and a read
+  if (offset > 0 && gap < this->ChunkSize)
+  {
+    size_t n = this->ReadFromFile(this->Buffer, this->ChunkSize);
+    if (static_cast<vtkTypeInt64>(n) >= gap)
+    {
+      ucp = this->Buffer + gap;
+      ep = this->Buffer + n;
+      this->BytesRead += n;
+    }
+    else
+    {
+      // the new position is past the end of the file
+      ucp = this->Buffer;
+      ep = ucp;
+      this->BytesRead = pos + offset;
+    }
+    return !this->InputFile->GetError();
+  }
+
+  // otherwise, seek within the file
+  if (this->InputFile->SetPosition(pos + offset))
   {
     // read just 8 bytes at the new position, i.e. enough to take a peek
-    // at the next element
-    size_t n = this->InputFile->Read(this->Buffer, 8);
+    // at the next element, unless the buffer size is adaptive, in which
+    // case the buffer is filled to avoid a second round trip
+    size_t m = (this->AdaptiveBufferSize ? this->ChunkSize : 8);
+    size_t n = this->ReadFromFile(this->Buffer, m);
     ucp = this->Buffer;
     ep = ucp + n;
     this->BytesRead = pos + offset + n;
@@ -2368,9 +2644,19 @@ void vtkDICOMParser::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "MetaData: " << this->MetaData << "\n";
   os << indent << "Index: " << this->Index << "\n";
   os << indent << "BufferSize: " << this->BufferSize << "\n";
+  os << indent << "AdaptiveBufferSize: "
+     << (this->AdaptiveBufferSize ? "On\n" : "Off\n");
+  os << indent << "NumberOfReads: " << this->NumberOfReads << "\n";
+  os << indent << "NumberOfBytesRead: " << this->NumberOfBytesRead << "\n";
+  os << indent << "CheckFileFormat: "
+     << (this->CheckFileFormat ? "On\n" : "Off\n");
+  os << indent << "FileIsDICOM: "
+     << (this->FileIsDICOM ? "True\n" : "False\n");
+  os << indent << "FileError: " << this->FileError << "\n";
   os << indent << "Query: " << this->Query << "\n";
   os << indent << "QueryItem: " << this->QueryItem << "\n";
   os << indent << "QueryMatched: "
      << (this->QueryMatched ? "True\n" : "False\n");
   os << indent << "Groups: " << this->Groups << "\n";
+  os << indent << "StreamingTag: " << this->StreamingTag << "\n";
 }
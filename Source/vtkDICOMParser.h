@@ -18,10 +18,13 @@
 #include "vtkStdString.h" // For std::string
 #include "vtkDICOMModule.h" // For export macro
 #include "vtkDICOMCharacterSet.h" // For character sets
+#include "vtkDICOMTag.h" // For vtkDICOMTag
+#include "vtkCommand.h" // For UserEvent
 
 class vtkDICOMFile;
 class vtkDICOMItem;
 class vtkDICOMMetaData;
+class vtkDICOMQueryMatcher;
 class vtkUnsignedShortArray;
 class vtkDICOMParserInternalFriendship;
 
@@ -42,6 +45,12 @@ public:
   //! VTK dynamic type information macro.
   vtkTypeMacro(vtkDICOMParser, vtkObject);
 
+  //! Events specific to vtkDICOMParser.
+  enum EventIds
+  {
+    SequenceItemEvent = vtkCommand::UserEvent + 2358
+  };
+
   //! Print a summary of the contents of this object.
 #ifdef VTK_OVERRIDE
   void PrintSelf(ostream& os, vtkIndent indent) VTK_OVERRIDE;
@@ -100,7 +109,9 @@ public:
   /*!
    *  This can be used to scan a file for data that matches a given
    *  query.  For more information on how matching is done, see the
-   *  vtkDICOMValue::Matches() method.
+   *  vtkDICOMValue::Matches() method.  The query is prepared for
+   *  matching when it is set, and again if it is modified, so the
+   *  same parser should be used for all the files that are queried.
    */
   void SetQuery(vtkDICOMMetaData *query);
   vtkDICOMMetaData *GetQuery() { return this->Query; }
@@ -117,6 +128,21 @@ public:
   void SetQueryItem(const vtkDICOMItem& query);
   //@}
 
+  //@{
+  //! Stream the items of a sequence, instead of storing them.
+  /*!
+   *  If this is set to the tag of a top-level sequence, then as each item
+   *  of that sequence is read, a SequenceItemEvent is invoked with the
+   *  item (a vtkDICOMItem pointer) as the call data.  The items are not
+   *  stored, so the sequence will be empty after the file has been read.
+   *  This allows long sequences, such as the DirectoryRecordSequence of a
+   *  large DICOMDIR, to be processed while the file is being read.  The
+   *  default is an empty tag, which disables streaming.
+   */
+  void SetStreamingTag(vtkDICOMTag tag) { this->StreamingTag = tag; }
+  vtkDICOMTag GetStreamingTag() { return this->StreamingTag; }
+  //@}
+
   //@{
   //! Set specific metadata groups to read (obsolete).
   /*!
@@ -156,6 +182,44 @@ public:
    */
   void SetBufferSize(int size);
   int GetBufferSize() { return this->BufferSize; }
+
+  //! Choose the buffer size for each file, based on earlier files.
+  /*!
+   *  When a parser is used to scan many files, this option sizes the
+   *  buffer to fit the meta data that was found in the previous files,
+   *  so that each header can usually be read in one go.  The size is
+   *  limited to 64k on fast storage, or to 1M if the reads are slow
+   *  (e.g. network storage), and the BufferSize is used as a minimum.
+   */
+  void SetAdaptiveBufferSize(bool b) { this->AdaptiveBufferSize = b; }
+  bool GetAdaptiveBufferSize() { return this->AdaptiveBufferSize; }
+  //@}
+
+  //@{
+  //! Get the number of read calls that were used for the last file.
+  int GetNumberOfReads() { return this->NumberOfReads; }
+
+  //! Get the number of bytes that were read from the last file.
+  vtkTypeInt64 GetNumberOfBytesRead() { return this->NumberOfBytesRead; }
+  //@}
+
+  //@{
+  //! Check that the file is DICOM before parsing it.
+  /*!
+   *  If this is on, the first buffer that is read from the file is checked
+   *  with vtkDICOMUtilities::IsDICOMFile(), and if the file cannot be read
+   *  or if it is not DICOM, Update() will return without reporting an
+   *  error.  This saves opening each file twice when scanning through
+   *  files that might not be DICOM.  Check GetFileIsDICOM() afterwards.
+   */
+  void SetCheckFileFormat(bool b) { this->CheckFileFormat = b; }
+  bool GetCheckFileFormat() { return this->CheckFileFormat; }
+
+  //! This is false if the file could not be read, or failed the check.
+  bool GetFileIsDICOM() { return this->FileIsDICOM; }
+
+  //! Get the vtkDICOMFile error code, if the file could not be read.
+  int GetFileError() { return this->FileError; }
   //@}
 
   //@{
@@ -228,12 +292,24 @@ protected:
   vtkTypeInt64 GetBytesProcessed(
     const unsigned char* cp, const unsigned char* ep);
 
+  //! Read from the file, and keep track of the number of reads.
+  size_t ReadFromFile(unsigned char *data, size_t size);
+
+  //! Choose the buffer size for the next file.
+  int ComputeChunkSize();
+
+  //! Prepare the query for matching.
+  void UpdateQueryMatcher();
+
   char *FileName;
   std::string TransferSyntax;
   vtkDICOMMetaData *MetaData;
   vtkDICOMMetaData *Query;
   vtkDICOMItem *QueryItem;
+  vtkDICOMQueryMatcher *QueryMatcher;
+  vtkTimeStamp QueryMatcherTime;
   vtkUnsignedShortArray *Groups;
+  vtkDICOMTag StreamingTag;
   vtkDICOMFile *InputFile;
   vtkTypeInt64 BytesRead;
   vtkTypeInt64 FileOffset;
@@ -241,10 +317,19 @@ protected:
   unsigned char *Buffer;
   int BufferSize;
   int ChunkSize;
+  bool AdaptiveBufferSize;
+  vtkTypeInt64 HeaderSizeEstimate;
+  double ReadLatency;
+  long long ReadTime;
+  int NumberOfReads;
+  vtkTypeInt64 NumberOfBytesRead;
   int Index;
   unsigned int PixelDataVL;
   bool PixelDataFound;
   bool QueryMatched;
+  bool CheckFileFormat;
+  bool FileIsDICOM;
+  int FileError;
   vtkDICOMCharacterSet DefaultCharacterSet;
   bool OverrideCharacterSet;
   unsigned long ErrorCode;
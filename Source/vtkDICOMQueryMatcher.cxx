@@ -0,0 +1,441 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDICOMQueryMatcher.h"
+#include "vtkDICOMItem.h"
+#include "vtkDICOMUtilities.h"
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+//----------------------------------------------------------------------------
+namespace {
+
+// The ways in which a query key can be matched
+enum MatchMethod
+{
+  UniversalMatch,   // key is empty, everything matches
+  DefaultMatch,     // use vtkDICOMValue::Matches()
+  DateTimeMatch,    // date, time, or datetime, possibly a range
+  PersonNameMatch,  // case-insensitive person name matching
+  SingleValueMatch, // wildcard matching for single-valued text
+  MultiValueMatch,  // matching of backslash-separated values
+  UIDListMatch      // matching against a list of UIDs
+};
+
+} // end anonymous namespace
+
+//----------------------------------------------------------------------------
+// A query key, and the information needed to match it
+struct vtkDICOMQueryMatcher::Key
+{
+  vtkDICOMTag Tag;
+  vtkDICOMValue Query;
+  int Method;
+  // the pattern, for wildcard matching
+  std::string Pattern;
+  size_t PatternLength;
+  // the normalized names, or the sorted UIDs
+  std::vector<std::string> Patterns;
+  // the normalized start and end of a date or time range
+  char Start[22];
+  char End[22];
+  size_t StartLength;
+  size_t EndLength;
+  bool Range;
+
+  bool operator<(const Key& o) const { return (this->Tag < o.Tag); }
+};
+
+class vtkDICOMQueryMatcher::KeyVector
+  : public std::vector<vtkDICOMQueryMatcher::Key>
+{
+};
+
+//----------------------------------------------------------------------------
+vtkDICOMQueryMatcher::vtkDICOMQueryMatcher()
+{
+  this->Keys = new KeyVector;
+}
+
+//----------------------------------------------------------------------------
+vtkDICOMQueryMatcher::~vtkDICOMQueryMatcher()
+{
+  delete this->Keys;
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMQueryMatcher::SetQuery(
+  const vtkDICOMDataElementIterator& iter,
+  const vtkDICOMDataElementIterator& iterEnd)
+{
+  this->Keys->clear();
+
+  for (vtkDICOMDataElementIterator i = iter; i != iterEnd; ++i)
+  {
+    this->Keys->push_back(Key());
+    Key& key = this->Keys->back();
+    key.Tag = i->GetTag();
+    key.Query = i->GetValue();
+    vtkDICOMQueryMatcher::CompileKey(&key);
+  }
+
+  // data elements are stored in order, but make sure
+  std::stable_sort(this->Keys->begin(), this->Keys->end());
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMQueryMatcher::SetQuery(const vtkDICOMItem& query)
+{
+  this->SetQuery(query.Begin(), query.End());
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMQueryMatcher::Clear()
+{
+  this->Keys->clear();
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMQueryMatcher::IsEmpty() const
+{
+  return this->Keys->empty();
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMQueryMatcher::Matches(
+  vtkDICOMTag tag, const vtkDICOMValue& value) const
+{
+  // binary search for the key
+  const KeyVector& keys = *this->Keys;
+  size_t lo = 0;
+  size_t hi = keys.size();
+  while (lo < hi)
+  {
+    size_t mid = (lo + hi)/2;
+    if (keys[mid].Tag < tag)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  if (lo == keys.size() || keys[lo].Tag != tag)
+  {
+    return true;
+  }
+  return vtkDICOMQueryMatcher::MatchesKey(keys[lo], value);
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMQueryMatcher::CompileKey(Key *key)
+{
+  const vtkDICOMValue& value = key->Query;
+  vtkDICOMVR vr = value.GetVR();
+  key->Method = DefaultMatch;
+  key->PatternLength = 0;
+  key->StartLength = 0;
+  key->EndLength = 0;
+  key->Range = false;
+  key->Start[0] = '\0';
+  key->End[0] = '\0';
+
+  // keys with no value match everything (universal matching)
+  if (!value.IsValid())
+  {
+    key->Method = UniversalMatch;
+    return;
+  }
+  const vtkDICOMItem *items = value.GetSequenceData();
+  if (items)
+  {
+    // empty sequences, or sequences with an empty item, match everything
+    if (value.GetNumberOfValues() == 0 ||
+        items->GetNumberOfDataElements() == 0)
+    {
+      key->Method = UniversalMatch;
+    }
+    return;
+  }
+  if (value.GetVL() == 0)
+  {
+    key->Method = UniversalMatch;
+    return;
+  }
+
+  // only text is prepared, everything else uses the default method
+  const char *pattern = value.GetCharData();
+  if (pattern == 0)
+  {
+    return;
+  }
+
+  // does the pattern have wildcards?
+  bool wildcard = false;
+  size_t pl = 0;
+  while (pattern[pl] != '\0' && pl < value.GetVL())
+  {
+    char c = pattern[pl++];
+    wildcard |= (c == '*');
+    wildcard |= (c == '?');
+  }
+  key->Pattern.assign(pattern, pl);
+  while (pl > 0 && pattern[pl-1] == ' ') { pl--; }
+  key->PatternLength = pl;
+
+  if (!wildcard &&
+      (vr == vtkDICOMVR::DA ||
+       vr == vtkDICOMVR::TM ||
+       vr == vtkDICOMVR::DT))
+  {
+    // find the position of the hyphen
+    size_t hp = 0;
+    while (hp < pl && pattern[hp] != '-') { hp++; }
+    if (vr == vtkDICOMVR::DT && hp + 5 < pl)
+    {
+      // check if the hyphen was part of the timezone offset
+      if (pattern[hp+5] == '-')
+      {
+        hp += 5;
+      }
+      else if (hp != 4 && pattern[hp+5] == '\0')
+      {
+        hp = 0;
+      }
+    }
+    // get a pointer to the part of pattern after the hyphen
+    const char *dp = &pattern[hp];
+    bool hyphen = (*dp == '-');
+    dp += hyphen;
+
+    // normalize the start and end of the range
+    if (pattern[0] != '\0' && pattern[0] != '-')
+    {
+      key->StartLength =
+        vtkDICOMValue::NormalizeDateTime(pattern, key->Start, vr);
+    }
+    if (dp[0] != '\0' && dp[0] != '-')
+    {
+      key->EndLength = vtkDICOMValue::NormalizeDateTime(dp, key->End, vr);
+    }
+    key->Range = hyphen;
+    key->Method = DateTimeMatch;
+  }
+  else if (vr == vtkDICOMVR::PN)
+  {
+    // case-fold the pattern, and normalize each of the names
+    std::string pstr =
+      value.GetCharacterSet().CaseFoldedUTF8(pattern, pl);
+    char normalizedPattern[256];
+    const char *pp = pstr.c_str();
+    for (;;)
+    {
+      vtkDICOMValue::NormalizePersonName(pp, normalizedPattern, true);
+      key->Patterns.push_back(normalizedPattern);
+      while (*pp != '\0' && *pp != '\\') { pp++; }
+      if (*pp == '\0') { break; }
+      pp++;
+    }
+    key->Method = PersonNameMatch;
+  }
+  else
+  {
+    if (vr.HasSpecificCharacterSet())
+    {
+      // convert the pattern to utf-8
+      key->Pattern = value.AsUTF8String();
+      key->PatternLength = key->Pattern.length();
+    }
+
+    if (vr.HasSingleValue())
+    {
+      key->Method = SingleValueMatch;
+    }
+    else if (vr == vtkDICOMVR::UI)
+    {
+      // store the UIDs in sorted order, with spaces stripped
+      const char *pp = key->Pattern.c_str();
+      for (;;)
+      {
+        const char *pd = pp;
+        while (*pd != '\0' && *pd != '\\') { pd++; }
+        const char *pf = pd;
+        while (*pp == ' ') { pp++; }
+        while (pf != pp && pf[-1] == ' ') { --pf; }
+        key->Patterns.push_back(std::string(pp, pf - pp));
+        if (*pd == '\0') { break; }
+        pp = pd + 1;
+      }
+      std::sort(key->Patterns.begin(), key->Patterns.end());
+      key->Method = UIDListMatch;
+    }
+    else
+    {
+      key->Method = MultiValueMatch;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMQueryMatcher::MatchesKey(
+  const Key& key, const vtkDICOMValue& value)
+{
+  if (key.Method == UniversalMatch)
+  {
+    return true;
+  }
+
+  if (!value.IsValid() || value.GetVR() != key.Query.GetVR())
+  {
+    // match is impossible if VRs differ
+    return false;
+  }
+
+  const char *cp = value.GetCharData();
+  if (key.Method == DefaultMatch || cp == 0)
+  {
+    const vtkDICOMValue *vp = value.GetMultiplexData();
+    if (vp && key.Method != DefaultMatch)
+    {
+      // match if any of the contained values match
+      size_t vn = value.GetNumberOfValues();
+      for (size_t i = 0; i < vn; i++)
+      {
+        if (vtkDICOMQueryMatcher::MatchesKey(key, vp[i]))
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+    return value.Matches(key.Query);
+  }
+
+  // remove any trailing nulls and spaces
+  size_t l = value.GetVL();
+  while (l > 0 && cp[l-1] == '\0') { l--; }
+  while (l > 0 && cp[l-1] == ' ') { l--; }
+
+  bool match = false;
+  vtkDICOMVR vr = value.GetVR();
+
+  if (key.Method == DateTimeMatch)
+  {
+    // perform lexical comparison on normalized datetime
+    char d[22];
+    vtkDICOMValue::NormalizeDateTime(cp, d, vr);
+    const char *r1 = key.Start;
+    const char *r2 = key.End;
+    size_t n1 = key.StartLength;
+    size_t n2 = key.EndLength;
+    if (!key.Range)
+    {
+      match = (strncmp(d, r1, n1) == 0);
+    }
+    else if (*r1 != '\0')
+    {
+      match = (strncmp(d, r1, n1) >= 0);
+    }
+    else if (*r2 != '\0')
+    {
+      match = (strncmp(r2, d, n2) >= 0);
+    }
+    else
+    {
+      match = (strncmp(r2, d, n2) >= 0 && strncmp(d, r1, n1) >= 0);
+    }
+  }
+  else if (key.Method == PersonNameMatch)
+  {
+    // convert to lowercase utf-8, one name at a time
+    vtkDICOMCharacterSet cs = value.GetCharacterSet();
+    std::string str;
+    const char *ep = cp + l;
+    while (cp != ep && *cp != '\0')
+    {
+      size_t n = cs.NextBackslash(cp, ep);
+      str.append(cs.CaseFoldedUTF8(cp, n));
+      cp += n;
+      if (cp != ep && *cp == '\\')
+      {
+        str.append(cp, 1);
+        cp++;
+      }
+    }
+
+    char normalizedName[256];
+    const char *vp = str.c_str();
+    while (!match)
+    {
+      vtkDICOMValue::NormalizePersonName(vp, normalizedName);
+      size_t nl = strlen(normalizedName);
+      for (size_t i = 0; i < key.Patterns.size() && !match; i++)
+      {
+        const std::string& p = key.Patterns[i];
+        match = vtkDICOMUtilities::PatternMatches(
+          p.c_str(), p.length(), normalizedName, nl);
+      }
+
+      // break if no values remain
+      while (*vp != '\0' && *vp != '\\') { vp++; }
+      if (*vp == '\0') { break; }
+      vp++;
+    }
+  }
+  else if (key.Method == UIDListMatch)
+  {
+    // match if any of the UIDs is in the list
+    const char *vp = cp;
+    while (!match)
+    {
+      const char *vd = vp;
+      while (*vd != '\0' && *vd != '\\') { vd++; }
+      const char *vf = vd;
+      while (*vp == ' ') { vp++; }
+      while (vf != vp && vf[-1] == ' ') { --vf; }
+      match = std::binary_search(key.Patterns.begin(), key.Patterns.end(),
+                                 std::string(vp, vf - vp));
+      if (*vd == '\0') { break; }
+      vp = vd + 1;
+    }
+  }
+  else
+  {
+    std::string str;
+    if (vr.HasSpecificCharacterSet())
+    {
+      // convert value to utf-8 before matching
+      str = value.AsUTF8String();
+      cp = str.c_str();
+      l = str.length();
+    }
+
+    if (key.Method == SingleValueMatch)
+    {
+      match = vtkDICOMUtilities::PatternMatches(
+        key.Pattern.c_str(), key.PatternLength, cp, l);
+    }
+    else
+    {
+      match = vtkDICOMValue::PatternMatchesMulti(
+        key.Pattern.c_str(), cp, vr);
+    }
+  }
+
+  return match;
+}
@@ -0,0 +1,86 @@
+/*=========================================================================
+
+  Program: DICOM for VTK
+
+  Copyright (c) 2012-2017 David Gobbi
+  All rights reserved.
+  See Copyright.txt or http://dgobbi.github.io/bsd3.txt for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#ifndef vtkDICOMQueryMatcher_h
+#define vtkDICOMQueryMatcher_h
+
+#include "vtkSystemIncludes.h"
+#include "vtkDICOMModule.h" // For export macro
+#include "vtkDICOMDataElement.h" // For vtkDICOMDataElementIterator
+
+class vtkDICOMItem;
+
+//! A find query that has been prepared for matching many data sets.
+/*!
+ *  When vtkDICOMValue::Matches() is used to check a value against a
+ *  query key, the key is examined anew for each value: date and time
+ *  ranges are parsed, person names are case-folded and normalized,
+ *  and text is converted to UTF-8.  This class does that work once,
+ *  when the query is set, so that the matching of each value is cheap.
+ *  Lists of UIDs are sorted so that they can be searched efficiently.
+ *  The results are identical to those of vtkDICOMValue::Matches().
+ */
+class VTKDICOM_EXPORT vtkDICOMQueryMatcher
+{
+public:
+  //@{
+  //! Construct an empty matcher, which will match everything.
+  vtkDICOMQueryMatcher();
+
+  //! Destructor.
+  ~vtkDICOMQueryMatcher();
+  //@}
+
+  //@{
+  //! Prepare the query keys in the range from "iter" to "iterEnd".
+  void SetQuery(const vtkDICOMDataElementIterator& iter,
+                const vtkDICOMDataElementIterator& iterEnd);
+
+  //! Prepare all of the keys in a query item.
+  void SetQuery(const vtkDICOMItem& query);
+
+  //! Remove all of the query keys.
+  void Clear();
+
+  //! Check whether there are no query keys.
+  bool IsEmpty() const;
+  //@}
+
+  //@{
+  //! Check whether a value matches the query key with the given tag.
+  /*!
+   *  The result is the same as value.Matches(key), where "key" is the
+   *  value of the query key with the given tag.  If there is no query
+   *  key with the given tag, then the return value is true.
+   */
+  bool Matches(vtkDICOMTag tag, const vtkDICOMValue& value) const;
+  //@}
+
+private:
+  vtkDICOMQueryMatcher(const vtkDICOMQueryMatcher&); // = delete;
+  vtkDICOMQueryMatcher& operator=(const vtkDICOMQueryMatcher&); // = delete;
+
+  struct Key;
+  class KeyVector;
+
+  //! Prepare a query key for matching.
+  static void CompileKey(Key *key);
+
+  //! Match a value against a prepared query key.
+  static bool MatchesKey(const Key& key, const vtkDICOMValue& value);
+
+  KeyVector *Keys;
+};
+
+#endif /* vtkDICOMQueryMatcher_h */
+// VTK-HeaderTest-Exclude: vtkDICOMQueryMatcher.h
@@ -14,6 +14,7 @@
 #include "vtkDICOMReader.h"
 #include "vtkDICOMAlgorithm.h"
 #include "vtkDICOMFile.h"
+#include "vtkDICOMFileBatch.h"
 #include "vtkDICOMFilePath.h"
 #include "vtkDICOMMetaData.h"
 #include "vtkDICOMParser.h"
@@ -103,6 +104,8 @@ vtkDICOMReader::vtkDICOMReader()
   this->NumberOfPackedComponents = 1;
   this->NumberOfPlanarComponents = 1;
   this->Sorting = 1;
+  this->ReadOrder = vtkDICOMFile::NameOrder;
+  this->ReadAhead = 0;
   this->TimeAsVector = 0;
   this->DesiredTimeIndex = -1;
   this->TimeDimension = 0;
@@ -223,6 +226,11 @@ void vtkDICOMReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "FrameIndexArray: " << this->FrameIndexArray << "\n";
 
   os << indent << "Sorting: " << (this->Sorting ? "On\n" : "Off\n");
+  os << indent << "ReadOrder: "
+     << (this->ReadOrder == vtkDICOMFile::IndexOrder ? "Index\n" :
+         (this->ReadOrder == vtkDICOMFile::PhysicalOrder ?
+          "Physical\n" : "Name\n"));
+  os << indent << "ReadAhead: " << this->ReadAhead << "\n";
   os << indent << "TimeAsVector: "
      << (this->TimeAsVector ? "On\n" : "Off\n");
   os << indent << "TimeDimension: " << this->TimeDimension << "\n";
@@ -744,8 +752,46 @@ int vtkDICOMReader::RequestInformation(
   this->FileOffsetArray->SetNumberOfComponents(2);
   this->FileOffsetArray->SetNumberOfTuples(numFiles);
 
+  // Choose the order in which to read the files.
+  std::vector<int> readOrder(numFiles > 0 ? numFiles : 0);
   for (int idx = 0; idx < numFiles; idx++)
   {
+    readOrder[idx] = idx;
+  }
+  if (this->ReadOrder != vtkDICOMFile::NameOrder && numFiles > 1)
+  {
+    std::vector<std::string> names(numFiles);
+    std::vector<const char *> namePtrs(numFiles);
+    for (int idx = 0; idx < numFiles; idx++)
+    {
+      this->ComputeInternalFileName(this->DataExtent[4] + idx);
+      names[idx] = this->InternalFileName;
+      namePtrs[idx] = names[idx].c_str();
+    }
+    vtkDICOMFile::SortByLocation(
+      &namePtrs[0], numFiles, &readOrder[0], this->ReadOrder);
+  }
+
+  // Read the headers of upcoming files in the background
+  vtkDICOMFileBatch *readAhead = 0;
+  if (this->ReadAhead > 0 && numFiles > 1)
+  {
+    readAhead = new vtkDICOMFileBatch(this->ReadAhead);
+  }
+  int readAheadIdx = 1;
+
+  for (int ridx = 0; ridx < numFiles; ridx++)
+  {
+    for (; readAhead && readAheadIdx < numFiles &&
+           readAheadIdx <= ridx + this->ReadAhead; readAheadIdx++)
+    {
+      this->ComputeInternalFileName(
+        this->DataExtent[4] + readOrder[readAheadIdx]);
+      readAhead->Prefetch(
+        this->InternalFileName, 0, this->Parser->GetBufferSize());
+    }
+
+    int idx = readOrder[ridx];
     this->ComputeInternalFileName(this->DataExtent[4] + idx);
     this->Parser->SetFileName(this->InternalFileName);
     this->Parser->SetIndex(idx);
@@ -763,6 +809,8 @@ int vtkDICOMReader::RequestInformation(
     this->FileOffsetArray->SetTupleValue(idx, offset);
   }
 
+  delete readAhead;
+
   // Files are read in the order provided, but they might have
   // to be re-sorted to create a proper volume.  The FileIndexArray
   // holds the sorted order of the files.
@@ -2028,6 +2076,30 @@ int vtkDICOMReader::RequestData(
     }
   }
 
+  // sort the files by their location on disk, if requested
+  int numFilesToRead = static_cast<int>(files.size());
+  if (this->ReadOrder != vtkDICOMFile::NameOrder && numFilesToRead > 1)
+  {
+    std::vector<std::string> names(numFilesToRead);
+    std::vector<const char *> namePtrs(numFilesToRead);
+    for (int idx = 0; idx < numFilesToRead; idx++)
+    {
+      this->ComputeInternalFileName(files[idx].FileIndex);
+      names[idx] = this->InternalFileName;
+      namePtrs[idx] = names[idx].c_str();
+    }
+    std::vector<int> readOrder(numFilesToRead);
+    vtkDICOMFile::SortByLocation(
+      &namePtrs[0], numFilesToRead, &readOrder[0], this->ReadOrder);
+    std::vector<vtkDICOMReaderFileInfo> sortedFiles;
+    sortedFiles.reserve(numFilesToRead);
+    for (int idx = 0; idx < numFilesToRead; idx++)
+    {
+      sortedFiles.push_back(files[readOrder[idx]]);
+    }
+    files.swap(sortedFiles);
+  }
+
   // get the data object, allocate memory
   vtkImageData *data =
     static_cast<vtkImageData *>(outInfo->Get(vtkDataObject::DATA_OBJECT()));
@@ -2078,11 +2150,30 @@ int vtkDICOMReader::RequestData(
   unsigned char *fileBuffer = 0;
   int framesInPreviousFile = -1;
 
+  // Read the pixel data of upcoming files in the background
+  vtkDICOMFileBatch *readAhead = 0;
+  if (this->ReadAhead > 0 && files.size() > 1)
+  {
+    readAhead = new vtkDICOMFileBatch(this->ReadAhead);
+  }
+  size_t readAheadIdx = 1;
+
   // loop through all files in the update extent
   for (size_t idx = 0; idx < files.size(); idx++)
   {
     if (this->AbortExecute) { break; }
 
+    for (; readAhead && readAheadIdx < files.size() &&
+           readAheadIdx <= idx + this->ReadAhead; readAheadIdx++)
+    {
+      vtkTypeInt64 offset[2];
+      int aheadIdx = files[readAheadIdx].FileIndex;
+      this->FileOffsetArray->GetTupleValue(aheadIdx, offset);
+      this->ComputeInternalFileName(aheadIdx);
+      readAhead->Prefetch(this->InternalFileName, offset[0],
+                          offset[1] - offset[0]);
+    }
+
     this->UpdateProgress(static_cast<double>(idx)/
                          static_cast<double>(files.size()));
 
@@ -2215,6 +2306,7 @@ int vtkDICOMReader::RequestData(
     }
   }
 
+  delete readAhead;
   delete [] rowBuffer;
   delete [] fileBuffer;
 
@@ -25,6 +25,7 @@
 #include "vtkImageReader2.h"
 #include "vtkDICOMModule.h" // For export macro
 #include "vtkDICOMCharacterSet.h" // For character sets
+#include "vtkDICOMFile.h" // For read orders
 
 class vtkIntArray;
 class vtkTypeInt64Array;
@@ -167,6 +168,35 @@ public:
   vtkBooleanMacro(Sorting, int)
   //@}
 
+  //@{
+  //! Set the order in which the files are read from disk.
+  /*!
+   *  By default, files are read in the order that they were given.  On
+   *  spinning disks or tape-backed storage, it can be much faster to read
+   *  them in the order of their location on disk, see vtkDICOMFile for a
+   *  description of the orders.  The output is not affected by this.
+   */
+  vtkSetMacro(ReadOrder, int);
+  void SetReadOrderToName() { this->SetReadOrder(vtkDICOMFile::NameOrder); }
+  void SetReadOrderToIndex() { this->SetReadOrder(vtkDICOMFile::IndexOrder); }
+  void SetReadOrderToPhysical() {
+    this->SetReadOrder(vtkDICOMFile::PhysicalOrder); }
+  vtkGetMacro(ReadOrder, int);
+  //@}
+
+  //@{
+  //! Set the number of files to read ahead.
+  /*!
+   *  While each file is read, the next few files are read into the
+   *  system's file cache in the background, so that the storage device
+   *  is kept busy with several requests at once (see vtkDICOMFileBatch).
+   *  The default is zero, which disables it, and a value of 16 is a good
+   *  choice for network or spinning-disk storage.
+   */
+  vtkSetMacro(ReadAhead, int);
+  vtkGetMacro(ReadAhead, int);
+  //@}
+
   //@{
   //! Set a custom sorter to be used to sort files and frames into slices.
   /*!
@@ -453,6 +483,10 @@ protected:
   //! Select whether to sort the files.
   int Sorting;
 
+  //! The order in which to read the files.
+  int ReadOrder;
+  int ReadAhead;
+
   //! Information for rescaling data to quantitative units.
   double RescaleIntercept;
   double RescaleSlope;
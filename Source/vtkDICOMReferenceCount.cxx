@@ -30,3 +30,63 @@ unsigned int vtkDICOMReferenceCount::operator++()
     InterlockedIncrement(reinterpret_cast<LONG *>(&this->Counter)));
 }
 #endif
+
+#if defined(_WIN32)
+void vtkDICOMReferenceCount::Fence()
+{
+  MemoryBarrier();
+}
+#endif
+
+#if defined(_WIN32)
+bool vtkDICOMReferenceCount::CompareAndSwap(
+  void **ptr, void *oldval, void *newval)
+{
+  return (InterlockedCompareExchangePointer(ptr, newval, oldval) == oldval);
+}
+#endif
+
+#if !defined(_WIN32) && !defined(VTK_DICOM_SYNC_BUILTINS)
+// Without atomic builtins, a mutex is used.  Locking and unlocking the
+// mutex also acts as a full memory barrier.
+#include <pthread.h>
+
+namespace {
+pthread_mutex_t vtkDICOMReferenceCountMutex = PTHREAD_MUTEX_INITIALIZER;
+} // end anonymous namespace
+
+unsigned int vtkDICOMReferenceCount::operator--()
+{
+  pthread_mutex_lock(&vtkDICOMReferenceCountMutex);
+  unsigned int c = --this->Counter;
+  pthread_mutex_unlock(&vtkDICOMReferenceCountMutex);
+  return c;
+}
+
+unsigned int vtkDICOMReferenceCount::operator++()
+{
+  pthread_mutex_lock(&vtkDICOMReferenceCountMutex);
+  unsigned int c = ++this->Counter;
+  pthread_mutex_unlock(&vtkDICOMReferenceCountMutex);
+  return c;
+}
+
+void vtkDICOMReferenceCount::Fence()
+{
+  pthread_mutex_lock(&vtkDICOMReferenceCountMutex);
+  pthread_mutex_unlock(&vtkDICOMReferenceCountMutex);
+}
+
+bool vtkDICOMReferenceCount::CompareAndSwap(
+  void **ptr, void *oldval, void *newval)
+{
+  pthread_mutex_lock(&vtkDICOMReferenceCountMutex);
+  bool r = (*ptr == oldval);
+  if (r)
+  {
+    *ptr = newval;
+  }
+  pthread_mutex_unlock(&vtkDICOMReferenceCountMutex);
+  return r;
+}
+#endif
@@ -37,29 +37,53 @@ public:
   bool operator!=(unsigned int x) const {
     return this->Counter != x; }
 
+  //! A full memory barrier, for sharing data with other threads.
+  /*!
+   *  Data that other threads read without a lock must be completely
+   *  written before the pointer to the data is stored.
+   */
+  static void Fence();
+
+  //! Atomically replace a pointer, if it still has the expected value.
+  /*!
+   *  This is used to publish data that is computed on demand by const
+   *  methods.  It returns false if another thread stored a different
+   *  pointer first, in which case the caller should discard its copy.
+   */
+  static bool CompareAndSwap(void **ptr, void *oldval, void *newval);
+
 private:
   unsigned int Counter;
 };
 
-#if !defined(_WIN32)
+// Use the gcc atomic builtins if available, otherwise the methods are
+// defined in the .cxx file (Interlocked functions on Windows, or a mutex)
+#if !defined(_WIN32) && (defined(VTK_HAVE_SYNC_BUILTINS) || \
+  (defined(__GNUC__) && \
+   (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1))))
+#define VTK_DICOM_SYNC_BUILTINS
+#endif
+
+#if defined(VTK_DICOM_SYNC_BUILTINS)
 inline unsigned int vtkDICOMReferenceCount::operator--()
 {
-#if defined(VTK_HAVE_SYNC_BUILTINS)
   return __sync_sub_and_fetch(&this->Counter, 1);
-#else
-  return --this->Counter;
-#endif
 }
-#endif
 
-#if !defined(_WIN32)
 inline unsigned int vtkDICOMReferenceCount::operator++()
 {
-#if defined(VTK_HAVE_SYNC_BUILTINS)
   return __sync_add_and_fetch(&this->Counter, 1);
-#else
-  return ++this->Counter;
-#endif
+}
+
+inline void vtkDICOMReferenceCount::Fence()
+{
+  __sync_synchronize();
+}
+
+inline bool vtkDICOMReferenceCount::CompareAndSwap(
+  void **ptr, void *oldval, void *newval)
+{
+  return __sync_bool_compare_and_swap(ptr, oldval, newval);
 }
 #endif
 
@@ -389,7 +389,7 @@ int vtkDICOMToRAS::RequestUpdateExtent(
 
   for (int i = 0; i < 3; i++)
   {
-    int offset = outExt[2*i];
+    int offset = outExt[2*i] - wholeExt[2*i];
     int size = outExt[2*i + 1] - outExt[2*i] + 1;
     int wholeSize = wholeExt[2*i + 1] - wholeExt[2*i] + 1;
     if (flip[i])
@@ -400,7 +400,7 @@ int vtkDICOMToRAS::RequestUpdateExtent(
     inExt[2*i + 1] = inExt[2*i] + size - 1;
   }
 
-  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), outExt, 6);
+  inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), inExt, 6);
 
   return 1;
 }
@@ -570,7 +570,7 @@ void vtkDICOMToRAS::ThreadedRequestData(
   int inExecuteExt[6];
   for (int i = 0; i < 3; i++)
   {
-    int offset = outExecuteExt[2*i];
+    int offset = outExecuteExt[2*i] - inWholeExt[2*i];
     int size = outExecuteExt[2*i + 1] - outExecuteExt[2*i] + 1;
     int wholeSize = inWholeExt[2*i + 1] - inWholeExt[2*i] + 1;
     if (flip[i])
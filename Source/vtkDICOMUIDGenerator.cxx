@@ -15,21 +15,163 @@
 
 #include "vtkDICOMFile.h"
 #include "vtkDICOMUtilities.h"
+#include "vtkDICOMReferenceCount.h"
 
 #include "vtkObjectFactory.h"
 #include "vtkStringArray.h"
+#include "vtkMutexLock.h"
 
 #include <string.h>
 
+#include <string>
+#include <vector>
+#include <algorithm>
+
 // needed for random number generation and time
 #ifdef _WIN32
 #include <windows.h>
 #include <wincrypt.h>
+#else
+#include <sys/types.h>
+#include <unistd.h>
+#include <errno.h>
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 #endif
 
 vtkStandardNewMacro(vtkDICOMUIDGenerator);
 vtkDICOMUIDGenerator *vtkDICOMUIDGenerator::Default;
 
+// Generators that were replaced by SetDefault() are kept until exit,
+// since other threads might still be using them.
+static vtkSimpleMutexLock *vtkDICOMUIDGeneratorDefaultLock;
+static std::vector<vtkDICOMUIDGenerator *> *vtkDICOMUIDGeneratorRetired;
+
+//----------------------------------------------------------------------------
+namespace {
+
+// read random bytes from the operating system, cryptographic quality
+// random numbers are needed to ensure uniqueness of the generated uids
+bool vtkReadSystemRandomBytes(unsigned char *bytes, size_t n)
+{
+  int r = 0;
+#ifdef _WIN32
+  // use the Windows cryptography interface (WinXP and later)
+  HCRYPTPROV hProv;
+  r = CryptAcquireContext(&hProv, NULL, NULL, PROV_RSA_FULL,
+                          CRYPT_SILENT | CRYPT_VERIFYCONTEXT);
+  if (r == 0 && GetLastError() == NTE_BAD_KEYSET)
+  {
+    r = CryptAcquireContext(&hProv, NULL, NULL, PROV_RSA_FULL,
+                            CRYPT_SILENT | CRYPT_NEWKEYSET);
+  }
+  if (r != 0)
+  {
+    r = CryptGenRandom(hProv, static_cast<DWORD>(n),
+                       reinterpret_cast<BYTE *>(bytes));
+    CryptReleaseContext(hProv, 0);
+  }
+#else
+#if defined(__linux__) && defined(SYS_getrandom)
+  // getrandom() (Linux 3.17 and later) does not need a file descriptor
+  size_t m = 0;
+  while (m < n)
+  {
+    long k = syscall(SYS_getrandom, bytes + m, n - m, 0);
+    if (k < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      break;
+    }
+    m += static_cast<size_t>(k);
+  }
+  r = (m == n);
+  if (r == 0)
+#endif
+  {
+    vtkDICOMFile infile("/dev/urandom", vtkDICOMFile::In);
+    if (infile.GetError() == 0)
+    {
+      size_t m = infile.Read(bytes, n);
+      r = (m == n);
+      infile.Close();
+    }
+  }
+#endif
+  return (r != 0);
+}
+
+// A pool of random bytes that is refilled in large chunks, so that the
+// operating system is not asked for random bytes for every uid.
+class vtkDICOMEntropyPool
+{
+public:
+  vtkDICOMEntropyPool() : Position(PoolSize), ProcessId(0) {}
+  ~vtkDICOMEntropyPool() { memset(this->Pool, '\0', PoolSize); }
+
+  // Get n random bytes, returns false if the system failed to provide them.
+  bool Read(unsigned char *bytes, size_t n);
+
+private:
+  enum { PoolSize = 4096 };
+
+  vtkSimpleMutexLock Lock;
+  unsigned char Pool[PoolSize];
+  size_t Position;
+  long ProcessId;
+};
+
+bool vtkDICOMEntropyPool::Read(unsigned char *bytes, size_t n)
+{
+  if (n > PoolSize/4)
+  {
+    // large requests go directly to the system
+    return vtkReadSystemRandomBytes(bytes, n);
+  }
+
+  bool success = true;
+  this->Lock.Lock();
+#ifndef _WIN32
+  // after fork(), the pool is a copy of the parent's pool, so it must
+  // be discarded or the child would generate the same uids as the parent
+  long pid = static_cast<long>(getpid());
+  if (pid != this->ProcessId)
+  {
+    this->ProcessId = pid;
+    this->Position = PoolSize;
+  }
+#endif
+  if (PoolSize - this->Position < n)
+  {
+    this->Position = 0;
+    success = vtkReadSystemRandomBytes(this->Pool, PoolSize);
+    if (!success)
+    {
+      this->Position = PoolSize;
+    }
+  }
+  if (success)
+  {
+    // bytes are erased once used, so that they are never used twice
+    unsigned char *cp = this->Pool + this->Position;
+    memcpy(bytes, cp, n);
+    memset(cp, '\0', n);
+    this->Position += n;
+  }
+  this->Lock.Unlock();
+
+  return success;
+}
+
+// the pool that is shared by all uid generators
+vtkDICOMEntropyPool *vtkDICOMUIDGeneratorEntropyPool;
+
+} // end anonymous namespace
+
 //----------------------------------------------------------------------------
 // A helper class to delete static variables when program exits.
 static unsigned int vtkDICOMUIDGeneratorInitializerCounter;
@@ -39,6 +181,9 @@ vtkDICOMUIDGeneratorInitializer::vtkDICOMUIDGeneratorInitializer()
 {
   if (vtkDICOMUIDGeneratorInitializerCounter++ == 0)
   {
+    vtkDICOMUIDGeneratorEntropyPool = new vtkDICOMEntropyPool;
+    vtkDICOMUIDGeneratorDefaultLock = new vtkSimpleMutexLock;
+    vtkDICOMUIDGeneratorRetired = new std::vector<vtkDICOMUIDGenerator *>;
     vtkDICOMUIDGenerator::Default = vtkDICOMUIDGenerator::New();
   }
 }
@@ -51,7 +196,16 @@ vtkDICOMUIDGeneratorInitializer::~vtkDICOMUIDGeneratorInitializer()
     if (vtkDICOMUIDGenerator::Default)
     {
       vtkDICOMUIDGenerator::Default->Delete();
+      vtkDICOMUIDGenerator::Default = 0;
     }
+    for (size_t i = 0; i < vtkDICOMUIDGeneratorRetired->size(); i++)
+    {
+      (*vtkDICOMUIDGeneratorRetired)[i]->Delete();
+    }
+    delete vtkDICOMUIDGeneratorRetired;
+    delete vtkDICOMUIDGeneratorDefaultLock;
+    delete vtkDICOMUIDGeneratorEntropyPool;
+    vtkDICOMUIDGeneratorEntropyPool = 0;
   }
 }
 
@@ -272,36 +426,11 @@ void vtkConvertUUIDToUID(const char *uuid, char *uid)
   vtkConvertHexToDecimal(uuid, uid + 5);
 }
 
-// read from the random number generator, cryptographic quality random
-// numbers are needed to ensure uniqueness of the generated uids
+// get random bytes from the shared pool
 void vtkGenerateRandomBytes(unsigned char *bytes, vtkIdType n)
 {
-  int r = 0;
-#ifdef _WIN32
-  // use the Windows cryptography interface (WinXP and later)
-  HCRYPTPROV hProv;
-  r = CryptAcquireContext(&hProv, NULL, NULL, PROV_RSA_FULL,
-                          CRYPT_SILENT | CRYPT_VERIFYCONTEXT);
-  if (r == 0 && GetLastError() == NTE_BAD_KEYSET)
-  {
-    r = CryptAcquireContext(&hProv, NULL, NULL, PROV_RSA_FULL,
-                            CRYPT_SILENT | CRYPT_NEWKEYSET);
-  }
-  if (r != 0)
-  {
-    r = CryptGenRandom(hProv, n, reinterpret_cast<BYTE *>(bytes));
-    CryptReleaseContext(hProv, 0);
-  }
-#else
-  vtkDICOMFile infile("/dev/urandom", vtkDICOMFile::In);
-  if (infile.GetError() == 0)
-  {
-    size_t m = infile.Read(bytes, n);
-    r = (m == static_cast<size_t>(n));
-    infile.Close();
-  }
-#endif
-  if (r == 0)
+  if (!vtkDICOMUIDGeneratorEntropyPool->Read(
+        bytes, static_cast<size_t>(n)))
   {
     memset(bytes, '\0', n);
     vtkGenericWarningMacro(
@@ -310,6 +439,12 @@ void vtkGenerateRandomBytes(unsigned char *bytes, vtkIdType n)
   }
 }
 
+// compare uids for sorting
+bool vtkCompareUIDs(const std::string& u1, const std::string& u2)
+{
+  return (vtkDICOMUtilities::CompareUIDs(u1.c_str(), u2.c_str()) < 0);
+}
+
 // generate a single-digit numerical prefix for UIDs that identifies the
 // purpose of the uid (this is just for convenience in recognizing the
 // uid types, it is not suggested by the DICOM standard) 
@@ -474,6 +609,7 @@ void vtkDICOMUIDGenerator::GenerateUIDs(vtkDICOMTag tag, vtkStringArray *uids)
   unsigned char *r = new unsigned char[n*m];
   vtkGenerateRandomBytes(r, n*m);
 
+  std::vector<std::string> sorted(n);
   for (vtkIdType i = 0; i < n; i++)
   {
     char uid[64];
@@ -489,33 +625,29 @@ void vtkDICOMUIDGenerator::GenerateUIDs(vtkDICOMTag tag, vtkStringArray *uids)
       vtkGeneratePrefixedUID(r + i*m, m, prefix, d, uid);
     }
 
-    // put uids into the array in order (simple insertion sort)
-    vtkIdType j = 0;
-    for (; j < i; j++)
-    {
-      if (vtkDICOMUtilities::CompareUIDs(uids->GetValue(j), uid) > 0)
-      {
-        break;
-      }
-    }
-    for (vtkIdType k = i; k > j; --k)
-    {
-      uids->SetValue(k, uids->GetValue(k - 1));
-    }
-    uids->SetValue(j, uid);
+    sorted[i] = uid;
   }
 
+  memset(r, '\0', n*m);
   delete [] r;
+
+  // put uids into the array in order
+  std::sort(sorted.begin(), sorted.end(), vtkCompareUIDs);
+  for (vtkIdType i = 0; i < n; i++)
+  {
+    uids->SetValue(i, sorted[i]);
+  }
 }
 
 //----------------------------------------------------------------------------
 void vtkDICOMUIDGenerator::SetDefault(vtkDICOMUIDGenerator *uidgen)
 {
+  vtkDICOMUIDGeneratorDefaultLock->Lock();
   if (uidgen != vtkDICOMUIDGenerator::Default)
   {
     if (vtkDICOMUIDGenerator::Default)
     {
-      vtkDICOMUIDGenerator::Default->Delete();
+      vtkDICOMUIDGeneratorRetired->push_back(vtkDICOMUIDGenerator::Default);
     }
     if (uidgen)
     {
@@ -525,6 +657,9 @@ void vtkDICOMUIDGenerator::SetDefault(vtkDICOMUIDGenerator *uidgen)
     {
       uidgen = vtkDICOMUIDGenerator::New();
     }
+    // the generator must be complete before other threads can see it
+    vtkDICOMReferenceCount::Fence();
     vtkDICOMUIDGenerator::Default = uidgen;
   }
+  vtkDICOMUIDGeneratorDefaultLock->Unlock();
 }
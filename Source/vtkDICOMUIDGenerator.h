@@ -30,7 +30,8 @@ class vtkStringArray;
  *  random number.  Other prefixes (which can only be used by a designated
  *  organization) are followed by a 128-bit random number if the prefix is
  *  shorter than 24 chars, or a 96-bit random number if the prefix is 24
- *  chars or longer.
+ *  chars or longer.  The random numbers are taken from a thread-safe pool
+ *  that is refilled from the operating system in large chunks.
  */
 class VTKDICOM_EXPORT vtkDICOMUIDGenerator : public vtkObject
 {
@@ -89,6 +90,9 @@ public:
   //! Set the default UID generator.
   /*!
    *  This can be used to set an application-wide UID generator.
+   *  The previous default generator is kept alive until the program
+   *  exits, so that it remains usable by any threads that are still
+   *  using it.
    */
   static void SetDefault(vtkDICOMUIDGenerator *uidgen);
 
@@ -19,8 +19,12 @@
 #include "vtkDICOMUIDGenerator.h"
 #include "vtkDICOMFile.h"
 #include "vtkDICOMConfig.h"
+#include "vtkDICOMReferenceCount.h"
+
+#include "vtkMutexLock.h"
 
 #include <string>
+#include <vector>
 
 #include <stdio.h>
 #include <string.h>
@@ -388,6 +392,18 @@ bool vtkDICOMUtilities::IsDICOMFile(const char *filename)
     return false;
   }
 
+  return vtkDICOMUtilities::IsDICOMFile(buffer, size);
+}
+
+//----------------------------------------------------------------------------
+bool vtkDICOMUtilities::IsDICOMFile(const unsigned char *buffer, size_t size)
+{
+  // the checks below need at least 256 bytes
+  if (buffer == 0 || size < 256)
+  {
+    return false;
+  }
+
   const unsigned char *cp = buffer;
 
   // Look for the magic number and the first meta header tag.
@@ -407,12 +423,6 @@ bool vtkDICOMUtilities::IsDICOMFile(const char *filename)
     skip = 0;
   }
 
-  // File must be a reasonable size.
-  if (size < 256)
-  {
-    return false;
-  }
-
   cp = buffer;
 
   // If no magic number found, look for a valid meta header.
@@ -443,8 +453,89 @@ bool vtkDICOMUtilities::IsDICOMFile(const char *filename)
 }
 
 //----------------------------------------------------------------------------
-char vtkDICOMUtilities::UIDPrefix[64] = "2.25.";
+#define VTK_DICOM_VERSION_CREATOR2(name, x, y, z) \
+  name "_" #x "_" #y "_" #z
+#define VTK_DICOM_VERSION_CREATOR(name, x, y, z) \
+  VTK_DICOM_VERSION_CREATOR2(name, x, y, z)
+
+// The default values of the global strings.
+static const char vtkDICOMUtilitiesDefaultUIDPrefix[] = "2.25.";
+static const char vtkDICOMUtilitiesDefaultImplementationClassUID[] =
+  "2.25.190146791043182537444806132342625375407";
+static const char vtkDICOMUtilitiesDefaultImplementationVersionName[] =
+  VTK_DICOM_VERSION_CREATOR("VTK_DICOM",
+    DICOM_MAJOR_VERSION, DICOM_MINOR_VERSION, DICOM_PATCH_VERSION);
+
+const char *vtkDICOMUtilities::UIDPrefix =
+  vtkDICOMUtilitiesDefaultUIDPrefix;
+const char *vtkDICOMUtilities::ImplementationClassUID =
+  vtkDICOMUtilitiesDefaultImplementationClassUID;
+const char *vtkDICOMUtilities::ImplementationVersionName =
+  vtkDICOMUtilitiesDefaultImplementationVersionName;
+
+// The global strings are never modified once they have been set, instead
+// a new string is stored, so that the strings can be read without a lock.
+// The old strings are kept until the program exits, since other threads
+// might still be reading them.
+static vtkSimpleMutexLock *vtkDICOMUtilitiesLock;
+static std::vector<char *> *vtkDICOMUtilitiesStrings;
+
+//----------------------------------------------------------------------------
+// A helper class to delete static variables when program exits.
+static unsigned int vtkDICOMUtilitiesInitializerCounter;
+
+// Perform initialization of static variables.
+vtkDICOMUtilitiesInitializer::vtkDICOMUtilitiesInitializer()
+{
+  if (vtkDICOMUtilitiesInitializerCounter++ == 0)
+  {
+    vtkDICOMUtilitiesLock = new vtkSimpleMutexLock;
+    vtkDICOMUtilitiesStrings = new std::vector<char *>;
+  }
+}
+
+// Perform cleanup of static variables.
+vtkDICOMUtilitiesInitializer::~vtkDICOMUtilitiesInitializer()
+{
+  if (--vtkDICOMUtilitiesInitializerCounter == 0)
+  {
+    vtkDICOMUtilities::UIDPrefix =
+      vtkDICOMUtilitiesDefaultUIDPrefix;
+    vtkDICOMUtilities::ImplementationClassUID =
+      vtkDICOMUtilitiesDefaultImplementationClassUID;
+    vtkDICOMUtilities::ImplementationVersionName =
+      vtkDICOMUtilitiesDefaultImplementationVersionName;
+    for (size_t i = 0; i < vtkDICOMUtilitiesStrings->size(); i++)
+    {
+      delete [] (*vtkDICOMUtilitiesStrings)[i];
+    }
+    delete vtkDICOMUtilitiesStrings;
+    delete vtkDICOMUtilitiesLock;
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkDICOMUtilities::ReplaceString(
+  const char **target, const char *s, size_t maxlen)
+{
+  size_t l = 0;
+  while (l < maxlen && s[l] != '\0')
+  {
+    l++;
+  }
+  char *cp = new char[l + 1];
+  strncpy(cp, s, l);
+  cp[l] = '\0';
+
+  vtkDICOMUtilitiesLock->Lock();
+  vtkDICOMUtilitiesStrings->push_back(cp);
+  // the string must be complete before other threads can see it
+  vtkDICOMReferenceCount::Fence();
+  *target = cp;
+  vtkDICOMUtilitiesLock->Unlock();
+}
 
+//----------------------------------------------------------------------------
 const char *vtkDICOMUtilities::GetUIDPrefix()
 {
   return vtkDICOMUtilities::UIDPrefix;
@@ -453,14 +544,10 @@ const char *vtkDICOMUtilities::GetUIDPrefix()
 //----------------------------------------------------------------------------
 void vtkDICOMUtilities::SetUIDPrefix(const char *uid)
 {
-  strncpy(vtkDICOMUtilities::UIDPrefix, uid, 63);
-  vtkDICOMUtilities::UIDPrefix[63] = '\0';
+  vtkDICOMUtilities::ReplaceString(&vtkDICOMUtilities::UIDPrefix, uid, 63);
 }
 
 //----------------------------------------------------------------------------
-char vtkDICOMUtilities::ImplementationClassUID[65] =
-  "2.25.190146791043182537444806132342625375407";
-
 const char *vtkDICOMUtilities::GetImplementationClassUID()
 {
   return vtkDICOMUtilities::ImplementationClassUID;
@@ -469,20 +556,11 @@ const char *vtkDICOMUtilities::GetImplementationClassUID()
 //----------------------------------------------------------------------------
 void vtkDICOMUtilities::SetImplementationClassUID(const char *uid)
 {
-  strncpy(vtkDICOMUtilities::ImplementationClassUID, uid, 64);
-  vtkDICOMUtilities::ImplementationClassUID[64] = '\0';
+  vtkDICOMUtilities::ReplaceString(
+    &vtkDICOMUtilities::ImplementationClassUID, uid, 64);
 }
 
 //----------------------------------------------------------------------------
-#define VTK_DICOM_VERSION_CREATOR2(name, x, y, z) \
-  name "_" #x "_" #y "_" #z
-#define VTK_DICOM_VERSION_CREATOR(name, x, y, z) \
-  VTK_DICOM_VERSION_CREATOR2(name, x, y, z)
-
-char vtkDICOMUtilities::ImplementationVersionName[17] =
-  VTK_DICOM_VERSION_CREATOR("VTK_DICOM",
-    DICOM_MAJOR_VERSION, DICOM_MINOR_VERSION, DICOM_PATCH_VERSION);
-
 const char *vtkDICOMUtilities::GetImplementationVersionName()
 {
   return vtkDICOMUtilities::ImplementationVersionName;
@@ -491,8 +569,8 @@ const char *vtkDICOMUtilities::GetImplementationVersionName()
 //----------------------------------------------------------------------------
 void vtkDICOMUtilities::SetImplementationVersionName(const char *name)
 {
-  strncpy(vtkDICOMUtilities::ImplementationVersionName, name, 16);
-  vtkDICOMUtilities::ImplementationVersionName[16] = '\0';
+  vtkDICOMUtilities::ReplaceString(
+    &vtkDICOMUtilities::ImplementationVersionName, name, 16);
 }
 
 //----------------------------------------------------------------------------
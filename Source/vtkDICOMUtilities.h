@@ -119,6 +119,15 @@ public:
    *  the file look like DICOM data elements.
    */
   static bool IsDICOMFile(const char *filename);
+
+  //! Check if the data from the beginning of a file looks like DICOM.
+  /*!
+   *  This performs the same check as IsDICOMFile(), but on data that
+   *  has already been read from the file, so that a file can be checked
+   *  and parsed without opening it twice.  At least 256 bytes (or the
+   *  whole file, if smaller) must be provided.
+   */
+  static bool IsDICOMFile(const unsigned char *data, size_t size);
   //@}
 
   //@{
@@ -129,6 +138,7 @@ public:
   /*!
    *  The supplied UID will be copied into a static storage area,
    *  and used for all future calls to GetImplementationClassUID.
+   *  A string returned by a previous call will remain valid.
    *  The ImplementationClassUID appears in the DICOM meta header.
    */
   static void SetImplementationClassUID(const char *uid);
@@ -140,6 +150,7 @@ public:
   /*!
    *  The supplied name will be copied into a static storage area,
    *  and used for all future calls to GetImplementationVersionName.
+   *  A string returned by a previous call will remain valid.
    *  The ImplementationVersionName appears in the DICOM meta header.
    */
   static void SetImplementationVersionName(const char *name);
@@ -194,11 +205,16 @@ protected:
 
   static long long GetLocalOffset(long long t);
 
-  static char UIDPrefix[64];
-  static char ImplementationClassUID[65];
-  static char ImplementationVersionName[17];
+  //! Store a copy of a string, and set the target to point to it.
+  static void ReplaceString(const char **target, const char *s, size_t l);
+
+  static const char *UIDPrefix;
+  static const char *ImplementationClassUID;
+  static const char *ImplementationVersionName;
 
 private:
+  friend class vtkDICOMUtilitiesInitializer;
+
 #ifdef VTK_DELETE_FUNCTION
   vtkDICOMUtilities(const vtkDICOMUtilities&) VTK_DELETE_FUNCTION;
   void operator=(const vtkDICOMUtilities&) VTK_DELETE_FUNCTION;
@@ -208,4 +224,31 @@ private:
 #endif
 };
 
+//! @cond
+//! Initializer (Schwarz counter).
+/*!
+ *  This ensures that the vtkDICOMUtilities module is initialized before
+ *  any other module that includes this header file.
+ */
+class VTKDICOM_EXPORT vtkDICOMUtilitiesInitializer
+{
+public:
+  vtkDICOMUtilitiesInitializer();
+  ~vtkDICOMUtilitiesInitializer();
+private:
+#ifdef VTK_DELETE_FUNCTION
+  vtkDICOMUtilitiesInitializer(
+    const vtkDICOMUtilitiesInitializer&) VTK_DELETE_FUNCTION;
+  vtkDICOMUtilitiesInitializer& operator=(
+    const vtkDICOMUtilitiesInitializer&) VTK_DELETE_FUNCTION;
+#else
+  vtkDICOMUtilitiesInitializer(const vtkDICOMUtilitiesInitializer&);
+  vtkDICOMUtilitiesInitializer& operator=(
+    const vtkDICOMUtilitiesInitializer&);
+#endif
+};
+
+static vtkDICOMUtilitiesInitializer vtkDICOMUtilitiesInitializerInstance;
+//! @endcond
+
 #endif /* vtkDICOMUtilities_h */
@@ -73,43 +73,160 @@ public:
   void adjust(int n) { pbump(n); }
 };
 
+// Check for decimal digits, plain ASCII (don't use locale)
+bool IsDigit(char c)
+{
+  return (c >= '0' && c <= '9');
+}
+
+// Check for the whitespace that is skipped by the "C" locale
+bool IsSpace(char c)
+{
+  return (c == ' ' || (c >= '\t' && c <= '\r'));
+}
+
+// Find the end of a backslash-separated value
+const char *EndOfValue(const char *cp)
+{
+  while (*cp != '\\' && *cp != '\0') { cp++; }
+  return cp;
+}
+
+// Powers of ten that can be exactly represented as doubles
+const double PowersOfTen[23] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Decode a number with a stream that uses the "C" locale, this is
+// slow but it is correct for all numbers that the stream can read.
+template<class T>
+T StreamDecode(const char *cp, const char *ep)
+{
+  InputString sb(cp, ep - cp);
+  std::istream sbs(&sb);
+  sbs.imbue(std::locale::classic());
+  T d = 0;
+  sbs >> d;
+  return d;
+}
+
+// Decode one value from a decimal string (DS).  Most values have
+// fewer than 16 significant digits and a small exponent, and these
+// are converted with a single multiplication or division, which is
+// exactly rounded since both operands are exactly representable.
+double DecodeDS(const char *cp)
+{
+  const char *start = cp;
+  while (IsSpace(*cp)) { cp++; }
+  bool negative = (*cp == '-');
+  cp += (*cp == '-' || *cp == '+');
+
+  double m = 0.0;
+  int digits = 0; // significant digits
+  int count = 0; // all digits
+  int e = 0;
+  for (; IsDigit(*cp); cp++)
+  {
+    m = 10.0*m + (*cp - '0');
+    digits += (m != 0.0);
+    count++;
+  }
+  if (*cp == '.')
+  {
+    for (cp++; IsDigit(*cp); cp++)
+    {
+      m = 10.0*m + (*cp - '0');
+      digits += (m != 0.0);
+      count++;
+      e--;
+    }
+  }
+  if (count == 0)
+  {
+    return 0.0;
+  }
+
+  bool slow = (digits > 15);
+  if (*cp == 'e' || *cp == 'E')
+  {
+    cp++;
+    bool eneg = (*cp == '-');
+    cp += (*cp == '-' || *cp == '+');
+    slow |= !IsDigit(*cp);
+    int x = 0;
+    for (; IsDigit(*cp); cp++)
+    {
+      x = (x < 10000 ? 10*x + (*cp - '0') : x);
+    }
+    e += (eneg ? -x : x);
+  }
+
+  if (m == 0.0)
+  {
+    // zero, whatever the exponent (which might be out of range)
+    return (negative ? -0.0 : 0.0);
+  }
+  if (slow || e < -22 || e > 22)
+  {
+    return StreamDecode<double>(start, EndOfValue(cp));
+  }
+
+  m = (e < 0 ? m/PowersOfTen[-e] : m*PowersOfTen[e]);
+  return (negative ? -m : m);
+}
+
+// Decode one value from an integer string (IS).
+int DecodeIS(const char *cp)
+{
+  const char *start = cp;
+  while (IsSpace(*cp)) { cp++; }
+  bool negative = (*cp == '-');
+  cp += (*cp == '-' || *cp == '+');
+  while (*cp == '0' && IsDigit(cp[1])) { cp++; }
+
+  int i = 0;
+  int count = 0;
+  for (; IsDigit(*cp); cp++)
+  {
+    i = 10*i + (*cp - '0');
+    if (++count > 9)
+    {
+      // might overflow, so let the stream check the range
+      return StreamDecode<int>(start, EndOfValue(cp));
+    }
+  }
+  return (negative ? -i : i);
+}
+
 // The input is a list of one or more numerical string values separated
 // by backslashes, for example "1.23435\85234.0\2345.22".  Convert "n"
 // values to type OT, starting at the "i"th backslash-separated value.
+// Values that are missing or that are not numbers are set to zero.
 template<class OT>
 void StringConversion(
   const char *cp, vtkDICOMVR vr, OT *v, size_t i, size_t n)
 {
   if (vr == vtkDICOMVR::IS || vr == vtkDICOMVR::DS)
   {
-    // create a stream for conversion with "C" locale
-    InputString sb(cp, strlen(cp));
-    std::istream sbs(&sb);
-    sbs.imbue(std::locale::classic());
-
-    for (size_t j = 0; j < i && !sbs.eof(); j++)
+    for (size_t j = 0; j < i && *cp != '\0'; j++)
     {
-      sbs.ignore(std::numeric_limits<std::streamsize>::max(), '\\');
+      cp = EndOfValue(cp);
+      cp += (*cp == '\\');
     }
 
-    for (size_t k = 0; k < n && !sbs.eof(); k++)
+    for (size_t k = 0; k < n; k++)
     {
       if (vr == vtkDICOMVR::DS)
       {
-        double d = 0.0;
-        sbs >> d;
-        *v++ = static_cast<OT>(d);
+        *v++ = static_cast<OT>(DecodeDS(cp));
       }
       else
       {
-        int d = 0;
-        sbs >> d;
-        *v++ = static_cast<OT>(d);
-      }
-      if (k + 1 < n)
-      {
-        sbs.ignore(std::numeric_limits<std::streamsize>::max(), '\\');
+        *v++ = static_cast<OT>(DecodeIS(cp));
       }
+      cp = EndOfValue(cp);
+      cp += (*cp == '\\');
     }
   }
   else if (n > 0)
@@ -179,6 +296,18 @@ void ValueFree(void *vp)
   free(vp);
 }
 
+// Check whether values with this VR keep their decoded numbers
+bool HasDecodedNumbers(vtkDICOMVR vr)
+{
+  return (vr == vtkDICOMVR::DS || vr == vtkDICOMVR::IS);
+}
+
+// Get the slot that holds the decoded numbers
+void **DecodedNumbersSlot(const void *vp)
+{
+  return static_cast<void **>(const_cast<void *>(vp)) - 1;
+}
+
 } // end anonymous namespace
 
 #ifdef VTK_DICOM_USE_OVERFLOW_BYTE
@@ -336,9 +465,17 @@ char *vtkDICOMValue::Allocate<char>(vtkDICOMVR vr, size_t vn)
   // give an even number of chars.  All strings (including UI) need one
   // extra char for the null terminator to make them valid C strings.
   size_t pad = (vn & static_cast<size_t>(vr != vtkDICOMVR::UI));
+  // Numerical strings have a slot before the Value struct, to hold
+  // the numbers after they have been decoded.
+  size_t slot = (HasDecodedNumbers(vr) ? sizeof(void *) : 0);
   // Use C++ "placement new" to allocate a single block of memory that
   // includes both the Value struct and the array of values.
-  void *vp = ValueMalloc(sizeof(Value) + vn + pad + 1);
+  void *vp = ValueMalloc(slot + sizeof(Value) + vn + pad + 1);
+  if (slot)
+  {
+    *static_cast<void **>(vp) = 0;
+    vp = static_cast<char *>(vp) + slot;
+  }
   ValueT<char> *v = new(vp) ValueT<char>(vr, vn);
   // Test the assumption that Data is at an offset of sizeof(Value)
   assert(v->Data == static_cast<char *>(vp) + sizeof(Value));
@@ -447,6 +584,14 @@ void vtkDICOMValue::ComputeNumberOfValuesForCharData()
       }
       this->V->NumberOfValues = n;
     }
+
+    // discard any numbers that were decoded from the old contents
+    if (HasDecodedNumbers(this->V->VR))
+    {
+      void **slot = DecodedNumbersSlot(this->V);
+      ValueFree(*slot);
+      *slot = 0;
+    }
   }
 }
 
@@ -1120,6 +1265,14 @@ void vtkDICOMValue::FreeValue(Value *v)
         dp++;
       }
     }
+    else if (v->Type == VTK_CHAR && HasDecodedNumbers(v->VR))
+    {
+      // free the decoded numbers, and the slot that precedes the value
+      void **slot = DecodedNumbersSlot(v);
+      ValueFree(*slot);
+      ValueFree(slot);
+      return;
+    }
 
     ValueFree(v);
   }
@@ -1375,6 +1528,38 @@ vtkDICOMValue *vtkDICOMValue::GetMultiplex()
   return ptr;
 }
 
+//----------------------------------------------------------------------------
+const void *vtkDICOMValue::GetDecodedNumbers() const
+{
+  void **slot = DecodedNumbersSlot(this->V);
+  void *vp = *slot;
+  if (vp == 0)
+  {
+    const char *cp = static_cast<const ValueT<char> *>(this->V)->Data;
+    size_t n = this->V->NumberOfValues;
+    if (this->V->VR == vtkDICOMVR::DS)
+    {
+      double *dp =
+        static_cast<double *>(ValueMalloc((n + !n)*sizeof(double)));
+      StringConversion(cp, vtkDICOMVR::DS, dp, 0, n);
+      vp = dp;
+    }
+    else
+    {
+      int *ip = static_cast<int *>(ValueMalloc((n + !n)*sizeof(int)));
+      StringConversion(cp, vtkDICOMVR::IS, ip, 0, n);
+      vp = ip;
+    }
+    // another thread might have decoded the numbers at the same time
+    if (!vtkDICOMReferenceCount::CompareAndSwap(slot, 0, vp))
+    {
+      ValueFree(vp);
+      vp = *slot;
+    }
+  }
+  return vp;
+}
+
 //----------------------------------------------------------------------------
 template<class VT>
 void vtkDICOMValue::GetValuesT(VT *v, size_t c, size_t s) const
@@ -1382,9 +1567,33 @@ void vtkDICOMValue::GetValuesT(VT *v, size_t c, size_t s) const
   switch (this->V->Type)
   {
     case VTK_CHAR:
-      StringConversion(
-        static_cast<const ValueT<char> *>(this->V)->Data, this->V->VR,
-        v, s, c);
+      if (this->V->VR == vtkDICOMVR::DS || this->V->VR == vtkDICOMVR::IS)
+      {
+        // only "n" numbers were decoded, values past the end are zero
+        size_t n = this->V->NumberOfValues;
+        n = (s < n ? n - s : 0);
+        n = (c < n ? c : n);
+        if (n > 0 && this->V->VR == vtkDICOMVR::DS)
+        {
+          NumericalConversion(
+            static_cast<const double *>(this->GetDecodedNumbers())+s, v, n);
+        }
+        else if (n > 0)
+        {
+          NumericalConversion(
+            static_cast<const int *>(this->GetDecodedNumbers())+s, v, n);
+        }
+        for (size_t i = n; i < c; i++)
+        {
+          v[i] = 0;
+        }
+      }
+      else
+      {
+        StringConversion(
+          static_cast<const ValueT<char> *>(this->V)->Data, this->V->VR,
+          v, s, c);
+      }
       break;
     case VTK_UNSIGNED_CHAR:
       NumericalConversion(
@@ -1724,7 +1933,14 @@ std::string vtkDICOMValue::AsUTF8String() const
         while (n > 0 && *cp == ' ') { cp++; n--; }
         size_t m = n;
         while (m > 0 && cp[m-1] == ' ') { m--; }
-        s.append(cs.ToUTF8(cp, m));
+        if (cs.IsPlainASCII(cp, m))
+        {
+          s.append(cp, m);
+        }
+        else
+        {
+          s.append(cs.ToUTF8(cp, m));
+        }
         cp += n;
         if (cp != ep && *cp == '\\')
         {
@@ -1909,7 +2125,15 @@ void vtkDICOMValue::AppendValueToUTF8String(
       l = dp - cp;
     }
     vtkDICOMCharacterSet cs(this->V->CharacterSet);
-    str += cs.ToUTF8(cp, l);
+    if (cs.IsPlainASCII(cp, l))
+    {
+      // no conversion needed, avoid making a temporary string
+      str.append(cp, l);
+    }
+    else
+    {
+      str += cs.ToUTF8(cp, l);
+    }
   }
   else
   {
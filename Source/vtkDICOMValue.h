@@ -437,6 +437,14 @@ private:
   template<class OT>
   void GetValuesT(OT *v, size_t count, size_t s) const;
 
+  //! Get the numbers for a DS or IS value, decoding them if needed.
+  /*!
+   *  The numbers are decoded from the string the first time that they
+   *  are requested, and are then kept until the value is freed.  They
+   *  are stored as doubles for DS, and as ints for IS.
+   */
+  const void *GetDecodedNumbers() const;
+
   //! Internal templated value creation method.
   template<class T>
   void CreateValue(vtkDICOMVR vr, const T *data, size_t count);
@@ -519,6 +527,9 @@ private:
   // friend the sequence class, it requires AppendValue() and SetValue().
   friend class vtkDICOMSequence;
 
+  // friend the query matcher, it uses the pattern matching methods.
+  friend class vtkDICOMQueryMatcher;
+
   // friend the meta data class, it requires GetMultiplex().
   friend class vtkDICOMValueFriendMetaData;
 };
@@ -18,6 +18,7 @@
 #include "vtkNIFTIReader.h"
 #include "vtkImageData.h"
 #include "vtkPointData.h"
+#include "vtkDataArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
@@ -58,11 +59,17 @@
 #define gzopen gzopen_w
 #define fopen _wfopen
 #define NIFTI_FILE_MODE L"wb"
+#define NIFTI_FILE_UPDATE_MODE L"r+b"
+#define NIFTI_FILE_READ_MODE L"rb"
 #else
 #define NIFTI_FILE_MODE "wb"
+#define NIFTI_FILE_UPDATE_MODE "r+b"
+#define NIFTI_FILE_READ_MODE "rb"
 #endif
 #else
 #define NIFTI_FILE_MODE "wb"
+#define NIFTI_FILE_UPDATE_MODE "r+b"
+#define NIFTI_FILE_READ_MODE "rb"
 #endif
 
 vtkStandardNewMacro(vtkNIFTIWriter);
@@ -90,6 +97,8 @@ vtkNIFTIWriter::vtkNIFTIWriter()
   // Planar RGB (NIFTI doesn't allow this, it's here for Analyze)
   this->PlanarRGB = false;
   this->DataByteOrder = LittleEndian;
+  this->Streaming = 0;
+  this->MemoryLimit = 262144;
 }
 
 //----------------------------------------------------------------------------
@@ -175,6 +184,8 @@ void vtkNIFTIWriter::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "DataByteOrder: "
      << ((this->DataByteOrder == BigEndian) ?
          "BigEndian\n" : "LittleEndian\n");
+  os << indent << "Streaming: " << (this->Streaming ? "On\n" : "Off\n");
+  os << indent << "MemoryLimit: " << this->MemoryLimit << "\n";
 }
 
 //----------------------------------------------------------------------------
@@ -599,6 +610,39 @@ int vtkNIFTIWriter::GenerateHeader(vtkInformation *info, bool singleFile)
   return 1;
 }
 
+//----------------------------------------------------------------------------
+namespace {
+
+// Seek to a 64-bit offset within a file that is being written.
+bool vtkNIFTIWriterSeek(FILE *file, vtkTypeInt64 offset)
+{
+#if defined(_WIN32)
+  return (_fseeki64(file, offset, SEEK_SET) == 0);
+#elif defined(__unix__) || defined(__APPLE__)
+  return (fseeko(file, static_cast<off_t>(offset), SEEK_SET) == 0);
+#else
+  return (fseek(file, static_cast<long>(offset), SEEK_SET) == 0);
+#endif
+}
+
+// Copy an uncompressed file into a compressed file.
+bool vtkNIFTIWriterCompress(FILE *infile, gzFile outfile)
+{
+  const size_t bufsize = 65536;
+  char *buffer = new char[bufsize];
+  bool success = true;
+  size_t n;
+  while (success && (n = fread(buffer, 1, bufsize, infile)) != 0)
+  {
+    int code = gzwrite(outfile, buffer, static_cast<unsigned int>(n));
+    success = (code > 0 && static_cast<size_t>(code) == n);
+  }
+  delete [] buffer;
+  return (success && !ferror(infile));
+}
+
+} // end anonymous namespace
+
 //----------------------------------------------------------------------------
 int vtkNIFTIWriter::RequestData(
   vtkInformation* vtkNotUsed(request),
@@ -643,6 +687,24 @@ int vtkNIFTIWriter::RequestData(
     return 0;
   }
 
+  // when streaming, only a slab of slices is written on each execution
+  int slabExtent[6] = {
+    extent[0], extent[1], extent[2], extent[3], extent[4], extent[5] };
+  if (this->Streaming)
+  {
+    int updateExtent[6];
+    info->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), updateExtent);
+    if (updateExtent[4] >= extent[4] && updateExtent[5] <= extent[5] &&
+        updateExtent[4] <= updateExtent[5])
+    {
+      slabExtent[4] = updateExtent[4];
+      slabExtent[5] = updateExtent[5];
+    }
+  }
+  bool isSlab = (slabExtent[4] != extent[4] || slabExtent[5] != extent[5]);
+  bool firstSlab = (slabExtent[4] == extent[4]);
+  bool lastSlab = (slabExtent[5] == extent[5]);
+
   // use compression if name ends in .gz
   bool isCompressed = false;
   size_t n = strlen(filename);
@@ -680,6 +742,22 @@ int vtkNIFTIWriter::RequestData(
   char *imgname = vtkNIFTIWriter::ReplaceExtension(
     filename, ".hdr", ".img");
 
+  // slabs are written to uncompressed temporary files, because a gzip
+  // stream cannot be reopened for writing, and are compressed at the end
+  bool useTempFiles = (isSlab && isCompressed);
+  bool isCompressedOutput = (isCompressed && !useTempFiles);
+  char *hdrwname = hdrname;
+  char *imgwname = imgname;
+  if (useTempFiles)
+  {
+    hdrwname = new char[strlen(hdrname) + 6];
+    strcpy(hdrwname, hdrname);
+    strcat(hdrwname, ".part");
+    imgwname = new char[strlen(imgname) + 6];
+    strcpy(imgwname, imgname);
+    strcat(imgwname, ".part");
+  }
+
   vtkDebugMacro(<< "Writing NIFTI file " << hdrname);
 
   // get either a NIFTIv1 or a NIFTIv2 header
@@ -712,13 +790,20 @@ int vtkNIFTIWriter::RequestData(
         extent[5] - extent[4] + 1 > VTK_SHORT_MAX)
     {
       vtkErrorMacro("Image too large to store in NIFTI-1 format");
+      if (useTempFiles)
+      {
+        delete [] hdrwname;
+        delete [] imgwname;
+      }
+      delete [] hdrname;
+      delete [] imgname;
       return 0;
     }
   }
 
 #if _WIN32
-  vtkDICOMFilePath fph(hdrname);
-  vtkDICOMFilePath fpi(imgname);
+  vtkDICOMFilePath fph(hdrwname);
+  vtkDICOMFilePath fpi(imgwname);
 #if VTK_MAJOR_VERSION < 7
   // convert to the local character set
   const char *uhdrname = fph.Local();
@@ -729,8 +814,8 @@ int vtkNIFTIWriter::RequestData(
   const wchar_t *uimgname = fpi.Wide();
 #endif
 #else
-  const char *uhdrname = hdrname;
-  const char *uimgname = imgname;
+  const char *uhdrname = hdrwname;
+  const char *uimgname = imgwname;
 #endif
 
   // try opening file
@@ -738,7 +823,12 @@ int vtkNIFTIWriter::RequestData(
   FILE *ufile = 0;
   if (uhdrname && uimgname)
   {
-    if (isCompressed)
+    if (!firstSlab)
+    {
+      // reopen the file that was created for the first slab
+      ufile = fopen(uimgname, NIFTI_FILE_UPDATE_MODE);
+    }
+    else if (isCompressedOutput)
     {
       file = gzopen(uhdrname, "wb");
     }
@@ -750,18 +840,30 @@ int vtkNIFTIWriter::RequestData(
 
   if (!file && !ufile)
   {
+    if (useTempFiles)
+    {
+      delete [] hdrwname;
+      delete [] imgwname;
+    }
     delete [] hdrname;
     delete [] imgname;
     this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
     return 0;
   }
 
-  this->InvokeEvent(vtkCommand::StartEvent);
-  this->UpdateProgress(0.0);
+  if (firstSlab)
+  {
+    this->InvokeEvent(vtkCommand::StartEvent);
+    this->UpdateProgress(0.0);
+  }
 
   // write the header
   size_t bytesWritten = 0;
-  if (isCompressed)
+  if (!firstSlab)
+  {
+    // header was written along with the first slab
+  }
+  else if (isCompressedOutput)
   {
     unsigned int hsize = static_cast<unsigned int>(hdrsize);
     int code = gzwrite(file, hdrptr, hsize);
@@ -771,19 +873,23 @@ int vtkNIFTIWriter::RequestData(
   {
     bytesWritten = fwrite(hdrptr, 1, hdrsize, ufile);
   }
-  if (bytesWritten < hdrsize)
+  if (firstSlab && bytesWritten < hdrsize)
   {
     this->SetErrorCode(vtkErrorCode::OutOfDiskSpaceError);
   }
 
-  if (singleFile && !this->ErrorCode)
+  if (!firstSlab)
+  {
+    // the image file is already open
+  }
+  else if (singleFile && !this->ErrorCode)
   {
     // write the padding between the header and the image to the .nii file
     size_t padsize = (static_cast<size_t>(this->OwnHeader->GetVoxOffset()) -
                       hdrsize);
     char *padding = new char[padsize];
     memset(padding, '\0', padsize);
-    if (isCompressed)
+    if (isCompressedOutput)
     {
       int code = gzwrite(file, padding, static_cast<unsigned int>(padsize));
       bytesWritten = (code < 0 ? 0 : code);
@@ -801,7 +907,7 @@ int vtkNIFTIWriter::RequestData(
   else if (!this->ErrorCode)
   {
     // close the .hdr file and open the .img file
-    if (isCompressed)
+    if (isCompressedOutput)
     {
       gzclose(file);
       file = gzopen(uimgname, "wb");
@@ -819,10 +925,6 @@ int vtkNIFTIWriter::RequestData(
     this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
   }
 
-  // write the image
-  unsigned char *dataPtr =
-    static_cast<unsigned char *>(data->GetScalarPointer());
-
   // check if planar RGB is applicable (Analyze only)
   bool planarRGB = (this->PlanarRGB &&
                     (this->OwnHeader->GetDataType() == NIFTI_TYPE_RGB24 ||
@@ -836,6 +938,13 @@ int vtkNIFTIWriter::RequestData(
   int timeDim = static_cast<int>(this->OwnHeader->GetDim(4));
   int vectorDim = static_cast<int>(this->OwnHeader->GetDim(5));
 
+  // the number of slices in this slab (all slices, unless streaming)
+  int slabSizeZ = slabExtent[5] - slabExtent[4] + 1;
+
+  // write the image, starting with the first slice of the slab
+  unsigned char *dataPtr = static_cast<unsigned char *>(
+    data->GetScalarPointer(extent[0], extent[2], slabExtent[4]));
+
   // for counting, include timeDim in vectorDim
   vectorDim *= timeDim;
 
@@ -863,7 +972,7 @@ int vtkNIFTIWriter::RequestData(
     sliceOffset = scalarSize*numComponents;
     sliceOffset *= outSizeX;
     sliceOffset *= outSizeY;
-    dataPtr += sliceOffset*(outSizeZ - 1);
+    dataPtr += sliceOffset*(slabSizeZ - 1);
   }
 
   // special increment to handle planar RGB
@@ -880,9 +989,13 @@ int vtkNIFTIWriter::RequestData(
 
   // report progress every 2% of the way to completion
   vtkIdType target =
-    static_cast<vtkIdType>(0.02*planarSize*outSizeY*outSizeZ*vectorDim) + 1;
+    static_cast<vtkIdType>(0.02*planarSize*outSizeY*slabSizeZ*vectorDim) + 1;
   vtkIdType count = 0;
 
+  // the fraction of the whole image that is written by this slab
+  double progressBase = (slabExtent[4] - extent[4])*1.0/outSizeZ;
+  double progressScale = slabSizeZ*1.0/outSizeZ;
+
   // write the data one row at a time, do planar-to-packed conversion
   // of vector components if NIFTI file has a vector dimension
   int rowSize = fileVoxelIncr/scalarSize*outSizeX;
@@ -892,6 +1005,25 @@ int vtkNIFTIWriter::RequestData(
   int k = 0; // counter for slices
   int t = 0; // counter for time
 
+  // for slabs, the position of the slab's first slice within the file
+  vtkTypeInt64 imageOffset = 0;
+  vtkTypeInt64 sliceBytes = 0;
+  int fileSlice = 0;
+  if (isSlab)
+  {
+    imageOffset = (singleFile ? this->OwnHeader->GetVoxOffset() : 0);
+    sliceBytes = static_cast<vtkTypeInt64>(rowSize)*scalarSize;
+    sliceBytes *= outSizeY;
+    sliceBytes *= planarSize;
+    fileSlice = (this->QFac < 0 ?
+                 extent[5] - slabExtent[5] : slabExtent[4] - extent[4]);
+    if (ufile && !this->ErrorCode &&
+        !vtkNIFTIWriterSeek(ufile, imageOffset + fileSlice*sliceBytes))
+    {
+      this->SetErrorCode(vtkErrorCode::OutOfDiskSpaceError);
+    }
+  }
+
   unsigned char *ptr = dataPtr;
 
   while (!this->AbortExecute && !this->ErrorCode)
@@ -922,7 +1054,7 @@ int vtkNIFTIWriter::RequestData(
       vtkByteSwap::SwapVoidRange(rowBuffer, rowSize, scalarSize);
     }
 
-    if (isCompressed)
+    if (isCompressedOutput)
     {
       int code = gzwrite(file, rowBuffer, rowSize*scalarSize);
       bytesWritten = (code < 0 ? 0 : code);
@@ -939,7 +1071,7 @@ int vtkNIFTIWriter::RequestData(
 
     if (++count % target == 0)
     {
-      this->UpdateProgress(0.02*count/target);
+      this->UpdateProgress(progressBase + progressScale*0.02*count/target);
     }
 
     if (++j == outSizeY)
@@ -952,7 +1084,7 @@ int vtkNIFTIWriter::RequestData(
         p = 0;
         ptr += planarEndOffset; // advance to start of next slice
         ptr -= 2*sliceOffset; // for reverse slice order
-        if (++k == outSizeZ)
+        if (++k == slabSizeZ)
         {
           k = 0;
           if (++t == timeDim)
@@ -975,6 +1107,15 @@ int vtkNIFTIWriter::RequestData(
             ptr = dataPtr + (c + t*(vectorDim - 1))/timeDim*
                              fileVoxelIncr*planarSize;
           }
+
+          // the slab is not contiguous across vector components
+          if (isSlab && !vtkNIFTIWriterSeek(ufile, imageOffset +
+                (static_cast<vtkTypeInt64>(c)*outSizeZ + fileSlice)*
+                sliceBytes))
+          {
+            this->SetErrorCode(vtkErrorCode::OutOfDiskSpaceError);
+            break;
+          }
         }
       }
     }
@@ -985,15 +1126,59 @@ int vtkNIFTIWriter::RequestData(
     delete [] rowBuffer;
   }
 
-  if (isCompressed)
+  if (file)
   {
     gzclose(file);
   }
-  else
+  if (ufile)
   {
     fclose(ufile);
   }
 
+  if (useTempFiles && lastSlab && !this->ErrorCode && !this->AbortExecute)
+  {
+    // compress the temporary files to produce the final files
+    int numFiles = (singleFile ? 1 : 2);
+    for (int i = 0; i < numFiles && !this->ErrorCode; i++)
+    {
+      const char *srcname = (i == 0 ? imgwname : hdrwname);
+      const char *dstname = (i == 0 ? imgname : hdrname);
+#if _WIN32
+      vtkDICOMFilePath fps(srcname);
+      vtkDICOMFilePath fpd(dstname);
+#if VTK_MAJOR_VERSION < 7
+      const char *usrcname = fps.Local();
+      const char *udstname = fpd.Local();
+#else
+      const wchar_t *usrcname = fps.Wide();
+      const wchar_t *udstname = fpd.Wide();
+#endif
+#else
+      const char *usrcname = srcname;
+      const char *udstname = dstname;
+#endif
+      FILE *infile = (usrcname ? fopen(usrcname, NIFTI_FILE_READ_MODE) : 0);
+      gzFile outfile = (infile && udstname ? gzopen(udstname, "wb") : 0);
+      if (!infile || !outfile)
+      {
+        vtkErrorMacro("Cannot open file " << (infile ? dstname : srcname));
+        this->SetErrorCode(vtkErrorCode::CannotOpenFileError);
+      }
+      else if (!vtkNIFTIWriterCompress(infile, outfile))
+      {
+        this->SetErrorCode(vtkErrorCode::OutOfDiskSpaceError);
+      }
+      if (infile)
+      {
+        fclose(infile);
+      }
+      if (outfile)
+      {
+        gzclose(outfile);
+      }
+    }
+  }
+
   if (this->ErrorCode == vtkErrorCode::OutOfDiskSpaceError)
   {
     // erase the file, rather than leave a corrupt file on disk
@@ -1005,11 +1190,99 @@ int vtkNIFTIWriter::RequestData(
     }
   }
 
-  this->UpdateProgress(1.0);
-  this->InvokeEvent(vtkCommand::EndEvent);
+  if (useTempFiles && (lastSlab || this->ErrorCode || this->AbortExecute))
+  {
+    // the temporary files are no longer needed
+    vtkDICOMFile::Remove(imgwname);
+    if (!singleFile)
+    {
+      vtkDICOMFile::Remove(hdrwname);
+    }
+  }
 
+  if (lastSlab || this->ErrorCode)
+  {
+    this->UpdateProgress(1.0);
+    this->InvokeEvent(vtkCommand::EndEvent);
+  }
+
+  if (useTempFiles)
+  {
+    delete [] hdrwname;
+    delete [] imgwname;
+  }
   delete [] hdrname;
   delete [] imgname;
 
   return 1;
 }
+
+//----------------------------------------------------------------------------
+void vtkNIFTIWriter::Write()
+{
+  if (!this->Streaming)
+  {
+    this->Superclass::Write();
+    return;
+  }
+
+  // call Modified to force update to execute
+  this->Modified();
+  this->UpdateInformation();
+  vtkInformation* inInfo = this->GetExecutive()->GetInputInformation(0, 0);
+  if (inInfo == NULL)
+  {
+    vtkErrorMacro("No input provided!");
+    return;
+  }
+
+  int wholeExtent[6];
+  inInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), wholeExtent);
+
+  // compute the number of slices that fit within the memory limit
+  vtkInformation *scalarInfo = vtkDataObject::GetActiveFieldInformation(
+    inInfo, vtkDataObject::FIELD_ASSOCIATION_POINTS,
+    vtkDataSetAttributes::SCALARS);
+  vtkIdType sliceSize = 0;
+  if (scalarInfo)
+  {
+    int scalarType = scalarInfo->Get(vtkDataObject::FIELD_ARRAY_TYPE());
+    int numComponents = scalarInfo->Get(
+      vtkDataObject::FIELD_NUMBER_OF_COMPONENTS());
+    sliceSize = vtkDataArray::GetDataTypeSize(scalarType)*numComponents;
+    sliceSize *= (wholeExtent[1] - wholeExtent[0] + 1);
+    sliceSize *= (wholeExtent[3] - wholeExtent[2] + 1);
+  }
+  vtkIdType slabSize = wholeExtent[5] - wholeExtent[4] + 1;
+  if (sliceSize > 0 && this->MemoryLimit > 0)
+  {
+    slabSize = this->MemoryLimit*1024/sliceSize;
+    if (slabSize < 1)
+    {
+      slabSize = 1;
+    }
+  }
+
+  // write the slabs in order, so that the file is written front-to-back
+  int extent[6] = {
+    wholeExtent[0], wholeExtent[1],
+    wholeExtent[2], wholeExtent[3],
+    wholeExtent[4], wholeExtent[5]
+  };
+  for (int i = wholeExtent[4]; i <= wholeExtent[5]; i += slabSize)
+  {
+    // set the update extent to the slab
+    extent[4] = i;
+    extent[5] = static_cast<int>(
+      (wholeExtent[5] - i < slabSize ? wholeExtent[5] : i + slabSize - 1));
+    this->Modified();
+    inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(),
+                extent, 6);
+    this->Update();
+
+    if (this->ErrorCode || this->AbortExecute)
+    {
+      break;
+    }
+  }
+}
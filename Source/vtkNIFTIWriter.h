@@ -182,6 +182,34 @@ public:
   vtkGetMacro(DataByteOrder, EndianEnum);
   //@}
 
+  //@{
+  //! Turn on streaming, to write the image in slabs of slices.
+  /*!
+   *  Streaming decreases memory usage for large images, since only one
+   *  slab will have to be in memory at a time.  The number of slices in
+   *  each slab is chosen so that the slab fits within the MemoryLimit.
+   *  When streaming to a compressed file, the image is first written to
+   *  a temporary uncompressed file, which is compressed after the final
+   *  slab has been written.
+   */
+  vtkSetMacro(Streaming, int);
+  vtkGetMacro(Streaming, int);
+  vtkBooleanMacro(Streaming, int);
+  //@}
+
+  //@{
+  //! Set the memory limit for streaming, in kibibytes (default 262144).
+  vtkSetMacro(MemoryLimit, vtkIdType);
+  vtkGetMacro(MemoryLimit, vtkIdType);
+  //@}
+
+  //! Write the file.
+#ifdef VTK_OVERRIDE
+  void Write() VTK_OVERRIDE;
+#else
+  void Write();
+#endif
+
 protected:
   vtkNIFTIWriter();
   ~vtkNIFTIWriter();
@@ -238,6 +266,10 @@ protected:
   //! Whether the file should be little endian.
   EndianEnum DataByteOrder;
 
+  //! Whether to write the file in slabs.
+  int Streaming;
+  vtkIdType MemoryLimit;
+
 private:
 #ifdef VTK_DELETE_FUNCTION
   vtkNIFTIWriter(const vtkNIFTIWriter&) VTK_DELETE_FUNCTION;
@@ -19,6 +19,7 @@
 #include "vtkImageData.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
+#include "vtkByteSwap.h"
 #include "vtkPointData.h"
 #include "vtkDataArray.h"
 #include "vtkStringArray.h"
@@ -98,6 +99,10 @@ void vtkScancoCTReader::InitializeHeader()
   this->MuWater = 0;
 
   this->Compression = 0;
+
+  this->RunLengthOffset = 0;
+  this->RunLengthVoxel = 0;
+  this->RunLengthFlip = 0;
 }
 
 //----------------------------------------------------------------------------
@@ -1052,16 +1057,334 @@ int vtkScancoCTReader::RequestInformation(
 }
 
 //----------------------------------------------------------------------------
-int vtkScancoCTReader::RequestData(
-  vtkInformation* request,
-  vtkInformationVector** inputVector,
-  vtkInformationVector* outputVector)
+int vtkScancoCTReader::ReadUncompressed(
+  ifstream *file, vtkImageData *data, const int extent[6])
 {
-  if (this->Compression == 0)
+  const int *wholeExtent = this->DataExtent;
+  int scalarSize = data->GetScalarSize();
+  int pixelSize = scalarSize*data->GetNumberOfScalarComponents();
+
+  // use 64-bit offsets, since files can be much larger than 4GB
+  vtkTypeInt64 rowSize = pixelSize;
+  rowSize *= (wholeExtent[1] - wholeExtent[0] + 1);
+  vtkTypeInt64 sliceSize = rowSize;
+  sliceSize *= (wholeExtent[3] - wholeExtent[2] + 1);
+
+  vtkTypeInt64 offset = this->HeaderSize;
+  offset += (extent[4] - wholeExtent[4])*sliceSize;
+  offset += (extent[2] - wholeExtent[2])*rowSize;
+  offset += (extent[0] - wholeExtent[0])*pixelSize;
+
+  size_t outRowSize = pixelSize;
+  outRowSize *= (extent[1] - extent[0] + 1);
+  int ysize = (extent[3] - extent[2] + 1);
+  int zsize = (extent[5] - extent[4] + 1);
+
+  // if whole rows are needed, each slab slice is read with a single read
+  bool fullRows = (extent[0] == wholeExtent[0] &&
+                   extent[1] == wholeExtent[1]);
+  size_t readSize = (fullRows ? outRowSize*ysize : outRowSize);
+  int readCount = (fullRows ? 1 : ysize);
+
+  char *dataPtr = static_cast<char *>(data->GetScalarPointer());
+
+  for (int i = 0; i < zsize; i++)
   {
-    return this->Superclass::RequestData(request, inputVector, outputVector);
+    for (int j = 0; j < readCount; j++)
+    {
+      file->seekg(static_cast<std::streamoff>(offset + j*rowSize));
+      file->read(dataPtr, readSize);
+      size_t shortread = readSize - file->gcount();
+      if (shortread != 0)
+      {
+        this->SetErrorCode(vtkErrorCode::PrematureEndOfFileError);
+        vtkErrorMacro("File is truncated, " << shortread <<
+                      " bytes are missing");
+        return 0;
+      }
+      if (this->GetSwapBytes() && scalarSize > 1)
+      {
+        vtkByteSwap::SwapVoidRange(
+          dataPtr, readSize/scalarSize, scalarSize);
+      }
+      dataPtr += readSize;
+    }
+    offset += sliceSize;
+    this->UpdateProgress(static_cast<double>(i + 1)/zsize);
   }
 
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkScancoCTReader::ReadPackedBits(
+  ifstream *file, vtkImageData *data, const int extent[6])
+{
+  const int *wholeExtent = this->DataExtent;
+
+  // each byte holds a 2x2x2 block of voxels
+  vtkTypeInt64 xinc = (wholeExtent[1] - wholeExtent[0] + 2)/2;
+  vtkTypeInt64 yinc = (wholeExtent[3] - wholeExtent[2] + 2)/2;
+  vtkTypeInt64 zinc = (wholeExtent[5] - wholeExtent[4] + 2)/2;
+  vtkTypeInt64 planeSize = xinc*yinc;
+
+  // the voxel value is stored in the byte that follows the bits
+  vtkTypeInt64 offset = this->HeaderSize;
+  file->seekg(static_cast<std::streamoff>(offset + planeSize*zinc));
+  char c = 0;
+  file->read(&c, 1);
+  unsigned char v = static_cast<unsigned char>(c);
+  v = (v == 0 ? 0x7f : v);
+
+  // read only the block planes that overlap the requested slices
+  int z0 = (extent[4] - wholeExtent[4])/2;
+  int z1 = (extent[5] - wholeExtent[4])/2;
+  size_t size = static_cast<size_t>(planeSize*(z1 - z0 + 1));
+  char *input = new char[size];
+  file->seekg(static_cast<std::streamoff>(offset + planeSize*z0));
+  file->read(input, size);
+
+  // confirm that enough data was read
+  size_t shortread = size - file->gcount();
+  if (shortread != 0)
+  {
+    this->SetErrorCode(vtkErrorCode::PrematureEndOfFileError);
+    vtkErrorMacro("File is truncated, " << shortread << " bytes are missing");
+  }
+
+  // unpack the bits, the bit index for each voxel is 4*z + 2*y + x
+  unsigned char *dataPtr =
+    static_cast<unsigned char *>(data->GetScalarPointer());
+  for (int i = extent[4]; i <= extent[5]; i++)
+  {
+    int zi = i - wholeExtent[4];
+    for (int j = extent[2]; j <= extent[3]; j++)
+    {
+      int yj = j - wholeExtent[2];
+      const char *inPtr = input + ((zi/2 - z0)*yinc + yj/2)*xinc;
+      int bit = ((zi & 1) << 2) + ((yj & 1) << 1);
+      for (int k = extent[0]; k <= extent[1]; k++)
+      {
+        int xk = k - wholeExtent[0];
+        unsigned char b = static_cast<unsigned char>(inPtr[xk/2]);
+        *dataPtr++ = ((b >> (bit + (xk & 1))) & 1)*v;
+      }
+    }
+  }
+
+  delete [] input;
+
+  return (shortread == 0);
+}
+
+//----------------------------------------------------------------------------
+int vtkScancoCTReader::ReadRunLengths(
+  ifstream *file, vtkImageData *data, const int extent[6])
+{
+  const int *wholeExtent = this->DataExtent;
+  vtkTypeInt64 nx = wholeExtent[1] - wholeExtent[0] + 1;
+  vtkTypeInt64 ny = wholeExtent[3] - wholeExtent[2] + 1;
+  vtkTypeInt64 planeSize = nx*ny;
+  int xsize = (extent[1] - extent[0] + 1);
+  int ysize = (extent[3] - extent[2] + 1);
+
+  // get the size of the compressed data
+  int intSize = 4;
+  if (strcmp(this->Version, "AIMDATA_V030   ") == 0)
+  {
+    // header uses 64-bit ints (8 bytes)
+    intSize = 8;
+  }
+
+  vtkTypeInt64 offset = this->HeaderSize;
+  file->seekg(static_cast<std::streamoff>(offset));
+  char head[8];
+  file->read(head, intSize);
+  vtkTypeInt64 size =
+    static_cast<unsigned int>(vtkScancoCTReader::DecodeInt(head));
+  if (intSize == 8)
+  {
+    // Read the high word of a 64-bit int
+    unsigned int high = vtkScancoCTReader::DecodeInt(head + 4);
+    size += (static_cast<vtkTypeInt64>(high) << 32);
+  }
+  vtkTypeInt64 endOffset = offset + size;
+  offset += intSize;
+
+  // binary run-lengths start with the two values that they alternate between
+  size_t runSize = 2;
+  char values[2] = { 0, 0 };
+  if (this->Compression == 0x00b2)
+  {
+    runSize = 1;
+    file->read(values, 2);
+    offset += 2;
+  }
+
+  // the range of voxels that must be decoded
+  vtkTypeInt64 startVoxel = (extent[4] - wholeExtent[4])*planeSize;
+  vtkTypeInt64 endVoxel = (extent[5] - wholeExtent[4] + 1)*planeSize;
+
+  // resume from the previous slab, if it ended before this one starts
+  vtkTypeInt64 voxel = 0;
+  int flip = 0;
+  if (this->RunLengthVoxel > 0 && this->RunLengthVoxel <= startVoxel)
+  {
+    offset = this->RunLengthOffset;
+    voxel = this->RunLengthVoxel;
+    flip = this->RunLengthFlip;
+  }
+
+  // if only part of each slice is needed, decode one row at a time
+  bool fullSlices = (extent[0] == wholeExtent[0] &&
+                     extent[1] == wholeExtent[1] &&
+                     extent[2] == wholeExtent[2] &&
+                     extent[3] == wholeExtent[3]);
+  unsigned char *rowBuffer = 0;
+  if (!fullSlices)
+  {
+    rowBuffer = new unsigned char[nx];
+  }
+
+  unsigned char *dataPtr =
+    static_cast<unsigned char *>(data->GetScalarPointer());
+
+  // the compressed data is read in chunks to limit memory use
+  const size_t bufferSize = 65536;
+  unsigned char *buffer = new unsigned char[bufferSize];
+  size_t n = 0;
+  size_t i = 0;
+  size_t shortread = 0;
+  file->seekg(static_cast<std::streamoff>(offset));
+
+  while (voxel < endVoxel)
+  {
+    if (i + runSize > n)
+    {
+      // refill the buffer
+      offset += i;
+      vtkTypeInt64 remaining = endOffset - offset;
+      if (remaining < static_cast<vtkTypeInt64>(runSize))
+      {
+        break;
+      }
+      n = bufferSize;
+      if (remaining < static_cast<vtkTypeInt64>(n))
+      {
+        n = static_cast<size_t>(remaining);
+      }
+      file->seekg(static_cast<std::streamoff>(offset));
+      file->read(reinterpret_cast<char *>(buffer), n);
+      shortread = n - file->gcount();
+      if (shortread != 0)
+      {
+        break;
+      }
+      i = 0;
+      if (voxel > startVoxel)
+      {
+        this->UpdateProgress(static_cast<double>(voxel - startVoxel)/
+                             (endVoxel - startVoxel));
+      }
+    }
+
+    // save the state at the start of this run, for resuming
+    this->RunLengthOffset = offset + i;
+    this->RunLengthVoxel = voxel;
+    this->RunLengthFlip = flip;
+
+    unsigned int l = buffer[i];
+    unsigned char v;
+    if (runSize == 1)
+    {
+      // a length of 255 means that the run continues with the same value
+      v = static_cast<unsigned char>(values[flip]);
+      if (l == 255)
+      {
+        l = 254;
+      }
+      else
+      {
+        flip = !flip;
+      }
+    }
+    else
+    {
+      v = buffer[i + 1];
+    }
+    i += runSize;
+
+    // clip the run to the range of voxels that are needed
+    vtkTypeInt64 a = voxel;
+    vtkTypeInt64 b = voxel + l;
+    voxel = b;
+    if (a < startVoxel)
+    {
+      a = startVoxel;
+    }
+    if (b > endVoxel)
+    {
+      b = endVoxel;
+    }
+    if (a >= b)
+    {
+      continue;
+    }
+
+    if (fullSlices)
+    {
+      memset(dataPtr + (a - startVoxel), v, b - a);
+      continue;
+    }
+
+    do
+    {
+      // fill the row, and copy it to the output when it is complete
+      vtkTypeInt64 x = a % nx;
+      vtkTypeInt64 m = nx - x;
+      if (m > b - a)
+      {
+        m = b - a;
+      }
+      memset(rowBuffer + x, v, m);
+      a += m;
+      if (x + m == nx)
+      {
+        vtkTypeInt64 row = (a - 1)/nx;
+        int y = static_cast<int>(row % ny) + wholeExtent[2];
+        int z = static_cast<int>(row / ny) + wholeExtent[4];
+        if (y >= extent[2] && y <= extent[3])
+        {
+          size_t outOffset = (z - extent[4]);
+          outOffset = (outOffset*ysize + (y - extent[2]))*xsize;
+          memcpy(dataPtr + outOffset, rowBuffer + (extent[0] - wholeExtent[0]),
+                 xsize);
+        }
+      }
+    }
+    while (a < b);
+  }
+
+  delete [] buffer;
+  delete [] rowBuffer;
+
+  if (shortread != 0)
+  {
+    this->RunLengthVoxel = 0;
+    this->SetErrorCode(vtkErrorCode::PrematureEndOfFileError);
+    vtkErrorMacro("File is truncated, " << shortread << " bytes are missing");
+    return 0;
+  }
+
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+int vtkScancoCTReader::RequestData(
+  vtkInformation* request,
+  vtkInformationVector** vtkNotUsed(inputVector),
+  vtkInformationVector* outputVector)
+{
   // check whether the reader is in an error state
   if (this->GetErrorCode() != vtkErrorCode::NoError)
   {
@@ -1080,8 +1403,9 @@ int vtkScancoCTReader::RequestData(
 
   vtkInformation* outInfo = outputVector->GetInformationObject(0);
 
+  // only the requested extent is read, to allow streaming
   int extent[6];
-  outInfo->Get(vtkStreamingDemandDrivenPipeline::WHOLE_EXTENT(), extent);
+  outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_EXTENT(), extent);
 
   // get the data object, allocate memory
   vtkImageData *data =
@@ -1110,12 +1434,15 @@ int vtkScancoCTReader::RequestData(
     return 0;
   }
 
-  // get the pointer to the output
-  unsigned char *dataPtr =
-    static_cast<unsigned char *>(data->GetScalarPointer());
+#if defined(_WIN32) && (_MSC_VER >= 1400)
+  vtkDICOMFilePath fp(filename);
+  const wchar_t *ufilename = fp.Wide();
+#else
+  const char *ufilename = filename;
+#endif
 
   // open the file
-  ifstream infile(filename, ios::in | ios::binary);
+  ifstream infile(ufilename, ios::in | ios::binary);
   if (!infile.good())
   {
     vtkErrorMacro("Cannot open file " << filename);
@@ -1123,165 +1450,26 @@ int vtkScancoCTReader::RequestData(
     return 0;
   }
 
-  // seek to the data
-  infile.seekg(this->HeaderSize);
-
-  // get the size of the compressed data
-  int intSize = 4;
-  if (strcmp(this->Version, "AIMDATA_V030   ") == 0)
+  int rval = 0;
+  if (this->Compression == 0)
   {
-    // header uses 64-bit ints (8 bytes)
-    intSize = 8;
+    rval = this->ReadUncompressed(&infile, data, extent);
   }
-
-  // Dimensions of the data
-  int xsize = (extent[1] - extent[0] + 1);
-  int ysize = (extent[3] - extent[2] + 1);
-  int zsize = (extent[5] - extent[4] + 1);
-  size_t outSize = xsize;
-  outSize *= ysize;
-  outSize *= zsize;
-
-  // For the input (compressed) data
-  char *input = 0;
-  size_t size = 0;
-
-  if (this->Compression == 0x00b1)
+  else if (this->Compression == 0x00b1)
   {
-    // Compute the size of the binary packed data
-    size_t xinc = (xsize+1)/2;
-    size_t yinc = (ysize+1)/2;
-    size_t zinc = (zsize+1)/2;
-    size = xinc*yinc*zinc + 1;
-    input = new char[size];
-    infile.read(input, size);
+    rval = this->ReadPackedBits(&infile, data, extent);
   }
   else if (this->Compression == 0x00b2 ||
            this->Compression == 0x00c2)
   {
-    // Get the size of the compressed data
-    char head[8];
-    infile.read(head, intSize);
-    size = static_cast<unsigned int>(vtkScancoCTReader::DecodeInt(head));
-    if (intSize == 8)
-    {
-      // Read the high word of a 64-bit int
-      unsigned int high = vtkScancoCTReader::DecodeInt(head + 4);
-      size += (static_cast<vtkTypeUInt64>(high) << 32);
-    }
-    input = new char[size - intSize];
-    size -= intSize;
-    infile.read(input, size);
-  }
-
-  // confirm that enough data was read
-  size_t shortread = size - infile.gcount();
-  if (shortread != 0)
-  {
-    this->SetErrorCode(vtkErrorCode::PrematureEndOfFileError);
-    vtkErrorMacro("File is truncated, " << shortread << " bytes are missing");
+    rval = this->ReadRunLengths(&infile, data, extent);
   }
 
   // Close the file
   infile.close();
 
-  if (this->Compression == 0x00b1)
-  {
-    // Unpack binary data, each byte becomes a 2x2x2 block of voxels
-    size_t xinc = (xsize+1)/2;
-    size_t yinc = (ysize+1)/2;
-    unsigned char v = input[size-1];
-    v = (v == 0 ? 0x7f : v);
-    unsigned char bit = 0;
-    for (int i = 0; i < zsize; i++)
-    {
-      bit ^= (bit & 2);
-      for (int j = 0; j < ysize; j++)
-      {
-        char *inPtr = input + (i*yinc + j)*xinc;
-        bit ^= (bit & 1);
-        for (int k = 0; k < xsize; k++)
-        {
-          unsigned char c = *inPtr;
-          *dataPtr++ = ((c >> bit) & 1)*v;
-          inPtr += (bit & 1);
-          bit ^= 1;
-        }
-        bit ^= 2;
-      }
-      bit ^= 4;
-    }
-  }
-  else if (this->Compression == 0x00b2)
-  {
-    // Decompress binary run-lengths
-    bool flip = 0;
-    unsigned char v = input[flip];
-    char *inPtr = input + 2;
-    size -= 2;
-    if (size > 0)
-    {
-      do
-      {
-        unsigned char l = *inPtr++;
-        if (l == 255)
-        {
-          l = 254;
-          flip = !flip;
-        }
-        if (l > outSize)
-        {
-          l = static_cast<unsigned char>(outSize);
-        }
-        outSize -= l;
-        if (l > 0)
-        {
-          do
-          {
-            *dataPtr++ = v;
-          }
-          while (--l);
-        }
-        flip = !flip;
-        v = input[flip];
-      }
-      while (--size != 0 && outSize != 0);
-    }
-  }
-  else if (this->Compression == 0x00c2)
-  {
-    // Decompress 8-bit run-lengths
-    char *inPtr = input;
-    size /= 2;
-    if (size > 0)
-    {
-      do
-      {
-        unsigned char l = inPtr[0];
-        unsigned char v = inPtr[1];
-        inPtr += 2;
-        if (l > outSize)
-        {
-          l = static_cast<unsigned char>(outSize);
-        }
-        outSize -= l;
-        if (l > 0)
-        {
-          do
-          {
-            *dataPtr++ = v;
-          }
-          while (--l);
-        }
-      }
-      while (--size != 0 && outSize != 0);
-    }
-  }
-
-  delete [] input;
-
   this->UpdateProgress(1.0);
   this->InvokeEvent(vtkCommand::EndEvent);
 
-  return 1;
+  return rval;
 }
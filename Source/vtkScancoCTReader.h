@@ -28,6 +28,14 @@
  * To convert to Hounsfield units, multiply by 1000/(MuScaling*MuWater)
  * and subtract 1000.
  *
+ * This reader only reads the slices that are within the UPDATE_EXTENT
+ * that is requested by the pipeline, so that very large files can be
+ * streamed in slabs (e.g. with vtkImageDataStreamer).  Uncompressed data
+ * is read by seeking directly to the requested voxels, while compressed
+ * AIM data is decoded only up to the end of the requested slab.  When
+ * the slabs are requested in sequential order, the decoding of run-length
+ * compressed data resumes from where the previous slab ended.
+ *
  * Created at the Calgary Image Processing and Analysis Centre (CIPAC).
  */
 
@@ -37,6 +45,8 @@
 #include "vtkImageReader2.h"
 #include "vtkDICOMModule.h" // For export macro
 
+class vtkImageData;
+
 //----------------------------------------------------------------------------
 class VTKDICOM_EXPORT vtkScancoCTReader : public vtkImageReader2
 {
@@ -221,6 +231,18 @@ protected:
   //! Read AIM header.
   int ReadAIMHeader(ifstream *file, unsigned long bytesRead);
 
+  //! Read the uncompressed voxels within the given extent.
+  int ReadUncompressed(ifstream *file, vtkImageData *data,
+                       const int extent[6]);
+
+  //! Read the packed-bit (0x00b1) voxels within the given extent.
+  int ReadPackedBits(ifstream *file, vtkImageData *data,
+                     const int extent[6]);
+
+  //! Read the run-length (0x00b2, 0x00c2) voxels within the given extent.
+  int ReadRunLengths(ifstream *file, vtkImageData *data,
+                     const int extent[6]);
+
   //! Check the file header to see what type of file it is.
   /*!
    *  Return values are: 0 if unrecognized, 1 if ISQ/RAD,
@@ -292,6 +314,11 @@ protected:
   // The compression mode, if any.
   int Compression;
 
+  // The position at which to resume decoding run-length data.
+  vtkTypeInt64 RunLengthOffset;
+  vtkTypeInt64 RunLengthVoxel;
+  int RunLengthFlip;
+
 private:
 #ifdef VTK_DELETE_FUNCTION
   vtkScancoCTReader(const vtkScancoCTReader&) VTK_DELETE_FUNCTION;
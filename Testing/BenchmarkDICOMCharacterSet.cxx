@@ -0,0 +1,138 @@
+#include "vtkDICOMCharacterSet.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <time.h>
+#include <string.h>
+#include <stdlib.h>
+
+// Measure the speed of conversion to and from UTF-8 for the encodings
+// that use large tables, i.e. the Chinese, Japanese, and Korean ones.
+// This is not run as a test, since the results depend on the machine.
+
+// the character sets to measure, and the unicode range to take text from
+struct EncodingInfo
+{
+  const char *Name;
+  unsigned int First;
+  unsigned int Last;
+};
+
+static const EncodingInfo Encodings[] = {
+  { "GB18030", 0x4E00, 0x9FFF },
+  { "GBK", 0x4E00, 0x9FFF },
+  { "ISO 2022 IR 58", 0x4E00, 0x9FFF },
+  { "big5", 0x4E00, 0x9FFF },
+  { "ISO 2022 IR 87", 0x4E00, 0x9FFF },
+  { "ISO 2022 IR 13\\ISO 2022 IR 87", 0x3040, 0x30FF },
+  { "euc-jp", 0x4E00, 0x9FFF },
+  { "shift_jis", 0x4E00, 0x9FFF },
+  { "ISO 2022 IR 149", 0xAC00, 0xD7A3 },
+  { "euc-kr", 0xAC00, 0xD7A3 },
+  { NULL, 0, 0 }
+};
+
+// append a unicode character to a utf-8 string
+static void AppendUTF8(unsigned int code, std::string *s)
+{
+  if (code < 0x80)
+  {
+    s->push_back(static_cast<char>(code));
+  }
+  else if (code < 0x800)
+  {
+    s->push_back(static_cast<char>(0xC0 | (code >> 6)));
+    s->push_back(static_cast<char>(0x80 | (code & 0x3F)));
+  }
+  else
+  {
+    s->push_back(static_cast<char>(0xE0 | (code >> 12)));
+    s->push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+    s->push_back(static_cast<char>(0x80 | (code & 0x3F)));
+  }
+}
+
+// report the conversion rate for a timed loop
+static void Report(const char *what, clock_t t, size_t n)
+{
+  double s = static_cast<double>(t)/CLOCKS_PER_SEC;
+  if (s > 0)
+  {
+    cout << "  " << what << ": " << static_cast<long>(n/s) << " chars/s\n";
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  int repeats = 20;
+  if (argc > 1)
+  {
+    repeats = atoi(argv[1]);
+  }
+
+  size_t count = 0;
+  for (int i = 0; Encodings[i].Name != NULL; i++)
+  {
+    vtkDICOMCharacterSet cs(Encodings[i].Name);
+
+    // collect the characters in the range that the encoding supports
+    std::vector<unsigned int> codes;
+    for (unsigned int c = Encodings[i].First; c <= Encodings[i].Last; c++)
+    {
+      std::string u;
+      AppendUTF8(c, &u);
+      size_t l;
+      std::string e = cs.FromUTF8(u.data(), u.length(), &l);
+      if (l == u.length() && cs.ToUTF8(e) == u)
+      {
+        codes.push_back(c);
+      }
+    }
+
+    // shuffle them, since the characters in real names are not sorted
+    unsigned int seed = 1;
+    for (size_t j = codes.size(); j > 1; j--)
+    {
+      seed = seed*1103515245u + 12345u;
+      std::swap(codes[j - 1], codes[(seed >> 8) % j]);
+    }
+
+    // make names with a few characters each, as for patient names
+    std::string names;
+    for (size_t j = 0; j < codes.size(); j++)
+    {
+      AppendUTF8(codes[j], &names);
+      if (j % 4 == 3)
+      {
+        names += "^";
+      }
+    }
+    size_t n = codes.size() + codes.size()/4;
+
+    // convert once before timing, so that any tables are ready
+    std::string encoded = cs.FromUTF8(names);
+
+    cout << Encodings[i].Name << ", chars: " << n << "\n";
+
+    clock_t t = clock();
+    for (int r = 0; r < repeats; r++)
+    {
+      count += cs.FromUTF8(names).length();
+    }
+    Report("from utf-8", clock() - t, repeats*n);
+
+    t = clock();
+    for (int r = 0; r < repeats; r++)
+    {
+      count += cs.ToUTF8(encoded).length();
+    }
+    Report("to utf-8", clock() - t, repeats*n);
+  }
+
+  // print the count so that the loops are not optimized away
+  cout << "bytes: " << count << "\n";
+
+  return 0;
+}
@@ -0,0 +1,123 @@
+#include "vtkDICOMDictionary.h"
+#include "vtkDICOMDictEntry.h"
+
+#include <algorithm>
+#include <vector>
+#include <string>
+
+#include <time.h>
+#include <string.h>
+#include <stdlib.h>
+
+// Measure the speed of dictionary lookups by tag and by keyword.
+// This is not run as a test, since the results depend on the machine.
+
+// the groups that are searched to collect the tags for the benchmark
+static const unsigned short Groups[] = {
+  0x0002, 0x0008, 0x0010, 0x0018, 0x0020, 0x0028, 0x0032, 0x0040,
+  0x0054, 0x0070, 0x0088, 0x0400, 0x2050, 0x3002, 0x3006, 0x300A,
+  0x300C, 0x300E, 0x4000, 0x4008, 0x5200, 0x7FE0, 0xFFFE
+};
+
+// report the lookup rate for a timed loop
+static void Report(const char *what, clock_t t, size_t n)
+{
+  double s = static_cast<double>(t)/CLOCKS_PER_SEC;
+  if (s > 0)
+  {
+    cout << what << ": " << static_cast<long>(n/s) << " lookups/s\n";
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  int repeats = 20;
+  if (argc > 1)
+  {
+    repeats = atoi(argv[1]);
+  }
+
+  // collect all of the dictionary tags in the listed groups, and
+  // an equal number of tags that are not in the dictionary
+  std::vector<vtkDICOMTag> hits;
+  std::vector<vtkDICOMTag> misses;
+  std::vector<std::string> keys;
+  size_t ng = sizeof(Groups)/sizeof(Groups[0]);
+  for (size_t i = 0; i < ng; i++)
+  {
+    for (unsigned int e = 0; e < 0x10000; e++)
+    {
+      vtkDICOMTag tag(Groups[i], e);
+      vtkDICOMDictEntry entry = vtkDICOMDictionary::FindDictEntry(tag);
+      if (entry.IsValid())
+      {
+        hits.push_back(tag);
+        keys.push_back(entry.GetName());
+      }
+      else if ((e & 0x00FF) == 0x00F1)
+      {
+        misses.push_back(tag);
+      }
+    }
+  }
+  misses.resize(hits.size());
+
+  // also look up the tags in a shuffled order, since the lookups done
+  // while parsing a file are mixed with other work and do not sweep
+  // through the dictionary in order
+  std::vector<vtkDICOMTag> shuffled = hits;
+  unsigned int seed = 1;
+  for (size_t i = shuffled.size(); i > 1; i--)
+  {
+    seed = seed*1103515245u + 12345u;
+    std::swap(shuffled[i - 1], shuffled[(seed >> 8) % i]);
+  }
+
+  cout << "tags: " << hits.size() << ", repeats: " << repeats << "\n";
+
+  size_t count = 0;
+  clock_t t = clock();
+  for (int r = 0; r < repeats; r++)
+  {
+    for (size_t i = 0; i < hits.size(); i++)
+    {
+      count += vtkDICOMDictionary::FindDictEntry(hits[i]).IsValid();
+    }
+  }
+  Report("tag (found)", clock() - t, repeats*hits.size());
+
+  t = clock();
+  for (int r = 0; r < repeats; r++)
+  {
+    for (size_t i = 0; i < shuffled.size(); i++)
+    {
+      count += vtkDICOMDictionary::FindDictEntry(shuffled[i]).IsValid();
+    }
+  }
+  Report("tag (found, shuffled)", clock() - t, repeats*shuffled.size());
+
+  t = clock();
+  for (int r = 0; r < repeats; r++)
+  {
+    for (size_t i = 0; i < misses.size(); i++)
+    {
+      count += vtkDICOMDictionary::FindDictEntry(misses[i]).IsValid();
+    }
+  }
+  Report("tag (not found)", clock() - t, repeats*misses.size());
+
+  t = clock();
+  for (int r = 0; r < repeats; r++)
+  {
+    for (size_t i = 0; i < keys.size(); i++)
+    {
+      count += vtkDICOMDictionary::FindDictEntry(keys[i].c_str()).IsValid();
+    }
+  }
+  Report("keyword (found)", clock() - t, repeats*keys.size());
+
+  // print the count so that the loops are not optimized away
+  cout << "valid: " << count << "\n";
+
+  return 0;
+}
@@ -385,5 +385,45 @@ int main(int argc, char *argv[])
   }
   }
 
+  { // test that plain ASCII text is passed through unchanged
+  std::string ascii;
+  for (int c = 1; c < 0x80; c++)
+  {
+    if (c != '\033')
+    {
+      ascii.push_back(static_cast<char>(c));
+    }
+  }
+  std::string folded = ascii;
+  for (size_t i = 0; i < folded.size(); i++)
+  {
+    if (folded[i] >= 'A' && folded[i] <= 'Z') { folded[i] += 0x20; }
+  }
+  for (int k = 0; k < 256; k++)
+  {
+    vtkDICOMCharacterSet cs(k);
+    if (cs.GetKey() != k)
+    {
+      continue;
+    }
+    if (cs.IsPlainASCII(ascii.data(), ascii.length()))
+    {
+      TestAssert(cs.ToUTF8(ascii) == ascii);
+      TestAssert(cs.CaseFoldedUTF8(ascii) == folded);
+    }
+    else
+    {
+      // only JIS X 0201 uses different codes for the ASCII range
+      TestAssert(cs.ToUTF8(ascii) != ascii);
+    }
+  }
+  vtkDICOMCharacterSet cs(vtkDICOMCharacterSet::ISO_2022_IR_87);
+  TestAssert(cs.IsPlainASCII("ABC", 3));
+  TestAssert(!cs.IsPlainASCII("A\033$B", 4));
+  TestAssert(!cs.IsPlainASCII("abcdefghijklmnopqrstuvwxyz0123456789\xe9", 37));
+  TestAssert(!vtkDICOMCharacterSet(
+    vtkDICOMCharacterSet::ISO_IR_13).IsPlainASCII("ABC", 3));
+  }
+
   return rval;
 }
@@ -72,6 +72,33 @@ int main(int argc, char *argv[])
   TestAssert(pkey == e.GetName());
   e = vtkDICOMDictionary::FindDictEntry("", "GEMS_ACQU_01");
   TestAssert(!e.IsValid());
+  e = vtkDICOMDictionary::FindDictEntry(ptag, "GEMS_ACQU_0");
+  TestAssert(!e.IsValid());
+
+  // test that a built-in dictionary stays removed, even if it was
+  // removed before it was ever looked up
+  vtkDICOMDictionary::RemovePrivateDictionary("GEMS_IMAG_01");
+  e = vtkDICOMDictionary::FindDictEntry(
+    vtkDICOMTag(0x0027,0x0006), "GEMS_IMAG_01");
+  TestAssert(!e.IsValid());
+  e = vtkDICOMDictionary::FindDictEntry("ScoutType", "GEMS_IMAG_01");
+  TestAssert(!e.IsValid());
+
+  // test that every tag in a group can be found again by key
+  int found = 0;
+  for (unsigned int element = 0; element < 0x10000; element++)
+  {
+    vtkDICOMTag tag(0x0018, element);
+    e = vtkDICOMDictionary::FindDictEntry(tag);
+    if (e.IsValid())
+    {
+      found++;
+      TestAssert(e.GetTag() == tag);
+      vtkDICOMDictEntry e2 = vtkDICOMDictionary::FindDictEntry(e.GetName());
+      TestAssert(e2.IsValid() && e2.GetTag() == tag);
+    }
+  }
+  TestAssert(found > 500);
 
   return rval;
 }
@@ -0,0 +1,467 @@
+#include "TestDICOMHelpers.h"
+
+#include "vtkDICOMDirectory.h"
+#include "vtkDICOMMetaData.h"
+#include "vtkDICOMItem.h"
+#include "vtkDICOMUtilities.h"
+
+#include "vtkStringArray.h"
+#include "vtkSmartPointer.h"
+#include "vtkCommand.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+
+#include <algorithm>
+
+#include <string.h>
+
+// macro for performing tests
+#define TestAssert(t) \
+if (!(t)) \
+{ \
+  cout << exename << ": Assertion Failed: " << #t << "\n"; \
+  cout << __FILE__ << ":" << __LINE__ << "\n"; \
+  cout.flush(); \
+  rval |= 1; \
+}
+
+// the files that are written: subdirectory, series, instance number,
+// and the series number if it differs from the usual number for the series
+struct FileInfo
+{
+  const char *Directory;
+  int Series;
+  int InstanceNumber;
+  int SeriesNumber;
+};
+
+// the series are spread across directories, and some instance numbers
+// are repeated, so that the order in which files are found matters
+static const FileInfo TestFiles[] = {
+  { "a", 0, 2, 0 },
+  { "a", 0, 1, 0 },
+  { "a/x", 2, 2, 0 },
+  { "a", 0, 3, 0 },
+  { "a/x", 1, 1, 0 },
+  { "a/x", 1, 1, 0 },
+  { "a/x/y", 1, 2, 0 },
+  { "b", 2, 3, 0 },
+  { "b", 2, 1, 0 },
+  { "b/z", 3, 1, 0 },
+  { "b/z", 2, 2, 0 },
+  { "", 3, 2, 5 },
+  { 0, 0, 0, 0 }
+};
+
+// the patient for each series
+static const char *TestPatients[] = {
+  "Test^One", "Test^One", "Test^Two", "Test^Three"
+};
+
+// write a header-only file
+static bool WriteFile(
+  const std::string& filename, const char *patient, int study,
+  const std::string& studyUID, int series, const std::string& seriesUID,
+  int seriesNumber, int instance)
+{
+  vtkSmartPointer<vtkDICOMMetaData> meta =
+    vtkSmartPointer<vtkDICOMMetaData>::New();
+  meta->Set(DC::SOPClassUID, "1.2.840.10008.5.1.4.1.1.4");
+  meta->Set(DC::PatientName, patient);
+  meta->Set(DC::PatientID, patient + 5);
+  meta->Set(DC::StudyInstanceUID, studyUID);
+  meta->Set(DC::StudyID, study + 1);
+  meta->Set(DC::SeriesInstanceUID, seriesUID);
+  meta->Set(DC::SOPInstanceUID,
+            vtkDICOMUtilities::GenerateUID(DC::SOPInstanceUID));
+  meta->Set(DC::Modality, "MR");
+  meta->Set(DC::SeriesNumber, (seriesNumber ? seriesNumber : series + 1));
+  meta->Set(DC::InstanceNumber, instance);
+  // differs between files, so it shows which file the record came from
+  meta->Set(DC::SeriesDescription, vtkDICOMFilePath(filename).GetBack());
+  // only in some files, so it is sometimes missing from the series record
+  if (instance != 2)
+  {
+    meta->Set(DC::SeriesTime, "120000");
+  }
+
+  return TestWriteFile(filename, meta);
+}
+
+// print a record, optionally without the attributes that differ
+// between the files in a series
+static void PrintRecord(
+  std::ostream& os, const vtkDICOMItem& item, bool description)
+{
+  vtkDICOMDataElementIterator iter = item.Begin();
+  vtkDICOMDataElementIterator iterEnd = item.End();
+  for (; iter != iterEnd; ++iter)
+  {
+    vtkDICOMTag tag = iter->GetTag();
+    if (description || (tag != DC::SeriesDescription &&
+                        tag != DC::SeriesTime && tag != DC::SeriesNumber))
+    {
+      os << " " << iter->GetTag() << "=" << iter->GetValue().AsString();
+    }
+  }
+  os << "\n";
+}
+
+// summarize everything that a vtkDICOMDirectory found
+static std::string Summarize(
+  vtkDICOMDirectory *dir, bool description=true)
+{
+  std::ostringstream os;
+  os << "patients " << dir->GetNumberOfPatients() << "\n";
+  for (int i = 0; i < dir->GetNumberOfStudies(); i++)
+  {
+    os << "patient";
+    PrintRecord(os, dir->GetPatientRecordForStudy(i), description);
+    os << "study";
+    PrintRecord(os, dir->GetStudyRecord(i), description);
+    int j1 = dir->GetLastSeriesForStudy(i);
+    for (int j = dir->GetFirstSeriesForStudy(i); j <= j1; j++)
+    {
+      os << "series";
+      PrintRecord(os, dir->GetSeriesRecord(j), description);
+      vtkStringArray *sa = dir->GetFileNamesForSeries(j);
+      vtkDICOMMetaData *meta = dir->GetMetaDataForSeries(j);
+      for (vtkIdType k = 0; k < sa->GetNumberOfValues(); k++)
+      {
+        int idx = static_cast<int>(k);
+        os << "file " << sa->GetValue(k) << " "
+           << meta->Get(idx, DC::SeriesTime).AsString() << "\n";
+      }
+    }
+  }
+  return os.str();
+}
+
+// collect the files from each PartialSeriesEvent
+class PartialSeriesObserver : public vtkCommand
+{
+public:
+  static PartialSeriesObserver *New() { return new PartialSeriesObserver; }
+  vtkTypeMacro(PartialSeriesObserver,vtkCommand);
+
+#ifdef VTK_OVERRIDE
+  void Execute(vtkObject *, unsigned long, void *data) VTK_OVERRIDE;
+#else
+  void Execute(vtkObject *, unsigned long, void *data);
+#endif
+
+  std::map<int, std::vector<std::string> > Files;
+  int NumberOfEvents;
+
+protected:
+  PartialSeriesObserver() : NumberOfEvents(0) {}
+};
+
+void PartialSeriesObserver::Execute(vtkObject *, unsigned long, void *data)
+{
+  vtkDICOMDirectory::PartialSeries *ps =
+    static_cast<vtkDICOMDirectory::PartialSeries *>(data);
+  std::vector<std::string>& files = this->Files[ps->ScanIndex];
+  for (vtkIdType i = 0; i < ps->NewFileNames->GetNumberOfValues(); i++)
+  {
+    files.push_back(ps->NewFileNames->GetValue(i));
+  }
+  this->NumberOfEvents++;
+}
+
+// keep the file name arrays that are requested during UpdateDataEvent
+class UpdateDataObserver : public vtkCommand
+{
+public:
+  static UpdateDataObserver *New() { return new UpdateDataObserver; }
+  vtkTypeMacro(UpdateDataObserver,vtkCommand);
+
+#ifdef VTK_OVERRIDE
+  void Execute(vtkObject *, unsigned long, void *data) VTK_OVERRIDE;
+#else
+  void Execute(vtkObject *, unsigned long, void *data);
+#endif
+
+  std::vector<vtkStringArray *> Arrays;
+
+protected:
+  UpdateDataObserver() {}
+};
+
+void UpdateDataObserver::Execute(vtkObject *caller, unsigned long, void *data)
+{
+  vtkDICOMDirectory *dir = static_cast<vtkDICOMDirectory *>(caller);
+  int k = *static_cast<int *>(data);
+  this->Arrays.resize(k + 1);
+  this->Arrays[k] = dir->GetFileNamesForSeries(k);
+}
+
+// check that the two ways of getting the file names agree
+static bool CheckFileNames(vtkDICOMDirectory *dir)
+{
+  vtkSmartPointer<vtkStringArray> files =
+    vtkSmartPointer<vtkStringArray>::New();
+  for (int j = 0; j < dir->GetNumberOfSeries(); j++)
+  {
+    dir->GetFileNamesForSeries(j, files);
+    vtkStringArray *sa = dir->GetFileNamesForSeries(j);
+    if (sa != dir->GetFileNamesForSeries(j) ||
+        sa->GetNumberOfValues() != files->GetNumberOfValues() ||
+        dir->GetNumberOfFilesForSeries(j) != files->GetNumberOfValues())
+    {
+      return false;
+    }
+    for (vtkIdType k = 0; k < sa->GetNumberOfValues(); k++)
+    {
+      if (sa->GetValue(k) != files->GetValue(k))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// check that the files reported by PartialSeriesEvent match the results
+static bool CheckPartialSeries(
+  vtkDICOMDirectory *dir, PartialSeriesObserver *observer)
+{
+  size_t n = 0;
+  for (int j = 0; j < dir->GetNumberOfSeries(); j++)
+  {
+    // every file is reported exactly once, under the same scan index
+    std::vector<std::string> files =
+      observer->Files[dir->GetScanIndexForSeries(j)];
+    vtkStringArray *sa = dir->GetFileNamesForSeries(j);
+    if (files.size() != static_cast<size_t>(sa->GetNumberOfValues()))
+    {
+      return false;
+    }
+    for (vtkIdType k = 0; k < sa->GetNumberOfValues(); k++)
+    {
+      std::vector<std::string>::iterator pos =
+        std::find(files.begin(), files.end(), sa->GetValue(k));
+      if (pos == files.end())
+      {
+        return false;
+      }
+      files.erase(pos);
+    }
+    n += static_cast<size_t>(sa->GetNumberOfValues());
+  }
+  return (n > 0 && observer->Files.size() ==
+          static_cast<size_t>(dir->GetNumberOfSeries()));
+}
+
+int main(int argc, char *argv[])
+{
+  int rval = 0;
+  const char *exename = TestExeName(argc, argv, "TestDICOMDirectory");
+
+  // the directory for the files, removed when the test is done
+  TestDirectory testdir(argc, argv, "TestDICOMDirectory_files");
+  const std::string& dirname = testdir.GetName();
+
+  // write the files in reverse, so that the order in which they are
+  // stored on disk is different from the order of their names
+  std::string studyUIDs[3];
+  std::string seriesUIDs[4];
+  for (int i = 0; i < 3; i++)
+  {
+    studyUIDs[i] = vtkDICOMUtilities::GenerateUID(DC::StudyInstanceUID);
+  }
+  for (int i = 0; i < 4; i++)
+  {
+    seriesUIDs[i] = vtkDICOMUtilities::GenerateUID(DC::SeriesInstanceUID);
+  }
+  std::vector<std::string> filenames;
+  int numberOfFiles = 0;
+  while (TestFiles[numberOfFiles].Directory)
+  {
+    numberOfFiles++;
+  }
+  for (int j = numberOfFiles - 1; j >= 0; j--)
+  {
+    const FileInfo *info = &TestFiles[j];
+    vtkDICOMFilePath path(dirname);
+    for (const char *dp = info->Directory; *dp != '\0'; )
+    {
+      size_t l = strcspn(dp, "/");
+      path.PushBack(std::string(dp, l));
+      dp += l + (dp[l] == '/');
+    }
+    vtkDICOMFileDirectory::Create(path.AsString().c_str());
+    std::ostringstream fname;
+    fname << "IM" << j << ".dcm";
+    path.PushBack(fname.str());
+    filenames.push_back(path.AsString());
+
+    const char *patient = TestPatients[info->Series];
+    int study = (info->Series < 2 ? 0 : info->Series - 1);
+    TestAssert(WriteFile(filenames.back(), patient, study,
+                         studyUIDs[study], info->Series,
+                         seriesUIDs[info->Series], info->SeriesNumber,
+                         info->InstanceNumber));
+  }
+
+  // scan the files with one thread
+  vtkSmartPointer<vtkDICOMDirectory> dir =
+    vtkSmartPointer<vtkDICOMDirectory>::New();
+  dir->SetDirectoryName(dirname.c_str());
+  dir->SetScanDepth(4);
+  dir->RequirePixelDataOff();
+  dir->SetNumberOfThreads(1);
+  dir->Update();
+  TestAssert(dir->GetErrorCode() == 0);
+  TestAssert(dir->GetNumberOfPatients() == 3);
+  TestAssert(dir->GetNumberOfStudies() == 3);
+  TestAssert(dir->GetNumberOfSeries() == 4);
+  TestAssert(dir->GetNumberOfReads() >= numberOfFiles);
+  TestAssert(dir->GetNumberOfBytesRead() > 0);
+  std::string expected = Summarize(dir);
+
+  { // scan with several threads, a few times over
+  for (int t = 2; t <= 8; t *= 2)
+  {
+    for (int i = 0; i < 3; i++)
+    {
+      dir->SetNumberOfThreads(t);
+      dir->Modified();
+      dir->Update();
+      TestAssert(dir->GetErrorCode() == 0);
+      TestAssert(Summarize(dir) == expected);
+    }
+  }
+  }
+
+  { // the partial series must add up to the results, even while the
+    // files are scanned by one thread as they are found by the others
+  for (int t = 1; t <= 4; t *= 2)
+  {
+    vtkSmartPointer<PartialSeriesObserver> observer =
+      vtkSmartPointer<PartialSeriesObserver>::New();
+    vtkSmartPointer<vtkDICOMDirectory> incremental =
+      vtkSmartPointer<vtkDICOMDirectory>::New();
+    incremental->SetDirectoryName(dirname.c_str());
+    incremental->SetScanDepth(4);
+    incremental->RequirePixelDataOff();
+    incremental->SetNumberOfThreads(t);
+    incremental->IncrementalOn();
+    incremental->AddObserver(vtkDICOMDirectory::PartialSeriesEvent, observer);
+    incremental->Update();
+    TestAssert(incremental->GetErrorCode() == 0);
+    TestAssert(observer->NumberOfEvents > 0);
+    TestAssert(CheckPartialSeries(incremental, observer));
+    TestAssert(Summarize(incremental) == expected);
+  }
+  }
+
+  { // the arrays requested during UpdateDataEvent must be kept
+  vtkSmartPointer<UpdateDataObserver> observer =
+    vtkSmartPointer<UpdateDataObserver>::New();
+  vtkSmartPointer<vtkDICOMDirectory> observed =
+    vtkSmartPointer<vtkDICOMDirectory>::New();
+  observed->SetDirectoryName(dirname.c_str());
+  observed->SetScanDepth(4);
+  observed->RequirePixelDataOff();
+  observed->AddObserver(vtkCommand::UpdateDataEvent, observer);
+  observed->Update();
+  TestAssert(observed->GetErrorCode() == 0);
+  TestAssert(observer->Arrays.size() == 4);
+  for (int j = 0; j < observed->GetNumberOfSeries(); j++)
+  {
+    TestAssert(observer->Arrays[j] == observed->GetFileNamesForSeries(j));
+  }
+  TestAssert(CheckFileNames(observed));
+  TestAssert(CheckFileNames(dir));
+  TestAssert(Summarize(observed) == expected);
+  }
+
+  { // the read order must not change the results
+  static const int readOrders[] = {
+    vtkDICOMFile::IndexOrder,
+    vtkDICOMFile::PhysicalOrder,
+    vtkDICOMFile::NameOrder
+  };
+  for (int i = 0; i < 3; i++)
+  {
+    dir->SetReadOrder(readOrders[i]);
+    dir->SetNumberOfThreads(1);
+    dir->Update();
+    TestAssert(dir->GetErrorCode() == 0);
+    TestAssert(Summarize(dir) == expected);
+    dir->SetNumberOfThreads(4);
+    dir->Update();
+    TestAssert(dir->GetErrorCode() == 0);
+    TestAssert(Summarize(dir) == expected);
+  }
+  }
+
+  { // repeated queries with KeepIndex must match a fresh scan
+  vtkSmartPointer<vtkDICOMDirectory> indexed =
+    vtkSmartPointer<vtkDICOMDirectory>::New();
+  indexed->SetDirectoryName(dirname.c_str());
+  indexed->SetScanDepth(4);
+  indexed->RequirePixelDataOff();
+  indexed->KeepIndexOn();
+  indexed->Update();
+  TestAssert(indexed->GetErrorCode() == 0);
+  TestAssert(Summarize(indexed) == expected);
+
+  for (int i = 0; i < 6; i++)
+  {
+    vtkDICOMItem query;
+    int level = vtkDICOMDirectory::SERIES;
+    switch (i)
+    {
+      case 0: // patient level
+        query.Set(DC::PatientName, "Test^One");
+        break;
+      case 1: // an index tag
+        query.Set(DC::PatientID, "Two");
+        break;
+      case 2: // series level
+        query.Set(DC::SeriesNumber, 3);
+        break;
+      case 3: // image level, not an index tag but in the image records
+        query.Set(DC::InstanceNumber, 1);
+        level = vtkDICOMDirectory::IMAGE;
+        break;
+      case 4: // image level, for a series find
+        query.Set(DC::InstanceNumber, 3);
+        break;
+      case 5: // no matches
+        query.Set(DC::PatientName, "Nobody");
+        break;
+    }
+
+    indexed->SetFindQuery(query);
+    indexed->SetFindLevel(level);
+    indexed->Update();
+    TestAssert(indexed->GetErrorCode() == 0);
+    // these are all answered from the index, without reading files
+    TestAssert(indexed->GetNumberOfReads() == 0);
+
+    vtkSmartPointer<vtkDICOMDirectory> fresh =
+      vtkSmartPointer<vtkDICOMDirectory>::New();
+    fresh->SetDirectoryName(dirname.c_str());
+    fresh->SetScanDepth(4);
+    fresh->RequirePixelDataOff();
+    fresh->SetFindQuery(query);
+    fresh->SetFindLevel(level);
+    fresh->Update();
+    TestAssert(fresh->GetErrorCode() == 0);
+    TestAssert(fresh->GetNumberOfReads() >= numberOfFiles);
+
+    // some series attributes differ between the files in a series, so for
+    // an image-level find, they depend on which file matched first
+    TestAssert(Summarize(indexed, false) == Summarize(fresh, false));
+    TestAssert(i == 5 || fresh->GetNumberOfSeries() > 0);
+  }
+  }
+
+  return rval;
+}
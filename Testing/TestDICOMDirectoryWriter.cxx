@@ -0,0 +1,299 @@
+#include "TestDICOMHelpers.h"
+
+#include "vtkDICOMDirectoryWriter.h"
+#include "vtkDICOMDirectory.h"
+#include "vtkDICOMParser.h"
+#include "vtkDICOMMetaData.h"
+#include "vtkDICOMSequence.h"
+#include "vtkDICOMItem.h"
+#include "vtkDICOMUtilities.h"
+
+#include "vtkStringArray.h"
+#include "vtkSmartPointer.h"
+
+#include <sstream>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <set>
+
+#include <string.h>
+#include <stdlib.h>
+
+// macro for performing tests
+#define TestAssert(t) \
+if (!(t)) \
+{ \
+  cout << exename << ": Assertion Failed: " << #t << "\n"; \
+  cout << __FILE__ << ":" << __LINE__ << "\n"; \
+  cout.flush(); \
+  rval |= 1; \
+}
+
+// the series that are written: patient, study, number of files
+struct SeriesInfo
+{
+  const char *PatientName;
+  int Study;
+  int NumberOfFiles;
+};
+
+static const SeriesInfo TestSeries[] = {
+  { "Test^One", 0, 3 },
+  { "Test^One", 0, 2 },
+  { "Test^Two", 1, 4 },
+  { 0, 0, 0 }
+};
+
+// get all of the file names that a vtkDICOMDirectory found
+static std::vector<std::string> GetAllFileNames(vtkDICOMDirectory *dir)
+{
+  std::vector<std::string> names;
+  for (int i = 0; i < dir->GetNumberOfSeries(); i++)
+  {
+    vtkStringArray *sa = dir->GetFileNamesForSeries(i);
+    for (vtkIdType j = 0; j < sa->GetNumberOfValues(); j++)
+    {
+      names.push_back(vtkDICOMFilePath(sa->GetValue(j)).GetRealPath());
+    }
+  }
+  std::sort(names.begin(), names.end());
+  return names;
+}
+
+int main(int argc, char *argv[])
+{
+  int rval = 0;
+  const char *exename = TestExeName(argc, argv, "TestDICOMDirectoryWriter");
+
+  // the directory for the files, removed when the test is done
+  TestDirectory testdir(argc, argv, "TestDICOMDirectoryWriter_files");
+  const std::string& dirname = testdir.GetName();
+  vtkDICOMFilePath dirpath(dirname);
+  std::string dicomdir = dirpath.Join("DICOMDIR");
+
+  // write a few series without pixel data
+  std::string studyUIDs[2];
+  studyUIDs[0] = vtkDICOMUtilities::GenerateUID(DC::StudyInstanceUID);
+  studyUIDs[1] = vtkDICOMUtilities::GenerateUID(DC::StudyInstanceUID);
+  int numberOfFiles = 0;
+  int numberOfSeries = 0;
+  for (const SeriesInfo *info = TestSeries; info->PatientName; info++)
+  {
+    std::string seriesUID =
+      vtkDICOMUtilities::GenerateUID(DC::SeriesInstanceUID);
+    for (int i = 0; i < info->NumberOfFiles; i++)
+    {
+      vtkSmartPointer<vtkDICOMMetaData> meta =
+        vtkSmartPointer<vtkDICOMMetaData>::New();
+      meta->Set(DC::SOPClassUID, "1.2.840.10008.5.1.4.1.1.4");
+      meta->Set(DC::PatientName, info->PatientName);
+      meta->Set(DC::PatientID, info->PatientName + 5);
+      meta->Set(DC::StudyInstanceUID, studyUIDs[info->Study]);
+      meta->Set(DC::SeriesInstanceUID, seriesUID);
+      meta->Set(DC::SOPInstanceUID,
+                vtkDICOMUtilities::GenerateUID(DC::SOPInstanceUID));
+      meta->Set(DC::Modality, "MR");
+      meta->Set(DC::SeriesNumber, numberOfSeries + 1);
+      meta->Set(DC::InstanceNumber, i + 1);
+
+      // the names must be valid ReferencedFileID components, and the
+      // second patient's files are in a subdirectory
+      std::ostringstream fname;
+      fname << "IM" << numberOfSeries << "_" << i;
+      std::string filename = dirpath.Join(fname.str());
+      if (info->Study == 1)
+      {
+        vtkDICOMFilePath subpath(dirpath);
+        subpath.PushBack("P2");
+        vtkDICOMFileDirectory::Create(subpath.AsString().c_str());
+        filename = subpath.Join(fname.str());
+      }
+      TestAssert(TestWriteFile(filename, meta));
+      numberOfFiles++;
+    }
+    numberOfSeries++;
+  }
+
+  // scan the files
+  vtkSmartPointer<vtkDICOMDirectory> scanner =
+    vtkSmartPointer<vtkDICOMDirectory>::New();
+  scanner->SetDirectoryName(dirname.c_str());
+  scanner->SetScanDepth(2);
+  scanner->RequirePixelDataOff();
+  scanner->IgnoreDicomdirOn();
+  scanner->Update();
+  TestAssert(scanner->GetErrorCode() == 0);
+  TestAssert(scanner->GetNumberOfPatients() == 2);
+  TestAssert(scanner->GetNumberOfStudies() == 2);
+  TestAssert(scanner->GetNumberOfSeries() == numberOfSeries);
+  std::vector<std::string> scannedNames = GetAllFileNames(scanner);
+  TestAssert(static_cast<int>(scannedNames.size()) == numberOfFiles);
+
+  // write the DICOMDIR
+  vtkSmartPointer<vtkDICOMDirectoryWriter> writer =
+    vtkSmartPointer<vtkDICOMDirectoryWriter>::New();
+  writer->SetFileName(dicomdir.c_str());
+  writer->SetFileSetID("TESTSET");
+  writer->AddDirectory(scanner);
+  TestAssert(writer->GetNumberOfSeries() == numberOfSeries);
+  writer->Write();
+  TestAssert(writer->GetErrorCode() == 0);
+
+  { // check the offsets in the DICOMDIR against the parsed items
+  vtkSmartPointer<vtkDICOMMetaData> meta =
+    vtkSmartPointer<vtkDICOMMetaData>::New();
+  vtkSmartPointer<vtkDICOMParser> parser =
+    vtkSmartPointer<vtkDICOMParser>::New();
+  parser->SetFileName(dicomdir.c_str());
+  parser->SetMetaData(meta);
+  parser->Update();
+  TestAssert(parser->GetErrorCode() == 0);
+  TestAssert(meta->Get(DC::FileSetID).AsString() == "TESTSET");
+
+  const vtkDICOMValue& seq = meta->Get(DC::DirectoryRecordSequence);
+  const vtkDICOMItem *items = seq.GetSequenceData();
+  unsigned int n = static_cast<unsigned int>(seq.GetNumberOfValues());
+  // patients, studies, series, and images
+  TestAssert(n == static_cast<unsigned int>(
+    2 + 2 + numberOfSeries + numberOfFiles));
+
+  std::set<unsigned int> offsets;
+  for (unsigned int i = 0; i < n; i++)
+  {
+    offsets.insert(items[i].GetByteOffset());
+  }
+  TestAssert(offsets.size() == n);
+
+  // the root offsets must refer to the first and last patient
+  unsigned int first = meta->Get(
+    DC::OffsetOfTheFirstDirectoryRecordOfTheRootDirectoryEntity)
+    .AsUnsignedInt();
+  unsigned int last = meta->Get(
+    DC::OffsetOfTheLastDirectoryRecordOfTheRootDirectoryEntity)
+    .AsUnsignedInt();
+  TestAssert(n > 0 && first == items[0].GetByteOffset());
+  TestAssert(offsets.find(last) != offsets.end());
+
+  // every offset in a record must refer to a record, and the records
+  // must be written in order, with each one above its children
+  int images = 0;
+  for (unsigned int i = 0; i < n; i++)
+  {
+    std::string recordType =
+      items[i].Get(DC::DirectoryRecordType).AsString();
+    unsigned int next =
+      items[i].Get(DC::OffsetOfTheNextDirectoryRecord).AsUnsignedInt();
+    unsigned int lower = items[i].Get(
+      DC::OffsetOfReferencedLowerLevelDirectoryEntity).AsUnsignedInt();
+    TestAssert(next == 0 || offsets.find(next) != offsets.end());
+    TestAssert(next == 0 || next > items[i].GetByteOffset());
+    if (recordType == "IMAGE")
+    {
+      TestAssert(lower == 0);
+      TestAssert(items[i].Get(DC::ReferencedFileID).IsValid());
+      TestAssert(items[i].Get(DC::ReferencedTransferSyntaxUIDInFile)
+                 .IsValid());
+      images++;
+    }
+    else
+    {
+      // the child is the record that follows this one
+      TestAssert(i + 1 < n && lower == items[i + 1].GetByteOffset());
+    }
+    if (recordType == "PATIENT" && next == 0)
+    {
+      TestAssert(last == items[i].GetByteOffset());
+    }
+  }
+  TestAssert(images == numberOfFiles);
+  }
+
+  { // read the DICOMDIR back with vtkDICOMDirectory
+  vtkSmartPointer<vtkDICOMDirectory> reader =
+    vtkSmartPointer<vtkDICOMDirectory>::New();
+  reader->SetDirectoryName(dirname.c_str());
+  reader->SetScanDepth(2);
+  reader->RequirePixelDataOff();
+  reader->Update();
+  TestAssert(reader->GetErrorCode() == 0);
+  TestAssert(reader->GetFileSetID() != 0 &&
+             strcmp(reader->GetFileSetID(), "TESTSET") == 0);
+  TestAssert(reader->GetNumberOfPatients() == 2);
+  TestAssert(reader->GetNumberOfStudies() == 2);
+  TestAssert(reader->GetNumberOfSeries() == numberOfSeries);
+  for (int i = 0; i < reader->GetNumberOfSeries(); i++)
+  {
+    TestAssert(reader->GetFileNamesForSeries(i)->GetNumberOfValues() ==
+               scanner->GetFileNamesForSeries(i)->GetNumberOfValues());
+  }
+  TestAssert(GetAllFileNames(reader) == scannedNames);
+
+  // only the DICOMDIR was read, and it was read completely
+  vtkDICOMFile infile(dicomdir.c_str(), vtkDICOMFile::In);
+  TestAssert(reader->GetNumberOfReads() > 0);
+  TestAssert(reader->GetNumberOfBytesRead() ==
+             static_cast<vtkTypeInt64>(infile.GetSize()));
+  }
+
+  { // files with empty names are left out, and a series with no files
+    // is left out completely
+  vtkSmartPointer<vtkDICOMDirectoryWriter> partial =
+    vtkSmartPointer<vtkDICOMDirectoryWriter>::New();
+  partial->SetFileName(dicomdir.c_str());
+  for (int i = 0; i < scanner->GetNumberOfSeries(); i++)
+  {
+    vtkSmartPointer<vtkStringArray> names =
+      vtkSmartPointer<vtkStringArray>::New();
+    scanner->GetFileNamesForSeries(i, names);
+    for (vtkIdType j = 0; j < names->GetNumberOfValues(); j++)
+    {
+      if (i == 1 || j == 0)
+      {
+        names->SetValue(j, "");
+      }
+    }
+    partial->AddSeries(scanner, i, names);
+  }
+  partial->Write();
+  TestAssert(partial->GetErrorCode() == 0);
+
+  vtkSmartPointer<vtkDICOMDirectory> reader =
+    vtkSmartPointer<vtkDICOMDirectory>::New();
+  reader->SetDirectoryName(dirname.c_str());
+  reader->SetScanDepth(2);
+  reader->RequirePixelDataOff();
+  reader->Update();
+  TestAssert(reader->GetErrorCode() == 0);
+  TestAssert(reader->GetNumberOfSeries() == numberOfSeries - 1);
+  TestAssert(static_cast<int>(GetAllFileNames(reader).size()) ==
+             numberOfFiles - scanner->GetNumberOfFilesForSeries(1) -
+             (numberOfSeries - 1));
+  }
+
+  { // paths that cannot be used as a ReferencedFileID must be rejected
+  static const char *badNames[] = {
+    "im0_0",       // lower case
+    "IM0_0.DCM",   // period
+    "IM0123456",   // more than 8 characters
+    "P2/../IM0_0", // fine after the path is resolved
+    0
+  };
+  for (int i = 0; badNames[i]; i++)
+  {
+    vtkSmartPointer<vtkStringArray> names =
+      vtkSmartPointer<vtkStringArray>::New();
+    scanner->GetFileNamesForSeries(0, names);
+    names->SetValue(0, dirpath.Join(badNames[i]));
+    vtkSmartPointer<vtkDICOMDirectoryWriter> bad =
+      vtkSmartPointer<vtkDICOMDirectoryWriter>::New();
+    bad->SetFileName(dirpath.Join("DICOMBAD").c_str());
+    bad->AddSeries(scanner, 0, names);
+    bad->Write();
+    TestAssert((bad->GetErrorCode() == 0) == (badNames[i+1] == 0));
+    vtkDICOMFile::Remove(dirpath.Join("DICOMBAD").c_str());
+  }
+  }
+
+  return rval;
+}
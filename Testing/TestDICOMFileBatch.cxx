@@ -0,0 +1,195 @@
+#include "vtkDICOMFileBatch.h"
+#include "vtkDICOMFile.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <string.h>
+
+// macro for performing tests
+#define TestAssert(t) \
+if (!(t)) \
+{ \
+  cout << exename << ": Assertion Failed: " << #t << "\n"; \
+  cout << __FILE__ << ":" << __LINE__ << "\n"; \
+  cout.flush(); \
+  rval |= 1; \
+}
+
+// the sizes of the files, some are smaller than a page and some are not
+static const size_t TestSizes[] = {
+  0, 1, 100, 4095, 4096, 4097, 65536, 200003, 17, 8192, 300000, 1000
+};
+
+static const int NumberOfFiles =
+  static_cast<int>(sizeof(TestSizes)/sizeof(size_t));
+
+// the byte at a given position in a given file
+static unsigned char FileByte(int file, size_t pos)
+{
+  return static_cast<unsigned char>((pos*7 + pos/4096 + file*31) & 0xff);
+}
+
+// write a file that is filled with a known pattern
+static bool WriteFile(const std::string& filename, int file, size_t size)
+{
+  std::vector<unsigned char> data(size + 1);
+  for (size_t i = 0; i < size; i++)
+  {
+    data[i] = FileByte(file, i);
+  }
+  vtkDICOMFile outfile(filename.c_str(), vtkDICOMFile::Out);
+  if (outfile.GetError() != 0)
+  {
+    return false;
+  }
+  return (outfile.Write(&data[0], size) == size);
+}
+
+// check the data that was read from a file
+static bool CheckData(
+  const std::vector<unsigned char>& data, int file, size_t offset,
+  size_t size)
+{
+  for (size_t i = 0; i < size; i++)
+  {
+    if (data[i] != FileByte(file, offset + i))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  int rval = 0;
+  const char *exename = (argc > 0 ? argv[0] : "TestDICOMFileBatch");
+
+  // remove path portion of exename
+  const char *cp = exename + strlen(exename);
+  while (cp != exename && cp[-1] != '\\' && cp[-1] != '/') { --cp; }
+  exename = cp;
+
+  // write the files
+  std::vector<std::string> filenames;
+  for (int i = 0; i < NumberOfFiles; i++)
+  {
+    std::ostringstream fname;
+    fname << "TestDICOMFileBatch_" << i << ".dat";
+    filenames.push_back(fname.str());
+    TestAssert(WriteFile(filenames.back(), i, TestSizes[i]));
+  }
+  std::string missing = "TestDICOMFileBatch_missing.dat";
+
+  // the thread pool, then the default (io_uring, if it is available)
+  static const int backends[] = {
+    vtkDICOMFileBatch::ThreadBackend,
+    vtkDICOMFileBatch::DefaultBackend
+  };
+
+  for (int b = 0; b < 2; b++)
+  {
+    for (int depth = 1; depth <= 16; depth *= 4)
+    {
+      vtkDICOMFileBatch batch(depth, backends[b]);
+      int backend = batch.GetBackend();
+      TestAssert(batch.GetDepth() == depth);
+      TestAssert(backend == vtkDICOMFileBatch::ThreadBackend ||
+                 backend == vtkDICOMFileBatch::IOUringBackend);
+      if (backends[b] == vtkDICOMFileBatch::ThreadBackend)
+      {
+        TestAssert(backend == vtkDICOMFileBatch::ThreadBackend);
+      }
+
+      // nothing is pending yet
+      int id;
+      vtkDICOMFileBatch::Size bytesRead;
+      int error;
+      TestAssert(batch.GetNumberOfPending() == 0);
+      TestAssert(!batch.Poll(&id, &bytesRead, &error));
+      TestAssert(!batch.Wait(&id, &bytesRead, &error));
+
+      // read every file twice: the whole file (asking for more than the
+      // file holds), and then the second half of the file
+      std::vector<std::vector<unsigned char> > buffers(2*NumberOfFiles);
+      std::vector<int> done(2*NumberOfFiles);
+      int submitted = 0;
+      int completed = 0;
+      for (int i = 0; i < 2*NumberOfFiles || completed < submitted; )
+      {
+        if (i < 2*NumberOfFiles)
+        {
+          int f = i % NumberOfFiles;
+          size_t offset = (i < NumberOfFiles ? 0 : TestSizes[f]/2);
+          size_t size = TestSizes[f] - offset + 10;
+          buffers[i].resize(size);
+          if (batch.Submit(filenames[f].c_str(), offset, size,
+                           &buffers[i][0], i))
+          {
+            submitted++;
+            i++;
+            continue;
+          }
+          // the batch must only be full if "depth" reads are pending
+          TestAssert(batch.GetNumberOfPending() == depth);
+        }
+
+        TestAssert(batch.Wait(&id, &bytesRead, &error));
+        completed++;
+        TestAssert(id >= 0 && id < 2*NumberOfFiles);
+        if (id >= 0 && id < 2*NumberOfFiles)
+        {
+          int f = id % NumberOfFiles;
+          size_t offset = (id < NumberOfFiles ? 0 : TestSizes[f]/2);
+          TestAssert(done[id]++ == 0);
+          TestAssert(error == 0);
+          TestAssert(bytesRead == TestSizes[f] - offset);
+          TestAssert(CheckData(buffers[id], f, offset,
+                               TestSizes[f] - offset));
+        }
+      }
+      TestAssert(submitted == 2*NumberOfFiles);
+      TestAssert(batch.GetNumberOfPending() == 0);
+
+      // a file that does not exist
+      unsigned char tmp[16];
+      TestAssert(batch.Submit(missing.c_str(), 0, sizeof(tmp), tmp, 100));
+      batch.Flush();
+      TestAssert(batch.Wait(&id, &bytesRead, &error));
+      TestAssert(id == 100);
+      TestAssert(error == vtkDICOMFile::FileNotFound);
+      TestAssert(bytesRead == 0);
+
+      // prefetch every file, then collect the completions
+      for (int i = 0; i < NumberOfFiles; i++)
+      {
+        batch.Prefetch(filenames[i].c_str(), 0, TestSizes[i]);
+        TestAssert(batch.GetNumberOfPending() <= depth);
+      }
+      while (batch.Wait(&id, &bytesRead, &error))
+      {
+        TestAssert(error == 0);
+        TestAssert(bytesRead == 0);
+      }
+      TestAssert(batch.GetNumberOfPending() == 0);
+
+      // submit reads and then destroy the batch without waiting
+      vtkDICOMFileBatch *early = new vtkDICOMFileBatch(depth, backends[b]);
+      std::vector<unsigned char> buffer(TestSizes[7]);
+      TestAssert(early->Submit(filenames[7].c_str(), 0, TestSizes[7],
+                               &buffer[0], 0));
+      early->Flush();
+      delete early;
+    }
+  }
+
+  // remove the files
+  for (size_t i = 0; i < filenames.size(); i++)
+  {
+    vtkDICOMFile::Remove(filenames[i].c_str());
+  }
+
+  return rval;
+}
@@ -0,0 +1,112 @@
+#ifndef TestDICOMHelpers_h
+#define TestDICOMHelpers_h
+
+// Helpers for the tests that write DICOM files.
+
+#include "vtkDICOMCompiler.h"
+#include "vtkDICOMMetaData.h"
+#include "vtkDICOMFile.h"
+#include "vtkDICOMFileDirectory.h"
+#include "vtkDICOMFilePath.h"
+
+#include "vtkSmartPointer.h"
+
+#include <string>
+
+#include <string.h>
+
+// get the name of the test executable, without the path
+static const char *TestExeName(int argc, char *argv[], const char *name)
+{
+  const char *exename = (argc > 0 ? argv[0] : name);
+
+  // remove path portion of exename
+  const char *cp = exename + strlen(exename);
+  while (cp != exename && cp[-1] != '\\' && cp[-1] != '/') { --cp; }
+  return cp;
+}
+
+// write a DICOM file with the SOPInstanceUID and SeriesInstanceUID from
+// the meta data, the meta data must have an empty PixelData if "pixels"
+// is provided
+static bool TestWriteFile(
+  const std::string& filename, vtkDICOMMetaData *meta,
+  const unsigned char *pixels = 0, size_t size = 0)
+{
+  std::string instanceUID = meta->Get(DC::SOPInstanceUID).AsString();
+  std::string seriesUID = meta->Get(DC::SeriesInstanceUID).AsString();
+
+  vtkSmartPointer<vtkDICOMCompiler> compiler =
+    vtkSmartPointer<vtkDICOMCompiler>::New();
+  compiler->SetFileName(filename.c_str());
+  compiler->SetMetaData(meta);
+  compiler->SetSOPInstanceUID(instanceUID.c_str());
+  compiler->SetSeriesInstanceUID(seriesUID.c_str());
+  compiler->WriteHeader();
+  if (pixels)
+  {
+    compiler->WritePixelData(pixels, static_cast<vtkIdType>(size));
+  }
+  compiler->Close();
+  return (compiler->GetErrorCode() == 0);
+}
+
+// a directory for the files that a test writes, which is removed along
+// with everything in it when the test is done with it
+class TestDirectory
+{
+public:
+  // The directory is created within the directory given as the first
+  // argument to the test, or within the current directory.
+  TestDirectory(int argc, char *argv[], const char *name)
+  {
+    vtkDICOMFilePath path(argc > 1 ? argv[1] : ".");
+    path.PushBack(name);
+    this->Name = path.AsString();
+    TestDirectory::RemoveAll(this->Name);
+    vtkDICOMFileDirectory::Create(this->Name.c_str());
+  }
+
+  ~TestDirectory() { TestDirectory::RemoveAll(this->Name); }
+
+  // Get the directory name.
+  const std::string& GetName() const { return this->Name; }
+
+  // Get the path to a file in the directory.
+  std::string Join(const std::string& name) const
+  {
+    return vtkDICOMFilePath(this->Name).Join(name);
+  }
+
+  // Remove a directory and everything in it.
+  static void RemoveAll(const std::string& dirname)
+  {
+    vtkDICOMFileDirectory d(dirname.c_str());
+    if (d.GetError() != 0)
+    {
+      return;
+    }
+    int n = d.GetNumberOfEntries();
+    for (int i = 0; i < n; i++)
+    {
+      std::string fname = vtkDICOMFilePath(dirname).Join(d.GetEntry(i));
+      if (d.IsDirectory(i) && !d.IsSymlink(i))
+      {
+        TestDirectory::RemoveAll(fname);
+      }
+      else
+      {
+        vtkDICOMFile::Remove(fname.c_str());
+      }
+    }
+    vtkDICOMFileDirectory::Remove(dirname.c_str());
+  }
+
+private:
+  TestDirectory(const TestDirectory&);
+  void operator=(const TestDirectory&);
+
+  std::string Name;
+};
+
+#endif
@@ -0,0 +1,372 @@
+#include "TestDICOMHelpers.h"
+
+#include "vtkDICOMParser.h"
+#include "vtkDICOMMetaData.h"
+#include "vtkDICOMSequence.h"
+#include "vtkDICOMItem.h"
+#include "vtkDICOMUtilities.h"
+
+#include "vtkSmartPointer.h"
+#include "vtkCommand.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+// macro for performing tests
+#define TestAssert(t) \
+if (!(t)) \
+{ \
+  cout << exename << ": Assertion Failed: " << #t << "\n"; \
+  cout << __FILE__ << ":" << __LINE__ << "\n"; \
+  cout.flush(); \
+  rval |= 1; \
+}
+
+// the files that are written: the length of a long text attribute, the
+// number of items in a sequence, and the size of the pixel data
+struct FileInfo
+{
+  int CommentLength;
+  int NumberOfItems;
+  int Columns;
+};
+
+// the header sizes go up and down, so that the adaptive buffer size
+// is sometimes too large and sometimes too small
+static const FileInfo TestFiles[] = {
+  { 0, 0, 64 },
+  { 200000, 0, 64 },
+  { 100, 3, 0 },
+  { 30000, 0, 128 },
+  { 5000, 100, 64 },
+  { 0, 0, 0 },
+  { 70000, 1, 256 },
+  { 100, 0, 64 },
+  { -1, 0, 0 }
+};
+
+// write a file, with pixel data if columns is not zero
+static bool WriteFile(
+  const std::string& filename, const FileInfo *info)
+{
+  vtkSmartPointer<vtkDICOMMetaData> meta =
+    vtkSmartPointer<vtkDICOMMetaData>::New();
+  meta->Set(DC::SOPClassUID, "1.2.840.10008.5.1.4.1.1.7");
+  meta->Set(DC::PatientName, "Test^Parser");
+  meta->Set(DC::StudyInstanceUID,
+            vtkDICOMUtilities::GenerateUID(DC::StudyInstanceUID));
+  meta->Set(DC::SeriesInstanceUID,
+            vtkDICOMUtilities::GenerateUID(DC::SeriesInstanceUID));
+  meta->Set(DC::SOPInstanceUID,
+            vtkDICOMUtilities::GenerateUID(DC::SOPInstanceUID));
+  meta->Set(DC::Modality, "OT");
+  meta->Set(DC::InstanceNumber, 1);
+
+  if (info->CommentLength > 0)
+  {
+    std::string comments;
+    for (int i = 0; i < info->CommentLength; i++)
+    {
+      comments.push_back(static_cast<char>('A' + i % 26));
+    }
+    meta->Set(DC::ImageComments, comments);
+  }
+
+  if (info->NumberOfItems > 0)
+  {
+    vtkDICOMSequence seq;
+    for (int i = 0; i < info->NumberOfItems; i++)
+    {
+      vtkDICOMItem item;
+      item.Set(DC::ReferencedSOPClassUID, "1.2.840.10008.5.1.4.1.1.7");
+      item.Set(DC::ReferencedSOPInstanceUID,
+               vtkDICOMUtilities::GenerateUID(DC::SOPInstanceUID));
+      seq.AddItem(item);
+    }
+    meta->Set(DC::ReferencedImageSequence, seq);
+  }
+
+  std::vector<unsigned char> pixels;
+  if (info->Columns > 0)
+  {
+    meta->Set(DC::SamplesPerPixel, 1);
+    meta->Set(DC::PhotometricInterpretation, "MONOCHROME2");
+    meta->Set(DC::Rows, info->Columns);
+    meta->Set(DC::Columns, info->Columns);
+    meta->Set(DC::BitsAllocated, 16);
+    meta->Set(DC::BitsStored, 16);
+    meta->Set(DC::HighBit, 15);
+    meta->Set(DC::PixelRepresentation, 0);
+    // add an empty PixelData to be filled in by the compiler
+    unsigned short empty = 0;
+    meta->Set(
+      DC::PixelData, vtkDICOMValue(vtkDICOMVR::OW, &empty, empty));
+    pixels.resize(2*info->Columns*info->Columns);
+    for (size_t i = 0; i < pixels.size(); i++)
+    {
+      pixels[i] = static_cast<unsigned char>(i);
+    }
+  }
+
+  return TestWriteFile(filename, meta,
+                       (pixels.empty() ? 0 : &pixels[0]), pixels.size());
+}
+
+// check that two parses of the same file stopped at the same place
+static bool SameParse(vtkDICOMParser *p1, vtkDICOMParser *p2)
+{
+  return (p1->GetErrorCode() == p2->GetErrorCode() &&
+          p1->GetFileIsDICOM() == p2->GetFileIsDICOM() &&
+          p1->GetPixelDataFound() == p2->GetPixelDataFound() &&
+          p1->GetFileOffset() == p2->GetFileOffset() &&
+          (!p1->GetPixelDataFound() ||
+           p1->GetPixelDataVL() == p2->GetPixelDataVL()));
+}
+
+// check that two parses of the same file gave the same results
+static bool SameResults(
+  vtkDICOMParser *p1, vtkDICOMMetaData *m1,
+  vtkDICOMParser *p2, vtkDICOMMetaData *m2)
+{
+  if (!SameParse(p1, p2))
+  {
+    return false;
+  }
+
+  if (m1->GetNumberOfDataElements() != m2->GetNumberOfDataElements())
+  {
+    return false;
+  }
+
+  vtkDICOMDataElementIterator iter1 = m1->Begin();
+  vtkDICOMDataElementIterator iter2 = m2->Begin();
+  for (; iter1 != m1->End(); ++iter1, ++iter2)
+  {
+    if (iter1->GetTag() != iter2->GetTag() ||
+        iter1->GetValue() != iter2->GetValue())
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// check that a parse with a query (p2) agrees with a full parse (p1):
+// only some of the attributes are kept, but those must be the same,
+// and every attribute in the query must be kept
+static bool SameQueryResults(
+  vtkDICOMParser *p1, vtkDICOMMetaData *m1,
+  vtkDICOMParser *p2, vtkDICOMMetaData *m2, const vtkDICOMItem& query)
+{
+  if (!SameParse(p1, p2))
+  {
+    return false;
+  }
+
+  vtkDICOMDataElementIterator iter = m2->Begin();
+  for (; iter != m2->End(); ++iter)
+  {
+    if (iter->GetValue() != m1->Get(iter->GetTag()))
+    {
+      return false;
+    }
+  }
+
+  iter = query.Begin();
+  for (; iter != query.End(); ++iter)
+  {
+    if (m2->Get(iter->GetTag()) != m1->Get(iter->GetTag()))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// an observer that keeps the items that are streamed by the parser
+class ItemObserver : public vtkCommand
+{
+public:
+  static ItemObserver *New() { return new ItemObserver; }
+  vtkTypeMacro(ItemObserver,vtkCommand);
+
+#ifdef VTK_OVERRIDE
+  void Execute(vtkObject *, unsigned long, void *data) VTK_OVERRIDE;
+#else
+  void Execute(vtkObject *, unsigned long, void *data);
+#endif
+
+  std::vector<vtkDICOMItem> Items;
+
+protected:
+  ItemObserver() {}
+};
+
+void ItemObserver::Execute(vtkObject *, unsigned long, void *data)
+{
+  this->Items.push_back(*static_cast<vtkDICOMItem *>(data));
+}
+
+int main(int argc, char *argv[])
+{
+  int rval = 0;
+  const char *exename = TestExeName(argc, argv, "TestDICOMParser");
+
+  // the directory for the files, removed when the test is done
+  TestDirectory dir(argc, argv, "TestDICOMParser_files");
+
+  // write the files
+  std::vector<std::string> filenames;
+  for (const FileInfo *info = TestFiles; info->CommentLength >= 0; info++)
+  {
+    std::ostringstream fname;
+    fname << "IM" << filenames.size() << ".dcm";
+    filenames.push_back(dir.Join(fname.str()));
+    TestAssert(WriteFile(filenames.back(), info));
+  }
+
+  // try the smallest buffer size, and the default buffer size
+  static const int bufferSizes[] = { 256, 8192 };
+  for (int k = 0; k < 2; k++)
+  {
+    vtkSmartPointer<vtkDICOMMetaData> meta1 =
+      vtkSmartPointer<vtkDICOMMetaData>::New();
+    vtkSmartPointer<vtkDICOMParser> parser1 =
+      vtkSmartPointer<vtkDICOMParser>::New();
+    parser1->SetMetaData(meta1);
+    parser1->SetBufferSize(bufferSizes[k]);
+
+    // the same parser is used for every file, so that its estimate
+    // of the header size is carried from one file to the next
+    vtkSmartPointer<vtkDICOMMetaData> meta2 =
+      vtkSmartPointer<vtkDICOMMetaData>::New();
+    vtkSmartPointer<vtkDICOMParser> parser2 =
+      vtkSmartPointer<vtkDICOMParser>::New();
+    parser2->SetMetaData(meta2);
+    parser2->SetBufferSize(bufferSizes[k]);
+    parser2->SetAdaptiveBufferSize(true);
+
+    // queries that every file matches, and that no file matches, with
+    // the adaptive buffer size (as used by vtkDICOMDirectory)
+    vtkDICOMItem query;
+    query.Set(DC::PatientName, "Test^Parser");
+    query.Set(DC::Modality, "OT");
+    query.Set(DC::InstanceNumber, 1);
+    vtkDICOMItem badQuery;
+    badQuery.Set(DC::Modality, "CT");
+
+    vtkSmartPointer<vtkDICOMMetaData> meta3 =
+      vtkSmartPointer<vtkDICOMMetaData>::New();
+    vtkSmartPointer<vtkDICOMParser> parser3 =
+      vtkSmartPointer<vtkDICOMParser>::New();
+    parser3->SetMetaData(meta3);
+    parser3->SetBufferSize(bufferSizes[k]);
+    parser3->SetAdaptiveBufferSize(true);
+    parser3->SetQueryItem(query);
+
+    vtkSmartPointer<vtkDICOMMetaData> meta4 =
+      vtkSmartPointer<vtkDICOMMetaData>::New();
+    vtkSmartPointer<vtkDICOMParser> parser4 =
+      vtkSmartPointer<vtkDICOMParser>::New();
+    parser4->SetMetaData(meta4);
+    parser4->SetBufferSize(bufferSizes[k]);
+    parser4->SetAdaptiveBufferSize(true);
+    parser4->SetQueryItem(badQuery);
+
+    // read the files twice, to go through them with a warm estimate
+    size_t n = filenames.size();
+    for (size_t i = 0; i < 2*n; i++)
+    {
+      const char *filename = filenames[i % n].c_str();
+      meta1->Clear();
+      parser1->SetFileName(filename);
+      parser1->Update();
+      meta2->Clear();
+      parser2->SetFileName(filename);
+      parser2->Update();
+      TestAssert(parser1->GetErrorCode() == 0);
+      TestAssert(parser1->GetFileIsDICOM());
+      TestAssert(meta1->Has(DC::SOPInstanceUID));
+      TestAssert(SameResults(parser1, meta1, parser2, meta2));
+
+      // every byte up to the pixel data was read, and no more reads
+      // were needed than with the fixed buffer size
+      vtkTypeInt64 fileSize = parser1->GetFileSize();
+      vtkTypeInt64 headerSize = (parser1->GetPixelDataFound() ?
+                                 parser1->GetFileOffset() : fileSize);
+      TestAssert(parser1->GetNumberOfReads() > 0);
+      TestAssert(parser1->GetNumberOfBytesRead() >= headerSize);
+      TestAssert(parser1->GetNumberOfBytesRead() <= fileSize);
+      TestAssert(parser2->GetNumberOfBytesRead() >= headerSize);
+      TestAssert(parser2->GetNumberOfBytesRead() <= fileSize);
+      TestAssert(parser2->GetNumberOfReads() <=
+                 parser1->GetNumberOfReads());
+
+      // a query that matches must give the same results as a full parse
+      meta3->Clear();
+      parser3->SetFileName(filename);
+      parser3->Update();
+      TestAssert(parser3->GetQueryMatched());
+      TestAssert(SameQueryResults(parser1, meta1, parser3, meta3, query));
+      TestAssert(parser3->GetNumberOfReads() > 0);
+      TestAssert(parser3->GetNumberOfBytesRead() <= fileSize);
+
+      // a query that fails can stop early, but never reads more
+      meta4->Clear();
+      parser4->SetFileName(filename);
+      parser4->Update();
+      TestAssert(parser4->GetErrorCode() == 0);
+      TestAssert(!parser4->GetQueryMatched());
+      TestAssert(parser4->GetNumberOfReads() > 0);
+      TestAssert(parser4->GetNumberOfBytesRead() <=
+                 parser2->GetNumberOfBytesRead());
+    }
+  }
+
+  // stream the items of a sequence, instead of storing them
+  for (size_t i = 0; i < filenames.size(); i++)
+  {
+    vtkSmartPointer<vtkDICOMMetaData> meta1 =
+      vtkSmartPointer<vtkDICOMMetaData>::New();
+    vtkSmartPointer<vtkDICOMParser> parser1 =
+      vtkSmartPointer<vtkDICOMParser>::New();
+    parser1->SetMetaData(meta1);
+    parser1->SetFileName(filenames[i].c_str());
+    parser1->Update();
+
+    vtkSmartPointer<vtkDICOMMetaData> meta2 =
+      vtkSmartPointer<vtkDICOMMetaData>::New();
+    vtkSmartPointer<vtkDICOMParser> parser2 =
+      vtkSmartPointer<vtkDICOMParser>::New();
+    vtkSmartPointer<ItemObserver> observer =
+      vtkSmartPointer<ItemObserver>::New();
+    parser2->AddObserver(vtkDICOMParser::SequenceItemEvent, observer);
+    parser2->SetStreamingTag(DC::ReferencedImageSequence);
+    parser2->SetMetaData(meta2);
+    parser2->SetBufferSize(256);
+    parser2->SetFileName(filenames[i].c_str());
+    parser2->Update();
+    TestAssert(parser2->GetErrorCode() == 0);
+
+    // the items were streamed in order, and were not stored
+    const vtkDICOMValue& seq = meta1->Get(DC::ReferencedImageSequence);
+    size_t m = seq.GetNumberOfValues();
+    TestAssert(observer->Items.size() == m);
+    for (size_t j = 0; j < m && j < observer->Items.size(); j++)
+    {
+      const vtkDICOMItem& item = seq.GetSequenceData()[j];
+      TestAssert(observer->Items[j].GetByteOffset() == item.GetByteOffset());
+      TestAssert(observer->Items[j].Get(DC::ReferencedSOPInstanceUID) ==
+                 item.Get(DC::ReferencedSOPInstanceUID));
+    }
+    TestAssert(meta2->Get(DC::ReferencedImageSequence)
+                 .GetNumberOfValues() == 0);
+    TestAssert(meta2->Get(DC::SOPInstanceUID) ==
+               meta1->Get(DC::SOPInstanceUID));
+  }
+
+  return rval;
+}
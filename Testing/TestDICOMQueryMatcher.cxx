@@ -0,0 +1,176 @@
+#include "vtkDICOMQueryMatcher.h"
+#include "vtkDICOMItem.h"
+#include "vtkDICOMSequence.h"
+#include "vtkDICOMValue.h"
+
+#include <string.h>
+#include <stdlib.h>
+
+// macro for performing tests
+#define TestAssert(t) \
+if (!(t)) \
+{ \
+  cout << exename << ": Assertion Failed: " << #t << "\n"; \
+  cout << __FILE__ << ":" << __LINE__ << "\n"; \
+  cout.flush(); \
+  rval |= 1; \
+}
+
+// a query value, and the values to check against it
+struct MatchCase
+{
+  vtkDICOMVR VR;
+  const char *Query;
+  const char *Values[6];
+};
+
+static const MatchCase MatchCases[] = {
+  { vtkDICOMVR::CS, "HELLO",
+    { "HELLO", "HEL", "HELLO\\THERE", "THERE", "", 0 } },
+  { vtkDICOMVR::CS, "H*?LLO",
+    { "HELLO", "HLLO", "HELLO ", "THERE\\HELLO", 0 } },
+  { vtkDICOMVR::CS, "HELLO\\THER",
+    { "HELLO\\THERE", "THER\\HELLO", "HELLO", 0 } },
+  { vtkDICOMVR::LO, "Head*",
+    { "Head First", "head first", "Neck", 0 } },
+  { vtkDICOMVR::UI, "10.3000.10.6\\10.3000.11.6",
+    { "10.3000.11.6", "10.3000.10.6", "10.3000.11.7", "10.3000.11", 0 } },
+  { vtkDICOMVR::UI, "1.2.3",
+    { "1.2.3", "1.2.3\\1.2.4", "1.2.4\\1.2.3", "1.2", "", 0 } },
+  { vtkDICOMVR::IS, "6\\10",
+    { "5\\6\\10", "10\\6", "6", 0 } },
+  { vtkDICOMVR::UT, "HELLO\\THERE",
+    { "HELLO\\THERE", "HELLO", 0 } },
+  { vtkDICOMVR::DA, "20070124-20080124",
+    { "20070125", "20070124", "20080124", "20080125", "2007", 0 } },
+  { vtkDICOMVR::DA, "-20070126",
+    { "20070125", "20070127", 0 } },
+  { vtkDICOMVR::DA, "2007",
+    { "20070125", "20080125", 0 } },
+  { vtkDICOMVR::DA, "2007*",
+    { "20070125", "20080125", 0 } },
+  { vtkDICOMVR::TM, "0800-1146",
+    { "114501.00", "075959", "1146", "1147", 0 } },
+  { vtkDICOMVR::DT, "20070124120000-0500",
+    { "20070124120000", "20070124120001", 0 } },
+  { vtkDICOMVR::DT, "20070124-20070125",
+    { "20070124120000", "20070126120000", 0 } },
+  { vtkDICOMVR::PN, "smith^j*",
+    { "SMITH^JOHN", "Smith^Jane^Q", "SMYTHE^JOHN", "DOE^J\\SMITH^JO", 0 } },
+  { vtkDICOMVR::PN, "Doe\\Smith",
+    { "DOE^JOHN", "smith", "Jones", 0 } },
+  { vtkDICOMVR::PN, "",
+    { "DOE^JOHN", "", 0 } },
+  { vtkDICOMVR::SH, "*",
+    { "anything", "", 0 } },
+  { vtkDICOMVR::SH, "A?C",
+    { "ABC", "AC", "ABBC", 0 } },
+};
+
+int main(int argc, char *argv[])
+{
+  int rval = 0;
+  const char *exename = (argc > 0 ? argv[0] : "TestDICOMQueryMatcher");
+
+  // remove path portion of exename
+  const char *cp = exename + strlen(exename);
+  while (cp != exename && cp[-1] != '\\' && cp[-1] != '/') { --cp; }
+  exename = cp;
+
+  { // test that results are identical to vtkDICOMValue::Matches()
+  vtkDICOMTag tag(0x0009, 0x1010);
+  vtkDICOMQueryMatcher matcher;
+  TestAssert(matcher.IsEmpty());
+  size_t n = sizeof(MatchCases)/sizeof(MatchCase);
+  for (size_t i = 0; i < n; i++)
+  {
+    const MatchCase& mc = MatchCases[i];
+    vtkDICOMValue u(mc.VR, mc.Query);
+    vtkDICOMItem query;
+    query.Set(tag, u);
+    matcher.SetQuery(query);
+    for (int j = 0; mc.Values[j] != 0; j++)
+    {
+      vtkDICOMValue v(mc.VR, mc.Values[j]);
+      bool expected = v.Matches(u);
+      bool matched = matcher.Matches(tag, v);
+      TestAssert(matched == expected);
+      if (matched != expected)
+      {
+        cout << "query \"" << mc.Query << "\" value \""
+             << mc.Values[j] << "\"\n";
+      }
+    }
+    // a null value only matches universal keys
+    TestAssert(matcher.Matches(tag, vtkDICOMValue()) ==
+               vtkDICOMValue().Matches(u));
+    // a value with the wrong VR never matches
+    TestAssert(!matcher.Matches(tag, vtkDICOMValue(vtkDICOMVR::US, 1)) ||
+               u.GetVL() == 0);
+  }
+  }
+
+  { // test queries with several keys
+  vtkDICOMItem query;
+  query.Set(DC::SpecificCharacterSet, "ISO_IR 100");
+  query.Set(DC::Modality, "MR");
+  query.Set(DC::PatientName, "DOE*");
+  query.Set(DC::StudyDate, "20010101-");
+  query.Set(DC::Rows, 256);
+  query.Set(DC::SeriesDescription, "");
+  vtkDICOMQueryMatcher matcher;
+  matcher.SetQuery(query);
+  TestAssert(!matcher.IsEmpty());
+
+  vtkDICOMItem item;
+  item.Set(DC::SpecificCharacterSet, "ISO_IR 100");
+  item.Set(DC::Modality, "MR");
+  item.Set(DC::PatientName, "Doe^John");
+  item.Set(DC::StudyDate, "20150315");
+  item.Set(DC::Rows, 256);
+  item.Set(DC::SeriesDescription, "Sag T1");
+  TestAssert(matcher.Matches(DC::Modality, item.Get(DC::Modality)));
+  TestAssert(matcher.Matches(DC::PatientName, item.Get(DC::PatientName)));
+  TestAssert(matcher.Matches(DC::StudyDate, item.Get(DC::StudyDate)));
+  TestAssert(matcher.Matches(DC::Rows, item.Get(DC::Rows)));
+  TestAssert(matcher.Matches(
+    DC::SeriesDescription, item.Get(DC::SeriesDescription)));
+  // tags that are not in the query always match
+  TestAssert(matcher.Matches(DC::StudyTime, vtkDICOMValue()));
+
+  TestAssert(!matcher.Matches(
+    DC::Modality, vtkDICOMValue(vtkDICOMVR::CS, "US")));
+  TestAssert(!matcher.Matches(
+    DC::StudyDate, vtkDICOMValue(vtkDICOMVR::DA, "19991231")));
+  TestAssert(!matcher.Matches(DC::Rows, vtkDICOMValue(vtkDICOMVR::US, 512)));
+  TestAssert(!matcher.Matches(DC::PatientName, vtkDICOMValue()));
+
+  matcher.Clear();
+  TestAssert(matcher.IsEmpty());
+  TestAssert(matcher.Matches(
+    DC::Modality, vtkDICOMValue(vtkDICOMVR::CS, "US")));
+  }
+
+  { // test sequence keys, which use the default method
+  vtkDICOMItem qitem;
+  qitem.Set(DC::CodeValue, "T-A*");
+  vtkDICOMSequence qseq(1);
+  qseq.SetItem(0, qitem);
+  vtkDICOMItem query;
+  query.Set(DC::AnatomicRegionSequence, qseq);
+  vtkDICOMQueryMatcher matcher;
+  matcher.SetQuery(query);
+
+  vtkDICOMItem vitem;
+  vitem.Set(DC::CodeValue, "T-A0100");
+  vtkDICOMSequence vseq(1);
+  vseq.SetItem(0, vitem);
+  TestAssert(matcher.Matches(DC::AnatomicRegionSequence, vseq));
+  vitem.Set(DC::CodeValue, "T-D1100");
+  vtkDICOMSequence vseq2(1);
+  vseq2.SetItem(0, vitem);
+  TestAssert(!matcher.Matches(DC::AnatomicRegionSequence, vseq2));
+  }
+
+  return rval;
+}
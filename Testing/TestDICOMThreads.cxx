@@ -0,0 +1,256 @@
+#include "vtkDICOMCompiler.h"
+#include "vtkDICOMParser.h"
+#include "vtkDICOMMetaData.h"
+#include "vtkDICOMDictionary.h"
+#include "vtkDICOMDictEntry.h"
+#include "vtkDICOMUIDGenerator.h"
+#include "vtkDICOMUtilities.h"
+#include "vtkDICOMFile.h"
+
+#include "vtkMultiThreader.h"
+#include "vtkMutexLock.h"
+#include "vtkStringArray.h"
+#include "vtkSmartPointer.h"
+
+#include <sstream>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <string.h>
+#include <stdlib.h>
+
+// macro for performing tests
+#define TestAssert(t) \
+if (!(t)) \
+{ \
+  cout << exename << ": Assertion Failed: " << #t << "\n"; \
+  cout << __FILE__ << ":" << __LINE__ << "\n"; \
+  cout.flush(); \
+  rval |= 1; \
+}
+
+// the global values that are switched back and forth while the
+// other threads are using them
+static const char *Prefixes[2] = {
+  "2.25.", "1.2.840.10008.9999.7." };
+static const char *ImplementationUIDs[2] = {
+  "2.25.190146791043182537444806132342625375407", "1.2.840.10008.9999.7" };
+
+// a trivial private dictionary that is added and removed
+static const vtkDICOMDictEntry::Entry ThreadDictContents[] = {
+{ 0x0011, 0x0010, 0, vtkDICOMVR::LO, vtkDICOMVM::M1, "ThreadTestValue" },
+};
+
+static const unsigned short ThreadDictTagHashTable[] = {
+    1,     1,     0, 0x0010,
+};
+
+static const unsigned short ThreadDictKeyHashTable[] = {
+    1,     0,
+};
+
+static vtkDICOMDictionary::Dict ThreadDict = {
+"THREADTEST",
+1,
+1,
+ThreadDictTagHashTable,
+ThreadDictKeyHashTable,
+ThreadDictContents
+};
+
+// the information that is shared by the threads
+struct ThreadData
+{
+  const char *exename;
+  int iterations;
+  vtkSimpleMutexLock *lock;
+  std::vector<std::string> uids;
+  int rval;
+};
+
+// check whether a string is one of the two allowed values
+static bool IsOneOf(const std::string& s, const char *values[2])
+{
+  return (s == values[0] || s == values[1]);
+}
+
+// check whether a uid begins with one of the two allowed prefixes
+static bool HasPrefix(const std::string& uid)
+{
+  for (int i = 0; i < 2; i++)
+  {
+    size_t l = strlen(Prefixes[i]);
+    if (uid.compare(0, l, Prefixes[i]) == 0 && uid.length() > l)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+static VTK_THREAD_RETURN_TYPE ThreadMethod(void *arg)
+{
+  vtkMultiThreader::ThreadInfo *info =
+    static_cast<vtkMultiThreader::ThreadInfo *>(arg);
+  ThreadData *data = static_cast<ThreadData *>(info->UserData);
+  int threadId = info->ThreadID;
+  const char *exename = data->exename;
+  int rval = 0;
+
+  std::ostringstream fname;
+  fname << "TestDICOMThreads_" << threadId << ".dcm";
+  std::string filename = fname.str();
+
+  std::vector<std::string> uids;
+  vtkDICOMTag ptag(0x0011, 0x0010);
+
+  for (int i = 0; i < data->iterations; i++)
+  {
+    if (threadId == 0)
+    {
+      // change the global state while the other threads are using it
+      int j = (i & 1);
+      vtkDICOMUtilities::SetUIDPrefix(Prefixes[j]);
+      vtkDICOMUtilities::SetImplementationClassUID(ImplementationUIDs[j]);
+      if (j == 0)
+      {
+        vtkDICOMDictionary::AddPrivateDictionary(&ThreadDict);
+      }
+      else
+      {
+        vtkDICOMDictionary::RemovePrivateDictionary(ThreadDict.Name);
+      }
+      if ((i & 3) == 0)
+      {
+        vtkDICOMUIDGenerator::SetDefault(NULL);
+      }
+    }
+
+    // the global strings must always be one value or the other
+    TestAssert(IsOneOf(vtkDICOMUtilities::GetUIDPrefix(), Prefixes));
+    TestAssert(IsOneOf(
+      vtkDICOMUtilities::GetImplementationClassUID(), ImplementationUIDs));
+
+    // the private dictionary is either present or absent
+    vtkDICOMDictEntry e =
+      vtkDICOMDictionary::FindDictEntry(ptag, "THREADTEST");
+    TestAssert(!e.IsValid() || strcmp(e.GetName(), "ThreadTestValue") == 0);
+    e = vtkDICOMDictionary::FindDictEntry("ThreadTestValue", "THREADTEST");
+    TestAssert(!e.IsValid() || e.GetTag() == ptag);
+
+    // generate uids with the default generator
+    std::string uid = vtkDICOMUtilities::GenerateUID(DC::StudyInstanceUID);
+    vtkSmartPointer<vtkStringArray> series =
+      vtkSmartPointer<vtkStringArray>::New();
+    series->SetNumberOfValues(2);
+    vtkDICOMUtilities::GenerateUIDs(DC::SOPInstanceUID, series);
+    std::string instanceUID = series->GetValue(0);
+    std::string seriesUID = series->GetValue(1);
+    TestAssert(HasPrefix(uid));
+    TestAssert(HasPrefix(instanceUID));
+    TestAssert(HasPrefix(seriesUID));
+    uids.push_back(uid);
+    uids.push_back(instanceUID);
+    uids.push_back(seriesUID);
+
+    // write a file with the compiler
+    vtkSmartPointer<vtkDICOMMetaData> meta =
+      vtkSmartPointer<vtkDICOMMetaData>::New();
+    meta->Set(DC::SOPClassUID, "1.2.840.10008.5.1.4.1.1.4");
+    meta->Set(DC::StudyInstanceUID, uid);
+    meta->Set(DC::SeriesInstanceUID, seriesUID);
+    meta->Set(DC::SOPInstanceUID, instanceUID);
+    meta->Set(DC::PatientName, "Thread^Test");
+    meta->Set(vtkDICOMTag(0x0011, 0x0010),
+              vtkDICOMValue(vtkDICOMVR::LO, "THREADTEST"));
+    meta->Set(vtkDICOMTag(0x0011, 0x1010),
+              vtkDICOMValue(vtkDICOMVR::LO, "Value"));
+
+    vtkSmartPointer<vtkDICOMCompiler> compiler =
+      vtkSmartPointer<vtkDICOMCompiler>::New();
+    compiler->SetFileName(filename.c_str());
+    compiler->SetMetaData(meta);
+    compiler->SetSOPInstanceUID(instanceUID.c_str());
+    compiler->SetSeriesInstanceUID(seriesUID.c_str());
+    compiler->WriteHeader();
+    compiler->Close();
+    TestAssert(compiler->GetErrorCode() == 0);
+
+    // read the file back with the parser
+    vtkSmartPointer<vtkDICOMMetaData> meta2 =
+      vtkSmartPointer<vtkDICOMMetaData>::New();
+    vtkSmartPointer<vtkDICOMParser> parser =
+      vtkSmartPointer<vtkDICOMParser>::New();
+    parser->SetFileName(filename.c_str());
+    parser->SetMetaData(meta2);
+    parser->Update();
+    TestAssert(parser->GetErrorCode() == 0);
+    TestAssert(IsOneOf(
+      meta2->Get(DC::ImplementationClassUID).AsString(), ImplementationUIDs));
+    TestAssert(meta2->Get(DC::StudyInstanceUID).AsString() == uid);
+    TestAssert(meta2->Get(DC::SeriesInstanceUID).AsString() == seriesUID);
+    TestAssert(meta2->Get(DC::SOPInstanceUID).AsString() == instanceUID);
+    TestAssert(meta2->Get(DC::MediaStorageSOPInstanceUID).AsString() ==
+               instanceUID);
+    TestAssert(meta2->Get(vtkDICOMTag(0x0011, 0x1010)).AsString() ==
+               "Value");
+  }
+
+  vtkDICOMFile::Remove(filename.c_str());
+
+  data->lock->Lock();
+  data->uids.insert(data->uids.end(), uids.begin(), uids.end());
+  data->rval |= rval;
+  data->lock->Unlock();
+
+  return VTK_THREAD_RETURN_VALUE;
+}
+
+int main(int argc, char *argv[])
+{
+  int rval = 0;
+  const char *exename = (argc > 0 ? argv[0] : "TestDICOMThreads");
+
+  // remove path portion of exename
+  const char *cp = exename + strlen(exename);
+  while (cp != exename && cp[-1] != '\\' && cp[-1] != '/') { --cp; }
+  exename = cp;
+
+  { // run parsers, compilers, and generators on several threads
+  ThreadData data;
+  data.exename = exename;
+  data.iterations = 200;
+  data.lock = new vtkSimpleMutexLock;
+  data.rval = 0;
+
+  vtkSmartPointer<vtkMultiThreader> threader =
+    vtkSmartPointer<vtkMultiThreader>::New();
+  threader->SetNumberOfThreads(8);
+  threader->SetSingleMethod(ThreadMethod, &data);
+  threader->SingleMethodExecute();
+  int n = threader->GetNumberOfThreads();
+
+  rval |= data.rval;
+  delete data.lock;
+
+  // every uid that was generated must be unique
+  std::vector<std::string>& uids = data.uids;
+  TestAssert(uids.size() == static_cast<size_t>(3*n*data.iterations));
+  std::sort(uids.begin(), uids.end());
+  TestAssert(std::adjacent_find(uids.begin(), uids.end()) == uids.end());
+  }
+
+  // restore the global state
+  vtkDICOMUtilities::SetUIDPrefix(Prefixes[0]);
+  vtkDICOMUtilities::SetImplementationClassUID(ImplementationUIDs[0]);
+  vtkDICOMDictionary::RemovePrivateDictionary(ThreadDict.Name);
+
+  { // check that the private dictionary was removed
+  vtkDICOMDictEntry e = vtkDICOMDictionary::FindDictEntry(
+    vtkDICOMTag(0x0011, 0x0010), "THREADTEST");
+  TestAssert(!e.IsValid());
+  }
+
+  return rval;
+}
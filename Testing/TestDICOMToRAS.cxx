@@ -0,0 +1,186 @@
+#include "vtkDICOMToRAS.h"
+#include "vtkNIFTIWriter.h"
+#include "vtkNIFTIReader.h"
+#include "vtkDICOMFile.h"
+
+#include "vtkImageData.h"
+#include "vtkSmartPointer.h"
+#include "vtkVersion.h"
+
+#include <string>
+
+#include <string.h>
+
+// macro for performing tests
+#define TestAssert(t) \
+if (!(t)) \
+{ \
+  cout << exename << ": Assertion Failed: " << #t << "\n"; \
+  cout << __FILE__ << ":" << __LINE__ << "\n"; \
+  cout.flush(); \
+  rval |= 1; \
+}
+
+// the reorderings to test: columns, rows
+static const int TestReorder[][2] = {
+  { 1, 1 },
+  { 0, 1 },
+  { 1, 0 },
+  { -1, -1 }
+};
+
+// the extents of the images, the second does not start at zero
+static const int TestExtents[][6] = {
+  { 0, 63, 0, 47, 0, 22 },
+  { 3, 66, -2, 45, 1, 23 }
+};
+
+// check that the output is the input with the expected reordering
+static bool CheckReorder(
+  vtkImageData *input, vtkImageData *output, const int flip[3])
+{
+  int extent[6], outExtent[6];
+  input->GetExtent(extent);
+  output->GetExtent(outExtent);
+  if (memcmp(extent, outExtent, sizeof(extent)) != 0 ||
+      output->GetScalarType() != VTK_SHORT)
+  {
+    return false;
+  }
+
+  int size[3];
+  for (int i = 0; i < 3; i++)
+  {
+    size[i] = extent[2*i + 1] - extent[2*i] + 1;
+  }
+
+  const short *inPtr = static_cast<short *>(input->GetScalarPointer());
+  const short *outPtr = static_cast<short *>(output->GetScalarPointer());
+  for (int k = 0; k < size[2]; k++)
+  {
+    int kk = (flip[2] ? size[2] - k - 1 : k);
+    for (int j = 0; j < size[1]; j++)
+    {
+      int jj = (flip[1] ? size[1] - j - 1 : j);
+      for (int i = 0; i < size[0]; i++)
+      {
+        int ii = (flip[0] ? size[0] - i - 1 : i);
+        if (*outPtr++ != inPtr[(kk*size[1] + jj)*size[0] + ii])
+        {
+          return false;
+        }
+      }
+    }
+  }
+
+  return true;
+}
+
+// read a NIFTI file and check that it matches the image
+static bool CheckImage(const std::string& filename, vtkImageData *image)
+{
+  vtkSmartPointer<vtkNIFTIReader> reader =
+    vtkSmartPointer<vtkNIFTIReader>::New();
+  reader->SetFileName(filename.c_str());
+  reader->Update();
+  if (reader->GetErrorCode() != 0)
+  {
+    return false;
+  }
+
+  vtkImageData *output = reader->GetOutput();
+  if (output->GetNumberOfPoints() != image->GetNumberOfPoints() ||
+      output->GetScalarType() != image->GetScalarType())
+  {
+    return false;
+  }
+
+  size_t size = image->GetScalarSize();
+  size *= image->GetNumberOfPoints();
+  return (memcmp(output->GetScalarPointer(), image->GetScalarPointer(),
+                 size) == 0);
+}
+
+int main(int argc, char *argv[])
+{
+  int rval = 0;
+  const char *exename = (argc > 0 ? argv[0] : "TestDICOMToRAS");
+
+  // remove path portion of exename
+  const char *cp = exename + strlen(exename);
+  while (cp != exename && cp[-1] != '\\' && cp[-1] != '/') { --cp; }
+  exename = cp;
+
+  for (int e = 0; e < 2; e++)
+  {
+    const int *extent = TestExtents[e];
+    vtkSmartPointer<vtkImageData> image =
+      vtkSmartPointer<vtkImageData>::New();
+    image->SetExtent(extent[0], extent[1], extent[2], extent[3],
+                     extent[4], extent[5]);
+    image->SetSpacing(0.9, 0.9, 1.5);
+#if (VTK_MAJOR_VERSION > 5)
+    image->AllocateScalars(VTK_SHORT, 1);
+#else
+    image->SetScalarType(VTK_SHORT);
+    image->SetNumberOfScalarComponents(1);
+    image->AllocateScalars();
+#endif
+
+    // fill with a different value for every voxel
+    short *data = static_cast<short *>(image->GetScalarPointer());
+    vtkIdType n = image->GetNumberOfPoints();
+    for (vtkIdType i = 0; i < n; i++)
+    {
+      data[i] = static_cast<short>(i);
+    }
+
+    for (int r = 0; TestReorder[r][0] >= 0; r++)
+    {
+      // with no patient matrix, the image is axial in DICOM coords, so
+      // the rows and columns are reordered if reordering is allowed, and
+      // the slices are reordered if only one of these is reordered
+      int flip[3];
+      flip[0] = TestReorder[r][0];
+      flip[1] = TestReorder[r][1];
+      flip[2] = flip[0] ^ flip[1];
+
+      vtkSmartPointer<vtkDICOMToRAS> converter =
+        vtkSmartPointer<vtkDICOMToRAS>::New();
+#if (VTK_MAJOR_VERSION > 5)
+      converter->SetInputData(image);
+#else
+      converter->SetInput(image);
+#endif
+      converter->SetAllowColumnReordering(flip[0]);
+      converter->SetAllowRowReordering(flip[1]);
+      converter->Update();
+      TestAssert(CheckReorder(image, converter->GetOutput(), flip));
+
+      // the converted image, as a whole and through a streamed write,
+      // which updates the converter one slab of slices at a time
+      vtkSmartPointer<vtkImageData> whole =
+        vtkSmartPointer<vtkImageData>::New();
+      whole->DeepCopy(converter->GetOutput());
+
+      std::string filename = "TestDICOMToRAS_";
+      filename.push_back(static_cast<char>('a' + 4*e + r));
+      filename += ".nii";
+
+      vtkSmartPointer<vtkNIFTIWriter> writer =
+        vtkSmartPointer<vtkNIFTIWriter>::New();
+      writer->SetInputConnection(converter->GetOutputPort());
+      writer->SetFileName(filename.c_str());
+      writer->StreamingOn();
+      writer->SetMemoryLimit(
+        static_cast<vtkIdType>((3*sizeof(short)*64*48 + 1023)/1024));
+      writer->Write();
+      TestAssert(writer->GetErrorCode() == 0);
+      TestAssert(CheckImage(filename, whole));
+
+      vtkDICOMFile::Remove(filename.c_str());
+    }
+  }
+
+  return rval;
+}
@@ -110,5 +110,20 @@ int main(int argc, char *argv[])
   TestAssert(u[0] == t[0] && u[1] == t[1] && u[2] == t[2] && u[3] == t[3]);
   }
 
+  { // Test checking the first bytes of a file for DICOM
+  unsigned char b[256];
+  memset(b, 0, sizeof(b));
+  TestAssert(!DU::IsDICOMFile(b, sizeof(b)));
+  memcpy(&b[128], "DICM\2\0\0\0", 8);
+  TestAssert(DU::IsDICOMFile(b, sizeof(b)));
+  TestAssert(!DU::IsDICOMFile(b, sizeof(b) - 1));
+  memset(b, 0, sizeof(b));
+  memcpy(b, "\2\0\0\0UL\4\0", 8);
+  TestAssert(DU::IsDICOMFile(b, sizeof(b)));
+  memset(b, 0, sizeof(b));
+  memcpy(b, "\x08\0\x16\0\4\0\0\0abcd\x08\0\x18\0\4\0\0\0", 20);
+  TestAssert(DU::IsDICOMFile(b, sizeof(b)));
+  }
+
   return rval;
 }
@@ -4,6 +4,7 @@
 
 #include <sstream>
 
+#include <float.h>
 #include <string.h>
 #include <stdlib.h>
 
@@ -286,6 +287,49 @@ int main(int argc, char *argv[])
   TestAssert(u == v);
   }
 
+  { // test decoding of numerical strings
+  vtkDICOMValue v(vtkDICOMVR::DS, " 1.5\\-2e-3\\+.25\\7.\\1E+2 ");
+  TestAssert(v.GetNumberOfValues() == 5);
+  double d[5];
+  v.GetValues(d, 5);
+  TestAssert(d[0] == 1.5);
+  TestAssert(d[1] == -2e-3);
+  TestAssert(d[2] == 0.25);
+  TestAssert(d[3] == 7.0);
+  TestAssert(d[4] == 100.0);
+  // values are decoded once, and reused
+  TestAssert(v.GetDouble(1) == -2e-3);
+  TestAssert(v.GetInt(4) == 100);
+  v = vtkDICOMValue(vtkDICOMVR::DS, "0.1\\1.7976931348623157e308\\4.9e-324");
+  TestAssert(v.GetDouble(0) == 0.1);
+  TestAssert(v.GetDouble(1) == DBL_MAX);
+  TestAssert(v.GetDouble(2) > 0.0 && v.GetDouble(2) < DBL_MIN);
+  // zero with an exponent that is out of range
+  v = vtkDICOMValue(vtkDICOMVR::DS,
+                    "0E-99\\0E99\\0.0E-30\\-0E-99999\\0E+99999");
+  TestAssert(v.GetNumberOfValues() == 5);
+  double z[5];
+  v.GetValues(z, 5);
+  TestAssert(z[0] == 0.0);
+  TestAssert(z[1] == 0.0);
+  TestAssert(z[2] == 0.0);
+  TestAssert(z[3] == 0.0 && 1.0/z[3] < 0.0);
+  TestAssert(z[4] == 0.0 && 1.0/z[4] > 0.0);
+  // a value that is not a number does not affect the others
+  v = vtkDICOMValue(vtkDICOMVR::DS, "1\\\\x\\4");
+  TestAssert(v.GetDouble(0) == 1.0);
+  TestAssert(v.GetDouble(1) == 0.0);
+  TestAssert(v.GetDouble(2) == 0.0);
+  TestAssert(v.GetDouble(3) == 4.0);
+  v = vtkDICOMValue(vtkDICOMVR::IS, "-0012\\2147483647\\-2147483648\\3.9");
+  int i[4];
+  v.GetValues(i, 4);
+  TestAssert(i[0] == -12);
+  TestAssert(i[1] == 2147483647);
+  TestAssert(i[2] == -2147483647 - 1);
+  TestAssert(i[3] == 3);
+  }
+
   { // test AsString
   vtkDICOMValue v;
   v = vtkDICOMValue(vtkDICOMVR::US, "3\\2\\1");
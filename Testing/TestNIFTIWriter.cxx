@@ -0,0 +1,209 @@
+#include "vtkNIFTIWriter.h"
+#include "vtkNIFTIReader.h"
+#include "vtkDICOMFile.h"
+
+#include "vtkImageData.h"
+#include "vtkSmartPointer.h"
+#include "vtkVersion.h"
+
+#include <string>
+#include <vector>
+
+#include <string.h>
+
+// macro for performing tests
+#define TestAssert(t) \
+if (!(t)) \
+{ \
+  cout << exename << ": Assertion Failed: " << #t << "\n"; \
+  cout << __FILE__ << ":" << __LINE__ << "\n"; \
+  cout.flush(); \
+  rval |= 1; \
+}
+
+// the images that are written
+struct ImageInfo
+{
+  const char *Extension;
+  int ScalarType;
+  int NumberOfComponents;
+  int TimeDimension;
+  double QFac;
+  bool PlanarRGB;
+};
+
+static const ImageInfo TestImages[] = {
+  { ".nii", VTK_SHORT, 1, 0, 1.0, false },
+  { ".nii", VTK_SHORT, 1, 0, -1.0, false },
+  { ".nii", VTK_UNSIGNED_CHAR, 3, 0, 1.0, false },
+  { ".nii", VTK_UNSIGNED_CHAR, 3, 0, -1.0, true },
+  { ".nii", VTK_FLOAT, 4, 2, -1.0, false },
+  { ".hdr", VTK_SHORT, 2, 0, -1.0, false },
+  { ".nii.gz", VTK_SHORT, 1, 0, 1.0, false },
+  { ".nii.gz", VTK_UNSIGNED_CHAR, 3, 0, -1.0, false },
+  { 0, 0, 0, 0, 0.0, false }
+};
+
+// read a whole file into memory
+static std::vector<char> ReadFile(const char *filename)
+{
+  std::vector<char> contents;
+  vtkDICOMFile infile(filename, vtkDICOMFile::In);
+  if (infile.GetError() == 0)
+  {
+    contents.resize(static_cast<size_t>(infile.GetSize()));
+    if (!contents.empty())
+    {
+      size_t n = infile.Read(
+        reinterpret_cast<unsigned char *>(&contents[0]), contents.size());
+      contents.resize(n);
+    }
+  }
+  return contents;
+}
+
+// write an image, with or without streaming
+static bool WriteImage(
+  const std::string& filename, const ImageInfo *info,
+  vtkImageData *image, vtkIdType memoryLimit)
+{
+  vtkSmartPointer<vtkNIFTIWriter> writer =
+    vtkSmartPointer<vtkNIFTIWriter>::New();
+#if (VTK_MAJOR_VERSION > 5)
+  writer->SetInputData(image);
+#else
+  writer->SetInput(image);
+#endif
+  writer->SetFileName(filename.c_str());
+  writer->SetTimeDimension(info->TimeDimension);
+  writer->SetQFac(info->QFac);
+  writer->SetPlanarRGB(info->PlanarRGB);
+  if (memoryLimit > 0)
+  {
+    writer->StreamingOn();
+    writer->SetMemoryLimit(memoryLimit);
+  }
+  writer->Write();
+  return (writer->GetErrorCode() == 0);
+}
+
+// read an image and check that it matches the original
+static bool CheckImage(
+  const std::string& filename, const ImageInfo *info, vtkImageData *image)
+{
+  vtkSmartPointer<vtkNIFTIReader> reader =
+    vtkSmartPointer<vtkNIFTIReader>::New();
+  reader->SetFileName(filename.c_str());
+  reader->SetPlanarRGB(info->PlanarRGB);
+  reader->Update();
+  if (reader->GetErrorCode() != 0)
+  {
+    return false;
+  }
+
+  vtkImageData *output = reader->GetOutput();
+  int extent[6], outExtent[6];
+  image->GetExtent(extent);
+  output->GetExtent(outExtent);
+  if (memcmp(extent, outExtent, sizeof(extent)) != 0 ||
+      output->GetScalarType() != image->GetScalarType() ||
+      output->GetNumberOfScalarComponents() !=
+        image->GetNumberOfScalarComponents())
+  {
+    return false;
+  }
+
+  size_t size = image->GetScalarSize();
+  size *= image->GetNumberOfScalarComponents();
+  size *= image->GetNumberOfPoints();
+  return (memcmp(output->GetScalarPointer(), image->GetScalarPointer(),
+                 size) == 0);
+}
+
+int main(int argc, char *argv[])
+{
+  int rval = 0;
+  const char *exename = (argc > 0 ? argv[0] : "TestNIFTIWriter");
+
+  // remove path portion of exename
+  const char *cp = exename + strlen(exename);
+  while (cp != exename && cp[-1] != '\\' && cp[-1] != '/') { --cp; }
+  exename = cp;
+
+  for (const ImageInfo *info = TestImages; info->Extension; info++)
+  {
+    // an image with an odd number of slices, so the last slab is short
+    vtkSmartPointer<vtkImageData> image =
+      vtkSmartPointer<vtkImageData>::New();
+    image->SetExtent(0, 63, 0, 47, 0, 22);
+    image->SetSpacing(0.9, 0.9, 1.5);
+#if (VTK_MAJOR_VERSION > 5)
+    image->AllocateScalars(info->ScalarType, info->NumberOfComponents);
+#else
+    image->SetScalarType(info->ScalarType);
+    image->SetNumberOfScalarComponents(info->NumberOfComponents);
+    image->AllocateScalars();
+#endif
+
+    // fill with a pattern that differs between slices and components,
+    // setting only one byte of each scalar so that any type is valid
+    size_t sliceSize = image->GetScalarSize();
+    sliceSize *= info->NumberOfComponents;
+    sliceSize *= 64*48;
+    unsigned char *data =
+      static_cast<unsigned char *>(image->GetScalarPointer());
+    size_t n = sliceSize*23;
+    memset(data, 0, n);
+    for (size_t i = 0; i < n; i += image->GetScalarSize())
+    {
+      data[i] = static_cast<unsigned char>((i*7 + i/sliceSize*13) & 0x3f);
+    }
+
+    // stream in slabs of three slices
+    vtkIdType memoryLimit =
+      static_cast<vtkIdType>((3*sliceSize + 1023)/1024);
+
+    std::string prefix = "TestNIFTIWriter_";
+    prefix.push_back(static_cast<char>('a' + (info - TestImages)));
+    std::string wholeName = prefix + "_whole" + info->Extension;
+    std::string slabName = prefix + "_slab" + info->Extension;
+
+    TestAssert(WriteImage(wholeName, info, image, 0));
+    TestAssert(WriteImage(slabName, info, image, memoryLimit));
+    TestAssert(CheckImage(wholeName, info, image));
+    TestAssert(CheckImage(slabName, info, image));
+
+    // the uncompressed files must be the same (for .hdr, both files)
+    std::vector<std::string> names;
+    names.push_back(wholeName);
+    names.push_back(slabName);
+    if (strcmp(info->Extension, ".hdr") == 0)
+    {
+      names.push_back(prefix + "_whole.img");
+      names.push_back(prefix + "_slab.img");
+    }
+    if (strcmp(info->Extension, ".nii.gz") != 0)
+    {
+      for (size_t i = 0; i < names.size(); i += 2)
+      {
+        std::vector<char> wholeData = ReadFile(names[i].c_str());
+        std::vector<char> slabData = ReadFile(names[i+1].c_str());
+        TestAssert(!wholeData.empty());
+        TestAssert(wholeData == slabData);
+      }
+    }
+
+    // the temporary file for compressed streaming must be gone
+    std::string partName = slabName + ".part";
+    TestAssert(vtkDICOMFile::Access(partName.c_str(), vtkDICOMFile::In) ==
+               vtkDICOMFile::FileNotFound);
+
+    // remove the files
+    for (size_t i = 0; i < names.size(); i++)
+    {
+      vtkDICOMFile::Remove(names[i].c_str());
+    }
+  }
+
+  return rval;
+}
@@ -3,7 +3,8 @@ Generate a C++ DICOM dictionary from a text file.
 
 This program will read a text file generated from the DICOM data
 element regsistry table (DICOM Chapter 6 part 6) and will generate
-a hash table that can be used for dictionary lookups.
+a hash table that can be used for dictionary lookups.  The hash tables
+are minimal perfect hash tables, so each lookup requires a single probe.
 
 Usage: python makedict.py nemadict.txt > vtkDICOMDictHash.cxx
 Usage: python makedict.py --header nemadict.txt > vtkDICOMDictHash.h
@@ -35,9 +36,6 @@ for arg in sys.argv[1:]:
       python makedict.py --header nemadict.txt > vtkDICOMDictHash.h\n""")
     sys.exit(1)
 
-# the hash table, in PYTHON
-htsize = 4096
-
 # collect private dictionaries
 privatelines = {}
 
@@ -100,6 +98,155 @@ def hashstring(s):
     h = ((h << 5) + h + ord(c)) & 0xffffffff
   return h
 
+def perfecthash(x):
+  """Scramble a 32-bit hash value with a multiplicative hash.
+  This must match vtkDICOMPerfectHash() in vtkDICOMDictionary.cxx.
+  """
+  return (x*0x9E3779B1) & 0xffffffff
+
+def perfectslot(h, d, m):
+  """Compute the slot for a scrambled hash value and a displacement.
+  This must match vtkDICOMPerfectHashLookup() in vtkDICOMDictionary.cxx.
+  """
+  return ((((h ^ d)*0x85EBCA6B) & 0xffffffff)*m) >> 32
+
+def makeperfect(items):
+  """Build a minimal perfect hash table with the "hash and displace"
+  method.  The items are (hash, index) pairs, and only the first of
+  any items with the same hash value is kept.  The table that is
+  returned contains the number of buckets "r", the number of slots "m",
+  the r displacements, and the index stored in each of the m slots.
+  """
+  keys = []
+  seen = {}
+  for x, j in items:
+    if not seen.has_key(x):
+      seen[x] = True
+      keys.append((perfecthash(x), j))
+
+  m = len(keys)
+  if m >= 0x8000:
+    sys.stderr.write("too many entries for perfect hash: %d\n" % (m,))
+    sys.exit(1)
+
+  # use an average of two keys per bucket
+  r = (m + 1)//2
+  if r == 0:
+    r = 1
+  buckets = [[] for b in range(r)]
+  for h, j in keys:
+    buckets[(h*r) >> 32].append((h, j))
+
+  # place the largest buckets first, while the table is empty
+  order = range(r)
+  order.sort(key=lambda b: -len(buckets[b]))
+  disp = [0]*r
+  slots = [None]*m
+  free = 0
+  for b in order:
+    bucket = buckets[b]
+    if len(bucket) > 1:
+      # search for a displacement that puts all keys into free slots
+      d = 1
+      while True:
+        trial = [perfectslot(h, d, m) for h, j in bucket]
+        if (len(set(trial)) == len(trial) and
+            all([slots[k] is None for k in trial])):
+          break
+        d = d + 1
+        if d >= 0x8000:
+          sys.stderr.write("failed to build perfect hash\n")
+          sys.exit(1)
+      for k, (h, j) in zip(trial, bucket):
+        slots[k] = j
+      disp[b] = d
+    elif len(bucket) == 1:
+      # a single key goes directly into the next free slot
+      while slots[free] is not None:
+        free = free + 1
+      slots[free] = bucket[0][1]
+      disp[b] = 0x8000 | free
+
+  return [r, m] + disp + slots
+
+def tagbucket(x, r):
+  """Compute the bucket for a tag, for a power-of-two number of buckets.
+  The group is scrambled, but the element is not, so that the buckets
+  for the elements of a group are in the same order as the elements.
+  This must match vtkDICOMOrderedHashLookup() in vtkDICOMDictionary.cxx.
+  """
+  g = (x >> 16)
+  e = (x & 0xffff)
+  h = ((g*0x9E3779B1) & 0xffffffff) >> 16
+  return (h + (e ^ ((e >> 12)*0x9E3))) & (r - 1)
+
+def orderedslot(x, s, n):
+  """Compute the slot within a bucket of size n for a seed s.
+  This must match vtkDICOMOrderedHashLookup() in vtkDICOMDictionary.cxx.
+  """
+  y = ((((x ^ s)*0x85EBCA6B) & 0xffffffff) >> 16)
+  return (y*n) >> 16
+
+def makeordered(items):
+  """Build a minimal perfect hash table for tags, where the buckets are
+  chosen with tagbucket() so that the buckets for nearby tags are close
+  together, and the slots for each bucket follow the slots for the
+  previous bucket.  The items are (tag, index) pairs, and only the first
+  of any items with the same tag is kept.  The table that is returned
+  contains the number of buckets "r", the number of slots "m", a (base,
+  seed) pair for each bucket plus a final pair (m, 0), the index stored
+  in each of the m slots, and a final slot that holds 0xFFFF.
+  """
+  keys = []
+  seen = {}
+  for x, j in items:
+    if not seen.has_key(x):
+      seen[x] = True
+      keys.append((x, j))
+
+  m = len(keys)
+  if m >= 0x8000:
+    sys.stderr.write("too many entries for perfect hash: %d\n" % (m,))
+    sys.exit(1)
+
+  # use a power of two for the number of buckets, with an average of at
+  # most two keys per bucket, and double it if a bucket cannot be
+  # placed
+  r = 1
+  while 2*r < m:
+    r = 2*r
+  while True:
+    buckets = [[] for b in range(r)]
+    for x, j in keys:
+      buckets[tagbucket(x, r)].append((x, j))
+    table = [r, m]
+    slots = []
+    for bucket in buckets:
+      n = len(bucket)
+      s = 0
+      if n > 1:
+        # search for a seed that puts the keys into different slots
+        while s <= 0xFFFF:
+          trial = [orderedslot(x, s, n) for x, j in bucket]
+          if len(set(trial)) == n:
+            break
+          s = s + 1
+        if s > 0xFFFF:
+          break
+        ordered = [None]*n
+        for k, (x, j) in zip(trial, bucket):
+          ordered[k] = j
+      else:
+        ordered = [j for x, j in bucket]
+      table.extend([len(slots), s])
+      slots.extend(ordered)
+    else:
+      return table + [m, 0] + slots + [0xFFFF]
+    if r >= 0x8000:
+      sys.stderr.write("failed to build perfect hash\n")
+      sys.exit(1)
+    r = 2*r
+
 def makedict(lines, creator="DICOM"):
   # the tables that will be created
   enum_list = []
@@ -109,11 +256,14 @@ def makedict(lines, creator="DICOM"):
   # a set to keep track of all VM strings encountered
   vms = {}
 
-  htsize = 4096
-  if privatedict:
-    htsize = int(len(lines)/6)
-    if htsize == 0:
-      htsize = 1
+  # the (hash, index) pairs for the tags and the keys
+  tag_items = []
+  key_items = []
+
+  # private dictionaries are small, so they use chained hash tables
+  htsize = int(len(lines)/6)
+  if htsize == 0:
+    htsize = 1
 
   ht = [None]*htsize
   ht2 = [None]*htsize
@@ -212,24 +362,25 @@ def makedict(lines, creator="DICOM"):
       element_list.append(
         "{ 0x%s, 0x%s, %s, VR::%s, VM::%s, \"%s\" }," % (g, e, ret, vr, vm, key))
 
-      # create a 16-bit hash from group, element
-      h = ((gi ^ (gi >> 6)) ^ (ei ^ (ei >> 6)))
+      # the tag itself is used as the hash for the tag table
+      tag_items.append(((gi << 16) | ei, j))
 
-      # create a string hash
-      hkey = hashstring(key)
-
-      # build the hash tables
-      h = (h % htsize)
+      # create the chained hash for the tag table
+      h = ((gi ^ (gi >> 6)) ^ (ei ^ (ei >> 6))) % htsize
       if ht[h] == None:
         ht[h] = []
-      h2 = (hkey % htsize)
-      if ht2[h2] == None:
-        ht2[h2] = []
-
-      # build the index table
       ht[h].append(j)
       ht[h].append(ei)
 
+      # create a string hash
+      hkey = hashstring(key)
+      if key:
+        key_items.append((hkey, j))
+
+      # create the chained hash for the key table
+      h2 = hkey % htsize
+      if ht2[h2] == None:
+        ht2[h2] = []
       ht2[h2].append(j)
       ht2[h2].append((hkey//htsize) & 0xffff)
       j = j + 1
@@ -239,7 +390,13 @@ def makedict(lines, creator="DICOM"):
 
   # debug: print statistics about the hash table
   #print maxl, minl, k0, k4
-  return enum_list, element_list, ht, ht2
+  if privatedict:
+    tag_table = ht
+    key_table = ht2
+  else:
+    tag_table = makeordered(tag_items)
+    key_table = makeperfect(key_items)
+  return enum_list, element_list, tag_table, key_table
 
 # write the output file
 def printhead(enum_dict, classname):
@@ -277,6 +434,55 @@ def printhead(enum_dict, classname):
   print
   print "#endif /* %s_h */" % (classname,)
 
+# print a perfect hash table
+def printperfect(table, tablename):
+  print "const unsigned short %s[] = {" % (tablename,)
+  i = 0
+  for e in table:
+    print "%5d," % (e,),
+    i = i + 1
+    if i % 10 == 0:
+      print
+  if i % 10 != 0:
+    print
+  print "};"
+
+# print a chained hash table: the bucket offsets, followed by the buckets
+def printchained(table, tablename):
+  print "const unsigned short %s[] = {" % (tablename,)
+  i = 0
+  j = len(table) + 1
+  for l in table:
+    if l is None:
+      print "%5d," % (len(table),),
+      i = i + 1
+      if i % 10 == 0:
+        print
+    else:
+      print "%5d," % (j,),
+      i = i + 1
+      if i % 10 == 0:
+        print
+      j = j + len(l) + 1
+  print "%5d," % (0,),
+  i = i + 1
+  if i % 10 == 0:
+    print
+  for l in table:
+    if not (l is None):
+      print "%5d," % (len(l)/2,),
+      i = i + 1
+      if i % 10 == 0:
+        print
+      for e in l:
+        print "%5d," % (e,),
+        i = i + 1
+        if i % 10 == 0:
+          print
+  if i % 10 != 0:
+    print
+  print "};"
+
 def printbody(entry_dict, classname):
   print header
   print
@@ -309,39 +515,10 @@ def printbody(entry_dict, classname):
     print "};"
     for table,tagorkey in [(tag_table,"Tag"),(key_table,"Key")]:
       print
-      print "const unsigned short Dict%s%sHashTable[] = {" % (ds,tagorkey)
-      i = 0
-      j = len(table) + 1
-      for l in table:
-        if l is None:
-          print "%5d," % (len(table),),
-          i = i + 1
-          if i % 10 == 0:
-            print
-        else:
-          print "%5d," % (j,),
-          i = i + 1
-          if i % 10 == 0:
-            print
-          j = j + len(l) + 1
-      print "%5d," % (0,),
-      i = i + 1
-      if i % 10 == 0:
-        print
-      for l in table:
-        if not (l is None):
-          print "%5d," % (len(l)/2,),
-          i = i + 1
-          if i % 10 == 0:
-            print
-          for e in l:
-            print "%5d," % (e,),
-            i = i + 1
-            if i % 10 == 0:
-              print
-      if i % 10 != 0:
-        print
-      print "};"
+      if privatedict:
+        printchained(table, "Dict%s%sHashTable" % (ds,tagorkey))
+      else:
+        printperfect(table, "Dict%s%sPerfectHash" % (ds,tagorkey))
 
     if not privatedict:
       print
@@ -352,20 +529,40 @@ def printbody(entry_dict, classname):
       ds = "%03d" % (dn,)
     print "vtkDICOMDictionary::Dict %sDict%sData = {" % (ns,ds)
     print "\"%s\"," % (name,)
-    print "%d," % (len(tag_table),)
-    print "%d," % (len(entry_list),)
-    print "Dict%sTagHashTable," % (ds,)
-    print "Dict%sKeyHashTable," % (ds,)
-    print "Dict%sContents" % (ds,)
+    if privatedict:
+      # chained hash tables, no perfect hash
+      print "%d," % (len(tag_table),)
+      print "%d," % (len(entry_list),)
+      print "Dict%sTagHashTable," % (ds,)
+      print "Dict%sKeyHashTable," % (ds,)
+      print "Dict%sContents," % (ds,)
+      print "NULL,"
+      print "NULL"
+    else:
+      # perfect hash, no chained hash tables
+      print "%d," % (0,)
+      print "%d," % (len(entry_list),)
+      print "NULL,"
+      print "NULL,"
+      print "Dict%sContents," % (ds,)
+      print "Dict%sTagPerfectHash," % (ds,)
+      print "Dict%sKeyPerfectHash" % (ds,)
     print "};"
 
   if privatedict:
     print
+    print "// sorted by name, for vtkDICOMDictionary::AddPrivateDictionaryList()"
     print "vtkDICOMDictionary::Dict *PrivateDictData[] = {"
     dn = 0
+    numbered = []
     for item in entry_dict.items():
       dn = dn + 1
-      print "&Dict%03dData," % (dn,),
+      numbered.append((item[0], dn))
+    numbered.sort()
+    dn = 0
+    for name, dnum in numbered:
+      dn = dn + 1
+      print "&Dict%03dData," % (dnum,),
       if dn % 5 == 0:
         print
     print "NULL"
@@ -379,10 +576,8 @@ def printbody(entry_dict, classname):
     print "{"
     print "  if (%sInitializerCounter++ == 0)" % (classname,)
     print "  {"
-    print "    for (vtkDICOMDictionary::Dict **dp = PrivateDictData; *dp != NULL; dp++)"
-    print "    {"
-    print "      vtkDICOMDictionary::AddPrivateDictionary(*dp);"
-    print "    }"
+    print "    // the dictionaries are added on demand, when first looked up"
+    print "    vtkDICOMDictionary::AddPrivateDictionaryList(PrivateDictData);"
     print "  }"
     print "}"
     print
@@ -390,10 +585,7 @@ def printbody(entry_dict, classname):
     print "{"
     print "  if (--%sInitializerCounter == 0)" % (classname,)
     print "  {"
-    print "    for (vtkDICOMDictionary::Dict **dp = PrivateDictData; *dp != NULL; dp++)"
-    print "    {"
-    print "      vtkDICOMDictionary::RemovePrivateDictionary((*dp)->Name);"
-    print "    }"
+    print "    vtkDICOMDictionary::RemovePrivateDictionaryList(PrivateDictData);"
     print "  }"
     print "}"
 